@@ -0,0 +1,198 @@
+// Host build of the Arduino core, see Arduino.h
+
+#include "Arduino.h"
+#include <malloc.h>
+#include <stdarg.h>
+#include <new>
+
+uint64_t host_micros = 0;
+
+unsigned long
+millis() {
+  return (unsigned long)(host_micros / 1000);
+}
+
+unsigned long
+micros() {
+  return (unsigned long)host_micros;
+}
+
+void
+delay(unsigned long ms) {
+  host_micros += (uint64_t)ms * 1000;
+}
+
+void
+yield() {
+}
+
+EspClass ESP;
+
+// Roughly what the firmware has free once running
+uint32_t
+EspClass::getFreeHeap() {
+  return 30000;
+}
+
+// As the ESP8266 core, format on the stack and only allocate for long
+// output
+size_t
+Print::printf(const char *format, ...) {
+  va_list arg;
+  va_start(arg, format);
+  char temp[64];
+  char *buffer = temp;
+  size_t len = vsnprintf(temp, sizeof(temp), format, arg);
+  va_end(arg);
+  if (len > sizeof(temp) - 1) {
+    buffer = new char[len + 1];
+    va_start(arg, format);
+    vsnprintf(buffer, len + 1, format, arg);
+    va_end(arg);
+  }
+  len = write((const uint8_t *)buffer, len);
+  if (buffer != temp) {
+    delete[] buffer;
+  }
+  return len;
+}
+
+bool host_serial_echo = false;
+HardwareSerial Serial;
+HardwareSerial Serial1;
+
+size_t
+HardwareSerial::write(uint8_t c) {
+  if (host_serial_echo) {
+    fputc(c, stdout);
+  }
+  return 1;
+}
+
+size_t
+HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  if (host_serial_echo) {
+    fwrite(buffer, 1, size, stdout);
+  }
+  return size;
+}
+
+// -------------------------------------------------------------------
+// Heap counting, scripts/bench.sh links with
+//   -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
+// so every allocation made from the code under test comes through here.
+// new and delete are replaced to go through malloc and free.
+// -------------------------------------------------------------------
+HostHeap host_heap = { 0, 0, 0, 0, 0 };
+
+static void *
+host_heap_add(void *ptr) {
+  if (ptr) {
+    host_heap.live += malloc_usable_size(ptr);
+    if (host_heap.live > host_heap.peak) {
+      host_heap.peak = host_heap.live;
+    }
+  }
+  return ptr;
+}
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *
+__wrap_malloc(size_t size) {
+  host_heap.allocs++;
+  host_heap.bytes += size;
+  return host_heap_add(__real_malloc(size));
+}
+
+void *
+__wrap_calloc(size_t count, size_t size) {
+  host_heap.allocs++;
+  host_heap.bytes += count * size;
+  return host_heap_add(__real_calloc(count, size));
+}
+
+void *
+__wrap_realloc(void *ptr, size_t size) {
+  if (size > 0) {
+    host_heap.allocs++;
+    host_heap.bytes += size;
+  }
+  if (ptr) {
+    host_heap.frees++;
+    host_heap.live -= malloc_usable_size(ptr);
+  }
+  return host_heap_add(__real_realloc(ptr, size));
+}
+
+void
+__wrap_free(void *ptr) {
+  if (ptr) {
+    host_heap.frees++;
+    host_heap.live -= malloc_usable_size(ptr);
+  }
+  __real_free(ptr);
+}
+}
+
+void *
+operator new(size_t size) {
+  void *ptr = malloc(size ? size : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void *
+operator new[](size_t size) {
+  return operator new(size);
+}
+
+void
+operator delete(void *ptr) noexcept {
+  free(ptr);
+}
+
+void
+operator delete[](void *ptr) noexcept {
+  free(ptr);
+}
+
+void
+operator delete(void *ptr, size_t size) noexcept {
+  free(ptr);
+}
+
+void
+operator delete[](void *ptr, size_t size) noexcept {
+  free(ptr);
+}
+
+size_t
+Print::print(unsigned long value, int base) {
+  char buf[8 * sizeof(long) + 1];
+  char *s = buf + sizeof(buf);
+  *--s = '\0';
+  if (base < 2) {
+    base = 10;
+  }
+  do {
+    unsigned digit = value % base;
+    *--s = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    value /= base;
+  } while (value);
+  return write(s);
+}
+
+size_t
+Print::print(long value, int base) {
+  if (value < 0 && 10 == base) {
+    return print('-') + print((unsigned long)-value, base);
+  }
+  return print((unsigned long)value, base);
+}
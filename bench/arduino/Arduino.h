@@ -0,0 +1,93 @@
+// Host build of the parts of the Arduino core used by the benchmarks
+//
+// Just enough for the firmware sources under test to compile and run on
+// Linux, see bench/readme.md
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// No separate flash address space on the host
+class __FlashStringHelper;
+#define PROGMEM
+#define PGM_P               const char *
+#define PSTR(s)             (s)
+#define F(s)                (reinterpret_cast<const __FlashStringHelper *>(PSTR(s)))
+#define FPSTR(p)            (reinterpret_cast<const __FlashStringHelper *>(p))
+#define pgm_read_byte(p)    (*(const uint8_t *)(p))
+#define memcpy_P            memcpy
+#define strcpy_P            strcpy
+#define strncpy_P           strncpy
+#define strlen_P            strlen
+#define strcmp_P            strcmp
+#define strncmp_P           strncmp
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+
+using std::min;
+using std::max;
+
+// The clock is simulated, millis() and micros() only move when the
+// benchmark advances host_micros so runs are repeatable
+extern uint64_t host_micros;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+class EspClass
+{
+public:
+  uint32_t getFreeHeap();
+  uint32_t getChipId() { return 0x123456; }
+  uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+  uint32_t getFreeSketchSpace() { return 1024 * 1024; }
+  void eraseConfig() {}
+  void restart() {}
+  void reset() {}
+};
+
+extern EspClass ESP;
+
+// Heap use, counted when linked with the malloc wrappers, see
+// scripts/bench.sh
+struct HostHeap
+{
+  unsigned long allocs;       // malloc, and realloc to a new size
+  unsigned long frees;
+  unsigned long long bytes;   // Requested by the allocs
+  long long live;             // Allocated now, as malloc_usable_size()
+  long long peak;             // Highest live, reset it to live to measure
+};
+
+extern HostHeap host_heap;
+
+#include "WString.h"
+#include "Stream.h"
+
+// Output is formatted, as the firmware would, and then dropped unless
+// host_serial_echo is set
+class HardwareSerial : public Stream
+{
+public:
+  void begin(unsigned long baud) {}
+  int available() { return 0; }
+  int read() { return -1; }
+  int peek() { return -1; }
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
+};
+
+extern bool host_serial_echo;
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
@@ -0,0 +1,355 @@
+// Host build of the Arduino String, see WString.h
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "WString.h"
+
+String::String(const char *cstr) {
+  init();
+  if (cstr) {
+    copy(cstr, strlen(cstr));
+  }
+}
+
+String::String(const String &str) {
+  init();
+  *this = str;
+}
+
+String::String(String &&rval) {
+  init();
+  move(rval);
+}
+
+String::String(const __FlashStringHelper *str) {
+  init();
+  *this = str;
+}
+
+String::String(char c) {
+  init();
+  char buf[2] = { c, 0 };
+  *this = buf;
+}
+
+static const char *
+format_unsigned(char *end, unsigned long value, unsigned char base) {
+  *--end = '\0';
+  do {
+    unsigned digit = value % base;
+    *--end = digit < 10 ? '0' + digit : 'a' + digit - 10;
+    value /= base;
+  } while (value);
+  return end;
+}
+
+static const char *
+format_signed(char *end, long value, unsigned char base) {
+  if (value < 0 && 10 == base) {
+    char *s = (char *)format_unsigned(end, -(unsigned long)value, base);
+    *--s = '-';
+    return s;
+  }
+  return format_unsigned(end, (unsigned long)value, base);
+}
+
+String::String(unsigned char value, unsigned char base) {
+  init();
+  char buf[34];
+  *this = format_unsigned(buf + sizeof(buf), value, base);
+}
+
+String::String(int value, unsigned char base) {
+  init();
+  char buf[34];
+  *this = format_signed(buf + sizeof(buf), value, base);
+}
+
+String::String(unsigned int value, unsigned char base) {
+  init();
+  char buf[34];
+  *this = format_unsigned(buf + sizeof(buf), value, base);
+}
+
+String::String(long value, unsigned char base) {
+  init();
+  char buf[66];
+  *this = format_signed(buf + sizeof(buf), value, base);
+}
+
+String::String(unsigned long value, unsigned char base) {
+  init();
+  char buf[66];
+  *this = format_unsigned(buf + sizeof(buf), value, base);
+}
+
+String::String(double value, unsigned char decimalPlaces) {
+  init();
+  char buf[33];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  *this = buf;
+}
+
+String::~String() {
+  free(buffer);
+}
+
+void
+String::invalidate() {
+  free(buffer);
+  init();
+}
+
+bool
+String::reserve(unsigned int size) {
+  if (buffer && capacity >= size) {
+    return true;
+  }
+  if (changeBuffer(size)) {
+    if (0 == len) {
+      buffer[0] = 0;
+    }
+    return true;
+  }
+  return false;
+}
+
+bool
+String::changeBuffer(unsigned int maxStrLen) {
+  char *newbuffer = (char *)realloc(buffer, maxStrLen + 1);
+  if (newbuffer) {
+    buffer = newbuffer;
+    capacity = maxStrLen;
+    return true;
+  }
+  return false;
+}
+
+String &
+String::copy(const char *cstr, unsigned int length) {
+  if (!reserve(length)) {
+    invalidate();
+    return *this;
+  }
+  len = length;
+  memmove(buffer, cstr, length);
+  buffer[len] = 0;
+  return *this;
+}
+
+void
+String::move(String &rhs) {
+  free(buffer);
+  buffer = rhs.buffer;
+  capacity = rhs.capacity;
+  len = rhs.len;
+  rhs.init();
+}
+
+String &
+String::operator=(const String &rhs) {
+  if (this == &rhs) {
+    return *this;
+  }
+  if (rhs.buffer) {
+    copy(rhs.buffer, rhs.len);
+  } else {
+    invalidate();
+  }
+  return *this;
+}
+
+String &
+String::operator=(String &&rval) {
+  if (this != &rval) {
+    move(rval);
+  }
+  return *this;
+}
+
+String &
+String::operator=(const char *cstr) {
+  if (cstr) {
+    copy(cstr, strlen(cstr));
+  } else {
+    invalidate();
+  }
+  return *this;
+}
+
+String &
+String::operator=(const __FlashStringHelper *str) {
+  return *this = (const char *)str;
+}
+
+bool
+String::concat(const char *cstr, unsigned int length) {
+  unsigned int newlen = len + length;
+  if (!cstr) {
+    return false;
+  }
+  if (0 == length) {
+    return true;
+  }
+  if (!reserve(newlen)) {
+    return false;
+  }
+  memmove(buffer + len, cstr, length);
+  len = newlen;
+  buffer[len] = 0;
+  return true;
+}
+
+bool
+String::concat(const String &str) {
+  return concat(str.c_str(), str.len);
+}
+
+bool
+String::concat(const char *cstr) {
+  return cstr ? concat(cstr, strlen(cstr)) : false;
+}
+
+bool
+String::concat(const __FlashStringHelper *str) {
+  return concat((const char *)str);
+}
+
+bool
+String::concat(char c) {
+  return concat(&c, 1);
+}
+
+bool
+String::concat(unsigned char value) {
+  char buf[4];
+  return concat(format_unsigned(buf + sizeof(buf), value, 10));
+}
+
+bool
+String::concat(int value) {
+  char buf[12];
+  return concat(format_signed(buf + sizeof(buf), value, 10));
+}
+
+bool
+String::concat(unsigned int value) {
+  char buf[11];
+  return concat(format_unsigned(buf + sizeof(buf), value, 10));
+}
+
+bool
+String::concat(long value) {
+  char buf[21];
+  return concat(format_signed(buf + sizeof(buf), value, 10));
+}
+
+bool
+String::concat(unsigned long value) {
+  char buf[21];
+  return concat(format_unsigned(buf + sizeof(buf), value, 10));
+}
+
+bool
+String::concat(double value) {
+  char buf[33];
+  snprintf(buf, sizeof(buf), "%.2f", value);
+  return concat(buf);
+}
+
+bool
+String::equals(const String &str) const {
+  return len == str.len && 0 == memcmp(c_str(), str.c_str(), len);
+}
+
+bool
+String::equals(const char *cstr) const {
+  return 0 == strcmp(c_str(), cstr ? cstr : "");
+}
+
+bool
+String::startsWith(const String &prefix) const {
+  return len >= prefix.len && 0 == memcmp(c_str(), prefix.c_str(), prefix.len);
+}
+
+bool
+String::endsWith(const String &suffix) const {
+  return len >= suffix.len &&
+         0 == memcmp(c_str() + len - suffix.len, suffix.c_str(), suffix.len);
+}
+
+int
+String::indexOf(char ch, unsigned int fromIndex) const {
+  if (fromIndex >= len) {
+    return -1;
+  }
+  const char *found = strchr(buffer + fromIndex, ch);
+  return found ? found - buffer : -1;
+}
+
+int
+String::indexOf(const String &str, unsigned int fromIndex) const {
+  if (fromIndex >= len) {
+    return -1;
+  }
+  const char *found = strstr(buffer + fromIndex, str.c_str());
+  return found ? found - buffer : -1;
+}
+
+String
+String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+  if (beginIndex > endIndex) {
+    unsigned int temp = endIndex;
+    endIndex = beginIndex;
+    beginIndex = temp;
+  }
+  String out;
+  if (beginIndex >= len) {
+    return out;
+  }
+  if (endIndex > len) {
+    endIndex = len;
+  }
+  out.copy(buffer + beginIndex, endIndex - beginIndex);
+  return out;
+}
+
+long
+String::toInt() const {
+  return buffer ? atol(buffer) : 0;
+}
+
+String
+operator+(const String &lhs, const String &rhs) {
+  String s(lhs);
+  s.concat(rhs);
+  return s;
+}
+
+String
+operator+(const String &lhs, const char *rhs) {
+  String s(lhs);
+  s.concat(rhs);
+  return s;
+}
+
+String
+operator+(const char *lhs, const String &rhs) {
+  String s(lhs);
+  s.concat(rhs);
+  return s;
+}
+
+String
+operator+(const String &lhs, const __FlashStringHelper *rhs) {
+  String s(lhs);
+  s.concat(rhs);
+  return s;
+}
+
+String
+operator+(const String &lhs, char rhs) {
+  String s(lhs);
+  s.concat(rhs);
+  return s;
+}
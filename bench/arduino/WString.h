@@ -0,0 +1,96 @@
+// Host build of the Arduino String, see Arduino.h
+//
+// Keeps the heap behaviour of the ESP8266 core's String (one malloc'd
+// buffer, realloc'd to fit on every append, no small string optimisation)
+// so allocation counts measured on the host carry over.
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+class __FlashStringHelper;
+
+class String
+{
+  char *buffer;
+  unsigned int capacity;
+  unsigned int len;
+
+  void init() {
+    buffer = NULL;
+    capacity = 0;
+    len = 0;
+  }
+  void invalidate();
+  bool changeBuffer(unsigned int maxStrLen);
+  String &copy(const char *cstr, unsigned int length);
+  void move(String &rhs);
+
+public:
+  String(const char *cstr = "");
+  String(const String &str);
+  String(String &&rval);
+  String(const __FlashStringHelper *str);
+  explicit String(char c);
+  explicit String(unsigned char value, unsigned char base = 10);
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(double value, unsigned char decimalPlaces = 2);
+  ~String();
+
+  bool reserve(unsigned int size);
+  unsigned int length() const { return len; }
+  const char *c_str() const { return buffer ? buffer : ""; }
+
+  String &operator=(const String &rhs);
+  String &operator=(String &&rval);
+  String &operator=(const char *cstr);
+  String &operator=(const __FlashStringHelper *str);
+
+  bool concat(const String &str);
+  bool concat(const char *cstr);
+  bool concat(const char *cstr, unsigned int length);
+  bool concat(const __FlashStringHelper *str);
+  bool concat(char c);
+  bool concat(unsigned char value);
+  bool concat(int value);
+  bool concat(unsigned int value);
+  bool concat(long value);
+  bool concat(unsigned long value);
+  bool concat(double value);
+
+  template<typename T> String &operator+=(T rhs) {
+    concat(rhs);
+    return *this;
+  }
+
+  bool equals(const String &str) const;
+  bool equals(const char *cstr) const;
+  bool operator==(const String &rhs) const { return equals(rhs); }
+  bool operator==(const char *cstr) const { return equals(cstr); }
+  bool operator!=(const String &rhs) const { return !equals(rhs); }
+  bool operator!=(const char *cstr) const { return !equals(cstr); }
+  bool startsWith(const String &prefix) const;
+  bool endsWith(const String &suffix) const;
+
+  char operator[](unsigned int index) const {
+    return index < len ? buffer[index] : 0;
+  }
+
+  int indexOf(char ch, unsigned int fromIndex = 0) const;
+  int indexOf(const String &str, unsigned int fromIndex = 0) const;
+  String substring(unsigned int beginIndex) const {
+    return substring(beginIndex, len);
+  }
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+  long toInt() const;
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const char *lhs, const String &rhs);
+String operator+(const String &lhs, const __FlashStringHelper *rhs);
+String operator+(const String &lhs, char rhs);
@@ -0,0 +1,3 @@
+// Host build, see Arduino.h
+
+#pragma once
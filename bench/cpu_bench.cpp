@@ -0,0 +1,514 @@
+// Firmware hot path benchmark
+//
+// Times the code that runs for every status update or request, built from
+// the firmware sources, and counts the heap allocations each run makes.
+// Build and run with scripts/bench.sh cpu, see bench/readme.md
+
+#include <Arduino.h>
+#include <getopt.h>
+#include <time.h>
+
+#include <EEPROM.h>
+#include <ESPAsyncWebServer.h>
+
+#include "RapiSender.h"
+#include "RapiCommands.h"
+#include "config.h"
+#include "evse_snapshot.h"
+#include "firmware.h"
+#include "input.h"
+#include "mqtt.h"
+#include "openevse.h"
+#include "web_server.h"
+
+#define ARRAY_LENGTH(x) (sizeof(x)/sizeof((x)[0]))
+
+// web_server.cpp
+extern void handleStatus(AsyncWebServerRequest *request);
+extern void handleConfig(AsyncWebServerRequest *request);
+
+// -------------------------------------------------------------------
+// An EVSE that answers every command straight away with the same reply
+// for the command, so only the RapiSender code is measured
+// -------------------------------------------------------------------
+struct LoopbackReply
+{
+  const char *cmd;
+  const char *reply;
+};
+
+// The settings input.cpp reads, as a charging protocol 5 EVSE has them
+static const LoopbackReply loopback_replies[] = {
+  { "$G3", "$OK 0" },
+  { "$GA", "$OK 220 0" },
+  { "$GC", "$OK 6 32" },
+  { "$GE", "$OK 32 0229" },
+  { "$GH", "$OK 0" },
+  { "$GV", "$OK 5.1.0 5.0.1" },
+};
+
+class LoopbackEvse : public Stream
+{
+  char _replies[ARRAY_LENGTH(loopback_replies) + 1][32];
+  char _cmd[4];
+  uint8_t _cmdLen;
+  const char *_next;
+
+  static void _frame(char *buf, size_t size, const char *reply) {
+    uint8_t chk = 0;
+    for (const char *p = reply; *p; p++) {
+      chk ^= *p;
+    }
+    snprintf(buf, size, "%s^%02X\r", reply, chk);
+  }
+
+public:
+  // Reply to anything else, $GG
+  LoopbackEvse(const char *reply) : _cmdLen(0), _next(NULL) {
+    for (size_t i = 0; i < ARRAY_LENGTH(loopback_replies); i++) {
+      _frame(_replies[i], sizeof(_replies[i]), loopback_replies[i].reply);
+    }
+    _frame(_replies[ARRAY_LENGTH(loopback_replies)], sizeof(_replies[0]), reply);
+  }
+
+  size_t write(uint8_t c) {
+    if ('$' == c) {
+      _cmdLen = 0;
+    }
+    if (_cmdLen < 3) {
+      _cmd[_cmdLen++] = c;
+    }
+    if ('\r' == c) {
+      size_t i = 0;
+      while (i < ARRAY_LENGTH(loopback_replies) &&
+             0 != strncmp(_cmd, loopback_replies[i].cmd, 3)) {
+        i++;
+      }
+      _next = _replies[i];
+    }
+    return 1;
+  }
+  size_t write(const uint8_t *buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+      write(buffer[i]);
+    }
+    return size;
+  }
+  using Print::write;
+
+  int available() {
+    return _next ? strlen(_next) : 0;
+  }
+  int read() {
+    if (NULL == _next) {
+      return -1;
+    }
+    int c = *_next++;
+    if ('\0' == *_next) {
+      _next = NULL;
+    }
+    return c;
+  }
+  int peek() {
+    return _next ? *_next : -1;
+  }
+};
+
+static LoopbackEvse evse("$OK 16000 240000");
+RapiSender rapiSender(&evse);
+
+struct BenchCase
+{
+  const char *name;
+  void (*run)();
+  size_t (*output)(String *out);  // What the last run produced
+  bool rate;                      // Report the output in KB/s
+};
+
+// Set for the warm up run, so the output is kept to be printed
+static bool keep_output = false;
+
+static uint64_t
+cpu_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// -------------------------------------------------------------------
+// The cases
+// -------------------------------------------------------------------
+
+// Status for EmonCMS and MQTT, built every update_rapi_values()
+static void
+run_rapi_json() {
+  create_rapi_json();
+}
+
+static size_t
+output_rapi_json(String *out) {
+  *out = data;
+  return data.length();
+}
+
+// data from create_rapi_json() split in to one message per value, the
+// messages are printed by PubSubClient with --verbose
+static void
+run_mqtt_publish() {
+  mqtt_publish(data);
+}
+
+static size_t
+output_mqtt_publish(String *out) {
+  return data.length();
+}
+
+static String last_body;
+static size_t last_response = 0;
+
+static void
+run_request(void (*handler)(AsyncWebServerRequest *), const char *url) {
+  AsyncWebServerRequest request(HTTP_GET, url);
+  handler(&request);
+
+  AsyncWebServerResponse *response = request.response();
+  last_response = response ? response->benchBody(keep_output ? &last_body : NULL) : 0;
+}
+
+static void
+run_status() {
+  run_request(handleStatus, "/status");
+}
+
+static void
+run_config() {
+  run_request(handleConfig, "/config");
+}
+
+static size_t
+output_response(String *out) {
+  *out = last_body;
+  return last_response;
+}
+
+// A $GG as update_rapi_values() sends it, queued, framed, answered,
+// tokenised and parsed
+static long milliAmps = 0;
+
+static void
+run_rapi_gg() {
+  bool done = false;
+  rapiSender.sendCmd<RapiReplyGG>(RAPI_CMD_GG, [&done](int ret, const RapiReplyGG &gg) {
+    milliAmps = gg.milliAmps;
+    done = true;
+  });
+  while (!done) {
+    rapiSender.loop();
+  }
+}
+
+static size_t
+output_rapi_gg(String *out) {
+  *out = rapiSender.getResponse();
+  return out->length();
+}
+
+// Finding the handler for a mix of page, API and unknown requests, the
+// work done for every request before its handler runs
+struct DispatchRequest
+{
+  int method;
+  const char *url;
+};
+
+static const DispatchRequest dispatch_requests[] = {
+  { HTTP_GET,  "/" },
+  { HTTP_GET,  "/home.js" },
+  { HTTP_GET,  "/style.css" },
+  { HTTP_GET,  "/ws" },
+  { HTTP_GET,  "/status" },
+  { HTTP_GET,  "/config" },
+  { HTTP_GET,  "/r" },
+  { HTTP_GET,  "/rapi/stats" },
+  { HTTP_POST, "/update" },
+  { HTTP_GET,  "/favicon.ico" },
+};
+
+#define DISPATCH_COUNT (sizeof(dispatch_requests) / sizeof(dispatch_requests[0]))
+
+// Made once, the server parses the URL whatever handles it
+static std::vector<AsyncWebServerRequest *> dispatch_list;
+static size_t dispatch_found = 0;
+
+static void
+run_dispatch() {
+  if (dispatch_list.empty()) {
+    for (size_t i = 0; i < DISPATCH_COUNT; i++) {
+      dispatch_list.push_back(new AsyncWebServerRequest(dispatch_requests[i].method, dispatch_requests[i].url));
+    }
+  }
+
+  dispatch_found = 0;
+  for (size_t i = 0; i < DISPATCH_COUNT; i++)
+  {
+    AsyncWebServerRequest *request = dispatch_list[i];
+    AsyncWebHandler *handler = server.benchRoute(request);
+    request->_tempObject = NULL;
+    if (handler != server.benchNotFound()) {
+      dispatch_found++;
+    }
+    if (keep_output) {
+      printf("%-6s %-12s %s\n", HTTP_GET == request->method() ? "GET" : "POST",
+             request->url().c_str(), handler != server.benchNotFound() ? "found" : "not found");
+    }
+  }
+}
+
+static size_t
+output_dispatch(String *out) {
+  return dispatch_found;
+}
+
+// The largest web UI file, gzipped, found, sent through a TCP window of
+// TCP_SND_BUF and acked a window at a time
+static unsigned long static_adds = 0;
+
+static void
+run_static_file() {
+  AsyncWebServerRequest request(HTTP_GET, "/lib.js");
+  request.addHeader("Accept-Encoding", "gzip, deflate");
+  server.benchRoute(&request)->handleRequest(&request);
+  last_response = request.benchTransfer();
+  static_adds = request.client()->benchAdds();
+}
+
+static size_t
+output_static_file(String *out) {
+  *out = "TCP adds " + String(static_adds);
+  return last_response;
+}
+
+// The same file when the browser has it cached, it has to get a 304 with
+// no body
+static String static_etag;        // From a 200 for the file, at setup
+static int static_code = 0;
+
+static void
+run_static_not_modified() {
+  AsyncWebServerRequest request(HTTP_GET, "/lib.js");
+  request.addHeader("Accept-Encoding", "gzip, deflate");
+  request.addHeader("If-None-Match", static_etag);
+  server.benchRoute(&request)->handleRequest(&request);
+  last_response = request.benchTransfer();
+  static_code = request.response()->code();
+}
+
+static size_t
+output_static_not_modified(String *out) {
+  *out = "ETag " + static_etag + " HTTP " + String(static_code);
+  if (304 != static_code) {
+    fprintf(stderr, "static /lib.js 304: got HTTP %d for If-None-Match: %s\n",
+            static_code, static_etag.c_str());
+    exit(1);
+  }
+  return last_response;
+}
+
+// config_load_settings() appends to the strings, empty them as after a
+// reset
+static void
+config_clear() {
+  String *strings[] = {
+    &esid, &epass, &www_username, &www_password,
+    &emoncms_server, &emoncms_node, &emoncms_apikey, &emoncms_fingerprint,
+    &mqtt_server, &mqtt_topic, &mqtt_user, &mqtt_pass, &mqtt_solar, &mqtt_grid_ie,
+    &ohm
+  };
+  for (size_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++) {
+    *strings[i] = String();
+  }
+}
+
+// The EEPROM part of setup()
+static void
+run_config_load() {
+  config_clear();
+  config_load_settings();
+}
+
+static size_t
+output_config_load(String *out) {
+  *out = esid + " " + emoncms_server + " " + mqtt_server;
+  return esid.length() + epass.length() + www_username.length() + www_password.length() +
+         emoncms_server.length() + emoncms_node.length() + emoncms_apikey.length() +
+         emoncms_fingerprint.length() + mqtt_server.length() + mqtt_topic.length() +
+         mqtt_user.length() + mqtt_pass.length() + mqtt_solar.length() +
+         mqtt_grid_ie.length() + ohm.length();
+}
+
+static const BenchCase cases[] = {
+  { "create_rapi_json",     run_rapi_json,           output_rapi_json,           false },
+  { "mqtt_publish",         run_mqtt_publish,        output_mqtt_publish,        false },
+  { "/status",              run_status,              output_response,            false },
+  { "/config",              run_config,              output_response,            false },
+  { "rapi $GG",             run_rapi_gg,             output_rapi_gg,             false },
+  { "config_load_settings", run_config_load,         output_config_load,         false },
+  { "web dispatch x10",     run_dispatch,            output_dispatch,            false },
+  { "static /lib.js",       run_static_file,         output_static_file,         true },
+  { "static /lib.js 304",   run_static_not_modified, output_static_not_modified, false },
+};
+
+#define CASE_COUNT (sizeof(cases) / sizeof(cases[0]))
+
+// -------------------------------------------------------------------
+// A configured, charging EVSE so every field is in the output
+// -------------------------------------------------------------------
+static void
+setup_firmware() {
+  EEPROM.begin(1024);
+  config_save_wifi("bench-network", "bench-password");
+  config_save_admin("admin", "secret");
+  config_save_emoncms(true, "data.openevse.com/emoncms", "openevse",
+                      "0123456789abcdef0123456789abcdef",
+                      "7D:82:15:BE:D7:BC:72:58:87:7D:8E:40:D4:80:BA:1A:9F:8B:8D:DA");
+  config_save_mqtt(true, "mqtt.local", "openevse", "mqtt-user", "mqtt-pass",
+                   "solar/power", "grid/power");
+  config_save_ohm(false, "");
+  run_config_load();
+
+  // No authentication, the fake request always passes but the check
+  // would still be timed
+  www_username = "";
+
+  evse_snapshot_begin();
+  evse_snapshot_set(EVSE_AMP, 16000);
+  evse_snapshot_set(EVSE_VOLT, 240000);
+  evse_snapshot_set(EVSE_POWER, 3840);
+  evse_snapshot_set(EVSE_TEMP1, 235);
+  evse_snapshot_set(EVSE_TEMP2, 241);
+  evse_snapshot_set(EVSE_TEMP3, 0);
+  evse_snapshot_set(EVSE_PILOT, 32);
+  evse_snapshot_set(EVSE_STATE, OPENEVSE_STATE_CHARGING);
+  evse_snapshot_set(EVSE_ELAPSED, 3600);
+  evse_snapshot_set(EVSE_WATTSEC, 13824000);
+  evse_snapshot_set(EVSE_WATTHOUR, 1234567);
+  evse_snapshot_set(EVSE_GFCI_COUNT, 0);
+  evse_snapshot_set(EVSE_NOGND_COUNT, 1);
+  evse_snapshot_set(EVSE_STUCK_COUNT, 0);
+  evse_snapshot_commit();
+
+  // The settings, read from the EVSE as input.cpp does once it is found
+  for (int i = 0; i < RAPI_SETTING_COUNT; i++) {
+    while (!rapi_setting_valid((RapiSetting)i)) {
+      update_rapi_settings();
+      while (rapiSender.isBusy()) {
+        rapiSender.loop();
+      }
+    }
+  }
+
+  create_rapi_json();
+
+  web_server_setup();
+
+  AsyncWebServerRequest request(HTTP_GET, "/lib.js");
+  server.benchRoute(&request)->handleRequest(&request);
+  static_etag = request.response()->benchHeader("ETag");
+}
+
+static void
+usage(const char *name) {
+  printf(
+    "Usage: %s [options]\n"
+    "  -n, --iterations=N  runs of each case (10000)\n"
+    "  -c, --case=NAME     only run the cases with NAME in their name\n"
+    "  -v, --verbose       print the output of each case once\n",
+    name);
+}
+
+int
+main(int argc, char **argv) {
+  unsigned long iterations = 10000;
+  const char *only = NULL;
+
+  static const struct option options[] = {
+    { "iterations", required_argument, NULL, 'n' },
+    { "case",       required_argument, NULL, 'c' },
+    { "verbose",    no_argument,       NULL, 'v' },
+    { "help",       no_argument,       NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+
+  int opt;
+  while (-1 != (opt = getopt_long(argc, argv, "n:c:vh", options, NULL)))
+  {
+    switch (opt)
+    {
+      case 'n': iterations = strtoul(optarg, NULL, 10); break;
+      case 'c': only = optarg; break;
+      case 'v': bench_verbose = true; break;
+      default:
+        usage(argv[0]);
+        return 'h' == opt ? 0 : 1;
+    }
+  }
+  if (optind != argc || 0 == iterations) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  bool verbose = bench_verbose;
+  bench_verbose = false;
+  setup_firmware();
+
+  printf("%-22s %10s %10s %10s %10s %10s %10s\n",
+         "case", "ns/op", "allocs/op", "bytes/op", "peak bytes", "out bytes", "KB/s");
+
+  for (size_t i = 0; i < CASE_COUNT; i++)
+  {
+    const BenchCase &test = cases[i];
+    if (only && NULL == strstr(test.name, only)) {
+      continue;
+    }
+
+    // Once to warm up, so the first run's one off allocations are not
+    // counted
+    bench_verbose = verbose;
+    keep_output = verbose;
+    test.run();
+    bench_verbose = false;
+    keep_output = false;
+
+    String out;
+    size_t outLength = test.output(&out);
+    if (verbose && out.length() > 0) {
+      printf("%s\n", out.c_str());
+    }
+
+    HostHeap heap = host_heap;
+    long long peak = 0;
+    uint64_t host = cpu_ns();
+    for (unsigned long n = 0; n < iterations; n++)
+    {
+      long long live = host_heap.live;
+      host_heap.peak = live;
+      test.run();
+      if (host_heap.peak - live > peak) {
+        peak = host_heap.peak - live;
+      }
+    }
+    host = cpu_ns() - host;
+
+    printf("%-22s %10.0f %10.1f %10.0f %10lld %10zu", test.name,
+           (double)host / iterations,
+           (double)(host_heap.allocs - heap.allocs) / iterations,
+           (double)(host_heap.bytes - heap.bytes) / iterations,
+           peak, outLength);
+    if (test.rate) {
+      printf(" %10.0f", (double)outLength * iterations * 1000000000.0 / host / 1024);
+    }
+    printf("\n");
+  }
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+// Stand ins for the firmware modules that talk to the network, the
+// benchmarks build everything else from src/. Config is left at the
+// defaults unless a benchmark sets it, so the EmonCMS, MQTT and Ohm
+// Connect services are off.
+
+#include "firmware.h"
+#include "emoncms.h"
+#include "event.h"
+#include "config.h"
+#include "mqtt.h"
+#include "ohm.h"
+#include "web_server.h"
+#include "wifi.h"
+
+#include <EEPROM.h>
+#include <ESP8266WiFi.h>
+
+bool bench_verbose = false;
+
+unsigned long bench_mqtt_publishes = 0;
+unsigned long bench_web_events = 0;
+
+// Arduino libraries
+ESP8266WiFiClass WiFi;
+UpdaterClass Update;
+EEPROMClass EEPROM;
+
+// src.ino
+void
+event_send(String event)
+{
+  web_server_event(event);
+
+  if (config_mqtt_enabled()) {
+    mqtt_publish(event);
+  }
+}
+
+// Linker script symbols bounding the SPIFFS partition, only used to size
+// an update so never read by the benchmarks
+extern "C" {
+uint32_t _SPIFFS_start;
+uint32_t _SPIFFS_end;
+}
+
+// wifi.cpp
+String st = "";
+String rssi = "";
+String ipaddress = "192.168.1.2";
+const char *esp_hostname = "openevse";
+
+bool
+wifi_client_connected() {
+  return true;
+}
+
+void
+wifi_scan() {
+}
+
+void
+wifi_restart() {
+}
+
+void
+wifi_disconnect() {
+}
+
+void
+wifi_turn_on_ap() {
+  if (bench_verbose) {
+    printf("%10.3f wifi AP on\n", millis() / 1000.0);
+  }
+}
+
+void
+wifi_turn_off_ap() {
+  if (bench_verbose) {
+    printf("%10.3f wifi AP off\n", millis() / 1000.0);
+  }
+}
+
+// emoncms.cpp
+boolean emoncms_connected = false;
+unsigned long packets_sent = 0;
+unsigned long packets_success = 0;
+
+void
+emoncms_publish(String url) {
+  packets_sent++;
+}
+
+// ohm.cpp
+String ohm_hour = "NotConnected";
+
+void
+ohm_loop() {
+}
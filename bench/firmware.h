@@ -0,0 +1,15 @@
+// Stand ins for the firmware modules the code under test calls but the
+// benchmarks don't run, see firmware.cpp
+
+#ifndef _BENCH_FIRMWARE_H
+#define _BENCH_FIRMWARE_H
+
+#include <Arduino.h>
+
+// Print what would have been sent to MQTT and the web server
+extern bool bench_verbose;
+
+extern unsigned long bench_mqtt_publishes;
+extern unsigned long bench_web_events;
+
+#endif // _BENCH_FIRMWARE_H
@@ -0,0 +1,28 @@
+// Host build of the ESP8266 EEPROM emulation, a RAM array
+#pragma once
+
+#include <Arduino.h>
+
+#define BENCH_EEPROM_SIZE 4096
+
+class EEPROMClass
+{
+  uint8_t _data[BENCH_EEPROM_SIZE];
+  size_t _size;
+
+public:
+  EEPROMClass() : _size(0) {
+    memset(_data, 0xff, sizeof(_data));
+  }
+  void begin(size_t size) { _size = size < sizeof(_data) ? size : sizeof(_data); }
+  uint8_t read(int address) { return address < _size ? _data[address] : 0; }
+  void write(int address, uint8_t value) {
+    if (address < _size) {
+      _data[address] = value;
+    }
+  }
+  bool commit() { return true; }
+  void end() {}
+};
+
+extern EEPROMClass EEPROM;
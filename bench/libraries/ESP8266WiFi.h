@@ -0,0 +1,42 @@
+// Host build stub, the benchmarks run as if connected to a network in
+// station mode
+#pragma once
+
+#include <Arduino.h>
+
+enum WiFiMode { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 };
+
+class ESP8266WiFiClass
+{
+public:
+  WiFiMode getMode() { return WIFI_STA; }
+  String SSID() { return "bench"; }
+  String SSID(uint8_t i) { return "bench"; }
+  int32_t RSSI() { return -60; }
+  int32_t RSSI(uint8_t i) { return -60; }
+  String BSSIDstr(uint8_t i) { return "00:00:00:00:00:00"; }
+  int32_t channel(uint8_t i) { return 1; }
+  uint8_t encryptionType(uint8_t i) { return 4; }
+  bool isHidden(uint8_t i) { return false; }
+  int8_t scanNetworks(bool async = false, bool show_hidden = false) { return 0; }
+  int8_t scanComplete() { return 0; }
+  void scanDelete() {}
+};
+
+extern ESP8266WiFiClass WiFi;
+
+#define U_FLASH   0
+#define U_SPIFFS  100
+
+class UpdaterClass
+{
+public:
+  bool begin(size_t size, int command = U_FLASH) { return false; }
+  size_t write(uint8_t *data, size_t len) { return 0; }
+  bool end(bool evenIfRemaining = false) { return false; }
+  bool hasError() { return true; }
+  void printError(Print &out) {}
+  void runAsync(bool async) {}
+};
+
+extern UpdaterClass Update;
@@ -0,0 +1,54 @@
+// Host build of the parts of ESPAsyncTCP the web server uses
+//
+// Enough of a TCP connection to send a response through. add() takes as
+// much as space() allows and copies it, as lwIP copies it in to a pbuf, and
+// the space is freed when the benchmark acks what was sent.
+#pragma once
+
+#include <Arduino.h>
+
+#define TCP_MSS     1460
+#define TCP_SND_BUF (2 * TCP_MSS)
+
+#define ASYNC_WRITE_FLAG_COPY 0x01
+
+class AsyncClient
+{
+  char _window[TCP_SND_BUF];
+  size_t _inFlight;
+  size_t _sent;
+  unsigned long _adds;
+
+public:
+  AsyncClient() : _inFlight(0), _sent(0), _adds(0) {}
+
+  size_t space() { return TCP_SND_BUF - _inFlight; }
+  size_t add(const char *data, size_t size, uint8_t apiflags = 0) {
+    size_t len = min(size, space());
+    memcpy(_window + _inFlight, data, len);
+    _inFlight += len;
+    _sent += len;
+    _adds++;
+    return len;
+  }
+  bool send() { return true; }
+  size_t write(const char *data, size_t size) {
+    size_t len = add(data, size);
+    send();
+    return len;
+  }
+
+  // Acks everything in flight, returns how much that was
+  size_t benchAck() {
+    size_t len = _inFlight;
+    _inFlight = 0;
+    return len;
+  }
+  size_t benchSent() const { return _sent; }
+  unsigned long benchAdds() const { return _adds; }
+  void benchReset() {
+    _inFlight = 0;
+    _sent = 0;
+    _adds = 0;
+  }
+};
@@ -0,0 +1,118 @@
+// Host build of the parts of ESPAsyncWebServer the web server uses, see
+// ESPAsyncWebServer.h
+
+#include "ESPAsyncWebServer.h"
+
+static const String empty_string;
+
+String
+AsyncWebServerResponse::_assembleHead(uint8_t version) {
+  String head = "HTTP/1." + String((int)version) + " " + String(_code) + "\r\n";
+  if (_sendContentLength) {
+    head += "Content-Length: " + String((unsigned long)_contentLength) + "\r\n";
+  }
+  if (_contentType.length()) {
+    head += "Content-Type: " + _contentType + "\r\n";
+  }
+  for (const AsyncWebHeader &header : _headers) {
+    head += header.toString();
+  }
+  head += "\r\n";
+  _headLength = head.length();
+  return head;
+}
+
+// Call the filler until it has nothing more, as the real response would
+// with a TCP window of TCP_MSS
+size_t
+AsyncCallbackResponse::benchBody(String *body) {
+  uint8_t buffer[TCP_MSS];
+  size_t total = 0;
+  while (!_chunked || 0 == _contentLength || total < _contentLength)
+  {
+    size_t want = sizeof(buffer);
+    if (!_chunked && _contentLength - total < want) {
+      want = _contentLength - total;
+    }
+    if (0 == want) {
+      break;
+    }
+    size_t len = _content(buffer, want, total);
+    if (0 == len) {
+      break;
+    }
+    if (body) {
+      body->concat((const char *)buffer, len);
+    }
+    total += len;
+  }
+  return total;
+}
+
+bool
+AsyncWebServerRequest::hasHeader(const String &name) const {
+  return nullptr != getHeader(name);
+}
+
+void
+AsyncWebServerRequest::addInterestingHeader(const String &name) {
+  for (const String &interesting : _interestingHeaders) {
+    if (0 == strcasecmp(interesting.c_str(), name.c_str())) {
+      return;
+    }
+  }
+  _interestingHeaders.push_back(name);
+}
+
+// As the library does once the handler is found
+void
+AsyncWebServerRequest::_removeNotInterestingHeaders() {
+  for (const String &interesting : _interestingHeaders) {
+    if (interesting == "ANY") {
+      return;
+    }
+  }
+
+  for (size_t i = _headers.size(); i-- > 0;) {
+    bool keep = false;
+    for (const String &interesting : _interestingHeaders) {
+      if (0 == strcasecmp(interesting.c_str(), _headers[i].name().c_str())) {
+        keep = true;
+        break;
+      }
+    }
+    if (!keep) {
+      _headers.erase(_headers.begin() + i);
+    }
+  }
+}
+
+AsyncWebHeader *
+AsyncWebServerRequest::getHeader(const String &name) const {
+  for (const AsyncWebHeader &header : _headers) {
+    if (0 == strcasecmp(header.name().c_str(), name.c_str())) {
+      return const_cast<AsyncWebHeader *>(&header);
+    }
+  }
+  return nullptr;
+}
+
+bool
+AsyncWebServerRequest::hasArg(const char *name) const {
+  for (const AsyncWebParameter &param : _params) {
+    if (param.name() == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+const String &
+AsyncWebServerRequest::arg(const String &name) const {
+  for (const AsyncWebParameter &param : _params) {
+    if (param.name() == name) {
+      return param.value();
+    }
+  }
+  return empty_string;
+}
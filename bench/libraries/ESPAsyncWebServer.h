@@ -0,0 +1,473 @@
+// Host build of the parts of ESPAsyncWebServer the web server uses
+//
+// Handlers can be called directly with an AsyncWebServerRequest made by
+// the benchmark, the response is kept in memory so the benchmarks can
+// check and measure it. Nothing is sent over a network.
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+// As the real library on the ESP8266
+#include <ESP8266WiFi.h>
+#include "ESPAsyncTCP.h"
+
+enum {
+  HTTP_GET     = 0b00000001,
+  HTTP_POST    = 0b00000010,
+  HTTP_DELETE  = 0b00000100,
+  HTTP_PUT     = 0b00001000,
+  HTTP_PATCH   = 0b00010000,
+  HTTP_HEAD    = 0b00100000,
+  HTTP_OPTIONS = 0b01000000,
+  HTTP_ANY     = 0b01111111,
+};
+typedef uint8_t WebRequestMethodComposite;
+
+enum {
+  RESPONSE_SETUP,
+  RESPONSE_HEADERS,
+  RESPONSE_CONTENT,
+  RESPONSE_WAIT_ACK,
+  RESPONSE_END,
+  RESPONSE_FAILED
+};
+
+class AsyncWebServerRequest;
+class AsyncWebServerResponse;
+class AsyncResponseStream;
+
+typedef std::function<size_t(uint8_t *buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+class AsyncWebHeader
+{
+  String _name;
+  String _value;
+
+public:
+  AsyncWebHeader(const String &name, const String &value) : _name(name), _value(value) {}
+  const String &name() const { return _name; }
+  const String &value() const { return _value; }
+  String toString() const { return _name + ": " + _value + "\r\n"; }
+};
+
+class AsyncWebParameter
+{
+  String _name;
+  String _value;
+
+public:
+  AsyncWebParameter(const String &name, const String &value) : _name(name), _value(value) {}
+  const String &name() const { return _name; }
+  const String &value() const { return _value; }
+  size_t size() const { return _value.length(); }
+  bool isFile() const { return false; }
+  bool isPost() const { return false; }
+};
+
+class AsyncWebServerResponse
+{
+protected:
+  int _code;
+  std::vector<AsyncWebHeader> _headers;
+  String _contentType;
+  size_t _contentLength;
+  bool _sendContentLength;
+  bool _chunked;
+  size_t _headLength;
+  size_t _sentLength;
+  size_t _ackedLength;
+  size_t _writtenLength;
+  int _state;
+
+public:
+  AsyncWebServerResponse() :
+    _code(0), _contentType(), _contentLength(0), _sendContentLength(true),
+    _chunked(false), _headLength(0), _sentLength(0), _ackedLength(0),
+    _writtenLength(0), _state(RESPONSE_SETUP) {}
+  virtual ~AsyncWebServerResponse() {}
+
+  void setCode(int code) { _code = code; }
+  int code() const { return _code; }
+  void setContentLength(size_t len) { _contentLength = len; }
+  void setContentType(const String &type) { _contentType = type; }
+  void addHeader(const String &name, const String &value) {
+    _headers.push_back(AsyncWebHeader(name, value));
+  }
+  String _assembleHead(uint8_t version);
+
+  // The value of a header added to the response, empty if there is none
+  String benchHeader(const String &name) const {
+    for (const AsyncWebHeader &header : _headers) {
+      if (header.name() == name) {
+        return header.value();
+      }
+    }
+    return String();
+  }
+
+  virtual bool _started() const { return _state > RESPONSE_SETUP; }
+  virtual bool _finished() const { return _state > RESPONSE_WAIT_ACK; }
+  virtual bool _failed() const { return _state == RESPONSE_FAILED; }
+  virtual bool _sourceValid() const { return false; }
+  virtual void _respond(AsyncWebServerRequest *request) { _state = RESPONSE_END; }
+  virtual size_t _ack(AsyncWebServerRequest *request, size_t len, uint32_t time) { return 0; }
+
+  // The body, as far as the bench can tell
+  virtual size_t benchBody(String *body) { return _contentLength; }
+};
+
+// Response with the body in a String
+class AsyncBasicResponse : public AsyncWebServerResponse
+{
+  String _content;
+
+public:
+  AsyncBasicResponse(int code, const String &contentType, const String &content) :
+    _content(content)
+  {
+    _code = code;
+    _contentType = contentType;
+    _contentLength = content.length();
+  }
+  bool _sourceValid() const { return true; }
+  size_t benchBody(String *body) {
+    if (body) {
+      *body = _content;
+    }
+    return _content.length();
+  }
+};
+
+// Response built with print(), the real one keeps the data in a cbuf that
+// grows as needed
+class AsyncResponseStream : public AsyncWebServerResponse, public Print
+{
+  String _content;
+
+public:
+  AsyncResponseStream(const String &contentType, size_t bufferSize) {
+    _code = 200;
+    _contentType = contentType;
+    _content.reserve(bufferSize);
+  }
+  bool _sourceValid() const { return true; }
+  size_t write(uint8_t c) {
+    _content.concat((char)c);
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t len) {
+    _content.concat((const char *)data, len);
+    return len;
+  }
+  using Print::write;
+  size_t benchBody(String *body) {
+    if (body) {
+      *body = _content;
+    }
+    return _content.length();
+  }
+};
+
+// Response filled by a callback, len is 0 for a chunked response
+class AsyncCallbackResponse : public AsyncWebServerResponse
+{
+  AwsResponseFiller _content;
+
+public:
+  AsyncCallbackResponse(const String &contentType, size_t len, AwsResponseFiller callback, bool chunked) :
+    _content(callback)
+  {
+    _code = 200;
+    _contentType = contentType;
+    _contentLength = len;
+    _chunked = chunked;
+  }
+  bool _sourceValid() const { return !!(_content); }
+  size_t benchBody(String *body);
+};
+
+class AsyncWebServerRequest
+{
+  std::vector<AsyncWebParameter> _params;
+  std::vector<AsyncWebHeader> _headers;
+  std::vector<String> _interestingHeaders;
+  String _url;
+  String _host;
+  String _contentType;
+  int _method;
+  AsyncWebServerResponse *_response;
+  AsyncClient _client;
+  std::function<void(void)> _onDisconnect;
+
+public:
+  void *_tempObject;
+
+  AsyncWebServerRequest(int method, const String &url) :
+    _url(url), _host("openevse.local"), _contentType(), _method(method),
+    _response(nullptr), _tempObject(nullptr) {}
+  // The library calls the disconnect handler and then deletes the request
+  ~AsyncWebServerRequest() {
+    if (_onDisconnect) {
+      _onDisconnect();
+    }
+    delete _response;
+  }
+
+  // Bench set up
+  void addArg(const String &name, const String &value) {
+    _params.push_back(AsyncWebParameter(name, value));
+  }
+  // Headers as the client sent them, the ones no handler asks for are
+  // dropped when the request is routed
+  void addHeader(const String &name, const String &value) {
+    _headers.push_back(AsyncWebHeader(name, value));
+  }
+  AsyncWebServerResponse *response() {
+    return _response;
+  }
+
+  // Sends the response as the library does, _respond() and then _ack()
+  // each time the client acks what was sent, returns the bytes sent
+  size_t benchTransfer() {
+    if (!_response) {
+      return 0;
+    }
+    _client.benchReset();
+    _response->_respond(this);
+    size_t acked;
+    while (!_response->_finished() && (acked = _client.benchAck()) > 0) {
+      _response->_ack(this, acked, millis());
+    }
+    return _client.benchSent();
+  }
+
+  AsyncClient *client() { return &_client; }
+  void onDisconnect(std::function<void(void)> fn) { _onDisconnect = fn; }
+  uint8_t version() const { return 1; }
+  int method() const { return _method; }
+  const String &url() const { return _url; }
+  const String &host() const { return _host; }
+  const String &contentType() const { return _contentType; }
+  size_t contentLength() const { return 0; }
+
+  bool authenticate(const char *username, const char *password) { return true; }
+  void requestAuthentication(const char *realm = NULL) { send(401); }
+
+  void addInterestingHeader(const String &name);
+  void _removeNotInterestingHeaders();
+  size_t headers() const { return _headers.size(); }
+  bool hasHeader(const String &name) const;
+  AsyncWebHeader *getHeader(const String &name) const;
+  AsyncWebHeader *getHeader(size_t num) const {
+    return num < _headers.size() ? const_cast<AsyncWebHeader *>(&_headers[num]) : nullptr;
+  }
+
+  size_t params() const { return _params.size(); }
+  AsyncWebParameter *getParam(size_t num) const {
+    return num < _params.size() ? const_cast<AsyncWebParameter *>(&_params[num]) : nullptr;
+  }
+  bool hasArg(const char *name) const;
+  const String &arg(const String &name) const;
+
+  void send(AsyncWebServerResponse *response) {
+    delete _response;
+    _response = response;
+  }
+  void send(int code, const String &contentType = String(), const String &content = String()) {
+    send(beginResponse(code, contentType, content));
+  }
+
+  AsyncWebServerResponse *beginResponse(int code, const String &contentType = String(), const String &content = String()) {
+    return new AsyncBasicResponse(code, contentType, content);
+  }
+  AsyncWebServerResponse *beginResponse(const String &contentType, size_t len, AwsResponseFiller callback) {
+    return new AsyncCallbackResponse(contentType, len, callback, false);
+  }
+  AsyncWebServerResponse *beginChunkedResponse(const String &contentType, AwsResponseFiller callback) {
+    return new AsyncCallbackResponse(contentType, 0, callback, true);
+  }
+  AsyncResponseStream *beginResponseStream(const String &contentType, size_t bufferSize = 1460) {
+    return new AsyncResponseStream(contentType, bufferSize);
+  }
+};
+
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)> ArBodyHandlerFunction;
+
+class AsyncWebHandler
+{
+protected:
+  String _username;
+  String _password;
+
+public:
+  virtual ~AsyncWebHandler() {}
+  AsyncWebHandler &setAuthentication(const char *username, const char *password) {
+    _username = username;
+    _password = password;
+    return *this;
+  }
+  virtual bool filter(AsyncWebServerRequest *request) { return true; }
+  virtual bool canHandle(AsyncWebServerRequest *request) { return false; }
+  virtual void handleRequest(AsyncWebServerRequest *request) {}
+  virtual void handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final) {}
+  virtual void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {}
+  virtual bool isRequestHandlerTrivial() { return true; }
+};
+
+// What server.on() adds, matched as the library matches it, the URI or
+// anything under it
+class AsyncCallbackWebHandler : public AsyncWebHandler
+{
+  String _uri;
+  WebRequestMethodComposite _method;
+  ArRequestHandlerFunction _onRequest;
+  ArUploadHandlerFunction _onUpload;
+
+public:
+  AsyncCallbackWebHandler() : _uri(), _method(HTTP_ANY), _onRequest(NULL), _onUpload(NULL) {}
+  void setUri(const String &uri) { _uri = uri; }
+  void setMethod(WebRequestMethodComposite method) { _method = method; }
+  void onRequest(ArRequestHandlerFunction fn) { _onRequest = fn; }
+  void onUpload(ArUploadHandlerFunction fn) { _onUpload = fn; }
+
+  bool canHandle(AsyncWebServerRequest *request) {
+    if (!_onRequest) {
+      return false;
+    }
+    if (!(_method & request->method())) {
+      return false;
+    }
+    if (_uri.length() && (_uri != request->url() && !request->url().startsWith(_uri + "/"))) {
+      return false;
+    }
+    request->addInterestingHeader("ANY");
+    return true;
+  }
+  void handleRequest(AsyncWebServerRequest *request) {
+    if (_onRequest) {
+      _onRequest(request);
+    } else {
+      request->send(500);
+    }
+  }
+  void handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final) {
+    if (_onUpload) {
+      _onUpload(request, filename, index, data, len, final);
+    }
+  }
+  bool isRequestHandlerTrivial() { return _onRequest ? false : true; }
+};
+
+class AsyncStaticWebHandler : public AsyncWebHandler
+{
+};
+
+class AsyncWebSocketClient
+{
+public:
+  uint32_t id() { return 0; }
+  void ping() {}
+};
+
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
+
+typedef struct {
+  uint8_t message_opcode;
+  uint32_t num;
+  uint8_t final;
+  uint8_t masked;
+  uint8_t opcode;
+  uint64_t len;
+  uint8_t mask[4];
+  uint64_t index;
+} AwsFrameInfo;
+
+extern unsigned long bench_web_events;
+extern bool bench_verbose;
+
+class AsyncWebSocket;
+typedef std::function<void(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)> AwsEventHandler;
+
+class AsyncWebSocket : public AsyncWebHandler
+{
+  String _url;
+
+public:
+  AsyncWebSocket(const String &url) : _url(url) {}
+  bool canHandle(AsyncWebServerRequest *request) {
+    return request->method() == HTTP_GET && request->url().equals(_url);
+  }
+  const char *url() const { return _url.c_str(); }
+  void onEvent(AwsEventHandler handler) {}
+  void textAll(const String &message) {
+    bench_web_events++;
+    if (bench_verbose) {
+      printf("%10.3f event %s\n", millis() / 1000.0, message.c_str());
+    }
+  }
+};
+
+// Handlers are tried in the order they were added, as the library does,
+// benchRoute() finds the one a request would go to
+class AsyncWebServer
+{
+  std::vector<AsyncWebHandler *> _handlers;
+  AsyncCallbackWebHandler _catchAll;
+  AsyncStaticWebHandler _static;
+
+  AsyncCallbackWebHandler &_on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload) {
+    AsyncCallbackWebHandler *handler = new AsyncCallbackWebHandler();
+    handler->setUri(uri);
+    handler->setMethod(method);
+    handler->onRequest(onRequest);
+    handler->onUpload(onUpload);
+    addHandler(handler);
+    return *handler;
+  }
+
+public:
+  AsyncWebServer(uint16_t port) {}
+
+  void begin() {}
+  AsyncWebHandler &addHandler(AsyncWebHandler *handler) {
+    _handlers.push_back(handler);
+    return *handler;
+  }
+
+  AsyncCallbackWebHandler &on(const char *uri, ArRequestHandlerFunction onRequest) {
+    return _on(uri, HTTP_ANY, onRequest, NULL);
+  }
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest) {
+    return _on(uri, method, onRequest, NULL);
+  }
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload) {
+    return _on(uri, method, onRequest, onUpload);
+  }
+
+  AsyncStaticWebHandler &serveStatic(const char *uri, void *fs, const char *path, const char *cache_control = NULL) { return _static; }
+
+  void onNotFound(ArRequestHandlerFunction fn) { _catchAll.onRequest(fn); }
+
+  // The handler for the request, or the not found handler, and then the
+  // headers it did not ask for are dropped
+  AsyncWebHandler *benchRoute(AsyncWebServerRequest *request) {
+    AsyncWebHandler *found = &_catchAll;
+    for (AsyncWebHandler *handler : _handlers) {
+      if (handler->filter(request) && handler->canHandle(request)) {
+        found = handler;
+        break;
+      }
+    }
+    if (&_catchAll == found) {
+      request->addInterestingHeader("ANY");
+    }
+    request->_removeNotInterestingHeaders();
+    return found;
+  }
+  AsyncWebHandler *benchNotFound() { return &_catchAll; }
+};
@@ -0,0 +1,2 @@
+// Host build stub, the benchmarks don't use the hash functions
+#pragma once
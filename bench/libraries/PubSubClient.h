@@ -0,0 +1,36 @@
+// Host build of PubSubClient, always connected, publish() only counts and
+// optionally prints the messages
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+#define MQTT_CALLBACK_SIGNATURE void (*callback)(char *, uint8_t *, unsigned int)
+
+extern unsigned long bench_mqtt_publishes;
+extern bool bench_verbose;
+
+class PubSubClient
+{
+public:
+  PubSubClient(Client &client) {}
+
+  PubSubClient &setServer(const char *domain, uint16_t port) { return *this; }
+  PubSubClient &setCallback(MQTT_CALLBACK_SIGNATURE) { return *this; }
+
+  bool connect(const char *id, const char *user, const char *pass,
+               const char *willTopic, uint8_t willQos, bool willRetain,
+               const char *willMessage) { return true; }
+  void disconnect() {}
+  bool publish(const char *topic, const char *payload) {
+    bench_mqtt_publishes++;
+    if (bench_verbose) {
+      printf("%10.3f mqtt %s %s\n", millis() / 1000.0, topic, payload);
+    }
+    return true;
+  }
+  bool subscribe(const char *topic) { return true; }
+  bool loop() { return true; }
+  bool connected() { return true; }
+  int state() { return 0; }
+};
@@ -0,0 +1,296 @@
+// RAPI link benchmark
+//
+// Runs RapiSender against the simulated EVSE and reports the throughput and
+// round trip latency of the blocking, async and pipelined ways of sending
+// commands. Build and run with scripts/bench.sh, see bench/readme.md
+
+#include <Arduino.h>
+#include <getopt.h>
+#include <time.h>
+#include <vector>
+
+#include "RapiSender.h"
+#include "sim_evse.h"
+
+// The mix of commands the firmware sends
+static const char *commands[] = {
+  "$GE",
+  "$GS",
+  "$GG",
+  "$GP",
+  "$GU",
+  "$GF",
+  "$SC 16 V",
+  "$FP 0 0 Benchmark",
+};
+
+#define COMMAND_COUNT (sizeof(commands) / sizeof(commands[0]))
+
+struct BenchResult
+{
+  const char *name;
+  unsigned long count;
+  unsigned long errors;
+  unsigned long events;
+  unsigned long overruns;
+  uint64_t linkUs;                // Simulated time for the whole run
+  uint64_t hostNs;                // CPU time the host took
+  std::vector<unsigned long> latency;
+};
+
+static unsigned long rapi_events = 0;
+
+static void
+on_rapi_event() {
+  rapi_events++;
+}
+
+static uint64_t
+cpu_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Send each command with the blocking API and wait for the response, as
+// the HTTP and MQTT RAPI pass through do
+static void
+bench_blocking(const SimEvseConfig &config, unsigned long count, BenchResult &result) {
+  SimEvse evse(config);
+  RapiSender rapi(&evse);
+  rapi.setOnEvent(on_rapi_event);
+  rapi.enableSequenceId(1);
+
+  uint64_t start = host_micros;
+  uint64_t host = cpu_ns();
+  for (unsigned long i = 0; i < count; i++)
+  {
+    uint64_t sent = host_micros;
+    if (RAPI_RESPONSE_OK != rapi.sendCmd(commands[i % COMMAND_COUNT])) {
+      result.errors++;
+    }
+    result.latency.push_back(host_micros - sent);
+  }
+
+  result.hostNs = cpu_ns() - host;
+  result.linkUs = host_micros - start;
+  result.overruns = evse.overruns;
+}
+
+// Keep depth commands queued with the async API, with or without the
+// sequence id that allows more than one to be in flight
+static void
+bench_async(const SimEvseConfig &config, unsigned long count, unsigned int depth,
+            bool sequenceId, BenchResult &result)
+{
+  SimEvse evse(config);
+  RapiSender rapi(&evse);
+  rapi.setOnEvent(on_rapi_event);
+  rapi.enableSequenceId(sequenceId ? 1 : 0);
+
+  unsigned long queued = 0;
+  unsigned long done = 0;
+
+  uint64_t start = host_micros;
+  uint64_t host = cpu_ns();
+  while (done < count)
+  {
+    while (queued < count && queued - done < depth)
+    {
+      uint64_t sent = host_micros;
+      rapi.sendCmd(commands[queued % COMMAND_COUNT], [&result, &done, sent](int ret)
+      {
+        if (RAPI_RESPONSE_OK != ret) {
+          result.errors++;
+        }
+        result.latency.push_back(host_micros - sent);
+        done++;
+      });
+      queued++;
+    }
+
+    rapi.loop();
+  }
+
+  result.hostNs = cpu_ns() - host;
+  result.linkUs = host_micros - start;
+  result.overruns = evse.overruns;
+}
+
+// Keep the LCD queue full of $FP writes while divert changes the charge
+// rate every 8th command, only the $SC latency is reported
+static void
+bench_priority(const SimEvseConfig &config, unsigned long count, BenchResult &result) {
+  SimEvse evse(config);
+  RapiSender rapi(&evse);
+  rapi.setOnEvent(on_rapi_event);
+  rapi.enableSequenceId(1);
+
+  unsigned long queued = 0;
+  unsigned long done = 0;
+  bool rateQueued = false;
+
+  uint64_t start = host_micros;
+  uint64_t host = cpu_ns();
+  while (done < count)
+  {
+    while (queued < count && rapi.getQueued(RAPI_SOURCE_LCD) < RAPI_SOURCE_QUOTA)
+    {
+      if (0 == queued % 8 && !rateQueued)
+      {
+        RapiSourceScope source(rapi, RAPI_SOURCE_DIVERT);
+        uint64_t sent = host_micros;
+        rateQueued = true;
+        rapi.sendCmd("$SC 16 V", [&result, &done, &rateQueued, sent](int ret)
+        {
+          if (RAPI_RESPONSE_OK != ret) {
+            result.errors++;
+          }
+          result.latency.push_back(host_micros - sent);
+          rateQueued = false;
+          done++;
+        });
+      }
+      else
+      {
+        RapiSourceScope source(rapi, RAPI_SOURCE_LCD);
+        rapi.sendCmd("$FP 0 0 Benchmark", [&result, &done](int ret)
+        {
+          if (RAPI_RESPONSE_OK != ret) {
+            result.errors++;
+          }
+          done++;
+        });
+      }
+      queued++;
+    }
+
+    rapi.loop();
+  }
+
+  result.hostNs = cpu_ns() - host;
+  result.linkUs = host_micros - start;
+  result.overruns = evse.overruns;
+}
+
+static unsigned long
+percentile(std::vector<unsigned long> &values, unsigned int pct) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  size_t i = (values.size() * pct + 99) / 100;
+  return values[i > 0 ? i - 1 : 0];
+}
+
+static void
+report(BenchResult &result) {
+  double seconds = result.linkUs / 1000000.0;
+  printf("%-10s %8lu %9.1f %9.2f %9.2f %7lu %7lu %8lu %9.0f\n",
+         result.name,
+         result.count,
+         seconds > 0 ? result.count / seconds : 0,
+         percentile(result.latency, 50) / 1000.0,
+         percentile(result.latency, 99) / 1000.0,
+         result.errors,
+         result.events,
+         result.overruns,
+         (double)result.hostNs / result.count);
+}
+
+static void
+usage(const char *name) {
+  fprintf(stderr,
+    "Usage: %s [options]\n"
+    "  -b, --baud=N        serial baud rate (115200)\n"
+    "  -l, --latency=US    EVSE processing time per command (2000)\n"
+    "  -j, --jitter=US     random extra processing time, up to (500)\n"
+    "  -e, --events=MS     $ST event interval, 0 for none (1000)\n"
+    "  -n, --count=N       commands per mode (2000)\n"
+    "  -d, --depth=N       commands kept queued in the async modes (4)\n"
+    "  -r, --rx-buffer=N   EVSE serial receive buffer (64)\n"
+    "  -x, --no-echo       EVSE does not echo the sequence id\n"
+    "  -s, --seed=N        jitter random seed (1)\n",
+    name);
+}
+
+int
+main(int argc, char **argv) {
+  SimEvseConfig config;
+  unsigned long count = 2000;
+  unsigned int depth = 4;
+
+  static const struct option options[] = {
+    { "baud",      required_argument, NULL, 'b' },
+    { "latency",   required_argument, NULL, 'l' },
+    { "jitter",    required_argument, NULL, 'j' },
+    { "events",    required_argument, NULL, 'e' },
+    { "count",     required_argument, NULL, 'n' },
+    { "depth",     required_argument, NULL, 'd' },
+    { "rx-buffer", required_argument, NULL, 'r' },
+    { "no-echo",   no_argument,       NULL, 'x' },
+    { "seed",      required_argument, NULL, 's' },
+    { "help",      no_argument,       NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+
+  int opt;
+  while (-1 != (opt = getopt_long(argc, argv, "b:l:j:e:n:d:r:xs:h", options, NULL)))
+  {
+    switch (opt)
+    {
+      case 'b': config.baud = strtoul(optarg, NULL, 10); break;
+      case 'l': config.latencyUs = strtoul(optarg, NULL, 10); break;
+      case 'j': config.jitterUs = strtoul(optarg, NULL, 10); break;
+      case 'e': config.stateEventMs = strtoul(optarg, NULL, 10); break;
+      case 'n': count = strtoul(optarg, NULL, 10); break;
+      case 'd': depth = strtoul(optarg, NULL, 10); break;
+      case 'r': config.rxBuffer = strtoul(optarg, NULL, 10); break;
+      case 'x': config.echoSequenceId = false; break;
+      case 's': config.seed = strtoul(optarg, NULL, 10); break;
+      default:
+        usage(argv[0]);
+        return 'h' == opt ? 0 : 1;
+    }
+  }
+  if (0 == config.baud || 0 == count || 0 == depth) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  printf("RAPI link: %lu baud, %lu us latency, %lu us jitter, $ST every %lu ms, "
+         "%u byte EVSE buffer, sequence id %s\n",
+         config.baud, config.latencyUs, config.jitterUs, config.stateEventMs,
+         config.rxBuffer, config.echoSequenceId ? "echoed" : "not echoed");
+  printf("%lu commands per mode, async depth %u\n\n", count, depth);
+  printf("%-10s %8s %9s %9s %9s %7s %7s %8s %9s\n",
+         "mode", "cmds", "cmd/s", "p50 ms", "p99 ms", "errors", "events", "overrun", "host ns");
+
+  BenchResult results[4] = {
+    { "blocking" },
+    { "async" },
+    { "pipelined" },
+    { "priority" },
+  };
+
+  for (int i = 0; i < 4; i++)
+  {
+    BenchResult &result = results[i];
+    result.count = count;
+    host_micros = 0;
+    rapi_events = 0;
+
+    switch (i)
+    {
+      case 0: bench_blocking(config, count, result); break;
+      case 1: bench_async(config, count, depth, false, result); break;
+      case 2: bench_async(config, count, depth, true, result); break;
+      case 3: bench_priority(config, count, result); break;
+    }
+
+    result.events = rapi_events;
+    report(result);
+  }
+
+  return 0;
+}
@@ -0,0 +1,509 @@
+// RAPI trace replay
+//
+// Plays a trace downloaded from /rapi/trace (ENABLE_RAPI_TRACE) back through
+// RapiSender and the input.cpp handlers. Each command the firmware sends is
+// answered with the reply the EVSE gave to the same command in the trace,
+// after the recorded delay, and the $ST/$WF events arrive at their recorded
+// times. --speed runs the session faster than it was recorded. Build and
+// run with scripts/bench.sh replay, see bench/readme.md
+
+#include <Arduino.h>
+#include <getopt.h>
+#include <time.h>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "RapiSender.h"
+#include "RapiTrace.h"
+#include "input.h"
+#include "openevse.h"
+#include "firmware.h"
+
+RapiSender rapiSender(nullptr);
+
+// Time on the host each time the stream is polled
+#define REPLAY_LOOP_US 5
+
+struct TraceReply
+{
+  uint64_t delayUs;               // After the command was sent
+  std::string body;               // eg "$OK 10 0", no sequence id or checksum
+  bool sequenceId;                // Reply had the sequence id
+};
+
+struct TraceExchange
+{
+  uint64_t time;
+  std::string cmd;                // eg "$GE", no sequence id or checksum
+  int sequenceId;                 // -1 for none
+  std::vector<TraceReply> replies;
+};
+
+struct TraceEvent
+{
+  uint64_t time;
+  std::string body;
+};
+
+// Split a frame in to the body, the sequence id and the checksum. Returns
+// false if the checksum is present and wrong.
+static bool
+split_frame(const std::string &frame, std::string &body, int &sequenceId) {
+  body = frame;
+  if (!body.empty() && '\r' == body[body.size() - 1]) {
+    body.erase(body.size() - 1);
+  }
+
+  bool ok = true;
+  size_t caret = body.rfind('^');
+  if (std::string::npos != caret) {
+    uint8_t chk = 0;
+    for (size_t i = 0; i < caret; i++) {
+      chk ^= body[i];
+    }
+    ok = chk == strtoul(body.c_str() + caret + 1, NULL, 16);
+    body.erase(caret);
+  }
+
+  sequenceId = -1;
+  size_t sos = body.rfind(" :");
+  if (std::string::npos != sos && body.size() - sos == 4) {
+    sequenceId = strtoul(body.c_str() + sos + 2, NULL, 16);
+    body.erase(sos);
+  }
+
+  return ok;
+}
+
+// The EVSE end of the link, answers from the trace
+class ReplayEvse : public Stream
+{
+  struct RxFrame
+  {
+    uint64_t due;
+    std::string bytes;
+  };
+
+  std::map<std::string, std::deque<const TraceExchange *> > _exchanges;
+  std::map<std::string, const TraceExchange *> _last;
+  const std::vector<TraceEvent> &_events;
+  size_t _nextEvent;
+  double _speed;
+
+  std::deque<RxFrame> _rx;
+  std::string _cmd;
+
+  uint64_t _scale(uint64_t us) {
+    return (uint64_t)(us / _speed);
+  }
+  void _deliverEvents();
+  void _command(const std::string &frame);
+
+public:
+  ReplayEvse(const std::vector<TraceExchange> &exchanges,
+             const std::vector<TraceEvent> &events, double speed);
+
+  unsigned long matched;          // Answered from a recorded exchange
+  unsigned long reused;           // Recorded exchanges ran out, answered from the last one
+  unsigned long unmatched;        // Not in the trace, answered $NK
+  unsigned long events;
+
+  bool done() {
+    return _nextEvent >= _events.size() && _rx.empty();
+  }
+
+  // Stream
+  size_t write(uint8_t c);
+  int available();
+  int read();
+  int peek();
+};
+
+ReplayEvse::ReplayEvse(const std::vector<TraceExchange> &exchanges,
+                       const std::vector<TraceEvent> &events, double speed) :
+  _events(events),
+  _nextEvent(0),
+  _speed(speed),
+  matched(0),
+  reused(0),
+  unmatched(0),
+  events(0)
+{
+  for (size_t i = 0; i < exchanges.size(); i++) {
+    if (!exchanges[i].replies.empty()) {
+      _exchanges[exchanges[i].cmd].push_back(&exchanges[i]);
+    }
+  }
+}
+
+void
+ReplayEvse::_deliverEvents() {
+  while (_nextEvent < _events.size() && _scale(_events[_nextEvent].time) <= host_micros)
+  {
+    std::string frame = _events[_nextEvent++].body;
+    uint8_t chk = 0;
+    for (size_t i = 0; i < frame.size(); i++) {
+      chk ^= frame[i];
+    }
+    char tail[8];
+    sprintf(tail, "^%02X\r", chk);
+    frame += tail;
+
+    // Ahead of any replies that are not due yet
+    std::deque<RxFrame>::iterator pos = _rx.begin();
+    while (pos != _rx.end() && pos->due <= host_micros) {
+      ++pos;
+    }
+    RxFrame event = { host_micros, frame };
+    _rx.insert(pos, event);
+    events++;
+  }
+}
+
+void
+ReplayEvse::_command(const std::string &frame) {
+  std::string cmd;
+  int sequenceId;
+  split_frame(frame, cmd, sequenceId);
+
+  const TraceExchange *exchange = nullptr;
+  std::deque<const TraceExchange *> &recorded = _exchanges[cmd];
+  if (!recorded.empty()) {
+    exchange = recorded.front();
+    recorded.pop_front();
+    _last[cmd] = exchange;
+    matched++;
+  } else if (_last.count(cmd)) {
+    exchange = _last[cmd];
+    reused++;
+  } else {
+    unmatched++;
+  }
+
+  static const TraceReply nk = { 1000, "$NK", true };
+  const std::vector<TraceReply> *replies = nullptr;
+  if (exchange) {
+    replies = &exchange->replies;
+  }
+
+  size_t count = replies ? replies->size() : 1;
+  for (size_t i = 0; i < count; i++)
+  {
+    const TraceReply &reply = replies ? (*replies)[i] : nk;
+    std::string out = reply.body;
+    char tail[8];
+    if (reply.sequenceId && sequenceId >= 0) {
+      sprintf(tail, " :%02X", (unsigned)sequenceId & 0xff);
+      out += tail;
+    }
+    uint8_t chk = 0;
+    for (size_t j = 0; j < out.size(); j++) {
+      chk ^= out[j];
+    }
+    sprintf(tail, "^%02X\r", chk);
+    out += tail;
+
+    RxFrame rx = { host_micros + _scale(reply.delayUs), out };
+    if (!_rx.empty() && _rx.back().due > rx.due) {
+      rx.due = _rx.back().due;
+    }
+    _rx.push_back(rx);
+  }
+}
+
+size_t
+ReplayEvse::write(uint8_t c) {
+  _cmd += (char)c;
+  if ('\r' == c) {
+    _command(_cmd);
+    _cmd.clear();
+  }
+  return 1;
+}
+
+int
+ReplayEvse::available() {
+  host_micros += REPLAY_LOOP_US;
+  _deliverEvents();
+
+  if (!_rx.empty() && _rx.front().due > host_micros) {
+    // Skip ahead to the next frame rather than spin
+    host_micros = _rx.front().due;
+  } else if (_rx.empty()) {
+    // Nothing on its way, let the clock run so timeouts can happen
+    uint64_t next = host_micros + 1000;
+    if (_nextEvent < _events.size() && _scale(_events[_nextEvent].time) < next) {
+      next = _scale(_events[_nextEvent].time);
+    }
+    host_micros = next;
+  }
+  _deliverEvents();
+
+  int count = 0;
+  for (size_t i = 0; i < _rx.size() && _rx[i].due <= host_micros; i++) {
+    count += _rx[i].bytes.size();
+  }
+  return count;
+}
+
+int
+ReplayEvse::read() {
+  int c = peek();
+  if (c >= 0) {
+    _rx.front().bytes.erase(0, 1);
+    if (_rx.front().bytes.empty()) {
+      _rx.pop_front();
+    }
+  }
+  return c;
+}
+
+int
+ReplayEvse::peek() {
+  if (_rx.empty() || _rx.front().due > host_micros) {
+    return -1;
+  }
+  return (uint8_t)_rx.front().bytes[0];
+}
+
+class FilePrint : public Print
+{
+  FILE *_file;
+
+public:
+  FilePrint(FILE *file) : _file(file) {}
+
+  size_t write(uint8_t c) {
+    return EOF != fputc(c, _file) ? 1 : 0;
+  }
+};
+
+// Read the trace in to the commands, with the replies to each, and the
+// events. Times are from the start of the trace.
+static bool
+load_trace(const char *name, std::vector<TraceExchange> &exchanges,
+           std::vector<TraceEvent> &events, unsigned long &badFrames)
+{
+  FILE *file = fopen(name, "r");
+  if (NULL == file) {
+    perror(name);
+    return false;
+  }
+
+  char line[4 * RAPI_TRACE_MAX_RUN + 32];
+  char data[RAPI_TRACE_MAX_RUN + 1];
+  bool first = true;
+  uint32_t last = 0;
+  uint64_t base = 0;
+  uint64_t start = 0;
+  std::string pending[2];         // Partial frames, TX and RX
+  uint64_t pendingTime[2] = { 0, 0 };
+  size_t unanswered = 0;          // Oldest exchange without a reply
+
+  while (fgets(line, sizeof(line), file))
+  {
+    uint32_t time;
+    char dir;
+    int len = RapiTrace::parse(line, time, dir, data, sizeof(data));
+    if (len < 0) {
+      continue;
+    }
+
+    // micros() wraps every 71 minutes
+    if (first) {
+      start = time;
+      first = false;
+    } else if (time < last) {
+      base += 1ULL << 32;
+    }
+    last = time;
+    uint64_t at = base + time - start;
+
+    int d = RAPI_TRACE_TX == dir ? 0 : 1;
+    for (int i = 0; i < len; i++)
+    {
+      if (pending[d].empty()) {
+        pendingTime[d] = at;
+      }
+      pending[d] += data[i];
+      if ('\r' != data[i]) {
+        continue;
+      }
+
+      std::string frame = pending[d];
+      pending[d].clear();
+      size_t soc = frame.find('$');
+      if (std::string::npos == soc) {
+        continue;
+      }
+
+      std::string body;
+      int sequenceId;
+      if (!split_frame(frame.substr(soc), body, sequenceId)) {
+        badFrames++;
+        continue;
+      }
+
+      if (0 == d)
+      {
+        TraceExchange exchange = { pendingTime[d], body, sequenceId };
+        exchanges.push_back(exchange);
+      }
+      else if (0 == body.compare(0, 3, "$ST") || 0 == body.compare(0, 3, "$WF"))
+      {
+        TraceEvent event = { pendingTime[d], body };
+        events.push_back(event);
+      }
+      else
+      {
+        // Match on the sequence id if there is one, else the EVSE answers in
+        // order
+        TraceExchange *exchange = nullptr;
+        for (size_t j = unanswered; j < exchanges.size(); j++) {
+          if (sequenceId >= 0 ? exchanges[j].sequenceId == sequenceId :
+                                exchanges[j].replies.empty()) {
+            exchange = &exchanges[j];
+            break;
+          }
+        }
+        if (nullptr == exchange) {
+          badFrames++;
+          continue;
+        }
+
+        TraceReply reply = { pendingTime[d] - exchange->time, body, sequenceId >= 0 };
+        exchange->replies.push_back(reply);
+        while (unanswered < exchanges.size() && !exchanges[unanswered].replies.empty()) {
+          unanswered++;
+        }
+      }
+    }
+  }
+
+  fclose(file);
+  return true;
+}
+
+static uint64_t
+cpu_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void
+usage(const char *name) {
+  fprintf(stderr,
+    "Usage: %s [options] trace\n"
+    "  -s, --speed=N       replay N times faster than recorded (1)\n"
+    "  -o, --output=FILE   write the RAPI trace of the replay\n"
+    "  -v, --verbose       print the events and MQTT messages\n",
+    name);
+}
+
+int
+main(int argc, char **argv) {
+  double speed = 1;
+  const char *output = NULL;
+
+  static const struct option options[] = {
+    { "speed",   required_argument, NULL, 's' },
+    { "output",  required_argument, NULL, 'o' },
+    { "verbose", no_argument,       NULL, 'v' },
+    { "help",    no_argument,       NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+
+  int opt;
+  while (-1 != (opt = getopt_long(argc, argv, "s:o:vh", options, NULL)))
+  {
+    switch (opt)
+    {
+      case 's': speed = strtod(optarg, NULL); break;
+      case 'o': output = optarg; break;
+      case 'v': bench_verbose = true; break;
+      default:
+        usage(argv[0]);
+        return 'h' == opt ? 0 : 1;
+    }
+  }
+  if (optind + 1 != argc || speed <= 0) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  std::vector<TraceExchange> exchanges;
+  std::vector<TraceEvent> events;
+  unsigned long badFrames = 0;
+  if (!load_trace(argv[optind], exchanges, events, badFrames)) {
+    return 1;
+  }
+
+  uint64_t duration = 0;
+  if (!exchanges.empty()) {
+    duration = exchanges.back().time;
+  }
+  if (!events.empty() && events.back().time > duration) {
+    duration = events.back().time;
+  }
+
+  printf("Trace: %zu commands, %zu events, %lu bad frames, %.1f s\n",
+         exchanges.size(), events.size(), badFrames, duration / 1000000.0);
+
+  ReplayEvse evse(exchanges, events, speed);
+  rapiSender.setStream(&evse);
+  rapiSender.setOnEvent(on_rapi_event);
+  rapiSender.enableSequenceId(1);
+
+  // As the firmware loop(), less the modules that are not under test
+  unsigned long loops = 0;
+  uint64_t end = (uint64_t)(duration / speed);
+  uint64_t host = cpu_ns();
+  while (host_micros < end || !evse.done())
+  {
+    rapiSender.loop();
+    update_rapi_state();
+
+    long state = evse_value(EVSE_STATE);
+    if (OPENEVSE_STATE_STARTING != state &&
+        OPENEVSE_STATE_INVALID != state)
+    {
+      update_rapi_settings();
+      update_rapi_values();
+    }
+    loops++;
+  }
+  host = cpu_ns() - host;
+
+  create_rapi_json();
+
+  printf("Replay: %.1f s at %gx, %lu loops, %.0f host ns per loop\n",
+         host_micros / 1000000.0, speed, loops, (double)host / loops);
+  printf("Commands: %lu matched, %lu reused, %lu not in the trace\n",
+         evse.matched, evse.reused, evse.unmatched);
+
+  const RapiLinkStats &stats = rapiSender.getStats();
+  printf("Link: %lu events, %lu bad checksum, %lu bad sequence id, %lu unexpected\n",
+         (unsigned long)stats.events, (unsigned long)stats.badChecksum,
+         (unsigned long)stats.badSequenceId, (unsigned long)stats.unexpected);
+  printf("Published: %lu MQTT, %lu web events\n",
+         bench_mqtt_publishes, bench_web_events);
+  printf("Values: generation %u, %s\n", evse_generation(), data.c_str());
+
+  if (output)
+  {
+    FILE *file = fopen(output, "w");
+    if (NULL == file) {
+      perror(output);
+      return 1;
+    }
+    FilePrint out(file);
+    out.print(F("# RAPI trace, time (us) and > to or < from the EVSE\n"));
+    rapiSender.getTrace().dump(out);
+    fclose(file);
+  }
+
+  return 0;
+}
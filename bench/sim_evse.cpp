@@ -0,0 +1,225 @@
+#include "sim_evse.h"
+
+SimEvse::SimEvse(const SimEvseConfig &config) :
+  _config(config),
+  _random(config.seed ? config.seed : 1),
+  _rxLineFree(0),
+  _nextEvent(0),
+  _eventState(1),
+  _cmdOverrun(false),
+  _txLineFree(0),
+  _busyUntil(0),
+  commands(0),
+  events(0),
+  overruns(0),
+  bytesSent(0),
+  bytesReceived(0)
+{
+  // 8N1, 10 bits a byte
+  _byteUs = 10000000UL / _config.baud;
+  if (_config.stateEventMs) {
+    _nextEvent = host_micros + (uint64_t)_config.stateEventMs * 1000;
+  }
+}
+
+// xorshift, repeatable for a given seed
+unsigned int
+SimEvse::_random32() {
+  _random ^= _random << 13;
+  _random ^= _random >> 17;
+  _random ^= _random << 5;
+  return _random;
+}
+
+// Queue a frame on the EVSE -> ESP line, starting no earlier than at
+void
+SimEvse::_send(uint64_t at, const std::string &body) {
+  _sendEvents(at);
+
+  uint8_t chk = 0;
+  for (size_t i = 0; i < body.size(); i++) {
+    chk ^= (uint8_t)body[i];
+  }
+  char tail[8];
+  snprintf(tail, sizeof(tail), "^%02X\r", chk);
+  std::string frame = body + tail;
+
+  for (size_t i = 0; i < frame.size(); i++) {
+    _rxLineFree = max(at, _rxLineFree) + _byteUs;
+    RxByte b = { _rxLineFree, frame[i] };
+    _rx.push_back(b);
+  }
+  bytesSent += frame.size();
+}
+
+void
+SimEvse::_sendEvents(uint64_t until) {
+  while (_config.stateEventMs && _nextEvent <= until)
+  {
+    uint64_t at = _nextEvent;
+    _nextEvent += (uint64_t)_config.stateEventMs * 1000;
+
+    // Flip between connected and charging
+    _eventState = 1 == _eventState ? 3 : 1;
+    char body[8];
+    snprintf(body, sizeof(body), "$ST %02X", _eventState);
+    events++;
+    _send(at, body);
+  }
+}
+
+// Bytes sitting in the EVSE's serial receive buffer at the given time. The
+// EVSE only drains the buffer between commands, so it fills up while it
+// is busy processing.
+unsigned int
+SimEvse::_buffered(uint64_t at) {
+  while (!_waiting.empty() && _waiting.front().start <= at) {
+    _waiting.pop_front();
+  }
+  if (_waiting.empty() && at >= _busyUntil) {
+    return 0;
+  }
+
+  unsigned int bytes = _cmd.size();
+  for (size_t i = 0; i < _waiting.size(); i++) {
+    bytes += _waiting[i].length;
+  }
+  return bytes;
+}
+
+std::string
+SimEvse::_reply(const std::string &frame) {
+  size_t end = frame.find('^');
+  std::string cmd = frame.substr(0, end);
+
+  uint8_t chk = 0;
+  for (size_t i = 0; i < cmd.size(); i++) {
+    chk ^= (uint8_t)cmd[i];
+  }
+  if (std::string::npos == end ||
+      strtoul(frame.substr(end + 1, 2).c_str(), NULL, 16) != chk) {
+    return "$NK";
+  }
+
+  std::string seq;
+  size_t sos = cmd.find(" :");
+  if (std::string::npos != sos) {
+    seq = cmd.substr(sos);
+    cmd = cmd.substr(0, sos);
+  }
+
+  std::string name = cmd.substr(0, 3);
+  std::string reply;
+  if ("$GE" == name) {
+    reply = "$OK 32 0229";
+  } else if ("$GS" == name) {
+    reply = "$OK 3 1234";
+  } else if ("$GG" == name) {
+    reply = "$OK 16000 240000";
+  } else if ("$GP" == name) {
+    reply = "$OK 285 -2560 -2560";
+  } else if ("$GU" == name) {
+    reply = "$OK 1234567 89012";
+  } else if ("$GF" == name) {
+    reply = "$OK 0 0 0";
+  } else if ("$SC" == name) {
+    reply = "$OK 16";
+  } else if ("$FP" == name) {
+    reply = "$OK";
+  } else {
+    reply = "$NK";
+  }
+
+  if (_config.echoSequenceId) {
+    reply += seq;
+  }
+  return reply;
+}
+
+void
+SimEvse::_process(uint64_t received) {
+  commands++;
+
+  std::string frame = _cmd;
+  bool overrun = _cmdOverrun;
+  _cmd.clear();
+  _cmdOverrun = false;
+
+  uint64_t start = max(received, _busyUntil);
+  uint64_t done = start + _config.latencyUs;
+  if (_config.jitterUs) {
+    done += _random32() % (_config.jitterUs + 1);
+  }
+  _busyUntil = done;
+
+  Pending pending = { start, (unsigned int)frame.size() };
+  _waiting.push_back(pending);
+
+  // Lost bytes leave a frame with a bad checksum
+  _send(done, overrun ? std::string("$NK") : _reply(frame));
+}
+
+size_t
+SimEvse::write(uint8_t c) {
+  uint64_t at = max(host_micros, _txLineFree) + _byteUs;
+  _txLineFree = at;
+  bytesReceived++;
+
+  if (_buffered(at) + 1 > _config.rxBuffer) {
+    if (!_cmdOverrun) {
+      overruns++;
+    }
+    _cmdOverrun = true;
+  } else {
+    _cmd += (char)c;
+  }
+
+  if ('\r' == c) {
+    _process(at);
+  }
+
+  return 1;
+}
+
+int
+SimEvse::available() {
+  host_micros += _config.loopUs;
+  _sendEvents(host_micros);
+
+  if (!_rx.empty() && _rx.front().due > host_micros) {
+    // Skip ahead to the next byte rather than spin
+    host_micros = _rx.front().due;
+  } else if (_rx.empty()) {
+    // Nothing on its way, let the clock run so timeouts can happen
+    uint64_t next = host_micros + 1000;
+    if (_config.stateEventMs && _nextEvent < next) {
+      next = _nextEvent;
+    }
+    host_micros = next;
+    _sendEvents(host_micros);
+  }
+
+  int count = 0;
+  for (size_t i = 0; i < _rx.size() && _rx[i].due <= host_micros; i++) {
+    count++;
+  }
+  return count;
+}
+
+int
+SimEvse::read() {
+  if (_rx.empty() || _rx.front().due > host_micros) {
+    return -1;
+  }
+  char c = _rx.front().c;
+  _rx.pop_front();
+  return (uint8_t)c;
+}
+
+int
+SimEvse::peek() {
+  if (_rx.empty() || _rx.front().due > host_micros) {
+    return -1;
+  }
+  return (uint8_t)_rx.front().c;
+}
@@ -0,0 +1,95 @@
+// Simulated OpenEVSE on the other end of the RAPI serial link
+//
+// Models the time the bytes take on the wire at the configured baud rate,
+// the time the EVSE takes to process each command, the 64 byte serial
+// receive buffer on the EVSE and the async $ST notifications. Time is the
+// simulated host_micros clock, it is moved on while RapiSender waits for
+// bytes so a run takes as long as the host needs, not the link.
+
+#ifndef _BENCH_SIM_EVSE_H
+#define _BENCH_SIM_EVSE_H
+
+#include <Arduino.h>
+#include <deque>
+#include <string>
+
+struct SimEvseConfig
+{
+  unsigned long baud;
+  unsigned long latencyUs;        // Time to process a command
+  unsigned long jitterUs;         // Up to this much extra processing time
+  unsigned long stateEventMs;     // $ST every this often, 0 for none
+  unsigned long loopUs;           // Host time used each time the stream is polled
+  unsigned int rxBuffer;          // EVSE serial receive buffer size
+  bool echoSequenceId;
+  unsigned int seed;
+
+  SimEvseConfig() :
+    baud(115200),
+    latencyUs(2000),
+    jitterUs(500),
+    stateEventMs(1000),
+    loopUs(5),
+    rxBuffer(64),
+    echoSequenceId(true),
+    seed(1)
+  {
+  }
+};
+
+class SimEvse : public Stream
+{
+  struct RxByte
+  {
+    uint64_t due;
+    char c;
+  };
+
+  struct Pending
+  {
+    uint64_t start;
+    unsigned int length;
+  };
+
+  SimEvseConfig _config;
+  uint64_t _byteUs;
+  unsigned int _random;
+
+  // EVSE -> ESP
+  std::deque<RxByte> _rx;
+  uint64_t _rxLineFree;
+  uint64_t _nextEvent;
+  uint8_t _eventState;
+
+  // ESP -> EVSE
+  std::string _cmd;
+  bool _cmdOverrun;
+  uint64_t _txLineFree;
+  uint64_t _busyUntil;
+  std::deque<Pending> _waiting;   // Commands received but not started
+
+  unsigned int _random32();
+  void _send(uint64_t at, const std::string &body);
+  void _sendEvents(uint64_t until);
+  unsigned int _buffered(uint64_t at);
+  void _process(uint64_t received);
+  std::string _reply(const std::string &cmd);
+
+public:
+  SimEvse(const SimEvseConfig &config);
+
+  // Totals for the run
+  unsigned long commands;
+  unsigned long events;
+  unsigned long overruns;
+  unsigned long bytesSent;
+  unsigned long bytesReceived;
+
+  // Stream
+  size_t write(uint8_t c);
+  int available();
+  int read();
+  int peek();
+};
+
+#endif // _BENCH_SIM_EVSE_H
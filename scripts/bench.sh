@@ -0,0 +1,52 @@
+#!/bin/sh -e
+# Build and run the host benchmarks, see bench/readme.md
+#
+# Usage: scripts/bench.sh [benchmark options]
+#        scripts/bench.sh replay [replay options] trace
+#        scripts/bench.sh cpu [cpu options]
+
+CXX=${CXX:-g++}
+BUILD_DIR=${BUILD_DIR:-${TMPDIR:-/tmp}/openevse-bench}
+CXXFLAGS="-std=gnu++11 -O2 -Wall -Wno-sign-compare -Wno-narrowing -Ibench/arduino -Ibench/libraries -Ibench -Isrc"
+ARDUINO="bench/arduino/Arduino.cpp bench/arduino/WString.cpp"
+
+# The firmware, less the modules that talk to the network, see
+# bench/firmware.cpp
+FIRMWARE="bench/firmware.cpp bench/libraries/ESPAsyncWebServer.cpp \
+  src/RapiSender.cpp src/RapiCommands.cpp src/RapiTrace.cpp src/RapiTransaction.cpp \
+  src/input.cpp src/evse_snapshot.cpp src/evse_energy.cpp src/rapi_caps.cpp src/rapi_cache.cpp \
+  src/divert.cpp src/lcd.cpp src/mqtt.cpp src/config.cpp \
+  src/web_server.cpp src/web_server_static.cpp src/web_server_routes.cpp src/JsonWriter.cpp"
+
+# Count the heap allocations, see bench/arduino/Arduino.cpp
+LDFLAGS="-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free"
+
+cd "$(dirname "$0")/.."
+mkdir -p "$BUILD_DIR"
+
+if [ "$1" = "replay" ]; then
+  shift
+  $CXX $CXXFLAGS $LDFLAGS -DENABLE_RAPI_TRACE \
+    -o "$BUILD_DIR/rapi_replay" \
+    bench/rapi_replay.cpp $ARDUINO $FIRMWARE
+
+  "$BUILD_DIR/rapi_replay" "$@"
+  exit
+fi
+
+if [ "$1" = "cpu" ]; then
+  shift
+  $CXX $CXXFLAGS $LDFLAGS \
+    -o "$BUILD_DIR/cpu_bench" \
+    bench/cpu_bench.cpp $ARDUINO $FIRMWARE
+
+  "$BUILD_DIR/cpu_bench" "$@"
+  exit
+fi
+
+$CXX $CXXFLAGS $LDFLAGS \
+  -o "$BUILD_DIR/rapi_bench" \
+  bench/rapi_bench.cpp bench/sim_evse.cpp $ARDUINO \
+  src/RapiSender.cpp src/RapiCommands.cpp
+
+"$BUILD_DIR/rapi_bench" "$@"
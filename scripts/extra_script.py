@@ -1,5 +1,8 @@
 from os.path import join, isfile, isdir, basename
 from os import listdir, system
+from io import BytesIO
+import gzip
+import hashlib
 import json
 from pprint import pprint
 import re
@@ -18,6 +21,10 @@ npm_installed = (0 == system("npm --version"))
 #print("Current build targets", map(str, BUILD_TARGETS))
 #
 
+# Word aligned, so StaticFileResponse can copy them out of flash a word at a
+# time
+CONTENT_ATTRIBUTES = "PROGMEM __attribute__((aligned(4)))"
+
 def get_c_name(source_file):
     return basename(source_file).upper().replace('.', '_').replace('-', '_')
 
@@ -25,31 +32,54 @@ def text_to_header(source_file):
     with open(source_file) as source_fh:
         original = source_fh.read().decode('utf-8')
     filename = get_c_name(source_file)
-    output = "static const char CONTENT_{}[] PROGMEM = ".format(filename)
+    output = "static const char CONTENT_{}[] {} = ".format(filename, CONTENT_ATTRIBUTES)
     for line in original.splitlines():
         output += u"\n  \"{}\\n\"".format(line.replace('\\', '\\\\').replace('"', '\\"'))
     output += ";\n"
     return output
 
-def binary_to_header(source_file):
-    filename = get_c_name(source_file)
-    output = "static const char CONTENT_"+filename+"[] PROGMEM = {\n  "
+def data_to_array(c_name, data):
+    output = "static const char CONTENT_"+c_name+"[] "+CONTENT_ATTRIBUTES+" = {\n  "
     count = 0
 
-    with open(source_file, "rb") as source_fh:
-        byte = source_fh.read(1)
-        while byte != "":
-            output += "0x{:02x}, ".format(ord(byte))
-            count += 1
-            if 16 == count:
-                output += "\n  "
-                count = 0
-
-            byte = source_fh.read(1)
+    for byte in bytearray(data):
+        output += "0x{:02x}, ".format(byte)
+        count += 1
+        if 16 == count:
+            output += "\n  "
+            count = 0
 
     output += "0x00 };\n"
     return output
 
+def binary_to_header(source_file):
+    with open(source_file, "rb") as source_fh:
+        return data_to_array(get_c_name(source_file), source_fh.read())
+
+# Files that gzip makes at least this much smaller also get a gzipped copy,
+# served to the clients that accept it. Images are already compressed.
+GZIP_MIN_SAVING = 0.1
+
+def gzip_file(source_file):
+    with open(source_file, "rb") as source_fh:
+        original = source_fh.read()
+
+    # No file name or time in the header, so the output only changes when
+    # the file does
+    compressed = BytesIO()
+    gz = gzip.GzipFile(filename="", mode="wb", fileobj=compressed, compresslevel=9, mtime=0)
+    gz.write(original)
+    gz.close()
+
+    if len(compressed.getvalue()) > len(original) * (1 - GZIP_MIN_SAVING):
+        return None
+    return compressed.getvalue()
+
+# Sent as the ETag, so browsers can check their cached copy is current
+def file_hash(source_file):
+    with open(source_file, "rb") as source_fh:
+        return "0x" + hashlib.sha1(source_fh.read()).hexdigest()[:8]
+
 def data_to_header(env, target, source):
     output = ""
     for source_file in source:
@@ -59,6 +89,9 @@ def data_to_header(env, target, source):
             output += text_to_header(file)
         else:
             output += binary_to_header(file)
+        compressed = gzip_file(file)
+        if compressed is not None:
+            output += data_to_array(get_c_name(file)+"_GZ", compressed)
     target_file = target[0].get_abspath()
     print("Generating {}".format(target_file))
     with open(target_file, "w") as output_file:
@@ -80,6 +113,11 @@ def make_static(env, target, source):
         filename = "web_server."+out_file+".h"
         output += "#include \"{}\"\n".format(filename)
 
+    # The names are kept in flash. The table is in the same order, sorted by
+    # name, so StaticFileWebHandler can binary search it.
+    for out_file in out_files:
+        output += "static const char STATIC_FILE_NAME_"+get_c_name(out_file)+"[] PROGMEM = \"/"+out_file+"\";\n"
+
     output += "StaticFile staticFiles[] = {\n"
 
     for out_file in out_files:
@@ -95,8 +133,15 @@ def make_static(env, target, source):
         elif out_file.endswith(".png"):
             filetype = "PNG"
 
+        # The uncompressed copy of a file that has a gzipped copy is only
+        # kept if the firmware is built with ENABLE_STATIC_IDENTITY, see
+        # web_server_static.cpp
         c_name = get_c_name(out_file)
-        output += "  { \"/"+out_file+"\", CONTENT_"+c_name+", sizeof(CONTENT_"+c_name+") - 1, _CONTENT_TYPE_"+filetype+" },\n"
+        etag = file_hash(join(dist_dir, out_file))
+        if gzip_file(join(dist_dir, out_file)) is not None:
+            output += "  { STATIC_FILE_NAME_"+c_name+", STATIC_FILE_IDENTITY(CONTENT_"+c_name+"), STATIC_FILE_GZIP(CONTENT_"+c_name+"_GZ), _CONTENT_TYPE_"+filetype+", "+etag+" },\n"
+        else:
+            output += "  { STATIC_FILE_NAME_"+c_name+", CONTENT_"+c_name+", sizeof(CONTENT_"+c_name+") - 1, NULL, 0, _CONTENT_TYPE_"+filetype+", "+etag+" },\n"
 
     output += "};\n"
 
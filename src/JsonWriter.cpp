@@ -0,0 +1,190 @@
+#include "JsonWriter.h"
+
+JsonWriter::JsonWriter(Print &out) :
+  _out(out),
+  _empty(1),
+  _depth(0),
+  _afterKey(false)
+{
+}
+
+void
+JsonWriter::_separator() {
+  if(_afterKey) {
+    _afterKey = false;
+    return;
+  }
+
+  uint32_t bit = 1UL << _depth;
+  if(_empty & bit) {
+    _empty &= ~bit;
+  } else {
+    _out.write(',');
+  }
+}
+
+void
+JsonWriter::_begin(char c) {
+  _separator();
+  _out.write(c);
+  if(_depth < JSON_WRITER_MAX_DEPTH) {
+    _depth++;
+  }
+  _empty |= 1UL << _depth;
+}
+
+void
+JsonWriter::_end(char c) {
+  if(_depth > 0) {
+    _depth--;
+  }
+  _out.write(c);
+}
+
+// The runs that need no escaping are written in one go
+void
+JsonWriter::_escaped(const char *str, size_t len) {
+  const char *run = str;
+  for(const char *p = str; p < str + len; p++)
+  {
+    uint8_t c = *p;
+    if(c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+
+    if(p > run) {
+      _out.write((const uint8_t *)run, p - run);
+    }
+    run = p + 1;
+
+    char escape[7] = { '\\', (char)c, 0 };
+    switch(c)
+    {
+      case '"':
+      case '\\': break;
+      case '\n': escape[1] = 'n'; break;
+      case '\r': escape[1] = 'r'; break;
+      case '\t': escape[1] = 't'; break;
+      default:
+        snprintf(escape, sizeof(escape), "\\u%04x", c);
+        break;
+    }
+    _out.write((const uint8_t *)escape, strlen(escape));
+  }
+  if(str + len > run) {
+    _out.write((const uint8_t *)run, str + len - run);
+  }
+}
+
+void
+JsonWriter::_string(const char *str, size_t len) {
+  _out.write('"');
+  _escaped(str, len);
+  _out.write('"');
+}
+
+void
+JsonWriter::beginObject() {
+  _begin('{');
+}
+
+void
+JsonWriter::beginObject(const __FlashStringHelper *name) {
+  key(name);
+  _begin('{');
+}
+
+void
+JsonWriter::endObject() {
+  _end('}');
+}
+
+void
+JsonWriter::beginArray() {
+  _begin('[');
+}
+
+void
+JsonWriter::beginArray(const __FlashStringHelper *name) {
+  key(name);
+  _begin('[');
+}
+
+void
+JsonWriter::endArray() {
+  _end(']');
+}
+
+void
+JsonWriter::key(const __FlashStringHelper *name) {
+  _separator();
+  _out.write('"');
+  _out.print(name);
+  _out.write('"');
+  _out.write(':');
+  _afterKey = true;
+}
+
+void
+JsonWriter::key(const char *name) {
+  _separator();
+  _string(name, strlen(name));
+  _out.write(':');
+  _afterKey = true;
+}
+
+void
+JsonWriter::value(long number) {
+  _separator();
+  _out.print(number);
+}
+
+void
+JsonWriter::value(unsigned long number) {
+  _separator();
+  _out.print(number);
+}
+
+void
+JsonWriter::value(bool b) {
+  _separator();
+  _out.print(b ? F("true") : F("false"));
+}
+
+void
+JsonWriter::value(const char *str) {
+  _separator();
+  _string(str, strlen(str));
+}
+
+void
+JsonWriter::value(const __FlashStringHelper *str) {
+  // Copied out of flash a piece at a time so it can be escaped
+  PGM_P p = reinterpret_cast<PGM_P>(str);
+  char buf[32];
+  size_t len = strlen_P(p);
+
+  _separator();
+  _out.write('"');
+  while(len > 0)
+  {
+    size_t n = len < sizeof(buf) ? len : sizeof(buf);
+    memcpy_P(buf, p, n);
+    _escaped(buf, n);
+    p += n;
+    len -= n;
+  }
+  _out.write('"');
+}
+
+void
+JsonWriter::valueNull() {
+  _separator();
+  _out.print(F("null"));
+}
+
+void
+JsonWriter::valueRaw(const String &json) {
+  _separator();
+  _out.print(json);
+}
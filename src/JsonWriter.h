@@ -0,0 +1,74 @@
+#pragma once
+// Writes JSON straight to a Print, eg an AsyncResponseStream, without
+// building it in a String first
+//
+//   JsonWriter json(*response);
+//   json.beginObject();
+//   json.add(F("amp"), 16000);
+//   json.beginObject(F("rapi_link"));
+//   json.add(F("checksum"), stats.badChecksum);
+//   json.endObject();
+//   json.endObject();
+//
+// The commas are added as needed. Numbers are formatted by Print on the
+// stack and keys given with F() are read from flash, so nothing is
+// allocated. Strings are escaped, keys from flash are assumed not to need
+// it.
+
+#include <Arduino.h>
+
+// Objects and arrays can be nested this deep
+#define JSON_WRITER_MAX_DEPTH 31
+
+class JsonWriter
+{
+  Print &_out;
+  uint32_t _empty;            // Bit per depth, set until it has a member
+  uint8_t _depth;
+  bool _afterKey;
+
+  void _separator();
+  void _begin(char c);
+  void _end(char c);
+  void _escaped(const char *str, size_t len);
+  void _string(const char *str, size_t len);
+
+public:
+  JsonWriter(Print &out);
+
+  void beginObject();
+  void beginObject(const __FlashStringHelper *name);
+  void endObject();
+  void beginArray();
+  void beginArray(const __FlashStringHelper *name);
+  void endArray();
+
+  // The name of the next member, followed by one value() or begin*()
+  void key(const __FlashStringHelper *name);
+  void key(const char *name);
+
+  // A member of an object after key(), or an item in an array
+  void value(long number);
+  void value(unsigned long number);
+  void value(int number) { value((long)number); }
+  void value(unsigned int number) { value((unsigned long)number); }
+  void value(bool b);
+  void value(const char *str);
+  void value(const String &str) { _separator(); _string(str.c_str(), str.length()); }
+  void value(const __FlashStringHelper *str);
+  void valueNull();
+
+  // JSON that is already formatted, written as is
+  void valueRaw(const String &json);
+
+  // key() and value() together
+  template<typename T>
+  void add(const __FlashStringHelper *name, const T &v) {
+    key(name);
+    value(v);
+  }
+  void addNull(const __FlashStringHelper *name) {
+    key(name);
+    valueNull();
+  }
+};
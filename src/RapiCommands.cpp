@@ -0,0 +1,204 @@
+#include <Arduino.h>
+#include "RapiSender.h"
+
+RapiArgs &
+RapiArgs::_append(const char *str, size_t len) {
+  // Space separator, room for the command name and the NUL
+  if (_overflow || _len + 1 + len + 3 >= RAPI_BUFLEN) {
+    _overflow = true;
+    return *this;
+  }
+
+  _buf[_len++] = ' ';
+  _chk ^= ' ';
+  for (size_t i = 0; i < len; i++) {
+    _buf[_len++] = str[i];
+    _chk ^= (uint8_t)str[i];
+  }
+  _buf[_len] = '\0';
+
+  return *this;
+}
+
+RapiArgs &
+RapiArgs::add(long value) {
+  char digits[12];
+  char *s = digits + sizeof(digits);
+  unsigned long u = value < 0 ? -(unsigned long)value : value;
+  do {
+    *--s = '0' + (u % 10);
+    u /= 10;
+  } while (u);
+  if (value < 0) {
+    *--s = '-';
+  }
+
+  return _append(s, digits + sizeof(digits) - s);
+}
+
+bool
+RapiReplyG3::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 2) {
+    return false;
+  }
+  timeLimit = rapi.getTokenInt(1);
+  return true;
+}
+
+bool
+RapiReplyGA::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 3) {
+    return false;
+  }
+  scale = rapi.getTokenInt(1);
+  offset = rapi.getTokenInt(2);
+  return true;
+}
+
+bool
+RapiReplyGC::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 3) {
+    return false;
+  }
+  minAmps = rapi.getTokenInt(1);
+  maxAmps = rapi.getTokenInt(2);
+  return true;
+}
+
+bool
+RapiReplyGD::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 5) {
+    return false;
+  }
+  startHour = rapi.getTokenInt(1);
+  startMin = rapi.getTokenInt(2);
+  stopHour = rapi.getTokenInt(3);
+  stopMin = rapi.getTokenInt(4);
+  return true;
+}
+
+bool
+RapiReplyGE::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 3) {
+    return false;
+  }
+  pilot = rapi.getTokenInt(1);
+  flags = rapi.getTokenHex(2);
+  return true;
+}
+
+bool
+RapiReplyGF::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 4) {
+    return false;
+  }
+  gfciCount = rapi.getTokenHex(1);
+  noGroundCount = rapi.getTokenHex(2);
+  stuckRelayCount = rapi.getTokenHex(3);
+  return true;
+}
+
+bool
+RapiReplyGG::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 2) {
+    return false;
+  }
+  milliAmps = rapi.getTokenInt(1);
+  milliVolts = rapi.getTokenInt(2);
+  return true;
+}
+
+bool
+RapiReplyGH::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 2) {
+    return false;
+  }
+  kwhLimit = rapi.getTokenInt(1);
+  return true;
+}
+
+bool
+RapiReplyGP::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 4) {
+    return false;
+  }
+  temp1 = rapi.getTokenInt(1);
+  temp2 = rapi.getTokenInt(2);
+  temp3 = rapi.getTokenInt(3);
+  return true;
+}
+
+// The whole token as a number in base, -1 if it is not one
+static long
+parseTokenNumber(RapiToken token, int base) {
+  if (0 == token.len) {
+    return -1;
+  }
+
+  long val = 0;
+  for (uint8_t i = 0; i < token.len; i++) {
+    char c = token.str[i];
+    int digit;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (c >= 'A' && c <= 'F') {
+      digit = c - 'A' + 10;
+    } else if (c >= 'a' && c <= 'f') {
+      digit = c - 'a' + 10;
+    } else {
+      return -1;
+    }
+    if (digit >= base) {
+      return -1;
+    }
+    val = (val * base) + digit;
+  }
+  return val;
+}
+
+long
+rapi_parse_state(RapiSender &rapi, int i) {
+  RapiToken token = rapi.getToken(i);
+  long state = parseTokenNumber(token, 10);
+  if (rapi_state_known(state)) {
+    return state;
+  }
+  state = parseTokenNumber(token, 16);
+  if (rapi_state_known(state)) {
+    return state;
+  }
+  return -1;
+}
+
+bool
+RapiReplyGS::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 3) {
+    return false;
+  }
+  state = rapi_parse_state(rapi, 1);
+  if (state < 0) {
+    return false;
+  }
+  elapsed = rapi.getTokenInt(2);
+  return true;
+}
+
+bool
+RapiReplyGU::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 3) {
+    return false;
+  }
+  wattSeconds = rapi.getTokenInt(1);
+  wattHours = rapi.getTokenInt(2);
+  return true;
+}
+
+bool
+RapiReplyGV::parse(RapiSender &rapi) {
+  if (rapi.getTokenCnt() < 3) {
+    return false;
+  }
+  firmware = rapi.getTokenString(1);
+  protocol = rapi.getTokenString(2);
+  return true;
+}
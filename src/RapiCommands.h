@@ -0,0 +1,184 @@
+#pragma once
+// RAPI command catalogue, included by RapiSender.h
+//
+// The commands the firmware sends with their checksums worked out at compile
+// time, the arguments formatted on the stack and the replies parsed in to
+// typed structs.
+
+class RapiSender;
+
+// XOR checksum of a string, evaluated by the compiler for constants
+constexpr uint8_t
+rapi_checksum(const char *s, uint8_t chk = 0) {
+  return *s ? rapi_checksum(s + 1, chk ^ (uint8_t)*s) : chk;
+}
+
+struct RapiCmd
+{
+  char name[4];
+  uint8_t chk;    // Checksum of name
+};
+
+#define RAPI_CMD(name) { name, rapi_checksum(name) }
+
+// The $S and $F commands change the EVSE's settings or state, the replies
+// to $G commands sent before them may be out of date
+constexpr bool
+rapi_is_write(const char *cmd) {
+  return '$' == cmd[0] && ('S' == cmd[1] || 'F' == cmd[1]);
+}
+
+// The EVSE states, 0x0b is over current on newer firmware
+constexpr bool
+rapi_state_known(long state) {
+  return (state >= 0 && state <= 0x0b) || 0xfe == state || 0xff == state;
+}
+
+// The state in a $GS reply or $ST event, -1 if it is not a known state.
+// Protocol 5 firmware sends the state in hex and older firmware in decimal,
+// the token is read both ways as none of the states read as a different
+// state in the other radix.
+long rapi_parse_state(RapiSender &rapi, int i);
+
+constexpr RapiCmd RAPI_CMD_F0 = RAPI_CMD("$F0");  // Enable/disable LCD updates
+constexpr RapiCmd RAPI_CMD_F1 = RAPI_CMD("$F1");  // Button press
+constexpr RapiCmd RAPI_CMD_FD = RAPI_CMD("$FD");  // Disable
+constexpr RapiCmd RAPI_CMD_FE = RAPI_CMD("$FE");  // Enable
+constexpr RapiCmd RAPI_CMD_FP = RAPI_CMD("$FP");  // Print text on the LCD
+constexpr RapiCmd RAPI_CMD_FS = RAPI_CMD("$FS");  // Sleep
+constexpr RapiCmd RAPI_CMD_G3 = RAPI_CMD("$G3");  // Charge time limit
+constexpr RapiCmd RAPI_CMD_GA = RAPI_CMD("$GA");  // Ammeter settings
+constexpr RapiCmd RAPI_CMD_GC = RAPI_CMD("$GC");  // Current capacity range
+constexpr RapiCmd RAPI_CMD_GD = RAPI_CMD("$GD");  // Delay timer
+constexpr RapiCmd RAPI_CMD_GE = RAPI_CMD("$GE");  // Settings
+constexpr RapiCmd RAPI_CMD_GF = RAPI_CMD("$GF");  // Fault counters
+constexpr RapiCmd RAPI_CMD_GG = RAPI_CMD("$GG");  // Charging current and voltage
+constexpr RapiCmd RAPI_CMD_GH = RAPI_CMD("$GH");  // kWh limit
+constexpr RapiCmd RAPI_CMD_GP = RAPI_CMD("$GP");  // Temperatures
+constexpr RapiCmd RAPI_CMD_GS = RAPI_CMD("$GS");  // State
+constexpr RapiCmd RAPI_CMD_GU = RAPI_CMD("$GU");  // Energy usage
+constexpr RapiCmd RAPI_CMD_GV = RAPI_CMD("$GV");  // Version
+constexpr RapiCmd RAPI_CMD_SC = RAPI_CMD("$SC");  // Set current capacity
+
+// Command arguments, formatted in place as they are added, eg
+//   RapiArgs().add(rate).add("V")
+class RapiArgs
+{
+  char _buf[RAPI_BUFLEN];
+  uint8_t _len;
+  uint8_t _chk;
+  bool _overflow;
+
+  RapiArgs &_append(const char *str, size_t len);
+
+public:
+  RapiArgs() : _len(0), _chk(0), _overflow(false) {
+    _buf[0] = '\0';
+  }
+
+  RapiArgs &add(long value);
+  RapiArgs &add(int value) {
+    return add((long)value);
+  }
+  RapiArgs &add(const char *str) {
+    return _append(str, strlen(str));
+  }
+
+  // Includes the leading space
+  const char *str() const { return _buf; }
+  uint8_t length() const { return _len; }
+  uint8_t checksum() const { return _chk; }
+  bool overflow() const { return _overflow; }
+};
+
+// -------------------------------------------------------------------
+// Typed replies, parse() returns false if the reply is too short
+// -------------------------------------------------------------------
+struct RapiReplyG3
+{
+  long timeLimit;             // 15 minute increments, 0 = none
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGA
+{
+  long scale;
+  long offset;
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGC
+{
+  long minAmps;
+  long maxAmps;
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGD
+{
+  long startHour;
+  long startMin;
+  long stopHour;
+  long stopMin;
+  bool enabled() const {
+    return 0 != startHour || 0 != startMin || 0 != stopHour || 0 != stopMin;
+  }
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGE
+{
+  long pilot;                 // Amps
+  unsigned long flags;
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGF
+{
+  unsigned long gfciCount;
+  unsigned long noGroundCount;
+  unsigned long stuckRelayCount;
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGG
+{
+  long milliAmps;
+  long milliVolts;            // 0 if not supported by the firmware
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGH
+{
+  long kwhLimit;              // 0 = none
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGP
+{
+  long temp1;                 // Tenths of a degree C
+  long temp2;
+  long temp3;
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGS
+{
+  long state;
+  long elapsed;               // Seconds
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGU
+{
+  long wattSeconds;
+  long wattHours;             // Accumulated
+  bool parse(RapiSender &rapi);
+};
+
+struct RapiReplyGV
+{
+  String firmware;
+  String protocol;
+  bool parse(RapiSender &rapi);
+};
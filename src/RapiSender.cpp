@@ -12,6 +12,14 @@
 #define DBG
 #endif
 
+#ifdef ENABLE_RAPI_TRACE
+#define trace(dir, data, len) _trace.append(dir, data, len)
+#define traceEnd() _trace.endRun()
+#else
+#define trace(dir, data, len)
+#define traceEnd()
+#endif
+
 // convert 2-digit hex string to uint8_t
 uint8_t
 htou8(const char *s) {
@@ -39,229 +47,689 @@ htou8(const char *s) {
 }
 
 
+static const uint16_t latency_buckets_ms[RAPI_STATS_BUCKETS - 1] = {
+  2, 5, 10, 20, 50, 100, 200
+};
+
 RapiSender::RapiSender(Stream * stream) {
   _stream = stream;
   *_respBuf = 0;
+  _respBufPos = 0;
+  _tokenCnt = 0;
   _flags = 0;
   _onRapiEvent = nullptr;
+  _onRapiWrite = nullptr;
+
+  for (int i = 0; i < RAPI_PRIORITY_COUNT; i++) {
+    _head[i] = nullptr;
+    _tail[i] = nullptr;
+    _lastSource[i] = 0;
+  }
+  memset(_queued, 0, sizeof(_queued));
+  _source = RAPI_SOURCE_OTHER;
+  _sentHead = nullptr;
+  _sentTail = nullptr;
+  _inFlight = 0;
+  _inFlightBytes = 0;
 
   _sequenceId = RAPI_INVALID_SEQUENCE_ID;
+  _respSequenceId = RAPI_INVALID_SEQUENCE_ID;
+
+  resetStats();
 }
 
-// return = 0 = OK
-//        = 1 = command will cause buffer overflow
 void
-RapiSender::_sendCmd(const char *cmdstr) {
-  _stream->print(cmdstr);
-  dbgprint(cmdstr);
+RapiSender::resetStats() {
+  memset(&_stats, 0, sizeof(_stats));
+}
 
-  const char *s = cmdstr;
-  uint8_t chk = 0;
-  while (*s) {
-    chk ^= *(s++);
+const char *
+RapiSender::sourceName(uint8_t source) {
+  static const char *names[RAPI_SOURCE_COUNT] = {
+    "other", "poll", "http", "mqtt", "divert", "lcd", "ohm"
+  };
+  return source < RAPI_SOURCE_COUNT ? names[source] : "";
+}
+
+uint16_t
+RapiSender::latencyBucketMs(int bucket) {
+  return bucket < RAPI_STATS_BUCKETS - 1 ? latency_buckets_ms[bucket] : 0;
+}
+
+// The stats slot for a command, the last slot is shared by any commands
+// that don't fit
+RapiCommandStats *
+RapiSender::_commandStats(const char *cmd) {
+  char name[2] = { cmd[1], cmd[1] ? cmd[2] : '\0' };
+
+  for (int i = 0; i < RAPI_STATS_MAX_COMMANDS - 1; i++)
+  {
+    RapiCommandStats *stats = &_stats.commands[i];
+    if ('\0' == stats->cmd[0]) {
+      stats->cmd[0] = name[0];
+      stats->cmd[1] = name[1];
+      return stats;
+    }
+    if (name[0] == stats->cmd[0] && name[1] == stats->cmd[1]) {
+      return stats;
+    }
   }
 
-  _sendTail(chk);
+  RapiCommandStats *other = &_stats.commands[RAPI_STATS_MAX_COMMANDS - 1];
+  other->cmd[0] = '*';
+  return other;
 }
 
-void RapiSender::_sendTail(uint8_t chk) {
+static char *
+put_hex(char *p, uint8_t u) {
+  static const char hex[] = "0123456789ABCDEF";
+  *p++ = hex[u >> 4];
+  *p++ = hex[u & 0x0f];
+  return p;
+}
+
+// Build the whole frame, cmd [:SS]^CK\r, and send it with one write. The
+// checksum of cmd was worked out when it was queued so only the sequence id
+// needs adding.
+//
+// returns the number of bytes sent
+int
+RapiSender::_sendCmd(RapiCommand *command) {
+  // Don't use _respBuf, we may be part way through receiving a frame
+  char frame[RAPI_FRAME_LEN];
+  size_t len = strlen(command->cmd);
+  memcpy(frame, command->cmd, len);
+  char *p = frame + len;
+  uint8_t chk = command->chk;
+
   if (_sequenceIdEnabled()) {
     if (++_sequenceId == RAPI_INVALID_SEQUENCE_ID)
       ++_sequenceId;
-    sprintf(_respBuf, " %c%02X", ESRAPI_SOS, (unsigned) _sequenceId);
-    const char *s = _respBuf;
-    while (*s) {
-      chk ^= *(s++);
+    char *seq = p;
+    *p++ = ' ';
+    *p++ = ESRAPI_SOS;
+    p = put_hex(p, _sequenceId);
+    for (; seq < p; seq++) {
+      chk ^= *seq;
     }
-    _stream->print(_respBuf);
-    dbgprint(_respBuf);
   }
 
-  sprintf(_respBuf, "^%02X%c", (unsigned) chk, ESRAPI_EOC);
-  _stream->print(_respBuf);
-  dbgprintln(_respBuf);
-  _stream->flush();
+  *p++ = '^';
+  p = put_hex(p, chk);
+  *p++ = ESRAPI_EOC;
+  len = p - frame;
 
-  *_respBuf = 0;
+  _stream->write((const uint8_t *)frame, len);
+  if (_flags & RSF_FLUSH) {
+    _stream->flush();
+  }
+
+#ifdef DBG
+  *(p - 1) = '\0';
+  dbgprintln(frame);
+#endif
+  trace(RAPI_TRACE_TX, frame, len);
+  traceEnd();
+
+  return len;
 }
 
+// Find the tokens in _respBuf, the buffer is not modified. The sequence id,
+// if any, is left in _respSequenceId for _matchResponse()
+//
 // return = 0 = OK
 //        = 1 = bad checksum
-//        = 2 = bad sequence id
 int
 RapiSender::_tokenize() {
   uint8_t chk = 0;
-  char *s = _respBuf;
+  const char *s = _respBuf;
   dbgprint("resp: ");
   dbgprintln(_respBuf);
 
   while (*s != '^' && *s != '\0') {
     chk ^= *(s++);
   }
+  const char *end = s;
   if (*s == '^') {
     uint8_t rchk = htou8(s + 1);
     if (rchk != chk) {
       _tokenCnt = 0;
 #ifdef DBG
-      sprintf(_respBuf, "bad chk %x %x %s", rchk, chk, s);
-      dbgprintln(_respBuf);
+      dbgprint("bad chk ");
+      dbgprint(rchk);
+      dbgprint(" ");
+      dbgprintln(chk);
 #endif
       return 1;
     }
-    *s = '\0';
   }
 
   _tokenCnt = 0;
+  _respSequenceId = RAPI_INVALID_SEQUENCE_ID;
   s = _respBuf;
-  while (*s) {
-    _tokens[_tokenCnt++] = s++;
-    if (_tokenCnt == RAPI_MAX_TOKENS)
-      break;
-
-    while (*s && (*s != ' ') && (*s != ESRAPI_SOS)) {
+  while (s < end && _tokenCnt < RAPI_MAX_TOKENS) {
+    if (*s == ' ') {
       s++;
+      continue;
     }
-    if (*s == ' ') {
-      *(s++) = '\0';
-    } else if (*s == ESRAPI_SOS) {
-      *(s++) = '\0';
-      uint8_t seqid = htou8(s + 1);
-      if (seqid != _sequenceId) {
-#ifdef DBG
-        sprintf(_respBuf, "bad seqid %x %x %s", seqid, _sequenceId, s);
-        dbgprintln(_respBuf);
-#endif
-        _tokenCnt = 0;
-        return 2;
-      }
+    if (*s == ESRAPI_SOS) {
+      _respSequenceId = htou8(s + 1);
       break;                    // sequence id is last - break out
     }
+
+    const char *start = s;
+    while (s < end && (*s != ' ') && (*s != ESRAPI_SOS)) {
+      s++;
+    }
+    _tokenStart[_tokenCnt] = start - _respBuf;
+    _tokenLen[_tokenCnt] = s - start;
+    _tokenCnt++;
   }
 
   return 0;
 }
 
+bool
+RapiSender::tokenEquals(int i, const char *str) {
+  if (i >= _tokenCnt) {
+    return false;
+  }
+
+  size_t len = strlen(str);
+  return len == _tokenLen[i] && 0 == memcmp(_respBuf + _tokenStart[i], str, len);
+}
+
+// Parse the token as an integer without copying it, returns 0 if the token
+// does not exist
+long
+RapiSender::getTokenInt(int i, int base) {
+  if (i >= _tokenCnt) {
+    return 0;
+  }
+
+  const char *s = _respBuf + _tokenStart[i];
+  const char *end = s + _tokenLen[i];
+  bool negative = false;
+  if (s < end && '-' == *s) {
+    negative = true;
+    s++;
+  }
+
+  long val = 0;
+  for (; s < end; s++) {
+    char c = *s;
+    int digit;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (c >= 'A' && c <= 'F') {
+      digit = c - 'A' + 10;
+    } else if (c >= 'a' && c <= 'f') {
+      digit = c - 'a' + 10;
+    } else {
+      break;
+    }
+    if (digit >= base) {
+      break;
+    }
+    val = (val * base) + digit;
+  }
+
+  return negative ? -val : val;
+}
+
+String
+RapiSender::getTokenString(int i) {
+  String str;
+  if (i < _tokenCnt) {
+    str.reserve(_tokenLen[i]);
+    const char *s = _respBuf + _tokenStart[i];
+    for (int j = 0; j < _tokenLen[i]; j++) {
+      str += s[j];
+    }
+  }
+  return str;
+}
+
+// Block until the command queued by one of the blocking sendCmd() wrappers
+// completes, anything queued before it is sent first
+int
+RapiSender::_waitForCommand(int queued, int &ret) {
+  if (RAPI_RESPONSE_QUEUED != queued) {
+    return queued;
+  }
+
+  _flags |= RSF_WAITING;
+  while (RAPI_RESPONSE_QUEUED == ret) {
+    _poll(&ret);
+    if (RAPI_RESPONSE_QUEUED == ret) {
+      yield();
+    }
+  }
+  _flags &= ~RSF_WAITING;
+
+  return ret;
+}
+
+// The blocking wrappers can't wait from inside _poll(), the command they
+// queue could only complete once the callback they were called from
+// returns
+bool
+RapiSender::_canBlock() {
+  if (_flags & (RSF_POLLING | RSF_WAITING)) {
+    DBUGF("RAPI: blocking sendCmd() from a callback");
+    return false;
+  }
+  return true;
+}
+
 /*
  * return values:
+ * -2= response buffer overflow
  * -1= timeout
  * 0= success
  * 1=$NK
  * 2=invalid RAPI response
  * 3=cmdstr too long
+ * -5= called from a completion callback
 */
 int
 RapiSender::sendCmd(const char *cmdstr, unsigned long timeout) {
-  _sendCmd(cmdstr);
-  return _waitForResult(timeout);
+  if (!_canBlock()) {
+    return RAPI_RESPONSE_WOULD_DEADLOCK;
+  }
+  int ret = RAPI_RESPONSE_QUEUED;
+  int queued = sendCmd(cmdstr, [&ret](int result) { ret = result; }, timeout);
+  return _waitForCommand(queued, ret);
 }
 
-/*
- * return values:
- * -1= timeout
- * 0= success
- * 1=$NK
- * 2=invalid RAPI response
- * 3=cmdstr too long
-*/
 int
-RapiSender::sendCmd(String &cmdstr, unsigned long timeout) {
-  _sendCmd(cmdstr.c_str());
-  return _waitForResult(timeout);
+RapiSender::sendCmd(const String &cmdstr, unsigned long timeout) {
+  return sendCmd(cmdstr.c_str(), timeout);
+}
+
+int
+RapiSender::sendCmd(const __FlashStringHelper *cmdstr, unsigned long timeout) {
+  if (!_canBlock()) {
+    return RAPI_RESPONSE_WOULD_DEADLOCK;
+  }
+  int ret = RAPI_RESPONSE_QUEUED;
+  int queued = sendCmd(cmdstr, [&ret](int result) { ret = result; }, timeout);
+  return _waitForCommand(queued, ret);
 }
 
 /*
  * return values:
- * -1= timeout
- * 0= success
- * 1=$NK
- * 2=invalid RAPI response
+ * -3= queued, callback will be called with one of the sendCmd() return values
  * 3=cmdstr too long
 */
 int
-RapiSender::sendCmd(const __FlashStringHelper *cmdstr, unsigned long timeout) {
-  _stream->print(cmdstr);
-  dbgprint(cmdstr);
+RapiSender::sendCmd(const char *cmdstr, RapiCommandCompleteHandler callback, unsigned long timeout) {
+  if (strlen(cmdstr) >= RAPI_BUFLEN) {
+    return RAPI_RESPONSE_CMD_TOO_LONG;
+  }
+
+  RapiCommand *command = new RapiCommand;
+  strcpy(command->cmd, cmdstr);
+  command->chk = rapi_checksum(command->cmd);
+  return _enqueue(command, callback, timeout);
+}
+
+int
+RapiSender::sendCmd(const String &cmdstr, RapiCommandCompleteHandler callback, unsigned long timeout) {
+  return sendCmd(cmdstr.c_str(), callback, timeout);
+}
 
+int
+RapiSender::sendCmd(const __FlashStringHelper *cmdstr, RapiCommandCompleteHandler callback, unsigned long timeout) {
   PGM_P p = reinterpret_cast<PGM_P>(cmdstr);
-  uint8_t chk = 0;
-  while (1) {
-    uint8_t c = pgm_read_byte(p++);
-    if (c == 0) break;
-    chk ^= c;
+  if (strlen_P(p) >= RAPI_BUFLEN) {
+    return RAPI_RESPONSE_CMD_TOO_LONG;
   }
 
-  _sendTail(chk);
-  return _waitForResult(timeout);
+  RapiCommand *command = new RapiCommand;
+  strcpy_P(command->cmd, p);
+  command->chk = rapi_checksum(command->cmd);
+  return _enqueue(command, callback, timeout);
 }
 
-/*
- * return values:
- * -1= timeout
- * 0= success
- * 1=$NK
- * 2=invalid RAPI response
- * 3=cmdstr too long
-*/
 int
-RapiSender::_waitForResult(unsigned long timeout) {
-  unsigned long mss = millis();
-start:
-  _tokenCnt = 0;
-  *_respBuf = 0;
-  int bufpos = 0;
-  do {
-    int bytesavail = _stream->available();
-    if (bytesavail) {
-      for (int i = 0; i < bytesavail; i++) {
-        char c = _stream->read();
-        if (!bufpos && (c != ESRAPI_SOC)) {
-          // wait for start character
-          continue;
-        } else if (bufpos && (c == ESRAPI_EOC)) {
-          _respBuf[bufpos] = '\0';
-          // Save the original response
-          strncpy(_respBufOrig, _respBuf, RAPI_BUFLEN);
-          if (!_tokenize())
-            break;
-          else
-            goto start;
-        } else {
-          _respBuf[bufpos++] = c;
-          if (bufpos >= (RAPI_BUFLEN - 1))
-            return -2;
+RapiSender::sendCmd(const RapiCmd &cmd, RapiCommandCompleteHandler callback, unsigned long timeout) {
+  RapiCommand *command = new RapiCommand;
+  memcpy(command->cmd, cmd.name, sizeof(cmd.name));
+  command->chk = cmd.chk;
+  return _enqueue(command, callback, timeout);
+}
+
+int
+RapiSender::sendCmd(const RapiCmd &cmd, const RapiArgs &args, RapiCommandCompleteHandler callback, unsigned long timeout) {
+  if (args.overflow()) {
+    return RAPI_RESPONSE_CMD_TOO_LONG;
+  }
+
+  RapiCommand *command = new RapiCommand;
+  memcpy(command->cmd, cmd.name, sizeof(cmd.name) - 1);
+  memcpy(command->cmd + sizeof(cmd.name) - 1, args.str(), args.length() + 1);
+  command->chk = cmd.chk ^ args.checksum();
+  return _enqueue(command, callback, timeout);
+}
+
+// Safety and charge control commands go ahead of everything else, whoever
+// sends them
+static uint8_t
+rapi_priority(const char *cmd, uint8_t source) {
+  if (('F' == cmd[1] && cmd[2] && strchr("SEDR", cmd[2])) ||
+      ('S' == cmd[1] && 'C' == cmd[2])) {
+    return RAPI_PRIORITY_CONTROL;
+  }
+  return RAPI_SOURCE_POLL == source || RAPI_SOURCE_LCD == source ?
+    RAPI_PRIORITY_BACKGROUND : RAPI_PRIORITY_USER;
+}
+
+int
+RapiSender::_enqueue(RapiCommand *command, RapiCommandCompleteHandler callback, unsigned long timeout) {
+  RapiSourceStats *source = &_stats.sources[_source];
+  if (_queued[_source] >= RAPI_SOURCE_QUOTA) {
+    source->rejected++;
+    delete command;
+    return RAPI_RESPONSE_QUEUE_FULL;
+  }
+
+  command->next = nullptr;
+  command->source = _source;
+  command->priority = rapi_priority(command->cmd, _source);
+  command->queued = millis();
+  command->timeout = timeout;
+  command->callback = callback;
+
+  uint8_t priority = command->priority;
+  if (_tail[priority]) {
+    _tail[priority]->next = command;
+  } else {
+    _head[priority] = command;
+  }
+  _tail[priority] = command;
+  _queued[_source]++;
+  source->queued++;
+
+  return RAPI_RESPONSE_QUEUED;
+}
+
+// The command to send next, the oldest in the highest priority queue from
+// the source after the one last sent from that queue
+RapiCommand *
+RapiSender::_nextCommand(RapiCommand *&prev) {
+  for (int priority = 0; priority < RAPI_PRIORITY_COUNT; priority++)
+  {
+    RapiCommand *next = nullptr;
+    uint8_t nextTurn = RAPI_SOURCE_COUNT;
+    RapiCommand *last = nullptr;
+    for (RapiCommand *command = _head[priority]; command; command = command->next)
+    {
+      uint8_t turn = (command->source + RAPI_SOURCE_COUNT - _lastSource[priority] - 1) %
+                     RAPI_SOURCE_COUNT;
+      if (turn < nextTurn) {
+        next = command;
+        nextTurn = turn;
+        prev = last;
+        if (0 == turn) {
+          break;
         }
       }
+      last = command;
+    }
+
+    if (next) {
+      return next;
+    }
+  }
+
+  return nullptr;
+}
+
+// Only pipeline commands once we know the responses can be matched to the
+// commands by the sequence id
+bool
+RapiSender::_canSend(RapiCommand *command) {
+  if (0 == _inFlight) {
+    return true;
+  }
+
+  if (!_sequenceIdConfirmed()) {
+    return false;
+  }
+
+  // Worst case length of the command with the sequence id and checksum
+  uint8_t length = strlen(command->cmd) + 8;
+  return _inFlight < RAPI_MAX_IN_FLIGHT &&
+         (_inFlightBytes + length) <= RAPI_MAX_IN_FLIGHT_BYTES;
+}
+
+// Send the next commands while the pipeline has space
+void
+RapiSender::_sendNext() {
+  RapiCommand *prev = nullptr;
+  RapiCommand *command;
+  while (nullptr != (command = _nextCommand(prev)) && _canSend(command)) {
+    uint8_t priority = command->priority;
+    if (prev) {
+      prev->next = command->next;
+    } else {
+      _head[priority] = command->next;
+    }
+    if (_tail[priority] == command) {
+      _tail[priority] = prev;
+    }
+    _lastSource[priority] = command->source;
+    _queued[command->source]--;
+
+    command->next = nullptr;
+    command->length = _sendCmd(command);
+    command->sequenceId = _sequenceId;
+    command->sent = millis();
+    _commandStats(command->cmd)->sent++;
+
+    RapiSourceStats *source = &_stats.sources[command->source];
+    uint32_t delay = command->sent - command->queued;
+    source->sent++;
+    source->delayTotal += delay;
+    if (delay > source->delayMax) {
+      source->delayMax = delay;
+    }
+
+    if (_sentTail) {
+      _sentTail->next = command;
+    } else {
+      _sentHead = command;
+    }
+    _sentTail = command;
+    _inFlight++;
+    _inFlightBytes += command->length;
+  }
+}
+
+// Find the command the last response is for
+RapiCommand *
+RapiSender::_matchResponse() {
+  if (nullptr == _sentHead) {
+    // Nothing sent, probably a response to a command that timed out
+    _stats.unexpected++;
+    return nullptr;
+  }
+
+  if (RAPI_INVALID_SEQUENCE_ID == _respSequenceId || !_sequenceIdEnabled())
+  {
+    if (_sequenceIdEnabled() && !_sequenceIdConfirmed()) {
+      // The EVSE does not echo the sequence id, stick to one command at a time
+      dbgprintln("No sequence id in response, disabling");
+      enableSequenceId(0);
+    }
+
+    // Responses come back in order
+    return _sentHead;
+  }
+
+  for (RapiCommand *command = _sentHead; command; command = command->next)
+  {
+    if (command->sequenceId == _respSequenceId)
+    {
+      _flags |= RSF_SEQUENCE_ID_CONFIRMED;
+
+      // The EVSE processes the commands in order, so anything sent before
+      // this has been lost
+      while (_sentHead != command) {
+        _complete(_sentHead, RAPI_RESPONSE_TIMEOUT);
+      }
+
+      return command;
+    }
+  }
+
+#ifdef DBG
+  dbgprint("bad seqid ");
+  dbgprintln(_respSequenceId);
+#endif
+  _stats.badSequenceId++;
+
+  return nullptr;
+}
+
+// Remove a sent command from the in flight list and let the caller know the
+// result
+void
+RapiSender::_complete(RapiCommand *command, int ret) {
+  RapiCommand *prev = nullptr;
+  for (RapiCommand *node = _sentHead; node != command; node = node->next) {
+    prev = node;
+  }
+  if (prev) {
+    prev->next = command->next;
+  } else {
+    _sentHead = command->next;
+  }
+  if (_sentTail == command) {
+    _sentTail = prev;
+  }
+  _inFlight--;
+  _inFlightBytes -= command->length;
+
+  RapiCommandStats *stats = _commandStats(command->cmd);
+  switch (ret)
+  {
+    case RAPI_RESPONSE_OK:              stats->ok++;       break;
+    case RAPI_RESPONSE_NK:              stats->nk++;       break;
+    case RAPI_RESPONSE_TIMEOUT:         stats->timeout++;  break;
+    case RAPI_RESPONSE_BUFFER_OVERFLOW: stats->overflow++; break;
+    default:                            stats->invalid++;  break;
+  }
+  if (RAPI_RESPONSE_TIMEOUT != ret)
+  {
+    uint32_t latency = millis() - command->sent;
+    int bucket = 0;
+    while (bucket < RAPI_STATS_BUCKETS - 1 && latency > latency_buckets_ms[bucket]) {
+      bucket++;
+    }
+    stats->latency[bucket]++;
+    stats->latencyTotal += latency;
+    if (latency > stats->latencyMax) {
+      stats->latencyMax = latency;
     }
-  } while (!_tokenCnt && ((millis() - mss) < timeout));
+  }
+
+  int tokenCnt = _tokenCnt;
+  if (RAPI_RESPONSE_TIMEOUT == ret || RAPI_RESPONSE_BUFFER_OVERFLOW == ret) {
+    _tokenCnt = 0;
+  }
 
 #ifdef DBG
   dbgprint("TOKENCNT: ");
   dbgprintln(_tokenCnt);
   for (int i = 0; i < _tokenCnt; i++) {
-    dbgprintln(_tokens[i]);
+    dbgprintln(getTokenString(i));
   }
   dbgprintln("");
 #endif
 
-  if (_tokenCnt > 0) {
-    if (!strcmp(_tokens[0], "$OK")) {
-      return 0;
-    } else if (!strcmp(_tokens[0], "$NK")) {
-      return 1;
-    } else if (!strcmp(_tokens[0],"$WF") ||
-               !strcmp(_tokens[0],"$ST"))
-    {
-      // async EVSE state transition or WiFi event
-      if(nullptr != _onRapiEvent) {
-        _onRapiEvent();
+  // Even a write that timed out may have been applied
+  if (_onRapiWrite && rapi_is_write(command->cmd)) {
+    _onRapiWrite(command->cmd);
+  }
+
+  if (command->callback) {
+    // Anything queued by the callback is from the same source
+    uint8_t source = _source;
+    _source = command->source;
+    command->callback(ret);
+    _source = source;
+  }
+  delete command;
+
+  // The response may still be needed for a later command
+  _tokenCnt = tokenCnt;
+}
+
+/*
+ * Consume the bytes that are available from the stream, the partial frame is
+ * kept in _respBuf between calls so this never waits for the rest of a frame.
+ * Async events are dispatched as they arrive.
+ *
+ * return values:
+ * -3= no complete response yet
+ * -2= response buffer overflow
+ * 0= success
+ * 1=$NK
+ * 2=invalid RAPI response
+*/
+int
+RapiSender::_readResponse() {
+  while (_stream->available()) {
+    char c = _stream->read();
+    trace(RAPI_TRACE_RX, &c, 1);
+    if (c == ESRAPI_SOC) {
+      // Start of a frame, if we were part way through one it has been
+      // truncated so start again
+      _respBuf[0] = c;
+      _respBufPos = 1;
+    } else if (!_respBufPos) {
+      // wait for start character
+      continue;
+    } else if (c == ESRAPI_EOC) {
+      // One trace record per frame so each has its own time
+      traceEnd();
+      _respBuf[_respBufPos] = '\0';
+      _respBufPos = 0;
+      if (_tokenize()) {
+        _stats.badChecksum++;
+        continue;
+      }
+      if (0 == _tokenCnt) {
+        continue;
+      }
+
+      if (tokenEquals(0, "$OK")) {
+        return RAPI_RESPONSE_OK;
+      } else if (tokenEquals(0, "$NK")) {
+        return RAPI_RESPONSE_NK;
+      } else if (tokenEquals(0, "$WF") ||
+                 tokenEquals(0, "$ST"))
+      {
+        // async EVSE state transition or WiFi event
+        _stats.events++;
+        if (nullptr != _onRapiEvent) {
+          _onRapiEvent();
+        }
+      } else { // not OK or NK
+        return RAPI_RESPONSE_INVALID_RESPONSE;
+      }
+    } else {
+      _respBuf[_respBufPos++] = c;
+      if (_respBufPos >= (RAPI_BUFLEN - 1)) {
+        _respBufPos = 0;
+        return RAPI_RESPONSE_BUFFER_OVERFLOW;
       }
-      goto start;
-    } else { // not OK or NK
-      return 2;
     }
-  } else { // !_tokenCnt
-    return -1;
   }
+
+  return RAPI_RESPONSE_QUEUED;
 }
 
 void
@@ -273,12 +741,76 @@ RapiSender::enableSequenceId(uint8_t tf) {
     _sequenceId = RAPI_INVALID_SEQUENCE_ID;
     _flags &= ~RSF_SEQUENCE_ID_ENABLED;
   }
+  _flags &= ~RSF_SEQUENCE_ID_CONFIRMED;
 }
 
 void
-RapiSender::loop()
+RapiSender::enableFlush(uint8_t tf) {
+  if (tf) {
+    _flags |= RSF_FLUSH;
+  } else {
+    _flags &= ~RSF_FLUSH;
+  }
+}
+
+// Process whatever has arrived from the EVSE, never waits for more. If done
+// is set stop as soon as it has been updated by a completion callback so the
+// response tokens are still valid for the caller.
+void
+RapiSender::_poll(const int *done)
 {
-  if(_stream->available()) {
-    _waitForResult(RAPI_TIMEOUT_MS);
+  // Not again from a completion callback, the command being completed is
+  // still on the sent list
+  if (_flags & RSF_POLLING) {
+    return;
+  }
+  _flags |= RSF_POLLING;
+  _pollResponses(done);
+  _flags &= ~RSF_POLLING;
+}
+
+void
+RapiSender::_pollResponses(const int *done)
+{
+  _sendNext();
+
+  int ret;
+  while (RAPI_RESPONSE_QUEUED != (ret = _readResponse()))
+  {
+    // Can't tell who an overflowed response was for, assume the oldest
+    RapiCommand *command = RAPI_RESPONSE_BUFFER_OVERFLOW == ret ?
+      _sentHead : _matchResponse();
+    if (command)
+    {
+      _complete(command, ret);
+      _sendNext();
+      if (done && RAPI_RESPONSE_QUEUED != *done) {
+        return;
+      }
+    }
+  }
+
+  unsigned long now = millis();
+  RapiCommand *command = _sentHead;
+  while (command)
+  {
+    if ((now - command->sent) >= command->timeout)
+    {
+      _complete(command, RAPI_RESPONSE_TIMEOUT);
+      if (done && RAPI_RESPONSE_QUEUED != *done) {
+        return;
+      }
+      command = _sentHead;
+    } else {
+      command = command->next;
+    }
   }
+
+  _sendNext();
+}
+
+void
+RapiSender::loop()
+{
+  _poll(nullptr);
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <Stream.h>
+#include <functional>
 
 // only enable if RAPI ver
 #define RAPI_SEQUENCE_ID
@@ -9,6 +10,47 @@
 #define RAPI_TIMEOUT_MS 500
 #define RAPI_BUFLEN 40
 #define RAPI_MAX_TOKENS 10
+// A queued command plus " :SS^CK\r"
+#define RAPI_FRAME_LEN (RAPI_BUFLEN + 8)
+
+// Max commands waiting for a response once the EVSE is known to echo the
+// sequence id, limited by the bytes outstanding so we don't overrun the
+// 64 byte serial receive buffer on the EVSE
+#ifndef RAPI_MAX_IN_FLIGHT
+#define RAPI_MAX_IN_FLIGHT 4
+#endif
+#ifndef RAPI_MAX_IN_FLIGHT_BYTES
+#define RAPI_MAX_IN_FLIGHT_BYTES 60
+#endif
+
+// Link statistics are kept for this many different commands, anything else
+// is counted under "*"
+#ifndef RAPI_STATS_MAX_COMMANDS
+#define RAPI_STATS_MAX_COMMANDS 12
+#endif
+#define RAPI_STATS_BUCKETS 8
+
+// Who queued a command, see RapiSourceScope
+#define RAPI_SOURCE_OTHER         0
+#define RAPI_SOURCE_POLL          1   // Polling of the EVSE values and settings
+#define RAPI_SOURCE_HTTP          2
+#define RAPI_SOURCE_MQTT          3
+#define RAPI_SOURCE_DIVERT        4
+#define RAPI_SOURCE_LCD           5
+#define RAPI_SOURCE_OHM           6
+#define RAPI_SOURCE_COUNT         7
+
+// Queue priorities, highest first. Commands from one source keep their
+// order within a priority, the sources take turns.
+#define RAPI_PRIORITY_CONTROL     0   // $FS $FE $FD $FR $SC, from any source
+#define RAPI_PRIORITY_USER        1   // HTTP, MQTT, divert, Ohm Connect
+#define RAPI_PRIORITY_BACKGROUND  2   // Polling and the LCD
+#define RAPI_PRIORITY_COUNT       3
+
+// Commands a source can have queued but not yet sent
+#ifndef RAPI_SOURCE_QUOTA
+#define RAPI_SOURCE_QUOTA 8
+#endif
 
 #define ESRAPI_SOC '$' // start of command
 #define ESRAPI_EOC 0xd // CR end of command
@@ -16,45 +58,284 @@
 
 // _flags
 #define RSF_SEQUENCE_ID_ENABLED   0x01
+#define RSF_SEQUENCE_ID_CONFIRMED 0x02
+#define RSF_FLUSH                 0x04
+#define RSF_POLLING               0x08    // In _poll(), so in a completion callback
+#define RSF_WAITING               0x10    // In a blocking sendCmd()
+
+// sendCmd() return values
+#define RAPI_RESPONSE_WOULD_DEADLOCK     -5
+#define RAPI_RESPONSE_QUEUE_FULL         -4
+#define RAPI_RESPONSE_QUEUED             -3
+#define RAPI_RESPONSE_BUFFER_OVERFLOW    -2
+#define RAPI_RESPONSE_TIMEOUT            -1
+#define RAPI_RESPONSE_OK                  0
+#define RAPI_RESPONSE_NK                  1
+#define RAPI_RESPONSE_INVALID_RESPONSE    2
+#define RAPI_RESPONSE_CMD_TOO_LONG        3
+
+#include "RapiCommands.h"
+
+#ifdef ENABLE_RAPI_TRACE
+#include "RapiTrace.h"
+#endif
 
 typedef void (* fnRapiEvent)();
 
+// Called when a write command (see rapi_is_write()) completes, however it
+// completed, before the sender's callback
+typedef void (* fnRapiWrite)(const char *cmd);
+
+// View of a token in the response buffer, not NUL terminated
+struct RapiToken
+{
+  const char *str;
+  uint8_t len;
+};
+
+// Called when a queued command completes, ret is one of the RAPI_RESPONSE_*
+// values. The response tokens are only valid for the duration of the call.
+typedef std::function<void(int ret)> RapiCommandCompleteHandler;
+
+struct RapiCommand
+{
+  RapiCommand *next;
+  char cmd[RAPI_BUFLEN];
+  uint8_t chk;                // Checksum of cmd, worked out when queued
+  uint8_t source;             // RAPI_SOURCE_*
+  uint8_t priority;           // RAPI_PRIORITY_*
+  unsigned long queued;
+  unsigned long timeout;
+  RapiCommandCompleteHandler callback;
+
+  // Set when sent
+  unsigned long sent;
+  uint8_t sequenceId;
+  uint8_t length;
+};
+
+// Outcome of each command sent, by the two letter command name
+struct RapiCommandStats
+{
+  char cmd[3];                // eg "GE", empty if the slot is free
+  uint32_t sent;
+  uint32_t ok;
+  uint32_t nk;
+  uint32_t timeout;
+  uint32_t invalid;
+  uint32_t overflow;
+  uint32_t latencyTotal;      // ms, responses only
+  uint32_t latencyMax;
+  uint32_t latency[RAPI_STATS_BUCKETS];   // see RapiSender::latencyBucketMs()
+};
+
+// Queueing for each RAPI_SOURCE_*
+struct RapiSourceStats
+{
+  uint32_t queued;
+  uint32_t rejected;          // Over RAPI_SOURCE_QUOTA
+  uint32_t sent;
+  uint32_t delayTotal;        // ms from queued to sent, commands sent only
+  uint32_t delayMax;
+};
+
+struct RapiLinkStats
+{
+  uint32_t badChecksum;       // Frames dropped, can't tell what they were for
+  uint32_t badSequenceId;     // Responses that match no command in flight
+  uint32_t unexpected;        // Responses with no command in flight
+  uint32_t events;
+  RapiCommandStats commands[RAPI_STATS_MAX_COMMANDS];
+  RapiSourceStats sources[RAPI_SOURCE_COUNT];
+};
+
 class RapiSender {
   Stream *_stream;
   uint8_t _sequenceId;
+  uint8_t _respSequenceId;
   uint8_t _flags;
   int _tokenCnt;
-  char *_tokens[RAPI_MAX_TOKENS];
+  uint8_t _tokenStart[RAPI_MAX_TOKENS];
+  uint8_t _tokenLen[RAPI_MAX_TOKENS];
   fnRapiEvent _onRapiEvent;
+  fnRapiWrite _onRapiWrite;
 
+  // The last complete response, or the partial frame being received. The
+  // tokens index in to this so it is never modified once tokenized.
   char _respBuf[RAPI_BUFLEN];
-  char _respBufOrig[RAPI_BUFLEN];
+  int _respBufPos;
+
+  // Command queue for each priority, _sentHead is the oldest command
+  // waiting for a response
+  RapiCommand *_head[RAPI_PRIORITY_COUNT];
+  RapiCommand *_tail[RAPI_PRIORITY_COUNT];
+  uint8_t _lastSource[RAPI_PRIORITY_COUNT];   // Last source sent from each queue
+  uint8_t _queued[RAPI_SOURCE_COUNT];
+  uint8_t _source;            // Source of the commands being queued
+  RapiCommand *_sentHead;
+  RapiCommand *_sentTail;
+  uint8_t _inFlight;
+  uint8_t _inFlightBytes;
+
+  RapiLinkStats _stats;
+
+#ifdef ENABLE_RAPI_TRACE
+  RapiTrace _trace;
+#endif
+
   int _tokenize();
-  void _sendCmd(const char *cmdstr);
-  void _sendTail(uint8_t chk);
-  int _waitForResult(unsigned long timeout);
+  int _sendCmd(RapiCommand *command);
+  int _waitForCommand(int queued, int &ret);
+  bool _canBlock();
+  int _enqueue(RapiCommand *command, RapiCommandCompleteHandler callback, unsigned long timeout);
+  bool _canSend(RapiCommand *command);
+  RapiCommand *_nextCommand(RapiCommand *&prev);
+  void _sendNext();
+  int _readResponse();
+  RapiCommand *_matchResponse();
+  void _complete(RapiCommand *command, int ret);
+  void _poll(const int *done);
+  void _pollResponses(const int *done);
+  RapiCommandStats *_commandStats(const char *cmd);
   uint8_t _sequenceIdEnabled() {
     return (_flags & RSF_SEQUENCE_ID_ENABLED) ? 1 : 0;
   }
+  uint8_t _sequenceIdConfirmed() {
+    return (_flags & RSF_SEQUENCE_ID_CONFIRMED) ? 1 : 0;
+  }
 
 public:
 
   RapiSender(Stream *stream);
   void setStream(Stream *stream) { _stream = stream; }
   //  void sendString(const char *str) { dbgprint(str); }
+
+  // Blocking API, waits for any queued commands and then the response,
+  // which can be a whole poll cycle. Only for code running from the main
+  // loop: not from a completion callback, where RAPI_RESPONSE_WOULD_DEADLOCK
+  // is returned, and not from the AsyncTCP context, which can't yield().
+  // Everything in the firmware uses the async API.
   int sendCmd(const char *cmdstr, unsigned long timeout=RAPI_TIMEOUT_MS);
-  int sendCmd(String &cmdstr, unsigned long timeout=RAPI_TIMEOUT_MS);
+  int sendCmd(const String &cmdstr, unsigned long timeout=RAPI_TIMEOUT_MS);
   int sendCmd(const __FlashStringHelper *cmdstr, unsigned long timeout=RAPI_TIMEOUT_MS);
+
+  // Async API, the command is sent from loop() and callback is called with
+  // the result. Returns RAPI_RESPONSE_QUEUED or an error if the command could
+  // not be queued, in which case the callback is not called.
+  int sendCmd(const char *cmdstr, RapiCommandCompleteHandler callback, unsigned long timeout=RAPI_TIMEOUT_MS);
+  int sendCmd(const String &cmdstr, RapiCommandCompleteHandler callback, unsigned long timeout=RAPI_TIMEOUT_MS);
+  int sendCmd(const __FlashStringHelper *cmdstr, RapiCommandCompleteHandler callback, unsigned long timeout=RAPI_TIMEOUT_MS);
+
+  // Commands from the catalogue in RapiCommands.h, no String or checksum
+  // work when queuing
+  int sendCmd(const RapiCmd &cmd, RapiCommandCompleteHandler callback, unsigned long timeout=RAPI_TIMEOUT_MS);
+  int sendCmd(const RapiCmd &cmd, const RapiArgs &args, RapiCommandCompleteHandler callback, unsigned long timeout=RAPI_TIMEOUT_MS);
+
+  // As above with the reply parsed in to one of the RapiReply* structs, eg
+  //   sendCmd<RapiReplyGG>(RAPI_CMD_GG, [](int ret, const RapiReplyGG &gg) { ... });
+  // A $OK reply that is too short is reported as RAPI_RESPONSE_INVALID_RESPONSE
+  template<typename Reply>
+  int sendCmd(const RapiCmd &cmd, std::function<void(int ret, const Reply &reply)> callback, unsigned long timeout=RAPI_TIMEOUT_MS) {
+    return sendCmd(cmd, [this, callback](int ret) {
+      Reply reply = Reply();
+      if (RAPI_RESPONSE_OK == ret && !reply.parse(*this)) {
+        ret = RAPI_RESPONSE_INVALID_RESPONSE;
+      }
+      if (callback) {
+        callback(ret, reply);
+      }
+    }, timeout);
+  }
+
+  // Parse the last response
+  template<typename Reply>
+  bool getReply(Reply &reply) {
+    return reply.parse(*this);
+  }
+
   void enableSequenceId(uint8_t tf);
+  // Wait for each command to leave the UART before returning from loop(),
+  // off by default so pipelined commands are not held up
+  void enableFlush(uint8_t tf);
   int8_t getTokenCnt() { return _tokenCnt; }
-  const char *getResponse() { return _respBufOrig; }
-  const char *getToken(int i) {
-    if (i < _tokenCnt) return _tokens[i];
-    else return NULL;
+  const char *getResponse() { return _respBuf; }
+  RapiToken getToken(int i) {
+    RapiToken token = { "", 0 };
+    if (i < _tokenCnt) {
+      token.str = _respBuf + _tokenStart[i];
+      token.len = _tokenLen[i];
+    }
+    return token;
+  }
+  bool tokenEquals(int i, const char *str);
+  long getTokenInt(int i, int base = 10);
+  unsigned long getTokenHex(int i) {
+    return (unsigned long)getTokenInt(i, 16);
   }
+  // Allocates, only use for values that are kept as a String
+  String getTokenString(int i);
   void setOnEvent(fnRapiEvent callback) {
     _onRapiEvent = callback;
   }
+  void setOnWrite(fnRapiWrite callback) {
+    _onRapiWrite = callback;
+  }
+  bool isBusy() {
+    for (int i = 0; i < RAPI_PRIORITY_COUNT; i++) {
+      if (nullptr != _head[i]) {
+        return true;
+      }
+    }
+    return nullptr != _sentHead;
+  }
+  // Commands queued to send from a source, use RapiSourceScope to set the
+  // source of new commands
+  uint8_t getQueued(uint8_t source) {
+    return _queued[source];
+  }
+  uint8_t getSource() {
+    return _source;
+  }
+  void setSource(uint8_t source) {
+    _source = source;
+  }
+  static const char *sourceName(uint8_t source);
+  // True if more than one command can be waiting for a response
+  bool isPipelined() {
+    return _sequenceIdConfirmed();
+  }
+  const RapiLinkStats &getStats() {
+    return _stats;
+  }
+  void resetStats();
+  // Upper limit (ms) of the latency histogram buckets, 0 for the last one
+  // which has everything slower
+  static uint16_t latencyBucketMs(int bucket);
+#ifdef ENABLE_RAPI_TRACE
+  RapiTrace &getTrace() {
+    return _trace;
+  }
+#endif
   void loop();
 };
 
+// Commands queued while this is in scope are from source, eg
+//   RapiSourceScope scope(rapiSender, RAPI_SOURCE_LCD);
+// Commands queued from a completion callback are from the same source as
+// the command that completed.
+class RapiSourceScope
+{
+  RapiSender &_sender;
+  uint8_t _previous;
+
+public:
+  RapiSourceScope(RapiSender &sender, uint8_t source) :
+    _sender(sender),
+    _previous(sender.getSource())
+  {
+    sender.setSource(source);
+  }
+  ~RapiSourceScope() {
+    _sender.setSource(_previous);
+  }
+};
@@ -0,0 +1,135 @@
+#include "RapiTrace.h"
+
+void
+RapiTrace::clear() {
+  _start = 0;
+  _used = 0;
+  _open = -1;
+}
+
+// Drop the oldest records until there is room for bytes more
+void
+RapiTrace::_reserve(uint16_t bytes) {
+  while (RAPI_TRACE_SIZE - _used < bytes)
+  {
+    uint16_t length = RAPI_TRACE_HEADER + _at(RAPI_TRACE_HEADER - 1);
+    if (_open == (_start + RAPI_TRACE_HEADER - 1) % RAPI_TRACE_SIZE) {
+      _open = -1;
+    }
+    _start = (_start + length) % RAPI_TRACE_SIZE;
+    _used -= length;
+  }
+}
+
+void
+RapiTrace::append(char dir, const char *data, size_t len) {
+  for (size_t i = 0; i < len; i++)
+  {
+    if (_open < 0 ||
+        RAPI_TRACE_MAX_RUN == _buf[_open] ||
+        dir != (char)_buf[(_open + RAPI_TRACE_SIZE - RAPI_TRACE_HEADER + 1) % RAPI_TRACE_SIZE])
+    {
+      _reserve(RAPI_TRACE_HEADER + 1);
+      uint32_t now = micros();
+      _put(dir);
+      _put(now);
+      _put(now >> 8);
+      _put(now >> 16);
+      _put(now >> 24);
+      _open = (_start + _used) % RAPI_TRACE_SIZE;
+      _put(0);
+    } else {
+      // Never drops the open run, the buffer holds at least two full runs
+      _reserve(1);
+    }
+
+    _put(data[i]);
+    _buf[_open]++;
+  }
+}
+
+size_t
+RapiTrace::dump(Print &out) {
+  size_t n = 0;
+  uint16_t offset = 0;
+  while (offset < _used)
+  {
+    char dir = _at(offset);
+    uint32_t time = (uint32_t)_at(offset + 1) |
+                    ((uint32_t)_at(offset + 2) << 8) |
+                    ((uint32_t)_at(offset + 3) << 16) |
+                    ((uint32_t)_at(offset + 4) << 24);
+    uint8_t len = _at(offset + 5);
+    offset += RAPI_TRACE_HEADER;
+
+    n += out.print(time);
+    n += out.print(' ');
+    n += out.print(dir);
+    n += out.print(' ');
+    for (uint8_t i = 0; i < len; i++, offset++)
+    {
+      char c = _at(offset);
+      if ('\r' == c) {
+        n += out.print(F("\\r"));
+      } else if ('\\' == c) {
+        n += out.print(F("\\\\"));
+      } else if (c < ' ' || c > '~') {
+        char hex[5];
+        sprintf(hex, "\\x%02X", (uint8_t)c);
+        n += out.print(hex);
+      } else {
+        n += out.print(c);
+      }
+    }
+    n += out.print('\n');
+  }
+
+  return n;
+}
+
+static int
+hex_digit(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  return -1;
+}
+
+int
+RapiTrace::parse(const char *line, uint32_t &time, char &dir, char *data, size_t size) {
+  char *end;
+  time = strtoul(line, &end, 10);
+  if (end == line || ' ' != end[0] ||
+      (RAPI_TRACE_TX != end[1] && RAPI_TRACE_RX != end[1]) ||
+      ' ' != end[2]) {
+    return -1;
+  }
+  dir = end[1];
+
+  size_t len = 0;
+  for (const char *s = end + 3; *s && '\n' != *s && len < size; s++)
+  {
+    char c = *s;
+    if ('\\' == c)
+    {
+      c = *++s;
+      if ('r' == c) {
+        c = '\r';
+      } else if ('x' == c && hex_digit(s[1]) >= 0 && hex_digit(s[2]) >= 0) {
+        c = (hex_digit(s[1]) << 4) | hex_digit(s[2]);
+        s += 2;
+      } else if ('\\' != c) {
+        return -1;
+      }
+    }
+    data[len++] = c;
+  }
+
+  return len;
+}
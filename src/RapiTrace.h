@@ -0,0 +1,66 @@
+#pragma once
+// Ring buffer trace of the raw RAPI serial traffic, enabled with
+// ENABLE_RAPI_TRACE
+//
+// Each record is a run of bytes in one direction with the micros() time
+// the run started. The oldest records are dropped to make room. dump()
+// writes the trace as text, one record per line:
+//
+//   <micros> <direction> <bytes>
+//
+// where the direction is '>' for ESP to EVSE and '<' for EVSE to ESP, and
+// the bytes are escaped C style (\r, \\, \xNN). bench/rapi_replay reads the
+// same format.
+
+#include <Arduino.h>
+
+#ifndef RAPI_TRACE_SIZE
+#define RAPI_TRACE_SIZE 2048
+#endif
+
+#define RAPI_TRACE_TX '>'
+#define RAPI_TRACE_RX '<'
+
+// direction, micros (4), length
+#define RAPI_TRACE_HEADER 6
+#define RAPI_TRACE_MAX_RUN 255
+
+static_assert(RAPI_TRACE_SIZE > 2 * (RAPI_TRACE_HEADER + RAPI_TRACE_MAX_RUN),
+              "RAPI_TRACE_SIZE too small");
+
+class RapiTrace
+{
+  uint8_t _buf[RAPI_TRACE_SIZE];
+  uint16_t _start;            // Oldest record
+  uint16_t _used;
+  int _open;                  // Offset of the length of the open run, -1 if none
+
+  uint8_t _at(uint16_t offset) {
+    return _buf[(_start + offset) % RAPI_TRACE_SIZE];
+  }
+  void _put(uint8_t c) {
+    _buf[(_start + _used) % RAPI_TRACE_SIZE] = c;
+    _used++;
+  }
+  void _reserve(uint16_t bytes);
+
+public:
+  RapiTrace() {
+    clear();
+  }
+
+  // Add bytes to the current run, or start a new one if the direction has
+  // changed or the run is full
+  void append(char dir, const char *data, size_t len);
+  // The next bytes start a new run
+  void endRun() {
+    _open = -1;
+  }
+  void clear();
+
+  size_t dump(Print &out);
+
+  // Parse a line written by dump(), returns the number of bytes in data or
+  // -1 if the line is not a record
+  static int parse(const char *line, uint32_t &time, char &dir, char *data, size_t size);
+};
@@ -0,0 +1,134 @@
+#if defined(ENABLE_DEBUG) && !defined(ENABLE_DEBUG_RAPI)
+#undef ENABLE_DEBUG
+#endif
+
+#include <Arduino.h>
+#include "RapiTransaction.h"
+#include "debug.h"
+
+RapiTransaction::RapiTransaction(RapiSender &sender, const char *name, uint8_t source,
+                                 unsigned long timeout) :
+  _sender(sender),
+  _name(name),
+  _source(source),
+  _timeout(timeout),
+  _started(0),
+  _run(0),
+  _running(false),
+  _sent(false),
+  _onEnd(nullptr)
+{
+}
+
+bool
+RapiTransaction::begin(Step first, EndHandler onEnd) {
+  if (isRunning()) {
+    return false;
+  }
+
+  _run++;
+  _running = true;
+  _started = millis();
+  _onEnd = onEnd;
+  _step(first, RAPI_RESPONSE_OK);
+
+  return true;
+}
+
+void
+RapiTransaction::_step(const Step &step, int ret) {
+  RapiSourceScope source(_sender, _source);
+
+  _sent = false;
+  if (step) {
+    step(ret);
+  }
+
+  // Nothing more to send, done
+  if (_running && !_sent) {
+    _end(true);
+  }
+}
+
+void
+RapiTransaction::_reply(uint16_t run, const Step &next, int ret) {
+  if (!_running || run != _run) {
+    // Aborted while the command was queued
+    return;
+  }
+
+  if (millis() - _started > _timeout) {
+    DBUGF("%s: timed out", _name);
+    abort();
+    return;
+  }
+
+  _step(next, ret);
+}
+
+bool
+RapiTransaction::_queued(int ret) {
+  if (RAPI_RESPONSE_QUEUED == ret) {
+    _sent = true;
+    return true;
+  }
+
+  DBUGF("%s: failed to queue, %d", _name, ret);
+  abort();
+  return false;
+}
+
+bool
+RapiTransaction::send(const RapiCmd &cmd, Step next) {
+  if (!_running || _sent) {
+    DBUGF("%s: send outside of a step", _name);
+    return false;
+  }
+
+  uint16_t run = _run;
+  return _queued(_sender.sendCmd(cmd, [this, run, next](int ret) {
+    _reply(run, next, ret);
+  }));
+}
+
+bool
+RapiTransaction::send(const RapiCmd &cmd, const RapiArgs &args, Step next) {
+  if (!_running || _sent) {
+    DBUGF("%s: send outside of a step", _name);
+    return false;
+  }
+
+  uint16_t run = _run;
+  return _queued(_sender.sendCmd(cmd, args, [this, run, next](int ret) {
+    _reply(run, next, ret);
+  }));
+}
+
+void
+RapiTransaction::abort() {
+  if (_running) {
+    DBUGF("%s: aborted", _name);
+    _end(false);
+  }
+}
+
+bool
+RapiTransaction::isRunning() {
+  if (_running && millis() - _started > _timeout) {
+    DBUGF("%s: timed out", _name);
+    abort();
+  }
+  return _running;
+}
+
+void
+RapiTransaction::_end(bool completed) {
+  _running = false;
+
+  // The handler may start the transaction again
+  EndHandler onEnd = _onEnd;
+  _onEnd = nullptr;
+  if (onEnd) {
+    onEnd(completed);
+  }
+}
@@ -0,0 +1,90 @@
+#pragma once
+// A sequence of RAPI commands where each step runs when the reply to the
+// last command arrives, so the next command can depend on the reply
+// without waiting in loop(), eg
+//
+//   static RapiTransaction wake(rapiSender, "wake", RAPI_SOURCE_DIVERT);
+//
+//   wake.begin([](int ret) {
+//     wake.send<RapiReplyGD>(RAPI_CMD_GD, [](int ret, const RapiReplyGD &gd) {
+//       wake.send(gd.enabled() ? RAPI_CMD_F1 : RAPI_CMD_FE, nullptr);
+//     });
+//   });
+//
+// A step continues the transaction by sending one command, the transaction
+// completes when a step returns without sending anything. It is aborted
+// if a command can't be queued, abort() is called or it takes longer than
+// its timeout. Replies to the commands of an aborted transaction are
+// ignored, the end handler is called exactly once either way so anything
+// the steps share can be freed there.
+
+#include "RapiSender.h"
+
+// Longest a transaction can run for, each command also has its own
+// RAPI_TIMEOUT_MS
+#ifndef RAPI_TRANSACTION_TIMEOUT_MS
+#define RAPI_TRANSACTION_TIMEOUT_MS 5000
+#endif
+
+class RapiTransaction
+{
+public:
+  // ret is the result of the command the step was waiting for, or
+  // RAPI_RESPONSE_OK for the first step
+  typedef std::function<void(int ret)> Step;
+  typedef std::function<void(bool completed)> EndHandler;
+
+private:
+  RapiSender &_sender;
+  const char *_name;
+  uint8_t _source;            // RAPI_SOURCE_* of the commands sent
+  unsigned long _timeout;
+  unsigned long _started;
+  uint16_t _run;              // Replies from an earlier run are ignored
+  bool _running;
+  bool _sent;                 // The step being run has sent its command
+  EndHandler _onEnd;
+
+  void _step(const Step &step, int ret);
+  void _reply(uint16_t run, const Step &next, int ret);
+  bool _queued(int ret);
+  void _end(bool completed);
+
+public:
+  RapiTransaction(RapiSender &sender, const char *name, uint8_t source,
+                  unsigned long timeout = RAPI_TRANSACTION_TIMEOUT_MS);
+
+  // Start the transaction, the first step is run straight away. Returns
+  // false if the transaction is already running.
+  bool begin(Step first, EndHandler onEnd = nullptr);
+
+  // From a step, send cmd and run next with the result. next can be
+  // nullptr if this is the last command. Returns false, and aborts the
+  // transaction, if the command could not be queued.
+  bool send(const RapiCmd &cmd, Step next);
+  bool send(const RapiCmd &cmd, const RapiArgs &args, Step next);
+
+  // As above with the reply parsed in to one of the RapiReply* structs
+  template<typename Reply>
+  bool send(const RapiCmd &cmd, std::function<void(int ret, const Reply &reply)> next) {
+    return send(cmd, [this, next](int ret) {
+      Reply reply = Reply();
+      if (RAPI_RESPONSE_OK == ret && !_sender.getReply(reply)) {
+        ret = RAPI_RESPONSE_INVALID_RESPONSE;
+      }
+      if (next) {
+        next(ret, reply);
+      }
+    });
+  }
+
+  // Stop the transaction, does nothing if it is not running
+  void abort();
+
+  // Also aborts the transaction if it has run for longer than its timeout
+  bool isRunning();
+
+  const char *getName() {
+    return _name;
+  }
+};
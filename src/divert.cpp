@@ -7,9 +7,11 @@
 #include "input.h"
 #include "config.h"
 #include "RapiSender.h"
+#include "RapiTransaction.h"
 #include "mqtt.h"
 #include "event.h"
 #include "openevse.h"
+#include "rapi_caps.h"
 
 // 1: Normal / Fast Charge (default):
 // Charging at maximum rate irrespective of solar PV / grid_ie output
@@ -23,9 +25,6 @@
 // If EVSE is sleeping charging will not start until solar PV / excess power > min chanrge rate
 // Once charging begins it will not pause even if solaer PV / excess power drops less then minimm charge rate. This avoids wear on the relay and the car
 
-#define SERVICE_LEVEL1_VOLTAGE  110
-#define SERVICE_LEVEL2_VOLTAGE  240
-
 #define DIVERT_MODE_NORMAL      1
 #define DIVERT_MODE_ECO         2
 
@@ -43,6 +42,12 @@ uint32_t lastUpdate = 0;
 
 extern RapiSender rapiSender;
 
+// Reading the charge rate when the mode changes
+static RapiTransaction divert_mode_change(rapiSender, "divertmode", RAPI_SOURCE_DIVERT);
+// Reading the EVSE, setting the charge rate and waking the EVSE for each
+// update of the solar / grid_ie
+static RapiTransaction divert_update(rapiSender, "divert", RAPI_SOURCE_DIVERT);
+
 // Update divert mode e.g. Normal / Eco
 // function called when divert mode is changed
 void divertmode_update(byte newmode)
@@ -52,22 +57,36 @@ void divertmode_update(byte newmode)
   {
     divertmode = newmode;
 
+    // Drop the reply to an earlier change still waiting for the EVSE, and
+    // any update that would set the charge rate for the old mode
+    divert_mode_change.abort();
+    divert_update.abort();
+
     // restore max charge current if normal mode or zero if eco mode
     switch(divertmode)
     {
       case DIVERT_MODE_NORMAL:
         // Restore the max charge current
-        rapiSender.sendCmd(String(F("$SC ")) + String(max_charge_current));
-        DBUGF("Restore max I: %d", max_charge_current);
+        divert_mode_change.begin([](int)
+        {
+          divert_mode_change.send(RAPI_CMD_SC, RapiArgs().add(max_charge_current), nullptr);
+          DBUGF("Restore max I: %d", max_charge_current);
+        });
         break;
 
       case DIVERT_MODE_ECO:
         charge_rate = 0;
         // Read the current charge current, assume this is the max set by the user
-        if(0 == rapiSender.sendCmd(F("$GE"))) {
-          max_charge_current = String(rapiSender.getToken(1)).toInt();
-          DBUGF("Read max I: %d", max_charge_current);
-        }
+        divert_mode_change.begin([](int)
+        {
+          divert_mode_change.send<RapiReplyGE>(RAPI_CMD_GE, [](int ret, const RapiReplyGE &ge)
+          {
+            if(RAPI_RESPONSE_OK == ret) {
+              max_charge_current = ge.pilot;
+              DBUGF("Read max I: %d", max_charge_current);
+            }
+          });
+        });
         break;
 
       default:
@@ -85,6 +104,7 @@ void divert_current_loop()
 {
   Profile_Start(divert_current_loop);
 
+  long state = evse_value(EVSE_STATE);
   if(last_state != state)
   {
     DBUGVAR(last_state);
@@ -101,142 +121,233 @@ void divert_current_loop()
   Profile_End(divert_current_loop, 5);
 } //end divert_current_loop
 
-// Set charge rate depending on divert mode and solar / grid_ie
-void divert_update_state()
+// Let the clients know the result of the last divert update
+static void divert_send_event()
 {
-  Profile_Start(divert_update_state);
+  DBUGVAR(charge_rate);
 
-  // If divert mode = Eco (2)
+  String event = mqtt_grid_ie != "" ? F("{\"grid_ie\":") : F("{\"solar\":");
+  event += mqtt_grid_ie != "" ? String(grid_ie) : String(solar);
   if (divertmode == DIVERT_MODE_ECO)
   {
-    int current_charge_rate;
+    event += F(",\"charge_rate\":");
+    event += String(charge_rate);
+  }
+  event += F(",\"divert_update\":0}");
+  DBUGVAR(event);
+  event_send(event);
 
-    // Read the current charge rate
-    if(0 == rapiSender.sendCmd(F("$GE"))) {
-      current_charge_rate = String(rapiSender.getToken(1)).toInt();
-      DBUGVAR(current_charge_rate);
-    }
+  lastUpdate = millis();
+}
 
-    // IMPROVE: Read from OpenEVSE or emonTX (MQTT)
-    int voltage = 1 == service ? SERVICE_LEVEL1_VOLTAGE : SERVICE_LEVEL2_VOLTAGE;
+// Start charging, if the EVSE is sleeping. A step of divert_update.
+static void divert_wake_evse()
+{
+  DBUGLN(F("Wake up EVSE"));
 
-    // Calculate current
-    if (mqtt_grid_ie != "")
-    {
-      // if grid feed is available and exporting increment the charge rate,
-      // if importing drop the charge rate.
-      // grid_ie is negative when exporting
-      // If grid feeds is available and exporting (negative)
-
-      double Igrid_ie = (double)grid_ie / (double)voltage;
-      DBUGVAR(Igrid_ie);
-
-      // Subtract the current charge the EV is using from the Grid IE
-      if(0 == rapiSender.sendCmd(F("$GG"))) {
-        int milliAmps = String(rapiSender.getToken(1)).toInt();
-        double amps = (double)milliAmps / 1000.0;
-        DBUGVAR(amps);
-        Igrid_ie -= amps;
-        DBUGVAR(Igrid_ie);
-      }
+  // Check if the timer is enabled, we need to do a bit of hackery if it is
+  if(RAPI_CAP_UNSUPPORTED == rapi_cap(RAPI_CAP_GD)) {
+    // No $GD, so no timer either
+    divert_update.send(RAPI_CMD_FE, nullptr);
+    return;
+  }
 
-      if (Igrid_ie < 0)
-      {
-        // If excess power
-        double reserve = GRID_IE_RESERVE_POWER / (double)voltage;
-        DBUGVAR(reserve);
-        charge_rate = (int)floor(-Igrid_ie - reserve);
-      }
-      else
+  divert_update.send<RapiReplyGD>(RAPI_CMD_GD, [](int ret, const RapiReplyGD &gd)
+  {
+    if(RAPI_RESPONSE_OK == ret || RAPI_RESPONSE_NK == ret) {
+      rapi_cap_set(RAPI_CAP_GD, RAPI_RESPONSE_OK == ret);
+    }
+
+    if(RAPI_RESPONSE_OK == ret && gd.enabled())
+    {
+      // Timer is enabled so we need to emulate a button press to work around
+      // an issue with $FE not working
+      divert_update.send(RAPI_CMD_F1, [](int ret)
       {
-        // no excess, so use the min charge
-        charge_rate = 0;
-      }
+        if(RAPI_RESPONSE_OK == ret) {
+          DBUGLN(F("Starting charge with button press"));
+        } else {
+          divert_update.send(RAPI_CMD_FE, nullptr);
+        }
+      });
     }
-    else if (mqtt_solar!="")
+    else
     {
-      // if grid feed is not available: charge rate = solar generation
-
-      double Isolar = (double)solar / (double)voltage;
-      DBUGVAR(Isolar);
-      charge_rate = (int)floor(Isolar);
+      divert_update.send(RAPI_CMD_FE, [](int ret)
+      {
+        if(RAPI_RESPONSE_OK == ret) {
+          DBUGLN(F("Starting charge"));
+        }
+      });
     }
+  });
+}
 
-    if(OPENEVSE_STATE_SLEEPING != state) {
-      // If we are not sleeping, make sure we are the minimum current
-      charge_rate = max(charge_rate, static_cast<int>(min_charge_current));
-    }
+// Set the charge current via RAPI, with the volatile flag so the rate is
+// not saved to EEPROM if the EVSE supports it, then wake the EVSE if asked.
+// A step of divert_update.
+static void divert_set_charge_rate(int rate, bool wake)
+{
+  bool volatileFlag = RAPI_CAP_UNSUPPORTED != rapi_cap(RAPI_CAP_SC_VOLATILE);
 
-    DBUGVAR(charge_rate);
+  RapiArgs args;
+  args.add(rate);
+  if(volatileFlag) {
+    args.add("V");
+  }
 
-    if(charge_rate >= min_charge_current)
+  divert_update.send(RAPI_CMD_SC, args, [rate, volatileFlag, wake](int ret)
+  {
+    if(RAPI_RESPONSE_OK == ret)
     {
-      // Cap the charge rate at the configured maximum
-      charge_rate = min(charge_rate, static_cast<int>(max_charge_current));
-
-      // Change the charge rate is needed
-      if(current_charge_rate != charge_rate)
+      DBUGF("Charge rate set to %d", rate);
+      evse_snapshot_update(EVSE_PILOT, rate);
+      if(volatileFlag) {
+        rapi_cap_set(RAPI_CAP_SC_VOLATILE, true);
+      }
+    }
+    else if(volatileFlag && RAPI_CAP_UNKNOWN == rapi_cap(RAPI_CAP_SC_VOLATILE))
+    {
+      // Fallback to old API
+      divert_update.send(RAPI_CMD_SC, RapiArgs().add(rate), [rate, ret, wake](int fallback)
       {
-        // Set charge rate via RAPI
-        bool chargeRateSet = false;
-        // Try and set current with new API with volatile flag (don't save the current rate to EEPROM)
-        if(0 == rapiSender.sendCmd(String(F("$SC ")) + String(charge_rate) + String(F(" V")))) {
-          chargeRateSet = true;
-        } else if(0 == rapiSender.sendCmd(String(F("$SC ")) + String(charge_rate))) {
-          // Fallback to old API
-          chargeRateSet = true;
+        if(RAPI_RESPONSE_OK == fallback) {
+          DBUGF("Charge rate set to %d", rate);
+          evse_snapshot_update(EVSE_PILOT, rate);
+          if(RAPI_RESPONSE_NK == ret) {
+            rapi_cap_set(RAPI_CAP_SC_VOLATILE, false);
+          }
         }
-        if(chargeRateSet = true) {
-          DBUGF("Charge rate set to %d", charge_rate);
-          pilot = charge_rate;
+        if(wake) {
+          divert_wake_evse();
         }
-      }
+      });
+      return;
+    }
 
-      // If charge rate > min current and EVSE is sleeping then start charging
-      if (state == OPENEVSE_STATE_SLEEPING)
-      {
-        DBUGLN(F("Wake up EVSE"));
-        bool chargeStarted = false;
+    if(wake) {
+      divert_wake_evse();
+    }
+  });
+}
 
-        // Check if the timer is enabled, we need to do a bit of hackery if it is
-        if(0 == rapiSender.sendCmd("$GD"))
-        {
-          if(rapiSender.getTokenCnt() >= 5 &&
-             (0 != String(rapiSender.getToken(1)).toInt() ||
-              0 != String(rapiSender.getToken(2)).toInt() ||
-              0 != String(rapiSender.getToken(3)).toInt() ||
-              0 != String(rapiSender.getToken(4)).toInt()))
-          {
-            // Timer is enabled so we need to emulate a button press to work around
-            // an issue with $FE not working
-            if(false == chargeStarted && 0 == rapiSender.sendCmd(F("$F1"))) {
-              DBUGLN(F("Starting charge with button press"));
-              chargeStarted = true;
-            }
-          }
-        }
+// Work out the new charge rate from the solar / grid_ie and the current
+// state of the EVSE, update the EVSE if needed
+static void divert_update_charge_rate(int current_charge_rate, double amps)
+{
+  // IMPROVE: Read from OpenEVSE or emonTX (MQTT)
+  int voltage = 1 == service ? SERVICE_LEVEL1_VOLTAGE : SERVICE_LEVEL2_VOLTAGE;
 
-        if(false == chargeStarted && 0 == rapiSender.sendCmd(F("$FE"))) {
-          DBUGLN(F("Starting charge"));
-        }
-      }
+  // Calculate current
+  if (mqtt_grid_ie != "")
+  {
+    // if grid feed is available and exporting increment the charge rate,
+    // if importing drop the charge rate.
+    // grid_ie is negative when exporting
+    // If grid feeds is available and exporting (negative)
+
+    double Igrid_ie = (double)grid_ie / (double)voltage;
+    DBUGVAR(Igrid_ie);
+
+    // Subtract the current charge the EV is using from the Grid IE
+    DBUGVAR(amps);
+    Igrid_ie -= amps;
+    DBUGVAR(Igrid_ie);
+
+    if (Igrid_ie < 0)
+    {
+      // If excess power
+      double reserve = GRID_IE_RESERVE_POWER / (double)voltage;
+      DBUGVAR(reserve);
+      charge_rate = (int)floor(-Igrid_ie - reserve);
+    }
+    else
+    {
+      // no excess, so use the min charge
+      charge_rate = 0;
     }
-  } // end ecomode
+  }
+  else if (mqtt_solar!="")
+  {
+    // if grid feed is not available: charge rate = solar generation
+
+    double Isolar = (double)solar / (double)voltage;
+    DBUGVAR(Isolar);
+    charge_rate = (int)floor(Isolar);
+  }
+
+  long state = evse_value(EVSE_STATE);
+  if(OPENEVSE_STATE_SLEEPING != state) {
+    // If we are not sleeping, make sure we are the minimum current
+    charge_rate = max(charge_rate, static_cast<int>(min_charge_current));
+  }
 
   DBUGVAR(charge_rate);
 
-  String event = mqtt_grid_ie != "" ? F("{\"grid_ie\":") : F("{\"solar\":");
-  event += mqtt_grid_ie != "" ? String(grid_ie) : String(solar);
-  if (divertmode == DIVERT_MODE_ECO)
+  if(charge_rate >= min_charge_current)
   {
-    event += F(",\"charge_rate\":");
-    event += String(charge_rate);
+    // Cap the charge rate at the configured maximum
+    charge_rate = min(charge_rate, static_cast<int>(max_charge_current));
+
+    // If charge rate > min current and EVSE is sleeping then start charging,
+    // once the charge rate has been set
+    bool wake = OPENEVSE_STATE_SLEEPING == state;
+
+    // Change the charge rate is needed
+    if(current_charge_rate != charge_rate) {
+      divert_set_charge_rate(charge_rate, wake);
+    } else if(wake) {
+      divert_wake_evse();
+    }
   }
-  event += F(",\"divert_update\":0}");
-  DBUGVAR(event);
-  event_send(event);
 
-  lastUpdate = millis();
+  divert_send_event();
+}
+
+// Set charge rate depending on divert mode and solar / grid_ie
+void divert_update_state()
+{
+  Profile_Start(divert_update_state);
+
+  // If divert mode = Eco (2)
+  if (divertmode == DIVERT_MODE_ECO)
+  {
+    // Read the current charge rate, the rest of the update is done once the
+    // response(s) arrive so we don't hold up the main loop. If the last
+    // update is still going this one is dropped, it will be based on
+    // nearly the same solar / grid_ie.
+    bool started = divert_update.begin([](int)
+    {
+      divert_update.send<RapiReplyGE>(RAPI_CMD_GE, [](int ret, const RapiReplyGE &ge)
+      {
+        int current_charge_rate = 0;
+        if(RAPI_RESPONSE_OK == ret) {
+          current_charge_rate = ge.pilot;
+          DBUGVAR(current_charge_rate);
+        }
+
+        if (mqtt_grid_ie != "")
+        {
+          // Need the current the EV is using to work out the excess power
+          divert_update.send<RapiReplyGG>(RAPI_CMD_GG, [current_charge_rate](int ret, const RapiReplyGG &gg)
+          {
+            double amps = 0;
+            if(RAPI_RESPONSE_OK == ret) {
+              amps = (double)gg.milliAmps / 1000.0;
+            }
+            divert_update_charge_rate(current_charge_rate, amps);
+          });
+        } else {
+          divert_update_charge_rate(current_charge_rate, 0);
+        }
+      });
+    });
+    if(!started) {
+      DBUGLN(F("Last divert update still running"));
+    }
+  } else {
+    divert_send_event();
+  }
 
   Profile_End(divert_update_state, 5);
 } //end divert_update_state
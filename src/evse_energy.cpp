@@ -0,0 +1,57 @@
+#include "emonesp.h"
+#include "evse_energy.h"
+#include "evse_snapshot.h"
+#include "input.h"
+#include "openevse.h"
+
+static bool sample_valid = false;
+static unsigned long sample_time = 0;   // millis() of the last $GG
+static int64_t sample_mw = 0;           // Power at the last $GG
+
+static bool anchor_valid = false;       // $GU has been read
+static long anchor_ws = 0;
+static long anchor_wh = 0;
+static int64_t integrated_mws = 0;      // Energy since the last $GU
+
+void
+evse_energy_sample(long milliAmps, long milliVolts) {
+  unsigned long now = millis();
+
+  if(milliVolts <= 0) {
+    milliVolts = 1000L * (1 == service ? SERVICE_LEVEL1_VOLTAGE : SERVICE_LEVEL2_VOLTAGE);
+  }
+  int64_t mw = (int64_t)milliAmps * milliVolts / 1000;
+
+  // Trapezoid between this reading and the last
+  if(sample_valid && now - sample_time <= EVSE_ENERGY_MAX_GAP_MS) {
+    integrated_mws += (sample_mw + mw) * (int64_t)(now - sample_time) / 2000;
+  }
+  sample_valid = true;
+  sample_time = now;
+  sample_mw = mw;
+
+  evse_snapshot_begin();
+  evse_snapshot_set(EVSE_POWER, (long)(mw / 1000));
+  if(anchor_valid)
+  {
+    evse_snapshot_set(EVSE_WATTSEC, anchor_ws + (long)(integrated_mws / 1000));
+    evse_snapshot_set(EVSE_WATTHOUR, anchor_wh + (long)(integrated_mws / 3600000));
+  }
+  evse_snapshot_commit();
+}
+
+void
+evse_energy_anchor(long wattSeconds, long wattHours) {
+  DBUGF("Energy estimate %ld Ws, EVSE %ld Ws",
+        anchor_ws + (long)(integrated_mws / 1000), wattSeconds);
+
+  anchor_valid = true;
+  anchor_ws = wattSeconds;
+  anchor_wh = wattHours;
+  integrated_mws = 0;
+
+  evse_snapshot_begin();
+  evse_snapshot_set(EVSE_WATTSEC, wattSeconds);
+  evse_snapshot_set(EVSE_WATTHOUR, wattHours);
+  evse_snapshot_commit();
+}
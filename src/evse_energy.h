@@ -0,0 +1,26 @@
+// EVSE power and energy
+// The EVSE only reports the energy with $GU, which is polled much less
+// often than the current. The power from each $GG reading is integrated
+// so the session and total energy keep moving between $GU replies, each
+// $GU reply replaces the local estimate.
+
+#ifndef _EMONESP_EVSE_ENERGY_H
+#define _EMONESP_EVSE_ENERGY_H
+
+#include <Arduino.h>
+
+// Readings further apart than this (ms) are not integrated across, eg
+// when the current is not being polled
+#ifndef EVSE_ENERGY_MAX_GAP_MS
+#define EVSE_ENERGY_MAX_GAP_MS 30000
+#endif
+
+// A $GG reading, sets EVSE_POWER and moves EVSE_WATTSEC and EVSE_WATTHOUR
+// on by the energy used since the last reading. milliVolts <= 0 if the EVSE
+// has no voltmeter, the nominal voltage for the service level is used.
+extern void evse_energy_sample(long milliAmps, long milliVolts);
+
+// A $GU reply, the EVSE's own count
+extern void evse_energy_anchor(long wattSeconds, long wattHours);
+
+#endif // _EMONESP_EVSE_ENERGY_H
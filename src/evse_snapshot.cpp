@@ -0,0 +1,97 @@
+#include "emonesp.h"
+#include "evse_snapshot.h"
+#include "openevse.h"
+
+// The live values, readers copy these with a seqlock. _seq is odd while
+// an update is in progress and readers retry if it changed while they
+// copied. The web server callbacks run between loop() iterations so
+// readers normally get a clean copy first time.
+static EvseSnapshot snapshot = {
+  0, 0, 0,
+  { 0, 0, 0, 0, 0, 0, OPENEVSE_STATE_STARTING }
+};
+static volatile uint32_t snapshot_seq = 0;
+
+static uint8_t snapshot_depth = 0;
+static uint32_t snapshot_pending = 0;   // Fields changed by the open update
+
+// Retries before a reader gives up waiting for a writer it has interrupted
+#define EVSE_SNAPSHOT_READ_RETRIES 4
+
+#define barrier() __asm__ __volatile__("" ::: "memory")
+
+void
+evse_snapshot_read(EvseSnapshot &copy) {
+  for(int retry = 0; retry < EVSE_SNAPSHOT_READ_RETRIES; retry++)
+  {
+    uint32_t seq = snapshot_seq;
+    barrier();
+    copy = snapshot;
+    barrier();
+    if(0 == (seq & 1) && seq == snapshot_seq) {
+      return;
+    }
+  }
+
+  DBUGLN("EVSE snapshot read during update");
+}
+
+long
+evse_value(EvseField field) {
+  // A single aligned word is read in one go
+  return snapshot.value[field];
+}
+
+uint32_t
+evse_generation() {
+  return snapshot.generation;
+}
+
+void
+evse_snapshot_begin() {
+  if(0 == snapshot_depth++)
+  {
+    snapshot_pending = 0;
+    snapshot_seq++;
+    barrier();
+  }
+}
+
+void
+evse_snapshot_set(EvseField field, long value) {
+  uint32_t bit = EVSE_FIELD_BIT(field);
+  if(value != snapshot.value[field] || 0 == (snapshot.valid & bit)) {
+    snapshot.value[field] = value;
+    snapshot_pending |= bit;
+  }
+  snapshot.valid |= bit;
+  snapshot.updated[field] = millis();
+}
+
+void
+evse_snapshot_commit() {
+  if(0 == snapshot_depth || 0 != --snapshot_depth) {
+    return;
+  }
+
+  if(snapshot_pending)
+  {
+    snapshot.generation++;
+    snapshot.dirty = snapshot_pending;
+    for(int i = 0; i < EVSE_FIELD_COUNT; i++) {
+      if(snapshot_pending & EVSE_FIELD_BIT(i)) {
+        snapshot.changed[i] = snapshot.generation;
+      }
+    }
+  }
+
+  barrier();
+  snapshot_seq++;
+}
+
+void
+evse_snapshot_update(EvseField field, long value) {
+  evse_snapshot_begin();
+  evse_snapshot_set(field, value);
+  evse_snapshot_commit();
+}
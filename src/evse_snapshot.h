@@ -0,0 +1,89 @@
+// EVSE telemetry
+// The values read from the EVSE, written from the main loop as RAPI
+// replies and events arrive and read by the web server, MQTT, EmonCMS and
+// divert code
+
+#ifndef _EMONESP_EVSE_SNAPSHOT_H
+#define _EMONESP_EVSE_SNAPSHOT_H
+
+#include <Arduino.h>
+
+enum EvseField
+{
+  EVSE_AMP,                   // mA
+  EVSE_VOLT,                  // mV, not supported by all EVSEs
+  EVSE_TEMP1,                 // Sensor DS3232 Ambient, 0.1 C
+  EVSE_TEMP2,                 // Sensor MCP9808 Ambient, 0.1 C
+  EVSE_TEMP3,                 // Sensor TMP007 Infared, 0.1 C
+  EVSE_PILOT,                 // A
+  EVSE_STATE,                 // OPENEVSE_STATE_*
+  EVSE_ELAPSED,               // s, only valid if charging
+  EVSE_WATTSEC,               // This session
+  EVSE_WATTHOUR,              // Total
+  EVSE_GFCI_COUNT,
+  EVSE_NOGND_COUNT,
+  EVSE_STUCK_COUNT,
+  EVSE_POWER,                 // W, worked out locally from each $GG
+  EVSE_FIELD_COUNT
+};
+
+#define EVSE_FIELD_BIT(field)   (1UL << (field))
+#define EVSE_FIELDS_ALL         (EVSE_FIELD_BIT(EVSE_FIELD_COUNT) - 1)
+
+// -------------------------------------------------------------------
+// A copy of all the values at one generation. The generation goes up by
+// one for each update that changes any value, each value records the
+// generation it last changed in so readers that keep the generation they
+// last saw can tell what has changed since.
+// -------------------------------------------------------------------
+struct EvseSnapshot
+{
+  uint32_t generation;
+  uint32_t dirty;             // EVSE_FIELD_BIT()s changed in this generation
+  uint32_t valid;             // EVSE_FIELD_BIT()s read from the EVSE at least once
+  long value[EVSE_FIELD_COUNT];
+  unsigned long updated[EVSE_FIELD_COUNT];  // millis() of the last update
+  uint32_t changed[EVSE_FIELD_COUNT];       // Generation of the last change
+
+  long get(EvseField field) const {
+    return value[field];
+  }
+
+  // EVSE_FIELD_BIT()s of the values changed after generation
+  uint32_t changedSince(uint32_t since) const {
+    uint32_t fields = 0;
+    for(int i = 0; i < EVSE_FIELD_COUNT; i++) {
+      if(changed[i] > since) {
+        fields |= EVSE_FIELD_BIT(i);
+      }
+    }
+    return fields;
+  }
+};
+
+// -------------------------------------------------------------------
+// Readers
+// -------------------------------------------------------------------
+
+// Take a consistent copy of all the values
+extern void evse_snapshot_read(EvseSnapshot &snapshot);
+
+// A single value, no copy needed
+extern long evse_value(EvseField field);
+
+extern uint32_t evse_generation();
+
+// -------------------------------------------------------------------
+// Writer, main loop only
+//
+// Values set between begin and commit are seen by readers as one
+// generation, begin/commit pairs can be nested
+// -------------------------------------------------------------------
+extern void evse_snapshot_begin();
+extern void evse_snapshot_set(EvseField field, long value);
+extern void evse_snapshot_commit();
+
+// begin, set and commit for a single value
+extern void evse_snapshot_update(EvseField field, long value);
+
+#endif // _EMONESP_EVSE_SNAPSHOT_H
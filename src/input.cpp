@@ -10,6 +10,11 @@
 #include "web_server.h"
 #include "wifi.h"
 #include "openevse.h"
+#include "rapi_caps.h"
+#include "evse_energy.h"
+#ifdef ENABLE_RAPI_CAPTURE
+#include "rapi_capture.h"
+#endif
 
 #include "RapiSender.h"
 
@@ -25,16 +30,6 @@ String data = "";
 int espflash = 0;
 int espfree = 0;
 
-int rapi_command = 1;
-
-long amp = 0;                         // OpenEVSE Current Sensor
-long volt = 0;                        // Not currently in used
-long temp1 = 0;                       // Sensor DS3232 Ambient
-long temp2 = 0;                       // Sensor MCP9808 Ambient
-long temp3 = 0;                       // Sensor TMP007 Infared
-long pilot = 0;                       // OpenEVSE Pilot Setting
-long state = OPENEVSE_STATE_STARTING; // OpenEVSE State
-long elapsed = 0;                     // Elapsed time (only valid if charging)
 #ifdef ENABLE_LEGACY_API
 String estate = "Unknown"; // Common name for State
 #endif
@@ -66,39 +61,44 @@ byte auto_start = 1;
 String firmware = "-";
 String protocol = "-";
 
-// Default OpenEVSE Fault Counters
-long gfci_count = 0;
-long nognd_count = 0;
-long stuck_count = 0;
-
 // OpenEVSE Session options
 #ifdef ENABLE_LEGACY_API
 long kwh_limit = 0;
 long time_limit = 0;
 #endif
 
-// OpenEVSE Usage Statistics
-long wattsec = 0;
-long watthour_total = 0;
-
 unsigned long comm_sent = 0;
 unsigned long comm_success = 0;
 
+// Values not read from the EVSE yet are left out rather than sent as 0
+static void
+rapi_json_value(const EvseSnapshot &evse, EvseField field, const char *name) {
+  if (evse.valid & EVSE_FIELD_BIT(field)) {
+    data += "\"";
+    data += name;
+    data += "\":" + String(evse.get(field)) + ",";
+  }
+}
+
 void
 create_rapi_json() {
+  EvseSnapshot evse;
+  evse_snapshot_read(evse);
+
   url = e_url;
   data = "";
   url += String(emoncms_node) + "&json={";
-  data += "\"amp\":" + String(amp) + ",";
-  if (volt > 0) {
-    data += "volt:" + String(volt) + ",";
-  }
-  data += "\"wh\":" + String(watthour_total) + ",";
-  data += "\"temp1\":" + String(temp1) + ",";
-  data += "\"temp2\":" + String(temp2) + ",";
-  data += "\"temp3\":" + String(temp3) + ",";
-  data += "\"pilot\":" + String(pilot) + ",";
-  data += "\"state\":" + String(state) + ",";
+  rapi_json_value(evse, EVSE_AMP, "amp");
+  if (evse.get(EVSE_VOLT) > 0) {
+    data += "volt:" + String(evse.get(EVSE_VOLT)) + ",";
+  }
+  rapi_json_value(evse, EVSE_POWER, "power");
+  rapi_json_value(evse, EVSE_WATTHOUR, "wh");
+  rapi_json_value(evse, EVSE_TEMP1, "temp1");
+  rapi_json_value(evse, EVSE_TEMP2, "temp2");
+  rapi_json_value(evse, EVSE_TEMP3, "temp3");
+  rapi_json_value(evse, EVSE_PILOT, "pilot");
+  rapi_json_value(evse, EVSE_STATE, "state");
   data += "\"freeram\":" + String(ESP.getFreeHeap()) + ",";
   data += "\"divertmode\":" + String(divertmode);
   url += data;
@@ -113,271 +113,547 @@ create_rapi_json() {
   //DEBUG.print(emoncms_server.c_str() + String(url));
 }
 
-// -------------------------------------------------------------------
-// OpenEVSE Request
-//
-// Get RAPI Values
-// Runs from arduino main loop, runs a new command in the loop
-// on each call.  Used for values that change at runtime.
-// -------------------------------------------------------------------
-
-void
-update_rapi_values() {
-  Profile_Start(update_rapi_values);
-
-  comm_sent++;
-  switch(rapi_command)
-  {
+#ifdef ENABLE_LEGACY_API
+static void
+update_estate() {
+  switch (evse_value(EVSE_STATE)) {
     case 1:
-      if (0 == rapiSender.sendCmd("$GE"))
-      {
-        if(rapiSender.getTokenCnt() >= 3)
-        {
-          const char *val = rapiSender.getToken(1);
-          pilot = strtol(val, NULL, 10);
-          comm_success++;
-        }
-      }
+      estate = "Not Connected";
       break;
     case 2:
-      if (0 == rapiSender.sendCmd("$GS"))
-      {
-        if(rapiSender.getTokenCnt() >= 3)
-        {
-          const char *val = rapiSender.getToken(1);
-          DBUGVAR(val);
-          state = strtol(val, NULL, 10);
-          DBUGVAR(state);
-          val = rapiSender.getToken(2);
-          DBUGVAR(val);
-          elapsed = strtol(val, NULL, 10);
-          DBUGVAR(elapsed);
-          comm_success++;
-
-#ifdef ENABLE_LEGACY_API
-          switch (state) {
-            case 1:
-              estate = "Not Connected";
-              break;
-            case 2:
-              estate = "EV Connected";
-              break;
-            case 3:
-              estate = "Charging";
-              break;
-            case 4:
-              estate = "Vent Required";
-              break;
-            case 5:
-              estate = "Diode Check Failed";
-              break;
-            case 6:
-              estate = "GFCI Fault";
-              break;
-            case 7:
-              estate = "No Earth Ground";
-              break;
-            case 8:
-              estate = "Stuck Relay";
-              break;
-            case 9:
-              estate = "GFCI Self Test Failed";
-              break;
-            case 10:
-              estate = "Over Temperature";
-              break;
-            case 254:
-              estate = "Sleeping";
-              break;
-            case 255:
-              estate = "Disabled";
-              break;
-            default:
-              estate = "Invalid";
-              break;
-          }
-#endif
-        }
-      }
+      estate = "EV Connected";
       break;
     case 3:
-      if (0 == rapiSender.sendCmd("$GG"))
-      {
-        if(rapiSender.getTokenCnt() >= 3)
-        {
-          const char *val;
-          val = rapiSender.getToken(1);
-          amp = strtol(val, NULL, 10);
-          val = rapiSender.getToken(2);
-          volt = strtol(val, NULL, 10);
-          comm_success++;
-        }
-      }
+      estate = "Charging";
       break;
     case 4:
-      if (0 == rapiSender.sendCmd("$GP"))
-      {
-        if(rapiSender.getTokenCnt() >= 4)
-        {
-          const char *val;
-          val = rapiSender.getToken(1);
-          temp1 = strtol(val, NULL, 10);
-          val = rapiSender.getToken(2);
-          temp2 = strtol(val, NULL, 10);
-          val = rapiSender.getToken(3);
-          temp3 = strtol(val, NULL, 10);
-          comm_success++;
-        }
-      }
+      estate = "Vent Required";
       break;
     case 5:
-      if (0 == rapiSender.sendCmd("$GU"))
-      {
-        if(rapiSender.getTokenCnt() >= 3)
-        {
-          const char *val;
-          val = rapiSender.getToken(1);
-          wattsec = strtol(val, NULL, 10);
-          val = rapiSender.getToken(2);
-          watthour_total = strtol(val, NULL, 10);
-          comm_success++;
-        }
-      }
+      estate = "Diode Check Failed";
       break;
     case 6:
-      if (0 == rapiSender.sendCmd("$GF")) {
-        if(rapiSender.getTokenCnt() >= 4)
-        {
-          const char *val;
-          val = rapiSender.getToken(1);
-          gfci_count = strtol(val, NULL, 16);
-          val = rapiSender.getToken(2);
-          nognd_count = strtol(val, NULL, 16);
-          val = rapiSender.getToken(3);
-          stuck_count = strtol(val, NULL, 16);
-          comm_success++;
-        }
-      }
-      rapi_command = 0;         //Last RAPI command
+      estate = "GFCI Fault";
+      break;
+    case 7:
+      estate = "No Earth Ground";
+      break;
+    case 8:
+      estate = "Stuck Relay";
+      break;
+    case 9:
+      estate = "GFCI Self Test Failed";
+      break;
+    case 10:
+      estate = "Over Temperature";
+      break;
+    case 254:
+      estate = "Sleeping";
+      break;
+    case 255:
+      estate = "Disabled";
+      break;
+    default:
+      estate = "Invalid";
       break;
   }
-  rapi_command++;
+}
+#endif
 
-  Profile_End(update_rapi_values, 5);
+static bool
+rapi_update_ge() {
+  RapiReplyGE ge;
+  if(!rapiSender.getReply(ge)) {
+    return false;
+  }
+  evse_snapshot_update(EVSE_PILOT, ge.pilot);
+  return true;
 }
 
-void
-handleRapiRead() {
-  Profile_Start(handleRapiRead);
+// -------------------------------------------------------------------
+// EVSE state tracking
+//
+// The EVSE reports state changes with $ST so $GS is only needed as a
+// watchdog, and the charge time is counted locally from the start of
+// charging.
+// -------------------------------------------------------------------
+static unsigned long state_confirmed = 0; // Last time the state came from $ST or $GS
+static unsigned long charge_start = 0;    // millis() at the start of charging
+static bool state_events = false;         // Has the EVSE sent any $ST events
+static uint8_t state_poll_attempts = 0;   // $GS sent before first contact
+
+static void
+evse_state_update(long newState) {
+  unsigned long now = millis();
+
+  evse_snapshot_begin();
+  if(OPENEVSE_STATE_CHARGING == newState &&
+     OPENEVSE_STATE_CHARGING != evse_value(EVSE_STATE))
+  {
+    charge_start = now;
+    evse_snapshot_set(EVSE_ELAPSED, 0);
+  }
+  evse_snapshot_set(EVSE_STATE, newState);
+  evse_snapshot_commit();
 
-  comm_sent++;
-  if (0 == rapiSender.sendCmd("$GV"))
+  state_confirmed = now;
+  DBUGVAR(newState);
+
+#ifdef ENABLE_LEGACY_API
+  update_estate();
+#endif
+}
+
+static bool
+rapi_update_gs() {
+  RapiReplyGS gs;
+  if(!rapiSender.getReply(gs)) {
+    return false;
+  }
+  evse_snapshot_begin();
+  evse_state_update(gs.state);
+
+  // Re-anchor the local charge timer on the EVSE's own count
+  evse_snapshot_set(EVSE_ELAPSED, gs.elapsed);
+  evse_snapshot_commit();
+  charge_start = millis() - (unsigned long)gs.elapsed * 1000;
+  DBUGVAR(gs.elapsed);
+  return true;
+}
+
+static bool
+rapi_update_gg() {
+  RapiReplyGG gg;
+  if(!rapiSender.getReply(gg)) {
+    return false;
+  }
+  evse_snapshot_begin();
+  evse_snapshot_set(EVSE_AMP, gg.milliAmps);
+  evse_snapshot_set(EVSE_VOLT, gg.milliVolts);
+  evse_energy_sample(gg.milliAmps, gg.milliVolts);
+  evse_snapshot_commit();
+  return true;
+}
+
+static bool
+rapi_update_gp() {
+  RapiReplyGP gp;
+  if(!rapiSender.getReply(gp)) {
+    return false;
+  }
+  evse_snapshot_begin();
+  evse_snapshot_set(EVSE_TEMP1, gp.temp1);
+  evse_snapshot_set(EVSE_TEMP2, gp.temp2);
+  evse_snapshot_set(EVSE_TEMP3, gp.temp3);
+  evse_snapshot_commit();
+  return true;
+}
+
+static bool
+rapi_update_gu() {
+  RapiReplyGU gu;
+  if(!rapiSender.getReply(gu)) {
+    return false;
+  }
+  evse_energy_anchor(gu.wattSeconds, gu.wattHours);
+  return true;
+}
+
+static bool
+rapi_update_gf() {
+  RapiReplyGF gf;
+  if(!rapiSender.getReply(gf)) {
+    return false;
+  }
+  evse_snapshot_begin();
+  evse_snapshot_set(EVSE_GFCI_COUNT, gf.gfciCount);
+  evse_snapshot_set(EVSE_NOGND_COUNT, gf.noGroundCount);
+  evse_snapshot_set(EVSE_STUCK_COUNT, gf.stuckRelayCount);
+  evse_snapshot_commit();
+  return true;
+}
+
+static RapiPollMetric rapi_poll[] = {
+  { &RAPI_CMD_GE, rapi_update_ge, RAPI_POLL_GE },
+  { &RAPI_CMD_GG, rapi_update_gg, RAPI_POLL_GG },
+  { &RAPI_CMD_GP, rapi_update_gp, RAPI_POLL_GP },
+  { &RAPI_CMD_GU, rapi_update_gu, RAPI_POLL_GU },
+  { &RAPI_CMD_GF, rapi_update_gf, RAPI_POLL_GF },
+};
+
+#define RAPI_POLL_COUNT (sizeof(rapi_poll) / sizeof(rapi_poll[0]))
+
+static RapiPollMetric rapi_state_poll = { &RAPI_CMD_GS, rapi_update_gs };
+
+static int
+rapi_poll_state() {
+  switch(evse_value(EVSE_STATE))
   {
-    if(rapiSender.getTokenCnt() >= 3)
-    {
-      firmware = rapiSender.getToken(1);
-      protocol = rapiSender.getToken(2);
-      comm_success++;
-    }
+    case OPENEVSE_STATE_CHARGING:
+      return RAPI_POLL_STATE_CHARGING;
+    case OPENEVSE_STATE_CONNECTED:
+      return RAPI_POLL_STATE_CONNECTED;
+    case OPENEVSE_STATE_SLEEPING:
+    case OPENEVSE_STATE_DISABLED:
+      return RAPI_POLL_STATE_SLEEPING;
+    default:
+      return RAPI_POLL_STATE_IDLE;
   }
+}
+
+static void
+rapi_poll_send(RapiPollMetric *metric, unsigned long now)
+{
   comm_sent++;
-  if (0 == rapiSender.sendCmd("$GA"))
-  {
-    if(rapiSender.getTokenCnt() >= 3)
+  if(RAPI_RESPONSE_QUEUED == rapiSender.sendCmd(*metric->cmd, [metric](int ret)
     {
-      const char *val;
-      val = rapiSender.getToken(1);
-      current_scale = strtol(val, NULL, 10);
-      val = rapiSender.getToken(2);
-      current_offset = strtol(val, NULL, 10);
-      comm_success++;
-    }
+      metric->pending = false;
+      if(RAPI_RESPONSE_OK == ret && metric->update())
+      {
+        comm_success++;
+
+        unsigned long now = millis();
+        if(metric->lastUpdate > 0)
+        {
+          // Smooth the time between updates so it is a useful indication
+          // of the refresh rate actually achieved
+          unsigned long interval = now - metric->lastUpdate;
+          metric->interval = metric->interval > 0 ?
+            (metric->interval * 3 + interval) / 4 :
+            interval;
+        }
+        metric->lastUpdate = now;
+      }
+    }))
+  {
+    metric->pending = true;
+    metric->lastSent = now;
   }
-#ifdef ENABLE_LEGACY_API
-  comm_sent++;
-  if (0 == rapiSender.sendCmd("$GH"))
+}
+
+// -------------------------------------------------------------------
+// OpenEVSE Request
+//
+// Get RAPI Values
+// Runs from arduino main loop, queues a command for each value that is
+// due a refresh. How often each value is read depends on the EVSE state.
+// -------------------------------------------------------------------
+
+void
+update_rapi_values() {
+#ifdef ENABLE_RAPI_CAPTURE
+  // Leave the link to the capture
+  if(rapi_capture_running()) {
+    return;
+  }
+#endif
+
+  Profile_Start(update_rapi_values);
+  RapiSourceScope source(rapiSender, RAPI_SOURCE_POLL);
+
+  unsigned long now = millis();
+  int pollState = rapi_poll_state();
+
+  for(int i = 0; i < RAPI_POLL_COUNT; i++)
   {
-    if(rapiSender.getTokenCnt() >= 2)
-    {
-      const char *val;
-      val = rapiSender.getToken(1);
-      kwh_limit = strtol(val, NULL, 10);
-      comm_success++;
+    RapiPollMetric *metric = &rapi_poll[i];
+    uint32_t period = metric->period[pollState];
+    if(metric->pending || 0 == period ||
+       (metric->lastSent > 0 && (now - metric->lastSent) < period)) {
+      continue;
     }
+
+    rapi_poll_send(metric, now);
   }
-  comm_sent++;
-  if (0 == rapiSender.sendCmd("$G3"))
+
+  Profile_End(update_rapi_values, 5);
+}
+
+// -------------------------------------------------------------------
+// How long the state can go unconfirmed before $GS is polled
+// -------------------------------------------------------------------
+static unsigned long
+rapi_state_window() {
+  if(0 == state_confirmed)
   {
-    if(rapiSender.getTokenCnt() >= 2)
-    {
-      const char *val;
-      val = rapiSender.getToken(1);
-      time_limit = strtol(val, NULL, 10);
-      comm_success++;
-    }
+    // Not heard from the EVSE yet, back off while it is not responding
+    unsigned long window = (unsigned long)RAPI_STATE_START_MS <<
+      (state_poll_attempts < 5 ? state_poll_attempts : 5);
+    return window < RAPI_STATE_WATCHDOG_MS ? window : RAPI_STATE_WATCHDOG_MS;
+  }
+
+  // Firmware that does not send $ST has to be polled
+  return state_events ? RAPI_STATE_WATCHDOG_MS : RAPI_STATE_POLL_MS;
+}
+
+// -------------------------------------------------------------------
+// Track the EVSE state
+//
+// Runs from arduino main loop, also before the EVSE has been found
+// -------------------------------------------------------------------
+void
+update_rapi_state() {
+  RapiSourceScope source(rapiSender, RAPI_SOURCE_POLL);
+  unsigned long now = millis();
+
+  if(OPENEVSE_STATE_CHARGING == evse_value(EVSE_STATE)) {
+    evse_snapshot_update(EVSE_ELAPSED, (now - charge_start) / 1000);
+  }
+
+#ifdef ENABLE_RAPI_CAPTURE
+  // Leave the link to the capture, the state is polled once it is done
+  if(rapi_capture_running()) {
+    return;
   }
 #endif
-  comm_sent++;
-  if (0 == rapiSender.sendCmd("$GE"))
+
+  unsigned long window = rapi_state_window();
+  if(rapi_state_poll.pending ||
+     (state_confirmed > 0 && (now - state_confirmed) < window) ||
+     (rapi_state_poll.lastSent > 0 && (now - rapi_state_poll.lastSent) < window)) {
+    return;
+  }
+
+  if(0 == state_confirmed) {
+    if(state_poll_attempts > 0) {
+      DBUGLN("OpenEVSE not responding or not connected");
+    }
+    state_poll_attempts++;
+  }
+  rapi_poll_send(&rapi_state_poll, now);
+}
+
+// -------------------------------------------------------------------
+// The configured and achieved refresh periods (ms) for each polled value
+// -------------------------------------------------------------------
+static void
+rapi_poll_metric_status(JsonWriter &json, RapiPollMetric *metric, unsigned long period) {
+  json.key(metric->cmd->name + 1);
+  json.beginObject();
+  json.add(F("period"), period);
+  json.add(F("interval"), metric->interval);
+  json.add(F("age"), metric->lastUpdate > 0 ? millis() - metric->lastUpdate : 0);
+  json.endObject();
+}
+
+void
+rapi_poll_status(JsonWriter &json) {
+  int pollState = rapi_poll_state();
+
+  json.beginObject();
+  for(int i = 0; i < RAPI_POLL_COUNT; i++)
   {
-    comm_success++;
-    const char *val;
-    val = rapiSender.getToken(1);
-    DBUGVAR(val);
-    pilot = strtol(val, NULL, 10);
-
-    val = rapiSender.getToken(2);
-    DBUGVAR(val);
-    long flags = strtol(val, NULL, 16);
-    service = bitRead(flags, 0) + 1;
-    diode_ck = bitRead(flags, 1);
-    vent_ck = bitRead(flags, 2);
-    ground_ck = bitRead(flags, 3);
-    stuck_relay = bitRead(flags, 4);
-    auto_service = bitRead(flags, 5);
-    auto_start = bitRead(flags, 6);
-    serial_dbg = bitRead(flags, 7);
-    rgb_lcd = bitRead(flags, 8);
-    gfci_test = bitRead(flags, 9);
-    temp_ck = bitRead(flags, 10);
+    RapiPollMetric *metric = &rapi_poll[i];
+    rapi_poll_metric_status(json, metric, metric->period[pollState]);
   }
-  comm_sent++;
+  rapi_poll_metric_status(json, &rapi_state_poll, rapi_state_window());
+  json.add(F("state_events"), state_events);
+  json.endObject();
+}
+
+// -------------------------------------------------------------------
+// Read the OpenEVSE settings
+//
+// The settings are read in the background once the EVSE has been found,
+// a few commands at a time so the polling, HTTP and MQTT RAPI traffic is
+// not held up behind them. Until a setting has been read it is reported as
+// pending.
+// -------------------------------------------------------------------
+static bool
+rapi_setting_gv() {
+  RapiReplyGV gv;
+  if(!rapiSender.getReply(gv)) {
+    return false;
+  }
+  firmware = gv.firmware;
+  protocol = gv.protocol;
+  rapi_caps_version(firmware, protocol);
+  return true;
+}
+
+static bool
+rapi_setting_ga() {
+  RapiReplyGA ga;
+  if(!rapiSender.getReply(ga)) {
+    return false;
+  }
+  current_scale = ga.scale;
+  current_offset = ga.offset;
+  return true;
+}
+
+static bool
+rapi_setting_ge() {
+  RapiReplyGE ge;
+  if(!rapiSender.getReply(ge)) {
+    return false;
+  }
+  evse_snapshot_update(EVSE_PILOT, ge.pilot);
+
+  long flags = ge.flags;
+  DBUGVAR(flags);
+  service = bitRead(flags, 0) + 1;
+  diode_ck = bitRead(flags, 1);
+  vent_ck = bitRead(flags, 2);
+  ground_ck = bitRead(flags, 3);
+  stuck_relay = bitRead(flags, 4);
+  auto_service = bitRead(flags, 5);
+  auto_start = bitRead(flags, 6);
+  serial_dbg = bitRead(flags, 7);
+  rgb_lcd = bitRead(flags, 8);
+  gfci_test = bitRead(flags, 9);
+  temp_ck = bitRead(flags, 10);
+  return true;
+}
+
 #ifdef ENABLE_LEGACY_API
-  if (0 == rapiSender.sendCmd("$GC"))
-  {
-    if(rapiSender.getTokenCnt() >= 3)
+static bool
+rapi_setting_gh() {
+  RapiReplyGH gh;
+  if(!rapiSender.getReply(gh)) {
+    return false;
+  }
+  kwh_limit = gh.kwhLimit;
+  return true;
+}
+
+static bool
+rapi_setting_g3() {
+  RapiReplyG3 g3;
+  if(!rapiSender.getReply(g3)) {
+    return false;
+  }
+  time_limit = g3.timeLimit;
+  return true;
+}
+
+static bool
+rapi_setting_gc() {
+  RapiReplyGC gc;
+  if(!rapiSender.getReply(gc)) {
+    return false;
+  }
+  if (service == 1) {
+    current_l1min = gc.minAmps;
+    current_l1max = gc.maxAmps;
+  } else {
+    current_l2min = gc.minAmps;
+    current_l2max = gc.maxAmps;
+  }
+  return true;
+}
+#endif
+
+struct RapiSettingRead
+{
+  const RapiCmd *cmd;
+  bool (*update)();           // Parse the reply, false if invalid
+  RapiSettingRead *after;     // Needs this setting first, or nullptr
+
+  bool valid;
+  bool pending;
+  unsigned long lastSent;
+};
+
+static RapiSettingRead rapi_settings[RAPI_SETTING_COUNT] = {
+  { &RAPI_CMD_GV, rapi_setting_gv },
+  { &RAPI_CMD_GA, rapi_setting_ga },
+  { &RAPI_CMD_GE, rapi_setting_ge },
+#ifdef ENABLE_LEGACY_API
+  { &RAPI_CMD_GH, rapi_setting_gh },
+  { &RAPI_CMD_G3, rapi_setting_g3 },
+  // The limits read depend on the service level from $GE
+  { &RAPI_CMD_GC, rapi_setting_gc, &rapi_settings[RAPI_SETTING_FLAGS] },
+#endif
+};
+
+static bool rapi_settings_wanted = false;   // A consumer is waiting for them
+
+static void
+rapi_setting_send(RapiSettingRead *setting, unsigned long now)
+{
+  comm_sent++;
+  if(RAPI_RESPONSE_QUEUED == rapiSender.sendCmd(*setting->cmd, [setting](int ret)
     {
-      const char *val;
-      if (service == 1) {
-        val = rapiSender.getToken(1);
-        current_l1min = strtol(val, NULL, 10);
-        val = rapiSender.getToken(2);
-        current_l1max = strtol(val, NULL, 10);
-      } else {
-        val = rapiSender.getToken(1);
-        current_l2min = strtol(val, NULL, 10);
-        val = rapiSender.getToken(2);
-        current_l2max = strtol(val, NULL, 10);
+      setting->pending = false;
+      if(RAPI_RESPONSE_OK == ret && setting->update()) {
+        setting->valid = true;
+        comm_success++;
       }
-      comm_success++;
-    }
+    }))
+  {
+    setting->pending = true;
+    setting->lastSent = now;
+  }
+}
+
+// -------------------------------------------------------------------
+// Runs from arduino main loop once the EVSE has been found, starts the
+// reads of any settings not known yet
+// -------------------------------------------------------------------
+void
+update_rapi_settings() {
+#ifdef ENABLE_RAPI_CAPTURE
+  if(rapi_capture_running()) {
+    return;
   }
 #endif
 
-  Profile_End(handleRapiRead, 10);
+  RapiSourceScope source(rapiSender, RAPI_SOURCE_POLL);
+  unsigned long now = millis();
+  uint8_t inFlight = 0;
+  for(int i = 0; i < RAPI_SETTING_COUNT; i++) {
+    if(rapi_settings[i].pending) {
+      inFlight++;
+    }
+  }
+
+  // Until asked for, only a few at a time
+  uint8_t budget = rapi_settings_wanted ? RAPI_SETTING_COUNT : RAPI_SETTINGS_IN_FLIGHT;
+  rapi_settings_wanted = false;
+
+  for(int i = 0; i < RAPI_SETTING_COUNT && inFlight < budget; i++)
+  {
+    RapiSettingRead *setting = &rapi_settings[i];
+    if(setting->valid || setting->pending ||
+       (setting->lastSent > 0 && (now - setting->lastSent) < RAPI_SETTINGS_RETRY_MS) ||
+       (setting->after && !setting->after->valid)) {
+      continue;
+    }
+
+    rapi_setting_send(setting, now);
+    if(setting->pending) {
+      inFlight++;
+    }
+  }
+}
+
+bool
+rapi_setting_valid(RapiSetting setting) {
+  if(!rapi_settings[setting].valid)
+  {
+    // Read whatever is missing straight away
+    rapi_settings_wanted = true;
+    return false;
+  }
+  return true;
 }
 
 void on_rapi_event()
 {
-  if(!strcmp(rapiSender.getToken(0), "$ST")) {
-    const char *val = rapiSender.getToken(1);
-    DBUGVAR(val);
+  if(rapiSender.tokenEquals(0, "$ST")) {
+    long newState = rapi_parse_state(rapiSender, 1);
+    if(newState < 0) {
+      DBUGF("Unknown state %s", rapiSender.getResponse());
+      return;
+    }
 
     // Update our local state
-    state = strtol(val, NULL, 16);
-    DBUGVAR(state);
+    evse_state_update(newState);
+    state_events = true;
 
     // Send to all clients
+    long state = evse_value(EVSE_STATE);
     String event = F("{\"state\":");
     event += state;
     event += F("}");
@@ -388,11 +664,8 @@ void on_rapi_event()
       event += String(state);
       mqtt_publish(event);
     }
-  } else if(!strcmp(rapiSender.getToken(0), "$WF")) {
-    const char *val = rapiSender.getToken(1);
-    DBUGVAR(val);
-
-    long wifiMode = strtol(val, NULL, 10);
+  } else if(rapiSender.tokenEquals(0, "$WF")) {
+    long wifiMode = rapiSender.getTokenInt(1);
     DBUGVAR(wifiMode);
     switch(wifiMode)
     {
@@ -3,20 +3,97 @@
 
 #include <Arduino.h>
 #include "RapiSender.h"
+#include "evse_snapshot.h"
+#include "JsonWriter.h"
 
 extern RapiSender rapiSender;
 
+// -------------------------------------------------------------------
+// Polling of the values that change at runtime
+//
+// Each value has a refresh period (ms) for each group of EVSE states,
+// 0 disables polling in that state. The defaults can be overridden with
+// build flags, eg -DRAPI_POLL_GG="{ 500, 5000, 30000, 0 }"
+// -------------------------------------------------------------------
+#define RAPI_POLL_STATE_CHARGING    0
+#define RAPI_POLL_STATE_CONNECTED   1
+#define RAPI_POLL_STATE_IDLE        2   // Not connected or fault
+#define RAPI_POLL_STATE_SLEEPING    3   // Sleeping or disabled
+#define RAPI_POLL_STATE_COUNT       4
+
+//                      Charging Connected  Idle    Sleeping
+#ifndef RAPI_POLL_GE
+#define RAPI_POLL_GE  {   10000,    10000,  30000,   60000 }  // Pilot
+#endif
+#ifndef RAPI_POLL_GG
+#define RAPI_POLL_GG  {    1000,    10000,  30000,       0 }  // Current, voltage
+#endif
+#ifndef RAPI_POLL_GP
+#define RAPI_POLL_GP  {   30000,    30000,  60000,  300000 }  // Temperatures
+#endif
+#ifndef RAPI_POLL_GU
+#define RAPI_POLL_GU  {    5000,    30000,  60000,  300000 }  // Energy
+#endif
+#ifndef RAPI_POLL_GF
+#define RAPI_POLL_GF  {  300000,   300000, 300000,  300000 }  // Fault counters
+#endif
+
+// The state is tracked from the $ST events, $GS is only polled when the
+// state has not been confirmed for a while (ms)
+#ifndef RAPI_STATE_WATCHDOG_MS
+#define RAPI_STATE_WATCHDOG_MS  30000
+#endif
+// Polling period used with firmware that does not send $ST events (ms)
+#ifndef RAPI_STATE_POLL_MS
+#define RAPI_STATE_POLL_MS      2000
+#endif
+// Initial polling period while looking for the EVSE, doubles on each
+// attempt up to RAPI_STATE_WATCHDOG_MS (ms)
+#ifndef RAPI_STATE_START_MS
+#define RAPI_STATE_START_MS     1000
+#endif
+
+// -------------------------------------------------------------------
+// EVSE settings, read once the EVSE has been found
+// -------------------------------------------------------------------
+enum RapiSetting
+{
+  RAPI_SETTING_VERSION,       // $GV firmware, protocol
+  RAPI_SETTING_AMMETER,       // $GA current_scale, current_offset
+  RAPI_SETTING_FLAGS,         // $GE service and the safety checks
+#ifdef ENABLE_LEGACY_API
+  RAPI_SETTING_KWH_LIMIT,     // $GH kwh_limit
+  RAPI_SETTING_TIME_LIMIT,    // $G3 time_limit
+  RAPI_SETTING_CURRENT,       // $GC current_l1min ... current_l2max
+#endif
+  RAPI_SETTING_COUNT
+};
+
+// Setting reads kept queued at once in the background, all the missing
+// settings are queued as soon as a consumer asks for one
+#ifndef RAPI_SETTINGS_IN_FLIGHT
+#define RAPI_SETTINGS_IN_FLIGHT 1
+#endif
+// Time (ms) before a failed setting read is tried again
+#ifndef RAPI_SETTINGS_RETRY_MS
+#define RAPI_SETTINGS_RETRY_MS  5000
+#endif
+
+struct RapiPollMetric
+{
+  const RapiCmd *cmd;
+  bool (*update)();           // Parse the reply, false if invalid
+  uint32_t period[RAPI_POLL_STATE_COUNT];
+
+  unsigned long lastSent;
+  unsigned long lastUpdate;
+  unsigned long interval;     // Smoothed time between updates
+  bool pending;
+};
+
 extern String url;
 extern String data;
 
-extern long amp;    // OpenEVSE Current Sensor
-extern long volt;   // Not currently in used
-extern long temp1;  // Sensor DS3232 Ambient
-extern long temp2;  // Sensor MCP9808 Ambient
-extern long temp3;  // Sensor TMP007 Infared
-extern long pilot;  // OpenEVSE Pilot Setting
-extern long state;    // OpenEVSE State
-extern long elapsed;  // Elapsed time (only valid if charging)
 extern String estate; // Common name for State
 
 //Defaults OpenEVSE Settings
@@ -47,28 +124,22 @@ extern byte auto_start;
 extern String firmware;
 extern String protocol;
 
-//Default OpenEVSE Fault Counters
-extern long gfci_count;
-extern long nognd_count;
-extern long stuck_count;
-
 //OpenEVSE Session
 #ifdef ENABLE_LEGACY_API
 extern long kwh_limit;
 extern long time_limit;
 #endif
 
-//OpenEVSE Usage Statistics
-extern long wattsec;
-extern long watthour_total;
-
 extern String ohm_hour;
 
 extern unsigned long comm_sent;
 extern unsigned long comm_success;
 
-extern void handleRapiRead();
+extern void update_rapi_settings();
+extern bool rapi_setting_valid(RapiSetting setting);
 extern void update_rapi_values();
+extern void update_rapi_state();
+extern void rapi_poll_status(JsonWriter &json);
 extern void create_rapi_json();
 extern void on_rapi_event();
 
@@ -1,6 +1,7 @@
 #include "emonesp.h"
 #include "lcd.h"
 #include "RapiSender.h"
+#include "RapiTransaction.h"
 #include "openevse.h"
 #include "input.h"
 
@@ -26,6 +27,9 @@ Message *tail = NULL;
 bool lcdClaimed = false;
 uint32_t nextTime = 0;
 
+// Writing one message, or releasing the LCD
+static RapiTransaction lcd_write(rapiSender, "lcd", RAPI_SOURCE_LCD);
+
 void lcd_display(Message *msg, int x, int y, int time, uint32_t flags)
 {
   msg->x = x;
@@ -35,6 +39,9 @@ void lcd_display(Message *msg, int x, int y, int time, uint32_t flags)
 
   if(flags & LCD_DISPLAY_NOW)
   {
+    // Stop writing the message on the LCD now so the new one is written
+    // straight away
+    lcd_write.abort();
     for(Message *next, *node = head; node; node = next) {
       next = node->next;
       delete node;
@@ -79,67 +86,77 @@ void lcd_display(const char *msg, int x, int y, int time, uint32_t flags)
   lcd_display(msgStruct, x, y, time, flags);
 }
 
+// Clear the rest of the line from x, older versions of the firmware crash
+// if sending more than 6 spaces so clear it using blocks of 6 spaces
+static void lcd_clear_line(const Message *msg, int x)
+{
+  if(x < LCD_MAX_LEN) {
+    lcd_write.send(RAPI_CMD_FP, RapiArgs().add(x).add(msg->y).add("      "), [msg, x](int ret)
+    {
+      if(RAPI_RESPONSE_OK == ret) {
+        lcd_clear_line(msg, x + 6);
+      }
+    });
+  }
+}
+
+static void lcd_write_message(const Message *msg)
+{
+  lcd_write.send(RAPI_CMD_FP, RapiArgs().add(msg->x).add(msg->y).add(msg->msg), [msg](int ret)
+  {
+    if(RAPI_RESPONSE_OK == ret && msg->clear) {
+      lcd_clear_line(msg, msg->x + strlen(msg->msg));
+    }
+  });
+}
+
 void lcd_loop()
 {
   // If the OpenEVSE has not started don't do anything
-  if(OPENEVSE_STATE_STARTING == state) {
+  if(OPENEVSE_STATE_STARTING == evse_value(EVSE_STATE)) {
     return;
   }
 
-  while(millis() >= nextTime)
-  {
-    if(head)
-    {
-      // Pop a message from the queue
-      Message *msg = head;
-      head = head->next;
-      if(NULL == head) {
-        tail = NULL;
-      }
+  // Wait for the last message to be written, the commands are sent one at
+  // a time from rapiSender.loop() so we don't wait for the responses here
+  if(millis() < nextTime || lcd_write.isRunning()) {
+    return;
+  }
 
-      // If the LCD has not been claimed, claim in
-      if(false == lcdClaimed) {
-        rapiSender.sendCmd(F("$F0 0"));
-        lcdClaimed = true;
-      }
+  if(head)
+  {
+    // Pop a message from the queue
+    Message *msg = head;
+    head = head->next;
+    if(NULL == head) {
+      tail = NULL;
+    }
 
-      // Display the message
-      String cmd = F("$FP ");
-      cmd += msg->x;
-      cmd += " ";
-      cmd += msg->y;
-      cmd += " ";
-      cmd += msg->msg;
-      rapiSender.sendCmd(cmd);
+    nextTime = millis() + msg->time;
 
-      if(msg->clear)
+    lcd_write.begin([msg](int)
+    {
+      // If the LCD has not been claimed, claim in
+      if(false == lcdClaimed)
       {
-        for(int i = msg->x + strlen(msg->msg); i < LCD_MAX_LEN; i += 6)
-        {
-          // Older versions of the firmware crash if sending more than 6 spaces so clear the rest
-          // of the line using blocks of 6 spaces
-          String cmd = F("$FP ");
-          cmd += i;
-          cmd += " ";
-          cmd += msg->y;
-          cmd += "       "; // 7 spaces 1 separator and 6 to display
-          rapiSender.sendCmd(cmd);
-        }
+        lcdClaimed = true;
+        lcd_write.send(RAPI_CMD_F0, RapiArgs().add(0), [msg](int ret) {
+          lcd_write_message(msg);
+        });
+      } else {
+        lcd_write_message(msg);
       }
-
-      nextTime = millis() + msg->time;
-
+    }, [msg](bool completed) {
       // delete the message
       delete msg;
-    }
-    else if (lcdClaimed)
-    {
-      // No messages to display release the LCD.
-      rapiSender.sendCmd(F("$F0 1"));
-      lcdClaimed = false;
-    } else {
-      break;
-    }
+    });
+  }
+  else if (lcdClaimed)
+  {
+    // No messages to display release the LCD.
+    lcdClaimed = false;
+    lcd_write.begin([](int) {
+      lcd_write.send(RAPI_CMD_F0, RapiArgs().add(1), nullptr);
+    });
   }
 }
-
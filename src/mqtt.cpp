@@ -3,6 +3,7 @@
 #include "config.h"
 #include "divert.h"
 #include "input.h"
+#include "rapi_cache.h"
 
 #include <Arduino.h>
 #include <PubSubClient.h>             // MQTT https://github.com/knolleary/pubsubclient PlatformIO lib: 89
@@ -74,16 +75,17 @@ void mqttmsg_callback(char *topic, byte * payload, unsigned int length) {
         }
       }
 
-      comm_sent++;
-      if (0 == rapiSender.sendCmd(cmd.c_str())) {
-        comm_success++;
-        String rapiString = rapiSender.getResponse();
-        if (rapiString.startsWith("$OK ") || rapiString.startsWith("$NK ")) {
-          String mqtt_data = rapiString;
-          String mqtt_sub_topic = mqtt_topic + "/rapi/out";
-          mqttclient.publish(mqtt_sub_topic.c_str(), mqtt_data.c_str());
+      RapiSourceScope source(rapiSender, RAPI_SOURCE_MQTT);
+      rapi_cache_send(cmd, [](int ret, const String &rapiString)
+      {
+        if (0 == ret) {
+          if (rapiString.startsWith("$OK ") || rapiString.startsWith("$NK ")) {
+            String mqtt_data = rapiString;
+            String mqtt_sub_topic = mqtt_topic + "/rapi/out";
+            mqttclient.publish(mqtt_sub_topic.c_str(), mqtt_data.c_str());
+          }
         }
-      }
+      });
     }
   }
 } //end call back
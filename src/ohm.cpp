@@ -33,6 +33,7 @@ extern RapiSender rapiSender;
 void ohm_loop()
 {
   Profile_Start(ohm_loop);
+  RapiSourceScope source(rapiSender, RAPI_SOURCE_OHM);
 
   if (ohm != 0)
   {
@@ -68,9 +69,11 @@ void ohm_loop()
             DBUGLN(F("Ohm Hour"));
             if (evse_sleep == 0) {
               evse_sleep = 1;
-              if(0 == rapiSender.sendCmd(F("$FS"))) {
-                DBUGLN(F("Charging Started"));
-              }
+              rapiSender.sendCmd(RAPI_CMD_FS, [](int ret) {
+                if(RAPI_RESPONSE_OK == ret) {
+                  DBUGLN(F("Charging Started"));
+                }
+              });
             }
           }
           else
@@ -78,9 +81,11 @@ void ohm_loop()
             DBUGLN(F("It is not an Ohm Hour"));
             if (evse_sleep == 1) {
               evse_sleep = 0;
-              if(0 == rapiSender.sendCmd(F("$FE"))) {
-                DBUGLN(F("Charging Stopped"));
-              }
+              rapiSender.sendCmd(RAPI_CMD_FE, [](int ret) {
+                if(RAPI_RESPONSE_OK == ret) {
+                  DBUGLN(F("Charging Stopped"));
+                }
+              });
             }
           }
         }
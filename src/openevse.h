@@ -17,4 +17,9 @@
 #define OPENEVSE_STATE_SLEEPING             254
 #define OPENEVSE_STATE_DISABLED             255
 
+// Nominal supply voltage for each service level, used when the EVSE has
+// no voltmeter
+#define SERVICE_LEVEL1_VOLTAGE  110
+#define SERVICE_LEVEL2_VOLTAGE  240
+
 #endif
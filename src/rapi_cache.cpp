@@ -0,0 +1,292 @@
+#if defined(ENABLE_DEBUG) && !defined(ENABLE_DEBUG_RAPI)
+#undef ENABLE_DEBUG
+#endif
+
+#include "emonesp.h"
+#include "input.h"
+#include "rapi_cache.h"
+#include "RapiSender.h"
+
+struct RapiCacheWaiter
+{
+  RapiCacheWaiter *next;
+  RapiCacheHandler callback;
+};
+
+struct RapiCacheEntry
+{
+  String cmd;                 // Empty if the entry is free
+  String response;
+  int ret;
+  unsigned long updated;
+  bool valid;
+  bool pending;               // Waiting for the EVSE to reply
+  RapiCacheWaiter *waiters;   // Callers sharing the in flight reply
+};
+
+static RapiCacheEntry rapi_cache[RAPI_CACHE_MAX_ENTRIES];
+
+static unsigned long rapi_cache_hits = 0;
+static unsigned long rapi_cache_misses = 0;
+static unsigned long rapi_cache_shared = 0;
+
+static const struct {
+  const char *cmd;
+  unsigned long ttl;
+} rapi_cache_ttl[] = {
+  { "$GG", RAPI_CACHE_TTL_GG },
+  { "$GS", RAPI_CACHE_TTL_GS },
+  { "$GT", RAPI_CACHE_TTL_GT },
+  { "$GU", RAPI_CACHE_TTL_GU },
+  { "$GP", RAPI_CACHE_TTL_GP },
+  { "$GF", RAPI_CACHE_TTL_GF },
+  { "$GV", RAPI_CACHE_TTL_GV },
+};
+
+// The $G commands that report the value changed by each write, any
+// other $S or $F command drops the whole cache
+static const struct {
+  const char *cmd;
+  const char *reads;
+} rapi_cache_writes[] = {
+  { "$F0", "" },
+  { "$FB", "" },
+  { "$FP", "" },
+  { "$SE", "" },
+  { "$FD", "GS" },
+  { "$FE", "GS" },
+  { "$FS", "GS" },
+  { "$FF", "GE" },
+  { "$S0", "GE" },
+  { "$S1", "GT" },
+  { "$S2", "GE" },
+  { "$S3", "G3" },
+  { "$SA", "GA" },
+  { "$SC", "GEGC" },
+  { "$SD", "GE" },
+  { "$SF", "GE" },
+  { "$SG", "GE" },
+  { "$SH", "GH" },
+  { "$SK", "GU" },
+  { "$SL", "GEGC" },
+  { "$SM", "GM" },
+  { "$SR", "GE" },
+  { "$SS", "GE" },
+  { "$ST", "GD" },
+  { "$SV", "GE" },
+  { "$SY", "GY" },
+};
+
+#define ARRAY_ITEMS(a) (sizeof(a) / sizeof(a[0]))
+
+// -------------------------------------------------------------------
+// How long the reply to a command can be reused, 0 if not at all
+// -------------------------------------------------------------------
+static unsigned long
+rapi_cache_ttl_for(const String &cmd) {
+  if(!cmd.startsWith("$G")) {
+    return 0;
+  }
+
+  for(int i = 0; i < ARRAY_ITEMS(rapi_cache_ttl); i++) {
+    if(cmd.startsWith(rapi_cache_ttl[i].cmd)) {
+      return rapi_cache_ttl[i].ttl;
+    }
+  }
+
+  return RAPI_CACHE_TTL_DEFAULT;
+}
+
+static RapiCacheEntry *
+rapi_cache_find(const String &cmd) {
+  for(int i = 0; i < RAPI_CACHE_MAX_ENTRIES; i++) {
+    if(rapi_cache[i].cmd == cmd) {
+      return &rapi_cache[i];
+    }
+  }
+
+  return NULL;
+}
+
+// -------------------------------------------------------------------
+// Find a free entry, or reuse the least recently updated one. Entries
+// with a reply pending are never reused as the RAPI callback refers to
+// them.
+// -------------------------------------------------------------------
+static RapiCacheEntry *
+rapi_cache_alloc() {
+  RapiCacheEntry *oldest = NULL;
+  for(int i = 0; i < RAPI_CACHE_MAX_ENTRIES; i++)
+  {
+    RapiCacheEntry *entry = &rapi_cache[i];
+    if(0 == entry->cmd.length()) {
+      return entry;
+    }
+    if(!entry->pending && (NULL == oldest || entry->updated < oldest->updated)) {
+      oldest = entry;
+    }
+  }
+
+  return oldest;
+}
+
+static void
+rapi_cache_complete(RapiCacheEntry *entry, int ret) {
+  entry->pending = false;
+  entry->ret = ret;
+  if(RAPI_RESPONSE_OK == ret || RAPI_RESPONSE_NK == ret)
+  {
+    if(RAPI_RESPONSE_OK == ret) {
+      comm_success++;
+    }
+    entry->response = rapiSender.getResponse();
+    entry->updated = millis();
+    entry->valid = true;
+  } else {
+    entry->response = "";
+    entry->valid = false;
+  }
+
+  // Detach the waiters first, the callbacks may send more commands
+  RapiCacheWaiter *waiter = entry->waiters;
+  entry->waiters = NULL;
+  String response = entry->response;
+
+  while(waiter)
+  {
+    RapiCacheWaiter *next = waiter->next;
+    if(waiter->callback) {
+      waiter->callback(ret, response);
+    }
+    delete waiter;
+    waiter = next;
+  }
+}
+
+static void
+rapi_cache_wait(RapiCacheEntry *entry, RapiCacheHandler callback) {
+  RapiCacheWaiter *waiter = new RapiCacheWaiter;
+  waiter->next = NULL;
+  waiter->callback = callback;
+
+  // Call back in the order the requests arrived
+  RapiCacheWaiter **tail = &entry->waiters;
+  while(*tail) {
+    tail = &(*tail)->next;
+  }
+  *tail = waiter;
+}
+
+// -------------------------------------------------------------------
+// Send a command without caching the reply
+// -------------------------------------------------------------------
+static int
+rapi_cache_forward(const String &cmd, RapiCacheHandler callback) {
+  comm_sent++;
+  return rapiSender.sendCmd(cmd, [callback](int ret)
+  {
+    if(RAPI_RESPONSE_OK == ret) {
+      comm_success++;
+    }
+
+    if(callback) {
+      callback(ret, ret >= RAPI_RESPONSE_OK ? String(rapiSender.getResponse()) : String(""));
+    }
+  });
+}
+
+int
+rapi_cache_send(const String &cmd, RapiCacheHandler callback) {
+  unsigned long ttl = rapi_cache_ttl_for(cmd);
+  if(0 == ttl) {
+    return rapi_cache_forward(cmd, callback);
+  }
+
+  RapiCacheEntry *entry = rapi_cache_find(cmd);
+  if(entry)
+  {
+    // Share the reply already on its way
+    if(entry->pending) {
+      rapi_cache_shared++;
+      rapi_cache_wait(entry, callback);
+      return RAPI_RESPONSE_QUEUED;
+    }
+
+    if(entry->valid && (millis() - entry->updated) < ttl)
+    {
+      DBUGF("RAPI cache hit %s", cmd.c_str());
+      rapi_cache_hits++;
+      if(callback) {
+        String response = entry->response;
+        callback(entry->ret, response);
+      }
+      return RAPI_RESPONSE_QUEUED;
+    }
+  } else {
+    entry = rapi_cache_alloc();
+    if(NULL == entry) {
+      // Everything is in flight, just send it
+      return rapi_cache_forward(cmd, callback);
+    }
+    entry->cmd = cmd;
+  }
+
+  rapi_cache_misses++;
+  entry->valid = false;
+  entry->pending = true;
+  rapi_cache_wait(entry, callback);
+
+  comm_sent++;
+  int ret = rapiSender.sendCmd(cmd, [entry](int ret) {
+    rapi_cache_complete(entry, ret);
+  });
+  if(RAPI_RESPONSE_QUEUED != ret)
+  {
+    // Not sent, drop the entry without calling back
+    delete entry->waiters;
+    entry->waiters = NULL;
+    entry->pending = false;
+    entry->cmd = "";
+  }
+
+  return ret;
+}
+
+void
+rapi_cache_invalidate(const char *cmd) {
+  const char *reads = NULL;
+  for(int i = 0; i < ARRAY_ITEMS(rapi_cache_writes); i++) {
+    if(0 == strncmp(cmd, rapi_cache_writes[i].cmd, 3)) {
+      reads = rapi_cache_writes[i].reads;
+      break;
+    }
+  }
+
+  for(int i = 0; i < RAPI_CACHE_MAX_ENTRIES; i++)
+  {
+    RapiCacheEntry *entry = &rapi_cache[i];
+    if(!entry->valid) {
+      continue;
+    }
+
+    // Unknown writes could change anything
+    bool affected = NULL == reads;
+    for(const char *read = reads; read && *read && !affected; read += 2) {
+      affected = entry->cmd[1] == read[0] && entry->cmd[2] == read[1];
+    }
+
+    if(affected) {
+      DBUGF("RAPI cache drop %s", entry->cmd.c_str());
+      entry->valid = false;
+    }
+  }
+}
+
+void
+rapi_cache_status(JsonWriter &json) {
+  json.beginObject();
+  json.add(F("hits"), rapi_cache_hits);
+  json.add(F("shared"), rapi_cache_shared);
+  json.add(F("misses"), rapi_cache_misses);
+  json.endObject();
+}
@@ -0,0 +1,63 @@
+// RAPI response cache
+// Shares the replies to read only RAPI commands between the HTTP and
+// MQTT RAPI pass through so several clients polling the same value only
+// cost one serial transaction
+
+#ifndef _EMONESP_RAPI_CACHE_H
+#define _EMONESP_RAPI_CACHE_H
+
+#include <Arduino.h>
+#include <functional>
+#include "JsonWriter.h"
+
+// -------------------------------------------------------------------
+// How long (ms) the reply to each $G command is reused, 0 disables
+// caching for that command. Writes ($S/$F) drop the affected replies
+// straight away.
+// -------------------------------------------------------------------
+#ifndef RAPI_CACHE_TTL_DEFAULT
+#define RAPI_CACHE_TTL_DEFAULT  5000    // Settings
+#endif
+#ifndef RAPI_CACHE_TTL_GG
+#define RAPI_CACHE_TTL_GG       1000    // Current, voltage
+#endif
+#ifndef RAPI_CACHE_TTL_GS
+#define RAPI_CACHE_TTL_GS       1000    // State, elapsed
+#endif
+#ifndef RAPI_CACHE_TTL_GT
+#define RAPI_CACHE_TTL_GT       1000    // Time
+#endif
+#ifndef RAPI_CACHE_TTL_GU
+#define RAPI_CACHE_TTL_GU       5000    // Energy
+#endif
+#ifndef RAPI_CACHE_TTL_GP
+#define RAPI_CACHE_TTL_GP       10000   // Temperatures
+#endif
+#ifndef RAPI_CACHE_TTL_GF
+#define RAPI_CACHE_TTL_GF       30000   // Fault counters
+#endif
+#ifndef RAPI_CACHE_TTL_GV
+#define RAPI_CACHE_TTL_GV       300000  // Firmware version
+#endif
+
+// Number of distinct commands that can be cached
+#ifndef RAPI_CACHE_MAX_ENTRIES
+#define RAPI_CACHE_MAX_ENTRIES  8
+#endif
+
+typedef std::function<void(int ret, const String &response)> RapiCacheHandler;
+
+// Send a RAPI command, or reuse a recent/in flight reply for the same
+// read command. The callback may be called before this returns when the
+// reply is cached. Returns RAPI_RESPONSE_QUEUED, or an error if the
+// command could not be sent in which case the callback is not called.
+extern int rapi_cache_send(const String &cmd, RapiCacheHandler callback);
+
+// Forget the cached replies affected by a write command, eg $SC. Set as
+// RapiSender's write handler so every write drops them, whoever sent it.
+extern void rapi_cache_invalidate(const char *cmd);
+
+// Hit/miss counters as JSON
+extern void rapi_cache_status(JsonWriter &json);
+
+#endif // _EMONESP_RAPI_CACHE_H
@@ -0,0 +1,59 @@
+#include "emonesp.h"
+#include "rapi_caps.h"
+
+static uint8_t rapi_caps[RAPI_CAP_COUNT];
+static String rapi_caps_key;          // "<firmware> <protocol>" they were learnt for
+
+static const char *rapi_cap_names[RAPI_CAP_COUNT] = {
+  "sc_volatile",
+  "gd",
+  "ff",
+};
+
+uint8_t
+rapi_cap(RapiCap cap) {
+  return rapi_caps[cap];
+}
+
+void
+rapi_cap_set(RapiCap cap, bool supported) {
+  uint8_t value = supported ? RAPI_CAP_SUPPORTED : RAPI_CAP_UNSUPPORTED;
+  if(value != rapi_caps[cap]) {
+    DBUGF("RAPI %s %s", rapi_cap_names[cap], supported ? "supported" : "not supported");
+    rapi_caps[cap] = value;
+  }
+}
+
+void
+rapi_caps_version(const String &firmware, const String &protocol) {
+  String key = firmware + " " + protocol;
+  if(key == rapi_caps_key) {
+    return;
+  }
+
+  // Whatever was learnt before the first $GV is from this EVSE, anything
+  // learnt for a different version is not
+  if(rapi_caps_key.length() > 0)
+  {
+    DBUGF("OpenEVSE firmware changed, %s -> %s", rapi_caps_key.c_str(), key.c_str());
+    for(int i = 0; i < RAPI_CAP_COUNT; i++) {
+      rapi_caps[i] = RAPI_CAP_UNKNOWN;
+    }
+  }
+  rapi_caps_key = key;
+}
+
+void
+rapi_caps_status(JsonWriter &json) {
+  json.beginObject();
+  for(int i = 0; i < RAPI_CAP_COUNT; i++)
+  {
+    json.key(rapi_cap_names[i]);
+    if(RAPI_CAP_UNKNOWN == rapi_caps[i]) {
+      json.valueNull();
+    } else {
+      json.value(RAPI_CAP_SUPPORTED == rapi_caps[i]);
+    }
+  }
+  json.endObject();
+}
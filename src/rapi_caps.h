@@ -0,0 +1,40 @@
+// RAPI capabilities
+// Which optional commands and flags the OpenEVSE firmware supports, so
+// callers can send the form the EVSE understands first time rather than
+// trying the new form and falling back on every call
+
+#ifndef _EMONESP_RAPI_CAPS_H
+#define _EMONESP_RAPI_CAPS_H
+
+#include <Arduino.h>
+#include "JsonWriter.h"
+
+enum RapiCap
+{
+  RAPI_CAP_SC_VOLATILE,       // $SC <amps> V, set the current without saving to EEPROM
+  RAPI_CAP_GD,                // $GD, read the delay timer
+  RAPI_CAP_FF,                // $FF <feature> <0|1>, else $S<feature> <0|1>
+  RAPI_CAP_COUNT
+};
+
+#define RAPI_CAP_UNKNOWN        0   // Not tried yet, send the new form
+#define RAPI_CAP_SUPPORTED      1
+#define RAPI_CAP_UNSUPPORTED    2
+
+// -------------------------------------------------------------------
+// Each capability is learnt the first time it is used. A capability is
+// only marked unsupported when the new form gets $NK and the fallback
+// works, so a command that failed for some other reason is tried again.
+// What was learnt applies to the firmware version from $GV, it is
+// forgotten if the EVSE reports a different version.
+// -------------------------------------------------------------------
+extern uint8_t rapi_cap(RapiCap cap);
+extern void rapi_cap_set(RapiCap cap, bool supported);
+
+// Called with the $GV reply
+extern void rapi_caps_version(const String &firmware, const String &protocol);
+
+// What is known as JSON
+extern void rapi_caps_status(JsonWriter &json);
+
+#endif // _EMONESP_RAPI_CAPS_H
@@ -0,0 +1,237 @@
+#ifdef ENABLE_RAPI_CAPTURE
+
+#include "emonesp.h"
+#include "rapi_capture.h"
+#include "input.h"
+#include "RapiSender.h"
+
+static RapiCaptureSample samples[RAPI_CAPTURE_SAMPLES];
+static uint16_t sample_count = 0;
+
+// Why the last capture stopped
+enum RapiCaptureStop
+{
+  RAPI_CAPTURE_STOP_NONE,
+  RAPI_CAPTURE_STOP_TIME,
+  RAPI_CAPTURE_STOP_FULL,
+  RAPI_CAPTURE_STOP_ERROR
+};
+
+static bool running = false;
+static RapiCaptureStop stopped = RAPI_CAPTURE_STOP_NONE;
+static bool capture_state = false;
+static unsigned int capture_seconds = 0;
+static uint32_t start_us = 0;
+static unsigned long end_ms = 0;
+static uint8_t in_flight = 0;
+static uint16_t sent = 0;             // Commands sent, picks $GG or $GS
+static uint16_t errors = 0;
+
+static void rapi_capture_send();
+
+static void
+rapi_capture_add(char cmd, long a, long b) {
+  if(sample_count < RAPI_CAPTURE_SAMPLES)
+  {
+    RapiCaptureSample &sample = samples[sample_count];
+    sample.time = micros() - start_us;
+    sample.cmd = cmd;
+    sample.value[0] = a;
+    sample.value[1] = b;
+    sample_count++;
+  }
+}
+
+static void
+rapi_capture_reply(bool state, int ret) {
+  in_flight--;
+
+  if(RAPI_RESPONSE_OK == ret)
+  {
+    if(state) {
+      RapiReplyGS gs;
+      if(rapiSender.getReply(gs)) {
+        rapi_capture_add('S', gs.state, gs.elapsed);
+      }
+    } else {
+      RapiReplyGG gg;
+      if(rapiSender.getReply(gg)) {
+        rapi_capture_add('G', gg.milliAmps, gg.milliVolts);
+      }
+    }
+  } else {
+    errors++;
+  }
+
+  if(running && sample_count >= RAPI_CAPTURE_SAMPLES) {
+    stopped = RAPI_CAPTURE_STOP_FULL;
+    running = false;
+  } else if(running && (long)(millis() - end_ms) >= 0) {
+    stopped = RAPI_CAPTURE_STOP_TIME;
+    running = false;
+  }
+  if(RAPI_CAPTURE_STOP_NONE != stopped && !running && 0 == in_flight) {
+    DBUGF("Capture done, %u samples, %u errors, stop %d", sample_count, errors, stopped);
+  }
+
+  if(running) {
+    rapi_capture_send();
+  }
+}
+
+// Send the next command, the source is set by the completion of the last
+static void
+rapi_capture_send() {
+  bool state = capture_state && 0 == (sent + 1) % (RAPI_CAPTURE_STATE_EVERY + 1);
+  int ret = rapiSender.sendCmd(state ? RAPI_CMD_GS : RAPI_CMD_GG, [state](int ret) {
+    rapi_capture_reply(state, ret);
+  });
+
+  if(RAPI_RESPONSE_QUEUED == ret) {
+    in_flight++;
+    sent++;
+  } else if(0 == in_flight) {
+    DBUGF("Capture stopped, %d", ret);
+    stopped = RAPI_CAPTURE_STOP_ERROR;
+    running = false;
+  }
+}
+
+bool
+rapi_capture_start(unsigned int seconds, bool state) {
+  if(running || in_flight > 0) {
+    return false;
+  }
+
+  DBUGF("Capture %u s", seconds);
+  running = true;
+  stopped = RAPI_CAPTURE_STOP_NONE;
+  capture_state = state;
+  capture_seconds = seconds;
+  sample_count = 0;
+  sent = 0;
+  errors = 0;
+  end_ms = millis() + seconds * 1000UL;
+  start_us = micros();
+
+  // Keep one command waiting for a reply while the next is sent if the
+  // link is pipelined
+  RapiSourceScope source(rapiSender, RAPI_SOURCE_POLL);
+  rapi_capture_send();
+  if(rapiSender.isPipelined()) {
+    rapi_capture_send();
+  }
+
+  return running;
+}
+
+bool
+rapi_capture_running() {
+  return running;
+}
+
+uint16_t
+rapi_capture_count() {
+  return sample_count;
+}
+
+const RapiCaptureSample &
+rapi_capture_sample(uint16_t i) {
+  return samples[i];
+}
+
+void
+rapi_capture_status(JsonWriter &json) {
+  json.beginObject();
+  json.add(F("running"), running);
+  switch(stopped) {
+    case RAPI_CAPTURE_STOP_TIME: json.add(F("stopped"), F("time")); break;
+    case RAPI_CAPTURE_STOP_FULL: json.add(F("stopped"), F("full")); break;
+    case RAPI_CAPTURE_STOP_ERROR: json.add(F("stopped"), F("error")); break;
+    default: json.addNull(F("stopped")); break;
+  }
+  json.add(F("seconds"), capture_seconds);
+  json.add(F("samples"), sample_count);
+  json.add(F("size"), RAPI_CAPTURE_SAMPLES);
+  json.add(F("errors"), errors);
+  json.add(F("duration_ms"), sample_count > 0 ? samples[sample_count - 1].time / 1000 : 0);
+  json.endObject();
+}
+
+static uint8_t
+rapi_capture_byte(uint16_t count, size_t offset) {
+  if(offset < RAPI_CAPTURE_HEADER_SIZE)
+  {
+    static const char magic[] = "RCAP";
+    switch(offset) {
+      case 4: return RAPI_CAPTURE_RECORD_SIZE;
+      case 5: return 0;
+      case 6: return count;
+      case 7: return count >> 8;
+      default: return magic[offset];
+    }
+  }
+
+  offset -= RAPI_CAPTURE_HEADER_SIZE;
+  const RapiCaptureSample &sample = samples[offset / RAPI_CAPTURE_RECORD_SIZE];
+  offset %= RAPI_CAPTURE_RECORD_SIZE;
+  if(offset < 4) {
+    return sample.time >> (8 * offset);
+  }
+  if(4 == offset) {
+    return sample.cmd;
+  }
+  offset -= 5;
+  return (uint32_t)sample.value[offset / 4] >> (8 * (offset % 4));
+}
+
+size_t
+rapi_capture_binary_size(uint16_t count) {
+  return RAPI_CAPTURE_HEADER_SIZE + (size_t)count * RAPI_CAPTURE_RECORD_SIZE;
+}
+
+size_t
+rapi_capture_binary(uint8_t *buffer, size_t maxLen, size_t index, uint16_t count) {
+  size_t total = rapi_capture_binary_size(count);
+  size_t len = 0;
+  for(; len < maxLen && index + len < total; len++) {
+    buffer[len] = rapi_capture_byte(count, index + len);
+  }
+  return len;
+}
+
+static const char csv_header[] PROGMEM = "time_us,cmd,value1,value2\n";
+
+size_t
+rapi_capture_csv(uint8_t *buffer, size_t maxLen, RapiCaptureCsv &pos, uint16_t count) {
+  // Longest line is 10 + 1 + 1 + 2 * (1 + 11) + 1
+  char line[40];
+  size_t len = 0;
+  while(len < maxLen && pos.line <= count)
+  {
+    int n;
+    if(0 == pos.line) {
+      n = sizeof(csv_header) - 1;
+      memcpy_P(line, csv_header, n);
+    } else {
+      const RapiCaptureSample &s = samples[pos.line - 1];
+      n = sprintf(line, "%u,%c,%d,%d\n",
+                  (unsigned)s.time, s.cmd, (int)s.value[0], (int)s.value[1]);
+    }
+
+    size_t copy = n - pos.offset;
+    if(copy > maxLen - len) {
+      copy = maxLen - len;
+    }
+    memcpy(buffer + len, line + pos.offset, copy);
+    len += copy;
+    pos.offset += copy;
+    if(pos.offset == n) {
+      pos.line++;
+      pos.offset = 0;
+    }
+  }
+  return len;
+}
+
+#endif // ENABLE_RAPI_CAPTURE
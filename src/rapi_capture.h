@@ -0,0 +1,72 @@
+// RAPI burst capture, enabled with ENABLE_RAPI_CAPTURE
+// Reads $GG back to back, and optionally $GS, for a few seconds in to a
+// fixed buffer to look at how the charge current changes in detail, eg a
+// slow ramp up or a car that oscillates. The normal polling of the EVSE
+// values, state and settings is paused while a capture runs.
+
+#ifndef _EMONESP_RAPI_CAPTURE_H
+#define _EMONESP_RAPI_CAPTURE_H
+
+#include <Arduino.h>
+#include "JsonWriter.h"
+
+#ifndef RAPI_CAPTURE_SAMPLES
+#define RAPI_CAPTURE_SAMPLES 512
+#endif
+
+// The capture stops early when the buffer is full. At about 380 readings
+// a second, a pipelined link at 115200 baud, 512 samples last about 1.3 s
+// so the default is 1 s, the status says why a capture stopped.
+#ifndef RAPI_CAPTURE_DEFAULT_SECONDS
+#define RAPI_CAPTURE_DEFAULT_SECONDS 1
+#endif
+#define RAPI_CAPTURE_MAX_SECONDS 60
+
+// One $GS for this many $GG when the state is captured
+#define RAPI_CAPTURE_STATE_EVERY 8
+
+struct RapiCaptureSample
+{
+  uint32_t time;              // micros() from the start of the capture to the reply
+  char cmd;                   // 'G' $GG or 'S' $GS
+  int32_t value[2];           // mA and mV, or state and elapsed seconds
+};
+
+// Binary download, little endian:
+//   "RCAP", uint16 record size (13), uint16 record count
+// followed by the records
+//   uint32 time, char cmd, int32 value[0], int32 value[1]
+#define RAPI_CAPTURE_HEADER_SIZE 8
+#define RAPI_CAPTURE_RECORD_SIZE 13
+
+// Start a capture of seconds, false if one is already running
+extern bool rapi_capture_start(unsigned int seconds, bool state);
+extern bool rapi_capture_running();
+
+// The samples captured so far, samples below count don't change
+extern uint16_t rapi_capture_count();
+extern const RapiCaptureSample &rapi_capture_sample(uint16_t i);
+
+// Status as JSON, stopped is "time" when the capture ran for the seconds
+// asked for, "full" if the buffer filled first, "error" if a command could
+// not be sent and null while running or before the first capture
+extern void rapi_capture_status(JsonWriter &json);
+
+// Write the part of the binary download of the first count samples that
+// starts at index in to buffer
+extern size_t rapi_capture_binary_size(uint16_t count);
+extern size_t rapi_capture_binary(uint8_t *buffer, size_t maxLen, size_t index, uint16_t count);
+
+// Where the CSV download of the first count samples has got to, a line
+// can be split over calls
+struct RapiCaptureCsv
+{
+  uint16_t line;              // 0 the header, then sample line - 1
+  uint8_t offset;             // Bytes of the line already written
+};
+
+// Write the CSV download from pos in to buffer, as much as fits, 0 once
+// it is all written
+extern size_t rapi_capture_csv(uint8_t *buffer, size_t maxLen, RapiCaptureCsv &pos, uint16_t count);
+
+#endif // _EMONESP_RAPI_CAPTURE_H
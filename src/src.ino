@@ -39,6 +39,7 @@
 #include "divert.h"
 #include "ota.h"
 #include "lcd.h"
+#include "rapi_cache.h"
 
 #include "RapiSender.h"
 
@@ -47,7 +48,7 @@ RapiSender rapiSender(&Serial);
 unsigned long Timer1; // Timer for events once every 30 seconds
 unsigned long Timer3; // Timer for events once every 2 seconds
 
-boolean rapi_read = 0; //flag to indicate first read of RAPI status
+boolean rapi_read = 0; //flag to indicate the OpenEVSE has been found
 
 // -------------------------------------------------------------------
 // SETUP
@@ -84,7 +85,8 @@ void setup() {
 #endif
 
   rapiSender.setOnEvent(on_rapi_event);
-  rapiSender.enableSequenceId(0);
+  rapiSender.setOnWrite(rapi_cache_invalidate);
+  rapiSender.enableSequenceId(1);
 } // end setup
 
 // -------------------------------------------------------------------
@@ -101,52 +103,37 @@ loop() {
   ota_loop();
 #endif
   rapiSender.loop();
+  update_rapi_state();
   divert_current_loop();
 
+  long state = evse_value(EVSE_STATE);
   if(OPENEVSE_STATE_STARTING != state &&
      OPENEVSE_STATE_INVALID != state)
   {
-    // Read initial state from OpenEVSE
+    // Show our version once the OpenEVSE has been found
     if (rapi_read == 0)
     {
       lcd_display(F("OpenEVSE WiFI"), 0, 0, 0, LCD_CLEAR_LINE);
       lcd_display(currentfirmware, 0, 1, 5 * 1000, LCD_CLEAR_LINE);
       lcd_loop();
 
-      DBUGLN("first read RAPI values");
-      handleRapiRead(); //Read all RAPI values
       rapi_read=1;
     }
 
+    // Read the EVSE settings not known yet, a few at a time
+    update_rapi_settings();
+
+    // Queue any RAPI values that are due a refresh
+    update_rapi_values();
+
     // -------------------------------------------------------------------
     // Do these things once every 2s
     // -------------------------------------------------------------------
     if ((millis() - Timer3) >= 2000) {
       DEBUG.printf("Free: %d\n", ESP.getFreeHeap());
-      update_rapi_values();
       Timer3 = millis();
     }
   }
-  else
-  {
-    // Check if we can talk to OpenEVSE
-    if ((millis() - Timer3) >= 1000)
-    {
-      // Check state the OpenEVSE is in.
-      if (0 == rapiSender.sendCmd("$GS"))
-      {
-        if(rapiSender.getTokenCnt() >= 3)
-        {
-          const char *val = rapiSender.getToken(1);
-          DBUGVAR(val);
-          state = strtol(val, NULL, 10);
-          DBUGVAR(state);
-        }
-      } else {
-        DBUGLN("OpenEVSE not responding or not connected");
-      }
-    }
-  }
 
   if(wifi_client_connected())
   {
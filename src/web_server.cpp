@@ -9,6 +9,7 @@
 #include "emonesp.h"
 #include "web_server.h"
 #include "web_server_static.h"
+#include "web_server_routes.h"
 #include "config.h"
 #include "wifi.h"
 #include "mqtt.h"
@@ -16,6 +17,12 @@
 #include "emoncms.h"
 #include "divert.h"
 #include "lcd.h"
+#include "rapi_cache.h"
+#include "rapi_caps.h"
+#include "JsonWriter.h"
+#ifdef ENABLE_RAPI_CAPTURE
+#include "rapi_capture.h"
+#endif
 
 AsyncWebServer server(80);          // Create class for Web server
 AsyncWebSocket ws("/ws");
@@ -95,7 +102,7 @@ void dumpRequest(AsyncWebServerRequest *request) {
 // -------------------------------------------------------------------
 // Helper function to perform the standard operations on a request
 // -------------------------------------------------------------------
-bool requestPreProcess(AsyncWebServerRequest *request, AsyncResponseStream *&response, const __FlashStringHelper *contentType = CONTENT_TYPE_JSON)
+bool requestAuthenticate(AsyncWebServerRequest *request)
 {
   dumpRequest(request);
 
@@ -105,6 +112,15 @@ bool requestPreProcess(AsyncWebServerRequest *request, AsyncResponseStream *&res
     return false;
   }
 
+  return true;
+}
+
+bool requestPreProcess(AsyncWebServerRequest *request, AsyncResponseStream *&response, const __FlashStringHelper *contentType = CONTENT_TYPE_JSON)
+{
+  if(false == requestAuthenticate(request)) {
+    return false;
+  }
+
   response = request->beginResponseStream(String(contentType));
   if(enableCors) {
     response->addHeader(F("Access-Control-Allow-Origin"), F("*"));
@@ -411,9 +427,23 @@ handleSaveOhmkey(AsyncWebServerRequest *request) {
   request->send(response);
 }
 
+static void
+statusEvseValue(JsonWriter &json, const EvseSnapshot &evse, uint32_t fields, EvseField field, const __FlashStringHelper *name) {
+  if(fields & EVSE_FIELD_BIT(field)) {
+    // null until read from the EVSE
+    if(evse.valid & EVSE_FIELD_BIT(field)) {
+      json.add(name, evse.get(field));
+    } else {
+      json.addNull(name);
+    }
+  }
+}
+
 // -------------------------------------------------------------------
 // Returns status json
 // url: /status
+// url: /status?since=<evse_generation>, only the EVSE values that have
+//      changed since an earlier reply
 // -------------------------------------------------------------------
 void
 handleStatus(AsyncWebServerRequest *request) {
@@ -422,81 +452,126 @@ handleStatus(AsyncWebServerRequest *request) {
     return;
   }
 
-  String s = "{";
+  EvseSnapshot evse;
+  evse_snapshot_read(evse);
+  uint32_t fields = EVSE_FIELDS_ALL;
+  if(request->hasArg("since")) {
+    fields = evse.changedSince(request->arg("since").toInt());
+  }
+
+  JsonWriter json(*response);
+  json.beginObject();
   if (wifi_mode_is_sta_only()) {
-    s += "\"mode\":\"STA\",";
+    json.add(F("mode"), F("STA"));
   } else if (wifi_mode_is_ap_only()) {
-    s += "\"mode\":\"AP\",";
+    json.add(F("mode"), F("AP"));
   } else if (wifi_mode_is_ap() && wifi_mode_is_sta()) {
-    s += "\"mode\":\"STA+AP\",";
+    json.add(F("mode"), F("STA+AP"));
   }
 
-  s += "\"wifi_client_connected\":" + String(wifi_client_connected()) + ",";
-  s += "\"srssi\":" + String(WiFi.RSSI()) + ",";
-  s += "\"ipaddress\":\"" + ipaddress + "\",";
-
-  s += "\"emoncms_connected\":" + String(emoncms_connected) + ",";
-  s += "\"packets_sent\":" + String(packets_sent) + ",";
-  s += "\"packets_success\":" + String(packets_success) + ",";
-
-  s += "\"mqtt_connected\":" + String(mqtt_connected()) + ",";
-
-  s += "\"ohm_hour\":\"" + ohm_hour + "\",";
-
-  s += "\"free_heap\":" + String(ESP.getFreeHeap()) + ",";
-
-  s += "\"comm_sent\":" + String(comm_sent) + ",";
-  s += "\"comm_success\":" + String(comm_success) + ",";
-
-  s += "\"amp\":" + String(amp) + ",";
-  s += "\"pilot\":" + String(pilot) + ",";
-  s += "\"temp1\":" + String(temp1) + ",";
-  s += "\"temp2\":" + String(temp2) + ",";
-  s += "\"temp3\":" + String(temp3) + ",";
-  s += "\"state\":" + String(state) + ",";
-  s += "\"elapsed\":" + String(elapsed) + ",";
-  s += "\"wattsec\":" + String(wattsec) + ",";
-  s += "\"watthour\":" + String(watthour_total) + ",";
-
-  s += "\"gfcicount\":" + String(gfci_count) + ",";
-  s += "\"nogndcount\":" + String(nognd_count) + ",";
-  s += "\"stuckcount\":" + String(stuck_count) + ",";
-
-  s += "\"divertmode\":" + String(divertmode) + ",";
-  s += "\"solar\":" + String(solar) + ",";
-  s += "\"grid_ie\":" + String(grid_ie) + ",";
-  s += "\"charge_rate\":" + String(charge_rate) + ",";
-  s += "\"divert_update\":" + String((millis() - lastUpdate) / 1000);
+  json.add(F("wifi_client_connected"), (int)wifi_client_connected());
+  json.add(F("srssi"), WiFi.RSSI());
+  json.add(F("ipaddress"), ipaddress);
+
+  json.add(F("emoncms_connected"), (int)emoncms_connected);
+  json.add(F("packets_sent"), packets_sent);
+  json.add(F("packets_success"), packets_success);
+
+  json.add(F("mqtt_connected"), (int)mqtt_connected());
+
+  json.add(F("ohm_hour"), ohm_hour);
+
+  json.add(F("free_heap"), ESP.getFreeHeap());
+
+  json.add(F("comm_sent"), comm_sent);
+  json.add(F("comm_success"), comm_success);
+  json.key(F("rapi_poll"));
+  rapi_poll_status(json);
+  json.key(F("rapi_cache"));
+  rapi_cache_status(json);
+  json.key(F("rapi_caps"));
+  rapi_caps_status(json);
+  json.beginObject(F("rapi_link"));
+  json.add(F("checksum"), rapiSender.getStats().badChecksum);
+  json.add(F("sequence_id"), rapiSender.getStats().badSequenceId);
+  json.add(F("unexpected"), rapiSender.getStats().unexpected);
+  json.endObject();
+
+  json.add(F("evse_generation"), evse.generation);
+  statusEvseValue(json, evse, fields, EVSE_AMP, F("amp"));
+  statusEvseValue(json, evse, fields, EVSE_POWER, F("power"));
+  statusEvseValue(json, evse, fields, EVSE_PILOT, F("pilot"));
+  statusEvseValue(json, evse, fields, EVSE_TEMP1, F("temp1"));
+  statusEvseValue(json, evse, fields, EVSE_TEMP2, F("temp2"));
+  statusEvseValue(json, evse, fields, EVSE_TEMP3, F("temp3"));
+  statusEvseValue(json, evse, fields, EVSE_STATE, F("state"));
+  statusEvseValue(json, evse, fields, EVSE_ELAPSED, F("elapsed"));
+  statusEvseValue(json, evse, fields, EVSE_WATTSEC, F("wattsec"));
+  statusEvseValue(json, evse, fields, EVSE_WATTHOUR, F("watthour"));
+
+  statusEvseValue(json, evse, fields, EVSE_GFCI_COUNT, F("gfcicount"));
+  statusEvseValue(json, evse, fields, EVSE_NOGND_COUNT, F("nogndcount"));
+  statusEvseValue(json, evse, fields, EVSE_STUCK_COUNT, F("stuckcount"));
+
+  json.add(F("divertmode"), divertmode);
+  json.add(F("solar"), solar);
+  json.add(F("grid_ie"), grid_ie);
+  json.add(F("charge_rate"), charge_rate);
+  json.add(F("divert_update"), (millis() - lastUpdate) / 1000);
 
 #ifdef ENABLE_LEGACY_API
-  s += ",\"networks\":[" + st + "]";
-  s += ",\"rssi\":[" + rssi + "]";
-  s += ",\"version\":\"" + currentfirmware + "\"";
-  s += ",\"ssid\":\"" + esid + "\"";
-  //s += ",\"pass\":\""+epass+"\""; security risk: DONT RETURN PASSWORDS
-  s += ",\"emoncms_server\":\"" + emoncms_server + "\"";
-  s += ",\"emoncms_node\":\"" + emoncms_node + "\"";
-  //s += ",\"emoncms_apikey\":\""+emoncms_apikey+"\""; security risk: DONT RETURN APIKEY
-  s += ",\"emoncms_fingerprint\":\"" + emoncms_fingerprint + "\"";
-  s += ",\"mqtt_server\":\"" + mqtt_server + "\"";
-  s += ",\"mqtt_topic\":\"" + mqtt_topic + "\"";
-  s += ",\"mqtt_user\":\"" + mqtt_user + "\"";
-  //s += ",\"mqtt_pass\":\""+mqtt_pass+"\""; security risk: DONT RETURN PASSWORDS
-  s += ",\"www_username\":\"" + www_username + "\"";
-  //s += ",\"www_password\":\""+www_password+"\""; security risk: DONT RETURN PASSWORDS
-  s += ",\"ohmkey\":\"" + ohm + "\"";
+  json.key(F("networks"));
+  json.valueRaw("[" + st + "]");
+  json.key(F("rssi"));
+  json.valueRaw("[" + rssi + "]");
+  json.add(F("version"), currentfirmware);
+  json.add(F("ssid"), esid);
+  //json.add(F("pass"), epass); security risk: DONT RETURN PASSWORDS
+  json.add(F("emoncms_server"), emoncms_server);
+  json.add(F("emoncms_node"), emoncms_node);
+  //json.add(F("emoncms_apikey"), emoncms_apikey); security risk: DONT RETURN APIKEY
+  json.add(F("emoncms_fingerprint"), emoncms_fingerprint);
+  json.add(F("mqtt_server"), mqtt_server);
+  json.add(F("mqtt_topic"), mqtt_topic);
+  json.add(F("mqtt_user"), mqtt_user);
+  //json.add(F("mqtt_pass"), mqtt_pass); security risk: DONT RETURN PASSWORDS
+  json.add(F("www_username"), www_username);
+  //json.add(F("www_password"), www_password); security risk: DONT RETURN PASSWORDS
+  json.add(F("ohmkey"), ohm);
 #endif
-  s += "}";
+  json.endObject();
 
   DBUGVAR(lastUpdate);
   DBUGVAR(millis());
   DBUGVAR((millis() - lastUpdate) / 1000);
 
   response->setCode(200);
-  response->print(s);
   request->send(response);
 }
 
+static void
+configSetting(JsonWriter &json, const __FlashStringHelper *name, bool valid, long value) {
+  if(valid) {
+    json.add(name, value);
+  } else {
+    json.addNull(name);
+  }
+}
+
+// Passwords and keys are never returned, only whether they are set
+static void
+configPassword(JsonWriter &json, const __FlashStringHelper *name, const String &value) {
+  json.add(name, value.length() > 0 ? DUMMY_PASSWORD : F(""));
+}
+
+// The pre $FF form of a feature command, $FF <feature> <0|1> was $S<feature> <0|1>
+static String
+legacyFeatureCmd(const String &rapi) {
+  String cmd = F("$S");
+  cmd += rapi.substring(4);
+  return cmd;
+}
+
 // -------------------------------------------------------------------
 // Returns OpenEVSE Config json
 // url: /config
@@ -508,70 +583,64 @@ handleConfig(AsyncWebServerRequest *request) {
     return;
   }
 
-  String dummyPassword = String(DUMMY_PASSWORD);
-
-  String s = "{";
-  s += "\"firmware\":\"" + firmware + "\",";
-  s += "\"protocol\":\"" + protocol + "\",";
-  s += "\"espflash\":" + String(ESP.getFlashChipSize()) + ",";
-  s += "\"version\":\"" + currentfirmware + "\",";
-  s += "\"diodet\":" + String(diode_ck) + ",";
-  s += "\"gfcit\":" + String(gfci_test) + ",";
-  s += "\"groundt\":" + String(ground_ck) + ",";
-  s += "\"relayt\":" + String(stuck_relay) + ",";
-  s += "\"ventt\":" + String(vent_ck) + ",";
-  s += "\"tempt\":" + String(temp_ck) + ",";
-  s += "\"service\":" + String(service) + ",";
+  // Settings not read from the EVSE yet are null, asking for them moves
+  // them to the front of the queue
+  bool version = rapi_setting_valid(RAPI_SETTING_VERSION);
+  bool flags = rapi_setting_valid(RAPI_SETTING_FLAGS);
+  bool ammeter = rapi_setting_valid(RAPI_SETTING_AMMETER);
+
+  JsonWriter json(*response);
+  json.beginObject();
+  if(version) {
+    json.add(F("firmware"), firmware);
+    json.add(F("protocol"), protocol);
+  } else {
+    json.addNull(F("firmware"));
+    json.addNull(F("protocol"));
+  }
+  json.add(F("espflash"), ESP.getFlashChipSize());
+  json.add(F("version"), currentfirmware);
+  configSetting(json, F("diodet"), flags, diode_ck);
+  configSetting(json, F("gfcit"), flags, gfci_test);
+  configSetting(json, F("groundt"), flags, ground_ck);
+  configSetting(json, F("relayt"), flags, stuck_relay);
+  configSetting(json, F("ventt"), flags, vent_ck);
+  configSetting(json, F("tempt"), flags, temp_ck);
+  configSetting(json, F("service"), flags, service);
 #ifdef ENABLE_LEGACY_API
-  s += "\"l1min\":\"" + current_l1min + "\",";
-  s += "\"l1max\":\"" + current_l1max + "\",";
-  s += "\"l2min\":\"" + current_l2min + "\",";
-  s += "\"l2max\":\"" + current_l2max + "\",";
-  s += "\"kwhlimit\":\"" + kwh_limit + "\",";
-  s += "\"timelimit\":\"" + time_limit + "\",";
-  s += "\"gfcicount\":" + String(gfci_count) + ",";
-  s += "\"nogndcount\":" + String(nognd_count) + ",";
-  s += "\"stuckcount\":" + String(stuck_count) + ",";
+  // Quoted, as they have always been
+  json.add(F("l1min"), String(current_l1min));
+  json.add(F("l1max"), String(current_l1max));
+  json.add(F("l2min"), String(current_l2min));
+  json.add(F("l2max"), String(current_l2max));
+  json.add(F("kwhlimit"), String(kwh_limit));
+  json.add(F("timelimit"), String(time_limit));
+  json.add(F("gfcicount"), evse_value(EVSE_GFCI_COUNT));
+  json.add(F("nogndcount"), evse_value(EVSE_NOGND_COUNT));
+  json.add(F("stuckcount"), evse_value(EVSE_STUCK_COUNT));
 #endif
-  s += "\"scale\":" + String(current_scale) + ",";
-  s += "\"offset\":" + String(current_offset) + ",";
-  s += "\"ssid\":\"" + esid + "\",";
-  s += "\"pass\":\"";
-  if(epass != 0) {
-    s += dummyPassword;
-  }
-  s += "\",";
-  s += "\"emoncms_enabled\":" + String(config_emoncms_enabled() ? "true" : "false") + ",";
-  s += "\"emoncms_server\":\"" + emoncms_server + "\",";
-  s += "\"emoncms_node\":\"" + emoncms_node + "\",";
-  s += "\"emoncms_apikey\":\"";
-  if(emoncms_apikey != 0) {
-    s += dummyPassword;
-  }
-  s += "\",";
-  s += "\"emoncms_fingerprint\":\"" + emoncms_fingerprint + "\",";
-  s += "\"mqtt_enabled\":" + String(config_mqtt_enabled() ? "true" : "false") + ",";
-  s += "\"mqtt_server\":\"" + mqtt_server + "\",";
-  s += "\"mqtt_topic\":\"" + mqtt_topic + "\",";
-  s += "\"mqtt_user\":\"" + mqtt_user + "\",";
-  s += "\"mqtt_pass\":\"";
-  if(mqtt_pass != 0) {
-    s += dummyPassword;
-  }
-  s += "\",";
-  s += "\"mqtt_solar\":\""+mqtt_solar+"\",";
-  s += "\"mqtt_grid_ie\":\""+mqtt_grid_ie+"\",";
-  s += "\"www_username\":\"" + www_username + "\",";
-  s += "\"www_password\":\"";
-  if(www_password != 0) {
-    s += dummyPassword;
-  }
-  s += "\",";
-  s += "\"ohm_enabled\":" + String(config_ohm_enabled() ? "true" : "false");
-  s += "}";
+  configSetting(json, F("scale"), ammeter, current_scale);
+  configSetting(json, F("offset"), ammeter, current_offset);
+  json.add(F("ssid"), esid);
+  configPassword(json, F("pass"), epass);
+  json.add(F("emoncms_enabled"), config_emoncms_enabled());
+  json.add(F("emoncms_server"), emoncms_server);
+  json.add(F("emoncms_node"), emoncms_node);
+  configPassword(json, F("emoncms_apikey"), emoncms_apikey);
+  json.add(F("emoncms_fingerprint"), emoncms_fingerprint);
+  json.add(F("mqtt_enabled"), config_mqtt_enabled());
+  json.add(F("mqtt_server"), mqtt_server);
+  json.add(F("mqtt_topic"), mqtt_topic);
+  json.add(F("mqtt_user"), mqtt_user);
+  configPassword(json, F("mqtt_pass"), mqtt_pass);
+  json.add(F("mqtt_solar"), mqtt_solar);
+  json.add(F("mqtt_grid_ie"), mqtt_grid_ie);
+  json.add(F("www_username"), www_username);
+  configPassword(json, F("www_password"), www_password);
+  json.add(F("ohm_enabled"), config_ohm_enabled());
+  json.endObject();
 
   response->setCode(200);
-  response->print(s);
   request->send(response);
 }
 
@@ -588,6 +657,9 @@ handleUpdate(AsyncWebServerRequest *request) {
     return;
   }
 
+  EvseSnapshot evse;
+  evse_snapshot_read(evse);
+
   String s = "{";
   s += "\"comm_sent\":" + String(comm_sent) + ",";
   s += "\"comm_success\":" + String(comm_success) + ",";
@@ -595,16 +667,16 @@ handleUpdate(AsyncWebServerRequest *request) {
   s += "\"espfree\":\"" + String(espfree) + "\",";
   s += "\"packets_sent\":\"" + String(packets_sent) + "\",";
   s += "\"packets_success\":\"" + String(packets_success) + "\",";
-  s += "\"amp\":" + amp + ",";
-  s += "\"pilot\":" + pilot + ",";
-  s += "\"temp1\":" + temp1 + ",";
-  s += "\"temp2\":" + temp2 + ",";
-  s += "\"temp3\":" + temp3 + ",";
-  s += "\"state\":" + String(state) + ",";
-  s += "\"elapsed\":" + String(elapsed) + ",";
+  s += "\"amp\":" + String(evse.get(EVSE_AMP)) + ",";
+  s += "\"pilot\":" + String(evse.get(EVSE_PILOT)) + ",";
+  s += "\"temp1\":" + String(evse.get(EVSE_TEMP1)) + ",";
+  s += "\"temp2\":" + String(evse.get(EVSE_TEMP2)) + ",";
+  s += "\"temp3\":" + String(evse.get(EVSE_TEMP3)) + ",";
+  s += "\"state\":" + String(evse.get(EVSE_STATE)) + ",";
+  s += "\"elapsed\":" + String(evse.get(EVSE_ELAPSED)) + ",";
   s += "\"estate\":\"" + estate + "\",";
-  s += "\"wattsec\":" + wattsec + ",";
-  s += "\"watthour\":" + watthour_total;
+  s += "\"wattsec\":" + String(evse.get(EVSE_WATTSEC)) + ",";
+  s += "\"watthour\":" + String(evse.get(EVSE_WATTHOUR));
   s += "}";
 
   response->setCode(200);
@@ -702,7 +774,7 @@ extern "C" uint32_t _SPIFFS_end;
 static int lastPercent = -1;
 
 void
-handleUpdateUpload(AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final)
+handleUpdateUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)
 {
   if(!index)
   {
@@ -769,6 +841,123 @@ handleUpdateUpload(AsyncWebServerRequest *request, String filename, size_t index
 
 String delayTimer = "0 0 0 0";
 
+// A /rapi request waiting for the EVSE to reply. The reply is sent from
+// the RAPI callback, the AsyncTCP callback that took the request doesn't
+// wait for it.
+struct RapiHttpRequest
+{
+  AsyncWebServerRequest *request;   // NULL once the client has gone
+  AsyncResponseStream *response;
+  String rapi;
+  bool json;
+  bool gd;
+  bool ff;
+};
+
+static void
+rapiRequestPage(AsyncResponseStream *response) {
+  response->print(F("<html><font size='20'><font color=006666>Open</font><b>EVSE</b></font><p>"
+                    "<b>Open Source Hardware</b><p>RAPI Command Sent<p>Common Commands:<p>"
+                    "Set Current - $SC XX<p>Set Service Level - $SL 1 - $SL 2 - $SL A<p>"
+                    "Get Real-time Current - $GG<p>Get Temperatures - $GP<p>"
+                    "<p>"
+                    "<form method='get' action='r'><label><b><i>RAPI Command:</b></i></label>"
+                    "<input id='rapi' name='rapi' length=32><p><input type='submit'></form>"));
+}
+
+static void
+rapiRequestPageEnd(AsyncResponseStream *response) {
+  response->print(F("<script type='text/javascript'>document.getElementById('rapi').focus();</script>"));
+  response->print(F("<p></html>\r\n\r\n"));
+}
+
+static void
+rapiRequestFinish(RapiHttpRequest *pending, int ret, String rapiString)
+{
+  AsyncWebServerRequest *request = pending->request;
+  AsyncResponseStream *response = pending->response;
+
+  // IMPROVE: handle other errors, eg timeout
+  if(0 == ret || 1 == ret)
+  {
+    // Fake $GD if not supported by firmware
+    if(0 == ret && pending->rapi.startsWith(F("$ST"))) {
+      delayTimer = pending->rapi.substring(4);
+    }
+    if(1 == ret && pending->gd) {
+      ret = 0;
+      rapiString = F("$OK ");
+      rapiString += delayTimer;
+    }
+
+    if(pending->json) {
+      JsonWriter json(*response);
+      json.beginObject();
+      json.add(F("cmd"), pending->rapi);
+      json.add(F("ret"), rapiString);
+      json.endObject();
+    } else {
+      response->print(pending->rapi);
+      response->print(F("<p>&gt;"));
+      response->print(rapiString);
+    }
+  }
+  if(false == pending->json) {
+    rapiRequestPageEnd(response);
+  }
+
+  delete pending;
+
+  if(request) {
+    request->onDisconnect(NULL);
+    response->setCode(200);
+    request->send(response);
+  } else {
+    delete response;
+  }
+}
+
+// The reply to the legacy $S form of a $FF, tried when the EVSE $NKs the
+// $FF and isn't yet known not to support it
+static void
+rapiRequestFallback(RapiHttpRequest *pending, const String &rapiString)
+{
+  DBUGF("Attempting legacy FF support");
+
+  String fallback = legacyFeatureCmd(pending->rapi);
+  DBUGF("Attempting %s", fallback.c_str());
+
+  String original = rapiString;
+  RapiSourceScope source(rapiSender, RAPI_SOURCE_HTTP);
+  int queued = rapi_cache_send(fallback, [pending, original](int ret, const String &reply) {
+    if(0 == ret) {
+      rapi_cap_set(RAPI_CAP_FF, false);
+      rapiRequestFinish(pending, 0, reply);
+    } else {
+      rapiRequestFinish(pending, 1, original);
+    }
+  });
+  if(RAPI_RESPONSE_QUEUED != queued) {
+    rapiRequestFinish(pending, 1, original);
+  }
+}
+
+static void
+rapiRequestReply(RapiHttpRequest *pending, int ret, const String &rapiString)
+{
+  if(0 == ret && (pending->gd || pending->ff)) {
+    rapi_cap_set(pending->gd ? RAPI_CAP_GD : RAPI_CAP_FF, true);
+  } else if(1 == ret && pending->gd) {
+    rapi_cap_set(RAPI_CAP_GD, false);
+  }
+
+  if(1 == ret && pending->ff && RAPI_CAP_UNKNOWN == rapi_cap(RAPI_CAP_FF)) {
+    rapiRequestFallback(pending, rapiString);
+  } else {
+    rapiRequestFinish(pending, ret, rapiString);
+  }
+}
+
 void
 handleRapi(AsyncWebServerRequest *request) {
   bool json = request->hasArg("json");
@@ -778,85 +967,222 @@ handleRapi(AsyncWebServerRequest *request) {
     return;
   }
 
-  String s;
-
   if(false == json) {
-    s = F("<html><font size='20'><font color=006666>Open</font><b>EVSE</b></font><p>"
-          "<b>Open Source Hardware</b><p>RAPI Command Sent<p>Common Commands:<p>"
-          "Set Current - $SC XX<p>Set Service Level - $SL 1 - $SL 2 - $SL A<p>"
-          "Get Real-time Current - $GG<p>Get Temperatures - $GP<p>"
-          "<p>"
-          "<form method='get' action='r'><label><b><i>RAPI Command:</b></i></label>"
-          "<input id='rapi' name='rapi' length=32><p><input type='submit'></form>");
+    rapiRequestPage(response);
+  }
+
+  if(false == request->hasArg("rapi")) {
+    if(false == json) {
+      rapiRequestPageEnd(response);
+    }
+    response->setCode(200);
+    request->send(response);
+    return;
+  }
+
+  RapiHttpRequest *pending = new RapiHttpRequest;
+  pending->request = request;
+  pending->response = response;
+  pending->rapi = request->arg("rapi");
+  pending->json = json;
+  pending->gd = pending->rapi.equals(F("$GD"));
+  pending->ff = pending->rapi.startsWith(F("$FF"));
+
+  // The reply is left for the RAPI callback to send, or to drop if the
+  // client goes first
+  request->onDisconnect([pending]() {
+    pending->request = NULL;
+  });
+
+  if(pending->gd && RAPI_CAP_UNSUPPORTED == rapi_cap(RAPI_CAP_GD)) {
+    // Known not to be supported, skip straight to faking it
+    rapiRequestFinish(pending, 1, String());
+    return;
+  }
+
+  bool legacy = pending->ff && RAPI_CAP_UNSUPPORTED == rapi_cap(RAPI_CAP_FF);
+  String cmd = legacy ? legacyFeatureCmd(pending->rapi) : pending->rapi;
+
+  RapiSourceScope source(rapiSender, RAPI_SOURCE_HTTP);
+  int queued = rapi_cache_send(cmd, [pending, legacy](int ret, const String &reply) {
+    if(legacy) {
+      rapiRequestFinish(pending, ret, reply);
+    } else {
+      rapiRequestReply(pending, ret, reply);
+    }
+  });
+  if(RAPI_RESPONSE_QUEUED != queued) {
+    rapiRequestFinish(pending, queued, String());
   }
+}
 
-  if (request->hasArg("rapi"))
+// -------------------------------------------------------------------
+// RAPI link statistics, per command and for the link as a whole
+// url: /rapi/stats
+// url: /rapi/stats?reset=1
+// -------------------------------------------------------------------
+void
+handleRapiStats(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response;
+  if(false == requestPreProcess(request, response)) {
+    return;
+  }
+
+  if(request->hasArg("reset") && isPositive(request->arg("reset"))) {
+    rapiSender.resetStats();
+  }
+
+  const RapiLinkStats &stats = rapiSender.getStats();
+
+  JsonWriter json(*response);
+  json.beginObject();
+  json.add(F("checksum"), stats.badChecksum);
+  json.add(F("sequence_id"), stats.badSequenceId);
+  json.add(F("unexpected"), stats.unexpected);
+  json.add(F("events"), stats.events);
+  json.beginArray(F("buckets_ms"));
+  for(int i = 0; i < RAPI_STATS_BUCKETS - 1; i++) {
+    json.value((unsigned int)RapiSender::latencyBucketMs(i));
+  }
+  json.endArray();
+  json.beginObject(F("commands"));
+  for(int i = 0; i < RAPI_STATS_MAX_COMMANDS; i++)
   {
-    String rapi = request->arg("rapi");
+    const RapiCommandStats &cmd = stats.commands[i];
+    if('\0' == cmd.cmd[0]) {
+      continue;
+    }
 
-    // BUG: Really we should do this in the main loop not here...
-    Serial.flush();
-    comm_sent++;
-    int ret = rapiSender.sendCmd(rapi.c_str());
+    char name[3] = { cmd.cmd[0], cmd.cmd[1], '\0' };
+    uint32_t responses = cmd.ok + cmd.nk + cmd.invalid + cmd.overflow;
+    json.key(name);
+    json.beginObject();
+    json.add(F("sent"), cmd.sent);
+    json.add(F("ok"), cmd.ok);
+    json.add(F("nk"), cmd.nk);
+    json.add(F("timeout"), cmd.timeout);
+    json.add(F("invalid"), cmd.invalid);
+    json.add(F("overflow"), cmd.overflow);
+    json.add(F("latency_mean"), responses > 0 ? cmd.latencyTotal / responses : 0);
+    json.add(F("latency_max"), cmd.latencyMax);
+    json.beginArray(F("latency"));
+    for(int b = 0; b < RAPI_STATS_BUCKETS; b++) {
+      json.value(cmd.latency[b]);
+    }
+    json.endArray();
+    json.endObject();
+  }
+  json.endObject();
+  json.beginObject(F("sources"));
+  for(int i = 0; i < RAPI_SOURCE_COUNT; i++)
+  {
+    const RapiSourceStats &source = stats.sources[i];
+    json.key(RapiSender::sourceName(i));
+    json.beginObject();
+    json.add(F("pending"), (unsigned int)rapiSender.getQueued(i));
+    json.add(F("queued"), source.queued);
+    json.add(F("rejected"), source.rejected);
+    json.add(F("delay_mean"), source.sent > 0 ? source.delayTotal / source.sent : 0);
+    json.add(F("delay_max"), source.delayMax);
+    json.endObject();
+  }
+  json.endObject();
+  json.endObject();
+
+  response->setCode(200);
+  request->send(response);
+}
 
-    // IMPROVE: handle other errors, eg timeout
-    if(0 == ret || 1 == ret)
+#ifdef ENABLE_RAPI_CAPTURE
+// -------------------------------------------------------------------
+// Burst capture of $GG (and $GS)
+// url: /rapi/capture
+// url: /rapi/capture?start=1&seconds=1&state=1
+// url: /rapi/capture?format=csv
+// url: /rapi/capture?format=bin
+// -------------------------------------------------------------------
+void
+handleRapiCapture(AsyncWebServerRequest *request) {
+  String format = request->arg("format");
+  if(format == "csv" || format == "bin")
+  {
+    if(false == requestAuthenticate(request)) {
+      return;
+    }
+
+    // Samples added while the download is running are left out
+    uint16_t count = rapi_capture_count();
+    AsyncWebServerResponse *response;
+    if(format == "bin")
     {
-      String rapiString = rapiSender.getResponse();
-      if(0 == ret) {
-        comm_success++;
-      }
+      response = request->beginResponse(String(F("application/octet-stream")),
+        rapi_capture_binary_size(count),
+        [count](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+          return rapi_capture_binary(buffer, maxLen, index, count);
+        });
+      response->addHeader(F("Content-Disposition"), F("attachment; filename=capture.bin"));
+    }
+    else
+    {
+      RapiCaptureCsv pos = { 0, 0 };
+      response = request->beginChunkedResponse(String(F("text/csv")),
+        [count, pos](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+          return rapi_capture_csv(buffer, maxLen, pos, count);
+        });
+      response->addHeader(F("Content-Disposition"), F("attachment; filename=capture.csv"));
+    }
+    if(enableCors) {
+      response->addHeader(F("Access-Control-Allow-Origin"), F("*"));
+    }
+    request->send(response);
+    return;
+  }
 
-      // Fake $GD if not supported by firmware
-      if(0 == ret && rapi.startsWith(F("$ST"))) {
-        delayTimer = rapi.substring(4);
-      }
-      if(1 == ret)
-      {
-        if(rapi.equals(F("$GD"))) {
-          ret = 0;
-          rapiString = F("$OK ");
-          rapiString += delayTimer;
-        }
-        else if (rapi.startsWith(F("$FF")))
-        {
-          DBUGF("Attempting legacy FF support");
-
-          String fallback = F("$S");
-          fallback += rapi.substring(4);
-
-          DBUGF("Attempting %s", fallback.c_str());
-
-          comm_sent++;
-          int ret = rapiSender.sendCmd(fallback.c_str());
-          if(0 == ret)
-          {
-            String rapiString = rapiSender.getResponse();
-            if(0 == ret) {
-              comm_success++;
-            }
-          }
-        }
-      }
+  AsyncResponseStream *response;
+  if(false == requestPreProcess(request, response)) {
+    return;
+  }
 
-      if (json) {
-        s = "{\"cmd\":\""+rapi+"\",\"ret\":\""+rapiString+"\"}";
-      } else {
-        s += rapi;
-        s += F("<p>&gt;");
-        s += rapiString;
-      }
+  response->setCode(200);
+  if(request->hasArg("start") && isPositive(request->arg("start")))
+  {
+    int seconds = request->hasArg("seconds") ? request->arg("seconds").toInt() : RAPI_CAPTURE_DEFAULT_SECONDS;
+    if(seconds < 1 || seconds > RAPI_CAPTURE_MAX_SECONDS) {
+      response->setCode(400);
+    } else if(false == rapi_capture_start(seconds, isPositive(request->arg("state")))) {
+      response->setCode(409);
     }
   }
-  if (false == json) {
-    s += F("<script type='text/javascript'>document.getElementById('rapi').focus();</script>");
-    s += F("<p></html>\r\n\r\n");
+
+  JsonWriter json(*response);
+  rapi_capture_status(json);
+  request->send(response);
+}
+#endif
+
+#ifdef ENABLE_RAPI_TRACE
+// -------------------------------------------------------------------
+// Download the RAPI serial trace, replay with bench/rapi_replay
+// url: /rapi/trace
+// url: /rapi/trace?clear=1
+// -------------------------------------------------------------------
+void
+handleRapiTrace(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response;
+  if(false == requestPreProcess(request, response, CONTENT_TYPE_TEXT)) {
+    return;
   }
 
+  RapiTrace &trace = rapiSender.getTrace();
   response->setCode(200);
-  response->print(s);
+  response->print(F("# RAPI trace, time (us) and > to or < from the EVSE\n"));
+  trace.dump(*response);
+  if(request->hasArg("clear") && isPositive(request->arg("clear"))) {
+    trace.clear();
+  }
   request->send(response);
 }
+#endif
 
 void handleNotFound(AsyncWebServerRequest *request)
 {
@@ -906,6 +1232,45 @@ void onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient *client, AwsEventTy
   }
 }
 
+#define ARRAY_LENGTH(x) (sizeof(x)/sizeof((x)[0]))
+
+// The API, sorted by path, see WebRouteHandler
+static constexpr WebRoute webRoutes[] PROGMEM = {
+  { "/apoff", HTTP_ANY, handleAPOff, NULL },
+  { "/config", HTTP_ANY, handleConfig, NULL },
+  { "/divertmode", HTTP_ANY, handleDivertMode, NULL },
+  { "/emoncms/describe", HTTP_ANY, handleDescribe, NULL },
+  { "/r", HTTP_ANY, handleRapi, NULL },
+  { "/rapi", HTTP_ANY, handleRapi, NULL },
+#ifdef ENABLE_RAPI_CAPTURE
+  { "/rapi/capture", HTTP_ANY, handleRapiCapture, NULL },
+#endif
+  { "/rapi/stats", HTTP_ANY, handleRapiStats, NULL },
+#ifdef ENABLE_RAPI_TRACE
+  { "/rapi/trace", HTTP_ANY, handleRapiTrace, NULL },
+#endif
+#ifdef ENABLE_LEGACY_API
+  { "/rapiupdate", HTTP_ANY, handleUpdate, NULL },
+#endif
+  { "/reset", HTTP_ANY, handleRst, NULL },
+  { "/restart", HTTP_ANY, handleRestart, NULL },
+  { "/saveadmin", HTTP_ANY, handleSaveAdmin, NULL },
+  { "/saveemoncms", HTTP_ANY, handleSaveEmoncms, NULL },
+  { "/savemqtt", HTTP_ANY, handleSaveMqtt, NULL },
+  { "/savenetwork", HTTP_ANY, handleSaveNetwork, NULL },
+  { "/saveohmkey", HTTP_ANY, handleSaveOhmkey, NULL },
+  { "/scan", HTTP_ANY, handleScan, NULL },
+  { "/status", HTTP_ANY, handleStatus, NULL },
+
+  // Simple Firmware Update Form
+  { "/update", HTTP_GET, handleUpdateGet, NULL },
+  { "/update", HTTP_POST, handleUpdatePost, handleUpdateUpload },
+};
+
+static_assert(web_routes_sorted(webRoutes, ARRAY_LENGTH(webRoutes)), "webRoutes must be sorted by path");
+
+static WebRouteHandler apiRoutes(webRoutes, ARRAY_LENGTH(webRoutes));
+
 void
 web_server_setup() {
 //  SPIFFS.begin(); // mount the fs
@@ -919,34 +1284,8 @@ web_server_setup() {
   server.addHandler(&ws);
   server.addHandler(&staticFile);
 
-  // Start server & server root html /
-  //server.on("/", handleHome);
-
-  // Handle status updates
-  server.on("/status", handleStatus);
-  server.on("/config", handleConfig);
-#ifdef ENABLE_LEGACY_API
-  server.on("/rapiupdate", handleUpdate);
-#endif
-
-  // Handle HTTP web interface button presses
-  server.on("/savenetwork", handleSaveNetwork);
-  server.on("/saveemoncms", handleSaveEmoncms);
-  server.on("/savemqtt", handleSaveMqtt);
-  server.on("/saveadmin", handleSaveAdmin);
-  server.on("/saveohmkey", handleSaveOhmkey);
-  server.on("/reset", handleRst);
-  server.on("/restart", handleRestart);
-  server.on("/rapi", handleRapi);
-  server.on("/r", handleRapi);
-  server.on("/scan", handleScan);
-  server.on("/apoff", handleAPOff);
-  server.on("/divertmode", handleDivertMode);
-  server.on("/emoncms/describe", handleDescribe);
-
-  // Simple Firmware Update Form
-  server.on("/update", HTTP_GET, handleUpdateGet);
-  server.on("/update", HTTP_POST, handleUpdatePost, handleUpdateUpload);
+  // The API, see webRoutes
+  server.addHandler(&apiRoutes);
 
   server.onNotFound(handleNotFound);
   server.begin();
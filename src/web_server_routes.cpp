@@ -0,0 +1,98 @@
+#if defined(ENABLE_DEBUG) && !defined(ENABLE_DEBUG_WEB)
+#undef ENABLE_DEBUG
+#endif
+
+#include <Arduino.h>
+
+#include "emonesp.h"
+#include "web_server_routes.h"
+
+// Compares the first len characters of url with a path in flash
+static int
+compareRoute(const char *url, size_t len, PGM_P path)
+{
+  int cmp = strncmp_P(url, path, len);
+  if(0 == cmp && '\0' != pgm_read_byte(path + len)) {
+    // The path is longer
+    cmp = -1;
+  }
+  return cmp;
+}
+
+WebRouteHandler::WebRouteHandler(const WebRoute *routes, size_t count) :
+  _routes(routes),
+  _count(count)
+{
+}
+
+// The route for the URL, else for the nearest path the URL is under, eg
+// /rapi for /rapi/foo
+bool WebRouteHandler::_find(AsyncWebServerRequest *request, WebRoute *route)
+{
+  const char *url = request->url().c_str();
+  size_t len = request->url().length();
+
+  while(len > 0)
+  {
+    // The first route with the path
+    size_t low = 0;
+    size_t high = _count;
+    while(low < high)
+    {
+      size_t mid = (low + high) / 2;
+      if(compareRoute(url, len, _routes[mid].path) > 0) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+
+    // Then the one for the method, the routes for a path are together
+    for(size_t i = low; i < _count && 0 == compareRoute(url, len, _routes[i].path); i++)
+    {
+      if(pgm_read_byte(&_routes[i].method) & request->method())
+      {
+        memcpy_P(route, &_routes[i], sizeof(WebRoute));
+        DBUGF("Route %s for %s", route->path, url);
+        return true;
+      }
+    }
+
+    // Up to the parent
+    while(len > 0 && '/' != url[--len]) {
+    }
+  }
+
+  return false;
+}
+
+bool WebRouteHandler::canHandle(AsyncWebServerRequest *request)
+{
+  WebRoute route;
+  if(_find(request, &route)) {
+    // The headers are all kept, as for a handler server.on() adds
+    request->addInterestingHeader("ANY");
+    return true;
+  }
+  return false;
+}
+
+// The route is found again rather than kept in request->_tempObject, the
+// request frees that if the client goes away part way through an upload
+void WebRouteHandler::handleRequest(AsyncWebServerRequest *request)
+{
+  WebRoute route;
+  if(_find(request, &route)) {
+    route.onRequest(request);
+  } else {
+    request->send(404);
+  }
+}
+
+void WebRouteHandler::handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)
+{
+  WebRoute route;
+  if(_find(request, &route) && route.onUpload) {
+    route.onUpload(request, filename, index, data, len, final);
+  }
+}
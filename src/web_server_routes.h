@@ -0,0 +1,58 @@
+#ifndef _EMONESP_WEB_SERVER_ROUTES_H
+#define _EMONESP_WEB_SERVER_ROUTES_H
+
+#include <ESPAsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+
+// Longest path a route can have, with the terminating NUL
+#define WEB_ROUTE_PATH_MAX 20
+
+typedef void (*WebRouteRequestHandler)(AsyncWebServerRequest *request);
+typedef void (*WebRouteUploadHandler)(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final);
+
+// A handler for the requests to a path, as server.on() would add. The path
+// is kept in the route so a table of them is all in flash.
+struct WebRoute
+{
+  char path[WEB_ROUTE_PATH_MAX];
+  WebRequestMethodComposite method;
+  WebRouteRequestHandler onRequest;
+  WebRouteUploadHandler onUpload;     // NULL if the route takes no uploads
+};
+
+// For checking a table is sorted at compile time:
+//   static_assert(web_routes_sorted(routes, ARRAY_LENGTH(routes)), "...");
+constexpr int
+web_route_compare(const char *a, const char *b) {
+  return *a != *b ? ((uint8_t)*a < (uint8_t)*b ? -1 : 1) :
+         '\0' == *a ? 0 : web_route_compare(a + 1, b + 1);
+}
+
+constexpr bool
+web_routes_sorted(const WebRoute *routes, size_t count) {
+  return count < 2 ||
+         (web_route_compare(routes[0].path, routes[1].path) <= 0 &&
+          web_routes_sorted(routes + 1, count - 1));
+}
+
+// Finds the route for a request with a binary search of a table in flash,
+// sorted by path, so there is one handler and no allocation however many
+// routes there are. Like server.on() a route also handles everything under
+// its path, the longest match wins, and a path can have a route for each
+// method.
+class WebRouteHandler: public AsyncWebHandler
+{
+  private:
+    const WebRoute *_routes;
+    size_t _count;
+
+    bool _find(AsyncWebServerRequest *request, WebRoute *route);
+  public:
+    WebRouteHandler(const WebRoute *routes, size_t count);
+    virtual bool canHandle(AsyncWebServerRequest *request) override final;
+    virtual void handleRequest(AsyncWebServerRequest *request) override final;
+    virtual void handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final) override final;
+    virtual bool isRequestHandlerTrivial() override final { return false; }
+};
+
+#endif // _EMONESP_WEB_SERVER_ROUTES_H
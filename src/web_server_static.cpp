@@ -10,49 +10,187 @@
 #include "config.h"
 #include "wifi.h"
 
-// Static files
+// Static files, the text files are kept gzipped. The uncompressed copies
+// are only needed for clients that don't accept gzip.
+#ifdef ENABLE_STATIC_IDENTITY
+#define STATIC_FILE_IDENTITY(content) content, sizeof(content) - 1
+#else
+#define STATIC_FILE_IDENTITY(content) NULL, 0
+#endif
+#define STATIC_FILE_GZIP(content)     content, sizeof(content) - 1
+
 #include "web_static/web_server_static_files.h"
 
 #define ARRAY_LENGTH(x) (sizeof(x)/sizeof((x)[0]))
 
-#define IS_ALIGNED(x)   (0 == ((uint32_t)(x) & 0x3))
+#define IS_ALIGNED(x)   (0 == ((uintptr_t)(x) & 0x3))
+
+// How long (s) browsers can use their copy of the scripts, styles and
+// images without asking if it is still current. Pages are always checked,
+// as they are what pick up a firmware update.
+#ifndef STATIC_CACHE_MAX_AGE
+#define STATIC_CACHE_MAX_AGE 86400
+#endif
+
+// Bytes copied out of flash for each add to the TCP connection, a full
+// segment (TCP_MSS) by default
+#ifndef STATIC_FILE_CHUNK_SIZE
+#define STATIC_FILE_CHUNK_SIZE 1460
+#endif
+
+#ifndef ASYNC_WRITE_FLAG_COPY
+#define ASYNC_WRITE_FLAG_COPY 0x01
+#endif
+
+// lwIP can't read from flash, so the file is copied a chunk at a time in to
+// here and lwIP copies it from here. The responses share it, it is only
+// used until add() returns.
+static uint32_t chunkBuffer[(STATIC_FILE_CHUNK_SIZE + 3) / 4];
 
 // Pages
 static const char _HOME_PAGE[] PROGMEM = "/home.html";
-#define HOME_PAGE FPSTR(_HOME_PAGE)
-
 static const char _WIFI_PAGE[] PROGMEM = "/wifi_portal.html";
-#define WIFI_PAGE FPSTR(_WIFI_PAGE)
 
 StaticFileWebHandler::StaticFileWebHandler()
 {
 }
 
+// staticFiles is sorted by name, see scripts/extra_script.py, and the names
+// are in flash so are compared where they are
 bool StaticFileWebHandler::_getFile(AsyncWebServerRequest *request, StaticFile **file)
 {
-  // Remove the found uri
-  String path = request->url();
-  if(path == "/") {
-    path = String(wifi_mode_is_ap_only() ? WIFI_PAGE : HOME_PAGE);
+  const char *path = request->url().c_str();
+  char page[sizeof(_WIFI_PAGE)];  // The longer of the two
+  if(0 == strcmp(path, "/")) {
+    strcpy_P(page, wifi_mode_is_ap_only() ? _WIFI_PAGE : _HOME_PAGE);
+    path = page;
   }
 
-  DBUGF("Looking for %s", path.c_str());
+  DBUGF("Looking for %s", path);
 
-  for(int i = 0; i < ARRAY_LENGTH(staticFiles); i++) {
-    if(path == staticFiles[i].filename)
+  size_t low = 0;
+  size_t high = ARRAY_LENGTH(staticFiles);
+  while(low < high)
+  {
+    size_t mid = (low + high) / 2;
+    int cmp = strcmp_P(path, staticFiles[mid].filename);
+    if(0 == cmp)
     {
-      DBUGF("Found %s %d@%p", staticFiles[i].filename, staticFiles[i].length, staticFiles[i].data);
+      DBUGF("Found %s %d@%p", path, staticFiles[mid].length, staticFiles[mid].data);
 
       if(file) {
-        *file = &staticFiles[i];
+        *file = &staticFiles[mid];
       }
       return true;
     }
+
+    if(cmp < 0) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
   }
 
   return false;
 }
 
+// No Accept-Encoding means any encoding will do, else gzip must be listed
+// and not with q=0
+bool StaticFileWebHandler::_acceptsGzip(AsyncWebServerRequest *request)
+{
+  AsyncWebHeader *header = request->getHeader("Accept-Encoding");
+  if(NULL == header) {
+    return true;
+  }
+
+  const char *p = header->value().c_str();
+  while(*p)
+  {
+    while(' ' == *p || ',' == *p) {
+      p++;
+    }
+    const char *coding = p;
+    while(*p && ',' != *p && ';' != *p && ' ' != *p) {
+      p++;
+    }
+    size_t len = p - coding;
+    bool match = (4 == len && 0 == strncasecmp(coding, "gzip", 4)) ||
+                 (1 == len && '*' == *coding);
+
+    // Parameters, only q matters
+    float q = 1;
+    while(*p && ',' != *p)
+    {
+      if(';' == *p) {
+        p++;
+        while(' ' == *p) {
+          p++;
+        }
+        if(('q' == *p || 'Q' == *p) && '=' == p[1]) {
+          q = atof(p + 2);
+        }
+      } else {
+        p++;
+      }
+    }
+
+    if(match) {
+      return q > 0;
+    }
+  }
+
+  return false;
+}
+
+// If-None-Match lists the ETags of the copies the browser has, or * for any
+bool StaticFileWebHandler::_notModified(AsyncWebServerRequest *request, const char *etag)
+{
+  AsyncWebHeader *header = request->getHeader("If-None-Match");
+  if(NULL == header) {
+    return false;
+  }
+
+  // The ETag is weak, so are compared without the W/
+  const char *tag = etag + 2;
+  size_t tagLen = strlen(tag);
+
+  const char *p = header->value().c_str();
+  while(*p)
+  {
+    while(' ' == *p || ',' == *p) {
+      p++;
+    }
+    if('*' == *p) {
+      return true;
+    }
+    if('W' == p[0] && '/' == p[1]) {
+      p += 2;
+    }
+    if(0 == strncmp(p, tag, tagLen) && (' ' == p[tagLen] || ',' == p[tagLen] || '\0' == p[tagLen])) {
+      return true;
+    }
+    while(*p && ',' != *p) {
+      p++;
+    }
+  }
+
+  return false;
+}
+
+static void
+addCacheHeaders(AsyncWebServerResponse *response, StaticFile *file, const char *etag)
+{
+  response->addHeader("ETag", etag);
+  if(_CONTENT_TYPE_HTML == file->type) {
+    response->addHeader("Cache-Control", "no-cache");
+  } else {
+    response->addHeader("Cache-Control", "max-age=" + String(STATIC_CACHE_MAX_AGE));
+  }
+  if(file->gzip) {
+    response->addHeader("Vary", "Accept-Encoding");
+  }
+}
+
 bool StaticFileWebHandler::canHandle(AsyncWebServerRequest *request)
 {
   StaticFile *file = NULL;
@@ -60,6 +198,10 @@ bool StaticFileWebHandler::canHandle(AsyncWebServerRequest *request)
       _getFile(request, &file))
   {
     request->_tempObject = file;
+
+    // The library only keeps the headers a handler asks for
+    request->addInterestingHeader("Accept-Encoding");
+    request->addInterestingHeader("If-None-Match");
     DBUGF("[StaticFileWebHandler::canHandle] TRUE");
     return true;
   }
@@ -85,20 +227,42 @@ void StaticFileWebHandler::handleRequest(AsyncWebServerRequest *request)
   if (file)
   {
     request->_tempObject = NULL;
-    AsyncWebServerResponse *response = new StaticFileResponse(200, file);
-    request->send(response);
+
+    // Weak, the same for the gzipped and uncompressed copies
+    char etag[16];
+    snprintf(etag, sizeof(etag), "W/\"%08x\"", file->etag);
+
+    bool gzip = NULL != file->gzip && _acceptsGzip(request);
+    if(_notModified(request, etag)) {
+      AsyncWebServerResponse *response = request->beginResponse(304);
+      addCacheHeaders(response, file, etag);
+      request->send(response);
+    } else if(gzip || NULL != file->data) {
+      AsyncWebServerResponse *response = new StaticFileResponse(200, file, gzip);
+      addCacheHeaders(response, file, etag);
+      request->send(response);
+    } else {
+      // Only the gzipped copy is in the firmware
+      AsyncWebServerResponse *response = request->beginResponse(406, CONTENT_TYPE_TEXT, F("gzip encoding required"));
+      response->addHeader("Vary", "Accept-Encoding");
+      request->send(response);
+    }
   } else {
     request->send(404);
   }
 }
 
-StaticFileResponse::StaticFileResponse(int code, StaticFile *content){
+StaticFileResponse::StaticFileResponse(int code, StaticFile *content, bool gzip){
   _code = code;
-  _content = content;
+  _data = gzip ? content->gzip : content->data;
+  _dataLength = gzip ? content->gzipLength : content->length;
   _contentType = String(FPSTR(content->type));
-  _contentLength = content->length;
-  ptr = content->data;
+  _contentLength = _dataLength;
+  ptr = _data;
   addHeader("Connection","close");
+  if(gzip) {
+    addHeader("Content-Encoding", "gzip");
+  }
 }
 
 size_t StaticFileResponse::write(AsyncWebServerRequest *request)
@@ -119,8 +283,11 @@ size_t StaticFileResponse::write(AsyncWebServerRequest *request)
     // How should failures to send be handled?
     request->client()->send();
   }
+
+  return total;
 }
 
+// Fills as much of the TCP window as it can take, up to a chunk per add
 size_t StaticFileResponse::writeData(AsyncWebServerRequest *request)
 {
   size_t space = request->client()->space();
@@ -137,30 +304,34 @@ size_t StaticFileResponse::writeData(AsyncWebServerRequest *request)
 
   if(length > 0 && space > 0)
   {
-    size_t written = 0;
-
-    bool aligned = RESPONSE_CONTENT == _state;
-    char buffer[128];
-    uint32_t copy = sizeof(buffer);
-    if(copy > length) {
-      copy = length;
-    }
+    size_t copy = length;
     if(copy > space) {
       copy = space;
     }
-    //DBUGF("%p: write %d@%p", request, copy, ptr);
-    if(IS_ALIGNED(ptr)) {
-      uint32_t *end = (uint32_t *)(ptr + copy);
-      for(uint32_t *src = (uint32_t *)ptr, *dst = (uint32_t *)buffer;
-          src < end; src++, dst++)
-      {
-        *dst = *src;
+
+    // The header is in RAM and can be added as is, the content is in flash
+    const char *data = ptr;
+    if(RESPONSE_CONTENT == _state)
+    {
+      if(copy > STATIC_FILE_CHUNK_SIZE) {
+        copy = STATIC_FILE_CHUNK_SIZE;
       }
-    } else {
-      memcpy_P(buffer, ptr, copy);
+
+      // Flash can be read a word at a time, chunkBuffer has room for the
+      // last word
+      if(IS_ALIGNED(ptr)) {
+        const uint32_t *end = (const uint32_t *)(ptr + copy);
+        uint32_t *dst = chunkBuffer;
+        for(const uint32_t *src = (const uint32_t *)ptr; src < end; src++, dst++) {
+          *dst = *src;
+        }
+      } else {
+        memcpy_P(chunkBuffer, ptr, copy);
+      }
+      data = (const char *)chunkBuffer;
     }
 
-    written = request->client()->add(buffer, copy);
+    size_t written = request->client()->add(data, copy, ASYNC_WRITE_FLAG_COPY);
     if(written > 0) {
       _writtenLength += written;
       ptr += written;
@@ -169,54 +340,14 @@ size_t StaticFileResponse::writeData(AsyncWebServerRequest *request)
       DBUGF("Failed to write data");
     }
 
-/*
-    bool aligned = RESPONSE_CONTENT == _state;
-    if(aligned && (!IS_ALIGNED(ptr) || length < 32))
-    {
-      char buffer[32];
-      uint32_t copy = sizeof(buffer) - ((uint32_t)ptr & 0x00000003); // byte aligned mask
-      if(copy > length) {
-        copy = length;
-      }
-      DBUGF("None aligned write %d@%p", copy, ptr);
-      memcpy_P(buffer, ptr, copy);
-
-      written = request->client()->write(buffer, copy);
-      if(written > 0) {
-        _writtenLength += written;
-        ptr += written;
-        length -= written;
-      } else {
-        DBUGF("Failed to write data");
-      }
-    }
-
-    if(!aligned || IS_ALIGNED(ptr))
-    {
-      size_t outLen = length;
-      if(outLen > space) {
-        outLen = space;
-      }
-      DBUGF("Aligned write %d@%p", outLen, ptr);
-      written = request->client()->write(ptr, outLen);
-      if(written > 0) {
-        _writtenLength += written;
-        ptr += written;
-        length -= written;
-      } else {
-        DBUGF("Failed to write data");
-      }
-    }
-*/
-
     if(0 == length)
     {
       switch(_state)
       {
         case RESPONSE_HEADERS:
           _state = RESPONSE_CONTENT;
-          ptr = _content->data;
-          length = _content->length;
+          ptr = _data;
+          length = _dataLength;
           break;
         case RESPONSE_CONTENT:
           _state = RESPONSE_WAIT_ACK;
@@ -243,5 +374,11 @@ void StaticFileResponse::_respond(AsyncWebServerRequest *request){
 
 size_t StaticFileResponse::_ack(AsyncWebServerRequest *request, size_t len, uint32_t time){
   _ackedLength += len;
-  return write(request);
+  size_t written = write(request);
+
+  // Finished once all of it is acked, so the request can be freed
+  if(RESPONSE_WAIT_ACK == _state && _ackedLength >= _writtenLength) {
+    _state = RESPONSE_END;
+  }
+  return written;
 }
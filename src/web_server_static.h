@@ -8,15 +8,20 @@
 struct StaticFile
 {
   const char *filename;
-  const char *data;
+  const char *data;           // NULL if only the gzipped copy is kept
   size_t length;
+  const char *gzip;           // NULL if gzip does not make it smaller
+  size_t gzipLength;
   const char *type;
+  uint32_t etag;              // Hash of the content
 };
 
 class StaticFileWebHandler: public AsyncWebHandler
 {
   private:
     bool _getFile(AsyncWebServerRequest *request, StaticFile **file = NULL);
+    bool _acceptsGzip(AsyncWebServerRequest *request);
+    bool _notModified(AsyncWebServerRequest *request, const char *etag);
   protected:
   public:
     StaticFileWebHandler();
@@ -28,7 +33,8 @@ class StaticFileResponse: public AsyncWebServerResponse
 {
   private:
     String _header;
-    StaticFile *_content;
+    const char *_data;
+    size_t _dataLength;
 
     const char *ptr;
     size_t length;
@@ -37,7 +43,7 @@ class StaticFileResponse: public AsyncWebServerResponse
     size_t write(AsyncWebServerRequest *request);
 
   public:
-    StaticFileResponse(int code, StaticFile *file);
+    StaticFileResponse(int code, StaticFile *file, bool gzip);
     void _respond(AsyncWebServerRequest *request);
     size_t _ack(AsyncWebServerRequest *request, size_t len, uint32_t time);
     bool _sourceValid() const { return true; }
@@ -1,2 +1,37 @@
-static const char CONTENT_ASSETS_JS[] PROGMEM = 
+static const char CONTENT_ASSETS_JS[] PROGMEM __attribute__((aligned(4))) = 
   "!function(t){var r={};function o(e){if(r[e])return r[e].exports;var n=r[e]={i:e,l:!1,exports:{}};return t[e].call(n.exports,n,n.exports,o),n.l=!0,n.exports}o.m=t,o.c=r,o.d=function(e,n,t){o.o(e,n)||Object.defineProperty(e,n,{enumerable:!0,get:t})},o.r=function(e){\"undefined\"!=typeof Symbol&&Symbol.toStringTag&&Object.defineProperty(e,Symbol.toStringTag,{value:\"Module\"}),Object.defineProperty(e,\"__esModule\",{value:!0})},o.t=function(n,e){if(1&e&&(n=o(n)),8&e)return n;if(4&e&&\"object\"==typeof n&&n&&n.__esModule)return n;var t=Object.create(null);if(o.r(t),Object.defineProperty(t,\"default\",{enumerable:!0,value:n}),2&e&&\"string\"!=typeof n)for(var r in n)o.d(t,r,function(e){return n[e]}.bind(null,r));return t},o.n=function(e){var n=e&&e.__esModule?function(){return e.default}:function(){return e};return o.d(n,\"a\",n),n},o.o=function(e,n){return Object.prototype.hasOwnProperty.call(e,n)},o.p=\"\",o(o.s=0)}([function(e,n,t){\"use strict\";t.r(n);t(1),t(2),t(3),t(4),t(5)},function(e,n,t){},function(e,n,t){e.exports=t.p+\"emoncms.jpg\"},function(e,n,t){e.exports=t.p+\"favicon-16x16.png\"},function(e,n,t){e.exports=t.p+\"favicon-32x32.png\"},function(e,n,t){e.exports=t.p+\"ohm.jpg\"}]);\n";
+static const char CONTENT_ASSETS_JS_GZ[] PROGMEM __attribute__((aligned(4))) = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x95, 0x53, 0xdb, 0x6e, 0xdb, 0x30, 
+  0x0c, 0x7d, 0xdf, 0x57, 0x38, 0x7a, 0x30, 0x2c, 0x4c, 0x13, 0x72, 0xe9, 0x8a, 0xc1, 0x86, 0xb0, 
+  0x2f, 0x18, 0x3a, 0xa0, 0x7b, 0x2b, 0x8a, 0xc2, 0x71, 0xe8, 0xd4, 0x85, 0x4d, 0x19, 0xb2, 0xdc, 
+  0x25, 0x70, 0xfd, 0xef, 0xa3, 0x7c, 0x4d, 0xd3, 0x06, 0xed, 0x00, 0x83, 0x96, 0x29, 0x1e, 0xf2, 
+  0xf0, 0x90, 0x5e, 0xa4, 0x35, 0x26, 0x36, 0xd3, 0x18, 0x58, 0xde, 0x3c, 0xc7, 0xc6, 0x33, 0xaa, 
+  0x69, 0xa3, 0xd1, 0xe9, 0xe9, 0x00, 0x78, 0x93, 0xa5, 0x81, 0xb9, 0x83, 0x7b, 0x6e, 0xc0, 0xd6, 
+  0x06, 0x3d, 0x77, 0x96, 0x70, 0x28, 0xb5, 0xb1, 0x55, 0xe4, 0x20, 0xa8, 0x9c, 0x4b, 0x35, 0x59, 
+  0x08, 0x22, 0x0f, 0x17, 0x2b, 0x31, 0x5c, 0x86, 0x4d, 0xdb, 0x46, 0x03, 0xc8, 0x3a, 0x50, 0x12, 
+  0xe7, 0x79, 0x80, 0x23, 0x56, 0xa0, 0x98, 0xcf, 0x9a, 0xd3, 0x47, 0xae, 0x16, 0xcb, 0xd9, 0xd7, 
+  0x6a, 0x59, 0x28, 0x2b, 0xb4, 0x4c, 0x94, 0x21, 0xbb, 0x53, 0x13, 0x55, 0x20, 0x28, 0xd1, 0xd5, 
+  0x52, 0xbb, 0x23, 0x7f, 0x79, 0xb9, 0xd9, 0x3e, 0x41, 0x62, 0xe5, 0x0e, 0xd2, 0x0c, 0xe1, 0xb7, 
+  0xd1, 0x25, 0x18, 0x7b, 0xec, 0xc2, 0x1a, 0xc0, 0xba, 0x00, 0x13, 0x6f, 0x73, 0x08, 0x29, 0xf9, 
+  0x1e, 0x6c, 0x68, 0x5b, 0xde, 0x52, 0x3e, 0x73, 0x92, 0x8f, 0x37, 0xac, 0xc6, 0x1e, 0xbd, 0x63, 
+  0x0b, 0x65, 0x8f, 0x25, 0xe8, 0xd4, 0xbb, 0x3d, 0x16, 0x5b, 0x9d, 0xfb, 0x7e, 0xff, 0x96, 0x56, 
+  0xdf, 0x5a, 0x93, 0xe1, 0xfe, 0x4f, 0xbc, 0xf7, 0xfd, 0x4b, 0x15, 0xdf, 0xc6, 0x0a, 0x92, 0x35, 
+  0xaf, 0x21, 0x64, 0xbf, 0xf4, 0xae, 0xce, 0x81, 0xb5, 0x5c, 0x5c, 0x02, 0xb3, 0x87, 0x07, 0xa8, 
+  0x86, 0xb0, 0x11, 0xb6, 0x58, 0xf6, 0x74, 0xed, 0x4c, 0x17, 0x45, 0x3f, 0x94, 0x95, 0x0f, 0xbe, 
+  0x1f, 0xa0, 0xd2, 0x01, 0x72, 0x2e, 0x7e, 0xf8, 0x30, 0x4e, 0x08, 0x23, 0xba, 0xbd, 0x72, 0xb7, 
+  0x4c, 0x77, 0xa5, 0x98, 0x1a, 0x7b, 0x42, 0xdf, 0x77, 0x8f, 0x9c, 0x2b, 0xcd, 0x20, 0x37, 0x4b, 
+  0xab, 0x06, 0x72, 0x89, 0x81, 0xd8, 0x42, 0x80, 0x75, 0x9e, 0x73, 0x97, 0x8e, 0x04, 0xa3, 0x15, 
+  0xb9, 0x40, 0xdd, 0x0a, 0x46, 0x9e, 0xb8, 0xce, 0x2d, 0x3b, 0x57, 0xbc, 0xef, 0x02, 0xa9, 0xeb, 
+  0x75, 0x47, 0xa8, 0xea, 0x74, 0x99, 0x45, 0x46, 0x9e, 0x6a, 0x13, 0x74, 0x9b, 0xe7, 0x65, 0xc4, 
+  0x82, 0xd3, 0xa4, 0x29, 0x9f, 0x11, 0xa7, 0xd3, 0x19, 0x29, 0xd2, 0x12, 0xb5, 0x72, 0x9b, 0xe1, 
+  0xae, 0xe3, 0x25, 0x0c, 0xe7, 0xd3, 0x7e, 0x39, 0x8d, 0xf0, 0xd5, 0x48, 0xfb, 0xd5, 0xa4, 0x9a, 
+  0x70, 0xd2, 0xed, 0xcf, 0x29, 0x62, 0xca, 0x0a, 0x72, 0xe0, 0xde, 0x86, 0xef, 0x5c, 0x4e, 0x1b, 
+  0xec, 0x78, 0xa1, 0x60, 0x31, 0xa3, 0x8d, 0x13, 0xe8, 0xca, 0xe9, 0x57, 0x1b, 0x39, 0x41, 0x06, 
+  0x89, 0x4a, 0xa3, 0xad, 0x76, 0x4d, 0xca, 0xc7, 0xb8, 0xba, 0xf9, 0x8b, 0xa3, 0x58, 0xfd, 0x5f, 
+  0xe0, 0x00, 0x2e, 0x47, 0xa9, 0x18, 0x13, 0x9a, 0xd4, 0xad, 0xd4, 0x92, 0xb7, 0xc1, 0xdd, 0xf9, 
+  0x8e, 0xb3, 0xba, 0x02, 0xcf, 0x69, 0x46, 0x43, 0x8c, 0x2c, 0xcd, 0x00, 0x79, 0x64, 0x83, 0x15, 
+  0x17, 0x36, 0x58, 0x3b, 0xb3, 0x71, 0xe6, 0xca, 0x99, 0xef, 0x94, 0xef, 0x1c, 0xfd, 0xd6, 0x03, 
+  0xe3, 0xdf, 0xa5, 0x88, 0xe1, 0x57, 0x06, 0x85, 0xc6, 0xa4, 0xa8, 0xe4, 0x53, 0xb9, 0x67, 0x1f, 
+  0x06, 0xa7, 0xf1, 0x73, 0x96, 0x68, 0xfc, 0xb6, 0xba, 0x3e, 0xac, 0xae, 0x65, 0x89, 0xff, 0x01, 
+  0xd9, 0xac, 0x0f, 0x9b, 0xf5, 0xe7, 0x20, 0xfa, 0xb1, 0xe8, 0xe9, 0xdc, 0xf3, 0xe8, 0xcb, 0x3f, 
+  0xb8, 0xe9, 0xd1, 0xf6, 0x9f, 0x04, 0x00, 0x00, 0x00 };
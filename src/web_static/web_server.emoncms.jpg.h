@@ -1,4 +1,4 @@
-static const char CONTENT_EMONCMS_JPG[] PROGMEM = {
+static const char CONTENT_EMONCMS_JPG[] PROGMEM __attribute__((aligned(4))) = {
   0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x01, 0x00, 0x48, 
   0x00, 0x48, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x80, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00, 0x4d, 0x4d, 
   0x00, 0x2a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x01, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 
@@ -157,3 +157,132 @@ static const char CONTENT_EMONCMS_JPG[] PROGMEM = {
   0x04, 0x78, 0x86, 0x20, 0x2d, 0x23, 0x9e, 0xf5, 0x0f, 0x9d, 0xa3, 0x86, 0x4e, 0x31, 0x72, 0x61, 
   0x3f, 0xcb, 0x08, 0x7b, 0x92, 0x59, 0x79, 0xe7, 0xc8, 0x53, 0x36, 0x77, 0x0a, 0x33, 0x1a, 0xe0, 
   0x75, 0x7a, 0xac, 0xab, 0xe5, 0x7f, 0x43, 0x5f, 0x9f, 0xff, 0xd9, 0x00 };
+static const char CONTENT_EMONCMS_JPG_GZ[] PROGMEM __attribute__((aligned(4))) = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x95, 0x55, 0x79, 0x5c, 0x53, 0x57, 
+  0x16, 0xbe, 0x2f, 0x0b, 0x4b, 0xc2, 0xf2, 0x12, 0x02, 0x02, 0x32, 0x25, 0x2c, 0x82, 0x86, 0x21, 
+  0x0b, 0x8a, 0x9a, 0x8c, 0x10, 0x91, 0x1d, 0x0d, 0xb2, 0xba, 0x00, 0x56, 0x1f, 0x10, 0x4c, 0x14, 
+  0x42, 0x36, 0x87, 0x80, 0xd6, 0x12, 0xa6, 0x82, 0x22, 0xb2, 0x59, 0xa1, 0x3a, 0x0e, 0x8b, 0x08, 
+  0x1d, 0x40, 0x69, 0x55, 0x14, 0x8b, 0x8a, 0x42, 0xb1, 0x5a, 0x57, 0x50, 0x51, 0x11, 0x41, 0x51, 
+  0x29, 0xa3, 0x52, 0x35, 0x28, 0x83, 0x75, 0xea, 0xa4, 0x37, 0x10, 0x82, 0x75, 0xfa, 0xcf, 0xdc, 
+  0xbc, 0xfc, 0x72, 0xee, 0xd9, 0xbe, 0x7b, 0xcf, 0x77, 0xce, 0x8b, 0xf6, 0xae, 0xf6, 0x21, 0x40, 
+  0xc3, 0x82, 0x42, 0x83, 0x00, 0x82, 0x20, 0x20, 0x04, 0x7e, 0x80, 0x76, 0x10, 0x64, 0x07, 0xaa, 
+  0xc4, 0x29, 0x00, 0x08, 0x04, 0x80, 0x01, 0x00, 0x30, 0x01, 0x04, 0xc4, 0x1e, 0x10, 0xa1, 0x84, 
+  0xc0, 0xaf, 0x2f, 0x32, 0xd3, 0x20, 0x07, 0x21, 0xb3, 0x01, 0x7e, 0x42, 0xc6, 0x01, 0x90, 0x27, 
+  0x06, 0x04, 0xbd, 0x3e, 0x1c, 0x4c, 0xae, 0x10, 0xfd, 0x7e, 0xf2, 0x17, 0x5f, 0x0c, 0x80, 0x31, 
+  0x94, 0x08, 0x6c, 0x2f, 0x0e, 0xbb, 0x6a, 0x4a, 0xe6, 0xb0, 0xd9, 0x55, 0xc8, 0x64, 0x16, 0xad, 
+  0x76, 0x32, 0x4c, 0x3b, 0x88, 0x93, 0x8a, 0x94, 0x4a, 0x29, 0x8f, 0xc5, 0x92, 0x28, 0x98, 0x58, 
+  0x72, 0x7a, 0xa2, 0x90, 0x99, 0x94, 0x9e, 0xc6, 0x52, 0x61, 0x52, 0x16, 0x87, 0xc9, 0x66, 0x81, 
+  0x45, 0x7c, 0x95, 0x14, 0x4b, 0xda, 0x28, 0x54, 0xd2, 0x13, 0x85, 0xeb, 0xc5, 0x12, 0x1f, 0xf7, 
+  0x97, 0xa7, 0xce, 0xba, 0xd3, 0xc5, 0xc9, 0x3e, 0xee, 0x2b, 0xbd, 0x05, 0x6c, 0x81, 0xd4, 0x5f, 
+  0x28, 0x12, 0x87, 0x64, 0xc9, 0x85, 0xd1, 0x59, 0xe1, 0x31, 0x49, 0x59, 0x1b, 0x93, 0xb8, 0xc9, 
+  0xee, 0x7c, 0x5f, 0xd2, 0x22, 0x15, 0x4f, 0x95, 0x26, 0x4d, 0x13, 0x2a, 0x31, 0xba, 0x2a, 0x2d, 
+  0x55, 0xa2, 0xe0, 0xa9, 0x7c, 0xdc, 0x27, 0x92, 0xf3, 0xa0, 0xac, 0x53, 0xb3, 0xdc, 0xa1, 0x93, 
+  0x3c, 0x39, 0x85, 0x17, 0x15, 0x10, 0xa4, 0x77, 0x81, 0x3b, 0x1f, 0x77, 0xfd, 0x59, 0x32, 0x32, 
+  0x32, 0x98, 0x19, 0x73, 0x99, 0xe9, 0xf2, 0xf5, 0x2c, 0x0e, 0x97, 0xcb, 0x65, 0xb1, 0xbd, 0x58, 
+  0x5e, 0x5e, 0x9e, 0xd0, 0xc3, 0x53, 0x91, 0x29, 0x51, 0x62, 0x2a, 0x4f, 0x89, 0xc2, 0x05, 0x66, 
+  0x20, 0xd1, 0x27, 0x72, 0x04, 0x08, 0x15, 0x49, 0x72, 0xb1, 0x54, 0x29, 0x4e, 0x97, 0xe8, 0x73, 
+  0x09, 0x61, 0x51, 0x0d, 0xc9, 0x7e, 0x77, 0x31, 0x9d, 0x65, 0xe2, 0x66, 0x30, 0x9c, 0x4e, 0x5f, 
+  0xa4, 0xdb, 0xf2, 0x56, 0x45, 0x09, 0x15, 0xe9, 0xa9, 0x9b, 0x74, 0xf1, 0xbe, 0x0b, 0xbc, 0x16, 
+  0xb1, 0xfe, 0x47, 0x69, 0xf0, 0x5c, 0xfd, 0x47, 0x9e, 0xab, 0xff, 0xc8, 0x73, 0x5a, 0x17, 0x2b, 
+  0x11, 0x2b, 0x7d, 0x43, 0x25, 0x49, 0x22, 0xbd, 0xfb, 0x47, 0x16, 0x43, 0x84, 0xae, 0x11, 0x56, 
+  0x08, 0xe5, 0x0a, 0x5d, 0x1a, 0x9d, 0x4c, 0xd7, 0x6f, 0xe8, 0x5e, 0x4c, 0x8e, 0x3e, 0xf4, 0x43, 
+  0x17, 0x43, 0x5c, 0x50, 0x2a, 0xa6, 0x10, 0x45, 0x88, 0x55, 0x53, 0x86, 0xa9, 0xbd, 0x21, 0x1e, 
+  0xde, 0x56, 0x1f, 0xff, 0xb1, 0xab, 0x21, 0x87, 0x7f, 0x7a, 0x6a, 0xba, 0x3c, 0x1a, 0x12, 0x2d, 
+  0xf4, 0x8d, 0x95, 0x24, 0x61, 0xa9, 0xe2, 0x44, 0x39, 0xa6, 0x14, 0x26, 0xeb, 0xc3, 0x3e, 0xb0, 
+  0xc2, 0x8a, 0xb3, 0x3e, 0x2a, 0x39, 0xa4, 0x61, 0x52, 0x07, 0xa9, 0x84, 0xa4, 0xb2, 0x0c, 0xd4, 
+  0xc3, 0x8d, 0xa1, 0x79, 0x84, 0x12, 0xd8, 0x31, 0x72, 0x5d, 0x6b, 0x68, 0xfb, 0x80, 0x3f, 0xc0, 
+  0xe3, 0x70, 0xba, 0x07, 0x2e, 0x02, 0x7c, 0x88, 0x26, 0x44, 0x22, 0x81, 0x40, 0x24, 0x19, 0x1b, 
+  0x1b, 0x99, 0x98, 0x91, 0xcc, 0xcc, 0xc8, 0x24, 0x32, 0xd9, 0xdc, 0x82, 0x8a, 0x9a, 0x5b, 0x50, 
+  0x2c, 0xc8, 0x64, 0xd4, 0x06, 0xa5, 0x58, 0xd1, 0xac, 0xad, 0xad, 0xcd, 0x2c, 0x67, 0xd8, 0xda, 
+  0xd0, 0x6c, 0xa9, 0x34, 0x6b, 0x9a, 0x2e, 0x09, 0x82, 0x87, 0x31, 0x04, 0xa2, 0x29, 0x91, 0x68, 
+  0x4a, 0x33, 0x27, 0x9b, 0xd3, 0xfe, 0xef, 0xa5, 0xed, 0x00, 0x14, 0x13, 0x38, 0x76, 0x2c, 0x3c, 
+  0x42, 0x01, 0x38, 0x0a, 0x82, 0xa7, 0x20, 0xda, 0x4e, 0x60, 0x0f, 0x00, 0x0e, 0x8f, 0x20, 0xe0, 
+  0x83, 0x65, 0x8c, 0x27, 0x18, 0x11, 0x4d, 0xa0, 0xcd, 0x0e, 0xea, 0x3f, 0xb2, 0x41, 0x13, 0x42, 
+  0xd4, 0xde, 0x03, 0x66, 0x78, 0x38, 0x99, 0x28, 0x1e, 0x85, 0xb3, 0x35, 0x16, 0x6c, 0xda, 0xf4, 
+  0x9a, 0x3c, 0x0f, 0x5d, 0x3a, 0x93, 0x54, 0xdb, 0xe2, 0x48, 0x0e, 0x2f, 0xaf, 0xa8, 0xdc, 0xd3, 
+  0xd7, 0x9d, 0x52, 0xfe, 0x6e, 0x59, 0xfb, 0xf6, 0x01, 0xde, 0xb1, 0xd6, 0x04, 0x3b, 0xc9, 0x7b, 
+  0xd2, 0x5f, 0xc5, 0xcc, 0x66, 0xee, 0xdd, 0xc4, 0xbd, 0x95, 0xf9, 0xf7, 0xdf, 0x6c, 0xbe, 0xd2, 
+  0x5c, 0x32, 0x54, 0x53, 0x6a, 0xd1, 0xba, 0xe2, 0xa9, 0x57, 0xfd, 0x80, 0x94, 0xac, 0x90, 0x18, 
+  0x39, 0x08, 0x67, 0x9c, 0x83, 0xd3, 0xd9, 0x09, 0x5c, 0x50, 0x80, 0x10, 0x70, 0x08, 0x9e, 0x38, 
+  0x8d, 0x88, 0xe0, 0x08, 0x44, 0x60, 0x64, 0x4c, 0xa1, 0xd2, 0xac, 0xac, 0xe9, 0x4e, 0xce, 0x10, 
+  0xdc, 0x04, 0x9e, 0x09, 0x21, 0xe2, 0x2e, 0x9f, 0xe9, 0xbe, 0x96, 0xe9, 0xb2, 0x6c, 0x5f, 0x55, 
+  0xea, 0xf6, 0x6b, 0x35, 0xf7, 0xfb, 0x9f, 0xa5, 0x8c, 0x6d, 0xf8, 0xb6, 0xf1, 0xb9, 0xc7, 0x00, 
+  0x9d, 0xde, 0x56, 0xc1, 0xef, 0x76, 0x7c, 0x52, 0x57, 0xb4, 0xe1, 0x58, 0x63, 0x26, 0xb1, 0x7f, 
+  0x7c, 0xb7, 0x9f, 0xd0, 0xee, 0xe7, 0xbb, 0xd9, 0x2b, 0x42, 0xbe, 0x0a, 0x7f, 0x37, 0xb4, 0x56, 
+  0xf1, 0xb8, 0x67, 0xa4, 0xf5, 0xc9, 0x57, 0x8c, 0x93, 0x82, 0xaa, 0xb6, 0x39, 0x07, 0xae, 0x96, 
+  0x8e, 0x45, 0x97, 0x3c, 0x2c, 0x77, 0x08, 0x78, 0x2c, 0x62, 0x8a, 0x86, 0xfd, 0xcc, 0x0b, 0xe2, 
+  0x0e, 0x13, 0x50, 0xd2, 0xf1, 0x7e, 0x99, 0x47, 0xab, 0xb0, 0x29, 0xdb, 0x74, 0x68, 0x9b, 0x49, 
+  0xac, 0xa6, 0x6d, 0x2d, 0x3c, 0xd9, 0x2c, 0x0a, 0x40, 0x74, 0x0c, 0x4e, 0x9f, 0x0c, 0x56, 0x00, 
+  0x4f, 0x40, 0x29, 0x44, 0xaa, 0xb3, 0x15, 0xdd, 0x85, 0xcd, 0xf1, 0x8a, 0x54, 0x4f, 0x9c, 0x0d, 
+  0x56, 0x8c, 0x8f, 0x1c, 0x1b, 0xde, 0x55, 0xe9, 0x5c, 0xd3, 0x98, 0x93, 0x74, 0xfe, 0xfd, 0x9e, 
+  0x9b, 0x3e, 0x35, 0x66, 0xcb, 0xb9, 0x3f, 0x7a, 0x6c, 0x75, 0x2c, 0x6e, 0xce, 0xef, 0x75, 0xd5, 
+  0x2c, 0x7d, 0x9b, 0x77, 0x42, 0xb0, 0x63, 0xe3, 0x7e, 0xff, 0x2f, 0xdf, 0x89, 0x8a, 0xa5, 0x8c, 
+  0x35, 0x8c, 0xb0, 0xf0, 0x64, 0x49, 0xcc, 0xfa, 0x2b, 0x37, 0xfa, 0xde, 0xfc, 0xfd, 0xd4, 0xa6, 
+  0xa2, 0x1b, 0x34, 0xd9, 0x7c, 0xbf, 0xd9, 0xb6, 0x17, 0x0e, 0xeb, 0xca, 0x01, 0x41, 0x09, 0x90, 
+  0x79, 0xfc, 0xef, 0x40, 0x29, 0x04, 0x22, 0xea, 0x44, 0xb5, 0x82, 0x2f, 0x3b, 0x6c, 0x12, 0x12, 
+  0xa7, 0x83, 0xec, 0x2d, 0xbe, 0xa4, 0x11, 0x2c, 0x3f, 0x5f, 0xc6, 0x4f, 0x79, 0x61, 0x43, 0x13, 
+  0xc8, 0x5a, 0xea, 0x34, 0x8b, 0x99, 0xd9, 0xf1, 0x81, 0x1b, 0x4e, 0x1e, 0xe9, 0xdc, 0x5c, 0xf2, 
+  0xdf, 0x03, 0xdc, 0x7b, 0xfb, 0x6f, 0xe7, 0xf4, 0xd8, 0x64, 0x16, 0xf5, 0x07, 0xd6, 0x1f, 0x9b, 
+  0xad, 0x2c, 0xb4, 0x11, 0xd8, 0xee, 0x6a, 0xe8, 0x3b, 0xf9, 0xac, 0x56, 0x64, 0x35, 0x5a, 0x18, 
+  0x53, 0x58, 0xd0, 0x19, 0xc6, 0xff, 0x54, 0x77, 0x4f, 0x6f, 0xc8, 0x00, 0x4e, 0xd7, 0xa4, 0x64, 
+  0x03, 0x24, 0x0e, 0x0f, 0x08, 0x14, 0xaa, 0x15, 0xc7, 0x0f, 0xc2, 0xba, 0x44, 0xd2, 0x9c, 0xbd, 
+  0x62, 0x30, 0x99, 0xba, 0x84, 0xbe, 0xc4, 0x3f, 0x2a, 0xb1, 0x74, 0x77, 0xf5, 0x91, 0xf6, 0x6e, 
+  0x3d, 0x27, 0x46, 0x7c, 0x5c, 0xce, 0x0f, 0x45, 0xf3, 0x04, 0xa9, 0x0f, 0x6e, 0x74, 0x47, 0xbe, 
+  0x35, 0x7e, 0xe1, 0xb9, 0x8c, 0x71, 0x70, 0xac, 0x3c, 0xbf, 0xa8, 0x38, 0xff, 0xd2, 0x99, 0x40, 
+  0x8b, 0x43, 0x9a, 0xd0, 0xd1, 0x85, 0xe7, 0x92, 0x42, 0x8a, 0x03, 0xa1, 0xfd, 0xaa, 0x25, 0xb1, 
+  0xe0, 0xb8, 0xf3, 0x6a, 0xd2, 0xd1, 0xfa, 0xfc, 0x7b, 0x2e, 0xae, 0x66, 0x18, 0xeb, 0xcb, 0xf4, 
+  0x04, 0x47, 0x67, 0xb9, 0x7d, 0x01, 0xda, 0xa4, 0xbc, 0x64, 0x35, 0x46, 0xd9, 0xb7, 0x8c, 0xb1, 
+  0x66, 0x43, 0xf3, 0x77, 0x8a, 0xc5, 0x35, 0xfb, 0xbc, 0x76, 0xa4, 0xf4, 0x74, 0xb5, 0xe2, 0xaf, 
+  0xc6, 0x63, 0xd1, 0x3c, 0x9f, 0xbe, 0x07, 0x59, 0xb1, 0x57, 0xab, 0xc6, 0xfd, 0xce, 0x96, 0x47, 
+  0x87, 0x6b, 0x92, 0x2a, 0x4c, 0x5f, 0x74, 0x06, 0xfe, 0xb9, 0xac, 0xfd, 0xdc, 0xe3, 0x55, 0x7b, 
+  0xea, 0x66, 0x9d, 0x73, 0x4e, 0x3b, 0xd2, 0xd5, 0xfa, 0xab, 0x47, 0x72, 0x58, 0xf8, 0xd7, 0x84, 
+  0x9e, 0xda, 0x0a, 0xeb, 0x0e, 0x2b, 0x65, 0xf1, 0x8d, 0xa7, 0xa7, 0x65, 0x2a, 0x7c, 0xaf, 0xc3, 
+  0x89, 0xc1, 0xe1, 0xe8, 0xe7, 0x87, 0x97, 0x6c, 0xfb, 0x14, 0xcd, 0xdb, 0x87, 0xdd, 0x3a, 0xd1, 
+  0xdb, 0xb0, 0xff, 0x54, 0x07, 0x37, 0x34, 0xb1, 0xe9, 0x20, 0x75, 0x9b, 0x77, 0x57, 0xe4, 0xcf, 
+  0x76, 0x01, 0xf7, 0x1f, 0x9d, 0xa9, 0x36, 0x3f, 0xa8, 0xa9, 0xe3, 0xab, 0xe4, 0x6b, 0xde, 0xf4, 
+  0x89, 0xdb, 0x97, 0x38, 0x6b, 0xc6, 0x33, 0x13, 0x4b, 0x33, 0x30, 0xff, 0xc4, 0x2d, 0x0b, 0x9f, 
+  0x9f, 0xc6, 0x6e, 0xba, 0xc5, 0x64, 0xec, 0x08, 0xf9, 0xa9, 0xf1, 0x2d, 0x76, 0xc2, 0x4e, 0x50, 
+  0xd6, 0x47, 0xc3, 0xdf, 0x84, 0xc5, 0x72, 0x45, 0x21, 0x1f, 0x90, 0x1f, 0x38, 0x42, 0x06, 0x7e, 
+  0x28, 0x1c, 0x27, 0x3f, 0x75, 0x24, 0x26, 0x2b, 0x39, 0xd2, 0x4e, 0xaf, 0x7e, 0x35, 0x55, 0x1b, 
+  0x84, 0xef, 0x14, 0xe1, 0xbd, 0x2d, 0x6c, 0xd8, 0xba, 0x65, 0x4b, 0x73, 0x21, 0xef, 0x97, 0x57, 
+  0xcb, 0x34, 0xe6, 0x33, 0x85, 0x9a, 0xeb, 0x1d, 0x16, 0xc5, 0x01, 0xfd, 0xef, 0x4b, 0xc5, 0xe6, 
+  0x32, 0x9a, 0xcb, 0xf7, 0xf5, 0xc4, 0xff, 0x3c, 0xde, 0x1b, 0xbf, 0x99, 0x27, 0xf3, 0x99, 0x77, 
+  0x65, 0xa1, 0xa7, 0x43, 0x9f, 0xd1, 0xe9, 0x03, 0x9b, 0x2c, 0xd7, 0x79, 0x7f, 0xd2, 0x7d, 0x7c, 
+  0xff, 0xf9, 0x43, 0xf1, 0xef, 0x1e, 0xb9, 0xad, 0xea, 0x51, 0x6a, 0x01, 0x6d, 0xe4, 0x02, 0xc9, 
+  0xef, 0xf9, 0xa3, 0x15, 0xb7, 0x1c, 0xe3, 0x18, 0xe5, 0x3f, 0x5e, 0x39, 0xb1, 0x20, 0x96, 0x22, 
+  0x9f, 0x97, 0x7d, 0x6d, 0x74, 0xa3, 0xb8, 0xe8, 0x6f, 0x0d, 0xa3, 0x95, 0x6e, 0x91, 0x84, 0x88, 
+  0x2d, 0x3b, 0x7b, 0xe7, 0xf0, 0xc3, 0x8e, 0x0c, 0xd8, 0x9e, 0x7d, 0xe8, 0x7f, 0x34, 0xe5, 0x4e, 
+  0x9c, 0xfa, 0x93, 0xf1, 0x39, 0xd5, 0xbd, 0xde, 0xd7, 0xbe, 0x6d, 0xef, 0x61, 0x9a, 0x3b, 0x34, 
+  0x1e, 0xc5, 0x09, 0x9c, 0x52, 0x8f, 0x9e, 0x39, 0x1b, 0xfd, 0xcb, 0x8a, 0xbf, 0x9c, 0x4e, 0x1d, 
+  0xf1, 0xb4, 0xb9, 0xdc, 0xca, 0x4a, 0x54, 0x76, 0x31, 0x23, 0x44, 0x0b, 0x96, 0xe0, 0xb7, 0x0c, 
+  0x3c, 0x78, 0x3d, 0x35, 0xe0, 0x13, 0x7f, 0x9e, 0x68, 0xf0, 0xfb, 0x19, 0x94, 0x06, 0xfe, 0xc5, 
+  0x21, 0x51, 0xb1, 0xa9, 0x6b, 0xce, 0x72, 0x78, 0x6b, 0x27, 0xf8, 0xfe, 0xc0, 0xe1, 0x90, 0x0f, 
+  0xba, 0x12, 0x20, 0x14, 0x27, 0x8e, 0x5f, 0x24, 0xca, 0xc6, 0x4a, 0x64, 0xea, 0x57, 0x86, 0x31, 
+  0x40, 0x47, 0x13, 0x42, 0xd7, 0x35, 0xfc, 0x3b, 0xc2, 0x74, 0xf0, 0x49, 0x38, 0x37, 0xa7, 0xeb, 
+  0x29, 0x85, 0xfb, 0x5e, 0xb4, 0x34, 0x4e, 0x98, 0x1f, 0x97, 0x49, 0x6d, 0x99, 0xff, 0xe8, 0xfa, 
+  0xe7, 0x2e, 0xf3, 0x0a, 0x4a, 0xdd, 0xab, 0xdf, 0x74, 0x0c, 0xb7, 0x59, 0xca, 0x76, 0x8e, 0xe7, 
+  0xd0, 0xbe, 0xe8, 0x5b, 0xed, 0xf0, 0xaf, 0x54, 0xcc, 0xbe, 0x2b, 0xdf, 0x9e, 0x21, 0xaa, 0xb0, 
+  0x0a, 0x54, 0xaf, 0xcc, 0x80, 0x70, 0x8e, 0x14, 0x5d, 0xd3, 0x83, 0xe9, 0x1a, 0xeb, 0x8a, 0xac, 
+  0x83, 0x93, 0xb1, 0xd5, 0xd5, 0x25, 0x86, 0x01, 0x40, 0xfb, 0x22, 0xe6, 0x06, 0xd4, 0x9a, 0x6f, 
+  0x0d, 0x0b, 0x8c, 0xbe, 0xee, 0x3b, 0xc4, 0xb8, 0xc3, 0x4f, 0x61, 0xfc, 0x74, 0xe9, 0xfc, 0x83, 
+  0xcb, 0x57, 0x66, 0xdc, 0xc8, 0xe6, 0x92, 0xee, 0xec, 0xad, 0x75, 0x37, 0xf6, 0x09, 0xb3, 0xa5, 
+  0x5d, 0x06, 0xb9, 0x21, 0x02, 0xff, 0x84, 0xf2, 0xeb, 0xb7, 0xd1, 0x98, 0xc8, 0xdd, 0xd2, 0xa6, 
+  0x6b, 0x2f, 0x66, 0xb5, 0x20, 0xb9, 0x76, 0x9f, 0x39, 0xbd, 0x5c, 0xe7, 0xbb, 0x12, 0xa2, 0x39, 
+  0xa3, 0x93, 0x68, 0xf0, 0x7d, 0x3d, 0x7d, 0x37, 0xa0, 0x43, 0xc3, 0xd4, 0x28, 0xbd, 0xa4, 0xba, 
+  0xdd, 0x40, 0x28, 0x1a, 0x54, 0x85, 0x8b, 0xbd, 0x95, 0xdc, 0x52, 0x70, 0x48, 0x7c, 0xab, 0x68, 
+  0x6b, 0x9e, 0xac, 0xc3, 0x1e, 0x7b, 0xdd, 0xa9, 0xfe, 0x95, 0xbd, 0xa3, 0xb6, 0xe1, 0x82, 0xf7, 
+  0xdd, 0xe8, 0xdc, 0x94, 0x63, 0xc6, 0x7e, 0xe3, 0x8b, 0x6c, 0x3b, 0xd8, 0xc1, 0xa1, 0xaa, 0x8b, 
+  0xc0, 0x7b, 0x76, 0xe0, 0x48, 0xd6, 0x37, 0x0b, 0xdb, 0x08, 0xc5, 0xf6, 0x4f, 0x3b, 0xeb, 0x49, 
+  0xcf, 0x2e, 0xb0, 0x77, 0x85, 0x1e, 0x7e, 0x4c, 0xcd, 0x71, 0x1d, 0xd0, 0xf8, 0xf2, 0xef, 0x06, 
+  0x54, 0xdc, 0xca, 0x6f, 0xfa, 0x21, 0xce, 0x23, 0xc1, 0xb5, 0xec, 0x89, 0xdb, 0xdb, 0xea, 0x57, 
+  0x0e, 0x4e, 0xfc, 0xaa, 0xfd, 0x05, 0xae, 0x84, 0x51, 0xdc, 0xa6, 0x28, 0x1b, 0xaa, 0xea, 0x2a, 
+  0xab, 0xdd, 0xe8, 0x40, 0xff, 0xed, 0x18, 0x34, 0xc3, 0x2c, 0xbc, 0x8e, 0xbd, 0xc0, 0xe2, 0x8b, 
+  0x7a, 0xb7, 0xd0, 0xef, 0x3a, 0x1b, 0x77, 0x31, 0x73, 0xc8, 0x83, 0xb4, 0xcf, 0x9e, 0xbc, 0xf9, 
+  0xa7, 0xf8, 0x9b, 0x51, 0x74, 0xdd, 0x16, 0x0f, 0xa3, 0xbc, 0x77, 0x3b, 0x5f, 0xba, 0x04, 0xdb, 
+  0x46, 0x31, 0xb6, 0x06, 0x84, 0xb4, 0x25, 0x72, 0xa4, 0x1d, 0xeb, 0xda, 0xbf, 0x26, 0x8f, 0x58, 
+  0x4a, 0xb3, 0xff, 0x54, 0xae, 0x56, 0xa2, 0xcd, 0x8b, 0xd3, 0xf7, 0x9a, 0x14, 0x9a, 0x95, 0x1d, 
+  0xfe, 0x1e, 0xa3, 0x5a, 0x6f, 0xf7, 0x5d, 0xff, 0xba, 0xe8, 0x38, 0x7b, 0x3d, 0x1a, 0x4f, 0xe2, 
+  0x05, 0xab, 0x09, 0xaa, 0x5c, 0xba, 0xa7, 0x4b, 0xc5, 0x98, 0xe5, 0x3f, 0x6a, 0x72, 0xc3, 0x39, 
+  0x72, 0x8c, 0x7f, 0xd9, 0x64, 0x73, 0xe9, 0xea, 0xcc, 0xe1, 0x8b, 0xd1, 0xf3, 0x33, 0x48, 0x73, 
+  0xed, 0x1f, 0x6e, 0xca, 0x3a, 0xd4, 0x38, 0xf4, 0xb9, 0xff, 0xda, 0x4a, 0x6d, 0xef, 0x6f, 0x30, 
+  0x65, 0xcb, 0x4c, 0xdb, 0x09, 0x00, 0x00, 0x00 };
@@ -1,4 +1,4 @@
-static const char CONTENT_HOME_HTML[] PROGMEM = 
+static const char CONTENT_HOME_HTML[] PROGMEM __attribute__((aligned(4))) = 
   "<!doctype html> <html lang=\"en\"> <head> <meta charset=\"utf-8\"> <title>OpenEVSE</title> <meta name=\"viewport\" content=\"width=device-width,initial-scale=1\"> <meta name=\"viewport\" content=\"width=device-width,user-scalable=no\"> <meta name=\"description\" content=\"OpenEVSE\"> <meta name=\"author\" content=\"OpenEVSE\"> <meta name=\"theme-color\" content=\"#000000\"> <link rel=\"stylesheet\" type=\"text/css\" href=\"style.css\"> <link rel=\"icon\" type=\"image/png\" href=\"favicon-32x32.png\" sizes=\"32x32\"> <link rel=\"icon\" type=\"image/png\" href=\"favicon-16x16.png\" sizes=\"16x16\"> </head> <body> <div id=\"page\"> <div class=\"header\"> <h1>Open<span>EVSE</span></h1> <h3>WiFi</h3> </div> <div class=\"container\" data-bind=\"visible: !initialised()\"> Loading, please wait... (<span data-bind=\"text: itemsLoaded\"></span>/<span data-bind=\"text: itemsTotal\"></span>) </div> <div class=\"container\" data-bind=\"visible: initialised\" style=\"display: none\"> <div class=\"tabs\"> <input id=\"tab-3\" type=\"radio\" name=\"tab-group\" data-bind=\"checked: tab\" value=\"status\"> <label for=\"tab-3\">OpenEVSE</label> <input id=\"tab-1\" type=\"radio\" name=\"tab-group\" data-bind=\"checked: tab\" value=\"system\"> <label for=\"tab-1\">System</label> <input id=\"tab-2\" type=\"radio\" name=\"tab-group\" data-bind=\"checked: tab\" value=\"services\"> <label for=\"tab-2\">Services</label> <input id=\"tab-4\" type=\"radio\" name=\"tab-group\" data-bind=\"checked: tab\" value=\"rapi\"> <label for=\"tab-4\" data-bind=\"visible: developerMode\">RAPI</label> </div> <div id=\"content\"> <div id=\"content-1\" data-bind=\"visible: isSystem\"> <div class=\"box380 left\"> <h2>WiFi Setup</h2> <p><b>Mode:</b> <span id=\"mode\" data-bind=\"text: status.fullMode\"></span></p> <div id=\"client-view\" data-bind=\"visible: !wifi.canConfigure() &amp;&amp; !wifi.wifiConnecting()\"> <table> <tr> <th>Network</th> <th>RSSI dBm</th> </tr> <tbody id=\"sta-ssid\"> <tr data-bind=\"click: function () { wifi.forceConfig(true); }\"> <td data-bind=\"text: config.ssid\"></td> <td data-bind=\"text: status.srssi\"></td> </tr> </tbody> </table> <button data-bind=\"click: function () { wifi.forceConfig(true); }\">Change WiFi network</button> <p><b>IP Address:</b><br><a data-bind=\"text: status.ipaddress, attr: {href: 'http://'+status.ipaddress()}\"></a></p> <p> <b>Successful packets:</b><br> <span data-bind=\"text: status.packets_success\"></span> of <span data-bind=\"text: status.packets_sent\"></span> </p> <p><b>OpenEVSE</b></p> <p><b>RAPI packets:</b><br><span data-bind=\"text: status.comm_success\"></span> of <span data-bind=\"text: status.comm_sent\"></span></p> <button id=\"apoff\" data-bind=\"visible: status.isWifiAccessPoint, click: wifi.turnOffAccessPoint, disable: wifi.turnOffAccessPointFetching\">Turn off Access Point</button> </div> <div id=\"ap-view\" data-bind=\"visible: wifi.canConfigure() &amp;&amp; !wifi.wifiConnecting()\"> <p>Connect to network:</p> <table> <tr> <th>Select</th> <th>Network</th> <th>RSSI dBm</th> </tr> <tbody id=\"networks\" data-bind=\"foreach: scan.results\"> <tr> <td><input class=\"networkcheckbox\" name=\"network\" data-bind=\"checkedValue: bssid(), checked: $root.wifi.bssid\" type=\"radio\"></td> <td data-bind=\"text: ssid\"></td> <td data-bind=\"text: rssi\"></td> </tr> </tbody> <tfoot data-bind=\"visible: 0 == scan.results().length\"> <tr> <td colspan=\"3\">Scanning...</td> </tr> </tfoot> </table> <p data-bind=\"text: config.ssid\"></p> <p> <b>Passkey:</b><br> <input type=\"text\" autocapitalize=\"none\" autocapitalize=\"none\" data-bind=\"textInput: config.pass\"> <button data-bind=\"click: wifi.saveNetwork, text: (wifi.saveNetworkFetching() ? 'Saving' : (wifi.saveNetworkSuccess() ? 'Saved' : 'Connect')), disable: wifi.saveNetworkFetching\">Connect</button> </p> </div> <div data-bind=\"visible: wifi.wifiConnecting\"> <p>Connecting to WIFI Network...</p> </div> </div> <div class=\"box380 right\"> <h2>Administration</h2> <p> <b>Username:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.www_username\" pattern=\".{15}\" title=\"The field requires 15 characters\" maxlength=\"15\" required=\"\"> <span class=\"small-text validMessage\">15 characters max</span> </p> <p> <b>Password:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.www_password\" pattern=\".{15}\" title=\"The field requires 15 characters\" maxlength=\"15\" required=\"\"> <span class=\"small-text validMessage\">15 characters max</span><br> <span class=\"small-text\">Web interface HTTP authentication.</span><br><br> <button data-bind=\"click: saveAdmin, text: (saveAdminFetching() ? 'Saving' : (saveAdminSuccess() ? 'Saved' : 'Save')), disable: saveAdminFetching\">Save</button> </p> </div> <div class=\"box380 right\"> <h2>WiFi Firmware</h2> <span class=\"small-text\">ESP8266</span><br> <p><b>Version: </b><span data-bind=\"text: config.version\"></span></p> <iframe style=\"width:380px; height:50px;\" frameborder=\"0\" scrolling=\"no\" marginheight=\"0\" marginwidth=\"0\" data-bind=\"attr: {src: upgradeUrl}\"> </iframe> <p> <button data-bind=\"click: restart, text: (restartFetching() ? 'Restarting...' : 'Restart'), disable: restartFetching\">Restart</button> <button data-bind=\"click: factoryReset, text: (factoryResetFetching() ? 'Resetting...' : 'Factory Reset'), disable: factoryResetFetching\">Factory Reset</button> </p> </div> <div class=\"box380 left\"> <h2>Developer Mode</h2> <div> <b>Enabled: </b> <label class=\"switch\"> <input type=\"checkbox\" data-bind=\"checked: developerMode\"> <div class=\"slider round\"></div> </label> </div> </div> </div> <div id=\"content-2\" data-bind=\"visible: isServices\"> <div class=\"box380 left\"> <h2>&nbsp; Energy Monitoring <img src=\"data:image/png;base64,R0lGODlhAQABAAD/ACwAAAAAAQABAAACADs=\" data-src=\"emoncms.jpg\" align=\"left\"></h2> <p> <input type=\"checkbox\" id=\"emoncms_enabled\" data-bind=\"checked: config.emoncms_enabled\"> <label for=\"emoncms_enabled\"><b>Enable Emoncms</b></label> </p> <p data-bind=\"visible: config.emoncms_enabled\"> <b>Emoncms Server*:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.emoncms_server\"><br> <span class=\"small-text\">e.g: <a href=\"http://data.openevse.com/emoncms\">data.openevse.com/emoncms</a>, <a href=\"https://emoncms.org\">emoncms.org</a>, <a href=\"http://emonpi/emoncms\">emonpi/emoncms</a> </span><br> </p> <p data-bind=\"visible: config.emoncms_enabled\"> <b>Emoncms Node*:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.emoncms_node\"> </p> <p data-bind=\"visible: config.emoncms_enabled\"> <b>Emoncms write-apikey*:</b><br> <input type=\"password\" autocapitalize=\"none\" data-bind=\"textInput: config.emoncms_apikey\"><br> </p> <p data-bind=\"visible: config.emoncms_enabled\"> <b>Emoncms SSL SHA-1 Fingerprint (optional):</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.emoncms_fingerprint\"><br> <br><span class=\"small-text\">HTTPS will be enabled if present e.g:</span> <span class=\"small-text\"> 7D:82:15:BE:D7:BC:72:58:87:7D:8E:40:D4:80:BA:1A:9F:8B:8D:DA </span> </p> <p> <button data-bind=\"click: saveEmonCms, text: (saveEmonCmsFetching() ? 'Saving' : (saveEmonCmsSuccess() ? 'Saved' : 'Save')), disable: saveEmonCmsFetching\">Save</button> <span data-bind=\"visible: config.emoncms_enabled\"><b>&nbsp; Connected:&nbsp;<span data-bind=\"text: 1 === status.emoncms_connected() ? 'Yes' : 'No'\"></span></b></span> <span data-bind=\"visible: config.emoncms_enabled() &amp;&amp; 1 === status.emoncms_connected()\"><b>&nbsp; Successful posts:&nbsp;<span data-bind=\"text: status.packets_success\"></span></b></span> </p> </div> <div class=\"box380 right\"> <h2>MQTT</h2> <p> <input type=\"checkbox\" id=\"mqtt_enabled\" data-bind=\"checked: config.mqtt_enabled\"> <label for=\"mqtt_enabled\"><b>Enable MQTT</b></label> <span class=\"info\" data-bind=\"click: toggle.bind($data, showMqttInfo)\"></span> </p> <div class=\"box\" data-bind=\"visible: showMqttInfo\"> <div> Status published to:<br> <span class=\"small-text\">{base-topic}/{status} value</span><br> <span class=\"small-text\">e.g. <span data-bind=\"text: '' !== config.mqtt_topic() ? config.mqtt_topic() : 'openevse'\"></span>/amp 16</span><br> </div> <p> RAPI control subscribes to:<br> <span class=\"small-text\">{base-topic}/rapi/in/{command} value</span><br> <span class=\"small-text\">e.g. <span data-bind=\"text: '' !== config.mqtt_topic() ? config.mqtt_topic() : 'openevse'\"></span>/rapi/in/$SC 16</span><br> <span class=\"small-text\">e.g. <span data-bind=\"text: '' !== config.mqtt_topic() ? config.mqtt_topic() : 'openevse'\"></span>/rapi/in/$GC</span><br> </p> <p> RAPI response published to:<br> <span class=\"small-text\">{base-topic}/rapi/out response</span><br> <span class=\"small-text\">e.g. <span data-bind=\"text: '' !== config.mqtt_topic() ? config.mqtt_topic() : 'openevse'\"></span>/rapi/out $OK 6 32</span><br> </p> </div> <p data-bind=\"visible: config.mqtt_enabled\"> <b>Host*:</b><br> <input data-bind=\"textInput: config.mqtt_server\" type=\"text\" autocapitalize=\"none\"><br> <span class=\"small-text\">e.g 'emonpi', 'test.mosquitto.org', '192.168.1.4'</span> </p> <p data-bind=\"visible: config.mqtt_enabled\"> <b>Username:</b><span> blank - no authentication</span> <input data-bind=\"textInput: config.mqtt_user\" type=\"text\" autocapitalize=\"none\"> </p> <p data-bind=\"visible: config.mqtt_enabled\"> <b>Password:</b><span> blank - no authentication</span> <input data-bind=\"textInput: config.mqtt_pass\" type=\"password\" autocapitalize=\"none\"><br> </p> <p data-bind=\"visible: config.mqtt_enabled\"> <b>Base-topic*:</b><br> <input data-bind=\"textInput: config.mqtt_topic\" type=\"text\" autocapitalize=\"none\"><br> <span class=\"small-text\">e.g 'openevse'</span> </p> <h2 data-bind=\"visible: config.mqtt_enabled\">Solar PV divert<span class=\"info\" data-bind=\"click: toggle.bind($data, showSolarDivert)\"></span></h2> <div class=\"box\" data-bind=\"visible: showSolarDivert() &amp;&amp; config.mqtt_enabled()\"> <div>Dynamically adjust charge rate based on solar PV generation or excess power (grid export).</div> <p> <b>1. Normal (default):</b> </p><ul> <li><span class=\"small-text\">Charge at maximum current set by EVSE.</span></li> </ul> <b>2. Eco:</b> <ul> <li><span class=\"small-text\">If only solar PV feed available: charge rate is modulated based on <b>solar PV generation.</b></span></li> <li><span class=\"small-text\">If grid +I/-E (positive Import / negative Export) feed is available: charge rate will be modulated by available <b>excess power.</b></span></li> <li><span class=\"small-text\">If EVSE is sleeping: charging will begin when solar PV / excess power > min charge rate.</span></li> <li><span class=\"small-text\">Charging will not pause; this avoids excess wear on the EVSE relay and the EV.</span></li> </ul> <span class=\"small-text\"><i>Note: It's assumed that EVSE power is included in the grid feed.</i></span><br> <p></p> </div> <p data-bind=\"visible: config.mqtt_enabled\"> <b>SolarPV-gen topic:</b> <input data-bind=\"textInput: config.mqtt_solar, enable: '' === config.mqtt_grid_ie()\" type=\"text\" autocapitalize=\"none\" hint=\"emon/emonpi/power2\"><br> <span class=\"small-text\">Solar PV MQTT topic to modulate charge rate based on solar </span></p> <p data-bind=\"visible: config.mqtt_enabled\"> <b>Grid (+I/-E) topic:</b><br> <input data-bind=\"textInput: config.mqtt_grid_ie, enable: '' === config.mqtt_solar()\" type=\"text\" autocapitalize=\"none\" hint=\"emon/emonpi/power1\"><br> <span class=\"small-text\">Grid (+I/-E) MQTT topic to modulate charge rate based on <b>excess power</b></span> </p> <button data-bind=\"click: saveMqtt, text: (saveMqttFetching() ? 'Saving' : (saveMqttSuccess() ? 'Saved' : 'Save')), disable: saveMqttFetching\">Save</button> <span data-bind=\"visible: config.mqtt_enabled\"><b>&nbsp; Connected:&nbsp;<span data-bind=\"text: 1 === status.mqtt_connected() ? 'Yes' : 'No'\"></span></b></span> <p></p> </div> <div class=\"box380 left\"> <h2>&nbsp; OhmConnect <img src=\"data:image/png;base64,R0lGODlhAQABAAD/ACwAAAAAAQABAAACADs=\" data-src=\"ohm.jpg\" align=\"left\"></h2> <p> <input type=\"checkbox\" id=\"ohm_enabled\" data-bind=\"checked: config.ohm_enabled\"> <label for=\"ohm_enabled\"><b>Enable OhmConnect</b></label> <a href=\"https://ohm.co/openevse\" rel=\"nofollow\">Click Here to Join</a> </p> <p data-bind=\"visible: config.ohm_enabled\"> OhmConnect monitors real-time conditions on the electricity grid. When dirty and unsustainable power plants turn on, our users receive a notification to save energy. </p> <p data-bind=\"visible: config.ohm_enabled\"> <b>Ohm Hour:</b> <span data-bind=\"text: status.ohm_hour\"></span> </p> <p data-bind=\"visible: config.ohm_enabled\"> <b>Ohm key:</b><br> <input data-bind=\"textInput: config.ohmkey\" type=\"text\" autocapitalize=\"none\"> </p> <p data-bind=\"visible: config.ohm_enabled\"> <strong>USA - California only</strong> </p> <div style=\"padding:56.25% 0 0 0;position:relative;\"><iframe src=\"https://player.vimeo.com/video/119419875\" style=\"position:absolute;top:0;left:0;width:100%;height:100%;\" frameborder=\"0\" webkitallowfullscreen mozallowfullscreen allowfullscreen></iframe></div><script src=\"https://player.vimeo.com/api/player.js\"></script> <p data-bind=\"visible: config.ohm_enabled\"> Ohm Key can be obtained by logging in to OhmConnect, enter Settings and locate the link in \"Open Source Projects\"<br> Example: https://login.ohmconnect.com/verify-ohm-hour/OpnEoVse<br> <b>Key: </b>OpnEoVse </p> <p> <button data-bind=\"click: saveOhmKey, text: (saveOhmKeyFetching() ? 'Saving' : (saveOhmKeySuccess() ? 'Saved' : 'Save')), disable: saveOhmKeyFetching\">Save</button> </p> </div> </div> <div id=\"content-3\" data-bind=\"visible: isStatus\"> <div data-bind=\"visible: openevse.isError\" class=\"box box-full left error\"> <h4>EVSE Error</h4> <span data-bind=\"text: status.estate\"></span> </div> <div data-bind=\"visible: !openevse.isError(),\n"
   "                          css: { ready: openevse.isReady(),\n"
   "                                 connected: openevse.isConnected() &amp;&amp; !openevse.isCharging(),\n"
@@ -32,3 +32,422 @@ static const char CONTENT_HOME_HTML[] PROGMEM =
   "                                  disable: updatingServiceLevel() || updatingCurrentCapacity(),\n"
   "                                  css: { saved: savedCurrentCapacity }\"></select> </p> </div> <div class=\"box380 right\" data-bind=\"visible: advancedMode\"> <h2>Current</h2> <table> <tr> <th>Name</th> <th> </th> </tr> <tr> <td>Service Level:</td> <td> <span data-bind=\"text: openevse.actualServiceLevel\"></span> </td> </tr> <tr> <td>Level <span data-bind=\"text: openevse.actualServiceLevel\"></span> Minimum:</td> <td> <span data-bind=\"text: openevse.minCurrentLevel() + ' A'\"></span> </td> </tr> <tr> <td>Level <span data-bind=\"text: openevse.actualServiceLevel\"></span> Maximum:</td> <td> <span data-bind=\"text: openevse.maxCurrentLevel() + ' A'\"></span> </td> </tr> <tr> <td>Sensor Scale:</td> <td><span data-bind=\"text: config.scale\"></span></td> </tr> <tr> <td>Sensor Offset:</td> <td><span data-bind=\"text: config.offset\"></span></td> </tr> </table> </div> <div class=\"box380 left\" data-bind=\"visible: advancedMode() || !openevse.allTestsEnabled()\"> <h2>Safety<span class=\"info\" data-bind=\"click: toggle.bind($data, showSafety)\"></span></h2> <div class=\"box\" data-bind=\"visible: showSafety()\"> Hardware safety checks. Enable dev mode (System > Developer Mode) to enable/disable or use the physical LCD + menu button. </div> <div data-bind=\"visible: !openevse.allTestsEnabled()\" class=\"box warning\"> <h4>Warning!!</h4> Not all the safety tests are enabled, please take extra care before charging your vehicle. </div> <table> <tr> <th>Test</th> <th>Status</th> </tr> <tr data-bind=\"css: {error: 9 === status.state() }\"> <td>GFI Self Test:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.gfiSelfTestEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.gfiSelfTestEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 7 === status.state() }\"> <td>Ground Monitoring:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.groundCheckEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.groundCheckEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 8 === status.state() }\"> <td>Stuck Contact Detection:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.stuckRelayEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.stuckRelayEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 10 === status.state() }\"> <td>Temperature Monitoring:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode() &amp;&amp; openevse.tempCheckSupported()\"> <input type=\"checkbox\" data-bind=\"checked: openevse.tempCheckEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.tempCheckEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 5 === status.state() }\"> <td>Diode Check:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.diodeCheckEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.diodeCheckEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 4 === status.state() }\"> <td>Vent Required:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.ventRequiredEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.ventRequiredEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr> <th>Error</th> <th>Count</th> </tr> <tr> <td>GFCI:</td> <td><span data-bind=\"text: status.gfcicount\"></span></td> </tr> <tr> <td>No Ground:</td> <td><span data-bind=\"text: status.nogndcount\"></span></td> </tr> <tr> <td>Stuck Contact:</td> <td><span data-bind=\"text: status.stuckcount\"></span></td> </tr> </table> </div> <div class=\"box380 right\" data-bind=\"visible: advancedMode\"> <h2>Hardware</h2> <table> <tr> <th>OpenEVSE</th> <th></th> </tr> <tr> <td>Firmware:</td> <td><span data-bind=\"text: config.firmware\"></span></td> </tr> <tr> <td>Protocol:</td> <td><span data-bind=\"text: config.protocol\"></span></td> </tr> <tr> <td colspan=\"2\" data-bind=\"with: openevse\"> <button data-bind=\"click: restart, text: (restartFetching() ? 'Restarting...' : 'Restart'), disable: restartFetching\">Restart</button> </td> </tr> <tr> <th>OpenEVSE WiFi</th> <th></th> </tr> <tr> <td>Firmware:</td> <td><span data-bind=\"text: config.version\"></span></td> </tr> <tr> <td>Flash Size:</td> <td><span data-bind=\"text: scaleString(config.espflash(), 1024, 0) + 'K'\"></span></td> </tr> <tr> <td>Free RAM:</td> <td><span data-bind=\"text: scaleString(status.free_heap(), 1024, 0) + 'K'\"></span></td> </tr> <tr> <td colspan=\"2\"> <button data-bind=\"click: restart, text: (restartFetching() ? 'Restarting...' : 'Restart'), disable: restartFetching\">Restart</button> </td> </tr> </table> </div> <div class=\"box380\" data-bind=\"css: { right: !advancedMode() &amp;&amp; !openevse.allTestsEnabled(),\n"
   "                                                left: advancedMode() || openevse.allTestsEnabled() }\"> <h2>Display</h2> <div> <span data-bind=\"css: {selected: !advancedMode() }\">Simple</span> <label class=\"switch\"> <input type=\"checkbox\" data-bind=\"checked: advancedMode\"> <div class=\"slider round\"></div> </label> <span data-bind=\"css: {selected: advancedMode }\">Advanced</span><br> </div> </div> </div> <div id=\"content-4\" data-bind=\"visible: isRapi\"> <div class=\"box380 left\"> <form method=\"get\" action=\"r\" data-bind=\"with: rapi\"> <p> <b>RAPI Command:</b> <input type=\"text\" autocapitalize=\"none\" name=\"rapi\" length=\"32\" data-bind=\"textInput: cmd\"> </p> <p> <button data-bind=\"click: send, disable: rapiSend\">Send</button> </p> <p data-bind=\"text: ret\"></p> </form> </div> <div class=\"box380 right\"> <h2>RAPI System Functions</h2> <table> <tr> <th>Function</th> <th>Description</th> </tr> <tr> <td>$FB</td> <td>LCD Backlight Color (0-7)</td> </tr> <tr> <td>$FD</td> <td>Disable EVSE</td> </tr> <tr> <td>$FE</td> <td>Enable EVSE</td> </tr> <tr> <td>$FP</td> <td>Output text at x y position text to LCD (x y text)</td> </tr> <tr> <td>$FR</td> <td>Reset EVSE</td> </tr> <tr> <td>$FS</td> <td>Put EVSE to sleep</td> </tr> </table> </div> <div class=\"box380 left\"> <h2>RAPI Get Commands</h2> <table> <tr> <th>Get</th> <th>Description</th> </tr> <tr> <td>$G3</td> <td>Get Charge Time Limit, 15-minutes (1), 30-minutes (2), etc...</td> </tr> <tr> <td>$GA</td> <td>Get Ammeter Scale/Offset, scale offset</td> </tr> <tr> <td>$GC</td> <td>Get current capacity range, integers</td> </tr> <tr> <td>$GE</td> <td>Get settings, amps flags</td> </tr> <tr> <td>$GF</td> <td>Get fault counters, gfi ground stuck (in hex)</td> </tr> <tr> <td>$GG</td> <td>Get charge current and voltage, milliamps millivolts</td> </tr> <tr> <td>$GH</td> <td>Get charge limit in kWh, integer</td> </tr> <tr> <td>$GM</td> <td>Get Voltmeter Scale/Offset, scale offset</td> </tr> <tr> <td>$GO</td> <td>Get Overtemperature thresholds, ambient infrared</td> </tr> <tr> <td>$GP</td> <td>Get Temperatures, LCD mcp9808 infrared (all integers, Celsius * 10)</td> </tr> <tr> <td>$GS</td> <td>Get EVSE State, state elapsed_seconds</td> </tr> <tr> <td>$GT</td> <td>Get time, year month day hour minute second</td> </tr> <tr> <td>$GU</td> <td>Get Energy usage, wattseconds watt_hour_accumulated</td> </tr> <tr> <td>$GV</td> <td>Get Versions, evse_firmware protocol_version</td> </tr> </table> </div> <div class=\"box380 right\"> <h2>RAPI Set Commands</h2> <table> <tr> <th>Set</th> <th>Description</th> </tr> <tr> <td>$S0</td> <td>Set LCD Type, Monochrome (0), Color (1)</td> </tr> <tr> <td>$S1</td> <td>Set RTC Year Month Day Hour Minute Second (all 2-digit max)</td> </tr> <tr> <td>$S2</td> <td>Enable (1)/ Disable (0) Ammeter Calibration Mode</td> </tr> <tr> <td>$S3</td> <td>Set Charge Time Limit, 15-minutes (1), 30-minutes (2), etc...</td> </tr> <tr> <td>$SA</td> <td>Set Ammeter Scale/Offset, scale offset</td> </tr> <tr> <td>$SC</td> <td>Set current capacity, integer</td> </tr> <tr><td>$SD</td><td>Enable (1) / Disable (0) Diode self-check</td></tr> <tr> <td>$SF</td> <td>Enable (1) / Disable (0) GFI self-check</td> </tr> <tr> <td>$SG</td> <td>Enable (1) / Disable (0) Ground check</td> </tr> <tr> <td>$SH</td> <td>Set charge limit in kWh, integer</td> </tr> <tr> <td>$SK</td> <td>Set accumulated Wh, integer</td> </tr> <tr><td>$SL</td><td>Set service level (1/2/A)</td></tr> <tr> <td>$SM</td> <td>Set Voltmeter Scale/Offset, scale offset</td> </tr> <tr> <td>$SO</td> <td>Set Overtemperature thresholds, ambient infrared</td> </tr> <tr> <td>$SR</td> <td>Enable (1) / Disable (0) Stuck-relay check</td> </tr> <tr> <td>$SS</td> <td>Enable (1) / Disable (0) GFI self-check</td> </tr> <tr> <td>$ST</td> <td>Set timer, start_hour start_min end_hour end_min</td> </tr> <tr> <td>$SV</td> <td>Enable (1) / Disable (0) vent required check</td> </tr> </table> </div> </div> </div> <div id=\"footer\"> <br><b> Powered by <a href=\"http://www.openevse.com\">OpenEVSE</a> and <a href=\"https://openenergymonitor.org\">OpenEnergyMonitor</a></b> <br> <b>Version: </b>V<span data-bind=\"text: config.version\"></span> </div> </div> </div> <script src=\"lib.js\"></script> <script src=\"home.js\"></script> </body> </html> \n";
+static const char CONTENT_HOME_HTML_GZ[] PROGMEM __attribute__((aligned(4))) = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x3d, 0x6b, 0x77, 0xdb, 0x38, 
+  0xae, 0xdf, 0xf7, 0x57, 0xb0, 0xde, 0xee, 0xc4, 0xd9, 0x89, 0xed, 0xd8, 0x49, 0xdb, 0xd4, 0x4d, 
+  0x7c, 0x8f, 0xeb, 0x24, 0x6d, 0xee, 0xb4, 0x4d, 0x36, 0xca, 0xa4, 0x67, 0x3f, 0xf5, 0xc8, 0x12, 
+  0x6d, 0x73, 0x22, 0x4b, 0x1a, 0x89, 0xce, 0x63, 0x3a, 0xfd, 0xef, 0x17, 0x00, 0xa9, 0xa7, 0x25, 
+  0x59, 0x76, 0xd2, 0x9d, 0x9e, 0x73, 0xb7, 0x73, 0xa6, 0xb5, 0x28, 0x12, 0x04, 0x01, 0x10, 0x00, 
+  0x41, 0x90, 0x3a, 0x7c, 0x66, 0x7b, 0x96, 0x7c, 0xf0, 0x39, 0x9b, 0xc9, 0xb9, 0x33, 0x60, 0x87, 
+  0xf8, 0x0f, 0x73, 0x4c, 0x77, 0x7a, 0xd4, 0xe0, 0x6e, 0x03, 0x0b, 0xb8, 0x69, 0xc3, 0x3f, 0x73, 
+  0x2e, 0x4d, 0x66, 0xcd, 0xcc, 0x20, 0xe4, 0xf2, 0xa8, 0xb1, 0x90, 0x93, 0xd6, 0x01, 0xbe, 0x95, 
+  0x42, 0x3a, 0x7c, 0x70, 0xee, 0x73, 0xf7, 0xe4, 0xda, 0x38, 0x39, 0xec, 0xa8, 0x67, 0x5d, 0xdd, 
+  0x35, 0xe7, 0xfc, 0xa8, 0x71, 0x2b, 0xf8, 0x9d, 0xef, 0x05, 0xb2, 0xc1, 0x2c, 0xcf, 0x95, 0xdc, 
+  0x85, 0xe6, 0x77, 0xc2, 0x96, 0xb3, 0x23, 0x9b, 0xdf, 0x0a, 0x8b, 0xb7, 0xe8, 0x61, 0x47, 0xb8, 
+  0x42, 0x0a, 0xd3, 0x69, 0x85, 0x96, 0xe9, 0xf0, 0xa3, 0x6e, 0x63, 0x13, 0x18, 0x8b, 0x90, 0x07, 
+  0x04, 0xc0, 0x1c, 0x03, 0x0c, 0xd7, 0xcb, 0x01, 0xb1, 0x79, 0x68, 0x05, 0xc2, 0x97, 0xc2, 0x73, 
+  0x53, 0x70, 0x22, 0xdc, 0x73, 0x95, 0xcd, 0x85, 0x9c, 0x79, 0xc1, 0xea, 0x7a, 0x72, 0xc6, 0xe7, 
+  0xbc, 0x65, 0x79, 0x4e, 0xa6, 0xf2, 0xdf, 0x77, 0xe9, 0x0f, 0xd6, 0x75, 0x84, 0x7b, 0xc3, 0x02, 
+  0xee, 0x1c, 0x35, 0x42, 0xf9, 0xe0, 0xf0, 0x70, 0xc6, 0x39, 0x0c, 0x03, 0x49, 0x0e, 0x8d, 0xf9, 
+  0xbd, 0xec, 0x58, 0x61, 0xd8, 0x60, 0xb3, 0x80, 0x4f, 0x74, 0x8d, 0x36, 0x16, 0x64, 0x1a, 0x0a, 
+  0x0b, 0x31, 0x56, 0x4d, 0xc4, 0xdc, 0x9c, 0xf2, 0x8e, 0xef, 0x4e, 0xa3, 0x36, 0x13, 0xf3, 0x16, 
+  0xdf, 0xb7, 0xf6, 0x7a, 0xf7, 0x7b, 0xbd, 0x36, 0xbd, 0x08, 0xc5, 0x1f, 0x3c, 0x3c, 0x6a, 0x50, 
+  0xc9, 0x06, 0x90, 0xba, 0x2f, 0xef, 0xbb, 0x2f, 0x33, 0x90, 0xa8, 0x04, 0x21, 0x75, 0xb4, 0x34, 
+  0x8c, 0x3d, 0xfb, 0x01, 0xfe, 0xb1, 0xc5, 0x2d, 0x13, 0xf6, 0x51, 0xc3, 0x07, 0x48, 0x0d, 0xfd, 
+  0x6c, 0x39, 0x66, 0x08, 0x4d, 0xb0, 0x22, 0x0f, 0x48, 0x80, 0xba, 0x24, 0x1f, 0x87, 0xa1, 0x6f, 
+  0xba, 0x03, 0x25, 0x25, 0xf4, 0x13, 0x80, 0x75, 0xf1, 0xf5, 0xde, 0xe0, 0xb3, 0x38, 0x15, 0xf0, 
+  0xb4, 0x87, 0x1d, 0x00, 0x88, 0x2c, 0x20, 0xa4, 0xa9, 0x29, 0x5c, 0x80, 0xc5, 0x6c, 0x53, 0x9a, 
+  0xad, 0xb1, 0x70, 0x6d, 0x14, 0x88, 0x50, 0x00, 0x93, 0xfb, 0xec, 0x99, 0x16, 0x1c, 0x11, 0x72, 
+  0xbb, 0xb9, 0x0d, 0xfd, 0x7d, 0xf0, 0x4c, 0x5b, 0xb8, 0xd3, 0x1d, 0xe6, 0x3b, 0xdc, 0x0c, 0x39, 
+  0xbb, 0x33, 0x85, 0x6c, 0xb7, 0xdb, 0xac, 0x49, 0x08, 0xa4, 0x61, 0x20, 0xf5, 0xfb, 0x4c, 0x48, 
+  0x3e, 0x0f, 0xb1, 0x11, 0xb7, 0x1b, 0x03, 0x8d, 0x5a, 0xa7, 0xaa, 0xee, 0x95, 0x27, 0x4d, 0x27, 
+  0xae, 0xba, 0xbd, 0x01, 0xce, 0x29, 0x94, 0x81, 0xc4, 0xc8, 0x73, 0x10, 0x4e, 0x11, 0xfa, 0x8e, 
+  0xf9, 0xd0, 0x67, 0xae, 0xe7, 0xe6, 0x69, 0x29, 0xcd, 0x31, 0x49, 0x84, 0x70, 0xfd, 0x85, 0x24, 
+  0x82, 0x43, 0x49, 0x6b, 0x2f, 0x62, 0x64, 0x00, 0x03, 0xf6, 0x1a, 0x91, 0x3c, 0xc2, 0x9b, 0x69, 
+  0xe0, 0x2d, 0xfc, 0x4c, 0xd7, 0xd6, 0x8c, 0x5b, 0x37, 0xdc, 0xee, 0x33, 0x78, 0xdd, 0x60, 0xb7, 
+  0xa6, 0xb3, 0xe0, 0x28, 0x6d, 0xa6, 0x5c, 0x28, 0x51, 0x33, 0xc7, 0xdc, 0x61, 0x13, 0x2f, 0x88, 
+  0x20, 0xa7, 0x66, 0x34, 0xbd, 0x5b, 0xea, 0xbc, 0xfb, 0xe8, 0xce, 0x1f, 0x42, 0x20, 0x66, 0x41, 
+  0xe7, 0x30, 0xf5, 0x0d, 0x7a, 0x57, 0xd6, 0x75, 0xef, 0xd1, 0x5d, 0xf3, 0x00, 0x95, 0x46, 0xd1, 
+  0xc8, 0x61, 0xba, 0x18, 0xfa, 0x6d, 0x59, 0xf7, 0xfb, 0x8f, 0xed, 0x3e, 0x30, 0x7d, 0x51, 0xd0, 
+  0xf5, 0x7e, 0xb1, 0xac, 0x80, 0x82, 0xe3, 0x8e, 0xe7, 0xf3, 0xe0, 0xa3, 0x67, 0x83, 0x5c, 0x5c, 
+  0x0e, 0x2f, 0xce, 0x12, 0xcc, 0x52, 0x92, 0x87, 0xe8, 0x69, 0xf5, 0xd3, 0x58, 0x2e, 0x42, 0x7e, 
+  0x15, 0x4a, 0x62, 0x68, 0xc4, 0x7c, 0x48, 0x09, 0xdc, 0xd8, 0xbb, 0xdf, 0x3b, 0xd8, 0x65, 0x0e, 
+  0x9f, 0x10, 0xb0, 0x59, 0x8f, 0xa6, 0x28, 0x33, 0xb8, 0x5c, 0xf8, 0x30, 0x51, 0x7b, 0x50, 0xe6, 
+  0x0f, 0x0e, 0xc7, 0x03, 0xc4, 0xa9, 0x7f, 0xd8, 0x19, 0xc3, 0x33, 0x4d, 0x18, 0xec, 0x71, 0x8e, 
+  0x78, 0x2e, 0x4f, 0x1d, 0x25, 0x6c, 0xed, 0xc9, 0xc2, 0x71, 0xd4, 0x48, 0x62, 0x2d, 0xe0, 0xa7, 
+  0xd1, 0x75, 0x04, 0x62, 0x8b, 0xea, 0xbe, 0x64, 0xba, 0xdf, 0x89, 0x89, 0x68, 0x5b, 0xa6, 0x3b, 
+  0xf2, 0xdc, 0x89, 0x98, 0x2e, 0x02, 0xde, 0xdc, 0x66, 0x3f, 0x99, 0x73, 0xff, 0x0d, 0xfd, 0xa5, 
+  0xdf, 0xe3, 0x5f, 0x50, 0xc1, 0xe5, 0x96, 0x04, 0x55, 0x40, 0x6a, 0xe1, 0x50, 0xa2, 0x51, 0xc0, 
+  0x7f, 0x03, 0xfc, 0x6b, 0x36, 0xf8, 0xc4, 0xe5, 0x9d, 0x17, 0xdc, 0x80, 0xc9, 0x9a, 0xa9, 0x82, 
+  0x4b, 0xc3, 0x38, 0x63, 0xf6, 0xdb, 0xb9, 0x2e, 0xe9, 0xa8, 0x8a, 0xa8, 0xe9, 0x08, 0x35, 0x18, 
+  0x40, 0x2b, 0x0c, 0x85, 0x4d, 0xb0, 0x82, 0x0c, 0x97, 0x1d, 0x61, 0xdd, 0xf4, 0xd9, 0x64, 0xe1, 
+  0x5a, 0x68, 0x5b, 0x18, 0x60, 0xf4, 0x95, 0x11, 0x1e, 0xc0, 0x5c, 0x8b, 0x2b, 0x4c, 0x9b, 0x32, 
+  0x58, 0xf0, 0xed, 0x37, 0xec, 0x1b, 0xb5, 0xb7, 0x97, 0x09, 0x64, 0x51, 0xb5, 0xb6, 0xea, 0x02, 
+  0x7a, 0xb7, 0x4b, 0xea, 0x69, 0x42, 0x86, 0x01, 0xd4, 0x8c, 0x2b, 0x2a, 0x64, 0x3b, 0x52, 0xeb, 
+  0xe5, 0x4e, 0x34, 0xd8, 0xf1, 0x42, 0x4a, 0xcf, 0x7d, 0x0c, 0xb2, 0xa3, 0x19, 0xf8, 0x02, 0x9c, 
+  0x11, 0xff, 0xdd, 0x88, 0x64, 0x0a, 0x6c, 0x24, 0x05, 0x67, 0x17, 0x6c, 0x68, 0xdb, 0x01, 0x0f, 
+  0x43, 0x92, 0x85, 0xc3, 0x71, 0x30, 0x38, 0x34, 0x4b, 0x11, 0x17, 0xbe, 0xa9, 0x2a, 0xef, 0x30, 
+  0x53, 0xca, 0xa0, 0xcf, 0xbe, 0xa2, 0xf5, 0xe9, 0xb3, 0xad, 0x99, 0x94, 0x7e, 0xbf, 0xd3, 0xd9, 
+  0xfa, 0x39, 0x5f, 0xb1, 0xb9, 0xfd, 0x0d, 0x07, 0x6a, 0x6a, 0x59, 0xc1, 0xff, 0xc7, 0x03, 0x63, 
+  0x61, 0xc1, 0x24, 0x0d, 0x41, 0x9e, 0x98, 0x6f, 0xc2, 0x24, 0x93, 0x49, 0xe7, 0xac, 0x44, 0x7b, 
+  0x6b, 0xb8, 0xba, 0xfa, 0x97, 0x50, 0x41, 0x88, 0x25, 0x91, 0x79, 0x93, 0xba, 0x2d, 0x69, 0x92, 
+  0x45, 0xcd, 0x22, 0xac, 0x00, 0xa9, 0x44, 0x6b, 0x8e, 0x07, 0xa9, 0x62, 0x9c, 0xb4, 0x4b, 0x58, 
+  0x56, 0x77, 0x65, 0x79, 0xf3, 0xf9, 0x06, 0x18, 0xaa, 0x66, 0x69, 0xf4, 0x14, 0x1a, 0x5a, 0x0e, 
+  0x50, 0x8e, 0x4d, 0xdf, 0x9b, 0x4c, 0x8a, 0x27, 0x57, 0x44, 0xf8, 0xf0, 0x33, 0xc8, 0xc3, 0x90, 
+  0xfa, 0xbe, 0xf0, 0x84, 0x2b, 0x77, 0x98, 0x96, 0x1a, 0x92, 0x13, 0xb9, 0x08, 0xdc, 0xf3, 0xc9, 
+  0x24, 0xf3, 0x1e, 0xac, 0x97, 0x49, 0x20, 0x4a, 0x6a, 0x9c, 0x72, 0x69, 0xcd, 0x60, 0x2a, 0x36, 
+  0x06, 0x57, 0xf0, 0x0e, 0xc6, 0x31, 0x61, 0xea, 0x2d, 0xa3, 0xd7, 0x29, 0x89, 0xca, 0xa9, 0x34, 
+  0xd3, 0xaf, 0x50, 0x06, 0x1b, 0xeb, 0x02, 0x7f, 0xa0, 0x4b, 0x98, 0xf4, 0x22, 0xa9, 0xee, 0x2b, 
+  0x4a, 0xe5, 0xd5, 0x84, 0xc1, 0x1d, 0xa8, 0x97, 0x68, 0x89, 0x75, 0xd5, 0x86, 0x86, 0x1e, 0x66, 
+  0x46, 0x00, 0x53, 0x8d, 0x9b, 0xd6, 0x0c, 0x28, 0x0e, 0xd8, 0xb7, 0x41, 0xc6, 0x17, 0x8e, 0x0c, 
+  0x1b, 0x71, 0xaf, 0xf6, 0x40, 0xdb, 0x1c, 0xad, 0x8e, 0x35, 0x0c, 0xb2, 0x26, 0xa0, 0x9a, 0x23, 
+  0x9b, 0xa3, 0x8b, 0x8b, 0x2c, 0xce, 0x35, 0x9a, 0x9a, 0x3e, 0x1b, 0xa3, 0x36, 0x69, 0x6e, 0x03, 
+  0xff, 0x22, 0x43, 0xf4, 0x3c, 0xf0, 0x3c, 0x49, 0x34, 0x69, 0xd3, 0xcb, 0xac, 0x31, 0xab, 0xd4, 
+  0x3b, 0xab, 0x14, 0x53, 0x95, 0x42, 0x92, 0x13, 0xe8, 0xb6, 0x90, 0x87, 0xbb, 0xec, 0xe8, 0x28, 
+  0x43, 0x86, 0xe6, 0x76, 0xdb, 0xe1, 0xee, 0x54, 0xce, 0x52, 0xf4, 0x00, 0xe5, 0xe8, 0xa0, 0x34, 
+  0x83, 0x4f, 0x0b, 0x06, 0x1a, 0x2a, 0xbb, 0xc0, 0x4a, 0x70, 0xea, 0x72, 0x9d, 0x61, 0x27, 0x69, 
+  0xed, 0xe7, 0xaf, 0xd4, 0xb2, 0x89, 0x3e, 0xb9, 0x00, 0x4a, 0xdf, 0xf0, 0x87, 0x94, 0x12, 0x51, 
+  0x2c, 0x48, 0x1c, 0xf5, 0x06, 0x83, 0x35, 0x81, 0x67, 0x81, 0xf5, 0x06, 0xff, 0x0f, 0xfc, 0x62, 
+  0x60, 0x00, 0xba, 0x6a, 0x25, 0xa5, 0xb9, 0x9e, 0xcf, 0x10, 0x58, 0xdc, 0xbd, 0x6f, 0x2a, 0x17, 
+  0xbf, 0x54, 0x3d, 0x13, 0x83, 0x42, 0xf3, 0x96, 0x6b, 0x71, 0xdb, 0x61, 0x0a, 0xfd, 0x66, 0xfe, 
+  0x45, 0x34, 0xb1, 0x40, 0xf2, 0xff, 0x87, 0x6d, 0x19, 0xe0, 0xc1, 0xbb, 0xd3, 0x2d, 0x56, 0x50, 
+  0x51, 0xeb, 0xcb, 0xb8, 0x1e, 0xb7, 0xb1, 0xda, 0x96, 0x9e, 0x07, 0x5b, 0xdb, 0xdb, 0xf9, 0x49, 
+  0x5c, 0xd0, 0x49, 0x23, 0x9a, 0x36, 0xe9, 0xf9, 0xea, 0x67, 0x27, 0x6d, 0xe9, 0x3c, 0xcd, 0xce, 
+  0xc3, 0xcc, 0x2c, 0x84, 0x67, 0x9c, 0x88, 0x9f, 0xcf, 0x4e, 0xcf, 0x98, 0xee, 0x92, 0x98, 0x9b, 
+  0x02, 0xbd, 0xec, 0x63, 0x6b, 0x1f, 0x25, 0x10, 0xd3, 0x59, 0xe4, 0xa4, 0x0c, 0xed, 0x39, 0xb8, 
+  0xd6, 0xa1, 0x0c, 0x4c, 0x34, 0x6d, 0xb1, 0xa3, 0x82, 0xec, 0xfd, 0x15, 0x9c, 0x3e, 0x9c, 0x35, 
+  0x1b, 0xf0, 0xb7, 0x92, 0x93, 0x77, 0x77, 0x77, 0x5f, 0x16, 0x1a, 0x76, 0x03, 0x74, 0xbc, 0x94, 
+  0xf0, 0xfb, 0xa8, 0xd1, 0xfe, 0xda, 0x7d, 0xf1, 0x0d, 0xe6, 0x16, 0xae, 0x86, 0x8f, 0x1a, 0x57, 
+  0x33, 0xce, 0x26, 0x82, 0x3b, 0x36, 0x2c, 0xc2, 0x7e, 0x5f, 0x08, 0x10, 0x74, 0xd6, 0x7d, 0x41, 
+  0x8b, 0x69, 0xd3, 0x82, 0xfa, 0xa0, 0x1b, 0xe6, 0xe6, 0xbd, 0x12, 0x7a, 0x58, 0x6b, 0xbd, 0x68, 
+  0x44, 0xd5, 0xa0, 0xc7, 0x46, 0x64, 0xcd, 0xf4, 0xa8, 0xc3, 0xb9, 0xe9, 0x38, 0x2d, 0xc4, 0x03, 
+  0xdd, 0x49, 0x61, 0x7f, 0x04, 0x9e, 0xd2, 0xe2, 0x2b, 0x03, 0x10, 0xe1, 0xe5, 0xcd, 0x53, 0x24, 
+  0xe4, 0x40, 0x5d, 0xfb, 0x7b, 0x50, 0xc1, 0xd7, 0xb0, 0x7f, 0x48, 0x2a, 0xa4, 0xdc, 0x82, 0x25, 
+  0x10, 0x8d, 0xc1, 0x67, 0x3e, 0x86, 0x35, 0x19, 0x34, 0x99, 0x98, 0x16, 0x67, 0xef, 0xaf, 0xae, 
+  0x2e, 0x90, 0x08, 0x33, 0x30, 0xa3, 0xc2, 0x22, 0x51, 0x6a, 0xa7, 0xc0, 0x28, 0x50, 0xa5, 0x33, 
+  0x17, 0xa7, 0x0d, 0xc9, 0x61, 0x3c, 0x65, 0xe3, 0x92, 0xd2, 0xb9, 0x1a, 0xd7, 0x28, 0x99, 0xa4, 
+  0xf8, 0x2b, 0x3b, 0x43, 0x97, 0x60, 0x82, 0x5a, 0x84, 0xa2, 0x8a, 0x79, 0x59, 0x3e, 0x6b, 0xc8, 
+  0xb5, 0x3b, 0x15, 0xc1, 0xfc, 0xce, 0x0c, 0xb8, 0x9e, 0x34, 0x65, 0x94, 0x3a, 0x31, 0x2e, 0x0e, 
+  0x7a, 0x2f, 0x5f, 0x66, 0xa8, 0x4a, 0x2e, 0xce, 0x35, 0xd0, 0x1b, 0x08, 0xd5, 0x67, 0x24, 0x59, 
+  0xc5, 0x3e, 0x8a, 0x16, 0x96, 0x5b, 0x55, 0x35, 0xe7, 0xa1, 0x88, 0x49, 0x00, 0x53, 0x28, 0x5a, 
+  0x0d, 0x53, 0x3c, 0xa7, 0x0f, 0x98, 0xfa, 0xf7, 0x6f, 0xd8, 0x8c, 0x23, 0xb6, 0xfd, 0x17, 0xf8, 
+  0xd0, 0x60, 0x54, 0x6f, 0x0c, 0x82, 0xc6, 0x61, 0xe1, 0xb4, 0x0b, 0xeb, 0x67, 0x2b, 0xf0, 0x1c, 
+  0x47, 0x60, 0xc0, 0xca, 0xf5, 0x50, 0x86, 0x82, 0xa9, 0x70, 0x55, 0x13, 0x7a, 0xaf, 0x0a, 0x54, 
+  0xb4, 0x08, 0x9f, 0x53, 0x68, 0x69, 0xff, 0x33, 0x0c, 0xac, 0x3e, 0x5b, 0xf8, 0x53, 0xb0, 0x81, 
+  0xfc, 0xd7, 0xc0, 0x21, 0x0f, 0xbd, 0xa3, 0xf0, 0x89, 0x66, 0x4e, 0x19, 0xb7, 0x41, 0x88, 0xa5, 
+  0x19, 0xc8, 0x98, 0xd7, 0xfa, 0x39, 0xcb, 0xe9, 0x4b, 0x55, 0xa8, 0x4c, 0x16, 0x31, 0x54, 0x97, 
+  0x6c, 0xa5, 0x59, 0x9a, 0x6b, 0x0a, 0x4b, 0x3d, 0x55, 0x90, 0xe2, 0x69, 0xb9, 0x37, 0x0f, 0x02, 
+  0xef, 0x05, 0x0f, 0xd0, 0x82, 0x27, 0xb8, 0xa4, 0x0b, 0x97, 0x10, 0xe2, 0x32, 0x8d, 0xcf, 0xa9, 
+  0xaa, 0xca, 0xe8, 0x45, 0x06, 0xab, 0x22, 0x20, 0x8d, 0x41, 0xa6, 0x7e, 0x6d, 0xa1, 0x4b, 0x2d, 
+  0x27, 0x8f, 0xa3, 0x55, 0x2d, 0xc3, 0xc5, 0xa0, 0x16, 0x3a, 0xd5, 0x6e, 0x3c, 0x38, 0x71, 0xb1, 
+  0x6f, 0x5b, 0xc9, 0x52, 0xb4, 0x4e, 0x8e, 0x84, 0xf1, 0x4e, 0x00, 0x12, 0x8d, 0x9c, 0xe2, 0x4a, 
+  0x3c, 0xa3, 0xa2, 0xc5, 0x77, 0x6e, 0x09, 0x9d, 0x41, 0x2d, 0x04, 0xed, 0x01, 0x58, 0xc0, 0xca, 
+  0xdd, 0x25, 0x87, 0x40, 0x5b, 0x9b, 0xdc, 0x02, 0x7b, 0xd9, 0x08, 0xa5, 0xd7, 0xd6, 0xbd, 0xd2, 
+  0xb5, 0x75, 0x2a, 0xd0, 0x50, 0x49, 0x8e, 0x9f, 0xdc, 0x71, 0x08, 0x0e, 0xeb, 0x89, 0xcb, 0x83, 
+  0xe9, 0x03, 0x90, 0xc4, 0x15, 0x40, 0x5e, 0xb4, 0x8a, 0x87, 0x62, 0x3e, 0x65, 0x20, 0x9f, 0x47, 
+  0x0d, 0xec, 0xa1, 0x1f, 0x87, 0xec, 0xde, 0x8c, 0xcd, 0x90, 0xbf, 0xdc, 0xdf, 0xb9, 0xdc, 0x75, 
+  0xde, 0x9d, 0x1f, 0x3b, 0xb3, 0xe1, 0xbf, 0x86, 0x6f, 0x87, 0xc3, 0xe3, 0xce, 0x70, 0x74, 0x37, 
+  0xa4, 0x3f, 0xf4, 0x3c, 0x1c, 0x0d, 0x8f, 0xa1, 0x3f, 0x85, 0x1d, 0x41, 0xe1, 0x73, 0xcf, 0xb5, 
+  0xe6, 0x61, 0xfb, 0x37, 0x7f, 0x0a, 0x8a, 0xde, 0x11, 0x53, 0xd0, 0xd2, 0x0a, 0x8f, 0x94, 0xb5, 
+  0x2c, 0xa6, 0x2c, 0x8e, 0x58, 0x37, 0xff, 0xc2, 0x15, 0x87, 0x8a, 0xc9, 0xad, 0xa7, 0x79, 0xbe, 
+  0x6e, 0x36, 0xe2, 0xb1, 0xf4, 0x36, 0xe6, 0x3b, 0x3b, 0x51, 0xaf, 0xd4, 0x1a, 0x2a, 0x66, 0x84, 
+  0x9f, 0xf7, 0xe7, 0x62, 0x3a, 0x97, 0xf7, 0x07, 0x20, 0x55, 0x21, 0x43, 0x4e, 0xf0, 0xe0, 0x9f, 
+  0x4f, 0x6d, 0xf7, 0xa2, 0x3e, 0x43, 0x02, 0xdf, 0x58, 0x61, 0x66, 0x78, 0x7b, 0x0a, 0x32, 0x6d, 
+  0xea, 0x68, 0xab, 0x5e, 0xee, 0x22, 0xfc, 0x36, 0x08, 0xa7, 0xcb, 0x6f, 0x43, 0x8e, 0xeb, 0xb7, 
+  0x8e, 0x06, 0xda, 0x18, 0x94, 0xbe, 0xc2, 0xb5, 0xf0, 0x4e, 0x16, 0x52, 0x08, 0xa0, 0x22, 0xe6, 
+  0x7a, 0x01, 0x4c, 0xd1, 0xd4, 0x43, 0x41, 0x75, 0x5d, 0xdb, 0x17, 0x49, 0x6f, 0xd9, 0x67, 0x6c, 
+  0xc3, 0x32, 0x6a, 0xfe, 0x91, 0x1c, 0xf8, 0x04, 0x73, 0xef, 0xbb, 0xd1, 0xdf, 0xd5, 0x13, 0xfb, 
+  0x91, 0x38, 0xde, 0x05, 0x42, 0xf2, 0x16, 0xa0, 0x00, 0x0b, 0x81, 0x32, 0x5c, 0x13, 0x37, 0xe7, 
+  0x11, 0xf8, 0xaa, 0x2e, 0x1a, 0x4f, 0x43, 0x59, 0xc3, 0xf8, 0xc0, 0x8c, 0xf7, 0xc3, 0x56, 0x17, 
+  0x8c, 0xb8, 0x3b, 0xe5, 0x81, 0x0f, 0x9a, 0x43, 0xb2, 0xa6, 0x47, 0x1b, 0x1d, 0xa6, 0xb3, 0xfd, 
+  0xbd, 0x88, 0x3e, 0x49, 0x7a, 0x8b, 0x46, 0x12, 0x87, 0x35, 0x0a, 0xa4, 0x1f, 0xdd, 0x2a, 0x03, 
+  0x96, 0x02, 0x8e, 0xc3, 0xc6, 0x9c, 0xe9, 0x91, 0x30, 0x31, 0x61, 0x3e, 0x58, 0x3e, 0x50, 0xa3, 
+  0x0c, 0xa7, 0x47, 0xec, 0xb4, 0x96, 0x41, 0x61, 0xaf, 0x8e, 0xfb, 0x07, 0xbd, 0x7e, 0xf7, 0x45, 
+  0xff, 0xed, 0x49, 0xff, 0xf8, 0x55, 0xff, 0xed, 0xa8, 0xff, 0xaa, 0xd7, 0x7f, 0x71, 0xd0, 0x3f, 
+  0x78, 0xd5, 0xc7, 0x57, 0x27, 0xfd, 0xfd, 0xdd, 0xfe, 0xf1, 0x7e, 0xff, 0x60, 0xb7, 0xff, 0x76, 
+  0xd8, 0xef, 0x0e, 0xfb, 0xaf, 0x4f, 0xfb, 0x07, 0x6f, 0xfb, 0x07, 0xc7, 0xfd, 0xe3, 0x21, 0x2b, 
+  0x70, 0x89, 0xab, 0xdc, 0x38, 0x24, 0xf0, 0x68, 0x1e, 0x66, 0x1c, 0x39, 0x5d, 0x56, 0xe9, 0xca, 
+  0xe9, 0x3a, 0x6b, 0x39, 0x73, 0x39, 0xb8, 0x4b, 0xee, 0x5c, 0xde, 0xa3, 0x5a, 0x29, 0x21, 0x20, 
+  0x20, 0xda, 0xaa, 0xe8, 0x45, 0x16, 0xa8, 0x66, 0x55, 0x50, 0xe2, 0x9d, 0x75, 0x61, 0x21, 0x7e, 
+  0x14, 0x85, 0x80, 0x22, 0x70, 0x56, 0xd4, 0x56, 0x8d, 0xe2, 0xdf, 0x3c, 0xa4, 0x31, 0x7c, 0xf2, 
+  0xb6, 0x52, 0xee, 0xdb, 0x78, 0x90, 0x65, 0x5b, 0x7d, 0x34, 0xb3, 0xf1, 0x9a, 0x55, 0x18, 0xa4, 
+  0x07, 0x95, 0x0e, 0xff, 0x79, 0xa1, 0x0c, 0xab, 0xc7, 0xb6, 0x22, 0xf2, 0x97, 0x19, 0x42, 0x7d, 
+  0xc7, 0xf9, 0xe3, 0xbf, 0xae, 0xae, 0x6a, 0x99, 0xcd, 0xf9, 0xef, 0x52, 0xd6, 0xb2, 0x99, 0x99, 
+  0x8a, 0x59, 0x83, 0x99, 0x7d, 0x95, 0x58, 0x4b, 0x85, 0x44, 0xda, 0x54, 0xa6, 0xa7, 0x8e, 0x70, 
+  0x27, 0x5e, 0xa3, 0x40, 0xbc, 0xa5, 0x37, 0x9d, 0x3a, 0xbc, 0x8d, 0x65, 0xcd, 0xe7, 0xf8, 0x7a, 
+  0x87, 0x85, 0x33, 0xef, 0xee, 0x23, 0x74, 0x72, 0x06, 0x4d, 0xb6, 0xf3, 0xd1, 0xcd, 0x2c, 0x21, 
+  0x4a, 0xa2, 0x87, 0x29, 0x00, 0x8d, 0xc8, 0x9d, 0x33, 0x88, 0xf2, 0xcc, 0x5f, 0x8c, 0x1d, 0x11, 
+  0xce, 0x60, 0xc2, 0x4b, 0xaf, 0x5f, 0x6d, 0x25, 0xbf, 0xa2, 0x6b, 0xd3, 0x92, 0x9e, 0x2f, 0xac, 
+  0x6f, 0x9d, 0xaf, 0x8a, 0x73, 0xdf, 0xd4, 0xde, 0x49, 0xad, 0xc5, 0x1c, 0xa8, 0x91, 0x76, 0x59, 
+  0x94, 0x74, 0x6b, 0x8b, 0x3d, 0x03, 0x11, 0x4b, 0x53, 0x9b, 0x3a, 0x22, 0xe9, 0x2e, 0x2a, 0x85, 
+  0x26, 0x91, 0x01, 0x4e, 0x24, 0xbe, 0x03, 0xd2, 0xca, 0xba, 0xd9, 0x45, 0x90, 0x16, 0x18, 0xa0, 
+  0x15, 0x05, 0x7b, 0xd1, 0x35, 0x84, 0x65, 0x09, 0x0b, 0x17, 0x63, 0xdc, 0x73, 0x1e, 0xc3, 0x5a, 
+  0x77, 0xbd, 0x81, 0xe3, 0x26, 0x51, 0x47, 0xb8, 0x9d, 0xaf, 0x18, 0xd1, 0x35, 0x5d, 0xfb, 0x07, 
+  0xa3, 0x40, 0x84, 0xde, 0x73, 0x63, 0x94, 0xa7, 0xc4, 0x8f, 0x80, 0xd5, 0xbb, 0x51, 0x81, 0xeb, 
+  0xa2, 0x59, 0x03, 0xd6, 0xc6, 0xf7, 0xdc, 0x90, 0x6f, 0x2c, 0x93, 0xd4, 0x8b, 0x07, 0x53, 0x3d, 
+  0x82, 0xf4, 0x43, 0x0d, 0x1f, 0x11, 0x7b, 0x7e, 0xfe, 0x0b, 0x7b, 0xc9, 0xf6, 0x7a, 0xcb, 0x44, 
+  0x88, 0xc4, 0xb4, 0x4a, 0x47, 0xe7, 0x95, 0xd0, 0x78, 0xf0, 0x1e, 0x34, 0xec, 0xb2, 0x3f, 0x54, 
+  0xe9, 0x24, 0x10, 0x10, 0xed, 0x16, 0xaf, 0x76, 0x38, 0x56, 0xd3, 0x8e, 0x6d, 0x29, 0xff, 0x74, 
+  0x6b, 0x87, 0x6d, 0x49, 0x58, 0x18, 0xb7, 0xe7, 0x5e, 0xf8, 0xfb, 0x42, 0x80, 0x75, 0x44, 0x0f, 
+  0x17, 0x4b, 0xbb, 0xaf, 0x7b, 0xed, 0xee, 0xcb, 0x83, 0x76, 0xb7, 0xbd, 0xbf, 0x95, 0x33, 0xf4, 
+  0xeb, 0x8d, 0x36, 0x1b, 0x2a, 0x54, 0x80, 0xc6, 0x8e, 0xe9, 0xde, 0xb0, 0x16, 0x73, 0xbd, 0x5c, 
+  0x64, 0x28, 0xee, 0xa9, 0x2e, 0x4d, 0x30, 0x58, 0x58, 0x87, 0x22, 0x9b, 0xe1, 0x9e, 0x0d, 0xf0, 
+  0x3d, 0x35, 0xee, 0x14, 0xb6, 0xae, 0xe7, 0x07, 0xd7, 0x76, 0x6d, 0x97, 0xc7, 0xf0, 0x36, 0x9e, 
+  0x6b, 0x9b, 0xc8, 0x1c, 0x35, 0x7c, 0x22, 0x91, 0x8b, 0xe7, 0x58, 0x56, 0x9e, 0x66, 0xbd, 0xfa, 
+  0x03, 0x32, 0x3c, 0xc7, 0x0c, 0xd8, 0xc5, 0x35, 0x78, 0x7b, 0x30, 0x15, 0xe4, 0x63, 0x8c, 0x33, 
+  0x81, 0x3a, 0x26, 0x30, 0xdb, 0x29, 0xd7, 0x25, 0x0a, 0x9d, 0xd4, 0xb2, 0xcf, 0x29, 0x18, 0x59, 
+  0xdf, 0xab, 0x00, 0x79, 0xb5, 0x55, 0x86, 0x0a, 0xe3, 0xf8, 0x01, 0xe6, 0x03, 0x08, 0x8d, 0xe3, 
+  0x3c, 0x30, 0xd3, 0xfe, 0x6d, 0x11, 0x4a, 0x8a, 0xb2, 0x4e, 0x39, 0x0b, 0x4c, 0xc9, 0x19, 0x2a, 
+  0x47, 0x9b, 0x81, 0x1b, 0x1d, 0x46, 0x83, 0x9d, 0x02, 0xdd, 0x54, 0x10, 0x9e, 0x79, 0x01, 0xe3, 
+  0xf7, 0xb4, 0xd3, 0xe7, 0x7b, 0x77, 0x3c, 0x60, 0xcd, 0x69, 0x20, 0x6c, 0x28, 0xc2, 0x6c, 0xae, 
+  0xed, 0x76, 0xca, 0x6e, 0x02, 0xe7, 0xbb, 0x6d, 0x58, 0x26, 0x06, 0xc0, 0x05, 0xd6, 0xb4, 0xf9, 
+  0xc4, 0x5c, 0x38, 0x72, 0x5b, 0x67, 0x17, 0x00, 0xdd, 0x0f, 0x17, 0x0e, 0xa5, 0x32, 0x95, 0xaf, 
+  0x30, 0x46, 0x0a, 0x27, 0x53, 0x62, 0xe0, 0x57, 0xcc, 0x17, 0x73, 0x66, 0x2d, 0x82, 0x00, 0x97, 
+  0x16, 0x21, 0x97, 0x6c, 0xfc, 0xc0, 0x70, 0x6b, 0x36, 0x0e, 0xe5, 0x76, 0x00, 0x14, 0x00, 0x26, 
+  0xa8, 0xe3, 0x41, 0xaf, 0xcd, 0x4e, 0x2c, 0x4f, 0xf7, 0xb6, 0xb2, 0xa7, 0xb3, 0x09, 0x0c, 0x17, 
+  0x88, 0x11, 0x0f, 0x78, 0xc2, 0x81, 0x02, 0xe6, 0xad, 0x29, 0x1c, 0xe5, 0xd2, 0xa7, 0xc9, 0x23, 
+  0x42, 0x36, 0xf7, 0xec, 0x85, 0x03, 0xbf, 0xed, 0x84, 0x56, 0xd0, 0x67, 0x01, 0xb9, 0xda, 0x29, 
+  0x57, 0x54, 0x63, 0xb8, 0x02, 0x0f, 0x22, 0xe7, 0xcf, 0x67, 0x9d, 0xd6, 0x09, 0x6b, 0x82, 0x27, 
+  0x2c, 0x24, 0x30, 0x97, 0x9d, 0xcd, 0x91, 0xbc, 0xac, 0xc3, 0x5c, 0x3e, 0x35, 0xa9, 0xe4, 0x44, 
+  0x11, 0x5c, 0x21, 0x0a, 0x18, 0x95, 0xe0, 0x1a, 0x2d, 0xcf, 0x52, 0x08, 0x3f, 0x24, 0x75, 0x11, 
+  0xe9, 0x34, 0x33, 0xd7, 0xc7, 0x16, 0x39, 0x80, 0xdd, 0x87, 0x0e, 0xe7, 0x3e, 0xac, 0x73, 0x74, 
+  0xef, 0x18, 0xea, 0xd2, 0x5d, 0xc3, 0x6f, 0x76, 0x07, 0x4a, 0x2a, 0xa1, 0x6d, 0x27, 0x2b, 0x40, 
+  0x03, 0x36, 0x87, 0x2a, 0x29, 0xa4, 0xdb, 0xf5, 0x31, 0x18, 0x65, 0x3a, 0x73, 0x3d, 0xc9, 0x7c, 
+  0x13, 0x14, 0xf2, 0x1b, 0x26, 0x67, 0x44, 0x13, 0x4f, 0xd8, 0x61, 0xd4, 0xdb, 0x1d, 0x87, 0xee, 
+  0x81, 0x51, 0xa0, 0x31, 0x15, 0xda, 0x01, 0x77, 0x4c, 0x20, 0x86, 0x6b, 0xeb, 0xa2, 0x42, 0x49, 
+  0x2a, 0xeb, 0xf9, 0x50, 0x0c, 0x3e, 0x79, 0x12, 0xa8, 0x7d, 0x26, 0xb7, 0xa0, 0xa7, 0x30, 0x5c, 
+  0xcc, 0xd1, 0xf1, 0x98, 0x81, 0xb0, 0x12, 0x70, 0x35, 0x36, 0x40, 0x42, 0xb8, 0x96, 0xb3, 0xb0, 
+  0x91, 0x49, 0xaa, 0x6b, 0xe2, 0x2f, 0x72, 0x0d, 0xba, 0x13, 0x83, 0x7c, 0xe0, 0xfd, 0x11, 0x46, 
+  0x9d, 0x54, 0xc1, 0xc5, 0x75, 0x0b, 0x84, 0x8f, 0x91, 0xd2, 0xd4, 0xc2, 0x5f, 0xdb, 0xb8, 0x63, 
+  0xfb, 0x1d, 0xbd, 0x90, 0x27, 0x1f, 0xe6, 0x28, 0xe7, 0xc3, 0x20, 0xea, 0x5f, 0x04, 0x07, 0x3d, 
+  0x52, 0x23, 0xe4, 0x00, 0xab, 0x5e, 0xa9, 0xc2, 0x82, 0x51, 0x64, 0x8a, 0x48, 0xd2, 0x5b, 0xa5, 
+  0xa8, 0x63, 0x05, 0x8b, 0x0b, 0x21, 0x35, 0x10, 0xdc, 0x4b, 0x8c, 0x04, 0xb8, 0x4a, 0x51, 0x65, 
+  0xf6, 0x1f, 0xd6, 0xa4, 0xde, 0x3b, 0x64, 0x4b, 0x93, 0xe6, 0xdd, 0x76, 0x8a, 0x7c, 0xeb, 0xd9, 
+  0x2a, 0x4d, 0xa0, 0x4a, 0x22, 0x12, 0xaa, 0x8f, 0x22, 0x61, 0x77, 0x15, 0x09, 0x33, 0x63, 0x59, 
+  0x87, 0x8c, 0x39, 0x75, 0xb0, 0xbc, 0x8c, 0xae, 0x0c, 0xaf, 0xe0, 0x5a, 0x31, 0x13, 0x5b, 0xc1, 
+  0x82, 0xca, 0xc0, 0x0a, 0x56, 0x58, 0x2b, 0xaa, 0x92, 0x86, 0xb8, 0x76, 0x48, 0x65, 0x69, 0xc5, 
+  0xfd, 0x88, 0x78, 0x0a, 0xc1, 0x5a, 0x37, 0x98, 0x92, 0x9b, 0xdf, 0x75, 0x76, 0x10, 0xce, 0x67, 
+  0xf3, 0x28, 0xb3, 0xe5, 0xa9, 0xb7, 0x0e, 0xbc, 0xd9, 0x7c, 0xd3, 0x6d, 0x03, 0x68, 0x5a, 0x2b, 
+  0xfc, 0x91, 0xae, 0x97, 0x8d, 0x7e, 0x64, 0xde, 0x24, 0xc1, 0x8f, 0x64, 0xb8, 0xd9, 0x10, 0x48, 
+  0x3e, 0x32, 0x8e, 0xb8, 0x5b, 0x5e, 0x27, 0xf2, 0xe7, 0x1a, 0x2a, 0x19, 0xda, 0xf5, 0x26, 0x9e, 
+  0xe3, 0x78, 0x77, 0x60, 0x17, 0x50, 0x2a, 0xd9, 0x7b, 0x1e, 0x70, 0x14, 0xfa, 0xff, 0xf5, 0x84, 
+  0xab, 0xe3, 0xdf, 0x2b, 0x35, 0x43, 0x16, 0xe5, 0x14, 0xf9, 0xe7, 0x6a, 0x13, 0x27, 0x84, 0xae, 
+  0x4c, 0x98, 0x68, 0x62, 0xce, 0xb1, 0x89, 0x2d, 0xd0, 0xca, 0x87, 0x91, 0x5d, 0xa1, 0xdc, 0xa2, 
+  0x40, 0x58, 0x42, 0x3e, 0x90, 0xa2, 0x6f, 0xb3, 0xcf, 0x68, 0xfa, 0x6c, 0x11, 0x48, 0x65, 0x69, 
+  0x16, 0x6e, 0x08, 0xde, 0x96, 0x29, 0xd4, 0x70, 0x95, 0x91, 0xf0, 0xc1, 0x9f, 0x97, 0x21, 0x93, 
+  0x94, 0x48, 0xe5, 0xee, 0x30, 0x6f, 0x11, 0x30, 0x5c, 0x55, 0x60, 0x57, 0x16, 0x47, 0x63, 0x6f, 
+  0xa2, 0x69, 0x13, 0x13, 0xed, 0xe6, 0xe3, 0x90, 0x70, 0x32, 0x30, 0x4e, 0xdb, 0x4b, 0xed, 0xf5, 
+  0x87, 0x85, 0x99, 0x6d, 0xb3, 0x39, 0x7b, 0x0f, 0x3d, 0xa5, 0xb3, 0x3d, 0xcb, 0xc2, 0x6c, 0xd8, 
+  0x78, 0x06, 0x75, 0x97, 0x52, 0xe4, 0xd6, 0xee, 0xb1, 0x28, 0x21, 0xa7, 0x52, 0xad, 0x02, 0x14, 
+  0x0c, 0xac, 0x3f, 0xd1, 0xfa, 0x2a, 0x87, 0x53, 0x28, 0x03, 0xcf, 0x9d, 0x0e, 0x7e, 0x35, 0x86, 
+  0xb0, 0x9a, 0x1a, 0x01, 0x34, 0x10, 0x4d, 0x57, 0x98, 0xe4, 0x0a, 0xc2, 0x48, 0xd5, 0xdb, 0x54, 
+  0xc0, 0x4c, 0xef, 0x65, 0x63, 0x1a, 0x23, 0xba, 0x3a, 0x2f, 0x5e, 0xb6, 0x7b, 0x2f, 0xfe, 0xc1, 
+  0x76, 0xf1, 0xbf, 0x37, 0xca, 0x55, 0xf3, 0xdc, 0x3e, 0x7a, 0x15, 0xe8, 0xa1, 0xbd, 0x41, 0x1f, 
+  0x41, 0xef, 0x81, 0xe3, 0x74, 0x8b, 0x44, 0x17, 0x93, 0xc2, 0xc1, 0xd3, 0xba, 0x05, 0x01, 0xf2, 
+  0x68, 0x0f, 0xe8, 0x56, 0xd8, 0xdc, 0xeb, 0x74, 0xbb, 0xaf, 0xf7, 0xbb, 0xaf, 0x0f, 0x5e, 0xbd, 
+  0x88, 0x13, 0xc8, 0x63, 0x88, 0xe6, 0x18, 0x6c, 0xc6, 0x42, 0xf2, 0x37, 0xa0, 0xc5, 0xfb, 0xbb, 
+  0x6f, 0x70, 0x9e, 0xc2, 0x3f, 0x6a, 0x47, 0xbd, 0xbb, 0xbb, 0xfb, 0x8f, 0x37, 0x7a, 0x3f, 0x9d, 
+  0x7e, 0x2f, 0xef, 0xa7, 0xdf, 0xf1, 0xf1, 0x0d, 0xd2, 0x0a, 0x26, 0x06, 0x26, 0xeb, 0x86, 0x56, 
+  0xc0, 0x41, 0x24, 0xe7, 0xde, 0x1f, 0xf9, 0xa2, 0xdc, 0xf3, 0x20, 0xde, 0x33, 0x57, 0x0a, 0xeb, 
+  0x50, 0x1d, 0xb6, 0x58, 0x31, 0x1a, 0x0c, 0x59, 0xe8, 0xc2, 0xdf, 0x54, 0x40, 0x96, 0x5a, 0xad, 
+  0x3d, 0xed, 0xd8, 0x2f, 0xfc, 0x81, 0x59, 0x20, 0x94, 0xe0, 0xbc, 0x7a, 0x63, 0x4a, 0xbe, 0x27, 
+  0xdf, 0xd5, 0x81, 0xb5, 0x14, 0x3a, 0x7c, 0x82, 0xa6, 0x41, 0x32, 0x3f, 0xd1, 0xe6, 0x4a, 0x98, 
+  0x4c, 0x86, 0xda, 0x08, 0x0f, 0x69, 0xb6, 0x39, 0x20, 0x27, 0x60, 0xdf, 0x70, 0x66, 0xd2, 0x91, 
+  0x09, 0x68, 0x44, 0xc7, 0x3e, 0x98, 0x01, 0xd2, 0x6c, 0x71, 0x76, 0x11, 0x78, 0xbf, 0x41, 0xdb, 
+  0xb0, 0x41, 0xf2, 0x78, 0x72, 0x0f, 0x2b, 0x27, 0xc4, 0x29, 0x1a, 0x1c, 0xf4, 0x25, 0x5c, 0x44, 
+  0x4d, 0x2b, 0x7a, 0xc5, 0x2e, 0x1e, 0x88, 0xc9, 0x43, 0x0b, 0x4a, 0x5b, 0x38, 0x27, 0x3a, 0xe7, 
+  0xbe, 0x7b, 0xe2, 0x5d, 0x87, 0x5c, 0x6f, 0x98, 0x0c, 0x00, 0x6f, 0xb5, 0xd1, 0x1d, 0xbd, 0xa8, 
+  0xbb, 0x3b, 0x01, 0x63, 0x81, 0xb6, 0x19, 0x03, 0xaa, 0x8a, 0x2a, 0x4d, 0xa8, 0xaa, 0xb2, 0x96, 
+  0x11, 0xcd, 0x42, 0xad, 0x4c, 0x34, 0x29, 0xd9, 0x20, 0xdf, 0x2b, 0xdd, 0x20, 0x8f, 0x4f, 0x20, 
+  0x94, 0xa5, 0x8e, 0xc5, 0xdb, 0x9f, 0x22, 0x3c, 0x09, 0x02, 0x3a, 0x63, 0x13, 0x9b, 0x40, 0x06, 
+  0xff, 0xb7, 0x50, 0x00, 0xc9, 0x10, 0x32, 0x4e, 0xef, 0xd1, 0x1c, 0xee, 0xd3, 0x31, 0x13, 0x46, 
+  0x0d, 0xc0, 0x40, 0xed, 0xaf, 0x52, 0x58, 0x98, 0x68, 0x21, 0x79, 0x5a, 0x5d, 0x55, 0xe7, 0xb3, 
+  0x3d, 0xcb, 0x63, 0xd5, 0xdc, 0xde, 0xf9, 0x1b, 0x2b, 0xfd, 0x63, 0x85, 0x61, 0x9f, 0x7d, 0x45, 
+  0x43, 0x60, 0x3f, 0x64, 0x46, 0x74, 0x89, 0x25, 0xd5, 0x6d, 0x23, 0x10, 0xb1, 0xcf, 0x91, 0x6e, 
+  0x3f, 0x4a, 0x39, 0x14, 0xe9, 0xbc, 0xd7, 0x74, 0x15, 0xbd, 0xe2, 0xa9, 0xd7, 0x8b, 0xae, 0x9c, 
+  0xed, 0x64, 0x1d, 0x08, 0xc9, 0xba, 0x2e, 0x05, 0xc1, 0xd0, 0x85, 0x80, 0xe5, 0xb7, 0x72, 0xfe, 
+  0x29, 0x47, 0x26, 0x7a, 0xad, 0x4a, 0x0c, 0x10, 0x52, 0xb4, 0x60, 0x4a, 0x4e, 0xb4, 0xaf, 0x91, 
+  0x54, 0x52, 0x9b, 0x31, 0x35, 0xd8, 0x4a, 0xed, 0xf2, 0x99, 0xbd, 0x23, 0x15, 0x1c, 0x48, 0x32, 
+  0x79, 0x55, 0xfa, 0x45, 0xf2, 0x7c, 0xc5, 0xe7, 0x7e, 0xea, 0xad, 0x63, 0xfa, 0xe0, 0xf7, 0x66, 
+  0xd3, 0x7c, 0xa3, 0x74, 0xdd, 0x12, 0xf1, 0xc2, 0xb3, 0x6c, 0x86, 0xc4, 0x4c, 0x8e, 0xa6, 0xc6, 
+  0x09, 0x18, 0x84, 0xf9, 0xb8, 0xa0, 0x7b, 0x77, 0x77, 0x58, 0x6f, 0x9b, 0xfd, 0xcc, 0xb6, 0xd8, 
+  0x30, 0xed, 0xff, 0xe9, 0xf4, 0xda, 0x35, 0x40, 0xde, 0x99, 0x52, 0x86, 0xdc, 0x42, 0xb0, 0x7b, 
+  0x2f, 0xe9, 0xd8, 0x59, 0x0c, 0xf9, 0xe6, 0xf3, 0xec, 0x71, 0xb0, 0x25, 0x90, 0xa0, 0xab, 0x10, 
+  0x86, 0xff, 0x15, 0xd0, 0x9f, 0x6c, 0x3e, 0x7d, 0x33, 0x5a, 0x03, 0x6e, 0x2c, 0x0a, 0xe8, 0x05, 
+  0xb5, 0xb9, 0xa2, 0x63, 0xbe, 0x79, 0x94, 0xc3, 0xab, 0x99, 0x54, 0xc7, 0xe7, 0xd5, 0xf1, 0x9e, 
+  0x73, 0xda, 0xe8, 0x8e, 0xa4, 0x23, 0x63, 0x36, 0xee, 0x04, 0xd8, 0xbc, 0xb8, 0xff, 0x1d, 0x56, 
+  0x35, 0x83, 0x2b, 0xf3, 0x71, 0x43, 0x2e, 0x95, 0x0c, 0x66, 0xa2, 0x72, 0x5b, 0xca, 0x04, 0x61, 
+  0xc2, 0x54, 0xea, 0x3c, 0x5a, 0x78, 0x92, 0xc4, 0xcf, 0x8c, 0xba, 0x19, 0x5c, 0x25, 0x1d, 0xd0, 
+  0x7c, 0xca, 0xc3, 0x4f, 0xe6, 0x53, 0x63, 0x70, 0x81, 0xf1, 0x8b, 0xbc, 0x36, 0x9e, 0x05, 0xd5, 
+  0x84, 0x50, 0x0e, 0xd6, 0x15, 0xfa, 0xa4, 0x8e, 0x98, 0x0b, 0x99, 0x3e, 0x39, 0x41, 0x2e, 0x69, 
+  0xba, 0xa9, 0xca, 0x23, 0x00, 0x0d, 0x86, 0xdc, 0xfb, 0x80, 0xd5, 0xc3, 0x1a, 0x8a, 0x40, 0xb7, 
+  0xba, 0x52, 0xfb, 0x1b, 0x18, 0x4e, 0xdf, 0xaa, 0xdf, 0x4a, 0x67, 0xaf, 0x6f, 0xd1, 0x96, 0x57, 
+  0x9d, 0x76, 0xb7, 0xaa, 0x41, 0x8c, 0x61, 0x8d, 0x26, 0xd1, 0x92, 0xfb, 0xd9, 0xc2, 0x87, 0xc1, 
+  0x02, 0x35, 0xaf, 0xa2, 0xc6, 0x59, 0x65, 0x9a, 0xd1, 0xb2, 0x75, 0x74, 0xa8, 0x52, 0xf6, 0x68, 
+  0x38, 0x6d, 0x65, 0x3f, 0xed, 0x18, 0x32, 0xa3, 0x73, 0x2c, 0x8a, 0xc4, 0x85, 0x0e, 0x68, 0x11, 
+  0x9b, 0x74, 0x52, 0x58, 0x09, 0xa3, 0xd2, 0x8e, 0x6e, 0x11, 0xd3, 0xd4, 0xba, 0xbd, 0x36, 0xdb, 
+  0x1e, 0xcf, 0xc2, 0xa7, 0x60, 0x67, 0x01, 0x6b, 0x53, 0xe3, 0x58, 0x13, 0xc0, 0x12, 0xa3, 0x47, 
+  0x09, 0xa8, 0xc7, 0xb1, 0x7a, 0x05, 0xdb, 0x53, 0xfd, 0x14, 0x31, 0x7e, 0xa6, 0x13, 0x66, 0x96, 
+  0xdc, 0x8c, 0xb2, 0xb9, 0x1a, 0x24, 0xdc, 0x27, 0xb5, 0xd2, 0xcf, 0xe5, 0xf3, 0x88, 0x79, 0x36, 
+  0x73, 0x47, 0x53, 0xce, 0xc6, 0xb0, 0x25, 0xb5, 0x37, 0x54, 0xaa, 0x6a, 0xec, 0xdc, 0x45, 0x2e, 
+  0xd5, 0x80, 0xa9, 0xe8, 0x41, 0x94, 0x5a, 0x81, 0xeb, 0x86, 0xf5, 0x61, 0x7b, 0x7e, 0x11, 0xe8, 
+  0x38, 0x2f, 0xa8, 0x48, 0xf7, 0x29, 0xf3, 0x90, 0x00, 0x89, 0x15, 0x27, 0xba, 0xa5, 0xbf, 0x22, 
+  0xbb, 0xb8, 0xf2, 0x4b, 0xb9, 0xac, 0x27, 0x36, 0x4b, 0xbc, 0x3e, 0x8e, 0x61, 0x67, 0x58, 0xbd, 
+  0x0e, 0x6f, 0x13, 0xf4, 0xae, 0x31, 0xd5, 0x7c, 0x63, 0x38, 0xcf, 0x6a, 0xf9, 0x8a, 0x89, 0x40, 
+  0x69, 0xbb, 0x80, 0x3c, 0x4b, 0x46, 0x81, 0x2e, 0x51, 0xb5, 0x3d, 0x49, 0x1d, 0x1c, 0x5d, 0x22, 
+  0xeb, 0x5f, 0x46, 0xc3, 0x4d, 0xc7, 0xee, 0xf9, 0xe9, 0xa1, 0x8f, 0x4c, 0xd7, 0xe2, 0xce, 0xf2, 
+  0x59, 0xb1, 0x15, 0xc9, 0x3a, 0x85, 0xd4, 0x31, 0xed, 0x5b, 0x84, 0x66, 0x47, 0x29, 0xc1, 0xe0, 
+  0x3b, 0x44, 0xee, 0x5f, 0xa1, 0xb3, 0x98, 0xf7, 0x0d, 0x0b, 0xdd, 0xc0, 0x2b, 0xdc, 0x45, 0xd0, 
+  0x3e, 0x6b, 0xff, 0xe9, 0x5c, 0xb9, 0x32, 0x4f, 0x2e, 0xd7, 0x39, 0x1e, 0x4b, 0xdf, 0xb8, 0x57, 
+  0x5c, 0x9b, 0xa6, 0x1d, 0xd3, 0xea, 0x3e, 0x57, 0xbb, 0x69, 0xe9, 0x3c, 0x29, 0xed, 0xa7, 0x21, 
+  0xa9, 0xd9, 0x7f, 0x66, 0x03, 0x54, 0xaf, 0x05, 0x4b, 0x2e, 0x0c, 0x08, 0x4f, 0x2c, 0x0f, 0x91, 
+  0x19, 0x46, 0xfb, 0x5a, 0xca, 0xf9, 0x83, 0x75, 0x22, 0x05, 0xbf, 0x55, 0x88, 0x81, 0x76, 0x87, 
+  0xac, 0xe8, 0x60, 0xa1, 0xcd, 0x50, 0x2b, 0x33, 0x23, 0xd9, 0x93, 0xa2, 0xa0, 0x39, 0xc5, 0xc9, 
+  0xdb, 0x6a, 0x89, 0x19, 0xbf, 0x53, 0x18, 0x26, 0x87, 0x5c, 0x30, 0x9c, 0x90, 0xde, 0x6c, 0xf1, 
+  0x02, 0x56, 0x11, 0x71, 0x1f, 0x73, 0x98, 0xb9, 0x13, 0x0a, 0x5f, 0xe8, 0x20, 0x61, 0x1c, 0xcd, 
+  0xfc, 0x7b, 0x7c, 0x70, 0xbd, 0xe2, 0x40, 0x2f, 0x9d, 0xe7, 0x05, 0xf6, 0x34, 0xb7, 0xa2, 0xda, 
+  0x5b, 0xdb, 0xc5, 0xdb, 0xbb, 0xc9, 0x19, 0xdf, 0xe4, 0xc8, 0xbb, 0x39, 0xc0, 0xb6, 0xed, 0x12, 
+  0xc6, 0xd6, 0xdc, 0x57, 0xfe, 0x7f, 0xb7, 0x6d, 0xcc, 0x9a, 0x61, 0x76, 0x9b, 0x7f, 0xfb, 0xbf, 
+  0x1b, 0xc9, 0xff, 0xdd, 0x48, 0xfe, 0x51, 0x37, 0x92, 0x73, 0xfb, 0xc8, 0xd5, 0x7b, 0x83, 0xd0, 
+  0x5d, 0x3c, 0x56, 0xbc, 0xd9, 0x81, 0x62, 0xac, 0xa6, 0x13, 0x92, 0xa2, 0xc2, 0xf9, 0x71, 0x2b, 
+  0x4c, 0xd2, 0x60, 0x94, 0x41, 0x97, 0xc9, 0x93, 0x53, 0x53, 0x01, 0x1b, 0x75, 0xe8, 0x94, 0x90, 
+  0xa8, 0xdc, 0xd9, 0x2a, 0x0e, 0x10, 0xe6, 0x35, 0x75, 0xa3, 0x20, 0x94, 0xa7, 0x5c, 0x6f, 0xe5, 
+  0x5c, 0xa3, 0xf3, 0xfd, 0x8c, 0xab, 0x46, 0x14, 0x6e, 0x1a, 0x44, 0x9a, 0x01, 0xe6, 0xf6, 0x76, 
+  0xdc, 0xff, 0xa3, 0x8f, 0x14, 0xe9, 0x2e, 0xd6, 0x3b, 0x4c, 0xb4, 0x0a, 0x71, 0x0d, 0x14, 0xb1, 
+  0x26, 0xa5, 0x92, 0xa8, 0x93, 0xa2, 0x54, 0xd3, 0xf5, 0x88, 0x56, 0x78, 0x2d, 0x42, 0xdc, 0x66, 
+  0x06, 0xeb, 0x15, 0x52, 0xe1, 0xb4, 0xb9, 0x46, 0xbf, 0xfa, 0xf5, 0xf2, 0xba, 0xb1, 0x25, 0x5a, 
+  0xb3, 0x33, 0xca, 0xa8, 0x52, 0x5b, 0xc9, 0x4a, 0x69, 0x74, 0x94, 0xa6, 0xa8, 0x86, 0xa3, 0x7c, 
+  0x92, 0x04, 0x08, 0xb9, 0xfe, 0xda, 0x2d, 0x89, 0xd3, 0x07, 0x58, 0x72, 0xe9, 0x85, 0xde, 0x0c, 
+  0x8f, 0x00, 0x7e, 0x66, 0xad, 0x32, 0x98, 0x13, 0xe4, 0xbb, 0x54, 0x8b, 0x88, 0x66, 0x36, 0x02, 
+  0xa5, 0x88, 0xfa, 0x65, 0xa1, 0xde, 0x61, 0xbc, 0x9b, 0x38, 0xa1, 0x9e, 0x47, 0xc8, 0xca, 0x15, 
+  0x0d, 0x1a, 0x35, 0x08, 0x93, 0x48, 0xc8, 0x9f, 0xa8, 0xed, 0x46, 0x89, 0x9a, 0xa9, 0xb3, 0x85, 
+  0xa6, 0xb4, 0xd2, 0x97, 0x20, 0x1d, 0x96, 0x1e, 0xe6, 0xc3, 0xd3, 0x4f, 0xe4, 0xf7, 0x1a, 0xdc, 
+  0x0d, 0xc1, 0xdc, 0xd2, 0x2a, 0x3d, 0x2c, 0x71, 0x7f, 0x55, 0x9d, 0xc4, 0xfd, 0xbd, 0x56, 0xc9, 
+  0xc8, 0x05, 0x3e, 0xf0, 0x85, 0x70, 0x3c, 0x59, 0xc3, 0x0d, 0xd5, 0x19, 0xf9, 0x58, 0xbb, 0x59, 
+  0x16, 0x06, 0xcd, 0x42, 0xd6, 0xf1, 0x5a, 0xb0, 0xf5, 0x77, 0x1b, 0xb9, 0xb9, 0xf5, 0x42, 0xaf, 
+  0x39, 0xa7, 0x1a, 0xe3, 0x9f, 0xfd, 0xef, 0x1c, 0x39, 0x5d, 0xee, 0xb2, 0xb7, 0x71, 0x97, 0xbd, 
+  0x4d, 0xbb, 0xdc, 0xdb, 0xb8, 0xcb, 0xbd, 0x75, 0xba, 0x5c, 0xbd, 0x72, 0x08, 0xf1, 0x92, 0xa1, 
+  0x46, 0x55, 0x14, 0x37, 0xda, 0x4f, 0xa1, 0x5d, 0x4c, 0xf6, 0x2c, 0x2d, 0xd2, 0x88, 0x0a, 0x6d, 
+  0x78, 0xb2, 0x6c, 0xa9, 0xba, 0x76, 0x87, 0x84, 0x3d, 0x75, 0x85, 0xd1, 0x72, 0x27, 0x38, 0xdd, 
+  0xd3, 0xc1, 0x56, 0x9a, 0xfe, 0x33, 0x33, 0xbc, 0xbc, 0x1a, 0xe9, 0x08, 0x31, 0x85, 0x62, 0xfa, 
+  0x20, 0x84, 0x0c, 0xca, 0xc0, 0x55, 0x97, 0xa4, 0xbc, 0x63, 0x77, 0xb3, 0x0e, 0xd4, 0x32, 0xa0, 
+  0xc5, 0xe7, 0xb4, 0x50, 0xe7, 0x14, 0xc6, 0x5e, 0xa0, 0x3c, 0x15, 0x71, 0xc1, 0x5d, 0x6e, 0x50, 
+  0x78, 0xc2, 0x42, 0x50, 0x79, 0x63, 0x56, 0x16, 0xbf, 0x51, 0x88, 0x95, 0xc1, 0x48, 0xa5, 0xf0, 
+  0x16, 0x86, 0xa8, 0x56, 0x0d, 0x6b, 0xa5, 0xa1, 0xce, 0xf4, 0xa7, 0x98, 0xf4, 0xd1, 0x74, 0x17, 
+  0xa6, 0xf3, 0x74, 0x86, 0x7a, 0x89, 0x2c, 0x4f, 0x67, 0xae, 0x0b, 0xb0, 0x1f, 0x46, 0x45, 0x3a, 
+  0xf5, 0x3a, 0x8a, 0xcf, 0xe8, 0x2d, 0x7a, 0x75, 0x14, 0xbd, 0xa5, 0x04, 0x74, 0x6f, 0xd7, 0xbf, 
+  0x6f, 0x14, 0xef, 0x04, 0x28, 0x5c, 0x8d, 0x07, 0xd7, 0x4a, 0x07, 0x3b, 0xf4, 0x64, 0xd2, 0xff, 
+  0x28, 0x64, 0x55, 0xa4, 0x5f, 0xe5, 0xf3, 0xa9, 0x45, 0x1c, 0xfb, 0x80, 0xa7, 0x9d, 0xeb, 0x45, 
+  0xf4, 0xf5, 0x0a, 0x91, 0x5a, 0xfc, 0xb0, 0x41, 0xfd, 0x34, 0x92, 0x35, 0x5a, 0xc5, 0xc2, 0x1c, 
+  0x85, 0xaf, 0x8c, 0x54, 0xfb, 0x4d, 0x23, 0xf8, 0x69, 0x18, 0x85, 0x41, 0x7c, 0xe2, 0xc0, 0x47, 
+  0xf3, 0x9e, 0x69, 0x23, 0x55, 0x8f, 0xfe, 0x7a, 0x9d, 0x59, 0x9b, 0xfe, 0x9b, 0x86, 0xe4, 0x37, 
+  0x8e, 0xc3, 0x47, 0xc1, 0x77, 0x85, 0xe7, 0xc8, 0xf4, 0x4d, 0x4c, 0x55, 0xaa, 0xd3, 0x72, 0x05, 
+  0x1b, 0xd8, 0x9f, 0x7f, 0xc6, 0x6f, 0x46, 0x59, 0xe8, 0xf5, 0x62, 0x84, 0x45, 0xf1, 0xf6, 0x2c, 
+  0x9c, 0x22, 0x3e, 0x3d, 0x91, 0xc7, 0x14, 0xef, 0x1c, 0x17, 0xfa, 0x4a, 0x9f, 0x80, 0x2d, 0x89, 
+  0xa7, 0xc4, 0x0a, 0xbd, 0xa4, 0xfc, 0x64, 0x8d, 0x2c, 0x2f, 0x5b, 0xb5, 0x85, 0x6a, 0x5a, 0x12, 
+  0xf4, 0x63, 0x9a, 0x98, 0xe9, 0xb4, 0x85, 0x02, 0xdb, 0xae, 0x64, 0xf6, 0x31, 0x60, 0x3f, 0x0a, 
+  0x17, 0xa3, 0x22, 0xeb, 0x60, 0x09, 0x0b, 0xeb, 0x51, 0x4a, 0xb6, 0x97, 0x1d, 0xbc, 0xef, 0x86, 
+  0xab, 0x8a, 0xe0, 0xac, 0x85, 0xab, 0x79, 0xbf, 0x09, 0xae, 0xda, 0x6b, 0x36, 0xd0, 0x27, 0x5a, 
+  0xed, 0x3a, 0x45, 0xd7, 0x4e, 0x61, 0xed, 0x6a, 0x5f, 0x4c, 0xc3, 0x3d, 0x9f, 0x4c, 0xc0, 0x10, 
+  0xd4, 0x06, 0xec, 0x51, 0xf5, 0x47, 0xed, 0xa9, 0xaf, 0x14, 0x7e, 0x35, 0x6b, 0x93, 0x9d, 0x73, 
+  0xd3, 0x71, 0xae, 0x78, 0x28, 0xd3, 0xdb, 0xdd, 0xca, 0xc5, 0x32, 0x27, 0x5c, 0x3e, 0x3c, 0x2a, 
+  0xd0, 0x4b, 0x10, 0x36, 0x3f, 0xe4, 0x42, 0xcd, 0x09, 0x9f, 0xf7, 0x66, 0x60, 0xe3, 0xb5, 0x36, 
+  0xa0, 0x21, 0xb0, 0x4c, 0xdd, 0x83, 0x16, 0xb6, 0x99, 0xce, 0x1f, 0xb5, 0xf9, 0xad, 0x8a, 0x6a, 
+  0x34, 0xd5, 0x35, 0x98, 0x6c, 0xc0, 0xb2, 0x37, 0x93, 0x60, 0x6e, 0xb7, 0xde, 0x11, 0xe9, 0x68, 
+  0x95, 0x86, 0xa1, 0xc9, 0x45, 0xa8, 0xb2, 0xc4, 0xfc, 0xd9, 0x43, 0x88, 0x01, 0x4e, 0xf6, 0x61, 
+  0x74, 0x0c, 0x62, 0x33, 0xe7, 0xee, 0x82, 0x29, 0x83, 0xdd, 0x5e, 0x23, 0x89, 0x68, 0x99, 0x90, 
+  0xe9, 0x50, 0x36, 0xa0, 0xef, 0xea, 0x0b, 0xb3, 0x66, 0xfb, 0x83, 0xcf, 0xea, 0xe9, 0xd9, 0x33, 
+  0x15, 0x74, 0xfe, 0xe4, 0x49, 0xcc, 0xc3, 0x23, 0x64, 0xf4, 0x10, 0xf1, 0x74, 0x5c, 0xc8, 0x70, 
+  0xcc, 0x3a, 0xd0, 0x1b, 0xdf, 0x84, 0x2b, 0xcd, 0x1b, 0x28, 0xbc, 0x97, 0x81, 0xc9, 0x2c, 0x7c, 
+  0x3f, 0xe6, 0x78, 0x0f, 0x5d, 0x12, 0x38, 0x7b, 0xc0, 0x4c, 0xd2, 0x5b, 0x3e, 0x13, 0x16, 0xf0, 
+  0x24, 0xc6, 0x3f, 0xaf, 0xde, 0x10, 0xd5, 0x44, 0xbd, 0x45, 0x99, 0x39, 0x19, 0x1d, 0xb7, 0xec, 
+  0x35, 0x51, 0x3c, 0xbe, 0xcf, 0x5e, 0xa7, 0x73, 0xa2, 0x29, 0x3b, 0x27, 0x72, 0xcd, 0x41, 0x5e, 
+  0xdf, 0x9d, 0x9e, 0x31, 0x83, 0x3b, 0x13, 0x86, 0x3d, 0x64, 0x66, 0x70, 0x91, 0x17, 0x58, 0xe7, 
+  0xb2, 0xd4, 0x75, 0x1c, 0xc5, 0x98, 0x1b, 0xd3, 0x89, 0x40, 0x2c, 0x10, 0x89, 0x93, 0x24, 0xf7, 
+  0x73, 0x73, 0xb7, 0x31, 0xa7, 0x6e, 0x96, 0xc1, 0xab, 0xed, 0x4e, 0xfd, 0x40, 0xfb, 0x9d, 0xc7, 
+  0x4a, 0xd2, 0xec, 0x72, 0x1d, 0x54, 0x4a, 0xe1, 0x57, 0x95, 0x14, 0x26, 0x9c, 0x53, 0xf7, 0xcb, 
+  0xfc, 0x85, 0x54, 0x26, 0x54, 0x46, 0x58, 0xfe, 0x5d, 0xa8, 0xbc, 0x04, 0xfe, 0x49, 0xa9, 0x7c, 
+  0x50, 0x45, 0x65, 0x43, 0x2e, 0xac, 0x1b, 0x3c, 0x25, 0x20, 0xc1, 0x52, 0x81, 0x3e, 0xc1, 0x15, 
+  0x62, 0x76, 0x43, 0xf0, 0x3f, 0x4c, 0xeb, 0x10, 0x11, 0xba, 0xc4, 0xa0, 0xf3, 0xf7, 0x20, 0xf5, 
+  0x12, 0xf4, 0x27, 0xa5, 0x74, 0x77, 0xb7, 0x8a, 0xd4, 0x18, 0xb8, 0xc0, 0x0d, 0x8f, 0x45, 0xc0, 
+  0x9f, 0x56, 0xaa, 0xb3, 0x89, 0x21, 0x49, 0x34, 0x10, 0xfa, 0x23, 0xa1, 0x32, 0x16, 0x3e, 0x06, 
+  0x37, 0x23, 0xab, 0xb7, 0x01, 0x53, 0x62, 0x50, 0xdf, 0x83, 0x27, 0x79, 0xe0, 0x4f, 0xca, 0x92, 
+  0x17, 0x55, 0x1c, 0x39, 0x16, 0x68, 0x4e, 0xa9, 0xef, 0xbf, 0x4e, 0xe0, 0x6d, 0x44, 0xe2, 0xbb, 
+  0x11, 0x77, 0x09, 0xfa, 0x93, 0x52, 0x77, 0xbf, 0x8a, 0xba, 0xd7, 0x18, 0xff, 0xbc, 0xd4, 0xd7, 
+  0x22, 0xfe, 0x75, 0xf4, 0xbd, 0x05, 0x34, 0x22, 0x2c, 0xbe, 0x07, 0x85, 0x0b, 0xe0, 0x6f, 0x42, 
+  0x63, 0x9d, 0xb9, 0xa1, 0xb2, 0xc0, 0x23, 0x87, 0x65, 0x04, 0x28, 0xc9, 0xc2, 0x35, 0xd9, 0xbb, 
+  0xd3, 0xd1, 0x59, 0xed, 0xc0, 0xf5, 0x74, 0x62, 0x09, 0x0b, 0x41, 0x55, 0x7b, 0xf3, 0x9f, 0x3c, 
+  0xa6, 0x8c, 0x6e, 0x6d, 0xc0, 0xae, 0x37, 0x75, 0xed, 0x1a, 0x90, 0x33, 0x56, 0xa6, 0x36, 0x74, 
+  0x52, 0xd6, 0x15, 0xd0, 0xeb, 0x26, 0x76, 0xd4, 0x5d, 0x29, 0x47, 0xfe, 0x77, 0xc9, 0x52, 0x39, 
+  0xf5, 0xdd, 0x90, 0xaa, 0xbc, 0x9a, 0xe8, 0x72, 0xca, 0xda, 0xcb, 0xa1, 0x89, 0x6e, 0x50, 0x4d, 
+  0xc2, 0x8b, 0xc0, 0x93, 0x9e, 0xe5, 0x39, 0xb5, 0xc1, 0xfa, 0xba, 0x41, 0x25, 0xd8, 0xe4, 0xae, 
+  0xe2, 0x5e, 0x63, 0x45, 0x5a, 0xdf, 0x8f, 0x71, 0xab, 0x64, 0xd1, 0xa4, 0x89, 0x18, 0xc3, 0xd4, 
+  0xa7, 0x39, 0x9e, 0x96, 0x3b, 0xcb, 0x17, 0x80, 0x16, 0x30, 0xe7, 0x14, 0xa4, 0x6e, 0xc6, 0x0c, 
+  0xf1, 0x07, 0x5f, 0x6f, 0x63, 0x22, 0xba, 0x68, 0x2a, 0xf4, 0x27, 0x08, 0x41, 0xed, 0x4d, 0xf4, 
+  0xf6, 0x77, 0xd8, 0x2e, 0x2d, 0xec, 0x7f, 0x59, 0xb1, 0x15, 0x72, 0x1a, 0x70, 0xce, 0x2e, 0x87, 
+  0x1f, 0x37, 0xda, 0x0d, 0x99, 0x40, 0xe3, 0x2f, 0x33, 0x6e, 0xfa, 0x6b, 0xf6, 0x9a, 0x16, 0x99, 
+  0x1f, 0x53, 0x2e, 0x56, 0xea, 0x85, 0xc6, 0xb2, 0x41, 0x2b, 0xd9, 0xa0, 0x29, 0x3e, 0xa9, 0xb2, 
+  0xb4, 0x06, 0x5e, 0x33, 0xff, 0x16, 0xfe, 0x14, 0xee, 0xfb, 0xfc, 0xf9, 0x27, 0x2b, 0xef, 0x23, 
+  0xde, 0x15, 0x3a, 0x56, 0x1f, 0x5f, 0xc9, 0xdc, 0x43, 0xba, 0x7a, 0xf7, 0x62, 0x69, 0x87, 0xc9, 
+  0x10, 0x78, 0x20, 0xec, 0x09, 0x37, 0x2f, 0x72, 0x0a, 0xf5, 0x09, 0xf7, 0x2e, 0x52, 0x90, 0x69, 
+  0xe3, 0x42, 0x3f, 0x17, 0x25, 0x1a, 0x54, 0x9f, 0xed, 0xda, 0x2f, 0x3b, 0xdb, 0x75, 0xa9, 0x3f, 
+  0x73, 0x52, 0x7e, 0x84, 0x03, 0xb7, 0xe8, 0xd9, 0x9c, 0xcb, 0x99, 0x07, 0x2d, 0xa7, 0xf8, 0x55, 
+  0x24, 0x93, 0x56, 0x4a, 0x47, 0x8d, 0xa0, 0x40, 0x73, 0x46, 0x9f, 0x4d, 0x51, 0xb1, 0x76, 0xba, 
+  0xca, 0x69, 0xa4, 0xee, 0xc6, 0xca, 0x5c, 0x5c, 0xb0, 0xfa, 0x98, 0xbc, 0xba, 0x3c, 0x9f, 0xc0, 
+  0xb1, 0xe8, 0xba, 0xe9, 0xbd, 0x5e, 0xe9, 0xa5, 0x87, 0x73, 0xbb, 0x51, 0xef, 0xc6, 0x40, 0xee, 
+  0xda, 0xe9, 0x09, 0x06, 0xf0, 0x0d, 0x8e, 0xcc, 0xc1, 0xbf, 0xf3, 0x27, 0x34, 0x0a, 0x6e, 0xa6, 
+  0x0f, 0x54, 0xfc, 0x8e, 0xc2, 0xd4, 0x48, 0x99, 0xba, 0xd9, 0x95, 0x44, 0x09, 0x1d, 0xbe, 0x3a, 
+  0xd5, 0x49, 0x80, 0x65, 0xdb, 0xf8, 0xd1, 0xfb, 0x44, 0xa3, 0x1f, 0x27, 0xdf, 0xc4, 0x2a, 0x54, 
+  0xee, 0xcf, 0x4f, 0xdf, 0x26, 0x9a, 0x10, 0xa3, 0x5c, 0x6f, 0x4d, 0xeb, 0xc6, 0xc1, 0xee, 0x81, 
+  0xfa, 0x8e, 0x17, 0xb0, 0xe6, 0x6e, 0xeb, 0xd5, 0x76, 0xa1, 0x2a, 0x7d, 0x7e, 0x7a, 0x9c, 0x34, 
+  0xd5, 0xde, 0x1a, 0xd3, 0xd6, 0xbe, 0xa8, 0xf6, 0x49, 0x52, 0x3b, 0xba, 0x09, 0xb6, 0xbc, 0xf2, 
+  0x45, 0x52, 0xf9, 0x7c, 0x21, 0x89, 0xf1, 0x78, 0x1b, 0xb8, 0x29, 0xd9, 0x3d, 0x7b, 0x60, 0xd1, 
+  0x59, 0x58, 0x55, 0x28, 0x3d, 0x8a, 0xcf, 0x35, 0xf1, 0x0d, 0x16, 0x94, 0xa1, 0x7b, 0x99, 0xc0, 
+  0xa4, 0x8b, 0x8d, 0xab, 0xfa, 0x37, 0x92, 0xba, 0x17, 0x0b, 0x9d, 0x7a, 0x85, 0xe7, 0xac, 0x31, 
+  0x1d, 0x6d, 0xf3, 0x13, 0x4d, 0xc4, 0xcb, 0x77, 0x5c, 0x46, 0x92, 0x5d, 0xc6, 0xc7, 0x77, 0x5c, 
+  0xae, 0xc1, 0xc2, 0x77, 0x7b, 0x09, 0xb2, 0x04, 0x5c, 0xe5, 0xa2, 0xd0, 0xf9, 0x1f, 0x75, 0xa2, 
+  0x82, 0x75, 0x5f, 0xb4, 0xe6, 0xc2, 0x5d, 0x48, 0x1e, 0xb2, 0x66, 0x17, 0xb3, 0x8f, 0x77, 0x93, 
+  0xe7, 0x1e, 0x3c, 0x83, 0x99, 0xc8, 0x7f, 0x6e, 0x21, 0x01, 0x3f, 0xcc, 0x82, 0x1f, 0xce, 0x61, 
+  0x4e, 0x73, 0x1d, 0x1a, 0xef, 0xa8, 0x40, 0xf6, 0x8e, 0x32, 0x97, 0x4c, 0xc5, 0xa9, 0x4b, 0xe0, 
+  0x8c, 0xb2, 0x70, 0xa2, 0x2c, 0x4c, 0x2b, 0xda, 0xd0, 0x09, 0xf0, 0x4b, 0x34, 0x3b, 0x74, 0x53, 
+  0xfb, 0x14, 0x5c, 0x88, 0x12, 0x28, 0x27, 0x59, 0x28, 0xfa, 0xa6, 0x6b, 0xfc, 0xda, 0xcc, 0xdc, 
+  0x0f, 0x19, 0x38, 0x05, 0xd3, 0xb2, 0x96, 0xa7, 0xd9, 0x96, 0x94, 0x49, 0xca, 0xc8, 0x59, 0x86, 
+  0xde, 0x76, 0xd8, 0x74, 0x22, 0x98, 0x8a, 0x2b, 0x31, 0x72, 0xa3, 0x59, 0x53, 0xb8, 0x6c, 0xc6, 
+  0xef, 0x4b, 0xc4, 0xe9, 0xdd, 0xbb, 0xdc, 0x70, 0x14, 0xd5, 0xa3, 0x51, 0x61, 0xfa, 0xdf, 0xad, 
+  0xe7, 0x48, 0x13, 0x87, 0x34, 0x17, 0x8e, 0x23, 0x08, 0x3f, 0xfa, 0x85, 0xe5, 0x65, 0x48, 0xbe, 
+  0x2f, 0x84, 0x4a, 0xa7, 0x83, 0x30, 0xd3, 0xef, 0xe6, 0xf3, 0x2c, 0xa6, 0x50, 0x09, 0x84, 0x8f, 
+  0x59, 0x08, 0xd7, 0xd0, 0xd9, 0x86, 0x0c, 0x3b, 0xcf, 0x42, 0x3a, 0xc7, 0x2c, 0xa9, 0x54, 0x44, 
+  0x46, 0xce, 0xc0, 0xcb, 0x98, 0x79, 0x8e, 0x4d, 0xc4, 0x1f, 0xe3, 0x97, 0x9d, 0x00, 0xb5, 0x49, 
+  0x00, 0xbe, 0xa2, 0x5d, 0x02, 0xf1, 0x22, 0x0b, 0x31, 0x15, 0xdf, 0x01, 0x18, 0x38, 0x89, 0xe7, 
+  0x96, 0xff, 0xfa, 0x60, 0xf7, 0x20, 0x86, 0xc3, 0x9a, 0x18, 0xfe, 0x8e, 0x44, 0x62, 0x87, 0x8d, 
+  0xb8, 0x13, 0x8a, 0x45, 0xc8, 0xfe, 0x09, 0xfe, 0x57, 0x19, 0x63, 0x8c, 0x6c, 0x27, 0x34, 0x77, 
+  0x31, 0x8e, 0x0d, 0x8c, 0xa0, 0x05, 0x37, 0xd3, 0x47, 0x14, 0xbf, 0x84, 0x1c, 0xaf, 0x6c, 0x28, 
+  0xe3, 0xc4, 0x55, 0x16, 0x8c, 0xca, 0x86, 0x78, 0xc0, 0x64, 0xcf, 0x39, 0xd8, 0xc6, 0x19, 0x68, 
+  0xf8, 0x07, 0x86, 0x69, 0xf5, 0x4c, 0xcd, 0x24, 0xa6, 0xa0, 0x95, 0x00, 0xfb, 0x35, 0x87, 0x93, 
+  0x3a, 0xf4, 0xb5, 0x08, 0x49, 0x3c, 0xf4, 0xb1, 0x00, 0xc4, 0x85, 0x7e, 0xd3, 0xed, 0x0a, 0x5f, 
+  0x4c, 0xcb, 0x5a, 0xcc, 0x55, 0x72, 0x6d, 0x09, 0xd0, 0xeb, 0x1c, 0xa7, 0x95, 0xdf, 0x0d, 0x54, 
+  0x42, 0x77, 0xe8, 0x4b, 0xb4, 0x48, 0x62, 0xd1, 0xb2, 0xe6, 0x8b, 0x76, 0xcc, 0x1f, 0x91, 0xea, 
+  0xaf, 0x8c, 0xd1, 0x6a, 0x05, 0x66, 0xac, 0xa5, 0xc0, 0x8c, 0xdd, 0x64, 0x20, 0x08, 0x1c, 0x05, 
+  0xe1, 0x0a, 0xec, 0xfc, 0x0e, 0x06, 0xfd, 0x3c, 0x6b, 0x16, 0x78, 0xa0, 0xc9, 0x9a, 0xbb, 0xa0, 
+  0xa7, 0xb4, 0x4d, 0xea, 0x96, 0xb0, 0xde, 0xe8, 0x66, 0x01, 0x61, 0x0a, 0xcf, 0xbf, 0x91, 0x63, 
+  0x1f, 0x89, 0x63, 0xc7, 0xc0, 0x31, 0xbc, 0xe4, 0x02, 0xb7, 0x3c, 0x91, 0x63, 0x06, 0xd1, 0x5c, 
+  0x89, 0x58, 0xaf, 0x65, 0x8b, 0xa9, 0xa0, 0x1c, 0xf1, 0x32, 0xe0, 0xbd, 0x25, 0x03, 0x06, 0x88, 
+  0x74, 0x58, 0x64, 0xfa, 0x00, 0xc1, 0x58, 0x37, 0xe2, 0xed, 0x11, 0x63, 0x9d, 0xea, 0xae, 0x6e, 
+  0xc0, 0x2f, 0x84, 0xb8, 0x97, 0x45, 0xf7, 0x89, 0x15, 0xb7, 0x31, 0xcc, 0x82, 0xdf, 0x54, 0x71, 
+  0x1b, 0xa3, 0x2c, 0x9c, 0xbc, 0xe2, 0x2e, 0x55, 0x48, 0xaa, 0xb5, 0xf2, 0x12, 0xb2, 0x54, 0x63, 
+  0x59, 0xb2, 0xa9, 0xa8, 0x22, 0xb8, 0xaf, 0x93, 0x16, 0x39, 0xc7, 0xaa, 0x45, 0x1e, 0x8d, 0xd3, 
+  0x22, 0xfa, 0xe7, 0x20, 0xe1, 0x26, 0x53, 0x0e, 0xce, 0xf2, 0x78, 0xde, 0xd5, 0x01, 0xa4, 0x2c, 
+  0x41, 0x15, 0x98, 0xf7, 0x39, 0xb2, 0xac, 0xad, 0xaa, 0x8d, 0x5f, 0xb2, 0x10, 0x52, 0x33, 0x9e, 
+  0x55, 0x34, 0x56, 0x6d, 0x3f, 0xc4, 0x64, 0x35, 0xc8, 0x0c, 0xaa, 0x84, 0x03, 0x87, 0xb6, 0xd8, 
+  0x9b, 0xdd, 0x4e, 0xaf, 0x33, 0xdc, 0x2e, 0x26, 0xe3, 0xc7, 0x6c, 0xa7, 0x9b, 0xdb, 0x07, 0xe3, 
+  0x3c, 0x0b, 0xe9, 0xf1, 0xf6, 0xc1, 0xb8, 0xac, 0xc1, 0x19, 0x8a, 0x8c, 0xb5, 0x54, 0x92, 0x7d, 
+  0x15, 0x7b, 0x8c, 0xa7, 0x12, 0x97, 0xab, 0xec, 0x30, 0xd1, 0x10, 0x04, 0x3b, 0xea, 0xe4, 0x1e, 
+  0x69, 0x6a, 0xfd, 0x13, 0x4f, 0x1b, 0xc0, 0x52, 0x40, 0x15, 0xe1, 0x8f, 0xb9, 0x70, 0x4b, 0x20, 
+  0x5e, 0xd7, 0x40, 0x0d, 0x83, 0xa4, 0xf1, 0x27, 0x72, 0x0a, 0x06, 0x9a, 0x57, 0xdc, 0xc5, 0xcb, 
+  0x38, 0xfc, 0x64, 0x96, 0xfa, 0x4c, 0x2b, 0x1d, 0x05, 0x18, 0xb0, 0x0b, 0x3c, 0x3f, 0xa0, 0x8e, 
+  0x6b, 0xe4, 0xbf, 0x18, 0x70, 0x77, 0x77, 0x97, 0xf9, 0x1c, 0x41, 0xfa, 0x2b, 0xa1, 0xe6, 0x80, 
+  0x3c, 0x9a, 0xe5, 0x9b, 0x97, 0xb0, 0x3e, 0x19, 0x33, 0x7d, 0x21, 0x92, 0xfa, 0x3a, 0x01, 0x35, 
+  0xa4, 0x62, 0xbd, 0x6d, 0xa3, 0x3e, 0xef, 0x37, 0x8e, 0xcf, 0x8a, 0x66, 0x3f, 0x28, 0x73, 0xbd, 
+  0x5e, 0x40, 0xa9, 0x64, 0xcc, 0xe9, 0x0b, 0x69, 0x40, 0xfd, 0xe6, 0x2f, 0x9c, 0xc9, 0xdc, 0x57, 
+  0x03, 0x16, 0x25, 0xff, 0xbe, 0x13, 0x7d, 0x5c, 0x51, 0x7d, 0x29, 0xf9, 0x6f, 0xff, 0x07, 0x58, 
+  0xe5, 0x63, 0xc6, 0x3b, 0x79, 0x00, 0x00, 0x00 };
@@ -1,3 +1,442 @@
-static const char CONTENT_HOME_JS[] PROGMEM = 
+static const char CONTENT_HOME_JS[] PROGMEM __attribute__((aligned(4))) = 
   "\"use strict\";function OpenEVSEError(e){var n=1<arguments.length&&void 0!==arguments[1]?arguments[1]:\"\";this.type=e,this.message=n}function OpenEVSERequest(){var n=this;n._done=function(){},n._error=function(){},n._always=function(){},n.done=function(e){return n._done=e,n},n.error=function(e){return n._error=e,n},n.always=function(e){return n._always=e,n}}function OpenEVSE(e){var l=this;l._version=\"0.1\",l._endpoint=e,l.states={0:\"unknown\",1:\"not connected\",2:\"connected\",3:\"charging\",4:\"vent required\",5:\"diode check failed\",6:\"gfci fault\",7:\"no ground\",8:\"stuck relay\",9:\"gfci self-test failure\",10:\"over temperature\",254:\"sleeping\",255:\"disabled\"},l._lcd_colors=[\"off\",\"red\",\"green\",\"yellow\",\"blue\",\"violet\",\"teal\",\"white\"],l._status_functions={disable:\"FD\",enable:\"FE\",sleep:\"FS\"},l._lcd_types=[\"monochrome\",\"rgb\"],l._service_levels=[\"A\",\"1\",\"2\"],l.STANDARD_SERIAL_TIMEOUT=.5,l.RESET_SERIAL_TIMEOUT=10,l.STATUS_SERIAL_TIMEOUT=0,l.SYNC_SERIAL_TIMEOUT=.5,l.NEWLINE_MAX_AGE=5,l.CORRECT_RESPONSE_PREFIXES=\"$NK\",l.regex=/\\$([^^]*)(\\^..)?/,l._request=function(e){var a=1<arguments.length&&void 0!==arguments[1]?arguments[1]:function(){},n=\"$\"+(Array.isArray(e)?e.join(\"+\"):e),r=new OpenEVSERequest;return $.get(l._endpoint+\"?json=1&rapi=\"+encodeURI(n),function(e){var n=e.ret.match(l.regex);if(null!==n){var t=n[1].split(\" \");\"OK\"===t[0]?(a(t.slice(1)),r._done(t.slice(1))):r._error(new OpenEVSEError(\"OperationFailed\"))}else r._error(new OpenEVSEError(\"UnexpectedResponse\"))},\"json\").always(function(){r._always()}).fail(function(){r._error(new OpenEVSEError(\"RequestFailed\"))}),r},l._flags=function(t){var a=l._request(\"GE\",function(e){var n=parseInt(e[1],16);isNaN(n)?a._error(new OpenEVSEError(\"ParseError\",'Failed to parse \"'+e[0]+'\"')):t({service_level:1+(1&n),diode_check:0==(2&n),vent_required:0==(4&n),ground_check:0==(8&n),stuck_relay_check:0==(16&n),auto_service_level:0==(32&n),auto_start:0==(64&n),serial_debug:0!=(128&n),lcd_type:0!=(256&n)?\"monochrome\":\"rgb\",gfi_self_test:0==(512&n),temp_check:0==(1024&n)})});return a},l.reset=function(){return l._request(\"FR\")},l.time=function(u){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e)return l._request([\"S1\",e.getFullYear()-2e3,e.getMonth()+1,e.getDate(),e.getHours(),e.getMinutes(),e.getSeconds()],function(){l.time(u)});var c=l._request(\"GT\",function(e){if(6<=e.length){var n=parseInt(e[0]),t=parseInt(e[1]),a=parseInt(e[2]),r=parseInt(e[3]),o=parseInt(e[4]),i=parseInt(e[5]);if(isNaN(n)||isNaN(t)||isNaN(a)||isNaN(r)||isNaN(o)||isNaN(i))c._error(new OpenEVSEError(\"ParseError\",'Could not parse time \"'+e.join(\" \")+'\" arguments'));else if(165==n&&165==t&&165==a&&165==r&&165==o&&85==i)u(new Date(0),!1);else{var s=new Date(2e3+n,t-1,a,r,o,i);u(s,!0)}}else c._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return c},l.timer=function(o){var i=1<arguments.length&&void 0!==arguments[1]&&arguments[1],s=2<arguments.length&&void 0!==arguments[2]&&arguments[2];function u(e){return(e<10?\"0\":\"\")+e}if(!1!==i&&!1!==s){var e=/([01]\\d|2[0-3]):([0-5]\\d)/,n=i.match(e),t=s.match(e);return null!==n&&null!==t&&l._request([\"ST\",parseInt(n[1]),parseInt(n[2]),parseInt(t[1]),parseInt(t[2])],function(){l.timer(o)})}var c=l._request(\"GD\",function(e){if(4<=e.length){var n=parseInt(e[0]),t=parseInt(e[1]),a=parseInt(e[2]),r=parseInt(e[3]);isNaN(n)||isNaN(t)||isNaN(a)||isNaN(r)?c._error(new OpenEVSEError(\"ParseError\",'Could not parse time \"'+e.join(\" \")+'\" arguments')):0===n&&0===t&&0===a&&0===r?o(!1,\"--:--\",\"--:--\"):(i=u(n)+\":\"+u(t),s=u(a)+\":\"+u(r),o(!0,i,s))}else c._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return c},l.cancelTimer=function(e){return l._request([\"ST\",0,0,0,0],function(){e()})},l.time_limit=function(t){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e)return l._request([\"S3\",Math.round(e/15)],function(){l.time_limit(t)});var a=l._request(\"G3\",function(e){if(1<=e.length){var n=parseInt(e[0]);isNaN(n)?a._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):t(15*n)}else a._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return a},l.charge_limit=function(t){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e)return l._request([\"SH\",e],function(){l.charge_limit(t)});var a=l._request(\"GH\",function(e){if(1<=e.length){var n=parseInt(e[0]);isNaN(n)?a._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):t(n)}else a._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return a},l.ammeter_settings=function(a){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1],n=2<arguments.length&&void 0!==arguments[2]&&arguments[2];if(!1!==e&&!1!==n)return l._request([\"SA\",e,n],function(){a(e,n)});var r=l._request(\"GA\",function(e){if(2<=e.length){var n=parseInt(e[0]),t=parseInt(e[1]);isNaN(n)||isNaN(t)?r._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):a(n,t)}else r._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return r},l.current_capacity=function(t){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e)return l._request([\"SC\",e],function(){l.current_capacity(t)});var a=l._request(\"GE\",function(e){if(1<=e.length){var n=parseInt(e[0]);isNaN(n)?a._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):t(n)}else a._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return a},l.service_level=function(n){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];return!1!==e?l._request([\"SL\",l._service_levels[e]],function(){l.service_level(n)}):l._flags(function(e){n(e.auto_service_level?0:e.service_level,e.service_level)})},l.current_capacity_range=function(a){var r=l._request(\"GC\",function(e){if(2<=e.length){var n=parseInt(e[0]),t=parseInt(e[1]);isNaN(n)||isNaN(t)?r._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):a(n,t)}else r._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return r},l.status=function(a){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e){var n=l._status_functions[e];return l._request([n],function(){l.status(a)})}var r=l._request(\"GS\",function(e){if(1<=e.length){var n=parseInt(e[0]),t=parseInt(e[1]);isNaN(n)||isNaN(t)?r._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):a(n,t)}else r._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return r},l.diode_check=function(n){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF\",\"D\",e?\"1\":\"0\"],function(){l.diode_check(n)}):l._flags(function(e){n(e.diode_check)})},l.gfi_self_test=function(n){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF F\",e?\"1\":\"0\"],function(){l.gfi_self_test(n)}):l._flags(function(e){n(e.gfi_self_test)})},l.ground_check=function(n){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF G\",e?\"1\":\"0\"],function(){l.ground_check(n)}):l._flags(function(e){n(e.ground_check)})},l.stuck_relay_check=function(n){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF R\",e?\"1\":\"0\"],function(){l.stuck_relay_check(n)}):l._flags(function(e){n(e.stuck_relay_check)})},l.vent_required=function(n){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF V\",e?\"1\":\"0\"],function(){l.vent_required(n)}):l._flags(function(e){n(e.vent_required)})},l.temp_check=function(n){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF T\",e?\"1\":\"0\"],function(){l.temp_check(n)}):l._flags(function(e){n(e.temp_check)})},l.over_temperature_thresholds=function(a){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1],n=2<arguments.length&&void 0!==arguments[2]&&arguments[2];if(!1!==e&&!1!==n)return l._request([\"SO\",e,n],function(){l.over_temperature_thresholds(a)});var r=l._request(\"GO\",function(e){if(2<=e.length){var n=parseInt(e[0]),t=parseInt(e[1]);isNaN(n)||isNaN(t)?r._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):a(n,t)}else r._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return r},l.press_button=function(e){return l._request(\"F1\",function(){e()})},l.setEndpoint=function(e){l._endpoint=e}}function RapiViewModel(e){var n=this;n.baseEndpoint=e,n.rapiSend=ko.observable(!1),n.cmd=ko.observable(\"\"),n.ret=ko.observable(\"\"),n.send=function(){n.rapiSend(!0),$.get(n.baseEndpoint()+\"/r?json=1&rapi=\"+encodeURI(n.cmd()),function(e){n.ret(\">\"+e.ret),n.cmd(e.cmd)},\"json\").always(function(){n.rapiSend(!1)})}}function TimeViewModel(t){var a=this;function r(e){return(e<10?\"0\":\"\")+e}a.evseTimedate=ko.observable(new Date),a.localTimedate=ko.observable(new Date),a.nowTimedate=ko.observable(null),a.hasRTC=ko.observable(!0),a.elapsedNow=ko.observable(new Date(0)),a.elapsedLocal=ko.observable(new Date),a.divertUpdateNow=ko.observable(new Date(0)),a.divertUpdateLocal=ko.observable(new Date),a.date=ko.pureComputed({read:function(){if(null===a.nowTimedate())return\"\";var e=a.nowTimedate();return e.getFullYear()+\"-\"+r(e.getMonth()+1)+\"-\"+r(e.getDate())},write:function(e){a.evseTimedate(new Date(e)),a.localTimedate(new Date)}}),a.time=ko.pureComputed({read:function(){if(null===a.nowTimedate())return\"--:--:--\";var e=a.nowTimedate();return r(e.getHours())+\":\"+r(e.getMinutes())+\":\"+r(e.getSeconds())},write:function(e){var n=e.split(\":\"),t=a.evseTimedate();t.setHours(parseInt(n[0])),t.setMinutes(parseInt(n[1])),a.evseTimedate(t),a.localTimedate(new Date)}}),a.elapsed=ko.pureComputed(function(){if(null===a.nowTimedate())return\"0:00:00\";var e=a.elapsedNow().getTime(),n=(e=Math.floor(e/1e3))%60,t=(e=Math.floor(e/60))%60;return Math.floor(e/60)+\":\"+r(t)+\":\"+r(n)}),t.status.elapsed.subscribe(function(e){a.elapsedNow(new Date(1e3*e)),a.elapsedLocal(new Date)}),a.divert_update=ko.pureComputed(function(){if(null===a.nowTimedate())return!1;var e=a.divertUpdateNow().getTime();return Math.floor(e/1e3)}),t.status.divert_update.subscribe(function(e){a.divertUpdateNow(new Date(1e3*e)),a.divertUpdateLocal(new Date)});var o=null;a.automaticTime=ko.observable(!0),a.setTime=function(){var e=a.automaticTime()?new Date:a.evseTimedate();t.openevse.time(a.timeUpdate,e)},a.timeUpdate=function(e){var n=!(1<arguments.length&&void 0!==arguments[1])||arguments[1];a.hasRTC(n),null!==o&&(clearInterval(o),o=null),a.evseTimedate(e),a.nowTimedate(e),a.localTimedate(new Date),o=setInterval(function(){a.automaticTime()&&a.nowTimedate(new Date(a.evseTimedate().getTime()+(new Date-a.localTimedate()))),t.isCharging()&&a.elapsedNow(new Date(1e3*t.status.elapsed()+(new Date-a.elapsedLocal()))),a.divertUpdateNow(new Date(1e3*t.status.divert_update()+(new Date-a.divertUpdateLocal())))},1e3)}}function OpenEvseViewModel(e,n){var r=this,t=ko.pureComputed(function(){return e()+\"/r\"});r.openevse=new OpenEVSE(t()),t.subscribe(function(e){r.openevse.setEndpoint(e)}),r.status=n,r.time=new TimeViewModel(r),r.serviceLevels=[{name:\"Auto\",value:0},{name:\"1\",value:1},{name:\"2\",value:2}],r.currentLevels=ko.observableArray([]),r.timeLimits=[{name:\"none\",value:0},{name:\"15 min\",value:15},{name:\"30 min\",value:30},{name:\"45 min\",value:45},{name:\"1 hour\",value:60},{name:\"1.5 hours\",value:90},{name:\"2 hours\",value:120},{name:\"2.5 hours\",value:150},{name:\"3 hours\",value:180},{name:\"4 hours\",value:240},{name:\"5 hours\",value:300},{name:\"6 hours\",value:360},{name:\"7 hours\",value:420},{name:\"8 hours\",value:480}],r.chargeLimits=[{name:\"none\",value:0},{name:\"1 kWh\",value:1},{name:\"2 kWh\",value:2},{name:\"3 kWh\",value:3},{name:\"4 kWh\",value:4},{name:\"5 kWh\",value:5},{name:\"6 kWh\",value:6},{name:\"7 kWh\",value:7},{name:\"8 kWh\",value:8},{name:\"9 kWh\",value:9},{name:\"10 kWh\",value:10},{name:\"15 kWh\",value:11},{name:\"20 kWh\",value:12},{name:\"25 kWh\",value:25},{name:\"30 kWh\",value:30},{name:\"35 kWh\",value:35},{name:\"40 kWh\",value:40},{name:\"45 kWh\",value:45},{name:\"50 kWh\",value:50},{name:\"55 kWh\",value:55},{name:\"60 kWh\",value:60},{name:\"70 kWh\",value:70},{name:\"80 kWh\",value:80},{name:\"90 kWh\",value:90}],r.serviceLevel=ko.observable(-1),r.actualServiceLevel=ko.observable(-1),r.minCurrentLevel=ko.observable(-1),r.maxCurrentLevel=ko.observable(-1),r.currentCapacity=ko.observable(-1),r.timeLimit=ko.observable(-1),r.chargeLimit=ko.observable(-1),r.delayTimerEnabled=ko.observable(!1),r.delayTimerStart=ko.observable(\"--:--\"),r.delayTimerStop=ko.observable(\"--:--\"),r.gfiSelfTestEnabled=ko.observable(!1),r.groundCheckEnabled=ko.observable(!1),r.stuckRelayEnabled=ko.observable(!1),r.tempCheckEnabled=ko.observable(!1),r.diodeCheckEnabled=ko.observable(!1),r.ventRequiredEnabled=ko.observable(!1),r.allTestsEnabled=ko.pureComputed(function(){return r.gfiSelfTestEnabled()&&r.groundCheckEnabled()&&r.stuckRelayEnabled()&&r.tempCheckEnabled()&&r.diodeCheckEnabled()&&r.ventRequiredEnabled()}),r.tempCheckSupported=ko.observable(!1),r.isConnected=ko.pureComputed(function(){return-1!==[2,3].indexOf(r.status.state())}),r.isReady=ko.pureComputed(function(){return-1!==[0,1].indexOf(r.status.state())}),r.isCharging=ko.pureComputed(function(){return 3===r.status.state()}),r.isError=ko.pureComputed(function(){return-1!==[4,5,6,7,8,9,10].indexOf(r.status.state())}),r.isEnabled=ko.pureComputed(function(){return-1!==[0,1,2,3].indexOf(r.status.state())}),r.isSleeping=ko.pureComputed(function(){return 254===r.status.state()}),r.isDisabled=ko.pureComputed(function(){return 255===r.status.state()}),r.selectTimeLimit=function(e){if(r.timeLimit()!==e)for(var n=0;n<r.timeLimits.length;n++){var t=r.timeLimits[n];if(t.value>=e){r.timeLimit(t.value);break}}},r.selectChargeLimit=function(e){if(r.chargeLimit()!==e)for(var n=0;n<r.chargeLimits.length;n++){var t=r.chargeLimits[n];if(t.value>=e){r.chargeLimit(t.value);break}}};var a=[function(){return r.openevse.time(r.time.timeUpdate)},function(){return r.openevse.service_level(function(e,n){r.serviceLevel(e),r.actualServiceLevel(n)})},function(){return r.updateCurrentCapacity()},function(){return r.openevse.current_capacity(function(e){r.currentCapacity(e)})},function(){return r.openevse.time_limit(function(e){r.selectTimeLimit(e)})},function(){return r.openevse.charge_limit(function(e){r.selectChargeLimit(e)})},function(){return r.openevse.gfi_self_test(function(e){r.gfiSelfTestEnabled(e)})},function(){return r.openevse.ground_check(function(e){r.groundCheckEnabled(e)})},function(){return r.openevse.stuck_relay_check(function(e){r.stuckRelayEnabled(e)})},function(){return r.openevse.temp_check(function(e){r.tempCheckEnabled(e)})},function(){return r.openevse.diode_check(function(e){r.diodeCheckEnabled(e)})},function(){return r.openevse.vent_required(function(e){r.ventRequiredEnabled(e)})},function(){return r.openevse.temp_check(function(){r.tempCheckSupported(!0)},r.tempCheckEnabled()).error(function(){r.tempCheckSupported(!1)})},function(){return r.openevse.timer(function(e,n,t){r.delayTimerEnabled(e),r.delayTimerStart(n),r.delayTimerStop(t)})}];r.updateCount=ko.observable(0),r.updateTotal=ko.observable(a.length),r.updateCurrentCapacity=function(){return r.openevse.current_capacity_range(function(e,n){r.minCurrentLevel(e),r.maxCurrentLevel(n);var t=r.currentCapacity();r.currentLevels.removeAll();for(var a=r.minCurrentLevel();a<=r.maxCurrentLevel();a++)r.currentLevels.push({name:a+\" A\",value:a});r.currentCapacity(t)})},r.updatingServiceLevel=ko.observable(!1),r.savedServiceLevel=ko.observable(!1),r.updatingCurrentCapacity=ko.observable(!1),r.savedCurrentCapacity=ko.observable(!1),r.updatingTimeLimit=ko.observable(!1),r.savedTimeLimit=ko.observable(!1),r.updatingChargeLimit=ko.observable(!1),r.savedChargeLimit=ko.observable(!1),r.updatingDelayTimer=ko.observable(!1),r.savedDelayTimer=ko.observable(!1),r.updatingStatus=ko.observable(!1),r.savedStatus=ko.observable(!1),r.updatingGfiSelfTestEnabled=ko.observable(!1),r.savedGfiSelfTestEnabled=ko.observable(!1),r.updatingGroundCheckEnabled=ko.observable(!1),r.savedGroundCheckEnabled=ko.observable(!1),r.updatingStuckRelayEnabled=ko.observable(!1),r.savedStuckRelayEnabled=ko.observable(!1),r.updatingTempCheckEnabled=ko.observable(!1),r.savedTempCheckEnabled=ko.observable(!1),r.updatingDiodeCheckEnabled=ko.observable(!1),r.savedDiodeCheckEnabled=ko.observable(!1),r.updatingVentRequiredEnabled=ko.observable(!1),r.savedVentRequiredEnabled=ko.observable(!1);var o=!(r.setForTime=function(e,n){e(!0),setTimeout(function(){e(!1)},n)});function i(e){return/([01]\\d|2[0-3]):([0-5]\\d)/.test(e)}r.subscribe=function(){o||(r.serviceLevel.subscribe(function(e){r.updatingServiceLevel(!0),r.openevse.service_level(function(e,n){r.setForTime(r.savedServiceLevel,2e3),r.actualServiceLevel(n),r.updateCurrentCapacity().always(function(){})},e).always(function(){r.updatingServiceLevel(!1)})}),r.currentCapacity.subscribe(function(n){!0!==r.updatingServiceLevel()&&(r.updatingCurrentCapacity(!0),r.openevse.current_capacity(function(e){r.setForTime(r.savedCurrentCapacity,2e3),n!==e&&r.currentCapacity(e)},n).always(function(){r.updatingCurrentCapacity(!1)}))}),r.timeLimit.subscribe(function(n){r.updatingTimeLimit(!0),r.openevse.time_limit(function(e){r.setForTime(r.savedTimeLimit,2e3),n!==e&&r.selectTimeLimit(e)},n).always(function(){r.updatingTimeLimit(!1)})}),r.chargeLimit.subscribe(function(n){r.updatingChargeLimit(!0),r.openevse.charge_limit(function(e){r.setForTime(r.savedChargeLimit,2e3),n!==e&&r.selectChargeLimit(e)},n).always(function(){r.updatingChargeLimit(!1)})}),r.gfiSelfTestEnabled.subscribe(function(n){r.updatingGfiSelfTestEnabled(!0),r.openevse.gfi_self_test(function(e){r.setForTime(r.savedGfiSelfTestEnabled,2e3),n!==e&&r.gfiSelfTestEnabled(e)},n).always(function(){r.updatingGfiSelfTestEnabled(!1)})}),r.groundCheckEnabled.subscribe(function(n){r.updatingGroundCheckEnabled(!0),r.openevse.ground_check(function(e){r.setForTime(r.savedGroundCheckEnabled,2e3),n!==e&&r.groundCheckEnabled(e)},n).always(function(){r.updatingGroundCheckEnabled(!1)})}),r.stuckRelayEnabled.subscribe(function(n){r.updatingStuckRelayEnabled(!0),r.savedStuckRelayEnabled(!1),r.openevse.stuck_relay_check(function(e){r.savedStuckRelayEnabled(!0),setTimeout(function(){r.savedStuckRelayEnabled(!1)},2e3),n!==e&&r.stuckRelayEnabled(e)},n).always(function(){r.updatingStuckRelayEnabled(!1)})}),r.tempCheckEnabled.subscribe(function(n){r.updatingTempCheckEnabled(!0),r.openevse.temp_check(function(e){r.setForTime(r.savedTempCheckEnabled,2e3),n!==e&&r.tempCheckEnabled(e)},n).always(function(){r.updatingTempCheckEnabled(!1)})}),r.diodeCheckEnabled.subscribe(function(n){r.updatingDiodeCheckEnabled(!0),r.openevse.diode_check(function(e){r.setForTime(r.savedDiodeCheckEnabled,2e3),n!==e&&r.diodeCheckEnabled(e)},n).always(function(){r.updatingDiodeCheckEnabled(!1)})}),r.ventRequiredEnabled.subscribe(function(n){r.updatingVentRequiredEnabled(!0),r.openevse.vent_required(function(e){r.setForTime(r.savedVentRequiredEnabled,2e3),n!==e&&r.ventRequiredEnabled(e)},n).always(function(){r.updatingVentRequiredEnabled(!1)})}),o=!0)},r.update=function(){var e=0<arguments.length&&void 0!==arguments[0]?arguments[0]:function(){};r.updateCount(0),r.nextUpdate(e)},r.nextUpdate=function(e){(0,a[r.updateCount()])().always(function(){r.updateCount(r.updateCount()+1),r.updateCount()<a.length?r.nextUpdate(e):(r.subscribe(),e())})},r.delayTimerValid=ko.pureComputed(function(){return i(r.delayTimerStart())&&i(r.delayTimerStop())}),r.startDelayTimer=function(){r.updatingDelayTimer(!0),r.openevse.timer(function(){r.delayTimerEnabled(!0)},r.delayTimerStart(),r.delayTimerStop()).always(function(){r.updatingDelayTimer(!1)})},r.stopDelayTimer=function(){r.updatingDelayTimer(!0),r.openevse.cancelTimer(function(){r.delayTimerEnabled(!1)}).always(function(){r.updatingDelayTimer(!1)})},r.setStatus=function(e){var n=r.status.state();\"disabled\"===e&&255===n||\"sleep\"===e&&254===n||\"enable\"===e&&n<254||(r.updatingStatus(!0),!r.delayTimerEnabled()||\"sleep\"!==e&&\"enable\"!==e?r.openevse.status(function(e){r.status.state(e)},e).always(function(){r.updatingStatus(!1)}):r.openevse.press_button(function(){e=!1}).always(function(){r.openevse.status(function(e){r.status.state(e)},e).always(function(){r.updatingStatus(!1)})}))},r.restartFetching=ko.observable(!1),r.restart=function(){confirm(\"Restart OpenEVSE? Current config will be saved, takes approximately 10s.\")&&(r.restartFetching(!0),r.openevse.reset().always(function(){r.restartFetching(!1)}))}}function OpenEvseWiFiViewModel(e,n,t){var a=this;a.baseHost=ko.observable(\"\"!==e?e:\"openevse.local\"),a.basePort=ko.observable(n),a.baseProtocol=ko.observable(t),a.baseEndpoint=ko.pureComputed(function(){var e=\"//\"+a.baseHost();return 80!==a.basePort()&&(e+=\":\"+a.basePort()),e}),a.wsEndpoint=ko.pureComputed(function(){var e=\"ws://\"+a.baseHost();return\"https:\"===a.baseProtocol()&&(e=\"wss://\"+a.baseHost()),80!==a.basePort()&&(e+=\":\"+a.basePort()),e+=\"/ws\"}),a.config=new ConfigViewModel(a.baseEndpoint),a.status=new StatusViewModel(a.baseEndpoint),a.rapi=new RapiViewModel(a.baseEndpoint),a.scan=new WiFiScanViewModel(a.baseEndpoint),a.wifi=new WiFiConfigViewModel(a.baseEndpoint,a.config,a.status,a.scan),a.openevse=new OpenEvseViewModel(a.baseEndpoint,a.status),a.initialised=ko.observable(!1),a.updating=ko.observable(!1),a.scanUpdating=ko.observable(!1),a.bssid=ko.observable(\"\"),a.bssid.subscribe(function(e){for(var n=0;n<a.scan.results().length;n++){var t=a.scan.results()[n];if(e===t.bssid())return void a.config.ssid(t.ssid())}}),a.showMqttInfo=ko.observable(!1),a.showSolarDivert=ko.observable(!1),a.showSafety=ko.observable(!1),a.toggle=function(e){e(!e())},a.advancedMode=ko.observable(!1),a.advancedMode.subscribe(function(e){a.setCookie(\"advancedMode\",e.toString())}),a.developerMode=ko.observable(!1),a.developerMode.subscribe(function(e){a.setCookie(\"developerMode\",e.toString()),e&&a.advancedMode(!0)});var r=null,o=null,i=\"status\";\"\"!==window.location.hash&&(i=window.location.hash.substr(1)),a.tab=ko.observable(i),a.tab.subscribe(function(e){window.location.hash=\"#\"+e}),a.isSystem=ko.pureComputed(function(){return\"system\"===a.tab()}),a.isServices=ko.pureComputed(function(){return\"services\"===a.tab()}),a.isStatus=ko.pureComputed(function(){return\"status\"===a.tab()}),a.isRapi=ko.pureComputed(function(){return\"rapi\"===a.tab()}),a.upgradeUrl=ko.observable(\"about:blank\"),a.loadedCount=ko.observable(0),a.itemsLoaded=ko.pureComputed(function(){return a.loadedCount()+a.openevse.updateCount()}),a.itemsTotal=ko.observable(2+a.openevse.updateTotal()),a.start=function(){a.updating(!0),a.status.update(function(){a.loadedCount(a.loadedCount()+1),a.config.update(function(){a.loadedCount(a.loadedCount()+1),a.baseHost().endsWith(\".local\")&&\"\"!==a.status.ipaddress()&&(\"\"===a.config.www_username()?a.baseHost(a.status.ipaddress()):window.location.replace(\"http://\"+a.status.ipaddress()+\":\"+a.basePort())),a.openevse.update(function(){a.initialised(!0),r=setTimeout(a.update,5e3),a.upgradeUrl(a.baseEndpoint()+\"/update\");for(var e=document.getElementsByTagName(\"img\"),n=0;n<e.length;n++)e[n].getAttribute(\"data-src\")&&e[n].setAttribute(\"src\",e[n].getAttribute(\"data-src\"));a.updating(!1)})}),a.connect()}),a.advancedMode(\"true\"===a.getCookie(\"advancedMode\",\"false\")),a.developerMode(\"true\"===a.getCookie(\"developerMode\",\"false\"))};var s=!(a.update=function(){a.updating()||(a.updating(!0),null!==r&&(clearTimeout(r),r=null),a.status.update(function(){r=setTimeout(a.update,5e3),a.updating(!1)}))});a.startScan=function(){a.scanUpdating()||(s=!0,a.scanUpdating(!0),null!==o&&(clearTimeout(o),o=null),a.scan.update(function(){s&&(o=setTimeout(a.startScan,3e3)),a.scanUpdating(!1)}))},a.stopScan=function(){s=!1,a.scanUpdating()||null!==o&&(clearTimeout(o),o=null)},a.wifiConnecting=ko.observable(!1),a.status.mode.subscribe(function(e){\"STA+AP\"!==e&&\"STA\"!==e||a.wifiConnecting(!1),\"STA+AP\"===e||\"AP\"===e?a.startScan():a.stopScan()}),a.saveNetworkFetching=ko.observable(!1),a.saveNetworkSuccess=ko.observable(!1),a.saveNetwork=function(){\"\"===a.config.ssid()?alert(\"Please select network\"):(a.saveNetworkFetching(!0),a.saveNetworkSuccess(!1),$.post(a.baseEndpoint()+\"/savenetwork\",{ssid:a.config.ssid(),pass:a.config.pass()},function(){a.saveNetworkSuccess(!0),a.wifiConnecting(!0)}).fail(function(){alert(\"Failed to save WiFi config\")}).always(function(){a.saveNetworkFetching(!1)}))},a.saveAdminFetching=ko.observable(!1),a.saveAdminSuccess=ko.observable(!1),a.saveAdmin=function(){a.saveAdminFetching(!0),a.saveAdminSuccess(!1),$.post(a.baseEndpoint()+\"/saveadmin\",{user:a.config.www_username(),pass:a.config.www_password()},function(){a.saveAdminSuccess(!0)}).fail(function(){alert(\"Failed to save Admin config\")}).always(function(){a.saveAdminFetching(!1)})},a.saveEmonCmsFetching=ko.observable(!1),a.saveEmonCmsSuccess=ko.observable(!1),a.saveEmonCms=function(){var e={enable:a.config.emoncms_enabled(),server:a.config.emoncms_server(),apikey:a.config.emoncms_apikey(),node:a.config.emoncms_node(),fingerprint:a.config.emoncms_fingerprint()};!e.enable||\"\"!==e.server&&\"\"!==e.node?e.enable&&32!==e.apikey.length&&\"___DUMMY_PASSWORD___\"!==e.apikey?alert(\"Please enter valid Emoncms apikey\"):e.enable&&\"\"!==e.fingerprint&&59!==e.fingerprint.length?alert(\"Please enter valid SSL SHA-1 fingerprint\"):(a.saveEmonCmsFetching(!0),a.saveEmonCmsSuccess(!1),$.post(a.baseEndpoint()+\"/saveemoncms\",e,function(){a.saveEmonCmsSuccess(!0)}).fail(function(){alert(\"Failed to save Admin config\")}).always(function(){a.saveEmonCmsFetching(!1)})):alert(\"Please enter Emoncms server and node\")},a.saveMqttFetching=ko.observable(!1),a.saveMqttSuccess=ko.observable(!1),a.saveMqtt=function(){var e={enable:a.config.mqtt_enabled(),server:a.config.mqtt_server(),topic:a.config.mqtt_topic(),user:a.config.mqtt_user(),pass:a.config.mqtt_pass(),solar:a.config.mqtt_solar(),grid_ie:a.config.mqtt_grid_ie()};e.enable&&\"\"===e.server?alert(\"Please enter MQTT server\"):(a.saveMqttFetching(!0),a.saveMqttSuccess(!1),$.post(a.baseEndpoint()+\"/savemqtt\",e,function(){a.saveMqttSuccess(!0)}).fail(function(){alert(\"Failed to save MQTT config\")}).always(function(){a.saveMqttFetching(!1)}))},a.saveOhmKeyFetching=ko.observable(!1),a.saveOhmKeySuccess=ko.observable(!1),a.saveOhmKey=function(){a.saveOhmKeyFetching(!0),a.saveOhmKeySuccess(!1),$.post(a.baseEndpoint()+\"/saveohmkey\",{enable:a.config.ohm_enabled(),ohm:a.config.ohmkey()},function(){a.saveOhmKeySuccess(!0)}).fail(function(){alert(\"Failed to save Ohm key config\")}).always(function(){a.saveOhmKeyFetching(!1)})},a.turnOffAccessPointFetching=ko.observable(!1),a.turnOffAccessPointSuccess=ko.observable(!1),a.turnOffAccessPoint=function(){a.turnOffAccessPointFetching(!0),a.turnOffAccessPointSuccess(!1),$.post(a.baseEndpoint()+\"/apoff\",{},function(e){console.log(e),\"\"!==a.status.ipaddress()?setTimeout(function(){window.location=\"http://\"+a.status.ipaddress(),a.turnOffAccessPointSuccess(!0)},3e3):a.turnOffAccessPointSuccess(!0)}).fail(function(){alert(\"Failed to turn off Access Point\")}).always(function(){a.turnOffAccessPointFetching(!1)})},a.changeDivertModeFetching=ko.observable(!1),a.changeDivertModeSuccess=ko.observable(!1),a.changeDivertMode=function(e){a.status.divertmode()!==e&&(a.status.divertmode(e),a.changeDivertModeFetching(!0),a.changeDivertModeSuccess(!1),$.post(a.baseEndpoint()+\"/divertmode\",{divertmode:e},function(){a.changeDivertModeSuccess(!0)}).fail(function(){alert(\"Failed to set divert mode\")}).always(function(){a.changeDivertModeFetching(!1)}))},a.isEcoModeAvailable=ko.pureComputed(function(){return a.config.mqtt_enabled()&&(\"\"!==a.config.mqtt_solar()||\"\"!==a.config.mqtt_grid_ie())}),a.ecoMode=ko.pureComputed({read:function(){return 2===a.status.divertmode()},write:function(e){a.changeDivertMode(e?2:1)}}),a.haveSolar=ko.pureComputed(function(){return\"\"!==a.config.mqtt_solar()}),a.haveGridIe=ko.pureComputed(function(){return\"\"!==a.config.mqtt_grid_ie()}),a.factoryResetFetching=ko.observable(!1),a.factoryResetSuccess=ko.observable(!1),a.factoryReset=function(){confirm(\"CAUTION: Do you really want to Factory Reset? All setting and config will be lost.\")&&(a.factoryResetFetching(!0),a.factoryResetSuccess(!1),$.post(a.baseEndpoint()+\"/reset\",{},function(){a.factoryResetSuccess(!0)}).fail(function(){alert(\"Failed to Factory Reset\")}).always(function(){a.factoryResetFetching(!1)}))},a.restartFetching=ko.observable(!1),a.restartSuccess=ko.observable(!1),a.restart=function(){confirm(\"Restart OpenEVSE WiFi? Current config will be saved, takes approximately 10s.\")&&(a.restartFetching(!0),a.restartSuccess(!1),$.post(a.baseEndpoint()+\"/restart\",{},function(){a.restartSuccess(!0)}).fail(function(){alert(\"Failed to restart\")}).always(function(){a.restartFetching(!1)}))},a.pingInterval=!1,a.reconnectInterval=!1,a.socket=!1,a.connect=function(){a.socket=new WebSocket(a.wsEndpoint()),a.socket.onopen=function(e){console.log(e),a.pingInterval=setInterval(function(){a.socket.send('{\"ping\":1}')},1e3)},a.socket.onclose=function(e){console.log(e),a.reconnect()},a.socket.onmessage=function(e){console.log(e),ko.mapping.fromJSON(e.data,a.status)},a.socket.onerror=function(e){console.log(e),a.socket.close(),a.reconnect()}},a.reconnect=function(){!1!==a.pingInterval&&(clearInterval(a.pingInterval),a.pingInterval=!1),!1===a.reconnectInterval&&(a.reconnectInterval=setTimeout(function(){a.reconnectInterval=!1,a.connect()},500))},a.setCookie=function(e,n){var t=2<arguments.length&&void 0!==arguments[2]&&arguments[2],a=\"\";if(!1!==t){var r=new Date;r.setTime(r.getTime()+24*t*60*60*1e3),a=\";expires=\"+r.toUTCString()}document.cookie=e+\"=\"+n+a+\";path=/\"},a.getCookie=function(e){for(var n=1<arguments.length&&void 0!==arguments[1]?arguments[1]:\"\",t=e+\"=\",a=document.cookie.split(\";\"),r=0;r<a.length;r++){for(var o=a[r];\" \"===o.charAt(0);)o=o.substring(1);if(0===o.indexOf(t))return o.substring(t.length,o.length)}return n}}function scaleString(e,n,t){return(parseInt(e)/n).toFixed(t)}function formatUpdate(e){if(!1===e)return\"N/A\";var n=e/60,t=e/3600,a=t/24,r=e.toFixed(0)+\"s\";return 0===e.toFixed(0)?r=\"now\":7<a?r=\"inactive\":2<a?r=a.toFixed(1)+\" days\":2<t?r=t.toFixed(0)+\" hrs\":180<e&&(r=n.toFixed(0)+\" mins\"),r}function updateClass(e){if(!1===e)return\"\";var n=\"updateBad\";return(e=Math.abs(e))<25?n=\"updateGood\":e<60?n=\"updateSlow\":e<7200&&(n=\"updateSlower\"),n}!function(){var n=window.location.hostname,t=window.location.port,a=window.location.protocol;$(function(){var e=new OpenEvseWiFiViewModel(n,t,a);ko.applyBindings(e),e.start()})}();\n"
   "//# sourceMappingURL=home.js.map\n";
+static const char CONTENT_HOME_JS_GZ[] PROGMEM __attribute__((aligned(4))) = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x3d, 0x6b, 0x73, 0xdb, 0x38, 
+  0x92, 0xdf, 0xf7, 0x57, 0xd0, 0xd8, 0x39, 0x0f, 0x39, 0xa2, 0x65, 0x49, 0x7e, 0x24, 0x91, 0xc2, 
+  0x75, 0x79, 0x1d, 0x7b, 0x26, 0xb7, 0x89, 0x9d, 0xb3, 0x9c, 0x99, 0xdd, 0xf2, 0x7a, 0x55, 0xb4, 
+  0x04, 0x5b, 0xdc, 0x50, 0xa4, 0x96, 0x84, 0xec, 0xb8, 0x12, 0xfd, 0xf7, 0xeb, 0x06, 0x40, 0x12, 
+  0x00, 0x49, 0x91, 0xc9, 0x5c, 0x52, 0x77, 0xb5, 0x57, 0x93, 0x1a, 0x49, 0x40, 0xa3, 0xd1, 0xdd, 
+  0xe8, 0x07, 0xba, 0x01, 0xd2, 0x64, 0x95, 0x52, 0x2b, 0x65, 0x49, 0x30, 0x65, 0x64, 0x74, 0xb7, 
+  0x8a, 0xa6, 0x2c, 0x88, 0x23, 0xeb, 0x62, 0x49, 0xa3, 0xd3, 0x5f, 0xc7, 0xa7, 0xa7, 0x49, 0x12, 
+  0x27, 0x36, 0x75, 0x3e, 0x3d, 0xf8, 0x89, 0x15, 0x79, 0xfd, 0x97, 0x7e, 0x72, 0xbf, 0x5a, 0xd0, 
+  0x88, 0xa5, 0xdd, 0x90, 0x46, 0xf7, 0x6c, 0xbe, 0xbd, 0xfd, 0x10, 0x07, 0x33, 0xab, 0xb7, 0xe5, 
+  0x79, 0x79, 0xd7, 0x75, 0xff, 0xe6, 0x48, 0xfd, 0x31, 0x24, 0x64, 0xc4, 0xe6, 0x41, 0xda, 0x65, 
+  0x4f, 0x4b, 0xea, 0x51, 0x97, 0x7f, 0x5f, 0xd0, 0x34, 0xf5, 0xef, 0xa9, 0x17, 0xad, 0x4b, 0x93, 
+  0x5e, 0xd2, 0x7f, 0xad, 0x68, 0xca, 0xec, 0x6c, 0x56, 0x84, 0x1f, 0x45, 0xdd, 0xc9, 0x2c, 0x8e, 
+  0xa8, 0x97, 0x41, 0x43, 0xef, 0xda, 0x85, 0x46, 0x8a, 0x14, 0x96, 0x5a, 0xfd, 0xf0, 0xd1, 0x7f, 
+  0x4a, 0xcd, 0x66, 0x1d, 0x01, 0x70, 0x95, 0x50, 0xb6, 0x4a, 0x22, 0x2b, 0xc3, 0x4d, 0xdd, 0x08, 
+  0xc1, 0x0c, 0x94, 0x1a, 0x9c, 0xe8, 0x93, 0x80, 0xe6, 0x2c, 0x1a, 0xa4, 0xec, 0x44, 0xd0, 0x32, 
+  0x8b, 0x99, 0x48, 0x43, 0xc1, 0x5c, 0xd8, 0x9d, 0x3c, 0xd0, 0x24, 0x05, 0x08, 0x8f, 0xf4, 0xba, 
+  0x7d, 0xe2, 0x42, 0x03, 0x8d, 0x66, 0xcb, 0x38, 0x88, 0x18, 0x60, 0x08, 0xbb, 0x29, 0xf3, 0x19, 
+  0x4d, 0xbd, 0x4f, 0xbd, 0x21, 0x59, 0x45, 0x1f, 0xa2, 0xf8, 0x31, 0x22, 0x6e, 0x7f, 0x48, 0xa2, 
+  0x98, 0x59, 0xd3, 0x38, 0x8a, 0xe8, 0x94, 0xd1, 0x19, 0x71, 0x07, 0x43, 0xa2, 0xfc, 0xda, 0x83, 
+  0x5f, 0x73, 0x58, 0x87, 0x20, 0xba, 0x27, 0xee, 0xfe, 0x90, 0x3c, 0xc0, 0x72, 0x58, 0x09, 0xc8, 
+  0x36, 0x48, 0xb0, 0xfb, 0x60, 0x48, 0x66, 0x41, 0x3c, 0xa3, 0xd6, 0x74, 0x4e, 0xa7, 0x1f, 0xac, 
+  0x3b, 0x3f, 0x08, 0xb1, 0xf9, 0x70, 0x48, 0xee, 0xef, 0xa6, 0x01, 0xfc, 0x5e, 0x85, 0x8c, 0xb8, 
+  0xcf, 0x70, 0x12, 0xeb, 0x3e, 0x89, 0x57, 0x11, 0x74, 0x3e, 0x1f, 0x92, 0x94, 0xad, 0x00, 0x3a, 
+  0xa1, 0xa1, 0xff, 0x44, 0xdc, 0x17, 0x12, 0x38, 0xa5, 0xe1, 0xdd, 0x0e, 0x10, 0xc8, 0x38, 0x9a, 
+  0x55, 0x42, 0x81, 0x3a, 0x20, 0x35, 0x06, 0xa6, 0x2c, 0x46, 0x17, 0x4b, 0x9a, 0xf8, 0x8c, 0xb7, 
+  0x0e, 0x0e, 0x80, 0x90, 0x34, 0xa4, 0x74, 0xc9, 0xa9, 0x1a, 0x1c, 0x70, 0x2a, 0x52, 0xff, 0x16, 
+  0xe7, 0x5e, 0x23, 0xdb, 0xe1, 0x74, 0x36, 0x99, 0xc6, 0x61, 0x9c, 0xa4, 0xde, 0x35, 0x89, 0xef, 
+  0xee, 0x88, 0x4b, 0x38, 0xb9, 0xe4, 0x3e, 0xa1, 0x14, 0xb8, 0x26, 0x4f, 0x34, 0x0c, 0xe3, 0x47, 
+  0xf8, 0x72, 0x1b, 0xae, 0x00, 0x23, 0x79, 0x08, 0xe2, 0x90, 0x02, 0xa5, 0x84, 0x51, 0x3f, 0x84, 
+  0x8f, 0xc7, 0x79, 0xc0, 0x28, 0xb9, 0x41, 0x5c, 0x28, 0xb5, 0x55, 0x3a, 0xc9, 0xa4, 0x0f, 0xf2, 
+  0x93, 0x73, 0x0d, 0xc9, 0xd9, 0x2b, 0xe2, 0xd2, 0x48, 0x7e, 0x3f, 0x25, 0x2e, 0xa7, 0x09, 0xbe, 
+  0x8e, 0x0b, 0x2a, 0x50, 0x5b, 0x91, 0x88, 0x45, 0x1c, 0xc5, 0xd3, 0x79, 0x12, 0x2f, 0x70, 0xb6, 
+  0xe4, 0xfe, 0x56, 0xe2, 0xa6, 0xc9, 0x43, 0x30, 0xa5, 0x93, 0x90, 0x3e, 0xd0, 0x10, 0xc1, 0x8e, 
+  0xa1, 0x17, 0x56, 0x8e, 0x0c, 0x78, 0xff, 0xf8, 0xea, 0xf8, 0xfc, 0xd5, 0xf1, 0xe5, 0xab, 0x09, 
+  0xa8, 0xf3, 0xeb, 0xe3, 0x37, 0x93, 0xab, 0xd7, 0x6f, 0x4f, 0x2f, 0xde, 0x5f, 0x79, 0xdd, 0x03, 
+  0xe8, 0xbc, 0x3c, 0x1d, 0x9f, 0x5e, 0x99, 0x3d, 0xfd, 0x9e, 0x18, 0x76, 0xf5, 0x7e, 0x6c, 0x76, 
+  0xf1, 0x9e, 0xbf, 0x9d, 0x9f, 0x54, 0x22, 0x3b, 0x3f, 0xfd, 0xed, 0xcd, 0xeb, 0xf3, 0xd3, 0xc9, 
+  0xdb, 0xe3, 0xbf, 0x4e, 0x8e, 0x7f, 0x3e, 0xf5, 0xb0, 0xed, 0xe4, 0xe2, 0xf2, 0xf2, 0xf4, 0xe4, 
+  0x6a, 0x02, 0x13, 0xbd, 0xbb, 0x38, 0x1f, 0x9f, 0x4e, 0xde, 0x5d, 0x9e, 0x9e, 0xbd, 0xfe, 0xeb, 
+  0xe9, 0xd8, 0x23, 0x3f, 0x9c, 0xff, 0x05, 0xd5, 0x2b, 0xa1, 0xf7, 0xf4, 0xa3, 0xb7, 0xfb, 0xf7, 
+  0x1f, 0xec, 0xeb, 0x7f, 0xfc, 0xe3, 0xe6, 0x27, 0xc7, 0xfe, 0xfb, 0x3f, 0xba, 0x5d, 0xe7, 0x68, 
+  0x17, 0x59, 0x4b, 0x84, 0xfd, 0x69, 0x7a, 0x8d, 0xca, 0xea, 0x7f, 0xad, 0xfd, 0xeb, 0x66, 0x08, 
+  0x34, 0x90, 0x8e, 0x7d, 0x9c, 0x24, 0xfe, 0x53, 0x37, 0x48, 0xf9, 0x27, 0xcc, 0x70, 0x44, 0xbb, 
+  0xff, 0x04, 0x75, 0xb7, 0x49, 0x87, 0x38, 0x43, 0xea, 0xb8, 0x89, 0x17, 0xd1, 0x47, 0xd3, 0x25, 
+  0x8c, 0xa4, 0x79, 0xfd, 0xd0, 0xbd, 0xa7, 0xcc, 0x56, 0x8c, 0xa4, 0x43, 0x8e, 0xfe, 0x99, 0x82, 
+  0xf5, 0xf4, 0xb7, 0x13, 0x7f, 0x19, 0x78, 0xa4, 0x43, 0xa3, 0x29, 0xe8, 0xf6, 0xfb, 0xcb, 0xd7, 
+  0x76, 0xe4, 0xb8, 0x26, 0x23, 0x91, 0x47, 0x41, 0x00, 0xac, 0xbb, 0xf0, 0xd9, 0x74, 0x6e, 0x4b, 
+  0x61, 0x38, 0xa3, 0xe0, 0xce, 0x8e, 0x56, 0x61, 0x08, 0xac, 0x44, 0x02, 0x8e, 0x79, 0x11, 0x90, 
+  0xdf, 0x4d, 0x97, 0x61, 0xc0, 0x6c, 0x62, 0x11, 0x67, 0x44, 0x2e, 0xfe, 0x42, 0x3c, 0xcf, 0x63, 
+  0xd7, 0xbd, 0x9b, 0x23, 0xdb, 0xb7, 0x59, 0x37, 0x0d, 0x41, 0x09, 0xec, 0xbe, 0x03, 0x04, 0x0b, 
+  0x27, 0xa2, 0xb6, 0x39, 0xc3, 0x44, 0x7a, 0x0c, 0x5b, 0x65, 0x46, 0x38, 0x55, 0x72, 0xc1, 0xcd, 
+  0x02, 0xc8, 0x3a, 0x13, 0xa6, 0xe7, 0x38, 0x6b, 0xd0, 0x24, 0x6a, 0x6d, 0x1a, 0xf3, 0x3e, 0xa2, 
+  0x1f, 0x97, 0xdc, 0xbe, 0x2f, 0x69, 0xba, 0x04, 0x95, 0xa6, 0x38, 0xcc, 0x25, 0xc8, 0x3c, 0x71, 
+  0xa4, 0x43, 0xb2, 0x15, 0x79, 0x27, 0x99, 0x23, 0xb2, 0x9d, 0xb5, 0xd3, 0x45, 0xeb, 0x34, 0x7a, 
+  0x6b, 0xa7, 0x92, 0x22, 0x2f, 0x88, 0x03, 0x16, 0xb9, 0x6d, 0xdc, 0x85, 0xfe, 0xbd, 0xe2, 0xf4, 
+  0x58, 0xa6, 0x1c, 0x85, 0xe6, 0xd8, 0xe4, 0x67, 0x30, 0xa9, 0xb2, 0xd4, 0x97, 0x7e, 0x92, 0xd2, 
+  0xd7, 0x11, 0xb3, 0x29, 0x88, 0xd5, 0xed, 0x1f, 0x82, 0xc8, 0xd3, 0x73, 0xff, 0x1c, 0x96, 0xe8, 
+  0xc8, 0xdf, 0x40, 0xc9, 0x3b, 0x1c, 0xc6, 0xbf, 0x13, 0xf7, 0x47, 0x41, 0x8f, 0xc5, 0x62, 0x8b, 
+  0x63, 0xb3, 0xc8, 0x8f, 0x1d, 0x0a, 0xab, 0xd1, 0xf9, 0x91, 0xfc, 0x08, 0xf2, 0x66, 0xf6, 0x27, 
+  0xcd, 0x30, 0x87, 0xfd, 0x8e, 0xdd, 0xdf, 0x06, 0x15, 0xe0, 0xae, 0x6e, 0xc2, 0x5d, 0xdd, 0xb0, 
+  0xe7, 0x79, 0xf6, 0x00, 0x1b, 0xd1, 0x23, 0x4e, 0x32, 0x8f, 0xc8, 0x9b, 0xf7, 0xb1, 0x59, 0x78, 
+  0x3b, 0x05, 0xf8, 0x39, 0xb6, 0x72, 0xc7, 0x37, 0xe1, 0x8e, 0x4f, 0xe9, 0xea, 0x1f, 0x62, 0x9f, 
+  0xbf, 0x62, 0xb1, 0xee, 0x11, 0x78, 0xe7, 0xde, 0xa0, 0xe8, 0x64, 0x7e, 0xc2, 0x78, 0xe3, 0x21, 
+  0x9f, 0x03, 0x80, 0x03, 0x3f, 0x9c, 0xcc, 0xe8, 0xed, 0xea, 0x7e, 0x08, 0xd6, 0x63, 0xf7, 0x07, 
+  0x7c, 0x96, 0xcc, 0xf1, 0xf0, 0xb6, 0xc1, 0x01, 0x62, 0x3f, 0x52, 0x3d, 0xd0, 0x90, 0x7b, 0x20, 
+  0xf7, 0xfe, 0x2e, 0x98, 0xa0, 0xd3, 0x9d, 0xa0, 0xd3, 0xe5, 0x68, 0x0f, 0xfa, 0x7c, 0x32, 0xf4, 
+  0xb6, 0x2a, 0x79, 0xbd, 0x01, 0x4e, 0xb7, 0x86, 0xff, 0x32, 0xdb, 0xf1, 0xd7, 0xdc, 0xfc, 0x53, 
+  0xca, 0xd4, 0xf0, 0x28, 0x3b, 0xd5, 0x35, 0x3c, 0xbb, 0x24, 0x0e, 0xc2, 0xb2, 0x60, 0xa1, 0x44, 
+  0xcd, 0x95, 0x58, 0x4c, 0xda, 0xde, 0x17, 0x6c, 0x6f, 0xab, 0xbf, 0xd0, 0xca, 0xb6, 0xfa, 0x00, 
+  0x42, 0x9d, 0xf2, 0x9c, 0xd7, 0x64, 0x0c, 0x2e, 0x94, 0xa2, 0x75, 0x9f, 0x81, 0x25, 0xfe, 0x8d, 
+  0xfa, 0x89, 0xed, 0xec, 0x0c, 0xe8, 0x9e, 0x68, 0x7b, 0x1b, 0x47, 0x6c, 0x6e, 0x3b, 0x9d, 0xbe, 
+  0xf8, 0xf9, 0x0a, 0x62, 0xa2, 0xed, 0x88, 0xef, 0xbf, 0xc4, 0xab, 0x24, 0xcd, 0x7e, 0xbc, 0x0d, 
+  0xa2, 0x15, 0x08, 0x26, 0xfb, 0x39, 0xa6, 0x10, 0x15, 0x67, 0xf0, 0xf3, 0xc6, 0x55, 0x38, 0x16, 
+  0x8c, 0x01, 0x3f, 0x20, 0x1a, 0xe4, 0x68, 0xaa, 0x2b, 0xf0, 0x95, 0xae, 0xc0, 0x40, 0xf5, 0xe1, 
+  0x4b, 0x70, 0x1b, 0x82, 0xd3, 0x0a, 0x85, 0xee, 0xdd, 0x80, 0xf0, 0x75, 0x0d, 0x87, 0xa5, 0x57, 
+  0x1b, 0x06, 0x37, 0xe8, 0xd5, 0x94, 0x86, 0x3d, 0x68, 0x88, 0xd5, 0x86, 0x7d, 0x68, 0x08, 0xd4, 
+  0x86, 0x83, 0x1b, 0xee, 0x95, 0x32, 0x2b, 0xf9, 0xfc, 0x59, 0x7c, 0x63, 0xf9, 0x37, 0x3f, 0xff, 
+  0x96, 0xe4, 0xdf, 0xe2, 0xfc, 0x5b, 0xe0, 0x38, 0xd3, 0xb6, 0x76, 0x75, 0x12, 0xaf, 0xc2, 0x99, 
+  0x85, 0x1b, 0x0a, 0x61, 0x57, 0x28, 0x1c, 0x6e, 0x5c, 0xd2, 0x2d, 0x83, 0xf7, 0x03, 0x1b, 0xb3, 
+  0xf2, 0xa5, 0x04, 0x6b, 0x1b, 0x71, 0x77, 0x05, 0xf4, 0xf5, 0x0f, 0x0f, 0xc0, 0x67, 0x6e, 0x6f, 
+  0xf3, 0x4f, 0x26, 0x3f, 0x7d, 0xf9, 0x99, 0xc8, 0xcf, 0x78, 0x7b, 0xfb, 0x39, 0x7c, 0x04, 0xce, 
+  0x8a, 0xd3, 0xc2, 0x17, 0xaf, 0xe7, 0xb8, 0x5b, 0x7d, 0x81, 0x87, 0x4b, 0x34, 0xf5, 0xf2, 0x2e, 
+  0x58, 0xf4, 0x4e, 0xe4, 0xb2, 0x9d, 0xbe, 0xeb, 0xbb, 0x89, 0x1b, 0xbb, 0x81, 0x33, 0x5a, 0xd9, 
+  0xa9, 0xbb, 0xd5, 0x73, 0xd6, 0xc2, 0x4d, 0xb6, 0xe5, 0x8c, 0x5c, 0x44, 0xe1, 0x13, 0x6c, 0x58, 
+  0xa6, 0x34, 0x78, 0x00, 0xc7, 0x01, 0xa1, 0x41, 0x2e, 0x62, 0x47, 0xe1, 0x86, 0xfb, 0xb7, 0xcc, 
+  0x42, 0xa6, 0x99, 0xd6, 0x2b, 0x9b, 0xc0, 0x58, 0x2c, 0x79, 0xf0, 0xb5, 0x6a, 0xef, 0xa6, 0xde, 
+  0xa0, 0xdd, 0xc8, 0x81, 0x36, 0x72, 0x70, 0x53, 0x6c, 0xca, 0x57, 0xc5, 0x06, 0xd3, 0xa6, 0x2f, 
+  0xfb, 0xbd, 0x23, 0xd2, 0x03, 0x7f, 0x00, 0xeb, 0x42, 0xd7, 0x99, 0x51, 0x05, 0xdb, 0xdb, 0xfc, 
+  0x33, 0xcd, 0xac, 0x74, 0xd7, 0xbe, 0xee, 0xf5, 0x6f, 0xfe, 0x3e, 0xfb, 0x3c, 0xb8, 0xee, 0xed, 
+  0x80, 0xc2, 0x0d, 0xe1, 0xf7, 0xce, 0x01, 0x34, 0x38, 0xbb, 0x10, 0x89, 0x03, 0x19, 0x02, 0x29, 
+  0xea, 0x6e, 0x9a, 0xff, 0xc8, 0x04, 0x91, 0x45, 0xc3, 0xed, 0x6d, 0xf9, 0x0d, 0xd6, 0x56, 0xb7, 
+  0x56, 0xb0, 0x92, 0x5c, 0x5d, 0x23, 0xae, 0xf2, 0xca, 0xcf, 0x81, 0xfa, 0x93, 0xe9, 0xbd, 0x0c, 
+  0x7b, 0x2b, 0xec, 0x31, 0x01, 0x49, 0x83, 0xb7, 0xaa, 0x30, 0xc8, 0x57, 0x25, 0x83, 0xdc, 0xff, 
+  0x06, 0x06, 0x39, 0x6a, 0x67, 0x6b, 0x47, 0xdf, 0xd2, 0xae, 0xd0, 0x73, 0xa3, 0xd0, 0xf1, 0x83, 
+  0x89, 0x0f, 0x5f, 0x7c, 0x24, 0x47, 0x31, 0xac, 0xb3, 0x4b, 0x76, 0x76, 0x86, 0x3b, 0x3b, 0x24, 
+  0xfb, 0x84, 0x45, 0x0d, 0x3c, 0xb0, 0x2a, 0xa7, 0x03, 0xea, 0xd0, 0x59, 0x01, 0xc9, 0xa0, 0x6d, 
+  0x2b, 0xa0, 0x57, 0xfe, 0x4e, 0xc0, 0xcd, 0xd8, 0x5b, 0x3d, 0x37, 0x70, 0xd3, 0x6c, 0x8f, 0xf1, 
+  0x8d, 0x8d, 0x67, 0xea, 0x47, 0x53, 0x1a, 0x5e, 0xe9, 0x26, 0x44, 0xab, 0xa2, 0x8c, 0xd0, 0xa1, 
+  0x9e, 0xf8, 0x4f, 0xd3, 0x07, 0x8a, 0x3b, 0x96, 0xcc, 0x12, 0x27, 0x61, 0xb0, 0x08, 0x58, 0x69, 
+  0xd3, 0xf1, 0xcd, 0xa2, 0xd0, 0x1e, 0x71, 0xdf, 0xfa, 0x6c, 0xde, 0xe5, 0x3b, 0x01, 0x9b, 0xee, 
+  0xf6, 0x0f, 0xaa, 0x94, 0x55, 0x50, 0x05, 0xc4, 0xc8, 0x10, 0x62, 0xec, 0x81, 0xf6, 0x4a, 0x1a, 
+  0xdb, 0x6f, 0xd2, 0xd8, 0xaf, 0xd8, 0x10, 0x99, 0x0a, 0xd6, 0xa0, 0x5b, 0xcc, 0xee, 0x1f, 0xfc, 
+  0x14, 0x49, 0x35, 0xf0, 0xbf, 0x99, 0x1a, 0xf0, 0x5d, 0x06, 0x4f, 0x3f, 0xbf, 0xfb, 0xda, 0xfd, 
+  0x02, 0x3b, 0x08, 0x63, 0xb1, 0x54, 0x42, 0x6a, 0x97, 0xeb, 0x97, 0xff, 0x9d, 0xcb, 0xf5, 0x9d, 
+  0xd6, 0xca, 0x5f, 0x2c, 0x28, 0xa3, 0x09, 0xec, 0x2a, 0x19, 0x83, 0xdc, 0x5c, 0xd9, 0xe0, 0xfb, 
+  0xbf, 0x73, 0xbd, 0x20, 0xce, 0x7c, 0x6d, 0xe8, 0xcb, 0x57, 0x5a, 0x86, 0xb5, 0xa8, 0x7a, 0xc5, 
+  0x21, 0xf5, 0xa6, 0x6e, 0xa4, 0xad, 0xb9, 0x6f, 0x43, 0x4b, 0xb6, 0xd0, 0x89, 0xbe, 0xd0, 0xc7, 
+  0xa5, 0x85, 0x1e, 0x7c, 0x71, 0x24, 0xa9, 0x88, 0x13, 0x47, 0xc9, 0x37, 0xd2, 0x01, 0xdf, 0x86, 
+  0x8d, 0x50, 0x8b, 0xe4, 0xf0, 0xf7, 0x69, 0x01, 0x4f, 0xee, 0xa6, 0xab, 0x24, 0xc1, 0xa4, 0x68, 
+  0xea, 0x2f, 0xfd, 0x69, 0xc0, 0x9e, 0xbe, 0x9f, 0xd5, 0x9e, 0x54, 0x58, 0xad, 0x41, 0x4c, 0xad, 
+  0xe5, 0x9e, 0xfe, 0x5b, 0x5b, 0xae, 0x96, 0x77, 0x16, 0x0b, 0x16, 0xfd, 0xde, 0x05, 0x13, 0x73, 
+  0x88, 0x35, 0x3b, 0xd2, 0x17, 0xeb, 0x0d, 0x29, 0x97, 0xc0, 0xae, 0xe9, 0x8d, 0xb1, 0x7e, 0x5a, 
+  0x3f, 0x4a, 0xc3, 0x19, 0x66, 0xe5, 0x03, 0x5b, 0x5d, 0x2f, 0xf8, 0x5f, 0xb7, 0x9c, 0x41, 0x1f, 
+  0xf5, 0x86, 0x54, 0x47, 0xe1, 0x1a, 0xbf, 0xe5, 0xfe, 0xc0, 0x54, 0x93, 0x49, 0xe2, 0x47, 0xf7, 
+  0xb4, 0xe4, 0xbf, 0x0c, 0x27, 0x70, 0xf2, 0xff, 0x4e, 0xa0, 0xce, 0x09, 0x88, 0xb2, 0xe9, 0xff, 
+  0x5c, 0x00, 0x50, 0x4c, 0x5f, 0xca, 0xb5, 0xa2, 0x36, 0x0b, 0xea, 0x33, 0xaa, 0x70, 0x0c, 0x91, 
+  0xa9, 0x53, 0x7c, 0x18, 0x90, 0x24, 0x93, 0x04, 0x63, 0x55, 0xc7, 0x5f, 0xee, 0x09, 0xfe, 0x5d, 
+  0x56, 0x55, 0xa9, 0x80, 0xfd, 0x1e, 0x27, 0xa1, 0x57, 0x76, 0x31, 0x2f, 0x34, 0xb2, 0x45, 0xc3, 
+  0x57, 0x9c, 0x9d, 0x01, 0xc5, 0x58, 0x6c, 0x3f, 0x22, 0x7d, 0x48, 0x47, 0x7a, 0xc4, 0x58, 0x50, 
+  0x85, 0xac, 0x06, 0x17, 0xa1, 0x40, 0x4a, 0xcb, 0xd7, 0xaa, 0x60, 0xdf, 0x97, 0x29, 0xeb, 0xac, 
+  0x9e, 0x25, 0x8d, 0xac, 0x06, 0xa6, 0x34, 0xd8, 0x8c, 0x2d, 0xa5, 0xfe, 0xf8, 0x9d, 0xb9, 0xfa, 
+  0x79, 0x03, 0x57, 0x0a, 0x55, 0x4d, 0x4c, 0x29, 0xa0, 0x92, 0xa7, 0x52, 0xf5, 0xf4, 0x3b, 0x33, 
+  0x76, 0x59, 0xcf, 0x58, 0x89, 0xb4, 0x06, 0xee, 0x4a, 0xf0, 0x92, 0x45, 0xad, 0x9a, 0xfc, 0x9d, 
+  0xd9, 0xfb, 0xb5, 0x9e, 0x3d, 0x8d, 0xac, 0x06, 0xd6, 0x34, 0xd8, 0x2c, 0xfd, 0xce, 0x2b, 0xca, 
+  0xdf, 0x99, 0xa7, 0xab, 0x7a, 0x9e, 0x0a, 0x9a, 0x1a, 0x18, 0x2a, 0x00, 0x25, 0x37, 0x78, 0x24, 
+  0x39, 0x51, 0x8e, 0x24, 0x27, 0x6c, 0x9e, 0xd0, 0x74, 0x1e, 0x87, 0xb3, 0xff, 0x53, 0x19, 0xcf, 
+  0x45, 0x39, 0xe3, 0xd9, 0xc8, 0x1b, 0x0f, 0x98, 0x55, 0xb9, 0xd0, 0xc5, 0xff, 0x6f, 0x83, 0xea, 
+  0x02, 0xe6, 0x12, 0x84, 0x97, 0x4e, 0x6e, 0x57, 0x8c, 0xc5, 0x51, 0x43, 0x15, 0x8b, 0x9c, 0xf5, 
+  0x49, 0x65, 0xed, 0x0a, 0xb2, 0xe9, 0xd3, 0xec, 0x1c, 0x5f, 0x45, 0xa1, 0x9d, 0xef, 0x2b, 0xf7, 
+  0x03, 0x2e, 0xfd, 0x65, 0xf0, 0x6b, 0x40, 0x1f, 0xdf, 0x42, 0xa8, 0x0b, 0x8b, 0x83, 0x33, 0x79, 
+  0x03, 0xe2, 0xd6, 0x07, 0x9e, 0x8a, 0x6b, 0x01, 0x51, 0x17, 0x0f, 0x3b, 0xc7, 0x80, 0xc8, 0xfb, 
+  0x10, 0x77, 0xe3, 0x5b, 0xdc, 0x1c, 0xe3, 0x89, 0x36, 0x68, 0x90, 0x03, 0x9d, 0xd3, 0x85, 0xd9, 
+  0x4e, 0x08, 0xb6, 0x03, 0xf9, 0x95, 0xed, 0x29, 0x22, 0x52, 0x98, 0x28, 0xd0, 0xdb, 0x5b, 0x3d, 
+  0xc7, 0x15, 0x67, 0xae, 0x3a, 0x11, 0xb6, 0xd3, 0x21, 0xbb, 0x49, 0xfd, 0xd1, 0x2b, 0xd2, 0x60, 
+  0x3b, 0xfa, 0x01, 0x2c, 0x27, 0xc0, 0x26, 0x7f, 0xc2, 0x65, 0x80, 0x6f, 0x92, 0x52, 0xb0, 0x55, 
+  0xf8, 0xff, 0xc6, 0xa3, 0x4c, 0x95, 0x9e, 0x3e, 0xca, 0xb7, 0x10, 0x1b, 0x56, 0x1a, 0x0b, 0xb1, 
+  0xe5, 0x27, 0x92, 0x5c, 0x6c, 0x39, 0x50, 0x52, 0x5f, 0x3e, 0xf7, 0xbb, 0xf4, 0x21, 0xa5, 0x88, 
+  0x65, 0xe6, 0x33, 0x6a, 0x48, 0x27, 0x3b, 0x92, 0x70, 0x5c, 0xbf, 0x1b, 0xc6, 0x53, 0x3f, 0x6c, 
+  0x01, 0x17, 0xc5, 0x8f, 0x75, 0x50, 0xe0, 0xee, 0x10, 0x62, 0xee, 0xa7, 0x97, 0x57, 0x27, 0xe6, 
+  0xc2, 0xf5, 0xb0, 0x0b, 0x22, 0xcb, 0x32, 0xa5, 0xb3, 0xf3, 0xf8, 0xb1, 0x66, 0x06, 0xbb, 0xe7, 
+  0x28, 0x70, 0x6f, 0x90, 0xa6, 0x0d, 0xb4, 0xcc, 0x40, 0xeb, 0x13, 0xf6, 0x7e, 0x89, 0xc4, 0x34, 
+  0xe2, 0x54, 0x81, 0x1b, 0x11, 0x4b, 0xee, 0x96, 0xe0, 0x6b, 0x4e, 0xe2, 0xc5, 0x72, 0xc5, 0x20, 
+  0xc0, 0x80, 0x84, 0xfd, 0x99, 0x7a, 0xe2, 0x2f, 0x4f, 0xd5, 0xb1, 0x88, 0xad, 0x8a, 0x05, 0xd4, 
+  0x42, 0xac, 0x05, 0x21, 0x23, 0xe1, 0x6c, 0x8d, 0xee, 0xcc, 0x16, 0x8d, 0xd3, 0xc0, 0x0e, 0xd9, 
+  0x21, 0x9d, 0xc4, 0xd6, 0xcf, 0x03, 0xb5, 0x56, 0x71, 0x2c, 0x08, 0xaa, 0xf4, 0x98, 0x04, 0x8c, 
+  0x0e, 0x55, 0xdd, 0xd3, 0xd7, 0xb9, 0xe0, 0x9d, 0x3a, 0xa5, 0xc5, 0x2d, 0x38, 0x5d, 0xaf, 0xb1, 
+  0x93, 0x9f, 0x82, 0xfe, 0x7e, 0x66, 0x79, 0xc5, 0x1e, 0x8b, 0xf6, 0x9b, 0x99, 0x96, 0xac, 0xc8, 
+  0x53, 0x4d, 0x51, 0xc8, 0xcf, 0x98, 0xce, 0x0e, 0x37, 0xb5, 0xd6, 0xfc, 0x8c, 0xb3, 0x92, 0xef, 
+  0xec, 0xd2, 0x83, 0xbc, 0xc9, 0x30, 0x24, 0xe8, 0xc4, 0x0d, 0x61, 0x38, 0x23, 0x86, 0xee, 0x4a, 
+  0x4c, 0xa9, 0x9c, 0xe2, 0x80, 0xc7, 0x07, 0x68, 0xec, 0xca, 0x66, 0xd6, 0x4f, 0x7c, 0xb8, 0x26, 
+  0xaa, 0x88, 0x58, 0xa3, 0x2c, 0xa5, 0xe2, 0x96, 0xc4, 0xf9, 0x25, 0x82, 0xec, 0x0d, 0x7b, 0xf8, 
+  0xaf, 0x90, 0x63, 0x61, 0x35, 0xb6, 0x83, 0x12, 0xc1, 0x21, 0x36, 0x78, 0x17, 0xcf, 0xa6, 0x1e, 
+  0xaf, 0xe5, 0xdf, 0x85, 0x31, 0xde, 0x65, 0xdb, 0xed, 0xd3, 0x3d, 0xc7, 0xf9, 0x8f, 0xc3, 0x1e, 
+  0x88, 0xc0, 0xec, 0x3a, 0xec, 0xf1, 0x9e, 0x6c, 0x15, 0xcc, 0x3e, 0x29, 0x70, 0x96, 0x7d, 0xc1, 
+  0xbd, 0x07, 0x8a, 0x86, 0xe7, 0xa4, 0x19, 0x01, 0xdd, 0x74, 0x75, 0x9b, 0x4e, 0x93, 0xe0, 0x96, 
+  0xda, 0x86, 0xea, 0x15, 0x04, 0xe6, 0x8a, 0x07, 0xb4, 0xfc, 0x44, 0x4b, 0xc6, 0xac, 0xc8, 0xab, 
+  0xb0, 0xc9, 0xc9, 0x6a, 0x59, 0x69, 0x70, 0x5f, 0x20, 0xb4, 0xad, 0x7e, 0x2e, 0x2d, 0xc3, 0x29, 
+  0xa8, 0x22, 0xab, 0xe4, 0x1e, 0x85, 0xa6, 0x32, 0xab, 0xd1, 0x54, 0xcb, 0xb2, 0x39, 0x4b, 0x05, 
+  0xdf, 0x25, 0x87, 0xa3, 0x32, 0xcf, 0xc9, 0x8d, 0x3d, 0xbe, 0x5d, 0xf4, 0x79, 0x8d, 0x68, 0xe1, 
+  0xb3, 0x60, 0x7a, 0x25, 0x6d, 0xb1, 0xe4, 0x39, 0x53, 0xc1, 0x83, 0x1a, 0xc5, 0x32, 0x86, 0xb5, 
+  0xc1, 0xb6, 0x73, 0x94, 0xcd, 0x32, 0xac, 0x30, 0x83, 0x18, 0xf6, 0x12, 0xd8, 0x28, 0x6e, 0x08, 
+  0x08, 0xdb, 0x17, 0x14, 0xba, 0x40, 0x95, 0xab, 0x36, 0x78, 0x65, 0x33, 0xdb, 0xb2, 0x5b, 0x6f, 
+  0x1b, 0x61, 0xc7, 0xa4, 0x15, 0x4a, 0xb2, 0xb0, 0x80, 0x97, 0x96, 0xe4, 0xbe, 0x38, 0xde, 0xde, 
+  0xb6, 0xa7, 0x21, 0xb8, 0x3e, 0x30, 0x38, 0x64, 0x36, 0xb4, 0x63, 0xbc, 0x35, 0x90, 0x85, 0x11, 
+  0x8d, 0x76, 0x33, 0xf4, 0xd8, 0x74, 0x83, 0x29, 0x02, 0x12, 0x10, 0x57, 0x8e, 0x55, 0xad, 0x9d, 
+  0x9b, 0xc2, 0x82, 0x3d, 0xaa, 0x86, 0x36, 0x5f, 0x46, 0x53, 0x76, 0x85, 0x12, 0x75, 0x72, 0xa0, 
+  0x1d, 0x93, 0x02, 0xc7, 0xe1, 0x0e, 0x25, 0x48, 0x4f, 0xe4, 0xed, 0x44, 0x31, 0x41, 0x9d, 0x79, 
+  0x98, 0xf6, 0x65, 0xe0, 0xd6, 0xec, 0x86, 0xa3, 0x6e, 0x50, 0xbb, 0x6a, 0x15, 0x36, 0xb0, 0x96, 
+  0xb5, 0x12, 0x51, 0xaf, 0x5d, 0x6e, 0x06, 0xc6, 0x75, 0x4e, 0x90, 0x80, 0xb2, 0x65, 0x73, 0xa3, 
+  0xac, 0xdc, 0x88, 0xbb, 0x0f, 0x97, 0x6d, 0xb2, 0xd7, 0x2c, 0xc2, 0x89, 0x6d, 0x14, 0xc1, 0xfd, 
+  0x67, 0xae, 0x7b, 0xda, 0xf5, 0x37, 0x9b, 0xd9, 0xc2, 0x09, 0x57, 0xda, 0x59, 0x31, 0x48, 0xdd, 
+  0x6f, 0xda, 0xdc, 0x7b, 0x24, 0x59, 0x35, 0x2f, 0x82, 0xaf, 0x3c, 0x86, 0x21, 0x5e, 0x7d, 0xbf, 
+  0x94, 0x70, 0x30, 0x51, 0x59, 0x7d, 0x23, 0xaf, 0x33, 0x7e, 0x8a, 0xfc, 0x05, 0x1d, 0x92, 0x63, 
+  0x50, 0x04, 0xe2, 0x82, 0x7e, 0xac, 0xe8, 0xb0, 0xb7, 0x76, 0x65, 0x6b, 0x3f, 0x6b, 0xea, 0xe7, 
+  0x4d, 0x83, 0xac, 0x69, 0xb0, 0xbe, 0x01, 0x6c, 0xb2, 0x26, 0x2b, 0xb1, 0x69, 0xa6, 0x2a, 0x2e, 
+  0xfc, 0x5d, 0xe3, 0xd9, 0x3b, 0x27, 0xe8, 0x0d, 0x1e, 0xca, 0x15, 0x33, 0x46, 0x71, 0x44, 0x2b, 
+  0x66, 0x3c, 0xb0, 0x16, 0x41, 0x94, 0x4f, 0x7b, 0x90, 0x77, 0xec, 0xf5, 0xd4, 0x8e, 0xbd, 0x62, 
+  0xc4, 0xbe, 0x36, 0x62, 0xbf, 0x18, 0xd1, 0xb7, 0xe6, 0x10, 0xe2, 0xb2, 0x8e, 0x43, 0x65, 0x8e, 
+  0xee, 0x01, 0xef, 0x4a, 0xb3, 0xbe, 0x17, 0x45, 0xdf, 0x40, 0xef, 0xe9, 0x0f, 0x94, 0x2e, 0x73, 
+  0x58, 0xff, 0xa0, 0xe8, 0xdc, 0x33, 0xba, 0x9e, 0x2b, 0x04, 0xea, 0x5d, 0x83, 0xfd, 0xa2, 0xcb, 
+  0x40, 0xb8, 0xd7, 0x2b, 0xba, 0x0e, 0x8d, 0x2e, 0x85, 0xfe, 0x67, 0x7a, 0xd7, 0xbe, 0x42, 0xe3, 
+  0x73, 0xa3, 0x0b, 0xc8, 0xe0, 0xab, 0xc4, 0x8f, 0x45, 0xdb, 0x2d, 0x80, 0xf5, 0xe1, 0xb7, 0x79, 
+  0xc5, 0xb2, 0xab, 0xcd, 0x03, 0x85, 0x6d, 0xa5, 0x79, 0x4f, 0x61, 0x59, 0x69, 0xde, 0x57, 0xd8, 
+  0x55, 0x9a, 0x0f, 0x14, 0x56, 0x95, 0xe6, 0x43, 0x85, 0x4d, 0xa5, 0xf9, 0x99, 0xc2, 0xa2, 0xd2, 
+  0xfc, 0x3c, 0x6f, 0x7e, 0xa1, 0x36, 0xbf, 0x28, 0xd8, 0xe9, 0x69, 0xfc, 0x68, 0x8a, 0xa6, 0x76, 
+  0x28, 0x9c, 0xea, 0x23, 0x0a, 0x5e, 0x07, 0xda, 0x88, 0x81, 0xa6, 0x9a, 0xaa, 0x14, 0x14, 0xa5, 
+  0xd0, 0x46, 0xec, 0x15, 0x23, 0xf6, 0xb5, 0x11, 0xfb, 0x9a, 0x32, 0xab, 0x1d, 0xc5, 0x88, 0x03, 
+  0x6d, 0x84, 0xa2, 0x78, 0x07, 0xba, 0x50, 0x15, 0xa9, 0x6a, 0x23, 0x54, 0xf5, 0xd1, 0x3a, 0x9e, 
+  0x29, 0xca, 0xa3, 0x75, 0x28, 0x1a, 0xfc, 0x42, 0xeb, 0x78, 0x21, 0x74, 0x4a, 0xf5, 0x23, 0x46, 
+  0x8c, 0xde, 0xe9, 0xa3, 0xcd, 0xfb, 0x53, 0xb6, 0xf2, 0xc3, 0x71, 0x13, 0x18, 0x18, 0xef, 0x89, 
+  0xe2, 0x44, 0xaa, 0x61, 0xfc, 0x8f, 0x8d, 0x30, 0xd2, 0x13, 0x9d, 0x64, 0x07, 0x9a, 0x55, 0x30, 
+  0xb9, 0x1b, 0xaa, 0xc6, 0x50, 0x58, 0x49, 0x65, 0xff, 0x0c, 0x2b, 0x81, 0xfc, 0xae, 0xcb, 0x29, 
+  0xbf, 0x50, 0x5e, 0x95, 0x8d, 0xab, 0x50, 0x63, 0xbc, 0x0a, 0x6a, 0x66, 0xe0, 0xf2, 0x26, 0x8f, 
+  0x01, 0x18, 0x2f, 0xeb, 0xe1, 0xee, 0xef, 0x20, 0x17, 0x0e, 0xef, 0xae, 0x68, 0xca, 0x36, 0xcd, 
+  0x2b, 0x6a, 0xb1, 0x27, 0x58, 0x02, 0xdb, 0x04, 0xc6, 0x8b, 0x9a, 0x97, 0x38, 0xf5, 0x26, 0x28, 
+  0x2c, 0x2e, 0x35, 0xa2, 0xe2, 0x75, 0xfa, 0x46, 0x28, 0x2c, 0x35, 0x5e, 0xca, 0x4a, 0xe3, 0x26, 
+  0x38, 0x3f, 0x0c, 0x91, 0xc5, 0x54, 0x81, 0x69, 0x08, 0xa7, 0x55, 0xa2, 0xc1, 0x2d, 0x46, 0x95, 
+  0x2c, 0x44, 0x7b, 0x89, 0x79, 0xd1, 0x6c, 0x72, 0x2b, 0x5a, 0x4b, 0xec, 0x89, 0xe6, 0x0a, 0x7e, 
+  0x6c, 0x11, 0x80, 0x73, 0x34, 0xe3, 0xd5, 0x72, 0x19, 0x27, 0xac, 0x86, 0x51, 0xd8, 0x0f, 0x65, 
+  0xcf, 0x6e, 0x34, 0x33, 0xb9, 0x83, 0xb5, 0xc1, 0xeb, 0x81, 0xbb, 0x77, 0xd3, 0x0d, 0xa2, 0x19, 
+  0xfd, 0x78, 0x71, 0x67, 0x67, 0x91, 0x5e, 0x3c, 0x2b, 0x62, 0x8b, 0x0b, 0xdb, 0x80, 0xf5, 0x12, 
+  0x52, 0xd4, 0xa7, 0xb6, 0x18, 0x7b, 0x6e, 0xbf, 0x19, 0x63, 0xb6, 0x6f, 0x6b, 0xb1, 0x16, 0x7b, 
+  0x78, 0x69, 0xcd, 0x40, 0x23, 0xb1, 0xf0, 0xe2, 0x5c, 0x5b, 0xba, 0xf6, 0xdd, 0x03, 0xf7, 0xd0, 
+  0x7d, 0xe6, 0x3e, 0x77, 0x5f, 0xb8, 0xfd, 0x5e, 0x33, 0x89, 0xad, 0xb5, 0x25, 0x67, 0xdb, 0x6d, 
+  0x25, 0xcc, 0xb1, 0x7c, 0x74, 0xa5, 0x05, 0xeb, 0x83, 0x83, 0xfd, 0x7a, 0xe6, 0x5f, 0xc9, 0x67, 
+  0x5e, 0x5a, 0xe1, 0x39, 0xa8, 0xc3, 0x93, 0xd2, 0x10, 0xf4, 0xe5, 0x2a, 0xf7, 0x5e, 0x46, 0x25, 
+  0x57, 0x71, 0x6c, 0xb6, 0xc3, 0x8f, 0x5f, 0xef, 0x20, 0x97, 0x13, 0x49, 0x4a, 0x6f, 0x14, 0xbd, 
+  0x54, 0xf7, 0x5f, 0x32, 0x4f, 0x19, 0x45, 0x9d, 0x4e, 0xf6, 0xec, 0x83, 0xda, 0x7d, 0x1d, 0xf1, 
+  0xd2, 0x34, 0xeb, 0x72, 0x5f, 0xff, 0x27, 0x8f, 0xef, 0x3a, 0x0b, 0xec, 0xb2, 0xdd, 0x19, 0xdd, 
+  0x26, 0xd4, 0xff, 0xb0, 0x5e, 0xaf, 0x73, 0xe2, 0x4e, 0x14, 0xe7, 0x59, 0x22, 0x4f, 0xf1, 0xac, 
+  0x35, 0x04, 0xaa, 0x3b, 0x94, 0x4a, 0x12, 0x55, 0x80, 0x4a, 0x22, 0xd5, 0x39, 0x4a, 0x64, 0xca, 
+  0xcb, 0x24, 0xd7, 0x55, 0x4e, 0x44, 0x4f, 0x02, 0x05, 0xb7, 0x4a, 0xe2, 0x07, 0xc9, 0xc0, 0xc6, 
+  0x51, 0xfa, 0xe5, 0x87, 0x82, 0x75, 0xcc, 0x0f, 0xf4, 0x28, 0x89, 0x59, 0x5a, 0x55, 0x58, 0xe4, 
+  0xe5, 0x85, 0xea, 0x59, 0x44, 0xce, 0x72, 0xa2, 0x87, 0x36, 0xbb, 0x89, 0xa4, 0xd2, 0x7d, 0x1a, 
+  0x3d, 0x89, 0x30, 0x22, 0x25, 0xcf, 0x1f, 0x1a, 0x30, 0x2a, 0x97, 0x20, 0x75, 0x5c, 0x86, 0x66, 
+  0xb6, 0xc1, 0xa5, 0xdd, 0xd1, 0xab, 0xc2, 0xa6, 0xa8, 0x52, 0x1b, 0x7c, 0xfa, 0x29, 0xac, 0x8e, 
+  0xb0, 0x22, 0x40, 0xb4, 0xc1, 0xa8, 0x9e, 0x80, 0x1a, 0x08, 0xcb, 0x91, 0xa5, 0x05, 0xc2, 0xf2, 
+  0xc9, 0xa3, 0xc1, 0x77, 0x29, 0x2e, 0xb5, 0x59, 0x93, 0xe2, 0x6c, 0x4c, 0xc7, 0x56, 0x0a, 0x67, 
+  0x2d, 0x90, 0xa9, 0xa7, 0xf3, 0x3a, 0xb6, 0x72, 0x18, 0x6c, 0x81, 0x4e, 0x3f, 0x8b, 0xd4, 0x11, 
+  0x56, 0x05, 0xd0, 0xaf, 0x64, 0x57, 0xe3, 0x36, 0x8f, 0xba, 0x58, 0x23, 0x5a, 0xbb, 0x55, 0x61, 
+  0xdd, 0x11, 0x8f, 0x7c, 0x36, 0x23, 0xe8, 0xb7, 0x33, 0x89, 0x44, 0xb3, 0x77, 0x97, 0x71, 0x79, 
+  0x99, 0xbb, 0x44, 0x61, 0xf6, 0xc6, 0xb6, 0x10, 0x0b, 0x3f, 0xe6, 0x16, 0x90, 0x5f, 0x7b, 0x5b, 
+  0xdf, 0x8c, 0x72, 0xb3, 0x07, 0x55, 0x33, 0xf7, 0x8f, 0x3d, 0x1c, 0x26, 0xba, 0xaf, 0x62, 0x56, 
+  0xaa, 0xda, 0xfb, 0xd9, 0x81, 0x9e, 0x5b, 0xe3, 0x3b, 0xbc, 0x2f, 0x72, 0x1c, 0xe2, 0x86, 0x55, 
+  0xc9, 0xa9, 0x19, 0x5b, 0x76, 0xc1, 0xa0, 0xb1, 0x47, 0x07, 0x06, 0x47, 0xb9, 0xef, 0x36, 0xfd, 
+  0xd7, 0xc8, 0x28, 0x1c, 0x74, 0x13, 0xba, 0x88, 0x1f, 0xe8, 0x71, 0x18, 0x42, 0x5f, 0x16, 0x1a, 
+  0x7c, 0xaf, 0x3c, 0x93, 0x33, 0xf2, 0x5f, 0x7a, 0xe5, 0xb9, 0xa0, 0x19, 0x62, 0x85, 0x89, 0x74, 
+  0xb9, 0x4a, 0xe7, 0xb6, 0x48, 0x61, 0xfc, 0x0e, 0xb1, 0x8e, 0xb3, 0x04, 0xc6, 0x5f, 0x2b, 0x04, 
+  0x9c, 0xa8, 0x77, 0x0e, 0xd7, 0x99, 0xd8, 0x20, 0xf2, 0x6f, 0x48, 0x5c, 0xe4, 0x4e, 0xda, 0x7f, 
+  0xa0, 0xb3, 0x46, 0xa8, 0x0c, 0xdd, 0xc9, 0xc6, 0xf4, 0x44, 0xc1, 0xd8, 0x06, 0x30, 0x43, 0x7a, 
+  0x55, 0x93, 0xcf, 0x28, 0xe8, 0x36, 0x83, 0xe4, 0xd4, 0xd5, 0xa6, 0x3e, 0x2a, 0x65, 0x0d, 0x40, 
+  0x19, 0xb2, 0x57, 0xb9, 0x56, 0xd7, 0xe3, 0x6a, 0x80, 0xc9, 0x17, 0x41, 0xd4, 0xb4, 0xea, 0xc5, 
+  0x5f, 0xdf, 0x9f, 0xa1, 0xf8, 0xb9, 0x5d, 0xfa, 0xc4, 0xd1, 0xb5, 0x84, 0xcd, 0x51, 0xb7, 0x4c, 
+  0xb9, 0x38, 0xea, 0x76, 0xb0, 0x05, 0xe3, 0x6d, 0xd2, 0x34, 0x29, 0x83, 0x36, 0xa0, 0xb9, 0xca, 
+  0xb4, 0xc9, 0xec, 0x84, 0xe6, 0xb4, 0x81, 0xcc, 0xd7, 0xbc, 0x55, 0x2e, 0x28, 0x96, 0xbe, 0x15, 
+  0x68, 0x86, 0xf8, 0xd7, 0x96, 0xe9, 0x23, 0x47, 0xdd, 0x0a, 0x58, 0x9e, 0x35, 0x6c, 0xe1, 0xde, 
+  0x9f, 0xb2, 0xb3, 0x38, 0xd1, 0x4f, 0x12, 0xb8, 0x8f, 0x13, 0xe7, 0x0c, 0xf2, 0x94, 0x21, 0x5e, 
+  0x31, 0x5b, 0x3b, 0xf3, 0xc7, 0xf0, 0x20, 0x2e, 0x9d, 0xe7, 0x05, 0xe2, 0xa0, 0x38, 0x73, 0xde, 
+  0xf0, 0x24, 0x56, 0x97, 0x6f, 0x51, 0x20, 0xd8, 0x25, 0x45, 0x85, 0x57, 0xf5, 0xc8, 0xf1, 0xe7, 
+  0xcf, 0xb6, 0xbe, 0x67, 0xac, 0xad, 0x04, 0x57, 0xb9, 0x29, 0x4e, 0xf4, 0x17, 0x6c, 0x4d, 0x33, 
+  0xe6, 0xed, 0x0a, 0x67, 0xe6, 0x0e, 0xe8, 0x5e, 0xed, 0x76, 0xd5, 0xad, 0xdd, 0x99, 0x56, 0x1c, 
+  0xe7, 0xa3, 0x5b, 0xa5, 0xd5, 0x8f, 0x2c, 0x57, 0x33, 0xc1, 0x83, 0x6f, 0x45, 0x49, 0xa7, 0x4a, 
+  0x16, 0xc0, 0xc9, 0x16, 0x1e, 0xb6, 0xd4, 0xe0, 0x82, 0x8c, 0xdd, 0xae, 0xf5, 0xc1, 0xa6, 0xb8, 
+  0x1a, 0xb6, 0xcd, 0x65, 0x79, 0x19, 0xf8, 0x84, 0xc8, 0x22, 0x71, 0xa9, 0xa7, 0x72, 0x9b, 0x0d, 
+  0x82, 0xdf, 0x28, 0x87, 0x12, 0x81, 0x28, 0x0a, 0x59, 0x5c, 0xc8, 0xfc, 0x78, 0x8d, 0x14, 0x2a, 
+  0x82, 0x82, 0xc9, 0xdf, 0x86, 0x4d, 0xbc, 0xc9, 0x59, 0x8e, 0xc3, 0xe0, 0xa9, 0x62, 0xbb, 0xdf, 
+  0xc4, 0x93, 0x42, 0x4e, 0xb1, 0xb0, 0x45, 0x24, 0x69, 0x64, 0x47, 0xcd, 0x06, 0xcc, 0x05, 0xdb, 
+  0x94, 0x49, 0x94, 0x16, 0xab, 0xc0, 0x53, 0xc9, 0x94, 0x91, 0x75, 0x34, 0x2e, 0x95, 0x4a, 0x56, 
+  0xce, 0x58, 0x39, 0xdf, 0x68, 0xe4, 0xaf, 0x1c, 0x73, 0x4c, 0x36, 0x37, 0x25, 0x38, 0x65, 0x3e, 
+  0xcb, 0xf8, 0x0c, 0x76, 0xab, 0x73, 0xa2, 0x26, 0x7e, 0xab, 0xc8, 0x2c, 0xd8, 0x2e, 0x05, 0xb7, 
+  0x66, 0xb6, 0xcb, 0x89, 0x94, 0xc9, 0x76, 0x7d, 0x16, 0x56, 0xc1, 0x75, 0x09, 0x9d, 0xc9, 0x75, 
+  0x65, 0xe2, 0xd6, 0xc8, 0x75, 0x05, 0x95, 0x39, 0xd7, 0xa5, 0xac, 0xad, 0x91, 0xe9, 0x52, 0xa8, 
+  0x96, 0x3c, 0x57, 0xc7, 0x71, 0x19, 0xd9, 0xda, 0x67, 0x91, 0x35, 0x58, 0x6a, 0x23, 0xd9, 0xa6, 
+  0x89, 0xd7, 0xa6, 0x91, 0x54, 0xa5, 0xa8, 0x4d, 0xe2, 0xab, 0xc6, 0x6c, 0x54, 0x4b, 0xdb, 0x0a, 
+  0xcf, 0xdc, 0x8f, 0x94, 0xdc, 0x5b, 0x5d, 0x3e, 0x5c, 0xe1, 0xde, 0x0c, 0x54, 0x06, 0xaf, 0x55, 
+  0x09, 0x74, 0xa3, 0x9b, 0x2b, 0x51, 0x97, 0x73, 0x5a, 0xca, 0xa0, 0x1b, 0x59, 0x2d, 0x6d, 0x91, 
+  0x4c, 0x5e, 0xeb, 0xd3, 0xf5, 0x32, 0xb3, 0x25, 0x64, 0x06, 0xb7, 0x95, 0x09, 0x7e, 0x13, 0xbb, 
+  0x15, 0x14, 0xe6, 0xfc, 0x56, 0x24, 0xf8, 0x8d, 0x1c, 0x57, 0xec, 0xdc, 0x4c, 0x9e, 0x37, 0xd5, 
+  0x14, 0xca, 0x5c, 0x57, 0x20, 0x34, 0xf8, 0xae, 0xa9, 0x43, 0x34, 0x71, 0x5e, 0x49, 0xa9, 0xe4, 
+  0x1d, 0x76, 0x95, 0xbd, 0x22, 0x89, 0xac, 0xb8, 0x9e, 0xd2, 0x6b, 0x77, 0x61, 0xa4, 0xa7, 0x5e, 
+  0xa3, 0xee, 0xe9, 0xef, 0xd5, 0xd1, 0xcb, 0x03, 0xa2, 0x20, 0x10, 0xd1, 0x8f, 0xf2, 0x0e, 0x03, 
+  0xe7, 0x40, 0x6d, 0xd0, 0x8a, 0xb1, 0x76, 0xcf, 0xf5, 0xaf, 0xf5, 0xf1, 0xce, 0x8d, 0x63, 0x6f, 
+  0x60, 0x58, 0x42, 0x19, 0x63, 0x3a, 0x7d, 0x65, 0x0b, 0x28, 0x9a, 0x5e, 0x66, 0xa5, 0x87, 0x23, 
+  0x83, 0x9c, 0xa1, 0xad, 0x6c, 0x76, 0xf1, 0x4d, 0x1d, 0xbc, 0xc8, 0xbe, 0xd6, 0xaa, 0x1f, 0xbf, 
+  0xfa, 0x61, 0xd0, 0xa6, 0x44, 0x1e, 0xd8, 0xe5, 0x42, 0x8a, 0x03, 0x7b, 0x3c, 0xb3, 0x3d, 0x5e, 
+  0x66, 0x95, 0x7c, 0xfe, 0x3a, 0x16, 0x25, 0xd9, 0xac, 0x56, 0xe6, 0xbc, 0xbf, 0x6a, 0xcb, 0x64, 
+  0x94, 0x8b, 0xca, 0xf5, 0x1d, 0xb9, 0xe6, 0x25, 0xc2, 0xdc, 0x0a, 0xa2, 0x36, 0x1b, 0x95, 0x42, 
+  0x47, 0x5f, 0x0a, 0x29, 0x85, 0x71, 0x5f, 0x4f, 0xbf, 0xf2, 0x7c, 0x7e, 0x23, 0x17, 0x38, 0xe3, 
+  0x97, 0x93, 0x47, 0xd9, 0xd8, 0x78, 0x8a, 0x2c, 0xbf, 0x1f, 0x65, 0x1e, 0x65, 0x8c, 0x8a, 0x37, 
+  0x80, 0x79, 0xdc, 0x06, 0xc5, 0x89, 0x47, 0xf4, 0xf9, 0xb3, 0x78, 0x53, 0x58, 0xde, 0xba, 0x2f, 
+  0x5b, 0xc5, 0x7b, 0xbb, 0x64, 0x73, 0xf4, 0x12, 0x3a, 0x78, 0x7e, 0xa4, 0x17, 0x07, 0x38, 0xcb, 
+  0x5b, 0x55, 0x1c, 0x39, 0x39, 0x62, 0x61, 0xf2, 0x19, 0x3e, 0xfe, 0x10, 0x82, 0x16, 0x57, 0x39, 
+  0x1e, 0xb3, 0x24, 0xab, 0x90, 0x4e, 0x5b, 0xa4, 0x30, 0x92, 0x18, 0x14, 0xcc, 0x50, 0x41, 0xae, 
+  0x5e, 0x2e, 0xd7, 0xb2, 0x48, 0x6f, 0xab, 0x5f, 0x23, 0xef, 0x6f, 0x47, 0x18, 0x26, 0x13, 0xb0, 
+  0x68, 0x40, 0x12, 0x6a, 0xe8, 0x19, 0x65, 0xd3, 0xb9, 0x3c, 0xe3, 0x2a, 0xe5, 0xd3, 0x12, 0x46, 
+  0x55, 0xb8, 0x69, 0x1c, 0xdd, 0x05, 0xc9, 0x02, 0xdf, 0x18, 0xc5, 0xfb, 0xf2, 0x5b, 0x4b, 0x47, 
+  0x96, 0x4c, 0x5c, 0x2c, 0x0e, 0x72, 0x6f, 0x3d, 0x06, 0x61, 0x68, 0xdd, 0x52, 0x8b, 0x7b, 0x62, 
+  0xd7, 0x62, 0xfe, 0x07, 0x9a, 0x5a, 0xfe, 0x72, 0x99, 0xc4, 0x1f, 0x83, 0x05, 0xd0, 0x1d, 0x3e, 
+  0x59, 0xfd, 0x5e, 0xda, 0x25, 0x22, 0x3d, 0x33, 0xc8, 0x31, 0x75, 0x98, 0xbf, 0xc2, 0xa8, 0xc6, 
+  0x47, 0x95, 0x86, 0x8a, 0x84, 0xa9, 0x7c, 0x71, 0xeb, 0xb7, 0xe0, 0x2c, 0xd0, 0x2e, 0x6f, 0xb9, 
+  0xfa, 0xe5, 0x71, 0x9f, 0x5f, 0x77, 0xff, 0x25, 0x4e, 0xcb, 0x57, 0xe6, 0xb9, 0xba, 0xd0, 0x21, 
+  0xc9, 0x09, 0xe2, 0xb7, 0xdc, 0x08, 0xde, 0x3f, 0xc3, 0x31, 0xef, 0xe2, 0xd2, 0x21, 0x7f, 0x94, 
+  0xf7, 0x25, 0x31, 0x8b, 0xa7, 0xb1, 0x59, 0x19, 0x64, 0x59, 0x7f, 0x7e, 0xc7, 0x7f, 0x83, 0xeb, 
+  0x13, 0x81, 0x83, 0xec, 0xee, 0x92, 0x4e, 0x41, 0x64, 0x71, 0x79, 0xf3, 0x39, 0x8f, 0x1c, 0x39, 
+  0x25, 0x3c, 0xe3, 0xa5, 0x1d, 0x0f, 0xef, 0xad, 0xaa, 0xad, 0xe0, 0x77, 0xf9, 0x15, 0xd3, 0xc7, 
+  0xf4, 0x0b, 0xe6, 0x7c, 0x4c, 0x87, 0x35, 0xd3, 0x92, 0x39, 0x63, 0xcb, 0x74, 0x48, 0xbc, 0x7c, 
+  0x6e, 0xc9, 0xa9, 0x98, 0x1f, 0x87, 0x96, 0xc7, 0x3a, 0x6e, 0x7b, 0x62, 0xa1, 0x71, 0xf7, 0x31, 
+  0x25, 0x9c, 0x66, 0xa1, 0x54, 0xfc, 0x3e, 0xdb, 0x09, 0xff, 0x5a, 0x2c, 0xa4, 0x2e, 0x46, 0x7e, 
+  0x33, 0x54, 0xde, 0x82, 0x03, 0x60, 0xa1, 0xf9, 0x9b, 0x80, 0xf9, 0x83, 0x0c, 0x08, 0xaa, 0x3f, 
+  0x8e, 0x51, 0x81, 0x15, 0x1c, 0x29, 0x07, 0x44, 0x3d, 0x1a, 0xc3, 0x8f, 0x4d, 0xc0, 0x8f, 0xc1, 
+  0x5d, 0x90, 0x03, 0x6f, 0xa6, 0x38, 0xe7, 0x2e, 0xa7, 0x5c, 0x4e, 0x86, 0x78, 0xca, 0x37, 0x04, 
+  0xb5, 0x1b, 0x88, 0x25, 0x4c, 0x02, 0x01, 0x8e, 0x0c, 0xa2, 0x80, 0x05, 0x10, 0x53, 0xd3, 0xca, 
+  0x62, 0x99, 0x9f, 0xfb, 0x86, 0xca, 0x4e, 0x9c, 0xfe, 0xfd, 0x26, 0x80, 0xdb, 0x34, 0x0d, 0xaa, 
+  0x9e, 0x38, 0x91, 0x3d, 0x35, 0x25, 0x2b, 0xfd, 0xc4, 0x57, 0x4c, 0x83, 0xf6, 0xbb, 0x0a, 0x59, 
+  0x0a, 0xd6, 0x5d, 0x3e, 0xf3, 0x35, 0x41, 0xe4, 0xa9, 0x2f, 0xc5, 0x97, 0xe5, 0x88, 0x99, 0xf2, 
+  0xfb, 0xce, 0x16, 0xdf, 0x43, 0x65, 0xb2, 0xec, 0xf2, 0x3e, 0xd6, 0x95, 0x20, 0xe2, 0x2a, 0x7a, 
+  0x3a, 0x8f, 0x1f, 0xdf, 0xfe, 0x8b, 0xb1, 0xd7, 0xd1, 0x5d, 0x5c, 0xcd, 0x36, 0x00, 0x8c, 0xe3, 
+  0xd0, 0x4f, 0x5e, 0xf1, 0x2b, 0xa1, 0xf5, 0x30, 0xfe, 0x1d, 0xad, 0x2c, 0xcb, 0xfb, 0x5d, 0x16, 
+  0xdf, 0xdf, 0x87, 0xfa, 0x8e, 0x0b, 0xba, 0xc4, 0x33, 0x0a, 0x7e, 0xd7, 0x9f, 0x3d, 0x60, 0x34, 
+  0x9e, 0xe1, 0xea, 0x55, 0x0e, 0x57, 0x01, 0x6a, 0x6f, 0x5a, 0x83, 0x2f, 0x3c, 0x89, 0xe3, 0x0f, 
+  0x01, 0x88, 0x5c, 0x85, 0xc7, 0x97, 0xa9, 0xb1, 0x78, 0xcc, 0x12, 0x7e, 0xcd, 0x56, 0x5e, 0x27, 
+  0xc7, 0x12, 0x18, 0x28, 0x51, 0x52, 0x3b, 0xa3, 0x06, 0xd1, 0x66, 0x4a, 0x6d, 0x80, 0x31, 0xa7, 
+  0x4b, 0xf1, 0x76, 0xaf, 0x4a, 0x14, 0xdf, 0x19, 0x65, 0x4f, 0xa3, 0xe1, 0x45, 0x66, 0x79, 0x9f, 
+  0xd9, 0x0d, 0x3c, 0x22, 0x94, 0x95, 0x8c, 0xb8, 0x7f, 0x7d, 0x0c, 0xa2, 0x59, 0xfc, 0xc8, 0x1d, 
+  0x2b, 0x4e, 0x8b, 0x97, 0xa3, 0x61, 0x63, 0x6c, 0x07, 0x95, 0x1d, 0x9c, 0x4e, 0x96, 0xf0, 0x77, 
+  0x31, 0x82, 0xcc, 0xfd, 0x5b, 0x83, 0xb5, 0x40, 0x36, 0xd7, 0xf0, 0x53, 0x85, 0xd2, 0x23, 0x7f, 
+  0x24, 0x1d, 0xe1, 0x20, 0x83, 0x74, 0xfc, 0x94, 0x42, 0x02, 0xd8, 0xbc, 0x1b, 0x25, 0x29, 0x07, 
+  0x14, 0x3e, 0x10, 0xe6, 0xb3, 0x9d, 0x0c, 0x81, 0xa8, 0x40, 0xa6, 0x6d, 0x50, 0x48, 0xd0, 0x0a, 
+  0x24, 0xf9, 0xc9, 0x46, 0x13, 0x0a, 0x21, 0xc8, 0x12, 0x02, 0x74, 0x69, 0x2d, 0x86, 0xa3, 0x0b, 
+  0x34, 0x07, 0xaf, 0x96, 0xf7, 0x89, 0x3f, 0xa3, 0xef, 0x13, 0x33, 0x70, 0x11, 0xff, 0x36, 0x5e, 
+  0xb1, 0xe1, 0x6d, 0xe8, 0x47, 0x1f, 0x88, 0xb8, 0x72, 0x0e, 0x70, 0xb3, 0x9a, 0x83, 0x4a, 0xa0, 
+  0x02, 0xe4, 0x93, 0xbe, 0xe1, 0x30, 0x2d, 0x76, 0xf7, 0x1a, 0x3a, 0x48, 0x32, 0x0a, 0x0f, 0xa8, 
+  0xa7, 0x1a, 0xeb, 0x1c, 0x75, 0xd5, 0x11, 0xe8, 0xa0, 0x3c, 0x8e, 0x83, 0xd9, 0x8e, 0x0c, 0x0f, 
+  0xfa, 0xa6, 0xa6, 0x70, 0x86, 0xd9, 0xa3, 0x05, 0x62, 0x7f, 0x25, 0x6f, 0x8b, 0x6b, 0x90, 0x2a, 
+  0x79, 0x26, 0xb1, 0xfd, 0x22, 0x52, 0x7d, 0xdd, 0xd8, 0x22, 0x4e, 0x76, 0x69, 0x34, 0x4b, 0x7f, 
+  0x0b, 0xd8, 0xdc, 0x26, 0xd9, 0x5e, 0x03, 0x36, 0xaf, 0x84, 0x87, 0x4e, 0x49, 0x5d, 0xb0, 0xf4, 
+  0x67, 0x33, 0xdc, 0x59, 0xf2, 0x10, 0x4a, 0xc4, 0x02, 0xca, 0xd9, 0x1f, 0x1f, 0x1f, 0x27, 0x2b, 
+  0x10, 0x07, 0x1e, 0x7c, 0xda, 0xf8, 0xda, 0x93, 0x1c, 0x73, 0xd5, 0x70, 0x67, 0x68, 0x1a, 0x44, 
+  0x42, 0x97, 0xa1, 0x3f, 0x85, 0xc5, 0xc6, 0x18, 0x2f, 0x83, 0x78, 0x79, 0x5c, 0xa7, 0x14, 0xb4, 
+  0xd5, 0x90, 0x55, 0x29, 0x02, 0x25, 0x2a, 0x89, 0x3d, 0x9e, 0xa7, 0x94, 0xa5, 0xe4, 0x3a, 0x50, 
+  0xf7, 0x00, 0x93, 0x74, 0x55, 0x07, 0x8d, 0x40, 0xc7, 0xef, 0xd0, 0x0b, 0x58, 0x52, 0x1c, 0x16, 
+  0x53, 0x6f, 0x16, 0x4f, 0x79, 0xc2, 0x8c, 0x8f, 0x26, 0x9c, 0x86, 0x94, 0xe7, 0xce, 0x7f, 0x7e, 
+  0xba, 0xf2, 0xef, 0xcf, 0x51, 0x0e, 0x24, 0x58, 0xdc, 0xe3, 0xc3, 0x8f, 0x3c, 0xf8, 0x50, 0x35, 
+  0xda, 0x50, 0x88, 0x2b, 0x38, 0xe6, 0x98, 0x81, 0x23, 0x83, 0x7d, 0x3a, 0x7a, 0x39, 0x9f, 0xf9, 
+  0x3b, 0x69, 0x32, 0x45, 0xb9, 0xf3, 0xee, 0x54, 0xeb, 0xc6, 0x1e, 0x77, 0xe3, 0x30, 0x67, 0xa4, 
+  0xaa, 0x95, 0x2c, 0x0e, 0xf0, 0x05, 0xc2, 0x7b, 0x7f, 0x52, 0x83, 0x35, 0x4f, 0x49, 0x58, 0xb2, 
+  0xa2, 0x62, 0x19, 0xef, 0xeb, 0x3c, 0x3c, 0xb9, 0xf3, 0x43, 0xfe, 0x1e, 0x58, 0xd3, 0x73, 0xd7, 
+  0x8c, 0x36, 0x9c, 0x75, 0x3e, 0x5c, 0xdc, 0x86, 0x4a, 0xbd, 0xad, 0x5c, 0xe8, 0x35, 0x06, 0x01, 
+  0x09, 0x94, 0x6d, 0xd8, 0x87, 0x7c, 0x58, 0x25, 0xc9, 0x1e, 0x56, 0xc9, 0x96, 0x2f, 0xe1, 0x2f, 
+  0xf2, 0x95, 0xcf, 0xaa, 0xd4, 0x9a, 0x50, 0xc3, 0x8a, 0xab, 0x02, 0xc3, 0xc0, 0x21, 0xcd, 0x15, 
+  0xf7, 0x5b, 0x3a, 0x85, 0xea, 0x16, 0x85, 0x53, 0x09, 0xcc, 0xf4, 0x8c, 0xad, 0x8b, 0x4a, 0x6e, 
+  0x6c, 0x92, 0xab, 0x3d, 0x5a, 0xc3, 0xb7, 0x19, 0x65, 0x62, 0x53, 0x18, 0x14, 0xeb, 0x04, 0xe7, 
+  0xe4, 0xb8, 0x7b, 0xf8, 0x6c, 0x59, 0x69, 0x46, 0x41, 0x38, 0x97, 0x40, 0xbc, 0x34, 0xc9, 0x06, 
+  0x1a, 0xfb, 0x6e, 0x99, 0xf6, 0x66, 0x12, 0xd7, 0x72, 0x4f, 0x29, 0xaf, 0x8d, 0xd6, 0xee, 0xdb, 
+  0x84, 0xd4, 0x17, 0xf5, 0xa1, 0x9c, 0x8c, 0xaf, 0x8e, 0x3b, 0xc7, 0xef, 0xb2, 0x74, 0x18, 0x7e, 
+  0xf1, 0xaf, 0x9f, 0x3f, 0x9b, 0xf8, 0x39, 0xc6, 0x0c, 0xda, 0xe3, 0x20, 0x44, 0x7e, 0x3b, 0x52, 
+  0xa4, 0x60, 0x3b, 0xc3, 0x82, 0x55, 0xa9, 0xd5, 0x98, 0xf2, 0x9d, 0x53, 0xf6, 0x18, 0x27, 0x1f, 
+  0x36, 0xe4, 0x97, 0x1a, 0xdc, 0x78, 0x35, 0x85, 0x10, 0x98, 0x36, 0x81, 0xa9, 0xb2, 0xd4, 0x3d, 
+  0x9e, 0xd8, 0xe8, 0x1d, 0xf9, 0x21, 0xec, 0xdb, 0x6c, 0xf2, 0x0e, 0xa4, 0x88, 0xaf, 0xba, 0xe7, 
+  0xa7, 0x3a, 0x56, 0x24, 0x06, 0xe3, 0xbb, 0x13, 0x2b, 0x89, 0xcb, 0xbc, 0x7e, 0x89, 0x1c, 0x4e, 
+  0xc0, 0x0f, 0xdd, 0xa5, 0x70, 0x9c, 0x25, 0x0f, 0x84, 0x03, 0x32, 0xdc, 0xee, 0x27, 0xa4, 0x60, 
+  0x68, 0xd0, 0xe3, 0x2e, 0x7d, 0x48, 0x82, 0xf2, 0x46, 0xfc, 0x65, 0xdc, 0xdc, 0xab, 0x9e, 0xb6, 
+  0xe7, 0xb8, 0xe5, 0xf5, 0xe8, 0x55, 0xbd, 0xd5, 0x59, 0x32, 0x5c, 0xbc, 0x29, 0x19, 0xd1, 0xf1, 
+  0xac, 0x43, 0x26, 0xe2, 0xa4, 0xba, 0xa4, 0x53, 0x23, 0x88, 0x42, 0x7b, 0xa1, 0xf7, 0x78, 0xb6, 
+  0x08, 0xa2, 0xc6, 0x15, 0xe4, 0x50, 0x4d, 0xeb, 0xc7, 0x81, 0xbc, 0xd2, 0xfc, 0xda, 0x0c, 0xca, 
+  0x32, 0xa8, 0x38, 0x5b, 0x2c, 0x82, 0x3f, 0xe3, 0x8f, 0xff, 0x7c, 0xc2, 0x90, 0x37, 0xac, 0x09, 
+  0x82, 0xc6, 0x52, 0x60, 0x27, 0xb6, 0x00, 0xfb, 0xb3, 0xca, 0x25, 0xd1, 0x49, 0xf8, 0x02, 0xd9, 
+  0xf3, 0x81, 0x6d, 0x84, 0x6f, 0x30, 0x2f, 0xca, 0x69, 0xa2, 0xeb, 0x74, 0x11, 0x47, 0x27, 0x8b, 
+  0xb4, 0x51, 0xf6, 0x12, 0xae, 0x49, 0xfa, 0x12, 0xac, 0x5c, 0x8b, 0xfe, 0x24, 0x5f, 0x8b, 0x9f, 
+  0x8b, 0x85, 0x02, 0xe4, 0x74, 0x91, 0x4e, 0x68, 0x56, 0x3f, 0xc3, 0x97, 0x57, 0x3f, 0xa8, 0x52, 
+  0xcd, 0x20, 0x44, 0x3b, 0x00, 0xc0, 0xe6, 0xf1, 0x03, 0x7d, 0x2a, 0x03, 0x88, 0x76, 0x7c, 0x2a, 
+  0x17, 0xbc, 0x51, 0xb9, 0x1b, 0x5b, 0xa1, 0xf3, 0x0e, 0xd8, 0xa3, 0xc9, 0x12, 0xf2, 0x07, 0x56, 
+  0x86, 0x51, 0x3a, 0x61, 0x8d, 0x46, 0x5b, 0xb4, 0x2b, 0xe8, 0x02, 0x57, 0xc4, 0xbd, 0x56, 0x57, 
+  0x10, 0x21, 0x77, 0x46, 0xb4, 0x8b, 0x38, 0x8f, 0x32, 0xa0, 0xed, 0xed, 0xbd, 0x01, 0x6f, 0x15, 
+  0x84, 0xe4, 0xb5, 0x76, 0x32, 0x99, 0x4c, 0x5e, 0xbd, 0x7f, 0xfb, 0xf6, 0x6f, 0x93, 0x77, 0xc7, 
+  0xe3, 0xf1, 0x6f, 0x17, 0x97, 0xaf, 0xa0, 0x81, 0x28, 0x90, 0x86, 0x13, 0xa1, 0xf8, 0xd4, 0xa4, 
+  0xf5, 0x80, 0xe5, 0x69, 0xeb, 0x54, 0x10, 0x66, 0x09, 0x40, 0x7c, 0x79, 0x7d, 0x3e, 0x99, 0x24, 
+  0x41, 0x21, 0x79, 0x7b, 0xfb, 0xe0, 0x85, 0xd9, 0x96, 0x15, 0xc8, 0xeb, 0xa7, 0x18, 0x8f, 0xdf, 
+  0x58, 0xe3, 0x5f, 0x8e, 0x77, 0xfa, 0x96, 0x32, 0xac, 0x70, 0x5d, 0x86, 0x66, 0x28, 0x36, 0xa3, 
+  0xeb, 0x42, 0x0b, 0xab, 0x91, 0x52, 0xc6, 0xb7, 0x8b, 0x94, 0x74, 0xd3, 0x44, 0xf6, 0x2d, 0xf4, 
+  0xbf, 0xc4, 0x0a, 0x77, 0x3e, 0xc3, 0x2a, 0xd1, 0x64, 0x72, 0x17, 0xeb, 0x6d, 0xf9, 0x11, 0xbe, 
+  0x45, 0x04, 0x36, 0x34, 0xb9, 0xc1, 0x60, 0x5a, 0xdf, 0x68, 0x2d, 0x08, 0xd4, 0x64, 0x2a, 0x08, 
+  0xd3, 0xc2, 0x4e, 0x16, 0x00, 0xb6, 0xc1, 0x48, 0x78, 0x77, 0x6e, 0x21, 0x10, 0x1d, 0x83, 0xa9, 
+  0xd1, 0xc9, 0xdb, 0xa0, 0x4f, 0x77, 0x59, 0xbc, 0x0b, 0x9b, 0x4a, 0xfe, 0x8a, 0xf7, 0x88, 0xf8, 
+  0xe1, 0xa6, 0x58, 0xa2, 0x30, 0x27, 0xc3, 0x36, 0x1b, 0xdf, 0x67, 0x1f, 0xcc, 0x26, 0x81, 0x49, 
+  0xa9, 0x6c, 0x45, 0x23, 0x52, 0x35, 0xd6, 0x2b, 0x6c, 0xa8, 0x52, 0x23, 0xdf, 0xfe, 0xd7, 0xd5, 
+  0x95, 0x94, 0x79, 0xa1, 0x81, 0xaa, 0xa8, 0x15, 0xf5, 0x53, 0x84, 0xdb, 0x42, 0xf7, 0x90, 0xaa, 
+  0x4a, 0xc5, 0xd3, 0xd0, 0x7c, 0x81, 0xd6, 0x71, 0x52, 0x5b, 0x28, 0x9d, 0x4e, 0xbd, 0x16, 0xee, 
+  0x2e, 0xe6, 0x8b, 0xbf, 0xd0, 0xa7, 0x46, 0x2d, 0x12, 0x60, 0x4d, 0x7a, 0x24, 0xa0, 0xca, 0x11, 
+  0x4f, 0x9f, 0x44, 0x91, 0x9f, 0x86, 0xb6, 0x85, 0x04, 0xe3, 0xf9, 0x02, 0x5d, 0x90, 0x5b, 0x52, 
+  0x4d, 0xe8, 0x50, 0x34, 0x13, 0x7e, 0x69, 0x5d, 0xdc, 0x25, 0x57, 0x84, 0x3b, 0x63, 0xfa, 0x2f, 
+  0x90, 0x3c, 0x8c, 0xb4, 0x00, 0x6b, 0x1b, 0xe1, 0x9b, 0xcc, 0x67, 0x21, 0x0f, 0x53, 0xff, 0x8b, 
+  0xbb, 0xbb, 0x63, 0x3e, 0xf9, 0x3b, 0x64, 0x73, 0xe3, 0x2a, 0x94, 0xc1, 0x37, 0xad, 0x46, 0x19, 
+  0x5a, 0x5f, 0x95, 0xfa, 0xc9, 0xe5, 0xea, 0xd4, 0x4e, 0xd7, 0xb0, 0x4a, 0xfe, 0x92, 0xff, 0x49, 
+  0x9b, 0x4f, 0x6b, 0xed, 0x95, 0x38, 0x20, 0x26, 0xb0, 0x55, 0x3c, 0x41, 0xb8, 0xc7, 0x4b, 0xd3, 
+  0xb5, 0x39, 0xfd, 0x51, 0xf5, 0x7d, 0x0d, 0x23, 0x53, 0xf7, 0x36, 0x67, 0xe8, 0x9b, 0xa9, 0xc7, 
+  0x33, 0x4b, 0x4c, 0x62, 0x86, 0x4d, 0x50, 0x2d, 0x54, 0x81, 0x57, 0x6f, 0x80, 0x5f, 0x4b, 0xa0, 
+  0xb0, 0x38, 0x8e, 0x5a, 0x65, 0xd8, 0x24, 0xf3, 0x4c, 0x29, 0xa6, 0x73, 0xbc, 0x78, 0x2e, 0x2a, 
+  0xb1, 0x98, 0xbd, 0x6e, 0x54, 0x09, 0x13, 0x78, 0x93, 0x42, 0x98, 0xb0, 0x9e, 0x51, 0xea, 0x54, 
+  0xdf, 0x18, 0xb0, 0xe0, 0xbb, 0x14, 0x91, 0x2c, 0xd9, 0x55, 0x7d, 0xd4, 0xd9, 0x40, 0xaa, 0x54, 
+  0xa0, 0x1a, 0xe2, 0x1a, 0xd4, 0xa7, 0x98, 0x04, 0x74, 0xa8, 0xf8, 0x31, 0xa4, 0x86, 0xf5, 0xd6, 
+  0x62, 0x6f, 0x69, 0xc3, 0x94, 0x59, 0x02, 0xbb, 0xb5, 0x10, 0x21, 0xb5, 0x7a, 0xc9, 0xea, 0x79, 
+  0xcc, 0x9d, 0x68, 0x90, 0x9e, 0x4e, 0x63, 0xec, 0x3b, 0x7e, 0x00, 0xf4, 0x28, 0xf1, 0x56, 0x15, 
+  0xbf, 0xca, 0x90, 0xca, 0x4b, 0x5a, 0x5b, 0x4a, 0x82, 0xa7, 0x46, 0x39, 0xb9, 0xff, 0xab, 0x89, 
+  0x71, 0x22, 0x09, 0xa5, 0x82, 0x94, 0xe6, 0xd7, 0xf8, 0x64, 0x8f, 0xde, 0x79, 0x8a, 0x1d, 0xaa, 
+  0x8b, 0x5f, 0xfd, 0x6e, 0x21, 0x53, 0x1c, 0x36, 0x3d, 0x1a, 0x0c, 0xfb, 0xf2, 0xa0, 0x61, 0x0e, 
+  0xbe, 0x8e, 0x9f, 0x23, 0xb4, 0x28, 0xbe, 0xd6, 0x32, 0x99, 0x63, 0xfa, 0x19, 0x18, 0x7b, 0x4d, 
+  0xbf, 0x0a, 0x55, 0x11, 0xf7, 0x11, 0xd9, 0x9d, 0x3f, 0x65, 0x71, 0xf2, 0x74, 0x89, 0x87, 0xa9, 
+  0x1b, 0xad, 0x49, 0x05, 0xdc, 0x64, 0x49, 0x2a, 0x5c, 0xe5, 0x29, 0xf1, 0xc9, 0xf1, 0xfb, 0xab, 
+  0xd7, 0x17, 0xe7, 0x43, 0xeb, 0x55, 0x6c, 0x3d, 0xc5, 0x2b, 0x0b, 0x64, 0x1f, 0x86, 0x4f, 0xd6, 
+  0xa3, 0x1f, 0x31, 0xd4, 0xbd, 0x33, 0x31, 0xde, 0xe2, 0x08, 0x8e, 0xac, 0xe3, 0x30, 0xb4, 0xe4, 
+  0x2b, 0xc9, 0xf9, 0x16, 0xcf, 0x38, 0x49, 0x0e, 0xc1, 0x50, 0xc4, 0x79, 0x71, 0x35, 0x2b, 0xd2, 
+  0xda, 0x2a, 0x88, 0x6f, 0xb0, 0x34, 0x7e, 0xba, 0xac, 0x3b, 0x6a, 0x5c, 0xe2, 0x4a, 0x44, 0xed, 
+  0x8c, 0x4a, 0x63, 0xac, 0xd6, 0xa4, 0xaa, 0x99, 0xc8, 0xcd, 0xa9, 0xf9, 0x88, 0x3e, 0x87, 0xd9, 
+  0xb4, 0x48, 0x5f, 0x72, 0x8a, 0xcf, 0x0b, 0x07, 0xbf, 0xeb, 0x28, 0xdf, 0xaf, 0x3c, 0xca, 0x37, 
+  0x09, 0x6d, 0x5e, 0x10, 0x04, 0x2e, 0x2f, 0x89, 0x89, 0xa5, 0xdd, 0x6a, 0x64, 0xe8, 0xea, 0xd6, 
+  0xa1, 0xe6, 0x06, 0x01, 0x50, 0x8d, 0x8f, 0xff, 0x66, 0x6f, 0xcd, 0x11, 0xa5, 0xbb, 0x84, 0xca, 
+  0x0a, 0xae, 0xde, 0x9c, 0xc6, 0xd3, 0x0f, 0x60, 0x03, 0xfc, 0xbb, 0x04, 0x30, 0xf6, 0x7e, 0x02, 
+  0x80, 0x1f, 0x09, 0xd3, 0xdb, 0x31, 0xff, 0x65, 0xab, 0x67, 0xf1, 0xf2, 0x6c, 0x82, 0x77, 0x74, 
+  0xe3, 0x08, 0xab, 0xe8, 0xde, 0x86, 0x7d, 0x83, 0x41, 0x5b, 0xed, 0xdb, 0x7d, 0x24, 0x42, 0x7c, 
+  0xdf, 0x9f, 0xfd, 0xe3, 0x27, 0xc2, 0xff, 0x14, 0xdf, 0xb0, 0xbf, 0xfe, 0x31, 0x7b, 0xbf, 0x8d, 
+  0x3a, 0xe7, 0x14, 0x2c, 0x8c, 0x6e, 0x9e, 0x34, 0x67, 0xdf, 0xd6, 0x87, 0x66, 0x7f, 0xe1, 0x71, 
+  0xc3, 0x60, 0xd0, 0xcd, 0x05, 0x28, 0x0d, 0x10, 0xd0, 0xbd, 0x4b, 0xe2, 0xc5, 0x7f, 0x8e, 0x2f, 
+  0xce, 0xf1, 0x45, 0xbf, 0x3e, 0xf3, 0x8b, 0x73, 0x6b, 0x0d, 0x67, 0xf9, 0x4f, 0x33, 0x96, 0xc8, 
+  0x91, 0xb0, 0x9c, 0x70, 0xdb, 0xa4, 0x6f, 0xad, 0xfe, 0x56, 0x57, 0x83, 0xbf, 0x6c, 0x53, 0x17, 
+  0x60, 0xe9, 0xc5, 0x4b, 0x7a, 0xb7, 0x53, 0xd6, 0x05, 0xfc, 0x6b, 0x46, 0x3c, 0x64, 0x94, 0x34, 
+  0x42, 0x5a, 0x81, 0xa9, 0x27, 0xd5, 0xfb, 0xb9, 0x5a, 0x8d, 0x52, 0xe4, 0x7c, 0xd0, 0xeb, 0xc9, 
+  0x2c, 0x25, 0x2b, 0xec, 0x1b, 0x8f, 0xaa, 0x88, 0xc3, 0xf2, 0xaf, 0x7c, 0x0d, 0xa9, 0xeb, 0x7b, 
+  0x84, 0xe4, 0xef, 0x22, 0x65, 0xd9, 0x1b, 0x8d, 0xb2, 0x17, 0x24, 0x8d, 0x92, 0xec, 0x4d, 0x5b, 
+  0x76, 0xa2, 0xbc, 0xf2, 0x69, 0xb0, 0xff, 0x13, 0xfb, 0xe9, 0xb0, 0x87, 0xff, 0xfa, 0xbc, 0x76, 
+  0xef, 0x91, 0x11, 0xfd, 0xb8, 0x0c, 0xc0, 0x96, 0x3c, 0xd2, 0x49, 0xba, 0x2c, 0x7e, 0x7f, 0x75, 
+  0x92, 0x9d, 0x0b, 0xaf, 0xf3, 0x83, 0x99, 0xa9, 0x20, 0x9f, 0x76, 0x08, 0x40, 0x45, 0x1d, 0xbf, 
+  0x43, 0x46, 0x4b, 0x9f, 0xcd, 0xbd, 0x5d, 0x82, 0xfc, 0xdd, 0x57, 0xf0, 0xa7, 0xde, 0x1a, 0xf8, 
+  0xea, 0x3f, 0x49, 0xea, 0x32, 0x31, 0x25, 0x90, 0x69, 0x90, 0x92, 0xbd, 0x26, 0x6f, 0x84, 0xef, 
+  0xd9, 0xf0, 0x7a, 0xa3, 0x24, 0xbf, 0xc4, 0x38, 0x4a, 0xf0, 0x1e, 0x42, 0x36, 0x79, 0xec, 0xf9, 
+  0xd7, 0xc9, 0xcd, 0x88, 0x58, 0x98, 0x34, 0xc7, 0xfc, 0xb1, 0x83, 0x63, 0xbc, 0x79, 0x39, 0x72, 
+  0x62, 0xf8, 0x29, 0x8e, 0xa3, 0x91, 0xd7, 0x3e, 0xff, 0x23, 0x5e, 0x3d, 0x0e, 0x94, 0xbd, 0x60, 
+  0x80, 0xe5, 0x77, 0x14, 0x54, 0xc8, 0xac, 0x16, 0xe4, 0xc6, 0xd9, 0x03, 0x9b, 0xeb, 0xec, 0x2d, 
+  0xb9, 0xca, 0xe5, 0xa5, 0x74, 0x0a, 0xee, 0x4c, 0xca, 0x31, 0x7b, 0xbe, 0x54, 0xbc, 0xd6, 0xb2, 
+  0x78, 0x2f, 0xab, 0xb3, 0x1b, 0x39, 0x20, 0xf0, 0xb3, 0xe0, 0x23, 0x6c, 0x0b, 0x98, 0x53, 0x0c, 
+  0x06, 0xe2, 0xc1, 0x3f, 0xe7, 0xd7, 0x30, 0x3f, 0xf1, 0x45, 0xf6, 0x8a, 0x3f, 0xcb, 0x40, 0xce, 
+  0x77, 0x8f, 0xc5, 0x4b, 0xf5, 0x22, 0x0f, 0x5f, 0x7a, 0x87, 0x62, 0xda, 0xdd, 0x3b, 0xec, 0xf5, 
+  0x40, 0x4e, 0x6c, 0x77, 0xb0, 0x0f, 0x12, 0xa1, 0x39, 0x62, 0x7c, 0x25, 0x5e, 0x4a, 0xb2, 0x3b, 
+  0x47, 0x3d, 0x5e, 0x3b, 0x28, 0xfa, 0x8e, 0x12, 0x8f, 0x44, 0xf1, 0x23, 0x19, 0x3e, 0x7b, 0xe9, 
+  0xe3, 0xf7, 0x20, 0x82, 0xe0, 0x06, 0xbb, 0x23, 0x32, 0x1c, 0xf0, 0x06, 0x3f, 0x87, 0xc5, 0x17, 
+  0x38, 0x5a, 0x33, 0x70, 0xc2, 0xd8, 0xc5, 0xa0, 0x8b, 0x69, 0x53, 0x58, 0xf3, 0x04, 0x7a, 0xfa, 
+  0xcf, 0x7b, 0x2f, 0x71, 0xcb, 0x0d, 0x7a, 0xa8, 0xf7, 0x2e, 0x82, 0x28, 0xc5, 0xa5, 0x2a, 0x98, 
+  0x94, 0xe7, 0xc2, 0x21, 0xd6, 0x46, 0xaa, 0x78, 0xcc, 0x18, 0x24, 0x02, 0xf0, 0xcf, 0xfe, 0x2c, 
+  0x63, 0x22, 0x7b, 0x23, 0xa0, 0x7f, 0x8b, 0x23, 0x9d, 0x97, 0x83, 0x83, 0xa3, 0x1c, 0xec, 0xe7, 
+  0x38, 0x9e, 0x91, 0x21, 0x7d, 0x79, 0xd8, 0x2b, 0xda, 0xc6, 0xf8, 0xb7, 0x48, 0xa1, 0xed, 0xd9, 
+  0xa0, 0xd7, 0x03, 0xda, 0xb4, 0x76, 0xac, 0x90, 0xb8, 0xd1, 0x7a, 0xcb, 0x28, 0x1d, 0x45, 0xe5, 
+  0xeb, 0x0b, 0x10, 0xf3, 0xb0, 0x22, 0x0d, 0xb2, 0x36, 0xbb, 0xf0, 0xc9, 0x63, 0x90, 0x7c, 0xa9, 
+  0x59, 0xde, 0xab, 0x1a, 0xfd, 0x50, 0xbe, 0x9f, 0xa5, 0x5e, 0x0b, 0xd2, 0xef, 0xb7, 0x81, 0xaa, 
+  0xb8, 0xbe, 0x33, 0x02, 0xaf, 0x0b, 0x4e, 0x37, 0x7c, 0xfa, 0x33, 0x20, 0xc5, 0x3f, 0xf5, 0x82, 
+  0x7e, 0x93, 0x8a, 0xe3, 0x1b, 0xfe, 0xde, 0x5a, 0xdb, 0x19, 0xfd, 0x61, 0x77, 0xf7, 0x8f, 0x56, 
+  0x1a, 0xaf, 0x92, 0x29, 0x7d, 0x2b, 0x1c, 0xf4, 0xfb, 0xcb, 0x37, 0xde, 0x3c, 0x5e, 0xd0, 0xee, 
+  0x3f, 0xf1, 0xef, 0x84, 0x2d, 0xff, 0xf0, 0xdf, 0x42, 0x34, 0x7e, 0xc5, 0x38, 0x78, 0x00, 0x00, 
+  0x00 };
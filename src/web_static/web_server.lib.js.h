@@ -1,3 +1,3484 @@
-static const char CONTENT_LIB_JS[] PROGMEM = 
+static const char CONTENT_LIB_JS[] PROGMEM __attribute__((aligned(4))) = 
   "\"use strict\";function _typeof(e){return(_typeof=\"function\"==typeof Symbol&&\"symbol\"==typeof Symbol.iterator?function(e){return typeof e}:function(e){return e&&\"function\"==typeof Symbol&&e.constructor===Symbol&&e!==Symbol.prototype?\"symbol\":typeof e})(e)}function BaseViewModel(e,t){var n=2<arguments.length&&void 0!==arguments[2]?arguments[2]:{};this.remoteUrl=t,ko.mapping.fromJS(e,n,this),this.fetching=ko.observable(!1)}function ConfigViewModel(e){var t=ko.pureComputed(function(){return e()+\"/config\"});BaseViewModel.call(this,{ssid:\"\",pass:\"\",emoncms_server:\"data.openevse.com/emoncms\",emoncms_apikey:\"\",emoncms_node:\"\",emoncms_fingerprint:\"\",emoncms_enabled:0,mqtt_server:\"\",mqtt_topic:\"\",mqtt_user:\"\",mqtt_pass:\"\",mqtt_solar:\"\",mqtt_grid_ie:\"\",mqtt_enabled:0,ohm_enabled:0,ohmkey:\"\",www_username:\"\",www_password:\"\",firmware:\"-\",protocol:\"-\",espflash:0,diodet:0,gfcit:0,groundt:0,relayt:0,ventt:0,tempt:0,scale:1,offset:0,version:\"0.0.0\"},t)}function StatusViewModel(e){var t=this,n=ko.pureComputed(function(){return e()+\"/status\"});BaseViewModel.call(t,{mode:\"ERR\",wifi_client_connected:0,srssi:\"\",ipaddress:\"\",packets_sent:0,packets_success:0,emoncms_connected:0,mqtt_connected:0,ohm_hour:\"\",free_heap:0,comm_sent:0,comm_success:0,amp:0,pilot:0,temp1:0,temp2:0,temp3:0,state:0,elapsed:0,wattsec:0,watthour:0,gfcicount:0,nogndcount:0,stuckcount:0,divertmode:1,solar:0,grid_ie:0,charge_rate:0,divert_update:0},n),t.isWiFiError=ko.pureComputed(function(){return\"ERR\"===t.mode()}),t.isWifiClient=ko.pureComputed(function(){return\"STA\"===t.mode()||\"STA+AP\"===t.mode()}),t.isWifiAccessPoint=ko.pureComputed(function(){return\"AP\"===t.mode()||\"STA+AP\"===t.mode()}),t.fullMode=ko.pureComputed(function(){switch(t.mode()){case\"AP\":return\"Access Point (AP)\";case\"STA\":return\"Client (STA)\";case\"STA+AP\":return\"Client + Access Point (STA+AP)\"}return\"Unknown (\"+t.mode()+\")\"}),this.estate=ko.pureComputed(function(){var e;switch(t.state()){case 0:e=\"Starting\";break;case 1:e=\"Not Connected\";break;case 2:e=\"EV Connected\";break;case 3:e=\"Charging\";break;case 4:e=\"Vent Required\";break;case 5:e=\"Diode Check Failed\";break;case 6:e=\"GFCI Fault\";break;case 7:e=\"No Earth Ground\";break;case 8:e=\"Stuck Relay\";break;case 9:e=\"GFCI Self Test Failed\";break;case 10:e=\"Over Temperature\";break;case 254:e=\"Waiting\";break;case 255:e=\"Disabled\";break;default:e=\"Invalid\"}return e})}function WiFiScanResultViewModel(e){ko.mapping.fromJS(e,{},this)}function WiFiScanViewModel(e){var t=this,n=ko.pureComputed(function(){return e()+\"/scan\"});t.results=ko.mapping.fromJS([],{key:function(e){return ko.utils.unwrapObservable(e.bssid)},create:function(e){return new WiFiScanResultViewModel(e.data)}}),t.fetching=ko.observable(!1),t.update=function(){var e=0<arguments.length&&void 0!==arguments[0]?arguments[0]:function(){};t.fetching(!0),$.get(n(),function(e){0<e.length&&(ko.mapping.fromJS(e,t.results),t.results.sort(function(e,t){return e.ssid()===t.ssid()?e.rssi()<t.rssi()?1:-1:e.ssid()<t.ssid()?-1:1}))},\"json\").always(function(){t.fetching(!1),e()})}}function WiFiConfigViewModel(e,t,n,r){var i=this;i.baseEndpoint=e,i.config=t,i.status=n,i.scan=r,i.scanUpdating=ko.observable(!1),i.bssid=ko.observable(\"\"),i.bssid.subscribe(function(e){for(var t=0;t<i.scan.results().length;t++){var n=i.scan.results()[t];if(e===n.bssid())return void i.config.ssid(n.ssid())}});var o=null,a=!1;i.startScan=function(){i.scanUpdating()||(a=!0,i.scanUpdating(!0),null!==o&&(clearTimeout(o),o=null),i.scan.update(function(){if(a&&(o=setTimeout(i.startScan,3e3)),\"\"===i.bssid())for(var e=i.config.ssid(),t=0;t<i.scan.results().length;t++){var n=i.scan.results()[t];if(e===n.ssid()){i.bssid(n.bssid());break}}i.scanUpdating(!1)}))},i.stopScan=function(){a=!1,i.scanUpdating()||null!==o&&(clearTimeout(o),o=null)},i.enableScan=function(e){e?i.startScan():i.stopScan()},i.forceConfig=ko.observable(!1),i.canConfigure=ko.pureComputed(function(){return!i.status.isWiFiError()&&!i.wifiConnecting()&&(!i.status.isWifiClient()||i.forceConfig())}),i.wifiConnecting=ko.observable(!1),i.canConfigure.subscribe(function(e){i.enableScan(e)}),i.status.wifi_client_connected.subscribe(function(e){e&&i.wifiConnecting(!1)}),i.enableScan(i.canConfigure()),i.saveNetworkFetching=ko.observable(!1),i.saveNetworkSuccess=ko.observable(!1),i.saveNetwork=function(){\"\"===i.config.ssid()?alert(\"Please select network\"):(i.saveNetworkFetching(!0),i.saveNetworkSuccess(!1),$.post(i.baseEndpoint()+\"/savenetwork\",{ssid:i.config.ssid(),pass:i.config.pass()},function(){i.status.wifi_client_connected(!1),i.forceConfig(!1),i.wifiConnecting(!0),i.saveNetworkSuccess(!0)}).fail(function(){alert(\"Failed to save WiFi config\")}).always(function(){i.saveNetworkFetching(!1)}))},i.turnOffAccessPointFetching=ko.observable(!1),i.turnOffAccessPointSuccess=ko.observable(!1),i.turnOffAccessPoint=function(){i.turnOffAccessPointFetching(!0),i.turnOffAccessPointSuccess(!1),$.post(i.baseEndpoint()+\"/apoff\",{},function(e){console.log(e),\"\"!==i.status.ipaddress()?setTimeout(function(){window.location=\"//\"+i.status.ipaddress(),i.turnOffAccessPointSuccess(!0)},3e3):i.turnOffAccessPointSuccess(!0)}).fail(function(){alert(\"Failed to turn off Access Point\")}).always(function(){i.turnOffAccessPointFetching(!1)})}}!function(e,t){\"object\"===(\"undefined\"==typeof module?\"undefined\":_typeof(module))&&\"object\"===_typeof(module.exports)?module.exports=e.document?t(e,!0):function(e){if(!e.document)throw new Error(\"jQuery requires a window with a document\");return t(e)}:t(e)}(\"undefined\"!=typeof window?window:void 0,function(k,e){var t=[],C=k.document,r=Object.getPrototypeOf,s=t.slice,v=t.concat,u=t.push,i=t.indexOf,n={},o=n.toString,g=n.hasOwnProperty,a=g.toString,c=a.call(Object),m={},y=function(e){return\"function\"==typeof e&&\"number\"!=typeof e.nodeType},b=function(e){return null!=e&&e===e.window},l={type:!0,src:!0,noModule:!0};function w(e,t,n){var r,i=(t=t||C).createElement(\"script\");if(i.text=e,n)for(r in l)n[r]&&(i[r]=n[r]);t.head.appendChild(i).parentNode.removeChild(i)}function x(e){return null==e?e+\"\":\"object\"===_typeof(e)||\"function\"==typeof e?n[o.call(e)]||\"object\":_typeof(e)}var f=\"3.3.1\",E=function e(t,n){return new e.fn.init(t,n)},p=/^[\\s\\uFEFF\\xA0]+|[\\s\\uFEFF\\xA0]+$/g;function d(e){var t=!!e&&\"length\"in e&&e.length,n=x(e);return!y(e)&&!b(e)&&(\"array\"===n||0===t||\"number\"==typeof t&&0<t&&t-1 in e)}E.fn=E.prototype={jquery:f,constructor:E,length:0,toArray:function(){return s.call(this)},get:function(e){return null==e?s.call(this):e<0?this[e+this.length]:this[e]},pushStack:function(e){var t=E.merge(this.constructor(),e);return t.prevObject=this,t},each:function(e){return E.each(this,e)},map:function(n){return this.pushStack(E.map(this,function(e,t){return n.call(e,t,e)}))},slice:function(){return this.pushStack(s.apply(this,arguments))},first:function(){return this.eq(0)},last:function(){return this.eq(-1)},eq:function(e){var t=this.length,n=+e+(e<0?t:0);return this.pushStack(0<=n&&n<t?[this[n]]:[])},end:function(){return this.prevObject||this.constructor()},push:u,sort:t.sort,splice:t.splice},E.extend=E.fn.extend=function(){var e,t,n,r,i,o,a=arguments[0]||{},s=1,u=arguments.length,c=!1;for(\"boolean\"==typeof a&&(c=a,a=arguments[s]||{},s++),\"object\"===_typeof(a)||y(a)||(a={}),s===u&&(a=this,s--);s<u;s++)if(null!=(e=arguments[s]))for(t in e)n=a[t],a!==(r=e[t])&&(c&&r&&(E.isPlainObject(r)||(i=Array.isArray(r)))?(o=i?(i=!1,n&&Array.isArray(n)?n:[]):n&&E.isPlainObject(n)?n:{},a[t]=E.extend(c,o,r)):void 0!==r&&(a[t]=r));return a},E.extend({expando:\"jQuery\"+(f+Math.random()).replace(/\\D/g,\"\"),isReady:!0,error:function(e){throw new Error(e)},noop:function(){},isPlainObject:function(e){var t,n;return!(!e||\"[object Object]\"!==o.call(e))&&(!(t=r(e))||\"function\"==typeof(n=g.call(t,\"constructor\")&&t.constructor)&&a.call(n)===c)},isEmptyObject:function(e){var t;for(t in e)return!1;return!0},globalEval:function(e){w(e)},each:function(e,t){var n,r=0;if(d(e))for(n=e.length;r<n&&!1!==t.call(e[r],r,e[r]);r++);else for(r in e)if(!1===t.call(e[r],r,e[r]))break;return e},trim:function(e){return null==e?\"\":(e+\"\").replace(p,\"\")},makeArray:function(e,t){var n=t||[];return null!=e&&(d(Object(e))?E.merge(n,\"string\"==typeof e?[e]:e):u.call(n,e)),n},inArray:function(e,t,n){return null==t?-1:i.call(t,e,n)},merge:function(e,t){for(var n=+t.length,r=0,i=e.length;r<n;r++)e[i++]=t[r];return e.length=i,e},grep:function(e,t,n){for(var r=[],i=0,o=e.length,a=!n;i<o;i++)!t(e[i],i)!==a&&r.push(e[i]);return r},map:function(e,t,n){var r,i,o=0,a=[];if(d(e))for(r=e.length;o<r;o++)null!=(i=t(e[o],o,n))&&a.push(i);else for(o in e)null!=(i=t(e[o],o,n))&&a.push(i);return v.apply([],a)},guid:1,support:m}),\"function\"==typeof Symbol&&(E.fn[Symbol.iterator]=t[Symbol.iterator]),E.each(\"Boolean Number String Function Array Date RegExp Object Error Symbol\".split(\" \"),function(e,t){n[\"[object \"+t+\"]\"]=t.toLowerCase()});var h=function(n){var e,d,w,o,i,h,f,v,x,u,c,T,k,a,C,g,s,l,m,E=\"sizzle\"+1*new Date,y=n.document,S=0,r=0,p=ae(),b=ae(),N=ae(),D=function(e,t){return e===t&&(c=!0),0},A={}.hasOwnProperty,t=[],O=t.pop,j=t.push,_=t.push,q=t.slice,L=function(e,t){for(var n=0,r=e.length;n<r;n++)if(e[n]===t)return n;return-1},M=\"checked|selected|async|autofocus|autoplay|controls|defer|disabled|hidden|ismap|loop|multiple|open|readonly|required|scoped\",P=\"[\\\\x20\\\\t\\\\r\\\\n\\\\f]\",B=\"(?:\\\\\\\\.|[\\\\w-]|[^\\0-\\\\xa0])+\",H=\"\\\\[\"+P+\"*(\"+B+\")(?:\"+P+\"*([*^$|!~]?=)\"+P+\"*(?:'((?:\\\\\\\\.|[^\\\\\\\\'])*)'|\\\"((?:\\\\\\\\.|[^\\\\\\\\\\\"])*)\\\"|(\"+B+\"))|)\"+P+\"*\\\\]\",R=\":(\"+B+\")(?:\\\\((('((?:\\\\\\\\.|[^\\\\\\\\'])*)'|\\\"((?:\\\\\\\\.|[^\\\\\\\\\\\"])*)\\\")|((?:\\\\\\\\.|[^\\\\\\\\()[\\\\]]|\"+H+\")*)|.*)\\\\)|)\",I=new RegExp(P+\"+\",\"g\"),$=new RegExp(\"^\"+P+\"+|((?:^|[^\\\\\\\\])(?:\\\\\\\\.)*)\"+P+\"+$\",\"g\"),F=new RegExp(\"^\"+P+\"*,\"+P+\"*\"),W=new RegExp(\"^\"+P+\"*([>+~]|\"+P+\")\"+P+\"*\"),V=new RegExp(\"=\"+P+\"*([^\\\\]'\\\"]*?)\"+P+\"*\\\\]\",\"g\"),U=new RegExp(R),J=new RegExp(\"^\"+B+\"$\"),z={ID:new RegExp(\"^#(\"+B+\")\"),CLASS:new RegExp(\"^\\\\.(\"+B+\")\"),TAG:new RegExp(\"^(\"+B+\"|[*])\"),ATTR:new RegExp(\"^\"+H),PSEUDO:new RegExp(\"^\"+R),CHILD:new RegExp(\"^:(only|first|last|nth|nth-last)-(child|of-type)(?:\\\\(\"+P+\"*(even|odd|(([+-]|)(\\\\d*)n|)\"+P+\"*(?:([+-]|)\"+P+\"*(\\\\d+)|))\"+P+\"*\\\\)|)\",\"i\"),bool:new RegExp(\"^(?:\"+M+\")$\",\"i\"),needsContext:new RegExp(\"^\"+P+\"*[>+~]|:(even|odd|eq|gt|lt|nth|first|last)(?:\\\\(\"+P+\"*((?:-\\\\d)?\\\\d*)\"+P+\"*\\\\)|)(?=[^-]|$)\",\"i\")},X=/^(?:input|select|textarea|button)$/i,G=/^h\\d$/i,Q=/^[^{]+\\{\\s*\\[native \\w/,Y=/^(?:#([\\w-]+)|(\\w+)|\\.([\\w-]+))$/,K=/[+~]/,Z=new RegExp(\"\\\\\\\\([\\\\da-f]{1,6}\"+P+\"?|(\"+P+\")|.)\",\"ig\"),ee=function(e,t,n){var r=\"0x\"+t-65536;return r!=r||n?t:r<0?String.fromCharCode(r+65536):String.fromCharCode(r>>10|55296,1023&r|56320)},te=/([\\0-\\x1f\\x7f]|^-?\\d)|^-$|[^\\0-\\x1f\\x7f-\\uFFFF\\w-]/g,ne=function(e,t){return t?\"\\0\"===e?\"�\":e.slice(0,-1)+\"\\\\\"+e.charCodeAt(e.length-1).toString(16)+\" \":\"\\\\\"+e},re=function(){T()},ie=ye(function(e){return!0===e.disabled&&(\"form\"in e||\"label\"in e)},{dir:\"parentNode\",next:\"legend\"});try{_.apply(t=q.call(y.childNodes),y.childNodes),t[y.childNodes.length].nodeType}catch(e){_={apply:t.length?function(e,t){j.apply(e,q.call(t))}:function(e,t){for(var n=e.length,r=0;e[n++]=t[r++];);e.length=n-1}}}function oe(e,t,n,r){var i,o,a,s,u,c,l,f=t&&t.ownerDocument,p=t?t.nodeType:9;if(n=n||[],\"string\"!=typeof e||!e||1!==p&&9!==p&&11!==p)return n;if(!r&&((t?t.ownerDocument||t:y)!==k&&T(t),t=t||k,C)){if(11!==p&&(u=Y.exec(e)))if(i=u[1]){if(9===p){if(!(a=t.getElementById(i)))return n;if(a.id===i)return n.push(a),n}else if(f&&(a=f.getElementById(i))&&m(t,a)&&a.id===i)return n.push(a),n}else{if(u[2])return _.apply(n,t.getElementsByTagName(e)),n;if((i=u[3])&&d.getElementsByClassName&&t.getElementsByClassName)return _.apply(n,t.getElementsByClassName(i)),n}if(d.qsa&&!N[e+\" \"]&&(!g||!g.test(e))){if(1!==p)f=t,l=e;else if(\"object\"!==t.nodeName.toLowerCase()){for((s=t.getAttribute(\"id\"))?s=s.replace(te,ne):t.setAttribute(\"id\",s=E),o=(c=h(e)).length;o--;)c[o]=\"#\"+s+\" \"+me(c[o]);l=c.join(\",\"),f=K.test(e)&&ve(t.parentNode)||t}if(l)try{return _.apply(n,f.querySelectorAll(l)),n}catch(e){}finally{s===E&&t.removeAttribute(\"id\")}}}return v(e.replace($,\"$1\"),t,n,r)}function ae(){var r=[];return function e(t,n){return r.push(t+\" \")>w.cacheLength&&delete e[r.shift()],e[t+\" \"]=n}}function se(e){return e[E]=!0,e}function ue(e){var t=k.createElement(\"fieldset\");try{return!!e(t)}catch(e){return!1}finally{t.parentNode&&t.parentNode.removeChild(t),t=null}}function ce(e,t){for(var n=e.split(\"|\"),r=n.length;r--;)w.attrHandle[n[r]]=t}function le(e,t){var n=t&&e,r=n&&1===e.nodeType&&1===t.nodeType&&e.sourceIndex-t.sourceIndex;if(r)return r;if(n)for(;n=n.nextSibling;)if(n===t)return-1;return e?1:-1}function fe(t){return function(e){return\"input\"===e.nodeName.toLowerCase()&&e.type===t}}function pe(n){return function(e){var t=e.nodeName.toLowerCase();return(\"input\"===t||\"button\"===t)&&e.type===n}}function de(t){return function(e){return\"form\"in e?e.parentNode&&!1===e.disabled?\"label\"in e?\"label\"in e.parentNode?e.parentNode.disabled===t:e.disabled===t:e.isDisabled===t||e.isDisabled!==!t&&ie(e)===t:e.disabled===t:\"label\"in e&&e.disabled===t}}function he(a){return se(function(o){return o=+o,se(function(e,t){for(var n,r=a([],e.length,o),i=r.length;i--;)e[n=r[i]]&&(e[n]=!(t[n]=e[n]))})})}function ve(e){return e&&void 0!==e.getElementsByTagName&&e}for(e in d=oe.support={},i=oe.isXML=function(e){var t=e&&(e.ownerDocument||e).documentElement;return!!t&&\"HTML\"!==t.nodeName},T=oe.setDocument=function(e){var t,n,r=e?e.ownerDocument||e:y;return r!==k&&9===r.nodeType&&r.documentElement&&(a=(k=r).documentElement,C=!i(k),y!==k&&(n=k.defaultView)&&n.top!==n&&(n.addEventListener?n.addEventListener(\"unload\",re,!1):n.attachEvent&&n.attachEvent(\"onunload\",re)),d.attributes=ue(function(e){return e.className=\"i\",!e.getAttribute(\"className\")}),d.getElementsByTagName=ue(function(e){return e.appendChild(k.createComment(\"\")),!e.getElementsByTagName(\"*\").length}),d.getElementsByClassName=Q.test(k.getElementsByClassName),d.getById=ue(function(e){return a.appendChild(e).id=E,!k.getElementsByName||!k.getElementsByName(E).length}),d.getById?(w.filter.ID=function(e){var t=e.replace(Z,ee);return function(e){return e.getAttribute(\"id\")===t}},w.find.ID=function(e,t){if(void 0!==t.getElementById&&C){var n=t.getElementById(e);return n?[n]:[]}}):(w.filter.ID=function(e){var n=e.replace(Z,ee);return function(e){var t=void 0!==e.getAttributeNode&&e.getAttributeNode(\"id\");return t&&t.value===n}},w.find.ID=function(e,t){if(void 0!==t.getElementById&&C){var n,r,i,o=t.getElementById(e);if(o){if((n=o.getAttributeNode(\"id\"))&&n.value===e)return[o];for(i=t.getElementsByName(e),r=0;o=i[r++];)if((n=o.getAttributeNode(\"id\"))&&n.value===e)return[o]}return[]}}),w.find.TAG=d.getElementsByTagName?function(e,t){return void 0!==t.getElementsByTagName?t.getElementsByTagName(e):d.qsa?t.querySelectorAll(e):void 0}:function(e,t){var n,r=[],i=0,o=t.getElementsByTagName(e);if(\"*\"!==e)return o;for(;n=o[i++];)1===n.nodeType&&r.push(n);return r},w.find.CLASS=d.getElementsByClassName&&function(e,t){if(void 0!==t.getElementsByClassName&&C)return t.getElementsByClassName(e)},s=[],g=[],(d.qsa=Q.test(k.querySelectorAll))&&(ue(function(e){a.appendChild(e).innerHTML=\"<a id='\"+E+\"'></a><select id='\"+E+\"-\\r\\\\' msallowcapture=''><option selected=''></option></select>\",e.querySelectorAll(\"[msallowcapture^='']\").length&&g.push(\"[*^$]=\"+P+\"*(?:''|\\\"\\\")\"),e.querySelectorAll(\"[selected]\").length||g.push(\"\\\\[\"+P+\"*(?:value|\"+M+\")\"),e.querySelectorAll(\"[id~=\"+E+\"-]\").length||g.push(\"~=\"),e.querySelectorAll(\":checked\").length||g.push(\":checked\"),e.querySelectorAll(\"a#\"+E+\"+*\").length||g.push(\".#.+[+~]\")}),ue(function(e){e.innerHTML=\"<a href='' disabled='disabled'></a><select disabled='disabled'><option/></select>\";var t=k.createElement(\"input\");t.setAttribute(\"type\",\"hidden\"),e.appendChild(t).setAttribute(\"name\",\"D\"),e.querySelectorAll(\"[name=d]\").length&&g.push(\"name\"+P+\"*[*^$|!~]?=\"),2!==e.querySelectorAll(\":enabled\").length&&g.push(\":enabled\",\":disabled\"),a.appendChild(e).disabled=!0,2!==e.querySelectorAll(\":disabled\").length&&g.push(\":enabled\",\":disabled\"),e.querySelectorAll(\"*,:x\"),g.push(\",.*:\")})),(d.matchesSelector=Q.test(l=a.matches||a.webkitMatchesSelector||a.mozMatchesSelector||a.oMatchesSelector||a.msMatchesSelector))&&ue(function(e){d.disconnectedMatch=l.call(e,\"*\"),l.call(e,\"[s!='']:x\"),s.push(\"!=\",R)}),g=g.length&&new RegExp(g.join(\"|\")),s=s.length&&new RegExp(s.join(\"|\")),t=Q.test(a.compareDocumentPosition),m=t||Q.test(a.contains)?function(e,t){var n=9===e.nodeType?e.documentElement:e,r=t&&t.parentNode;return e===r||!(!r||1!==r.nodeType||!(n.contains?n.contains(r):e.compareDocumentPosition&&16&e.compareDocumentPosition(r)))}:function(e,t){if(t)for(;t=t.parentNode;)if(t===e)return!0;return!1},D=t?function(e,t){if(e===t)return c=!0,0;var n=!e.compareDocumentPosition-!t.compareDocumentPosition;return n||(1&(n=(e.ownerDocument||e)===(t.ownerDocument||t)?e.compareDocumentPosition(t):1)||!d.sortDetached&&t.compareDocumentPosition(e)===n?e===k||e.ownerDocument===y&&m(y,e)?-1:t===k||t.ownerDocument===y&&m(y,t)?1:u?L(u,e)-L(u,t):0:4&n?-1:1)}:function(e,t){if(e===t)return c=!0,0;var n,r=0,i=e.parentNode,o=t.parentNode,a=[e],s=[t];if(!i||!o)return e===k?-1:t===k?1:i?-1:o?1:u?L(u,e)-L(u,t):0;if(i===o)return le(e,t);for(n=e;n=n.parentNode;)a.unshift(n);for(n=t;n=n.parentNode;)s.unshift(n);for(;a[r]===s[r];)r++;return r?le(a[r],s[r]):a[r]===y?-1:s[r]===y?1:0}),k},oe.matches=function(e,t){return oe(e,null,null,t)},oe.matchesSelector=function(e,t){if((e.ownerDocument||e)!==k&&T(e),t=t.replace(V,\"='$1']\"),d.matchesSelector&&C&&!N[t+\" \"]&&(!s||!s.test(t))&&(!g||!g.test(t)))try{var n=l.call(e,t);if(n||d.disconnectedMatch||e.document&&11!==e.document.nodeType)return n}catch(e){}return 0<oe(t,k,null,[e]).length},oe.contains=function(e,t){return(e.ownerDocument||e)!==k&&T(e),m(e,t)},oe.attr=function(e,t){(e.ownerDocument||e)!==k&&T(e);var n=w.attrHandle[t.toLowerCase()],r=n&&A.call(w.attrHandle,t.toLowerCase())?n(e,t,!C):void 0;return void 0!==r?r:d.attributes||!C?e.getAttribute(t):(r=e.getAttributeNode(t))&&r.specified?r.value:null},oe.escape=function(e){return(e+\"\").replace(te,ne)},oe.error=function(e){throw new Error(\"Syntax error, unrecognized expression: \"+e)},oe.uniqueSort=function(e){var t,n=[],r=0,i=0;if(c=!d.detectDuplicates,u=!d.sortStable&&e.slice(0),e.sort(D),c){for(;t=e[i++];)t===e[i]&&(r=n.push(i));for(;r--;)e.splice(n[r],1)}return u=null,e},o=oe.getText=function(e){var t,n=\"\",r=0,i=e.nodeType;if(i){if(1===i||9===i||11===i){if(\"string\"==typeof e.textContent)return e.textContent;for(e=e.firstChild;e;e=e.nextSibling)n+=o(e)}else if(3===i||4===i)return e.nodeValue}else for(;t=e[r++];)n+=o(t);return n},(w=oe.selectors={cacheLength:50,createPseudo:se,match:z,attrHandle:{},find:{},relative:{\">\":{dir:\"parentNode\",first:!0},\" \":{dir:\"parentNode\"},\"+\":{dir:\"previousSibling\",first:!0},\"~\":{dir:\"previousSibling\"}},preFilter:{ATTR:function(e){return e[1]=e[1].replace(Z,ee),e[3]=(e[3]||e[4]||e[5]||\"\").replace(Z,ee),\"~=\"===e[2]&&(e[3]=\" \"+e[3]+\" \"),e.slice(0,4)},CHILD:function(e){return e[1]=e[1].toLowerCase(),\"nth\"===e[1].slice(0,3)?(e[3]||oe.error(e[0]),e[4]=+(e[4]?e[5]+(e[6]||1):2*(\"even\"===e[3]||\"odd\"===e[3])),e[5]=+(e[7]+e[8]||\"odd\"===e[3])):e[3]&&oe.error(e[0]),e},PSEUDO:function(e){var t,n=!e[6]&&e[2];return z.CHILD.test(e[0])?null:(e[3]?e[2]=e[4]||e[5]||\"\":n&&U.test(n)&&(t=h(n,!0))&&(t=n.indexOf(\")\",n.length-t)-n.length)&&(e[0]=e[0].slice(0,t),e[2]=n.slice(0,t)),e.slice(0,3))}},filter:{TAG:function(e){var t=e.replace(Z,ee).toLowerCase();return\"*\"===e?function(){return!0}:function(e){return e.nodeName&&e.nodeName.toLowerCase()===t}},CLASS:function(e){var t=p[e+\" \"];return t||(t=new RegExp(\"(^|\"+P+\")\"+e+\"(\"+P+\"|$)\"))&&p(e,function(e){return t.test(\"string\"==typeof e.className&&e.className||void 0!==e.getAttribute&&e.getAttribute(\"class\")||\"\")})},ATTR:function(n,r,i){return function(e){var t=oe.attr(e,n);return null==t?\"!=\"===r:!r||(t+=\"\",\"=\"===r?t===i:\"!=\"===r?t!==i:\"^=\"===r?i&&0===t.indexOf(i):\"*=\"===r?i&&-1<t.indexOf(i):\"$=\"===r?i&&t.slice(-i.length)===i:\"~=\"===r?-1<(\" \"+t.replace(I,\" \")+\" \").indexOf(i):\"|=\"===r&&(t===i||t.slice(0,i.length+1)===i+\"-\"))}},CHILD:function(h,e,t,v,g){var m=\"nth\"!==h.slice(0,3),y=\"last\"!==h.slice(-4),b=\"of-type\"===e;return 1===v&&0===g?function(e){return!!e.parentNode}:function(e,t,n){var r,i,o,a,s,u,c=m!==y?\"nextSibling\":\"previousSibling\",l=e.parentNode,f=b&&e.nodeName.toLowerCase(),p=!n&&!b,d=!1;if(l){if(m){for(;c;){for(a=e;a=a[c];)if(b?a.nodeName.toLowerCase()===f:1===a.nodeType)return!1;u=c=\"only\"===h&&!u&&\"nextSibling\"}return!0}if(u=[y?l.firstChild:l.lastChild],y&&p){for(d=(s=(r=(i=(o=(a=l)[E]||(a[E]={}))[a.uniqueID]||(o[a.uniqueID]={}))[h]||[])[0]===S&&r[1])&&r[2],a=s&&l.childNodes[s];a=++s&&a&&a[c]||(d=s=0)||u.pop();)if(1===a.nodeType&&++d&&a===e){i[h]=[S,s,d];break}}else if(p&&(d=s=(r=(i=(o=(a=e)[E]||(a[E]={}))[a.uniqueID]||(o[a.uniqueID]={}))[h]||[])[0]===S&&r[1]),!1===d)for(;(a=++s&&a&&a[c]||(d=s=0)||u.pop())&&((b?a.nodeName.toLowerCase()!==f:1!==a.nodeType)||!++d||(p&&((i=(o=a[E]||(a[E]={}))[a.uniqueID]||(o[a.uniqueID]={}))[h]=[S,d]),a!==e)););return(d-=g)===v||d%v==0&&0<=d/v}}},PSEUDO:function(e,o){var t,a=w.pseudos[e]||w.setFilters[e.toLowerCase()]||oe.error(\"unsupported pseudo: \"+e);return a[E]?a(o):1<a.length?(t=[e,e,\"\",o],w.setFilters.hasOwnProperty(e.toLowerCase())?se(function(e,t){for(var n,r=a(e,o),i=r.length;i--;)e[n=L(e,r[i])]=!(t[n]=r[i])}):function(e){return a(e,0,t)}):a}},pseudos:{not:se(function(e){var r=[],i=[],s=f(e.replace($,\"$1\"));return s[E]?se(function(e,t,n,r){for(var i,o=s(e,null,r,[]),a=e.length;a--;)(i=o[a])&&(e[a]=!(t[a]=i))}):function(e,t,n){return r[0]=e,s(r,null,n,i),r[0]=null,!i.pop()}}),has:se(function(t){return function(e){return 0<oe(t,e).length}}),contains:se(function(t){return t=t.replace(Z,ee),function(e){return-1<(e.textContent||e.innerText||o(e)).indexOf(t)}}),lang:se(function(n){return J.test(n||\"\")||oe.error(\"unsupported lang: \"+n),n=n.replace(Z,ee).toLowerCase(),function(e){var t;do{if(t=C?e.lang:e.getAttribute(\"xml:lang\")||e.getAttribute(\"lang\"))return(t=t.toLowerCase())===n||0===t.indexOf(n+\"-\")}while((e=e.parentNode)&&1===e.nodeType);return!1}}),target:function(e){var t=n.location&&n.location.hash;return t&&t.slice(1)===e.id},root:function(e){return e===a},focus:function(e){return e===k.activeElement&&(!k.hasFocus||k.hasFocus())&&!!(e.type||e.href||~e.tabIndex)},enabled:de(!1),disabled:de(!0),checked:function(e){var t=e.nodeName.toLowerCase();return\"input\"===t&&!!e.checked||\"option\"===t&&!!e.selected},selected:function(e){return e.parentNode&&e.parentNode.selectedIndex,!0===e.selected},empty:function(e){for(e=e.firstChild;e;e=e.nextSibling)if(e.nodeType<6)return!1;return!0},parent:function(e){return!w.pseudos.empty(e)},header:function(e){return G.test(e.nodeName)},input:function(e){return X.test(e.nodeName)},button:function(e){var t=e.nodeName.toLowerCase();return\"input\"===t&&\"button\"===e.type||\"button\"===t},text:function(e){var t;return\"input\"===e.nodeName.toLowerCase()&&\"text\"===e.type&&(null==(t=e.getAttribute(\"type\"))||\"text\"===t.toLowerCase())},first:he(function(){return[0]}),last:he(function(e,t){return[t-1]}),eq:he(function(e,t,n){return[n<0?n+t:n]}),even:he(function(e,t){for(var n=0;n<t;n+=2)e.push(n);return e}),odd:he(function(e,t){for(var n=1;n<t;n+=2)e.push(n);return e}),lt:he(function(e,t,n){for(var r=n<0?n+t:n;0<=--r;)e.push(r);return e}),gt:he(function(e,t,n){for(var r=n<0?n+t:n;++r<t;)e.push(r);return e})}}).pseudos.nth=w.pseudos.eq,{radio:!0,checkbox:!0,file:!0,password:!0,image:!0})w.pseudos[e]=fe(e);for(e in{submit:!0,reset:!0})w.pseudos[e]=pe(e);function ge(){}function me(e){for(var t=0,n=e.length,r=\"\";t<n;t++)r+=e[t].value;return r}function ye(s,e,t){var u=e.dir,c=e.next,l=c||u,f=t&&\"parentNode\"===l,p=r++;return e.first?function(e,t,n){for(;e=e[u];)if(1===e.nodeType||f)return s(e,t,n);return!1}:function(e,t,n){var r,i,o,a=[S,p];if(n){for(;e=e[u];)if((1===e.nodeType||f)&&s(e,t,n))return!0}else for(;e=e[u];)if(1===e.nodeType||f)if(i=(o=e[E]||(e[E]={}))[e.uniqueID]||(o[e.uniqueID]={}),c&&c===e.nodeName.toLowerCase())e=e[u]||e;else{if((r=i[l])&&r[0]===S&&r[1]===p)return a[2]=r[2];if((i[l]=a)[2]=s(e,t,n))return!0}return!1}}function be(i){return 1<i.length?function(e,t,n){for(var r=i.length;r--;)if(!i[r](e,t,n))return!1;return!0}:i[0]}function we(e,t,n,r,i){for(var o,a=[],s=0,u=e.length,c=null!=t;s<u;s++)(o=e[s])&&(n&&!n(o,r,i)||(a.push(o),c&&t.push(s)));return a}function xe(d,h,v,g,m,e){return g&&!g[E]&&(g=xe(g)),m&&!m[E]&&(m=xe(m,e)),se(function(e,t,n,r){var i,o,a,s=[],u=[],c=t.length,l=e||function(e,t,n){for(var r=0,i=t.length;r<i;r++)oe(e,t[r],n);return n}(h||\"*\",n.nodeType?[n]:n,[]),f=!d||!e&&h?l:we(l,s,d,n,r),p=v?m||(e?d:c||g)?[]:t:f;if(v&&v(f,p,n,r),g)for(i=we(p,u),g(i,[],n,r),o=i.length;o--;)(a=i[o])&&(p[u[o]]=!(f[u[o]]=a));if(e){if(m||d){if(m){for(i=[],o=p.length;o--;)(a=p[o])&&i.push(f[o]=a);m(null,p=[],i,r)}for(o=p.length;o--;)(a=p[o])&&-1<(i=m?L(e,a):s[o])&&(e[i]=!(t[i]=a))}}else p=we(p===t?p.splice(c,p.length):p),m?m(null,t,p,r):_.apply(t,p)})}function Te(e){for(var i,t,n,r=e.length,o=w.relative[e[0].type],a=o||w.relative[\" \"],s=o?1:0,u=ye(function(e){return e===i},a,!0),c=ye(function(e){return-1<L(i,e)},a,!0),l=[function(e,t,n){var r=!o&&(n||t!==x)||((i=t).nodeType?u(e,t,n):c(e,t,n));return i=null,r}];s<r;s++)if(t=w.relative[e[s].type])l=[ye(be(l),t)];else{if((t=w.filter[e[s].type].apply(null,e[s].matches))[E]){for(n=++s;n<r&&!w.relative[e[n].type];n++);return xe(1<s&&be(l),1<s&&me(e.slice(0,s-1).concat({value:\" \"===e[s-2].type?\"*\":\"\"})).replace($,\"$1\"),t,s<n&&Te(e.slice(s,n)),n<r&&Te(e=e.slice(n)),n<r&&me(e))}l.push(t)}return be(l)}return ge.prototype=w.filters=w.pseudos,w.setFilters=new ge,h=oe.tokenize=function(e,t){var n,r,i,o,a,s,u,c=b[e+\" \"];if(c)return t?0:c.slice(0);for(a=e,s=[],u=w.preFilter;a;){for(o in n&&!(r=F.exec(a))||(r&&(a=a.slice(r[0].length)||a),s.push(i=[])),n=!1,(r=W.exec(a))&&(n=r.shift(),i.push({value:n,type:r[0].replace($,\" \")}),a=a.slice(n.length)),w.filter)!(r=z[o].exec(a))||u[o]&&!(r=u[o](r))||(n=r.shift(),i.push({value:n,type:o,matches:r}),a=a.slice(n.length));if(!n)break}return t?a.length:a?oe.error(e):b(e,s).slice(0)},f=oe.compile=function(e,t){var n,g,m,y,b,r,i=[],o=[],a=N[e+\" \"];if(!a){for(t||(t=h(e)),n=t.length;n--;)(a=Te(t[n]))[E]?i.push(a):o.push(a);(a=N(e,(g=o,y=0<(m=i).length,b=0<g.length,r=function(e,t,n,r,i){var o,a,s,u=0,c=\"0\",l=e&&[],f=[],p=x,d=e||b&&w.find.TAG(\"*\",i),h=S+=null==p?1:Math.random()||.1,v=d.length;for(i&&(x=t===k||t||i);c!==v&&null!=(o=d[c]);c++){if(b&&o){for(a=0,t||o.ownerDocument===k||(T(o),n=!C);s=g[a++];)if(s(o,t||k,n)){r.push(o);break}i&&(S=h)}y&&((o=!s&&o)&&u--,e&&l.push(o))}if(u+=c,y&&c!==u){for(a=0;s=m[a++];)s(l,f,t,n);if(e){if(0<u)for(;c--;)l[c]||f[c]||(f[c]=O.call(r));f=we(f)}_.apply(r,f),i&&!e&&0<f.length&&1<u+m.length&&oe.uniqueSort(r)}return i&&(S=h,x=p),l},y?se(r):r))).selector=e}return a},v=oe.select=function(e,t,n,r){var i,o,a,s,u,c=\"function\"==typeof e&&e,l=!r&&h(e=c.selector||e);if(n=n||[],1===l.length){if(2<(o=l[0]=l[0].slice(0)).length&&\"ID\"===(a=o[0]).type&&9===t.nodeType&&C&&w.relative[o[1].type]){if(!(t=(w.find.ID(a.matches[0].replace(Z,ee),t)||[])[0]))return n;c&&(t=t.parentNode),e=e.slice(o.shift().value.length)}for(i=z.needsContext.test(e)?0:o.length;i--&&(a=o[i],!w.relative[s=a.type]);)if((u=w.find[s])&&(r=u(a.matches[0].replace(Z,ee),K.test(o[0].type)&&ve(t.parentNode)||t))){if(o.splice(i,1),!(e=r.length&&me(o)))return _.apply(n,r),n;break}}return(c||f(e,l))(r,t,!C,n,!t||K.test(e)&&ve(t.parentNode)||t),n},d.sortStable=E.split(\"\").sort(D).join(\"\")===E,d.detectDuplicates=!!c,T(),d.sortDetached=ue(function(e){return 1&e.compareDocumentPosition(k.createElement(\"fieldset\"))}),ue(function(e){return e.innerHTML=\"<a href='#'></a>\",\"#\"===e.firstChild.getAttribute(\"href\")})||ce(\"type|href|height|width\",function(e,t,n){if(!n)return e.getAttribute(t,\"type\"===t.toLowerCase()?1:2)}),d.attributes&&ue(function(e){return e.innerHTML=\"<input/>\",e.firstChild.setAttribute(\"value\",\"\"),\"\"===e.firstChild.getAttribute(\"value\")})||ce(\"value\",function(e,t,n){if(!n&&\"input\"===e.nodeName.toLowerCase())return e.defaultValue}),ue(function(e){return null==e.getAttribute(\"disabled\")})||ce(M,function(e,t,n){var r;if(!n)return!0===e[t]?t.toLowerCase():(r=e.getAttributeNode(t))&&r.specified?r.value:null}),oe}(k);E.find=h,E.expr=h.selectors,E.expr[\":\"]=E.expr.pseudos,E.uniqueSort=E.unique=h.uniqueSort,E.text=h.getText,E.isXMLDoc=h.isXML,E.contains=h.contains,E.escapeSelector=h.escape;var T=function(e,t,n){for(var r=[],i=void 0!==n;(e=e[t])&&9!==e.nodeType;)if(1===e.nodeType){if(i&&E(e).is(n))break;r.push(e)}return r},S=function(e,t){for(var n=[];e;e=e.nextSibling)1===e.nodeType&&e!==t&&n.push(e);return n},N=E.expr.match.needsContext;function D(e,t){return e.nodeName&&e.nodeName.toLowerCase()===t.toLowerCase()}var A=/^<([a-z][^\\/\\0>:\\x20\\t\\r\\n\\f]*)[\\x20\\t\\r\\n\\f]*\\/?>(?:<\\/\\1>|)$/i;function O(e,n,r){return y(n)?E.grep(e,function(e,t){return!!n.call(e,t,e)!==r}):n.nodeType?E.grep(e,function(e){return e===n!==r}):\"string\"!=typeof n?E.grep(e,function(e){return-1<i.call(n,e)!==r}):E.filter(n,e,r)}E.filter=function(e,t,n){var r=t[0];return n&&(e=\":not(\"+e+\")\"),1===t.length&&1===r.nodeType?E.find.matchesSelector(r,e)?[r]:[]:E.find.matches(e,E.grep(t,function(e){return 1===e.nodeType}))},E.fn.extend({find:function(e){var t,n,r=this.length,i=this;if(\"string\"!=typeof e)return this.pushStack(E(e).filter(function(){for(t=0;t<r;t++)if(E.contains(i[t],this))return!0}));for(n=this.pushStack([]),t=0;t<r;t++)E.find(e,i[t],n);return 1<r?E.uniqueSort(n):n},filter:function(e){return this.pushStack(O(this,e||[],!1))},not:function(e){return this.pushStack(O(this,e||[],!0))},is:function(e){return!!O(this,\"string\"==typeof e&&N.test(e)?E(e):e||[],!1).length}});var j,_=/^(?:\\s*(<[\\w\\W]+>)[^>]*|#([\\w-]+))$/;(E.fn.init=function(e,t,n){var r,i;if(!e)return this;if(n=n||j,\"string\"!=typeof e)return e.nodeType?(this[0]=e,this.length=1,this):y(e)?void 0!==n.ready?n.ready(e):e(E):E.makeArray(e,this);if(!(r=\"<\"===e[0]&&\">\"===e[e.length-1]&&3<=e.length?[null,e,null]:_.exec(e))||!r[1]&&t)return!t||t.jquery?(t||n).find(e):this.constructor(t).find(e);if(r[1]){if(t=t instanceof E?t[0]:t,E.merge(this,E.parseHTML(r[1],t&&t.nodeType?t.ownerDocument||t:C,!0)),A.test(r[1])&&E.isPlainObject(t))for(r in t)y(this[r])?this[r](t[r]):this.attr(r,t[r]);return this}return(i=C.getElementById(r[2]))&&(this[0]=i,this.length=1),this}).prototype=E.fn,j=E(C);var q=/^(?:parents|prev(?:Until|All))/,L={children:!0,contents:!0,next:!0,prev:!0};function M(e,t){for(;(e=e[t])&&1!==e.nodeType;);return e}E.fn.extend({has:function(e){var t=E(e,this),n=t.length;return this.filter(function(){for(var e=0;e<n;e++)if(E.contains(this,t[e]))return!0})},closest:function(e,t){var n,r=0,i=this.length,o=[],a=\"string\"!=typeof e&&E(e);if(!N.test(e))for(;r<i;r++)for(n=this[r];n&&n!==t;n=n.parentNode)if(n.nodeType<11&&(a?-1<a.index(n):1===n.nodeType&&E.find.matchesSelector(n,e))){o.push(n);break}return this.pushStack(1<o.length?E.uniqueSort(o):o)},index:function(e){return e?\"string\"==typeof e?i.call(E(e),this[0]):i.call(this,e.jquery?e[0]:e):this[0]&&this[0].parentNode?this.first().prevAll().length:-1},add:function(e,t){return this.pushStack(E.uniqueSort(E.merge(this.get(),E(e,t))))},addBack:function(e){return this.add(null==e?this.prevObject:this.prevObject.filter(e))}}),E.each({parent:function(e){var t=e.parentNode;return t&&11!==t.nodeType?t:null},parents:function(e){return T(e,\"parentNode\")},parentsUntil:function(e,t,n){return T(e,\"parentNode\",n)},next:function(e){return M(e,\"nextSibling\")},prev:function(e){return M(e,\"previousSibling\")},nextAll:function(e){return T(e,\"nextSibling\")},prevAll:function(e){return T(e,\"previousSibling\")},nextUntil:function(e,t,n){return T(e,\"nextSibling\",n)},prevUntil:function(e,t,n){return T(e,\"previousSibling\",n)},siblings:function(e){return S((e.parentNode||{}).firstChild,e)},children:function(e){return S(e.firstChild)},contents:function(e){return D(e,\"iframe\")?e.contentDocument:(D(e,\"template\")&&(e=e.content||e),E.merge([],e.childNodes))}},function(r,i){E.fn[r]=function(e,t){var n=E.map(this,i,e);return\"Until\"!==r.slice(-5)&&(t=e),t&&\"string\"==typeof t&&(n=E.filter(t,n)),1<this.length&&(L[r]||E.uniqueSort(n),q.test(r)&&n.reverse()),this.pushStack(n)}});var P=/[^\\x20\\t\\r\\n\\f]+/g;function B(e){return e}function H(e){throw e}function R(e,t,n,r){var i;try{e&&y(i=e.promise)?i.call(e).done(t).fail(n):e&&y(i=e.then)?i.call(e,t,n):t.apply(void 0,[e].slice(r))}catch(e){n.apply(void 0,[e])}}E.Callbacks=function(r){var e,n;r=\"string\"==typeof r?(e=r,n={},E.each(e.match(P)||[],function(e,t){n[t]=!0}),n):E.extend({},r);var i,t,o,a,s=[],u=[],c=-1,l=function(){for(a=a||r.once,o=i=!0;u.length;c=-1)for(t=u.shift();++c<s.length;)!1===s[c].apply(t[0],t[1])&&r.stopOnFalse&&(c=s.length,t=!1);r.memory||(t=!1),i=!1,a&&(s=t?[]:\"\")},f={add:function(){return s&&(t&&!i&&(c=s.length-1,u.push(t)),function n(e){E.each(e,function(e,t){y(t)?r.unique&&f.has(t)||s.push(t):t&&t.length&&\"string\"!==x(t)&&n(t)})}(arguments),t&&!i&&l()),this},remove:function(){return E.each(arguments,function(e,t){for(var n;-1<(n=E.inArray(t,s,n));)s.splice(n,1),n<=c&&c--}),this},has:function(e){return e?-1<E.inArray(e,s):0<s.length},empty:function(){return s&&(s=[]),this},disable:function(){return a=u=[],s=t=\"\",this},disabled:function(){return!s},lock:function(){return a=u=[],t||i||(s=t=\"\"),this},locked:function(){return!!a},fireWith:function(e,t){return a||(t=[e,(t=t||[]).slice?t.slice():t],u.push(t),i||l()),this},fire:function(){return f.fireWith(this,arguments),this},fired:function(){return!!o}};return f},E.extend({Deferred:function(e){var o=[[\"notify\",\"progress\",E.Callbacks(\"memory\"),E.Callbacks(\"memory\"),2],[\"resolve\",\"done\",E.Callbacks(\"once memory\"),E.Callbacks(\"once memory\"),0,\"resolved\"],[\"reject\",\"fail\",E.Callbacks(\"once memory\"),E.Callbacks(\"once memory\"),1,\"rejected\"]],i=\"pending\",a={state:function(){return i},always:function(){return s.done(arguments).fail(arguments),this},catch:function(e){return a.then(null,e)},pipe:function(){var i=arguments;return E.Deferred(function(r){E.each(o,function(e,t){var n=y(i[t[4]])&&i[t[4]];s[t[1]](function(){var e=n&&n.apply(this,arguments);e&&y(e.promise)?e.promise().progress(r.notify).done(r.resolve).fail(r.reject):r[t[0]+\"With\"](this,n?[e]:arguments)})}),i=null}).promise()},then:function(t,n,r){var u=0;function c(i,o,a,s){return function(){var n=this,r=arguments,e=function(){var e,t;if(!(i<u)){if((e=a.apply(n,r))===o.promise())throw new TypeError(\"Thenable self-resolution\");t=e&&(\"object\"===_typeof(e)||\"function\"==typeof e)&&e.then,y(t)?s?t.call(e,c(u,o,B,s),c(u,o,H,s)):(u++,t.call(e,c(u,o,B,s),c(u,o,H,s),c(u,o,B,o.notifyWith))):(a!==B&&(n=void 0,r=[e]),(s||o.resolveWith)(n,r))}},t=s?e:function(){try{e()}catch(e){E.Deferred.exceptionHook&&E.Deferred.exceptionHook(e,t.stackTrace),u<=i+1&&(a!==H&&(n=void 0,r=[e]),o.rejectWith(n,r))}};i?t():(E.Deferred.getStackHook&&(t.stackTrace=E.Deferred.getStackHook()),k.setTimeout(t))}}return E.Deferred(function(e){o[0][3].add(c(0,e,y(r)?r:B,e.notifyWith)),o[1][3].add(c(0,e,y(t)?t:B)),o[2][3].add(c(0,e,y(n)?n:H))}).promise()},promise:function(e){return null!=e?E.extend(e,a):a}},s={};return E.each(o,function(e,t){var n=t[2],r=t[5];a[t[1]]=n.add,r&&n.add(function(){i=r},o[3-e][2].disable,o[3-e][3].disable,o[0][2].lock,o[0][3].lock),n.add(t[3].fire),s[t[0]]=function(){return s[t[0]+\"With\"](this===s?void 0:this,arguments),this},s[t[0]+\"With\"]=n.fireWith}),a.promise(s),e&&e.call(s,s),s},when:function(e){var n=arguments.length,t=n,r=Array(t),i=s.call(arguments),o=E.Deferred(),a=function(t){return function(e){r[t]=this,i[t]=1<arguments.length?s.call(arguments):e,--n||o.resolveWith(r,i)}};if(n<=1&&(R(e,o.done(a(t)).resolve,o.reject,!n),\"pending\"===o.state()||y(i[t]&&i[t].then)))return o.then();for(;t--;)R(i[t],a(t),o.reject);return o.promise()}});var I=/^(Eval|Internal|Range|Reference|Syntax|Type|URI)Error$/;E.Deferred.exceptionHook=function(e,t){k.console&&k.console.warn&&e&&I.test(e.name)&&k.console.warn(\"jQuery.Deferred exception: \"+e.message,e.stack,t)},E.readyException=function(e){k.setTimeout(function(){throw e})};var $=E.Deferred();function F(){C.removeEventListener(\"DOMContentLoaded\",F),k.removeEventListener(\"load\",F),E.ready()}E.fn.ready=function(e){return $.then(e).catch(function(e){E.readyException(e)}),this},E.extend({isReady:!1,readyWait:1,ready:function(e){(!0===e?--E.readyWait:E.isReady)||(E.isReady=!0)!==e&&0<--E.readyWait||$.resolveWith(C,[E])}}),E.ready.then=$.then,\"complete\"===C.readyState||\"loading\"!==C.readyState&&!C.documentElement.doScroll?k.setTimeout(E.ready):(C.addEventListener(\"DOMContentLoaded\",F),k.addEventListener(\"load\",F));var W=function e(t,n,r,i,o,a,s){var u=0,c=t.length,l=null==r;if(\"object\"===x(r))for(u in o=!0,r)e(t,n,u,r[u],!0,a,s);else if(void 0!==i&&(o=!0,y(i)||(s=!0),l&&(n=s?(n.call(t,i),null):(l=n,function(e,t,n){return l.call(E(e),n)})),n))for(;u<c;u++)n(t[u],r,s?i:i.call(t[u],u,n(t[u],r)));return o?t:l?n.call(t):c?n(t[0],r):a},V=/^-ms-/,U=/-([a-z])/g;function J(e,t){return t.toUpperCase()}function z(e){return e.replace(V,\"ms-\").replace(U,J)}var X=function(e){return 1===e.nodeType||9===e.nodeType||!+e.nodeType};function G(){this.expando=E.expando+G.uid++}G.uid=1,G.prototype={cache:function(e){var t=e[this.expando];return t||(t={},X(e)&&(e.nodeType?e[this.expando]=t:Object.defineProperty(e,this.expando,{value:t,configurable:!0}))),t},set:function(e,t,n){var r,i=this.cache(e);if(\"string\"==typeof t)i[z(t)]=n;else for(r in t)i[z(r)]=t[r];return i},get:function(e,t){return void 0===t?this.cache(e):e[this.expando]&&e[this.expando][z(t)]},access:function(e,t,n){return void 0===t||t&&\"string\"==typeof t&&void 0===n?this.get(e,t):(this.set(e,t,n),void 0!==n?n:t)},remove:function(e,t){var n,r=e[this.expando];if(void 0!==r){if(void 0!==t){n=(t=Array.isArray(t)?t.map(z):(t=z(t))in r?[t]:t.match(P)||[]).length;for(;n--;)delete r[t[n]]}(void 0===t||E.isEmptyObject(r))&&(e.nodeType?e[this.expando]=void 0:delete e[this.expando])}},hasData:function(e){var t=e[this.expando];return void 0!==t&&!E.isEmptyObject(t)}};var Q=new G,Y=new G,K=/^(?:\\{[\\w\\W]*\\}|\\[[\\w\\W]*\\])$/,Z=/[A-Z]/g;function ee(e,t,n){var r,i;if(void 0===n&&1===e.nodeType)if(r=\"data-\"+t.replace(Z,\"-$&\").toLowerCase(),\"string\"==typeof(n=e.getAttribute(r))){try{n=\"true\"===(i=n)||\"false\"!==i&&(\"null\"===i?null:i===+i+\"\"?+i:K.test(i)?JSON.parse(i):i)}catch(e){}Y.set(e,t,n)}else n=void 0;return n}E.extend({hasData:function(e){return Y.hasData(e)||Q.hasData(e)},data:function(e,t,n){return Y.access(e,t,n)},removeData:function(e,t){Y.remove(e,t)},_data:function(e,t,n){return Q.access(e,t,n)},_removeData:function(e,t){Q.remove(e,t)}}),E.fn.extend({data:function(n,e){var t,r,i,o=this[0],a=o&&o.attributes;if(void 0!==n)return\"object\"===_typeof(n)?this.each(function(){Y.set(this,n)}):W(this,function(e){var t;if(o&&void 0===e)return void 0!==(t=Y.get(o,n))?t:void 0!==(t=ee(o,n))?t:void 0;this.each(function(){Y.set(this,n,e)})},null,e,1<arguments.length,null,!0);if(this.length&&(i=Y.get(o),1===o.nodeType&&!Q.get(o,\"hasDataAttrs\"))){for(t=a.length;t--;)a[t]&&0===(r=a[t].name).indexOf(\"data-\")&&(r=z(r.slice(5)),ee(o,r,i[r]));Q.set(o,\"hasDataAttrs\",!0)}return i},removeData:function(e){return this.each(function(){Y.remove(this,e)})}}),E.extend({queue:function(e,t,n){var r;if(e)return t=(t||\"fx\")+\"queue\",r=Q.get(e,t),n&&(!r||Array.isArray(n)?r=Q.access(e,t,E.makeArray(n)):r.push(n)),r||[]},dequeue:function(e,t){t=t||\"fx\";var n=E.queue(e,t),r=n.length,i=n.shift(),o=E._queueHooks(e,t);\"inprogress\"===i&&(i=n.shift(),r--),i&&(\"fx\"===t&&n.unshift(\"inprogress\"),delete o.stop,i.call(e,function(){E.dequeue(e,t)},o)),!r&&o&&o.empty.fire()},_queueHooks:function(e,t){var n=t+\"queueHooks\";return Q.get(e,n)||Q.access(e,n,{empty:E.Callbacks(\"once memory\").add(function(){Q.remove(e,[t+\"queue\",n])})})}}),E.fn.extend({queue:function(t,n){var e=2;return\"string\"!=typeof t&&(n=t,t=\"fx\",e--),arguments.length<e?E.queue(this[0],t):void 0===n?this:this.each(function(){var e=E.queue(this,t,n);E._queueHooks(this,t),\"fx\"===t&&\"inprogress\"!==e[0]&&E.dequeue(this,t)})},dequeue:function(e){return this.each(function(){E.dequeue(this,e)})},clearQueue:function(e){return this.queue(e||\"fx\",[])},promise:function(e,t){var n,r=1,i=E.Deferred(),o=this,a=this.length,s=function(){--r||i.resolveWith(o,[o])};for(\"string\"!=typeof e&&(t=e,e=void 0),e=e||\"fx\";a--;)(n=Q.get(o[a],e+\"queueHooks\"))&&n.empty&&(r++,n.empty.add(s));return s(),i.promise(t)}});var te=/[+-]?(?:\\d*\\.|)\\d+(?:[eE][+-]?\\d+|)/.source,ne=new RegExp(\"^(?:([+-])=|)(\"+te+\")([a-z%]*)$\",\"i\"),re=[\"Top\",\"Right\",\"Bottom\",\"Left\"],ie=function(e,t){return\"none\"===(e=t||e).style.display||\"\"===e.style.display&&E.contains(e.ownerDocument,e)&&\"none\"===E.css(e,\"display\")},oe=function(e,t,n,r){var i,o,a={};for(o in t)a[o]=e.style[o],e.style[o]=t[o];for(o in i=n.apply(e,r||[]),t)e.style[o]=a[o];return i};function ae(e,t,n,r){var i,o,a=20,s=r?function(){return r.cur()}:function(){return E.css(e,t,\"\")},u=s(),c=n&&n[3]||(E.cssNumber[t]?\"\":\"px\"),l=(E.cssNumber[t]||\"px\"!==c&&+u)&&ne.exec(E.css(e,t));if(l&&l[3]!==c){for(u/=2,c=c||l[3],l=+u||1;a--;)E.style(e,t,l+c),(1-o)*(1-(o=s()/u||.5))<=0&&(a=0),l/=o;l*=2,E.style(e,t,l+c),n=n||[]}return n&&(l=+l||+u||0,i=n[1]?l+(n[1]+1)*n[2]:+n[2],r&&(r.unit=c,r.start=l,r.end=i)),i}var se={};function ue(e,t){for(var n,r,i,o,a,s,u,c=[],l=0,f=e.length;l<f;l++)(r=e[l]).style&&(n=r.style.display,t?(\"none\"===n&&(c[l]=Q.get(r,\"display\")||null,c[l]||(r.style.display=\"\")),\"\"===r.style.display&&ie(r)&&(c[l]=(u=a=o=void 0,a=(i=r).ownerDocument,s=i.nodeName,(u=se[s])||(o=a.body.appendChild(a.createElement(s)),u=E.css(o,\"display\"),o.parentNode.removeChild(o),\"none\"===u&&(u=\"block\"),se[s]=u)))):\"none\"!==n&&(c[l]=\"none\",Q.set(r,\"display\",n)));for(l=0;l<f;l++)null!=c[l]&&(e[l].style.display=c[l]);return e}E.fn.extend({show:function(){return ue(this,!0)},hide:function(){return ue(this)},toggle:function(e){return\"boolean\"==typeof e?e?this.show():this.hide():this.each(function(){ie(this)?E(this).show():E(this).hide()})}});var ce=/^(?:checkbox|radio)$/i,le=/<([a-z][^\\/\\0>\\x20\\t\\r\\n\\f]+)/i,fe=/^$|^module$|\\/(?:java|ecma)script/i,pe={option:[1,\"<select multiple='multiple'>\",\"</select>\"],thead:[1,\"<table>\",\"</table>\"],col:[2,\"<table><colgroup>\",\"</colgroup></table>\"],tr:[2,\"<table><tbody>\",\"</tbody></table>\"],td:[3,\"<table><tbody><tr>\",\"</tr></tbody></table>\"],_default:[0,\"\",\"\"]};function de(e,t){var n;return n=void 0!==e.getElementsByTagName?e.getElementsByTagName(t||\"*\"):void 0!==e.querySelectorAll?e.querySelectorAll(t||\"*\"):[],void 0===t||t&&D(e,t)?E.merge([e],n):n}function he(e,t){for(var n=0,r=e.length;n<r;n++)Q.set(e[n],\"globalEval\",!t||Q.get(t[n],\"globalEval\"))}pe.optgroup=pe.option,pe.tbody=pe.tfoot=pe.colgroup=pe.caption=pe.thead,pe.th=pe.td;var ve,ge,me=/<|&#?\\w+;/;function ye(e,t,n,r,i){for(var o,a,s,u,c,l,f=t.createDocumentFragment(),p=[],d=0,h=e.length;d<h;d++)if((o=e[d])||0===o)if(\"object\"===x(o))E.merge(p,o.nodeType?[o]:o);else if(me.test(o)){for(a=a||f.appendChild(t.createElement(\"div\")),s=(le.exec(o)||[\"\",\"\"])[1].toLowerCase(),u=pe[s]||pe._default,a.innerHTML=u[1]+E.htmlPrefilter(o)+u[2],l=u[0];l--;)a=a.lastChild;E.merge(p,a.childNodes),(a=f.firstChild).textContent=\"\"}else p.push(t.createTextNode(o));for(f.textContent=\"\",d=0;o=p[d++];)if(r&&-1<E.inArray(o,r))i&&i.push(o);else if(c=E.contains(o.ownerDocument,o),a=de(f.appendChild(o),\"script\"),c&&he(a),n)for(l=0;o=a[l++];)fe.test(o.type||\"\")&&n.push(o);return f}ve=C.createDocumentFragment().appendChild(C.createElement(\"div\")),(ge=C.createElement(\"input\")).setAttribute(\"type\",\"radio\"),ge.setAttribute(\"checked\",\"checked\"),ge.setAttribute(\"name\",\"t\"),ve.appendChild(ge),m.checkClone=ve.cloneNode(!0).cloneNode(!0).lastChild.checked,ve.innerHTML=\"<textarea>x</textarea>\",m.noCloneChecked=!!ve.cloneNode(!0).lastChild.defaultValue;var be=C.documentElement,we=/^key/,xe=/^(?:mouse|pointer|contextmenu|drag|drop)|click/,Te=/^([^.]*)(?:\\.(.+)|)/;function ke(){return!0}function Ce(){return!1}function Ee(){try{return C.activeElement}catch(e){}}function Se(e,t,n,r,i,o){var a,s;if(\"object\"===_typeof(t)){for(s in\"string\"!=typeof n&&(r=r||n,n=void 0),t)Se(e,s,n,r,t[s],o);return e}if(null==r&&null==i?(i=n,r=n=void 0):null==i&&(\"string\"==typeof n?(i=r,r=void 0):(i=r,r=n,n=void 0)),!1===i)i=Ce;else if(!i)return e;return 1===o&&(a=i,(i=function(e){return E().off(e),a.apply(this,arguments)}).guid=a.guid||(a.guid=E.guid++)),e.each(function(){E.event.add(this,t,i,r,n)})}E.event={global:{},add:function(t,e,n,r,i){var o,a,s,u,c,l,f,p,d,h,v,g=Q.get(t);if(g)for(n.handler&&(n=(o=n).handler,i=o.selector),i&&E.find.matchesSelector(be,i),n.guid||(n.guid=E.guid++),(u=g.events)||(u=g.events={}),(a=g.handle)||(a=g.handle=function(e){return void 0!==E&&E.event.triggered!==e.type?E.event.dispatch.apply(t,arguments):void 0}),c=(e=(e||\"\").match(P)||[\"\"]).length;c--;)d=v=(s=Te.exec(e[c])||[])[1],h=(s[2]||\"\").split(\".\").sort(),d&&(f=E.event.special[d]||{},d=(i?f.delegateType:f.bindType)||d,f=E.event.special[d]||{},l=E.extend({type:d,origType:v,data:r,handler:n,guid:n.guid,selector:i,needsContext:i&&E.expr.match.needsContext.test(i),namespace:h.join(\".\")},o),(p=u[d])||((p=u[d]=[]).delegateCount=0,f.setup&&!1!==f.setup.call(t,r,h,a)||t.addEventListener&&t.addEventListener(d,a)),f.add&&(f.add.call(t,l),l.handler.guid||(l.handler.guid=n.guid)),i?p.splice(p.delegateCount++,0,l):p.push(l),E.event.global[d]=!0)},remove:function(e,t,n,r,i){var o,a,s,u,c,l,f,p,d,h,v,g=Q.hasData(e)&&Q.get(e);if(g&&(u=g.events)){for(c=(t=(t||\"\").match(P)||[\"\"]).length;c--;)if(d=v=(s=Te.exec(t[c])||[])[1],h=(s[2]||\"\").split(\".\").sort(),d){for(f=E.event.special[d]||{},p=u[d=(r?f.delegateType:f.bindType)||d]||[],s=s[2]&&new RegExp(\"(^|\\\\.)\"+h.join(\"\\\\.(?:.*\\\\.|)\")+\"(\\\\.|$)\"),a=o=p.length;o--;)l=p[o],!i&&v!==l.origType||n&&n.guid!==l.guid||s&&!s.test(l.namespace)||r&&r!==l.selector&&(\"**\"!==r||!l.selector)||(p.splice(o,1),l.selector&&p.delegateCount--,f.remove&&f.remove.call(e,l));a&&!p.length&&(f.teardown&&!1!==f.teardown.call(e,h,g.handle)||E.removeEvent(e,d,g.handle),delete u[d])}else for(d in u)E.event.remove(e,d+t[c],n,r,!0);E.isEmptyObject(u)&&Q.remove(e,\"handle events\")}},dispatch:function(e){var t,n,r,i,o,a,s=E.event.fix(e),u=new Array(arguments.length),c=(Q.get(this,\"events\")||{})[s.type]||[],l=E.event.special[s.type]||{};for(u[0]=s,t=1;t<arguments.length;t++)u[t]=arguments[t];if(s.delegateTarget=this,!l.preDispatch||!1!==l.preDispatch.call(this,s)){for(a=E.event.handlers.call(this,s,c),t=0;(i=a[t++])&&!s.isPropagationStopped();)for(s.currentTarget=i.elem,n=0;(o=i.handlers[n++])&&!s.isImmediatePropagationStopped();)s.rnamespace&&!s.rnamespace.test(o.namespace)||(s.handleObj=o,s.data=o.data,void 0!==(r=((E.event.special[o.origType]||{}).handle||o.handler).apply(i.elem,u))&&!1===(s.result=r)&&(s.preventDefault(),s.stopPropagation()));return l.postDispatch&&l.postDispatch.call(this,s),s.result}},handlers:function(e,t){var n,r,i,o,a,s=[],u=t.delegateCount,c=e.target;if(u&&c.nodeType&&!(\"click\"===e.type&&1<=e.button))for(;c!==this;c=c.parentNode||this)if(1===c.nodeType&&(\"click\"!==e.type||!0!==c.disabled)){for(o=[],a={},n=0;n<u;n++)void 0===a[i=(r=t[n]).selector+\" \"]&&(a[i]=r.needsContext?-1<E(i,this).index(c):E.find(i,this,null,[c]).length),a[i]&&o.push(r);o.length&&s.push({elem:c,handlers:o})}return c=this,u<t.length&&s.push({elem:c,handlers:t.slice(u)}),s},addProp:function(t,e){Object.defineProperty(E.Event.prototype,t,{enumerable:!0,configurable:!0,get:y(e)?function(){if(this.originalEvent)return e(this.originalEvent)}:function(){if(this.originalEvent)return this.originalEvent[t]},set:function(e){Object.defineProperty(this,t,{enumerable:!0,configurable:!0,writable:!0,value:e})}})},fix:function(e){return e[E.expando]?e:new E.Event(e)},special:{load:{noBubble:!0},focus:{trigger:function(){if(this!==Ee()&&this.focus)return this.focus(),!1},delegateType:\"focusin\"},blur:{trigger:function(){if(this===Ee()&&this.blur)return this.blur(),!1},delegateType:\"focusout\"},click:{trigger:function(){if(\"checkbox\"===this.type&&this.click&&D(this,\"input\"))return this.click(),!1},_default:function(e){return D(e.target,\"a\")}},beforeunload:{postDispatch:function(e){void 0!==e.result&&e.originalEvent&&(e.originalEvent.returnValue=e.result)}}}},E.removeEvent=function(e,t,n){e.removeEventListener&&e.removeEventListener(t,n)},E.Event=function(e,t){if(!(this instanceof E.Event))return new E.Event(e,t);e&&e.type?(this.originalEvent=e,this.type=e.type,this.isDefaultPrevented=e.defaultPrevented||void 0===e.defaultPrevented&&!1===e.returnValue?ke:Ce,this.target=e.target&&3===e.target.nodeType?e.target.parentNode:e.target,this.currentTarget=e.currentTarget,this.relatedTarget=e.relatedTarget):this.type=e,t&&E.extend(this,t),this.timeStamp=e&&e.timeStamp||Date.now(),this[E.expando]=!0},E.Event.prototype={constructor:E.Event,isDefaultPrevented:Ce,isPropagationStopped:Ce,isImmediatePropagationStopped:Ce,isSimulated:!1,preventDefault:function(){var e=this.originalEvent;this.isDefaultPrevented=ke,e&&!this.isSimulated&&e.preventDefault()},stopPropagation:function(){var e=this.originalEvent;this.isPropagationStopped=ke,e&&!this.isSimulated&&e.stopPropagation()},stopImmediatePropagation:function(){var e=this.originalEvent;this.isImmediatePropagationStopped=ke,e&&!this.isSimulated&&e.stopImmediatePropagation(),this.stopPropagation()}},E.each({altKey:!0,bubbles:!0,cancelable:!0,changedTouches:!0,ctrlKey:!0,detail:!0,eventPhase:!0,metaKey:!0,pageX:!0,pageY:!0,shiftKey:!0,view:!0,char:!0,charCode:!0,key:!0,keyCode:!0,button:!0,buttons:!0,clientX:!0,clientY:!0,offsetX:!0,offsetY:!0,pointerId:!0,pointerType:!0,screenX:!0,screenY:!0,targetTouches:!0,toElement:!0,touches:!0,which:function(e){var t=e.button;return null==e.which&&we.test(e.type)?null!=e.charCode?e.charCode:e.keyCode:!e.which&&void 0!==t&&xe.test(e.type)?1&t?1:2&t?3:4&t?2:0:e.which}},E.event.addProp),E.each({mouseenter:\"mouseover\",mouseleave:\"mouseout\",pointerenter:\"pointerover\",pointerleave:\"pointerout\"},function(e,i){E.event.special[e]={delegateType:i,bindType:i,handle:function(e){var t,n=e.relatedTarget,r=e.handleObj;return n&&(n===this||E.contains(this,n))||(e.type=r.origType,t=r.handler.apply(this,arguments),e.type=i),t}}}),E.fn.extend({on:function(e,t,n,r){return Se(this,e,t,n,r)},one:function(e,t,n,r){return Se(this,e,t,n,r,1)},off:function(e,t,n){var r,i;if(e&&e.preventDefault&&e.handleObj)return r=e.handleObj,E(e.delegateTarget).off(r.namespace?r.origType+\".\"+r.namespace:r.origType,r.selector,r.handler),this;if(\"object\"!==_typeof(e))return!1!==t&&\"function\"!=typeof t||(n=t,t=void 0),!1===n&&(n=Ce),this.each(function(){E.event.remove(this,e,n,t)});for(i in e)this.off(i,t,e[i]);return this}});var Ne=/<(?!area|br|col|embed|hr|img|input|link|meta|param)(([a-z][^\\/\\0>\\x20\\t\\r\\n\\f]*)[^>]*)\\/>/gi,De=/<script|<style|<link/i,Ae=/checked\\s*(?:[^=]|=\\s*.checked.)/i,Oe=/^\\s*<!(?:\\[CDATA\\[|--)|(?:\\]\\]|--)>\\s*$/g;function je(e,t){return D(e,\"table\")&&D(11!==t.nodeType?t:t.firstChild,\"tr\")&&E(e).children(\"tbody\")[0]||e}function _e(e){return e.type=(null!==e.getAttribute(\"type\"))+\"/\"+e.type,e}function qe(e){return\"true/\"===(e.type||\"\").slice(0,5)?e.type=e.type.slice(5):e.removeAttribute(\"type\"),e}function Le(e,t){var n,r,i,o,a,s,u,c;if(1===t.nodeType){if(Q.hasData(e)&&(o=Q.access(e),a=Q.set(t,o),c=o.events))for(i in delete a.handle,a.events={},c)for(n=0,r=c[i].length;n<r;n++)E.event.add(t,i,c[i][n]);Y.hasData(e)&&(s=Y.access(e),u=E.extend({},s),Y.set(t,u))}}function Me(n,r,i,o){r=v.apply([],r);var e,t,a,s,u,c,l=0,f=n.length,p=f-1,d=r[0],h=y(d);if(h||1<f&&\"string\"==typeof d&&!m.checkClone&&Ae.test(d))return n.each(function(e){var t=n.eq(e);h&&(r[0]=d.call(this,e,t.html())),Me(t,r,i,o)});if(f&&(t=(e=ye(r,n[0].ownerDocument,!1,n,o)).firstChild,1===e.childNodes.length&&(e=t),t||o)){for(s=(a=E.map(de(e,\"script\"),_e)).length;l<f;l++)u=e,l!==p&&(u=E.clone(u,!0,!0),s&&E.merge(a,de(u,\"script\"))),i.call(n[l],u,l);if(s)for(c=a[a.length-1].ownerDocument,E.map(a,qe),l=0;l<s;l++)u=a[l],fe.test(u.type||\"\")&&!Q.access(u,\"globalEval\")&&E.contains(c,u)&&(u.src&&\"module\"!==(u.type||\"\").toLowerCase()?E._evalUrl&&E._evalUrl(u.src):w(u.textContent.replace(Oe,\"\"),c,u))}return n}function Pe(e,t,n){for(var r,i=t?E.filter(t,e):e,o=0;null!=(r=i[o]);o++)n||1!==r.nodeType||E.cleanData(de(r)),r.parentNode&&(n&&E.contains(r.ownerDocument,r)&&he(de(r,\"script\")),r.parentNode.removeChild(r));return e}E.extend({htmlPrefilter:function(e){return e.replace(Ne,\"<$1></$2>\")},clone:function(e,t,n){var r,i,o,a,s,u,c,l=e.cloneNode(!0),f=E.contains(e.ownerDocument,e);if(!(m.noCloneChecked||1!==e.nodeType&&11!==e.nodeType||E.isXMLDoc(e)))for(a=de(l),r=0,i=(o=de(e)).length;r<i;r++)s=o[r],u=a[r],void 0,\"input\"===(c=u.nodeName.toLowerCase())&&ce.test(s.type)?u.checked=s.checked:\"input\"!==c&&\"textarea\"!==c||(u.defaultValue=s.defaultValue);if(t)if(n)for(o=o||de(e),a=a||de(l),r=0,i=o.length;r<i;r++)Le(o[r],a[r]);else Le(e,l);return 0<(a=de(l,\"script\")).length&&he(a,!f&&de(e,\"script\")),l},cleanData:function(e){for(var t,n,r,i=E.event.special,o=0;void 0!==(n=e[o]);o++)if(X(n)){if(t=n[Q.expando]){if(t.events)for(r in t.events)i[r]?E.event.remove(n,r):E.removeEvent(n,r,t.handle);n[Q.expando]=void 0}n[Y.expando]&&(n[Y.expando]=void 0)}}}),E.fn.extend({detach:function(e){return Pe(this,e,!0)},remove:function(e){return Pe(this,e)},text:function(e){return W(this,function(e){return void 0===e?E.text(this):this.empty().each(function(){1!==this.nodeType&&11!==this.nodeType&&9!==this.nodeType||(this.textContent=e)})},null,e,arguments.length)},append:function(){return Me(this,arguments,function(e){1!==this.nodeType&&11!==this.nodeType&&9!==this.nodeType||je(this,e).appendChild(e)})},prepend:function(){return Me(this,arguments,function(e){if(1===this.nodeType||11===this.nodeType||9===this.nodeType){var t=je(this,e);t.insertBefore(e,t.firstChild)}})},before:function(){return Me(this,arguments,function(e){this.parentNode&&this.parentNode.insertBefore(e,this)})},after:function(){return Me(this,arguments,function(e){this.parentNode&&this.parentNode.insertBefore(e,this.nextSibling)})},empty:function(){for(var e,t=0;null!=(e=this[t]);t++)1===e.nodeType&&(E.cleanData(de(e,!1)),e.textContent=\"\");return this},clone:function(e,t){return e=null!=e&&e,t=null==t?e:t,this.map(function(){return E.clone(this,e,t)})},html:function(e){return W(this,function(e){var t=this[0]||{},n=0,r=this.length;if(void 0===e&&1===t.nodeType)return t.innerHTML;if(\"string\"==typeof e&&!De.test(e)&&!pe[(le.exec(e)||[\"\",\"\"])[1].toLowerCase()]){e=E.htmlPrefilter(e);try{for(;n<r;n++)1===(t=this[n]||{}).nodeType&&(E.cleanData(de(t,!1)),t.innerHTML=e);t=0}catch(e){}}t&&this.empty().append(e)},null,e,arguments.length)},replaceWith:function(){var n=[];return Me(this,arguments,function(e){var t=this.parentNode;E.inArray(this,n)<0&&(E.cleanData(de(this)),t&&t.replaceChild(e,this))},n)}}),E.each({appendTo:\"append\",prependTo:\"prepend\",insertBefore:\"before\",insertAfter:\"after\",replaceAll:\"replaceWith\"},function(e,a){E.fn[e]=function(e){for(var t,n=[],r=E(e),i=r.length-1,o=0;o<=i;o++)t=o===i?this:this.clone(!0),E(r[o])[a](t),u.apply(n,t.get());return this.pushStack(n)}});var Be=new RegExp(\"^(\"+te+\")(?!px)[a-z%]+$\",\"i\"),He=function(e){var t=e.ownerDocument.defaultView;return t&&t.opener||(t=k),t.getComputedStyle(e)},Re=new RegExp(re.join(\"|\"),\"i\");function Ie(e,t,n){var r,i,o,a,s=e.style;return(n=n||He(e))&&(\"\"!==(a=n.getPropertyValue(t)||n[t])||E.contains(e.ownerDocument,e)||(a=E.style(e,t)),!m.pixelBoxStyles()&&Be.test(a)&&Re.test(t)&&(r=s.width,i=s.minWidth,o=s.maxWidth,s.minWidth=s.maxWidth=s.width=a,a=n.width,s.width=r,s.minWidth=i,s.maxWidth=o)),void 0!==a?a+\"\":a}function $e(e,t){return{get:function(){if(!e())return(this.get=t).apply(this,arguments);delete this.get}}}!function(){function e(){if(u){s.style.cssText=\"position:absolute;left:-11111px;width:60px;margin-top:1px;padding:0;border:0\",u.style.cssText=\"position:relative;display:block;box-sizing:border-box;overflow:scroll;margin:auto;border:1px;padding:1px;width:60%;top:1%\",be.appendChild(s).appendChild(u);var e=k.getComputedStyle(u);n=\"1%\"!==e.top,a=12===t(e.marginLeft),u.style.right=\"60%\",o=36===t(e.right),r=36===t(e.width),u.style.position=\"absolute\",i=36===u.offsetWidth||\"absolute\",be.removeChild(s),u=null}}function t(e){return Math.round(parseFloat(e))}var n,r,i,o,a,s=C.createElement(\"div\"),u=C.createElement(\"div\");u.style&&(u.style.backgroundClip=\"content-box\",u.cloneNode(!0).style.backgroundClip=\"\",m.clearCloneStyle=\"content-box\"===u.style.backgroundClip,E.extend(m,{boxSizingReliable:function(){return e(),r},pixelBoxStyles:function(){return e(),o},pixelPosition:function(){return e(),n},reliableMarginLeft:function(){return e(),a},scrollboxSize:function(){return e(),i}}))}();var Fe=/^(none|table(?!-c[ea]).+)/,We=/^--/,Ve={position:\"absolute\",visibility:\"hidden\",display:\"block\"},Ue={letterSpacing:\"0\",fontWeight:\"400\"},Je=[\"Webkit\",\"Moz\",\"ms\"],ze=C.createElement(\"div\").style;function Xe(e){var t=E.cssProps[e];return t||(t=E.cssProps[e]=function(e){if(e in ze)return e;for(var t=e[0].toUpperCase()+e.slice(1),n=Je.length;n--;)if((e=Je[n]+t)in ze)return e}(e)||e),t}function Ge(e,t,n){var r=ne.exec(t);return r?Math.max(0,r[2]-(n||0))+(r[3]||\"px\"):t}function Qe(e,t,n,r,i,o){var a=\"width\"===t?1:0,s=0,u=0;if(n===(r?\"border\":\"content\"))return 0;for(;a<4;a+=2)\"margin\"===n&&(u+=E.css(e,n+re[a],!0,i)),r?(\"content\"===n&&(u-=E.css(e,\"padding\"+re[a],!0,i)),\"margin\"!==n&&(u-=E.css(e,\"border\"+re[a]+\"Width\",!0,i))):(u+=E.css(e,\"padding\"+re[a],!0,i),\"padding\"!==n?u+=E.css(e,\"border\"+re[a]+\"Width\",!0,i):s+=E.css(e,\"border\"+re[a]+\"Width\",!0,i));return!r&&0<=o&&(u+=Math.max(0,Math.ceil(e[\"offset\"+t[0].toUpperCase()+t.slice(1)]-o-u-s-.5))),u}function Ye(e,t,n){var r=He(e),i=Ie(e,t,r),o=\"border-box\"===E.css(e,\"boxSizing\",!1,r),a=o;if(Be.test(i)){if(!n)return i;i=\"auto\"}return a=a&&(m.boxSizingReliable()||i===e.style[t]),(\"auto\"===i||!parseFloat(i)&&\"inline\"===E.css(e,\"display\",!1,r))&&(i=e[\"offset\"+t[0].toUpperCase()+t.slice(1)],a=!0),(i=parseFloat(i)||0)+Qe(e,t,n||(o?\"border\":\"content\"),a,r,i)+\"px\"}function Ke(e,t,n,r,i){return new Ke.prototype.init(e,t,n,r,i)}E.extend({cssHooks:{opacity:{get:function(e,t){if(t){var n=Ie(e,\"opacity\");return\"\"===n?\"1\":n}}}},cssNumber:{animationIterationCount:!0,columnCount:!0,fillOpacity:!0,flexGrow:!0,flexShrink:!0,fontWeight:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,widows:!0,zIndex:!0,zoom:!0},cssProps:{},style:function(e,t,n,r){if(e&&3!==e.nodeType&&8!==e.nodeType&&e.style){var i,o,a,s=z(t),u=We.test(t),c=e.style;if(u||(t=Xe(s)),a=E.cssHooks[t]||E.cssHooks[s],void 0===n)return a&&\"get\"in a&&void 0!==(i=a.get(e,!1,r))?i:c[t];\"string\"===(o=_typeof(n))&&(i=ne.exec(n))&&i[1]&&(n=ae(e,t,i),o=\"number\"),null!=n&&n==n&&(\"number\"===o&&(n+=i&&i[3]||(E.cssNumber[s]?\"\":\"px\")),m.clearCloneStyle||\"\"!==n||0!==t.indexOf(\"background\")||(c[t]=\"inherit\"),a&&\"set\"in a&&void 0===(n=a.set(e,n,r))||(u?c.setProperty(t,n):c[t]=n))}},css:function(e,t,n,r){var i,o,a,s=z(t);return We.test(t)||(t=Xe(s)),(a=E.cssHooks[t]||E.cssHooks[s])&&\"get\"in a&&(i=a.get(e,!0,n)),void 0===i&&(i=Ie(e,t,r)),\"normal\"===i&&t in Ue&&(i=Ue[t]),\"\"===n||n?(o=parseFloat(i),!0===n||isFinite(o)?o||0:i):i}}),E.each([\"height\",\"width\"],function(e,s){E.cssHooks[s]={get:function(e,t,n){if(t)return!Fe.test(E.css(e,\"display\"))||e.getClientRects().length&&e.getBoundingClientRect().width?Ye(e,s,n):oe(e,Ve,function(){return Ye(e,s,n)})},set:function(e,t,n){var r,i=He(e),o=\"border-box\"===E.css(e,\"boxSizing\",!1,i),a=n&&Qe(e,s,n,o,i);return o&&m.scrollboxSize()===i.position&&(a-=Math.ceil(e[\"offset\"+s[0].toUpperCase()+s.slice(1)]-parseFloat(i[s])-Qe(e,s,\"border\",!1,i)-.5)),a&&(r=ne.exec(t))&&\"px\"!==(r[3]||\"px\")&&(e.style[s]=t,t=E.css(e,s)),Ge(0,t,a)}}}),E.cssHooks.marginLeft=$e(m.reliableMarginLeft,function(e,t){if(t)return(parseFloat(Ie(e,\"marginLeft\"))||e.getBoundingClientRect().left-oe(e,{marginLeft:0},function(){return e.getBoundingClientRect().left}))+\"px\"}),E.each({margin:\"\",padding:\"\",border:\"Width\"},function(i,o){E.cssHooks[i+o]={expand:function(e){for(var t=0,n={},r=\"string\"==typeof e?e.split(\" \"):[e];t<4;t++)n[i+re[t]+o]=r[t]||r[t-2]||r[0];return n}},\"margin\"!==i&&(E.cssHooks[i+o].set=Ge)}),E.fn.extend({css:function(e,t){return W(this,function(e,t,n){var r,i,o={},a=0;if(Array.isArray(t)){for(r=He(e),i=t.length;a<i;a++)o[t[a]]=E.css(e,t[a],!1,r);return o}return void 0!==n?E.style(e,t,n):E.css(e,t)},e,t,1<arguments.length)}}),((E.Tween=Ke).prototype={constructor:Ke,init:function(e,t,n,r,i,o){this.elem=e,this.prop=n,this.easing=i||E.easing._default,this.options=t,this.start=this.now=this.cur(),this.end=r,this.unit=o||(E.cssNumber[n]?\"\":\"px\")},cur:function(){var e=Ke.propHooks[this.prop];return e&&e.get?e.get(this):Ke.propHooks._default.get(this)},run:function(e){var t,n=Ke.propHooks[this.prop];return this.options.duration?this.pos=t=E.easing[this.easing](e,this.options.duration*e,0,1,this.options.duration):this.pos=t=e,this.now=(this.end-this.start)*t+this.start,this.options.step&&this.options.step.call(this.elem,this.now,this),n&&n.set?n.set(this):Ke.propHooks._default.set(this),this}}).init.prototype=Ke.prototype,(Ke.propHooks={_default:{get:function(e){var t;return 1!==e.elem.nodeType||null!=e.elem[e.prop]&&null==e.elem.style[e.prop]?e.elem[e.prop]:(t=E.css(e.elem,e.prop,\"\"))&&\"auto\"!==t?t:0},set:function(e){E.fx.step[e.prop]?E.fx.step[e.prop](e):1!==e.elem.nodeType||null==e.elem.style[E.cssProps[e.prop]]&&!E.cssHooks[e.prop]?e.elem[e.prop]=e.now:E.style(e.elem,e.prop,e.now+e.unit)}}}).scrollTop=Ke.propHooks.scrollLeft={set:function(e){e.elem.nodeType&&e.elem.parentNode&&(e.elem[e.prop]=e.now)}},E.easing={linear:function(e){return e},swing:function(e){return.5-Math.cos(e*Math.PI)/2},_default:\"swing\"},E.fx=Ke.prototype.init,E.fx.step={};var Ze,et,tt,nt,rt=/^(?:toggle|show|hide)$/,it=/queueHooks$/;function ot(){et&&(!1===C.hidden&&k.requestAnimationFrame?k.requestAnimationFrame(ot):k.setTimeout(ot,E.fx.interval),E.fx.tick())}function at(){return k.setTimeout(function(){Ze=void 0}),Ze=Date.now()}function st(e,t){var n,r=0,i={height:e};for(t=t?1:0;r<4;r+=2-t)i[\"margin\"+(n=re[r])]=i[\"padding\"+n]=e;return t&&(i.opacity=i.width=e),i}function ut(e,t,n){for(var r,i=(ct.tweeners[t]||[]).concat(ct.tweeners[\"*\"]),o=0,a=i.length;o<a;o++)if(r=i[o].call(n,t,e))return r}function ct(o,e,t){var n,a,r=0,i=ct.prefilters.length,s=E.Deferred().always(function(){delete u.elem}),u=function(){if(a)return!1;for(var e=Ze||at(),t=Math.max(0,c.startTime+c.duration-e),n=1-(t/c.duration||0),r=0,i=c.tweens.length;r<i;r++)c.tweens[r].run(n);return s.notifyWith(o,[c,n,t]),n<1&&i?t:(i||s.notifyWith(o,[c,1,0]),s.resolveWith(o,[c]),!1)},c=s.promise({elem:o,props:E.extend({},e),opts:E.extend(!0,{specialEasing:{},easing:E.easing._default},t),originalProperties:e,originalOptions:t,startTime:Ze||at(),duration:t.duration,tweens:[],createTween:function(e,t){var n=E.Tween(o,c.opts,e,t,c.opts.specialEasing[e]||c.opts.easing);return c.tweens.push(n),n},stop:function(e){var t=0,n=e?c.tweens.length:0;if(a)return this;for(a=!0;t<n;t++)c.tweens[t].run(1);return e?(s.notifyWith(o,[c,1,0]),s.resolveWith(o,[c,e])):s.rejectWith(o,[c,e]),this}}),l=c.props;for(!function(e,t){var n,r,i,o,a;for(n in e)if(i=t[r=z(n)],o=e[n],Array.isArray(o)&&(i=o[1],o=e[n]=o[0]),n!==r&&(e[r]=o,delete e[n]),(a=E.cssHooks[r])&&\"expand\"in a)for(n in o=a.expand(o),delete e[r],o)n in e||(e[n]=o[n],t[n]=i);else t[r]=i}(l,c.opts.specialEasing);r<i;r++)if(n=ct.prefilters[r].call(c,o,l,c.opts))return y(n.stop)&&(E._queueHooks(c.elem,c.opts.queue).stop=n.stop.bind(n)),n;return E.map(l,ut,c),y(c.opts.start)&&c.opts.start.call(o,c),c.progress(c.opts.progress).done(c.opts.done,c.opts.complete).fail(c.opts.fail).always(c.opts.always),E.fx.timer(E.extend(u,{elem:o,anim:c,queue:c.opts.queue})),c}E.Animation=E.extend(ct,{tweeners:{\"*\":[function(e,t){var n=this.createTween(e,t);return ae(n.elem,e,ne.exec(t),n),n}]},tweener:function(e,t){for(var n,r=0,i=(e=y(e)?(t=e,[\"*\"]):e.match(P)).length;r<i;r++)n=e[r],ct.tweeners[n]=ct.tweeners[n]||[],ct.tweeners[n].unshift(t)},prefilters:[function(e,t,n){var r,i,o,a,s,u,c,l,f=\"width\"in t||\"height\"in t,p=this,d={},h=e.style,v=e.nodeType&&ie(e),g=Q.get(e,\"fxshow\");for(r in n.queue||(null==(a=E._queueHooks(e,\"fx\")).unqueued&&(a.unqueued=0,s=a.empty.fire,a.empty.fire=function(){a.unqueued||s()}),a.unqueued++,p.always(function(){p.always(function(){a.unqueued--,E.queue(e,\"fx\").length||a.empty.fire()})})),t)if(i=t[r],rt.test(i)){if(delete t[r],o=o||\"toggle\"===i,i===(v?\"hide\":\"show\")){if(\"show\"!==i||!g||void 0===g[r])continue;v=!0}d[r]=g&&g[r]||E.style(e,r)}if((u=!E.isEmptyObject(t))||!E.isEmptyObject(d))for(r in f&&1===e.nodeType&&(n.overflow=[h.overflow,h.overflowX,h.overflowY],null==(c=g&&g.display)&&(c=Q.get(e,\"display\")),\"none\"===(l=E.css(e,\"display\"))&&(c?l=c:(ue([e],!0),c=e.style.display||c,l=E.css(e,\"display\"),ue([e]))),(\"inline\"===l||\"inline-block\"===l&&null!=c)&&\"none\"===E.css(e,\"float\")&&(u||(p.done(function(){h.display=c}),null==c&&(l=h.display,c=\"none\"===l?\"\":l)),h.display=\"inline-block\")),n.overflow&&(h.overflow=\"hidden\",p.always(function(){h.overflow=n.overflow[0],h.overflowX=n.overflow[1],h.overflowY=n.overflow[2]})),u=!1,d)u||(g?\"hidden\"in g&&(v=g.hidden):g=Q.access(e,\"fxshow\",{display:c}),o&&(g.hidden=!v),v&&ue([e],!0),p.done(function(){for(r in v||ue([e]),Q.remove(e,\"fxshow\"),d)E.style(e,r,d[r])})),u=ut(v?g[r]:0,r,p),r in g||(g[r]=u.start,v&&(u.end=u.start,u.start=0))}],prefilter:function(e,t){t?ct.prefilters.unshift(e):ct.prefilters.push(e)}}),E.speed=function(e,t,n){var r=e&&\"object\"===_typeof(e)?E.extend({},e):{complete:n||!n&&t||y(e)&&e,duration:e,easing:n&&t||t&&!y(t)&&t};return E.fx.off?r.duration=0:\"number\"!=typeof r.duration&&(r.duration in E.fx.speeds?r.duration=E.fx.speeds[r.duration]:r.duration=E.fx.speeds._default),null!=r.queue&&!0!==r.queue||(r.queue=\"fx\"),r.old=r.complete,r.complete=function(){y(r.old)&&r.old.call(this),r.queue&&E.dequeue(this,r.queue)},r},E.fn.extend({fadeTo:function(e,t,n,r){return this.filter(ie).css(\"opacity\",0).show().end().animate({opacity:t},e,n,r)},animate:function(t,e,n,r){var i=E.isEmptyObject(t),o=E.speed(e,n,r),a=function(){var e=ct(this,E.extend({},t),o);(i||Q.get(this,\"finish\"))&&e.stop(!0)};return a.finish=a,i||!1===o.queue?this.each(a):this.queue(o.queue,a)},stop:function(i,e,o){var a=function(e){var t=e.stop;delete e.stop,t(o)};return\"string\"!=typeof i&&(o=e,e=i,i=void 0),e&&!1!==i&&this.queue(i||\"fx\",[]),this.each(function(){var e=!0,t=null!=i&&i+\"queueHooks\",n=E.timers,r=Q.get(this);if(t)r[t]&&r[t].stop&&a(r[t]);else for(t in r)r[t]&&r[t].stop&&it.test(t)&&a(r[t]);for(t=n.length;t--;)n[t].elem!==this||null!=i&&n[t].queue!==i||(n[t].anim.stop(o),e=!1,n.splice(t,1));!e&&o||E.dequeue(this,i)})},finish:function(a){return!1!==a&&(a=a||\"fx\"),this.each(function(){var e,t=Q.get(this),n=t[a+\"queue\"],r=t[a+\"queueHooks\"],i=E.timers,o=n?n.length:0;for(t.finish=!0,E.queue(this,a,[]),r&&r.stop&&r.stop.call(this,!0),e=i.length;e--;)i[e].elem===this&&i[e].queue===a&&(i[e].anim.stop(!0),i.splice(e,1));for(e=0;e<o;e++)n[e]&&n[e].finish&&n[e].finish.call(this);delete t.finish})}}),E.each([\"toggle\",\"show\",\"hide\"],function(e,r){var i=E.fn[r];E.fn[r]=function(e,t,n){return null==e||\"boolean\"==typeof e?i.apply(this,arguments):this.animate(st(r,!0),e,t,n)}}),E.each({slideDown:st(\"show\"),slideUp:st(\"hide\"),slideToggle:st(\"toggle\"),fadeIn:{opacity:\"show\"},fadeOut:{opacity:\"hide\"},fadeToggle:{opacity:\"toggle\"}},function(e,r){E.fn[e]=function(e,t,n){return this.animate(r,e,t,n)}}),E.timers=[],E.fx.tick=function(){var e,t=0,n=E.timers;for(Ze=Date.now();t<n.length;t++)(e=n[t])()||n[t]!==e||n.splice(t--,1);n.length||E.fx.stop(),Ze=void 0},E.fx.timer=function(e){E.timers.push(e),E.fx.start()},E.fx.interval=13,E.fx.start=function(){et||(et=!0,ot())},E.fx.stop=function(){et=null},E.fx.speeds={slow:600,fast:200,_default:400},E.fn.delay=function(r,e){return r=E.fx&&E.fx.speeds[r]||r,e=e||\"fx\",this.queue(e,function(e,t){var n=k.setTimeout(e,r);t.stop=function(){k.clearTimeout(n)}})},tt=C.createElement(\"input\"),nt=C.createElement(\"select\").appendChild(C.createElement(\"option\")),tt.type=\"checkbox\",m.checkOn=\"\"!==tt.value,m.optSelected=nt.selected,(tt=C.createElement(\"input\")).value=\"t\",tt.type=\"radio\",m.radioValue=\"t\"===tt.value;var lt,ft=E.expr.attrHandle;E.fn.extend({attr:function(e,t){return W(this,E.attr,e,t,1<arguments.length)},removeAttr:function(e){return this.each(function(){E.removeAttr(this,e)})}}),E.extend({attr:function(e,t,n){var r,i,o=e.nodeType;if(3!==o&&8!==o&&2!==o)return void 0===e.getAttribute?E.prop(e,t,n):(1===o&&E.isXMLDoc(e)||(i=E.attrHooks[t.toLowerCase()]||(E.expr.match.bool.test(t)?lt:void 0)),void 0!==n?null===n?void E.removeAttr(e,t):i&&\"set\"in i&&void 0!==(r=i.set(e,n,t))?r:(e.setAttribute(t,n+\"\"),n):i&&\"get\"in i&&null!==(r=i.get(e,t))?r:null==(r=E.find.attr(e,t))?void 0:r)},attrHooks:{type:{set:function(e,t){if(!m.radioValue&&\"radio\"===t&&D(e,\"input\")){var n=e.value;return e.setAttribute(\"type\",t),n&&(e.value=n),t}}}},removeAttr:function(e,t){var n,r=0,i=t&&t.match(P);if(i&&1===e.nodeType)for(;n=i[r++];)e.removeAttribute(n)}}),lt={set:function(e,t,n){return!1===t?E.removeAttr(e,n):e.setAttribute(n,n),n}},E.each(E.expr.match.bool.source.match(/\\w+/g),function(e,t){var a=ft[t]||E.find.attr;ft[t]=function(e,t,n){var r,i,o=t.toLowerCase();return n||(i=ft[o],ft[o]=r,r=null!=a(e,t,n)?o:null,ft[o]=i),r}});var pt=/^(?:input|select|textarea|button)$/i,dt=/^(?:a|area)$/i;function ht(e){return(e.match(P)||[]).join(\" \")}function vt(e){return e.getAttribute&&e.getAttribute(\"class\")||\"\"}function gt(e){return Array.isArray(e)?e:\"string\"==typeof e&&e.match(P)||[]}E.fn.extend({prop:function(e,t){return W(this,E.prop,e,t,1<arguments.length)},removeProp:function(e){return this.each(function(){delete this[E.propFix[e]||e]})}}),E.extend({prop:function(e,t,n){var r,i,o=e.nodeType;if(3!==o&&8!==o&&2!==o)return 1===o&&E.isXMLDoc(e)||(t=E.propFix[t]||t,i=E.propHooks[t]),void 0!==n?i&&\"set\"in i&&void 0!==(r=i.set(e,n,t))?r:e[t]=n:i&&\"get\"in i&&null!==(r=i.get(e,t))?r:e[t]},propHooks:{tabIndex:{get:function(e){var t=E.find.attr(e,\"tabindex\");return t?parseInt(t,10):pt.test(e.nodeName)||dt.test(e.nodeName)&&e.href?0:-1}}},propFix:{for:\"htmlFor\",class:\"className\"}}),m.optSelected||(E.propHooks.selected={get:function(e){var t=e.parentNode;return t&&t.parentNode&&t.parentNode.selectedIndex,null},set:function(e){var t=e.parentNode;t&&(t.selectedIndex,t.parentNode&&t.parentNode.selectedIndex)}}),E.each([\"tabIndex\",\"readOnly\",\"maxLength\",\"cellSpacing\",\"cellPadding\",\"rowSpan\",\"colSpan\",\"useMap\",\"frameBorder\",\"contentEditable\"],function(){E.propFix[this.toLowerCase()]=this}),E.fn.extend({addClass:function(t){var e,n,r,i,o,a,s,u=0;if(y(t))return this.each(function(e){E(this).addClass(t.call(this,e,vt(this)))});if((e=gt(t)).length)for(;n=this[u++];)if(i=vt(n),r=1===n.nodeType&&\" \"+ht(i)+\" \"){for(a=0;o=e[a++];)r.indexOf(\" \"+o+\" \")<0&&(r+=o+\" \");i!==(s=ht(r))&&n.setAttribute(\"class\",s)}return this},removeClass:function(t){var e,n,r,i,o,a,s,u=0;if(y(t))return this.each(function(e){E(this).removeClass(t.call(this,e,vt(this)))});if(!arguments.length)return this.attr(\"class\",\"\");if((e=gt(t)).length)for(;n=this[u++];)if(i=vt(n),r=1===n.nodeType&&\" \"+ht(i)+\" \"){for(a=0;o=e[a++];)for(;-1<r.indexOf(\" \"+o+\" \");)r=r.replace(\" \"+o+\" \",\" \");i!==(s=ht(r))&&n.setAttribute(\"class\",s)}return this},toggleClass:function(i,t){var o=_typeof(i),a=\"string\"===o||Array.isArray(i);return\"boolean\"==typeof t&&a?t?this.addClass(i):this.removeClass(i):y(i)?this.each(function(e){E(this).toggleClass(i.call(this,e,vt(this),t),t)}):this.each(function(){var e,t,n,r;if(a)for(t=0,n=E(this),r=gt(i);e=r[t++];)n.hasClass(e)?n.removeClass(e):n.addClass(e);else void 0!==i&&\"boolean\"!==o||((e=vt(this))&&Q.set(this,\"__className__\",e),this.setAttribute&&this.setAttribute(\"class\",e||!1===i?\"\":Q.get(this,\"__className__\")||\"\"))})},hasClass:function(e){var t,n,r=0;for(t=\" \"+e+\" \";n=this[r++];)if(1===n.nodeType&&-1<(\" \"+ht(vt(n))+\" \").indexOf(t))return!0;return!1}});var mt=/\\r/g;E.fn.extend({val:function(n){var r,e,i,t=this[0];return arguments.length?(i=y(n),this.each(function(e){var t;1===this.nodeType&&(null==(t=i?n.call(this,e,E(this).val()):n)?t=\"\":\"number\"==typeof t?t+=\"\":Array.isArray(t)&&(t=E.map(t,function(e){return null==e?\"\":e+\"\"})),(r=E.valHooks[this.type]||E.valHooks[this.nodeName.toLowerCase()])&&\"set\"in r&&void 0!==r.set(this,t,\"value\")||(this.value=t))})):t?(r=E.valHooks[t.type]||E.valHooks[t.nodeName.toLowerCase()])&&\"get\"in r&&void 0!==(e=r.get(t,\"value\"))?e:\"string\"==typeof(e=t.value)?e.replace(mt,\"\"):null==e?\"\":e:void 0}}),E.extend({valHooks:{option:{get:function(e){var t=E.find.attr(e,\"value\");return null!=t?t:ht(E.text(e))}},select:{get:function(e){var t,n,r,i=e.options,o=e.selectedIndex,a=\"select-one\"===e.type,s=a?null:[],u=a?o+1:i.length;for(r=o<0?u:a?o:0;r<u;r++)if(((n=i[r]).selected||r===o)&&!n.disabled&&(!n.parentNode.disabled||!D(n.parentNode,\"optgroup\"))){if(t=E(n).val(),a)return t;s.push(t)}return s},set:function(e,t){for(var n,r,i=e.options,o=E.makeArray(t),a=i.length;a--;)((r=i[a]).selected=-1<E.inArray(E.valHooks.option.get(r),o))&&(n=!0);return n||(e.selectedIndex=-1),o}}}}),E.each([\"radio\",\"checkbox\"],function(){E.valHooks[this]={set:function(e,t){if(Array.isArray(t))return e.checked=-1<E.inArray(E(e).val(),t)}},m.checkOn||(E.valHooks[this].get=function(e){return null===e.getAttribute(\"value\")?\"on\":e.value})}),m.focusin=\"onfocusin\"in k;var yt=/^(?:focusinfocus|focusoutblur)$/,bt=function(e){e.stopPropagation()};E.extend(E.event,{trigger:function(e,t,n,r){var i,o,a,s,u,c,l,f,p=[n||C],d=g.call(e,\"type\")?e.type:e,h=g.call(e,\"namespace\")?e.namespace.split(\".\"):[];if(o=f=a=n=n||C,3!==n.nodeType&&8!==n.nodeType&&!yt.test(d+E.event.triggered)&&(-1<d.indexOf(\".\")&&(d=(h=d.split(\".\")).shift(),h.sort()),u=d.indexOf(\":\")<0&&\"on\"+d,(e=e[E.expando]?e:new E.Event(d,\"object\"===_typeof(e)&&e)).isTrigger=r?2:3,e.namespace=h.join(\".\"),e.rnamespace=e.namespace?new RegExp(\"(^|\\\\.)\"+h.join(\"\\\\.(?:.*\\\\.|)\")+\"(\\\\.|$)\"):null,e.result=void 0,e.target||(e.target=n),t=null==t?[e]:E.makeArray(t,[e]),l=E.event.special[d]||{},r||!l.trigger||!1!==l.trigger.apply(n,t))){if(!r&&!l.noBubble&&!b(n)){for(s=l.delegateType||d,yt.test(s+d)||(o=o.parentNode);o;o=o.parentNode)p.push(o),a=o;a===(n.ownerDocument||C)&&p.push(a.defaultView||a.parentWindow||k)}for(i=0;(o=p[i++])&&!e.isPropagationStopped();)f=o,e.type=1<i?s:l.bindType||d,(c=(Q.get(o,\"events\")||{})[e.type]&&Q.get(o,\"handle\"))&&c.apply(o,t),(c=u&&o[u])&&c.apply&&X(o)&&(e.result=c.apply(o,t),!1===e.result&&e.preventDefault());return e.type=d,r||e.isDefaultPrevented()||l._default&&!1!==l._default.apply(p.pop(),t)||!X(n)||u&&y(n[d])&&!b(n)&&((a=n[u])&&(n[u]=null),E.event.triggered=d,e.isPropagationStopped()&&f.addEventListener(d,bt),n[d](),e.isPropagationStopped()&&f.removeEventListener(d,bt),E.event.triggered=void 0,a&&(n[u]=a)),e.result}},simulate:function(e,t,n){var r=E.extend(new E.Event,n,{type:e,isSimulated:!0});E.event.trigger(r,null,t)}}),E.fn.extend({trigger:function(e,t){return this.each(function(){E.event.trigger(e,t,this)})},triggerHandler:function(e,t){var n=this[0];if(n)return E.event.trigger(e,t,n,!0)}}),m.focusin||E.each({focus:\"focusin\",blur:\"focusout\"},function(n,r){var i=function(e){E.event.simulate(r,e.target,E.event.fix(e))};E.event.special[r]={setup:function(){var e=this.ownerDocument||this,t=Q.access(e,r);t||e.addEventListener(n,i,!0),Q.access(e,r,(t||0)+1)},teardown:function(){var e=this.ownerDocument||this,t=Q.access(e,r)-1;t?Q.access(e,r,t):(e.removeEventListener(n,i,!0),Q.remove(e,r))}}});var wt=k.location,xt=Date.now(),Tt=/\\?/;E.parseXML=function(e){var t;if(!e||\"string\"!=typeof e)return null;try{t=(new k.DOMParser).parseFromString(e,\"text/xml\")}catch(e){t=void 0}return t&&!t.getElementsByTagName(\"parsererror\").length||E.error(\"Invalid XML: \"+e),t};var kt=/\\[\\]$/,Ct=/\\r?\\n/g,Et=/^(?:submit|button|image|reset|file)$/i,St=/^(?:input|select|textarea|keygen)/i;function Nt(n,e,r,i){var t;if(Array.isArray(e))E.each(e,function(e,t){r||kt.test(n)?i(n,t):Nt(n+\"[\"+(\"object\"===_typeof(t)&&null!=t?e:\"\")+\"]\",t,r,i)});else if(r||\"object\"!==x(e))i(n,e);else for(t in e)Nt(n+\"[\"+t+\"]\",e[t],r,i)}E.param=function(e,t){var n,r=[],i=function(e,t){var n=y(t)?t():t;r[r.length]=encodeURIComponent(e)+\"=\"+encodeURIComponent(null==n?\"\":n)};if(Array.isArray(e)||e.jquery&&!E.isPlainObject(e))E.each(e,function(){i(this.name,this.value)});else for(n in e)Nt(n,e[n],t,i);return r.join(\"&\")},E.fn.extend({serialize:function(){return E.param(this.serializeArray())},serializeArray:function(){return this.map(function(){var e=E.prop(this,\"elements\");return e?E.makeArray(e):this}).filter(function(){var e=this.type;return this.name&&!E(this).is(\":disabled\")&&St.test(this.nodeName)&&!Et.test(e)&&(this.checked||!ce.test(e))}).map(function(e,t){var n=E(this).val();return null==n?null:Array.isArray(n)?E.map(n,function(e){return{name:t.name,value:e.replace(Ct,\"\\r\\n\")}}):{name:t.name,value:n.replace(Ct,\"\\r\\n\")}}).get()}});var Dt=/%20/g,At=/#.*$/,Ot=/([?&])_=[^&]*/,jt=/^(.*?):[ \\t]*([^\\r\\n]*)$/gm,_t=/^(?:GET|HEAD)$/,qt=/^\\/\\//,Lt={},Mt={},Pt=\"*/\".concat(\"*\"),Bt=C.createElement(\"a\");function Ht(o){return function(e,t){\"string\"!=typeof e&&(t=e,e=\"*\");var n,r=0,i=e.toLowerCase().match(P)||[];if(y(t))for(;n=i[r++];)\"+\"===n[0]?(n=n.slice(1)||\"*\",(o[n]=o[n]||[]).unshift(t)):(o[n]=o[n]||[]).push(t)}}function Rt(t,i,o,a){var s={},u=t===Mt;function c(e){var r;return s[e]=!0,E.each(t[e]||[],function(e,t){var n=t(i,o,a);return\"string\"!=typeof n||u||s[n]?u?!(r=n):void 0:(i.dataTypes.unshift(n),c(n),!1)}),r}return c(i.dataTypes[0])||!s[\"*\"]&&c(\"*\")}function It(e,t){var n,r,i=E.ajaxSettings.flatOptions||{};for(n in t)void 0!==t[n]&&((i[n]?e:r||(r={}))[n]=t[n]);return r&&E.extend(!0,e,r),e}Bt.href=wt.href,E.extend({active:0,lastModified:{},etag:{},ajaxSettings:{url:wt.href,type:\"GET\",isLocal:/^(?:about|app|app-storage|.+-extension|file|res|widget):$/.test(wt.protocol),global:!0,processData:!0,async:!0,contentType:\"application/x-www-form-urlencoded; charset=UTF-8\",accepts:{\"*\":Pt,text:\"text/plain\",html:\"text/html\",xml:\"application/xml, text/xml\",json:\"application/json, text/javascript\"},contents:{xml:/\\bxml\\b/,html:/\\bhtml/,json:/\\bjson\\b/},responseFields:{xml:\"responseXML\",text:\"responseText\",json:\"responseJSON\"},converters:{\"* text\":String,\"text html\":!0,\"text json\":JSON.parse,\"text xml\":E.parseXML},flatOptions:{url:!0,context:!0}},ajaxSetup:function(e,t){return t?It(It(e,E.ajaxSettings),t):It(E.ajaxSettings,e)},ajaxPrefilter:Ht(Lt),ajaxTransport:Ht(Mt),ajax:function(e,t){\"object\"===_typeof(e)&&(t=e,e=void 0),t=t||{};var l,f,p,n,d,r,h,v,i,o,g=E.ajaxSetup({},t),m=g.context||g,y=g.context&&(m.nodeType||m.jquery)?E(m):E.event,b=E.Deferred(),w=E.Callbacks(\"once memory\"),x=g.statusCode||{},a={},s={},u=\"canceled\",T={readyState:0,getResponseHeader:function(e){var t;if(h){if(!n)for(n={};t=jt.exec(p);)n[t[1].toLowerCase()]=t[2];t=n[e.toLowerCase()]}return null==t?null:t},getAllResponseHeaders:function(){return h?p:null},setRequestHeader:function(e,t){return null==h&&(e=s[e.toLowerCase()]=s[e.toLowerCase()]||e,a[e]=t),this},overrideMimeType:function(e){return null==h&&(g.mimeType=e),this},statusCode:function(e){var t;if(e)if(h)T.always(e[T.status]);else for(t in e)x[t]=[x[t],e[t]];return this},abort:function(e){var t=e||u;return l&&l.abort(t),c(0,t),this}};if(b.promise(T),g.url=((e||g.url||wt.href)+\"\").replace(qt,wt.protocol+\"//\"),g.type=t.method||t.type||g.method||g.type,g.dataTypes=(g.dataType||\"*\").toLowerCase().match(P)||[\"\"],null==g.crossDomain){r=C.createElement(\"a\");try{r.href=g.url,r.href=r.href,g.crossDomain=Bt.protocol+\"//\"+Bt.host!=r.protocol+\"//\"+r.host}catch(e){g.crossDomain=!0}}if(g.data&&g.processData&&\"string\"!=typeof g.data&&(g.data=E.param(g.data,g.traditional)),Rt(Lt,g,t,T),h)return T;for(i in(v=E.event&&g.global)&&0==E.active++&&E.event.trigger(\"ajaxStart\"),g.type=g.type.toUpperCase(),g.hasContent=!_t.test(g.type),f=g.url.replace(At,\"\"),g.hasContent?g.data&&g.processData&&0===(g.contentType||\"\").indexOf(\"application/x-www-form-urlencoded\")&&(g.data=g.data.replace(Dt,\"+\")):(o=g.url.slice(f.length),g.data&&(g.processData||\"string\"==typeof g.data)&&(f+=(Tt.test(f)?\"&\":\"?\")+g.data,delete g.data),!1===g.cache&&(f=f.replace(Ot,\"$1\"),o=(Tt.test(f)?\"&\":\"?\")+\"_=\"+xt+++o),g.url=f+o),g.ifModified&&(E.lastModified[f]&&T.setRequestHeader(\"If-Modified-Since\",E.lastModified[f]),E.etag[f]&&T.setRequestHeader(\"If-None-Match\",E.etag[f])),(g.data&&g.hasContent&&!1!==g.contentType||t.contentType)&&T.setRequestHeader(\"Content-Type\",g.contentType),T.setRequestHeader(\"Accept\",g.dataTypes[0]&&g.accepts[g.dataTypes[0]]?g.accepts[g.dataTypes[0]]+(\"*\"!==g.dataTypes[0]?\", \"+Pt+\"; q=0.01\":\"\"):g.accepts[\"*\"]),g.headers)T.setRequestHeader(i,g.headers[i]);if(g.beforeSend&&(!1===g.beforeSend.call(m,T,g)||h))return T.abort();if(u=\"abort\",w.add(g.complete),T.done(g.success),T.fail(g.error),l=Rt(Mt,g,t,T)){if(T.readyState=1,v&&y.trigger(\"ajaxSend\",[T,g]),h)return T;g.async&&0<g.timeout&&(d=k.setTimeout(function(){T.abort(\"timeout\")},g.timeout));try{h=!1,l.send(a,c)}catch(e){if(h)throw e;c(-1,e)}}else c(-1,\"No Transport\");function c(e,t,n,r){var i,o,a,s,u,c=t;h||(h=!0,d&&k.clearTimeout(d),l=void 0,p=r||\"\",T.readyState=0<e?4:0,i=200<=e&&e<300||304===e,n&&(s=function(e,t,n){for(var r,i,o,a,s=e.contents,u=e.dataTypes;\"*\"===u[0];)u.shift(),void 0===r&&(r=e.mimeType||t.getResponseHeader(\"Content-Type\"));if(r)for(i in s)if(s[i]&&s[i].test(r)){u.unshift(i);break}if(u[0]in n)o=u[0];else{for(i in n){if(!u[0]||e.converters[i+\" \"+u[0]]){o=i;break}a||(a=i)}o=o||a}if(o)return o!==u[0]&&u.unshift(o),n[o]}(g,T,n)),s=function(e,t,n,r){var i,o,a,s,u,c={},l=e.dataTypes.slice();if(l[1])for(a in e.converters)c[a.toLowerCase()]=e.converters[a];for(o=l.shift();o;)if(e.responseFields[o]&&(n[e.responseFields[o]]=t),!u&&r&&e.dataFilter&&(t=e.dataFilter(t,e.dataType)),u=o,o=l.shift())if(\"*\"===o)o=u;else if(\"*\"!==u&&u!==o){if(!(a=c[u+\" \"+o]||c[\"* \"+o]))for(i in c)if((s=i.split(\" \"))[1]===o&&(a=c[u+\" \"+s[0]]||c[\"* \"+s[0]])){!0===a?a=c[i]:!0!==c[i]&&(o=s[0],l.unshift(s[1]));break}if(!0!==a)if(a&&e.throws)t=a(t);else try{t=a(t)}catch(e){return{state:\"parsererror\",error:a?e:\"No conversion from \"+u+\" to \"+o}}}return{state:\"success\",data:t}}(g,s,T,i),i?(g.ifModified&&((u=T.getResponseHeader(\"Last-Modified\"))&&(E.lastModified[f]=u),(u=T.getResponseHeader(\"etag\"))&&(E.etag[f]=u)),204===e||\"HEAD\"===g.type?c=\"nocontent\":304===e?c=\"notmodified\":(c=s.state,o=s.data,i=!(a=s.error))):(a=c,!e&&c||(c=\"error\",e<0&&(e=0))),T.status=e,T.statusText=(t||c)+\"\",i?b.resolveWith(m,[o,c,T]):b.rejectWith(m,[T,c,a]),T.statusCode(x),x=void 0,v&&y.trigger(i?\"ajaxSuccess\":\"ajaxError\",[T,g,i?o:a]),w.fireWith(m,[T,c]),v&&(y.trigger(\"ajaxComplete\",[T,g]),--E.active||E.event.trigger(\"ajaxStop\")))}return T},getJSON:function(e,t,n){return E.get(e,t,n,\"json\")},getScript:function(e,t){return E.get(e,void 0,t,\"script\")}}),E.each([\"get\",\"post\"],function(e,i){E[i]=function(e,t,n,r){return y(t)&&(r=r||n,n=t,t=void 0),E.ajax(E.extend({url:e,type:i,dataType:r,data:t,success:n},E.isPlainObject(e)&&e))}}),E._evalUrl=function(e){return E.ajax({url:e,type:\"GET\",dataType:\"script\",cache:!0,async:!1,global:!1,throws:!0})},E.fn.extend({wrapAll:function(e){var t;return this[0]&&(y(e)&&(e=e.call(this[0])),t=E(e,this[0].ownerDocument).eq(0).clone(!0),this[0].parentNode&&t.insertBefore(this[0]),t.map(function(){for(var e=this;e.firstElementChild;)e=e.firstElementChild;return e}).append(this)),this},wrapInner:function(n){return y(n)?this.each(function(e){E(this).wrapInner(n.call(this,e))}):this.each(function(){var e=E(this),t=e.contents();t.length?t.wrapAll(n):e.append(n)})},wrap:function(t){var n=y(t);return this.each(function(e){E(this).wrapAll(n?t.call(this,e):t)})},unwrap:function(e){return this.parent(e).not(\"body\").each(function(){E(this).replaceWith(this.childNodes)}),this}}),E.expr.pseudos.hidden=function(e){return!E.expr.pseudos.visible(e)},E.expr.pseudos.visible=function(e){return!!(e.offsetWidth||e.offsetHeight||e.getClientRects().length)},E.ajaxSettings.xhr=function(){try{return new k.XMLHttpRequest}catch(e){}};var $t={0:200,1223:204},Ft=E.ajaxSettings.xhr();m.cors=!!Ft&&\"withCredentials\"in Ft,m.ajax=Ft=!!Ft,E.ajaxTransport(function(i){var o,a;if(m.cors||Ft&&!i.crossDomain)return{send:function(e,t){var n,r=i.xhr();if(r.open(i.type,i.url,i.async,i.username,i.password),i.xhrFields)for(n in i.xhrFields)r[n]=i.xhrFields[n];for(n in i.mimeType&&r.overrideMimeType&&r.overrideMimeType(i.mimeType),i.crossDomain||e[\"X-Requested-With\"]||(e[\"X-Requested-With\"]=\"XMLHttpRequest\"),e)r.setRequestHeader(n,e[n]);o=function(e){return function(){o&&(o=a=r.onload=r.onerror=r.onabort=r.ontimeout=r.onreadystatechange=null,\"abort\"===e?r.abort():\"error\"===e?\"number\"!=typeof r.status?t(0,\"error\"):t(r.status,r.statusText):t($t[r.status]||r.status,r.statusText,\"text\"!==(r.responseType||\"text\")||\"string\"!=typeof r.responseText?{binary:r.response}:{text:r.responseText},r.getAllResponseHeaders()))}},r.onload=o(),a=r.onerror=r.ontimeout=o(\"error\"),void 0!==r.onabort?r.onabort=a:r.onreadystatechange=function(){4===r.readyState&&k.setTimeout(function(){o&&a()})},o=o(\"abort\");try{r.send(i.hasContent&&i.data||null)}catch(e){if(o)throw e}},abort:function(){o&&o()}}}),E.ajaxPrefilter(function(e){e.crossDomain&&(e.contents.script=!1)}),E.ajaxSetup({accepts:{script:\"text/javascript, application/javascript, application/ecmascript, application/x-ecmascript\"},contents:{script:/\\b(?:java|ecma)script\\b/},converters:{\"text script\":function(e){return E.globalEval(e),e}}}),E.ajaxPrefilter(\"script\",function(e){void 0===e.cache&&(e.cache=!1),e.crossDomain&&(e.type=\"GET\")}),E.ajaxTransport(\"script\",function(n){var r,i;if(n.crossDomain)return{send:function(e,t){r=E(\"<script>\").prop({charset:n.scriptCharset,src:n.url}).on(\"load error\",i=function(e){r.remove(),i=null,e&&t(\"error\"===e.type?404:200,e.type)}),C.head.appendChild(r[0])},abort:function(){i&&i()}}});var Wt,Vt=[],Ut=/(=)\\?(?=&|$)|\\?\\?/;E.ajaxSetup({jsonp:\"callback\",jsonpCallback:function(){var e=Vt.pop()||E.expando+\"_\"+xt++;return this[e]=!0,e}}),E.ajaxPrefilter(\"json jsonp\",function(e,t,n){var r,i,o,a=!1!==e.jsonp&&(Ut.test(e.url)?\"url\":\"string\"==typeof e.data&&0===(e.contentType||\"\").indexOf(\"application/x-www-form-urlencoded\")&&Ut.test(e.data)&&\"data\");if(a||\"jsonp\"===e.dataTypes[0])return r=e.jsonpCallback=y(e.jsonpCallback)?e.jsonpCallback():e.jsonpCallback,a?e[a]=e[a].replace(Ut,\"$1\"+r):!1!==e.jsonp&&(e.url+=(Tt.test(e.url)?\"&\":\"?\")+e.jsonp+\"=\"+r),e.converters[\"script json\"]=function(){return o||E.error(r+\" was not called\"),o[0]},e.dataTypes[0]=\"json\",i=k[r],k[r]=function(){o=arguments},n.always(function(){void 0===i?E(k).removeProp(r):k[r]=i,e[r]&&(e.jsonpCallback=t.jsonpCallback,Vt.push(r)),o&&y(i)&&i(o[0]),o=i=void 0}),\"script\"}),m.createHTMLDocument=((Wt=C.implementation.createHTMLDocument(\"\").body).innerHTML=\"<form></form><form></form>\",2===Wt.childNodes.length),E.parseHTML=function(e,t,n){return\"string\"!=typeof e?[]:(\"boolean\"==typeof t&&(n=t,t=!1),t||(m.createHTMLDocument?((r=(t=C.implementation.createHTMLDocument(\"\")).createElement(\"base\")).href=C.location.href,t.head.appendChild(r)):t=C),o=!n&&[],(i=A.exec(e))?[t.createElement(i[1])]:(i=ye([e],t,o),o&&o.length&&E(o).remove(),E.merge([],i.childNodes)));var r,i,o},E.fn.load=function(e,t,n){var r,i,o,a=this,s=e.indexOf(\" \");return-1<s&&(r=ht(e.slice(s)),e=e.slice(0,s)),y(t)?(n=t,t=void 0):t&&\"object\"===_typeof(t)&&(i=\"POST\"),0<a.length&&E.ajax({url:e,type:i||\"GET\",dataType:\"html\",data:t}).done(function(e){o=arguments,a.html(r?E(\"<div>\").append(E.parseHTML(e)).find(r):e)}).always(n&&function(e,t){a.each(function(){n.apply(this,o||[e.responseText,t,e])})}),this},E.each([\"ajaxStart\",\"ajaxStop\",\"ajaxComplete\",\"ajaxError\",\"ajaxSuccess\",\"ajaxSend\"],function(e,t){E.fn[t]=function(e){return this.on(t,e)}}),E.expr.pseudos.animated=function(t){return E.grep(E.timers,function(e){return t===e.elem}).length},E.offset={setOffset:function(e,t,n){var r,i,o,a,s,u,c=E.css(e,\"position\"),l=E(e),f={};\"static\"===c&&(e.style.position=\"relative\"),s=l.offset(),o=E.css(e,\"top\"),u=E.css(e,\"left\"),i=(\"absolute\"===c||\"fixed\"===c)&&-1<(o+u).indexOf(\"auto\")?(a=(r=l.position()).top,r.left):(a=parseFloat(o)||0,parseFloat(u)||0),y(t)&&(t=t.call(e,n,E.extend({},s))),null!=t.top&&(f.top=t.top-s.top+a),null!=t.left&&(f.left=t.left-s.left+i),\"using\"in t?t.using.call(e,f):l.css(f)}},E.fn.extend({offset:function(t){if(arguments.length)return void 0===t?this:this.each(function(e){E.offset.setOffset(this,t,e)});var e,n,r=this[0];return r?r.getClientRects().length?(e=r.getBoundingClientRect(),n=r.ownerDocument.defaultView,{top:e.top+n.pageYOffset,left:e.left+n.pageXOffset}):{top:0,left:0}:void 0},position:function(){if(this[0]){var e,t,n,r=this[0],i={top:0,left:0};if(\"fixed\"===E.css(r,\"position\"))t=r.getBoundingClientRect();else{for(t=this.offset(),n=r.ownerDocument,e=r.offsetParent||n.documentElement;e&&(e===n.body||e===n.documentElement)&&\"static\"===E.css(e,\"position\");)e=e.parentNode;e&&e!==r&&1===e.nodeType&&((i=E(e).offset()).top+=E.css(e,\"borderTopWidth\",!0),i.left+=E.css(e,\"borderLeftWidth\",!0))}return{top:t.top-i.top-E.css(r,\"marginTop\",!0),left:t.left-i.left-E.css(r,\"marginLeft\",!0)}}},offsetParent:function(){return this.map(function(){for(var e=this.offsetParent;e&&\"static\"===E.css(e,\"position\");)e=e.offsetParent;return e||be})}}),E.each({scrollLeft:\"pageXOffset\",scrollTop:\"pageYOffset\"},function(t,i){var o=\"pageYOffset\"===i;E.fn[t]=function(e){return W(this,function(e,t,n){var r;if(b(e)?r=e:9===e.nodeType&&(r=e.defaultView),void 0===n)return r?r[i]:e[t];r?r.scrollTo(o?r.pageXOffset:n,o?n:r.pageYOffset):e[t]=n},t,e,arguments.length)}}),E.each([\"top\",\"left\"],function(e,n){E.cssHooks[n]=$e(m.pixelPosition,function(e,t){if(t)return t=Ie(e,n),Be.test(t)?E(e).position()[n]+\"px\":t})}),E.each({Height:\"height\",Width:\"width\"},function(a,s){E.each({padding:\"inner\"+a,content:s,\"\":\"outer\"+a},function(r,o){E.fn[o]=function(e,t){var n=arguments.length&&(r||\"boolean\"!=typeof e),i=r||(!0===e||!0===t?\"margin\":\"border\");return W(this,function(e,t,n){var r;return b(e)?0===o.indexOf(\"outer\")?e[\"inner\"+a]:e.document.documentElement[\"client\"+a]:9===e.nodeType?(r=e.documentElement,Math.max(e.body[\"scroll\"+a],r[\"scroll\"+a],e.body[\"offset\"+a],r[\"offset\"+a],r[\"client\"+a])):void 0===n?E.css(e,t,i):E.style(e,t,n,i)},s,n?e:void 0,n)}})}),E.each(\"blur focus focusin focusout resize scroll click dblclick mousedown mouseup mousemove mouseover mouseout mouseenter mouseleave change select submit keydown keypress keyup contextmenu\".split(\" \"),function(e,n){E.fn[n]=function(e,t){return 0<arguments.length?this.on(n,null,e,t):this.trigger(n)}}),E.fn.extend({hover:function(e,t){return this.mouseenter(e).mouseleave(t||e)}}),E.fn.extend({bind:function(e,t,n){return this.on(e,null,t,n)},unbind:function(e,t){return this.off(e,null,t)},delegate:function(e,t,n,r){return this.on(t,e,n,r)},undelegate:function(e,t,n){return 1===arguments.length?this.off(e,\"**\"):this.off(t,e||\"**\",n)}}),E.proxy=function(e,t){var n,r,i;if(\"string\"==typeof t&&(n=e[t],t=e,e=n),y(e))return r=s.call(arguments,2),(i=function(){return e.apply(t||this,r.concat(s.call(arguments)))}).guid=e.guid=e.guid||E.guid++,i},E.holdReady=function(e){e?E.readyWait++:E.ready(!0)},E.isArray=Array.isArray,E.parseJSON=JSON.parse,E.nodeName=D,E.isFunction=y,E.isWindow=b,E.camelCase=z,E.type=x,E.now=Date.now,E.isNumeric=function(e){var t=E.type(e);return(\"number\"===t||\"string\"===t)&&!isNaN(e-parseFloat(e))},\"function\"==typeof define&&define.amd&&define(\"jquery\",[],function(){return E});var Jt=k.jQuery,zt=k.$;return E.noConflict=function(e){return k.$===E&&(k.$=zt),e&&k.jQuery===E&&(k.jQuery=Jt),E},e||(k.jQuery=k.$=E),E}),function(j){var e,_=this||(0,eval)(\"this\"),q=_.document,L=_.navigator,M=_.jQuery,P=_.JSON;e=function(e,r){function n(e,t){return(null===e||_typeof(e)in g)&&e===t}function o(e,t){var n;return function(){n||(n=E.a.setTimeout(function(){n=j,e()},t))}}function a(e,t){var n;return function(){clearTimeout(n),n=E.a.setTimeout(e,t)}}function u(e,t){t&&t!==m?\"beforeChange\"===t?this.Ob(e):this.Ja(e,t):this.Pb(e)}function i(e,t){null!==t&&t.k&&t.k()}function s(e,t){var n=this.Mc,r=n[T];r.T||(this.ob&&this.Oa[t]?(n.Sb(t,e,this.Oa[t]),this.Oa[t]=null,--this.ob):r.s[t]||n.Sb(t,e,r.t?{$:e}:n.yc(e)),e.Ha&&e.Hc())}function t(e,u,c,l){E.d[e]={init:function(r,i,e,t,o){var a,s;return E.m(function(){var e=i(),t=E.a.c(e),n=(t=!c!=!t,!s);(n||u||t!==a)&&(n&&E.xa.Ca()&&(s=E.a.wa(E.f.childNodes(r),!0)),t?(n||E.f.fa(r,E.a.wa(s)),E.hb(l?l(o,e):o,r)):E.f.za(r),a=t)},null,{i:r}),{controlsDescendantBindings:!0}}},E.h.va[e]=!1,E.f.aa[e]=!0}var c,l,f,p,d,h,v,E=void 0!==e?e:{};E.b=function(e,t){for(var n=e.split(\".\"),r=E,i=0;i<n.length-1;i++)r=r[n[i]];r[n[n.length-1]]=t},E.H=function(e,t,n){e[t]=n},E.version=\"3.4.2\",E.b(\"version\",E.version),E.options={deferUpdates:!1,useOnlyNativeEvents:!1},E.a=function(){function f(e,t){for(var n in e)e.hasOwnProperty(n)&&t(n,e[n])}function e(e,t){if(t)for(var n in t)t.hasOwnProperty(n)&&(e[n]=t[n]);return e}function t(e,t){return e.__proto__=t,e}function i(e,t,n,r){var i=e[t].match(c)||[];E.a.r(n.match(c),function(e){E.a.ra(i,e,r)}),e[t]=i.join(\" \")}var n={__proto__:[]}instanceof Array,r=\"function\"==typeof Symbol,o={},a={};o[L&&/Firefox\\/2/i.test(L.userAgent)?\"KeyboardEvent\":\"UIEvents\"]=[\"keyup\",\"keydown\",\"keypress\"],o.MouseEvents=\"click dblclick mousedown mouseup mousemove mouseover mouseout mouseenter mouseleave\".split(\" \"),f(o,function(e,t){if(t.length)for(var n=0,r=t.length;n<r;n++)a[t[n]]=e});var s={propertychange:!0},u=q&&function(){for(var e=3,t=q.createElement(\"div\"),n=t.getElementsByTagName(\"i\");t.innerHTML=\"\\x3c!--[if gt IE \"+ ++e+\"]><i></i><![endif]--\\x3e\",n[0];);return 4<e?e:j}(),c=/\\S+/g;return{gc:[\"authenticity_token\",/^__RequestVerificationToken(_.*)?$/],r:function(e,t){for(var n=0,r=e.length;n<r;n++)t(e[n],n)},o:function(e,t){if(\"function\"==typeof Array.prototype.indexOf)return Array.prototype.indexOf.call(e,t);for(var n=0,r=e.length;n<r;n++)if(e[n]===t)return n;return-1},Vb:function(e,t,n){for(var r=0,i=e.length;r<i;r++)if(t.call(n,e[r],r))return e[r];return null},Na:function(e,t){var n=E.a.o(e,t);0<n?e.splice(n,1):0===n&&e.shift()},Wb:function(e){for(var t=[],n=0,r=(e=e||[]).length;n<r;n++)E.a.o(t,e[n])<0&&t.push(e[n]);return t},ib:function(e,t){for(var n=[],r=0,i=(e=e||[]).length;r<i;r++)n.push(t(e[r],r));return n},Ma:function(e,t){for(var n=[],r=0,i=(e=e||[]).length;r<i;r++)t(e[r],r)&&n.push(e[r]);return n},ta:function(e,t){if(t instanceof Array)e.push.apply(e,t);else for(var n=0,r=t.length;n<r;n++)e.push(t[n]);return e},ra:function(e,t,n){var r=E.a.o(E.a.Bb(e),t);r<0?n&&e.push(t):n||e.splice(r,1)},la:n,extend:e,$a:t,ab:n?t:e,D:f,Ea:function(e,t){if(!e)return e;var n,r={};for(n in e)e.hasOwnProperty(n)&&(r[n]=t(e[n],n,e));return r},rb:function(e){for(;e.firstChild;)E.removeNode(e.firstChild)},nc:function(e){for(var t=((e=E.a.W(e))[0]&&e[0].ownerDocument||q).createElement(\"div\"),n=0,r=e.length;n<r;n++)t.appendChild(E.ba(e[n]));return t},wa:function(e,t){for(var n=0,r=e.length,i=[];n<r;n++){var o=e[n].cloneNode(!0);i.push(t?E.ba(o):o)}return i},fa:function(e,t){if(E.a.rb(e),t)for(var n=0,r=t.length;n<r;n++)e.appendChild(t[n])},uc:function(e,t){var n=e.nodeType?[e]:e;if(0<n.length){for(var r=n[0],i=r.parentNode,o=0,a=t.length;o<a;o++)i.insertBefore(t[o],r);for(o=0,a=n.length;o<a;o++)E.removeNode(n[o])}},Ba:function(e,t){if(e.length){for(t=8===t.nodeType&&t.parentNode||t;e.length&&e[0].parentNode!==t;)e.splice(0,1);for(;1<e.length&&e[e.length-1].parentNode!==t;)e.length--;if(1<e.length){var n=e[0],r=e[e.length-1];for(e.length=0;n!==r;)e.push(n),n=n.nextSibling;e.push(r)}}return e},wc:function(e,t){u<7?e.setAttribute(\"selected\",t):e.selected=t},cb:function(e){return null===e||e===j?\"\":e.trim?e.trim():e.toString().replace(/^[\\s\\xa0]+|[\\s\\xa0]+$/g,\"\")},sd:function(e,t){return e=e||\"\",!(t.length>e.length)&&e.substring(0,t.length)===t},Rc:function(e,t){if(e===t)return!0;if(11===e.nodeType)return!1;if(t.contains)return t.contains(3===e.nodeType?e.parentNode:e);if(t.compareDocumentPosition)return 16==(16&t.compareDocumentPosition(e));for(;e&&e!=t;)e=e.parentNode;return!!e},qb:function(e){return E.a.Rc(e,e.ownerDocument.documentElement)},Tb:function(e){return!!E.a.Vb(e,E.a.qb)},A:function(e){return e&&e.tagName&&e.tagName.toLowerCase()},Zb:function(e){return E.onError?function(){try{return e.apply(this,arguments)}catch(e){throw E.onError&&E.onError(e),e}}:e},setTimeout:function(n){function e(e,t){return n.apply(this,arguments)}return e.toString=function(){return n.toString()},e}(function(e,t){return setTimeout(E.a.Zb(e),t)}),dc:function(e){setTimeout(function(){throw E.onError&&E.onError(e),e},0)},q:function(t,e,n){var r=E.a.Zb(n);if(n=u&&s[e],E.options.useOnlyNativeEvents||n||!M)if(n||\"function\"!=typeof t.addEventListener){if(void 0===t.attachEvent)throw Error(\"Browser doesn't support addEventListener or attachEvent\");var i=function(e){r.call(t,e)},o=\"on\"+e;t.attachEvent(o,i),E.a.G.qa(t,function(){t.detachEvent(o,i)})}else t.addEventListener(e,r,!1);else M(t).bind(e,r)},Fa:function(e,t){if(!e||!e.nodeType)throw Error(\"element must be a DOM node when calling triggerEvent\");var n;if(n=!(\"input\"!==E.a.A(e)||!e.type||\"click\"!=t.toLowerCase()||\"checkbox\"!=(n=e.type)&&\"radio\"!=n),E.options.useOnlyNativeEvents||!M||n)if(\"function\"==typeof q.createEvent){if(\"function\"!=typeof e.dispatchEvent)throw Error(\"The supplied element doesn't support dispatchEvent\");(n=q.createEvent(a[t]||\"HTMLEvents\")).initEvent(t,!0,!0,_,0,0,0,0,0,!1,!1,!1,!1,0,e),e.dispatchEvent(n)}else if(n&&e.click)e.click();else{if(void 0===e.fireEvent)throw Error(\"Browser doesn't support triggering events\");e.fireEvent(\"on\"+t)}else M(e).trigger(t)},c:function(e){return E.I(e)?e():e},Bb:function(e){return E.I(e)?e.p():e},fb:function(t,e,n){var r;e&&(\"object\"===_typeof(t.classList)?(r=t.classList[n?\"add\":\"remove\"],E.a.r(e.match(c),function(e){r.call(t.classList,e)})):\"string\"==typeof t.className.baseVal?i(t.className,\"baseVal\",e,n):i(t,\"className\",e,n))},bb:function(e,t){var n=E.a.c(t);null!==n&&n!==j||(n=\"\");var r=E.f.firstChild(e);!r||3!=r.nodeType||E.f.nextSibling(r)?E.f.fa(e,[e.ownerDocument.createTextNode(n)]):r.data=n,E.a.Wc(e)},vc:function(e,t){if(e.name=t,u<=7)try{e.mergeAttributes(q.createElement(\"<input name='\"+e.name+\"'/>\"),!1)}catch(e){}},Wc:function(e){9<=u&&(e=1==e.nodeType?e:e.parentNode).style&&(e.style.zoom=e.style.zoom)},Sc:function(e){if(u){var t=e.style.width;e.style.width=0,e.style.width=t}},nd:function(e,t){e=E.a.c(e),t=E.a.c(t);for(var n=[],r=e;r<=t;r++)n.push(r);return n},W:function(e){for(var t=[],n=0,r=e.length;n<r;n++)t.push(e[n]);return t},bc:function(e){return r?Symbol(e):e},xd:6===u,yd:7===u,C:u,ic:function(e,t){for(var n=E.a.W(e.getElementsByTagName(\"input\")).concat(E.a.W(e.getElementsByTagName(\"textarea\"))),r=\"string\"==typeof t?function(e){return e.name===t}:function(e){return t.test(e.name)},i=[],o=n.length-1;0<=o;o--)r(n[o])&&i.push(n[o]);return i},kd:function(e){return\"string\"==typeof e&&(e=E.a.cb(e))?P&&P.parse?P.parse(e):new Function(\"return \"+e)():null},Gb:function(e,t,n){if(!P||!P.stringify)throw Error(\"Cannot find JSON.stringify(). Some browsers (e.g., IE < 8) don't support it natively, but you can overcome this by adding a script reference to json2.js, downloadable from http://www.json.org/json2.js\");return P.stringify(E.a.c(e),t,n)},ld:function(e,t,n){var r=(n=n||{}).params||{},i=n.includeFields||this.gc,o=e;if(\"object\"==_typeof(e)&&\"form\"===E.a.A(e)){o=e.action;for(var a=i.length-1;0<=a;a--)for(var s=E.a.ic(e,i[a]),u=s.length-1;0<=u;u--)r[s[u].name]=s[u].value}t=E.a.c(t);var c=q.createElement(\"form\");for(var l in c.style.display=\"none\",c.action=o,c.method=\"post\",t)(e=q.createElement(\"input\")).type=\"hidden\",e.name=l,e.value=E.a.Gb(E.a.c(t[l])),c.appendChild(e);f(r,function(e,t){var n=q.createElement(\"input\");n.type=\"hidden\",n.name=e,n.value=t,c.appendChild(n)}),q.body.appendChild(c),n.submitter?n.submitter(c):c.submit(),setTimeout(function(){c.parentNode.removeChild(c)},0)}}}(),E.b(\"utils\",E.a),E.b(\"utils.arrayForEach\",E.a.r),E.b(\"utils.arrayFirst\",E.a.Vb),E.b(\"utils.arrayFilter\",E.a.Ma),E.b(\"utils.arrayGetDistinctValues\",E.a.Wb),E.b(\"utils.arrayIndexOf\",E.a.o),E.b(\"utils.arrayMap\",E.a.ib),E.b(\"utils.arrayPushAll\",E.a.ta),E.b(\"utils.arrayRemoveItem\",E.a.Na),E.b(\"utils.extend\",E.a.extend),E.b(\"utils.fieldsIncludedWithJsonPost\",E.a.gc),E.b(\"utils.getFormFields\",E.a.ic),E.b(\"utils.peekObservable\",E.a.Bb),E.b(\"utils.postJson\",E.a.ld),E.b(\"utils.parseJson\",E.a.kd),E.b(\"utils.registerEventHandler\",E.a.q),E.b(\"utils.stringifyJson\",E.a.Gb),E.b(\"utils.range\",E.a.nd),E.b(\"utils.toggleDomNodeCssClass\",E.a.fb),E.b(\"utils.triggerEvent\",E.a.Fa),E.b(\"utils.unwrapObservable\",E.a.c),E.b(\"utils.objectForEach\",E.a.D),E.b(\"utils.addOrRemoveItem\",E.a.ra),E.b(\"utils.setTextContent\",E.a.bb),E.b(\"unwrap\",E.a.c),Function.prototype.bind||(Function.prototype.bind=function(t){var n=this;if(1===arguments.length)return function(){return n.apply(t,arguments)};var r=Array.prototype.slice.call(arguments,1);return function(){var e=r.slice(0);return e.push.apply(e,arguments),n.apply(t,e)}}),E.a.e=new function(){function r(e,t){var n=e[o];if(!n||\"null\"===n||!a[n]){if(!t)return j;n=e[o]=\"ko\"+i++,a[n]={}}return a[n]}var i=0,o=\"__ko__\"+(new Date).getTime(),a={};return{get:function(e,t){var n=r(e,!1);return n===j?j:n[t]},set:function(e,t,n){n===j&&r(e,!1)===j||(r(e,!0)[t]=n)},clear:function(e){var t=e[o];return!(!t||(delete a[t],e[o]=null))},J:function(){return i+++o}}},E.b(\"utils.domData\",E.a.e),E.b(\"utils.domData.clear\",E.a.e.clear),E.a.G=new function(){function r(e,t){var n=E.a.e.get(e,o);return n===j&&t&&(n=[],E.a.e.set(e,o,n)),n}function i(e){if(t=r(e,!1))for(var t=t.slice(0),n=0;n<t.length;n++)t[n](e);if(E.a.e.clear(e),E.a.G.cleanExternalData(e),s[e.nodeType])for(t=e.firstChild;e=t;)t=e.nextSibling,8===e.nodeType&&i(e)}var o=E.a.e.J(),a={1:!0,8:!0,9:!0},s={1:!0,9:!0};return{qa:function(e,t){if(\"function\"!=typeof t)throw Error(\"Callback must be a function\");r(e,!0).push(t)},tc:function(e,t){var n=r(e,!1);n&&(E.a.Na(n,t),0==n.length&&E.a.e.set(e,o,j))},ba:function(e){if(a[e.nodeType]&&(i(e),s[e.nodeType])){var t=[];E.a.ta(t,e.getElementsByTagName(\"*\"));for(var n=0,r=t.length;n<r;n++)i(t[n])}return e},removeNode:function(e){E.ba(e),e.parentNode&&e.parentNode.removeChild(e)},cleanExternalData:function(e){M&&\"function\"==typeof M.cleanData&&M.cleanData([e])}}},E.ba=E.a.G.ba,E.removeNode=E.a.G.removeNode,E.b(\"cleanNode\",E.ba),E.b(\"removeNode\",E.removeNode),E.b(\"utils.domNodeDisposal\",E.a.G),E.b(\"utils.domNodeDisposal.addDisposeCallback\",E.a.G.qa),E.b(\"utils.domNodeDisposal.removeDisposeCallback\",E.a.G.tc),c=[0,\"\",\"\"],d={thead:l=[1,\"<table>\",\"</table>\"],tbody:l,tfoot:l,tr:[2,\"<table><tbody>\",\"</tbody></table>\"],td:f=[3,\"<table><tbody><tr>\",\"</tr></tbody></table>\"],th:f,option:p=[1,\"<select multiple='multiple'>\",\"</select>\"],optgroup:p},h=E.a.C<=8,E.a.na=function(e,t){var n;if(M){if(M.parseHTML)n=M.parseHTML(e,t)||[];else if((n=M.clean([e],t))&&n[0]){for(var r=n[0];r.parentNode&&11!==r.parentNode.nodeType;)r=r.parentNode;r.parentNode&&r.parentNode.removeChild(r)}}else{(n=t)||(n=q),r=n.parentWindow||n.defaultView||_;var i,o=E.a.cb(e).toLowerCase(),a=n.createElement(\"div\");for(o=(i=(o=o.match(/^<([a-z]+)[ >]/))&&d[o[1]]||c)[0],i=\"ignored<div>\"+i[1]+e+i[2]+\"</div>\",\"function\"==typeof r.innerShiv?a.appendChild(r.innerShiv(i)):(h&&n.appendChild(a),a.innerHTML=i,h&&a.parentNode.removeChild(a));o--;)a=a.lastChild;n=E.a.W(a.lastChild.childNodes)}return n},E.a.Eb=function(e,t){if(E.a.rb(e),null!==(t=E.a.c(t))&&t!==j)if(\"string\"!=typeof t&&(t=t.toString()),M)M(e).html(t);else for(var n=E.a.na(t,e.ownerDocument),r=0;r<n.length;r++)e.appendChild(n[r])},E.b(\"utils.parseHtmlFragment\",E.a.na),E.b(\"utils.setHtml\",E.a.Eb),E.N=(v={},{yb:function(e){if(\"function\"!=typeof e)throw Error(\"You can only pass a function to ko.memoization.memoize()\");var t=(4294967296*(1+Math.random())|0).toString(16).substring(1)+(4294967296*(1+Math.random())|0).toString(16).substring(1);return v[t]=e,\"\\x3c!--[ko_memo:\"+t+\"]--\\x3e\"},Bc:function(e,t){var n=v[e];if(n===j)throw Error(\"Couldn't find any memo with ID \"+e+\". Perhaps it's already been unmemoized.\");try{return n.apply(null,t||[]),!0}finally{delete v[e]}},Cc:function(e,t){var n=[];!function e(t,n){if(t)if(8==t.nodeType)null!=(r=E.N.pc(t.nodeValue))&&n.push({Qc:t,hd:r});else if(1==t.nodeType)for(var r=0,i=t.childNodes,o=i.length;r<o;r++)e(i[r],n)}(e,n);for(var r=0,i=n.length;r<i;r++){var o=n[r].Qc,a=[o];t&&E.a.ta(a,t),E.N.Bc(n[r].hd,a),o.nodeValue=\"\",o.parentNode&&o.parentNode.removeChild(o)}},pc:function(e){return(e=e.match(/^\\[ko_memo\\:(.*?)\\]$/))?e[1]:null}}),E.b(\"memoization\",E.N),E.b(\"memoization.memoize\",E.N.yb),E.b(\"memoization.unmemoize\",E.N.Bc),E.b(\"memoization.parseMemoText\",E.N.pc),E.b(\"memoization.unmemoizeDomNodeAndDescendants\",E.N.Cc),E.Z=function(){function e(){if(o)for(var e,t=o,n=0;s<o;)if(e=i[s++]){if(t<s){if(5e3<=++n){s=o,E.a.dc(Error(\"'Too much recursion' after processing \"+n+\" task groups.\"));break}t=o}try{e()}catch(e){E.a.dc(e)}}}function t(){e(),s=o=i.length=0}var n,r,i=[],o=0,a=1,s=0;return{scheduler:_.MutationObserver?(n=t,r=q.createElement(\"div\"),new MutationObserver(n).observe(r,{attributes:!0}),function(){r.classList.toggle(\"foo\")}):q&&\"onreadystatechange\"in q.createElement(\"script\")?function(e){var t=q.createElement(\"script\");t.onreadystatechange=function(){t.onreadystatechange=null,q.documentElement.removeChild(t),t=null,e()},q.documentElement.appendChild(t)}:function(e){setTimeout(e,0)},Za:function(e){return o||E.Z.scheduler(t),i[o++]=e,a++},cancel:function(e){s<=(e-=a-o)&&e<o&&(i[e]=null)},resetForTesting:function(){var e=o-s;return s=o=i.length=0,e},rd:e}}(),E.b(\"tasks\",E.Z),E.b(\"tasks.schedule\",E.Z.Za),E.b(\"tasks.runEarly\",E.Z.rd),E.Aa={throttle:function(t,n){t.throttleEvaluation=n;var r=null;return E.B({read:t,write:function(e){clearTimeout(r),r=E.a.setTimeout(function(){t(e)},n)}})},rateLimit:function(e,t){var n,r,i;\"number\"==typeof t?n=t:(n=t.timeout,r=t.method),e.gb=!1,i=\"notifyWhenChangesStop\"==r?a:o,e.Wa(function(e){return i(e,n)})},deferred:function(r,e){if(!0!==e)throw Error(\"The 'deferred' extender only accepts the value 'true', because it is not supported to turn deferral off once enabled.\");r.gb||(r.gb=!0,r.Wa(function(e){var t,n=!1;return function(){if(!n){E.Z.cancel(t),t=E.Z.Za(e);try{n=!0,r.notifySubscribers(j,\"dirty\")}finally{n=!1}}}}))},notify:function(e,t){e.equalityComparer=\"always\"==t?null:n}};var g={undefined:1,boolean:1,number:1,string:1};E.b(\"extenders\",E.Aa),E.zc=function(e,t,n){this.$=e,this.jb=t,this.Pc=n,this.T=!1,E.H(this,\"dispose\",this.k)},E.zc.prototype.k=function(){this.T=!0,this.Pc()},E.K=function(){E.a.ab(this,y),y.ub(this)};var m=\"change\",y={ub:function(e){e.F={change:[]},e.Qb=1},Y:function(e,t,n){var r=this;n=n||m;var i=new E.zc(r,t?e.bind(t):e,function(){E.a.Na(r.F[n],i),r.Ka&&r.Ka(n)});return r.ua&&r.ua(n),r.F[n]||(r.F[n]=[]),r.F[n].push(i),i},notifySubscribers:function(e,t){if((t=t||m)===m&&this.Kb(),this.Ra(t)){var n=t===m&&this.Fc||this.F[t].slice(0);try{E.l.Xb();for(var r,i=0;r=n[i];++i)r.T||r.jb(e)}finally{E.l.end()}}},Pa:function(){return this.Qb},Zc:function(e){return this.Pa()!==e},Kb:function(){++this.Qb},Wa:function(e){var t,n,r,i,o=this,a=E.I(o);o.Ja||(o.Ja=o.notifySubscribers,o.notifySubscribers=u);var s=e(function(){o.Ha=!1,a&&i===o&&(i=o.Mb?o.Mb():o());var e=n||o.Ua(r,i);n=t=!1,e&&o.Ja(r=i)});o.Pb=function(e){o.Fc=o.F[m].slice(0),o.Ha=t=!0,i=e,s()},o.Ob=function(e){t||(r=e,o.Ja(e,\"beforeChange\"))},o.Hc=function(){o.Ua(r,o.p(!0))&&(n=!0)}},Ra:function(e){return this.F[e]&&this.F[e].length},Xc:function(e){if(e)return this.F[e]&&this.F[e].length||0;var n=0;return E.a.D(this.F,function(e,t){\"dirty\"!==e&&(n+=t.length)}),n},Ua:function(e,t){return!this.equalityComparer||!this.equalityComparer(e,t)},extend:function(e){var r=this;return e&&E.a.D(e,function(e,t){var n=E.Aa[e];\"function\"==typeof n&&(r=n(r,t)||r)}),r}};E.H(y,\"subscribe\",y.Y),E.H(y,\"extend\",y.extend),E.H(y,\"getSubscriptionsCount\",y.Xc),E.a.la&&E.a.$a(y,Function.prototype),E.K.fn=y,E.lc=function(e){return null!=e&&\"function\"==typeof e.Y&&\"function\"==typeof e.notifySubscribers},E.b(\"subscribable\",E.K),E.b(\"isSubscribable\",E.lc),E.xa=E.l=function(){function r(e){n.push(t),t=e}function i(){t=n.pop()}var t,n=[],o=0;return{Xb:r,end:i,sc:function(e){if(t){if(!E.lc(e))throw Error(\"Only subscribable things can act as dependencies\");t.jb.call(t.Lc,e,e.Gc||(e.Gc=++o))}},w:function(e,t,n){try{return r(),e.apply(t,n||[])}finally{i()}},Ca:function(){if(t)return t.m.Ca()},Va:function(){if(t)return t.Va}}}(),E.b(\"computedContext\",E.xa),E.b(\"computedContext.getDependenciesCount\",E.xa.Ca),E.b(\"computedContext.isInitial\",E.xa.Va),E.b(\"ignoreDependencies\",E.wd=E.l.w);var b=E.a.bc(\"_latestValue\");E.O=function(e){function t(){return 0<arguments.length?(t.Ua(t[b],arguments[0])&&(t.ia(),t[b]=arguments[0],t.ha()),this):(E.l.sc(t),t[b])}return t[b]=e,E.a.la||E.a.extend(t,E.K.fn),E.K.fn.ub(t),E.a.ab(t,w),E.options.deferUpdates&&E.Aa.deferred(t,!0),t};var w={equalityComparer:n,p:function(){return this[b]},ha:function(){this.notifySubscribers(this[b])},ia:function(){this.notifySubscribers(this[b],\"beforeChange\")}};E.a.la&&E.a.$a(w,E.K.fn);var x=E.O.md=\"__ko_proto__\";w[x]=E.O,E.Qa=function(e,t){return null!==e&&e!==j&&e[x]!==j&&(e[x]===t||E.Qa(e[x],t))},E.I=function(e){return E.Qa(e,E.O)},E.Da=function(e){return!!(\"function\"==typeof e&&e[x]===E.O||\"function\"==typeof e&&e[x]===E.B&&e.$c)},E.b(\"observable\",E.O),E.b(\"isObservable\",E.I),E.b(\"isWriteableObservable\",E.Da),E.b(\"isWritableObservable\",E.Da),E.b(\"observable.fn\",w),E.H(w,\"peek\",w.p),E.H(w,\"valueHasMutated\",w.ha),E.H(w,\"valueWillMutate\",w.ia),E.ma=function(e){if(\"object\"!=_typeof(e=e||[])||!(\"length\"in e))throw Error(\"The argument passed when initializing an observable array must be an array, or null, or undefined.\");return e=E.O(e),E.a.ab(e,E.ma.fn),e.extend({trackArrayChanges:!0})},E.ma.fn={remove:function(t){for(var e=this.p(),n=[],r=\"function\"!=typeof t||E.I(t)?function(e){return e===t}:t,i=0;i<e.length;i++){var o=e[i];r(o)&&(0===n.length&&this.ia(),n.push(o),e.splice(i,1),i--)}return n.length&&this.ha(),n},removeAll:function(t){if(t!==j)return t?this.remove(function(e){return 0<=E.a.o(t,e)}):[];var e=this.p(),n=e.slice(0);return this.ia(),e.splice(0,e.length),this.ha(),n},destroy:function(t){var e=this.p(),n=\"function\"!=typeof t||E.I(t)?function(e){return e===t}:t;this.ia();for(var r=e.length-1;0<=r;r--)n(e[r])&&(e[r]._destroy=!0);this.ha()},destroyAll:function(t){return t===j?this.destroy(function(){return!0}):t?this.destroy(function(e){return 0<=E.a.o(t,e)}):[]},indexOf:function(e){var t=this();return E.a.o(t,e)},replace:function(e,t){var n=this.indexOf(e);0<=n&&(this.ia(),this.p()[n]=t,this.ha())}},E.a.la&&E.a.$a(E.ma.fn,E.O.fn),E.a.r(\"pop push reverse shift sort splice unshift\".split(\" \"),function(n){E.ma.fn[n]=function(){var e=this.p();this.ia(),this.Yb(e,n,arguments);var t=e[n].apply(e,arguments);return this.ha(),t===e?this:t}}),E.a.r([\"slice\"],function(t){E.ma.fn[t]=function(){var e=this();return e[t].apply(e,arguments)}}),E.b(\"observableArray\",E.ma),E.Aa.trackArrayChanges=function(r,e){if(r.kb={},e&&\"object\"==_typeof(e)&&E.a.extend(r.kb,e),r.kb.sparse=!0,!r.Yb){var t,i,f=!1,p=null,d=0,n=r.ua,o=r.Ka;r.ua=function(e){n&&n.call(r,e),\"arrayChange\"===e&&function(){if(!f){f=!0,i=r.notifySubscribers,r.notifySubscribers=function(e,t){return t&&t!==m||++d,i.apply(this,arguments)};var n=[].concat(r.p()||[]);p=null,t=r.Y(function(e){var t;e=[].concat(e||[]),r.Ra(\"arrayChange\")&&((!p||1<d)&&(p=E.a.lb(n,e,r.kb)),t=p),n=e,p=null,d=0,t&&t.length&&r.notifySubscribers(t,\"arrayChange\")})}}()},r.Ka=function(e){o&&o.call(r,e),\"arrayChange\"!==e||r.Ra(\"arrayChange\")||(i&&(r.notifySubscribers=i,i=j),t.k(),f=!1)},r.Yb=function(e,t,n){function r(e,t,n){return i[i.length]={status:e,value:t,index:n}}if(f&&!d){var i=[],o=e.length,a=n.length,s=0;switch(t){case\"push\":s=o;case\"unshift\":for(t=0;t<a;t++)r(\"added\",n[t],s+t);break;case\"pop\":s=o-1;case\"shift\":o&&r(\"deleted\",e[s],s);break;case\"splice\":t=Math.min(Math.max(0,n[0]<0?o+n[0]:n[0]),o),o=1===a?o:Math.min(t+(n[1]||0),o),a=t+a-2,s=Math.max(o,a);for(var u=[],c=[],l=2;t<s;++t,++l)t<o&&c.push(r(\"deleted\",e[t],t)),t<a&&u.push(r(\"added\",n[l],t));E.a.hc(c,u);break;default:return}p=i}}}};var T=E.a.bc(\"_state\");E.m=E.B=function(e,t,n){function r(){if(0<arguments.length){if(\"function\"!=typeof i)throw Error(\"Cannot write a value to a ko.computed unless you specify a 'write' option. If you wish to read the current value, don't pass any parameters.\");return i.apply(o.sb,arguments),this}return E.l.sc(r),(o.V||o.t&&r.Sa())&&r.U(),o.M}if(\"object\"===_typeof(e)?n=e:(n=n||{},e&&(n.read=e)),\"function\"!=typeof n.read)throw Error(\"Pass a function that returns the value of the ko.computed\");var i=n.write,o={M:j,da:!0,V:!0,Ta:!1,Hb:!1,T:!1,Ya:!1,t:!1,od:n.read,sb:t||n.owner,i:n.disposeWhenNodeIsRemoved||n.i||null,ya:n.disposeWhen||n.ya,pb:null,s:{},L:0,fc:null};return r[T]=o,r.$c=\"function\"==typeof i,E.a.la||E.a.extend(r,E.K.fn),E.K.fn.ub(r),E.a.ab(r,k),n.pure?(o.Ya=!0,o.t=!0,E.a.extend(r,C)):n.deferEvaluation&&E.a.extend(r,S),E.options.deferUpdates&&E.Aa.deferred(r,!0),o.i&&(o.Hb=!0,o.i.nodeType||(o.i=null)),o.t||n.deferEvaluation||r.U(),o.i&&r.ca()&&E.a.G.qa(o.i,o.pb=function(){r.k()}),r};var k={equalityComparer:n,Ca:function(){return this[T].L},Sb:function(e,t,n){if(this[T].Ya&&t===this)throw Error(\"A 'pure' computed must not be called recursively\");(this[T].s[e]=n).Ia=this[T].L++,n.pa=t.Pa()},Sa:function(){var e,t,n=this[T].s;for(e in n)if(n.hasOwnProperty(e)&&(t=n[e],this.oa&&t.$.Ha||t.$.Zc(t.pa)))return!0},gd:function(){this.oa&&!this[T].Ta&&this.oa(!1)},ca:function(){var e=this[T];return e.V||0<e.L},qd:function(){this.Ha?this[T].V&&(this[T].da=!0):this.ec()},yc:function(e){if(!e.gb||this[T].i)return e.Y(this.ec,this);var t=e.Y(this.gd,this,\"dirty\"),n=e.Y(this.qd,this);return{$:e,k:function(){t.k(),n.k()}}},ec:function(){var e=this,t=e.throttleEvaluation;t&&0<=t?(clearTimeout(this[T].fc),this[T].fc=E.a.setTimeout(function(){e.U(!0)},t)):e.oa?e.oa(!0):e.U(!0)},U:function(e){var t=this[T],n=t.ya,r=!1;if(!t.Ta&&!t.T){if(t.i&&!E.a.qb(t.i)||n&&n()){if(!t.Hb)return void this.k()}else t.Hb=!1;t.Ta=!0;try{r=this.Vc(e)}finally{t.Ta=!1}return t.L||this.k(),r}},Vc:function(e){var t=this[T],n=!1,r=t.Ya?j:!t.L,i={Mc:this,Oa:t.s,ob:t.L};return E.l.Xb({Lc:i,jb:s,m:this,Va:r}),t.s={},t.L=0,i=this.Uc(t,i),this.Ua(t.M,i)&&(t.t||this.notifySubscribers(t.M,\"beforeChange\"),t.M=i,t.t?this.Kb():e&&this.notifySubscribers(t.M),n=!0),r&&this.notifySubscribers(t.M,\"awake\"),n},Uc:function(e,t){try{var n=e.od;return e.sb?n.call(e.sb):n()}finally{E.l.end(),t.ob&&!e.t&&E.a.D(t.Oa,i),e.da=e.V=!1}},p:function(e){var t=this[T];return(t.V&&(e||!t.L)||t.t&&this.Sa())&&this.U(),t.M},Wa:function(e){E.K.fn.Wa.call(this,e),this.Mb=function(){return this[T].da?this.U():this[T].V=!1,this[T].M},this.oa=function(e){this.Ob(this[T].M),this[T].V=!0,e&&(this[T].da=!0),this.Pb(this)}},k:function(){var e=this[T];!e.t&&e.s&&E.a.D(e.s,function(e,t){t.k&&t.k()}),e.i&&e.pb&&E.a.G.tc(e.i,e.pb),e.s=null,e.L=0,e.T=!0,e.da=!1,e.V=!1,e.t=!1,e.i=null}},C={ua:function(e){var i=this,o=i[T];if(!o.T&&o.t&&\"change\"==e){if(o.t=!1,o.da||i.Sa())o.s=null,o.L=0,i.U()&&i.Kb();else{var n=[];E.a.D(o.s,function(e,t){n[t.Ia]=e}),E.a.r(n,function(e,t){var n=o.s[e],r=i.yc(n.$);r.Ia=t,r.pa=n.pa,o.s[e]=r})}o.T||i.notifySubscribers(o.M,\"awake\")}},Ka:function(e){var n=this[T];n.T||\"change\"!=e||this.Ra(\"change\")||(E.a.D(n.s,function(e,t){t.k&&(n.s[e]={$:t.$,Ia:t.Ia,pa:t.pa},t.k())}),n.t=!0,this.notifySubscribers(j,\"asleep\"))},Pa:function(){var e=this[T];return e.t&&(e.da||this.Sa())&&this.U(),E.K.fn.Pa.call(this)}},S={ua:function(e){\"change\"!=e&&\"beforeChange\"!=e||this.p()}};E.a.la&&E.a.$a(k,E.K.fn);var N,D=E.O.md;E.m[D]=E.O,k[D]=E.m,E.bd=function(e){return E.Qa(e,E.m)},E.cd=function(e){return E.Qa(e,E.m)&&e[T]&&e[T].Ya},E.b(\"computed\",E.m),E.b(\"dependentObservable\",E.m),E.b(\"isComputed\",E.bd),E.b(\"isPureComputed\",E.cd),E.b(\"computed.fn\",k),E.H(k,\"peek\",k.p),E.H(k,\"dispose\",k.k),E.H(k,\"isActive\",k.ca),E.H(k,\"getDependenciesCount\",k.Ca),E.rc=function(e,t){return\"function\"==typeof e?E.m(e,t,{pure:!0}):((e=E.a.extend({},e)).pure=!0,E.m(e,t))},E.b(\"pureComputed\",E.rc),function(){function s(r,i,o){if(o=o||new e,\"object\"!=_typeof(r=i(r))||null===r||r===j||r instanceof RegExp||r instanceof Date||r instanceof String||r instanceof Number||r instanceof Boolean)return r;var a=r instanceof Array?[]:{};return o.save(r,a),function(e,t){if(e instanceof Array){for(var n=0;n<e.length;n++)t(n);\"function\"==typeof e.toJSON&&t(\"toJSON\")}else for(n in e)t(n)}(r,function(e){var t=i(r[e]);switch(_typeof(t)){case\"boolean\":case\"number\":case\"string\":case\"function\":a[e]=t;break;case\"object\":case\"undefined\":var n=o.get(t);a[e]=n!==j?n:s(t,i,o)}}),a}function e(){this.keys=[],this.Lb=[]}E.Ac=function(e){if(0==arguments.length)throw Error(\"When calling ko.toJS, pass the object you want to convert.\");return s(e,function(e){for(var t=0;E.I(e)&&t<10;t++)e=e();return e})},E.toJSON=function(e,t,n){return e=E.Ac(e),E.a.Gb(e,t,n)},e.prototype={save:function(e,t){var n=E.a.o(this.keys,e);0<=n?this.Lb[n]=t:(this.keys.push(e),this.Lb.push(t))},get:function(e){return 0<=(e=E.a.o(this.keys,e))?this.Lb[e]:j}}}(),E.b(\"toJS\",E.Ac),E.b(\"toJSON\",E.toJSON),E.j={u:function(e){switch(E.a.A(e)){case\"option\":return!0===e.__ko__hasDomDataOptionValue__?E.a.e.get(e,E.d.options.zb):E.a.C<=7?e.getAttributeNode(\"value\")&&e.getAttributeNode(\"value\").specified?e.value:e.text:e.value;case\"select\":return 0<=e.selectedIndex?E.j.u(e.options[e.selectedIndex]):j;default:return e.value}},ja:function(e,t,n){switch(E.a.A(e)){case\"option\":switch(_typeof(t)){case\"string\":E.a.e.set(e,E.d.options.zb,j),\"__ko__hasDomDataOptionValue__\"in e&&delete e.__ko__hasDomDataOptionValue__,e.value=t;break;default:E.a.e.set(e,E.d.options.zb,t),e.__ko__hasDomDataOptionValue__=!0,e.value=\"number\"==typeof t?t:\"\"}break;case\"select\":\"\"!==t&&null!==t||(t=j);for(var r,i=-1,o=0,a=e.options.length;o<a;++o)if((r=E.j.u(e.options[o]))==t||\"\"==r&&t===j){i=o;break}(n||0<=i||t===j&&1<e.size)&&(e.selectedIndex=i);break;default:null!==t&&t!==j||(t=\"\"),e.value=t}}},E.b(\"selectExtensions\",E.j),E.b(\"selectExtensions.readValue\",E.j.u),E.b(\"selectExtensions.writeValue\",E.j.ja),E.h=function(){function r(e){123===(e=E.a.cb(e)).charCodeAt(0)&&(e=e.slice(1,-1));var t,n=[],r=e.match(f),i=[],o=0;if(r){r.push(\",\");for(var a,s=0;a=r[s];++s){var u=a.charCodeAt(0);if(44===u){if(o<=0){n.push(t&&i.length?{key:t,value:i.join(\"\")}:{unknown:t||i.join(\"\")}),t=o=0,i=[];continue}}else if(58===u){if(!o&&!t&&1===i.length){t=i.pop();continue}}else 47===u&&s&&1<a.length?(u=r[s-1].match(p))&&!d[u[0]]&&((r=(e=e.substr(e.indexOf(a)+1)).match(f)).push(\",\"),s=-1,a=\"/\"):40===u||123===u||91===u?++o:41===u||125===u||93===u?--o:t||i.length||34!==u&&39!==u||(a=a.slice(1,-1));i.push(a)}}return n}var c=[\"true\",\"false\",\"null\",\"undefined\"],l=/^(?:[$_a-z][$\\w]*|(.+)(\\.\\s*[$_a-z][$\\w]*|\\[.+\\]))$/i,f=RegExp(\"\\\"(?:[^\\\"\\\\\\\\]|\\\\\\\\.)*\\\"|'(?:[^'\\\\\\\\]|\\\\\\\\.)*'|/(?:[^/\\\\\\\\]|\\\\\\\\.)*/w*|[^\\\\s:,/][^,\\\"'{}()/:[\\\\]]*[^\\\\s,\\\"'{}()/:[\\\\]]|[^\\\\s]\",\"g\"),p=/[\\])\"'A-Za-z0-9_$]+$/,d={in:1,return:1,typeof:1},h={};return{va:[],ga:h,Ab:r,Xa:function(e,t){function i(e,t){var n;if(!u){var r=E.getBindingHandler(e);if(r&&r.preprocess&&!(t=r.preprocess(t,e,i)))return;(r=h[e])&&(n=t,r=n=!(0<=E.a.o(c,n))&&null!==(r=n.match(l))&&(r[1]?\"Object(\"+r[1]+\")\"+r[2]:n)),r&&a.push(\"'\"+e+\"':function(_z){\"+n+\"=_z}\")}s&&(t=\"function(){return \"+t+\" }\"),o.push(\"'\"+e+\"':\"+t)}var o=[],a=[],s=(t=t||{}).valueAccessors,u=t.bindingParams,n=\"string\"==typeof e?r(e):e;return E.a.r(n,function(e){i(e.key||e.unknown,e.value)}),a.length&&i(\"_ko_property_writers\",\"{\"+a.join(\",\")+\" }\"),o.join(\",\")},fd:function(e,t){for(var n=0;n<e.length;n++)if(e[n].key==t)return!0;return!1},Ga:function(e,t,n,r,i){e&&E.I(e)?!E.Da(e)||i&&e.p()===r||e(r):(e=t.get(\"_ko_property_writers\"))&&e[n]&&e[n](r)}}}(),E.b(\"expressionRewriting\",E.h),E.b(\"expressionRewriting.bindingRewriteValidators\",E.h.va),E.b(\"expressionRewriting.parseObjectLiteral\",E.h.Ab),E.b(\"expressionRewriting.preProcessBindings\",E.h.Xa),E.b(\"expressionRewriting._twoWayBindings\",E.h.ga),E.b(\"jsonExpressionRewriting\",E.h),E.b(\"jsonExpressionRewriting.insertPropertyAccessorsIntoJson\",E.h.Xa),function(){function o(e){return 8==e.nodeType&&n.test(t?e.text:e.nodeValue)}function a(e){return 8==e.nodeType&&i.test(t?e.text:e.nodeValue)}function r(e,t){for(var n=e,r=1,i=[];n=n.nextSibling;){if(a(n)&&0==--r)return i;i.push(n),o(n)&&r++}if(!t)throw Error(\"Cannot find closing comment tag to match: \"+e.nodeValue);return null}function s(e,t){var n=r(e,t);return n?0<n.length?n[n.length-1].nextSibling:e.nextSibling:null}var t=q&&\"\\x3c!--test--\\x3e\"===q.createComment(\"test\").text,n=t?/^\\x3c!--\\s*ko(?:\\s+([\\s\\S]+))?\\s*--\\x3e$/:/^\\s*ko(?:\\s+([\\s\\S]+))?\\s*$/,i=t?/^\\x3c!--\\s*\\/ko\\s*--\\x3e$/:/^\\s*\\/ko\\s*$/,u={ul:!0,ol:!0};E.f={aa:{},childNodes:function(e){return o(e)?r(e):e.childNodes},za:function(e){if(o(e))for(var t=0,n=(e=E.f.childNodes(e)).length;t<n;t++)E.removeNode(e[t]);else E.a.rb(e)},fa:function(e,t){if(o(e)){E.f.za(e);for(var n=e.nextSibling,r=0,i=t.length;r<i;r++)n.parentNode.insertBefore(t[r],n)}else E.a.fa(e,t)},qc:function(e,t){o(e)?e.parentNode.insertBefore(t,e.nextSibling):e.firstChild?e.insertBefore(t,e.firstChild):e.appendChild(t)},kc:function(e,t,n){n?o(e)?e.parentNode.insertBefore(t,n.nextSibling):n.nextSibling?e.insertBefore(t,n.nextSibling):e.appendChild(t):E.f.qc(e,t)},firstChild:function(e){return o(e)?!e.nextSibling||a(e.nextSibling)?null:e.nextSibling:e.firstChild},nextSibling:function(e){return o(e)&&(e=s(e)),e.nextSibling&&a(e.nextSibling)?null:e.nextSibling},Yc:o,vd:function(e){return(e=(t?e.text:e.nodeValue).match(n))?e[1]:null},oc:function(e){if(u[E.a.A(e)]){var t=e.firstChild;if(t)do{if(1===t.nodeType){var n,r=null;if(n=t.firstChild)do{if(r)r.push(n);else if(o(n)){var i=s(n,!0);i?n=i:r=[n]}else a(n)&&(r=[n])}while(n=n.nextSibling);if(n=r)for(r=t.nextSibling,i=0;i<n.length;i++)r?e.insertBefore(n[i],r):e.appendChild(n[i])}}while(t=t.nextSibling)}}}}(),E.b(\"virtualElements\",E.f),E.b(\"virtualElements.allowedBindings\",E.f.aa),E.b(\"virtualElements.emptyNode\",E.f.za),E.b(\"virtualElements.insertAfter\",E.f.kc),E.b(\"virtualElements.prepend\",E.f.qc),E.b(\"virtualElements.setDomNodeChildren\",E.f.fa),E.S=function(){this.Kc={}},E.a.extend(E.S.prototype,{nodeHasBindings:function(e){switch(e.nodeType){case 1:return null!=e.getAttribute(\"data-bind\")||E.g.getComponentNameForNode(e);case 8:return E.f.Yc(e);default:return!1}},getBindings:function(e,t){var n=(n=this.getBindingsString(e,t))?this.parseBindingsString(n,t,e):null;return E.g.Rb(n,e,t,!1)},getBindingAccessors:function(e,t){var n=(n=this.getBindingsString(e,t))?this.parseBindingsString(n,t,e,{valueAccessors:!0}):null;return E.g.Rb(n,e,t,!0)},getBindingsString:function(e){switch(e.nodeType){case 1:return e.getAttribute(\"data-bind\");case 8:return E.f.vd(e);default:return null}},parseBindingsString:function(t,e,n,r){try{var i,o=this.Kc,a=t+(r&&r.valueAccessors||\"\");if(!(i=o[a])){var s,u=\"with($context){with($data||{}){return{\"+E.h.Xa(t,r)+\"}}}\";s=new Function(\"$context\",\"$element\",u),i=o[a]=s}return i(e,n)}catch(e){throw e.message=\"Unable to parse bindings.\\nBindings value: \"+t+\"\\nMessage: \"+e.message,e}}}),E.S.instance=new E.S,E.b(\"bindingProvider\",E.S),function(){function a(e){return function(){return e}}function g(e){return e()}function s(n){return E.a.Ea(E.l.w(n),function(e,t){return function(){return n()[t]}})}function m(e,t){return s(this.getBindings.bind(this,e,t))}function o(e,t,n){var r,i=E.f.firstChild(t),o=E.S.instance,a=o.preprocessNode;if(a){for(;r=i;)i=E.f.nextSibling(r),a.call(o,r);i=E.f.firstChild(t)}for(;r=i;)i=E.f.nextSibling(r),u(e,r,n)}function u(e,t,n){var r=!0,i=1===t.nodeType;i&&E.f.oc(t),(i&&n||E.S.instance.nodeHasBindings(t))&&(r=c(t,null,e,n).shouldBindDescendants),r&&!f[E.a.A(t)]&&o(e,t,!i)}function c(i,e,o,t){var a,s,r,u,c,l,n=E.a.e.get(i,y);if(!e){if(n)throw Error(\"You cannot apply bindings multiple times to the same element.\");E.a.e.set(i,y,!0)}if(!n&&t&&E.xc(i,o),e&&\"function\"!=typeof e)a=e;else{var f=E.S.instance,p=f.getBindingAccessors||m,d=E.B(function(){return(a=e?e(o,i):p.call(f,i,o))&&o.Q&&o.Q(),a},null,{i:i});a&&d.ca()||(d=null)}if(a){var h=d?function(e){return function(){return g(d()[e])}}:function(e){return a[e]},v=function(){return E.a.Ea(d?d():a,g)};v.get=function(e){return a[e]&&g(h(e))},v.has=function(e){return e in a},r=a,u=[],c={},l=[],E.a.D(r,function t(e){if(!c[e]){var n=E.getBindingHandler(e);n&&(n.after&&(l.push(e),E.a.r(n.after,function(e){if(r[e]){if(-1!==E.a.o(l,e))throw Error(\"Cannot combine the following bindings, because they have a cyclic dependency: \"+l.join(\", \"));t(e)}}),l.length--),u.push({key:e,jc:n})),c[e]=!0}}),t=u,E.a.r(t,function(e){var t=e.jc.init,n=e.jc.update,r=e.key;if(8===i.nodeType&&!E.f.aa[r])throw Error(\"The binding '\"+r+\"' cannot be used with virtual elements\");try{\"function\"==typeof t&&E.l.w(function(){var e=t(i,h(r),v,o.$data,o);if(e&&e.controlsDescendantBindings){if(s!==j)throw Error(\"Multiple bindings (\"+s+\" and \"+r+\") are trying to control descendant bindings of the same element. You cannot use these bindings together on the same element.\");s=r}}),\"function\"==typeof n&&E.B(function(){n(i,h(r),v,o.$data,o)},null,{i:i})}catch(e){throw e.message='Unable to process binding \"'+r+\": \"+a[r]+'\"\\nMessage: '+e.message,e}})}return{shouldBindDescendants:s===j}}function l(e){return e&&e instanceof E.R?e:new E.R(e)}E.d={};var f={script:!0,textarea:!0,template:!0};E.getBindingHandler=function(e){return E.d[e]},E.R=function(n,r,i,o,e){function t(){var e=c?n():n,t=E.a.c(e);return r?(r.Q&&r.Q(),E.a.extend(u,r),u.Q=s):(u.$parents=[],u.$root=t,u.ko=E),u.$rawData=e,u.$data=t,i&&(u[i]=t),o&&o(u,r,t),u.$data}var a,s,u=this,c=\"function\"==typeof n&&!E.I(n);e&&e.exportDependencies?t():(s=E.B(t,null,{ya:function(){return a&&!E.a.Tb(a)},i:!0})).ca()&&((u.Q=s).equalityComparer=null,a=[],s.Dc=function(e){a.push(e),E.a.G.qa(e,function(e){E.a.Na(a,e),a.length||(s.k(),u.Q=s=j)})})},E.R.prototype.createChildContext=function(e,t,n,r){return new E.R(e,this,t,function(e,t){e.$parentContext=t,e.$parent=t.$data,e.$parents=(t.$parents||[]).slice(0),e.$parents.unshift(e.$parent),n&&n(e)},r)},E.R.prototype.extend=function(n){return new E.R(this.Q||this.$data,this,null,function(e,t){e.$rawData=t.$rawData,E.a.extend(e,\"function\"==typeof n?n():n)})},E.R.prototype.ac=function(e,t){return this.createChildContext(e,t,null,{exportDependencies:!0})};var y=E.a.e.J(),n=E.a.e.J();E.xc=function(e,t){if(2!=arguments.length)return E.a.e.get(e,n);E.a.e.set(e,n,t),t.Q&&t.Q.Dc(e)},E.La=function(e,t,n){return 1===e.nodeType&&E.f.oc(e),c(e,t,l(n),!0)},E.Ic=function(e,t,n){return n=l(n),E.La(e,(i=n,o=e,\"function\"==typeof(r=t)?s(r.bind(null,i,o)):E.a.Ea(r,a)),n);var r,i,o},E.hb=function(e,t){1!==t.nodeType&&8!==t.nodeType||o(l(e),t,!0)},E.Ub=function(e,t){if(!M&&_.jQuery&&(M=_.jQuery),t&&1!==t.nodeType&&8!==t.nodeType)throw Error(\"ko.applyBindings: first parameter should be your view model; second parameter should be a DOM node\");t=t||_.document.body,u(l(e),t,!0)},E.nb=function(e){switch(e.nodeType){case 1:case 8:var t=E.xc(e);if(t)return t;if(e.parentNode)return E.nb(e.parentNode)}return j},E.Oc=function(e){return(e=E.nb(e))?e.$data:j},E.b(\"bindingHandlers\",E.d),E.b(\"applyBindings\",E.Ub),E.b(\"applyBindingsToDescendants\",E.hb),E.b(\"applyBindingAccessorsToNode\",E.La),E.b(\"applyBindingsToNode\",E.Ic),E.b(\"contextFor\",E.nb),E.b(\"dataFor\",E.Oc)}(),function(s){function r(r,e){var i,n,o,a=c.hasOwnProperty(r)?c[r]:s;a?a.Y(e):((a=c[r]=new E.K).Y(e),o=function(e,t){var n=!(!t||!t.synchronous);l[r]={definition:e,dd:n},delete c[r],i||n?a.notifySubscribers(e):E.Z.Za(function(){a.notifySubscribers(e)})},u(\"getConfig\",[n=r],function(t){t?u(\"loadComponent\",[n,t],function(e){o(e,t)}):o(null,null)}),i=!0)}function u(t,n,r,i){i||(i=E.g.loaders.slice(0));var e=i.shift();if(e){var o=e[t];if(o){var a=!1;if(o.apply(e,n.concat(function(e){a?r(null):null!==e?r(e):u(t,n,r,i)}))!==s&&(a=!0,!e.suppressLoaderExceptions))throw Error(\"Component loaders must supply values by invoking the callback, not by returning values synchronously.\")}else u(t,n,r,i)}else r(null)}var c={},l={};E.g={get:function(e,t){var n=l.hasOwnProperty(e)?l[e]:s;n?n.dd?E.l.w(function(){t(n.definition)}):E.Z.Za(function(){t(n.definition)}):r(e,t)},$b:function(e){delete l[e]},Nb:u},E.g.loaders=[],E.b(\"components\",E.g),E.b(\"components.get\",E.g.get),E.b(\"components.clearCachedDefinition\",E.g.$b)}(),function(){function i(e){switch(E.a.A(e)){case\"script\":return E.a.na(e.text);case\"textarea\":return E.a.na(e.value);case\"template\":if(o(e.content))return E.a.wa(e.content.childNodes)}return E.a.wa(e.childNodes)}function o(e){return _.DocumentFragment?e instanceof DocumentFragment:e&&11===e.nodeType}function u(e,t,n){\"string\"==typeof t.require?r||_.require?(r||_.require)([t.require],n):e(\"Uses require, but no AMD loader is present\"):n(t)}function a(t){return function(e){throw Error(\"Component '\"+t+\"': \"+e)}}var n={};E.g.register=function(e,t){if(!t)throw Error(\"Invalid configuration for \"+e);if(E.g.wb(e))throw Error(\"Component \"+e+\" is already registered\");n[e]=t},E.g.wb=function(e){return n.hasOwnProperty(e)},E.g.ud=function(e){delete n[e],E.g.$b(e)},E.g.cc={getConfig:function(e,t){t(n.hasOwnProperty(e)?n[e]:null)},loadComponent:function(t,e,n){var r=a(t);u(r,e,function(e){!function(t,e,n,r){function i(){0==--a&&r(o)}var o={},a=2,s=n.template;n=n.viewModel,s?u(e,s,function(e){E.g.Nb(\"loadTemplate\",[t,e],function(e){o.template=e,i()})}):i(),n?u(e,n,function(e){E.g.Nb(\"loadViewModel\",[t,e],function(e){o[c]=e,i()})}):i()}(t,r,e,n)})},loadTemplate:function(e,t,n){if(e=a(e),\"string\"==typeof t)n(E.a.na(t));else if(t instanceof Array)n(t);else if(o(t))n(E.a.W(t.childNodes));else if(t.element)if(t=t.element,_.HTMLElement?t instanceof HTMLElement:t&&t.tagName&&1===t.nodeType)n(i(t));else if(\"string\"==typeof t){var r=q.getElementById(t);r?n(i(r)):e(\"Cannot find element with ID \"+t)}else e(\"Unknown element type: \"+t);else e(\"Unknown template value: \"+t)},loadViewModel:function(e,t,n){!function e(t,n,r){if(\"function\"==typeof n)r(function(e){return new n(e)});else if(\"function\"==typeof n[c])r(n[c]);else if(\"instance\"in n){var i=n.instance;r(function(){return i})}else\"viewModel\"in n?e(t,n.viewModel,r):t(\"Unknown viewModel value: \"+n)}(a(e),t,n)}};var c=\"createViewModel\";E.b(\"components.register\",E.g.register),E.b(\"components.isRegistered\",E.g.wb),E.b(\"components.unregister\",E.g.ud),E.b(\"components.defaultLoader\",E.g.cc),E.g.loaders.push(E.g.cc),E.g.Ec=n}(),function(){E.g.getComponentNameForNode=function(e){var t=E.a.A(e);if(E.g.wb(t)&&(-1!=t.indexOf(\"-\")||\"[object HTMLUnknownElement]\"==\"\"+e||E.a.C<=8&&e.tagName===t))return t},E.g.Rb=function(e,t,n,r){if(1===t.nodeType){var i=E.g.getComponentNameForNode(t);if(i){if((e=e||{}).component)throw Error('Cannot use the \"component\" binding on a custom element matching a component');var o={name:i,params:function(n,e){if(t=n.getAttribute(\"params\")){var t=a.parseBindingsString(t,e,n,{valueAccessors:!0,bindingParams:!0}),r=(t=E.a.Ea(t,function(e){return E.m(e,null,{i:n})}),E.a.Ea(t,function(t){var e=t.p();return t.ca()?E.m({read:function(){return E.a.c(t())},write:E.Da(e)&&function(e){t()(e)},i:n}):e}));return r.hasOwnProperty(\"$raw\")||(r.$raw=t),r}return{$raw:{}}}(t,n)};e.component=r?function(){return o}:o}}return e};var r,t,a=new E.S;E.a.C<9&&(E.g.register=(t=E.g.register,function(e){return q.createElement(e),t.apply(this,arguments)}),q.createDocumentFragment=(r=q.createDocumentFragment,function(){var e,t=r(),n=E.g.Ec;for(e in n)n.hasOwnProperty(e)&&t.createElement(e);return t}))}(),N=0,E.d.component={init:function(l,t,e,n,f){function p(){var e=d&&d.dispose;\"function\"==typeof e&&e.call(d),h=d=null}var d,h,v=E.a.W(E.f.childNodes(l));return E.a.G.qa(l,p),E.m(function(){var s,u,e=E.a.c(t());if(\"string\"==typeof e?s=e:(s=E.a.c(e.name),u=E.a.c(e.params)),!s)throw Error(\"No component name specified\");var c=h=++N;E.g.get(s,function(e){if(h===c){if(p(),!e)throw Error(\"Unknown component '\"+s+\"'\");!function(e,t,n){if(!(t=t.template))throw Error(\"Component '\"+e+\"' has no template\");e=E.a.wa(t),E.f.fa(n,e)}(s,e,l);var t=(r=l,i=v,o=u,(a=(n=e).createViewModel)?a.call(n,o,{element:r,templateNodes:i}):o);e=f.createChildContext(t,void 0,function(e){e.$component=t,e.$componentTemplateNodes=v}),d=t,E.hb(e,l)}var n,r,i,o,a})},null,{i:l}),{controlsDescendantBindings:!0}}},E.f.aa.component=!0;var A={class:\"className\",for:\"htmlFor\"};E.d.attr={update:function(r,e){var t=E.a.c(e())||{};E.a.D(t,function(e,t){var n=!1===(t=E.a.c(t))||null===t||t===j;n&&r.removeAttribute(e),E.a.C<=8&&e in A?(e=A[e],n?r.removeAttribute(e):r[e]=t):n||r.setAttribute(e,t.toString()),\"name\"===e&&E.a.vc(r,n?\"\":t.toString())})}},E.d.checked={after:[\"value\",\"attr\"],init:function(i,o,a){function e(){var e=i.checked,t=p?s():e;if(!E.xa.Va()&&(!u||e)){var n=E.l.w(o);if(c){var r=l?n.p():n;f!==t?(e&&(E.a.ra(r,t,!0),E.a.ra(r,f,!1)),f=t):E.a.ra(r,t,e),l&&E.Da(n)&&n(r)}else E.h.Ga(n,a,\"checked\",t,!0)}}var s=E.rc(function(){return a.has(\"checkedValue\")?E.a.c(a.get(\"checkedValue\")):a.has(\"value\")?E.a.c(a.get(\"value\")):i.value}),t=\"checkbox\"==i.type,u=\"radio\"==i.type;if(t||u){var n=o(),c=t&&E.a.c(n)instanceof Array,l=!(c&&n.push&&n.splice),f=c?s():j,p=u||c;u&&!i.name&&E.d.uniqueName.init(i,function(){return!0}),E.m(e,null,{i:i}),E.a.q(i,\"click\",e),E.m(function(){var e=E.a.c(o());i.checked=c?0<=E.a.o(e,s()):t?e:s()===e},null,{i:i}),n=j}}},E.h.ga.checked=!0,E.d.checkedValue={update:function(e,t){e.value=E.a.c(t())}},E.d.css={update:function(n,e){var t=E.a.c(e());null!==t&&\"object\"==_typeof(t)?E.a.D(t,function(e,t){t=E.a.c(t),E.a.fb(n,e,t)}):(t=E.a.cb(String(t||\"\")),E.a.fb(n,n.__ko__cssValue,!1),n.__ko__cssValue=t,E.a.fb(n,t,!0))}},E.d.enable={update:function(e,t){var n=E.a.c(t());n&&e.disabled?e.removeAttribute(\"disabled\"):n||e.disabled||(e.disabled=!0)}},E.d.disable={update:function(e,t){E.d.enable.update(e,function(){return!E.a.c(t())})}},E.d.event={init:function(e,o,a,s,u){var t=o()||{};E.a.D(t,function(i){\"string\"==typeof i&&E.a.q(e,i,function(e){var t,n=o()[i];if(n){try{var r=E.a.W(arguments);s=u.$data,r.unshift(s),t=n.apply(s,r)}finally{!0!==t&&(e.preventDefault?e.preventDefault():e.returnValue=!1)}!1===a.get(i+\"Bubble\")&&(e.cancelBubble=!0,e.stopPropagation&&e.stopPropagation())}})})}},E.d.foreach={mc:function(n){return function(){var e=n(),t=E.a.Bb(e);return t&&\"number\"!=typeof t.length?(E.a.c(e),{foreach:t.data,as:t.as,includeDestroyed:t.includeDestroyed,afterAdd:t.afterAdd,beforeRemove:t.beforeRemove,afterRender:t.afterRender,beforeMove:t.beforeMove,afterMove:t.afterMove,templateEngine:E.X.vb}):{foreach:e,templateEngine:E.X.vb}}},init:function(e,t){return E.d.template.init(e,E.d.foreach.mc(t))},update:function(e,t,n,r,i){return E.d.template.update(e,E.d.foreach.mc(t),n,r,i)}},E.h.va.foreach=!1,E.f.aa.foreach=!0,E.d.hasfocus={init:function(r,i,o){function e(e){r.__ko_hasfocusUpdating=!0;var t=r.ownerDocument;if(\"activeElement\"in t){var n;try{n=t.activeElement}catch(e){n=t.body}e=n===r}t=i(),E.h.Ga(t,o,\"hasfocus\",e,!0),r.__ko_hasfocusLastValue=e,r.__ko_hasfocusUpdating=!1}var t=e.bind(null,!0),n=e.bind(null,!1);E.a.q(r,\"focus\",t),E.a.q(r,\"focusin\",t),E.a.q(r,\"blur\",n),E.a.q(r,\"focusout\",n)},update:function(e,t){var n=!!E.a.c(t());e.__ko_hasfocusUpdating||e.__ko_hasfocusLastValue===n||(n?e.focus():e.blur(),!n&&e.__ko_hasfocusLastValue&&e.ownerDocument.body.focus(),E.l.w(E.a.Fa,null,[e,n?\"focusin\":\"focusout\"]))}},E.h.ga.hasfocus=!0,E.d.hasFocus=E.d.hasfocus,E.h.ga.hasFocus=!0,E.d.html={init:function(){return{controlsDescendantBindings:!0}},update:function(e,t){E.a.Eb(e,t())}},t(\"if\"),t(\"ifnot\",!1,!0),t(\"with\",!0,!1,function(e,t){return e.ac(t)});var O={};E.d.options={init:function(e){if(\"select\"!==E.a.A(e))throw Error(\"options binding applies only to SELECT elements\");for(;0<e.length;)e.remove(0);return{controlsDescendantBindings:!0}},update:function(r,e,i){function t(){return E.a.Ma(r.options,function(e){return e.selected})}function o(e,t,n){var r=_typeof(t);return\"function\"==r?t(e):\"string\"==r?e[t]:n}function n(e,t){if(d&&c)E.j.ja(r,E.a.c(i.get(\"value\")),!0);else if(p.length){var n=0<=E.a.o(p,E.j.u(t[0]));E.a.wc(t[0],n),d&&!n&&E.l.w(E.a.Fa,null,[r,\"change\"])}}var a=r.multiple,s=0!=r.length&&a?r.scrollTop:null,u=E.a.c(e()),c=i.get(\"valueAllowUnset\")&&i.has(\"value\"),l=i.get(\"optionsIncludeDestroyed\");e={};var f,p=[];c||(a?p=E.a.ib(t(),E.j.u):0<=r.selectedIndex&&p.push(E.j.u(r.options[r.selectedIndex]))),u&&(void 0===u.length&&(u=[u]),f=E.a.Ma(u,function(e){return l||e===j||null===e||!E.a.c(e._destroy)}),i.has(\"optionsCaption\")&&null!==(u=E.a.c(i.get(\"optionsCaption\")))&&u!==j&&f.unshift(O));var d=!1;e.beforeRemove=function(e){r.removeChild(e)},u=n,i.has(\"optionsAfterRender\")&&\"function\"==typeof i.get(\"optionsAfterRender\")&&(u=function(e,t){n(0,t),E.l.w(i.get(\"optionsAfterRender\"),null,[t[0],e!==O?e:j])}),E.a.Db(r,f,function(e,t,n){return n.length&&(p=!c&&n[0].selected?[E.j.u(n[0])]:[],d=!0),t=r.ownerDocument.createElement(\"option\"),e===O?(E.a.bb(t,i.get(\"optionsCaption\")),E.j.ja(t,j)):(n=o(e,i.get(\"optionsValue\"),e),E.j.ja(t,E.a.c(n)),e=o(e,i.get(\"optionsText\"),n),E.a.bb(t,e)),[t]},e,u),E.l.w(function(){c?E.j.ja(r,E.a.c(i.get(\"value\")),!0):(a?p.length&&t().length<p.length:p.length&&0<=r.selectedIndex?E.j.u(r.options[r.selectedIndex])!==p[0]:p.length||0<=r.selectedIndex)&&E.a.Fa(r,\"change\")}),E.a.Sc(r),s&&20<Math.abs(s-r.scrollTop)&&(r.scrollTop=s)}},E.d.options.zb=E.a.e.J(),E.d.selectedOptions={after:[\"options\",\"foreach\"],init:function(n,r,i){E.a.q(n,\"change\",function(){var e=r(),t=[];E.a.r(n.getElementsByTagName(\"option\"),function(e){e.selected&&t.push(E.j.u(e))}),E.h.Ga(e,i,\"selectedOptions\",t)})},update:function(e,t){if(\"select\"!=E.a.A(e))throw Error(\"values binding applies only to SELECT elements\");var n=E.a.c(t()),r=e.scrollTop;n&&\"number\"==typeof n.length&&E.a.r(e.getElementsByTagName(\"option\"),function(e){var t=0<=E.a.o(n,E.j.u(e));e.selected!=t&&E.a.wc(e,t)}),e.scrollTop=r}},E.h.ga.selectedOptions=!0,E.d.style={update:function(n,e){var t=E.a.c(e()||{});E.a.D(t,function(e,t){null!==(t=E.a.c(t))&&t!==j&&!1!==t||(t=\"\"),n.style[e]=t})}},E.d.submit={init:function(r,i,e,t,o){if(\"function\"!=typeof i())throw Error(\"The value for a submit binding must be a function\");E.a.q(r,\"submit\",function(e){var t,n=i();try{t=n.call(o.$data,r)}finally{!0!==t&&(e.preventDefault?e.preventDefault():e.returnValue=!1)}})}},E.d.text={init:function(){return{controlsDescendantBindings:!0}},update:function(e,t){E.a.bb(e,t())}},E.f.aa.text=!0,function(){if(_&&_.navigator)var e=function(e){if(e)return parseFloat(e[1])},l=_.opera&&_.opera.version&&parseInt(_.opera.version()),t=_.navigator.userAgent,f=e(t.match(/^(?:(?!chrome).)*version\\/([^ ]*) safari/i)),p=e(t.match(/Firefox\\/([^ ]*)/));if(E.a.C<10)var r=E.a.e.J(),i=E.a.e.J(),o=function(e){var t=this.activeElement;(t=t&&E.a.e.get(t,i))&&t(e)},d=function(e,t){var n=e.ownerDocument;E.a.e.get(n,r)||(E.a.e.set(n,r,!0),E.a.q(n,\"selectionchange\",o)),E.a.e.set(e,i,t)};E.d.textInput={init:function(n,r,t){function e(e,t){E.a.q(n,e,t)}function i(){a||(s=n.value,a=E.a.setTimeout(o,4))}function o(){clearTimeout(a),s=a=j;var e=n.value;u!==e&&(u=e,E.h.Ga(r(),t,\"textInput\",e))}var a,s,u=n.value,c=9==E.a.C?i:o;E.a.C<10?(e(\"propertychange\",function(e){\"value\"===e.propertyName&&c(e)}),8==E.a.C&&(e(\"keyup\",o),e(\"keydown\",o)),8<=E.a.C&&(d(n,c),e(\"dragend\",i))):(e(\"input\",o),f<5&&\"textarea\"===E.a.A(n)?(e(\"keydown\",i),e(\"paste\",i),e(\"cut\",i)):l<11?e(\"keydown\",i):p<4&&(e(\"DOMAutoComplete\",o),e(\"dragdrop\",o),e(\"drop\",o))),e(\"change\",o),E.m(function e(){var t=E.a.c(r());null!==t&&t!==j||(t=\"\"),s!==j&&t===s?E.a.setTimeout(e,4):n.value!==t&&(u=t,n.value=t)},null,{i:n})}},E.h.ga.textInput=!0,E.d.textinput={preprocess:function(e,t,n){n(\"textInput\",e)}}}(),E.d.uniqueName={init:function(e,t){if(t()){var n=\"ko_unique_\"+ ++E.d.uniqueName.Nc;E.a.vc(e,n)}}},E.d.uniqueName.Nc=0,E.d.value={after:[\"options\",\"foreach\"],init:function(i,o,a){if(\"input\"!=i.tagName.toLowerCase()||\"checkbox\"!=i.type&&\"radio\"!=i.type){var e=[\"change\"],t=a.get(\"valueUpdate\"),n=!1,s=null;t&&(\"string\"==typeof t&&(t=[t]),E.a.ta(e,t),e=E.a.Wb(e));var r=function(){s=null,n=!1;var e=o(),t=E.j.u(i);E.h.Ga(e,a,\"value\",t)};!E.a.C||\"input\"!=i.tagName.toLowerCase()||\"text\"!=i.type||\"off\"==i.autocomplete||i.form&&\"off\"==i.form.autocomplete||-1!=E.a.o(e,\"propertychange\")||(E.a.q(i,\"propertychange\",function(){n=!0}),E.a.q(i,\"focus\",function(){n=!1}),E.a.q(i,\"blur\",function(){n&&r()})),E.a.r(e,function(e){var t=r;E.a.sd(e,\"after\")&&(t=function(){s=E.j.u(i),E.a.setTimeout(r,0)},e=e.substring(5)),E.a.q(i,e,t)}),E.m(function e(){var t=E.a.c(o()),n=E.j.u(i);if(null!==s&&t===s)E.a.setTimeout(e,0);else if(t!==n)if(\"select\"===E.a.A(i)){var r=a.get(\"valueAllowUnset\");(n=function(){E.j.ja(i,t,r)})(),r||t===E.j.u(i)?E.a.setTimeout(n,0):E.l.w(E.a.Fa,null,[i,\"change\"])}else E.j.ja(i,t)},null,{i:i})}else E.La(i,{checkedValue:o})},update:function(){}},E.h.ga.value=!0,E.d.visible={update:function(e,t){var n=E.a.c(t()),r=\"none\"!=e.style.display;n&&!r?e.style.display=\"\":!n&&r&&(e.style.display=\"none\")}},E.d.click={init:function(e,t,n,r,i){return E.d.event.init.call(this,e,function(){var e={};return e.click=t(),e},n,r,i)}},E.P=function(){},E.P.prototype.renderTemplateSource=function(){throw Error(\"Override renderTemplateSource\")},E.P.prototype.createJavaScriptEvaluatorBlock=function(){throw Error(\"Override createJavaScriptEvaluatorBlock\")},E.P.prototype.makeTemplateSource=function(e,t){if(\"string\"==typeof e){var n=(t=t||q).getElementById(e);if(!n)throw Error(\"Cannot find template with ID \"+e);return new E.v.n(n)}if(1==e.nodeType||8==e.nodeType)return new E.v.sa(e);throw Error(\"Unknown template type: \"+e)},E.P.prototype.renderTemplate=function(e,t,n,r){return e=this.makeTemplateSource(e,r),this.renderTemplateSource(e,t,n,r)},E.P.prototype.isTemplateRewritten=function(e,t){return!1===this.allowTemplateRewriting||this.makeTemplateSource(e,t).data(\"isRewritten\")},E.P.prototype.rewriteTemplate=function(e,t,n){t=t((e=this.makeTemplateSource(e,n)).text()),e.text(t),e.data(\"isRewritten\",!0)},E.b(\"templateEngine\",E.P),E.Ib=function(){function a(e,t,n,r){e=E.h.Ab(e);for(var i=E.h.va,o=0;o<e.length;o++){var a=e[o].key;if(i.hasOwnProperty(a)){var s=i[a];if(\"function\"==typeof s){if(a=s(e[o].value))throw Error(a)}else if(!s)throw Error(\"This template engine does not support the '\"+a+\"' binding within its templates\")}}return n=\"ko.__tr_ambtns(function($context,$element){return(function(){return{ \"+E.h.Xa(e,{valueAccessors:!0})+\" } })()},'\"+n.toLowerCase()+\"')\",r.createJavaScriptEvaluatorBlock(n)+t}var t=/(<([a-z]+\\d*)(?:\\s+(?!data-bind\\s*=\\s*)[a-z0-9\\-]+(?:=(?:\\\"[^\\\"]*\\\"|\\'[^\\']*\\'|[^>]*))?)*\\s+)data-bind\\s*=\\s*([\"'])([\\s\\S]*?)\\3/gi,n=/\\x3c!--\\s*ko\\b\\s*([\\s\\S]*?)\\s*--\\x3e/g;return{Tc:function(e,t,n){t.isTemplateRewritten(e,n)||t.rewriteTemplate(e,function(e){return E.Ib.jd(e,t)},n)},jd:function(e,o){return e.replace(t,function(e,t,n,r,i){return a(i,t,n,o)}).replace(n,function(e,t){return a(t,\"\\x3c!-- ko --\\x3e\",\"#comment\",o)})},Jc:function(r,i){return E.N.yb(function(e,t){var n=e.nextSibling;n&&n.nodeName.toLowerCase()===i&&E.La(n,r,t)})}}}(),E.b(\"__tr_ambtns\",E.Ib.Jc),function(){E.v={},E.v.n=function(e){if(this.n=e){var t=E.a.A(e);this.eb=\"script\"===t?1:\"textarea\"===t?2:\"template\"==t&&e.content&&11===e.content.nodeType?3:4}},E.v.n.prototype.text=function(){var e=1===this.eb?\"text\":2===this.eb?\"value\":\"innerHTML\";if(0==arguments.length)return this.n[e];var t=arguments[0];\"innerHTML\"===e?E.a.Eb(this.n,t):this.n[e]=t};var t=E.a.e.J()+\"_\";E.v.n.prototype.data=function(e){if(1===arguments.length)return E.a.e.get(this.n,t+e);E.a.e.set(this.n,t+e,arguments[1])};var n=E.a.e.J();E.v.n.prototype.nodes=function(){var e=this.n;if(0==arguments.length)return(E.a.e.get(e,n)||{}).mb||(3===this.eb?e.content:4===this.eb?e:j);E.a.e.set(e,n,{mb:arguments[0]})},E.v.sa=function(e){this.n=e},E.v.sa.prototype=new E.v.n,E.v.sa.prototype.text=function(){if(0==arguments.length){var e=E.a.e.get(this.n,n)||{};return e.Jb===j&&e.mb&&(e.Jb=e.mb.innerHTML),e.Jb}E.a.e.set(this.n,n,{Jb:arguments[0]})},E.b(\"templateSources\",E.v),E.b(\"templateSources.domElement\",E.v.n),E.b(\"templateSources.anonymousTemplate\",E.v.sa)}(),function(){function r(e,t,n){var r;for(t=E.f.nextSibling(t);e&&(r=e)!==t;)n(r,e=E.f.nextSibling(r))}function c(e,t){if(e.length){var i=e[0],o=e[e.length-1],n=i.parentNode,a=E.S.instance,s=a.preprocessNode;if(s){if(r(i,o,function(e,t){var n=e.previousSibling,r=s.call(a,e);r&&(e===i&&(i=r[0]||t),e===o&&(o=r[r.length-1]||n))}),e.length=0,!i)return;i===o?e.push(i):(e.push(i,o),E.a.Ba(e,n))}r(i,o,function(e){1!==e.nodeType&&8!==e.nodeType||E.Ub(t,e)}),r(i,o,function(e){1!==e.nodeType&&8!==e.nodeType||E.N.Cc(e,[t])}),E.a.Ba(e,n)}}function u(e){return e.nodeType?e:0<e.length?e[0]:null}function l(e,t,n,r,i){i=i||{};var o=(e&&u(e)||n||{}).ownerDocument,a=i.templateEngine||p;if(E.Ib.Tc(n,a,o),\"number\"!=typeof(n=a.renderTemplate(n,r,i,o)).length||0<n.length&&\"number\"!=typeof n[0].nodeType)throw Error(\"Template engine must return an array of DOM nodes\");switch(o=!1,t){case\"replaceChildren\":E.f.fa(e,n),o=!0;break;case\"replaceNode\":E.a.uc(e,n),o=!0;break;case\"ignoreTargetNode\":break;default:throw Error(\"Unknown renderMode: \"+t)}return o&&(c(n,r),i.afterRender&&E.l.w(i.afterRender,null,[n,r.$data])),n}function f(e,t,n){return E.I(e)?e():\"function\"==typeof e?e(t,n):e}var p;E.Fb=function(e){if(e!=j&&!(e instanceof E.P))throw Error(\"templateEngine must inherit from ko.templateEngine\");p=e},E.Cb=function(n,r,i,o,a){if(((i=i||{}).templateEngine||p)==j)throw Error(\"Set a template engine before calling renderTemplate\");if(a=a||\"replaceChildren\",o){var s=u(o);return E.B(function(){var e=r&&r instanceof E.R?r:new E.R(r,null,null,null,{exportDependencies:!0}),t=f(n,e.$data,e);e=l(o,a,t,e,i),\"replaceNode\"==a&&(s=u(o=e))},null,{ya:function(){return!s||!E.a.qb(s)},i:s&&\"replaceNode\"==a?s.parentNode:s})}return E.N.yb(function(e){E.Cb(n,r,i,e,\"replaceNode\")})},E.pd=function(n,t,r,i,o){function a(e,t){c(t,u),r.afterRender&&r.afterRender(t,e),u=null}function s(e,t){return u=o.createChildContext(e,r.as,function(e){e.$index=t}),l(null,\"ignoreTargetNode\",f(n,e,u),u,r)}var u;return E.B(function(){var e=E.a.c(t)||[];void 0===e.length&&(e=[e]),e=E.a.Ma(e,function(e){return r.includeDestroyed||e===j||null===e||!E.a.c(e._destroy)}),E.l.w(E.a.Db,null,[i,e,s,r,a])},null,{i:i})};var a=E.a.e.J();E.d.template={init:function(e,t){var n=E.a.c(t());if(\"string\"==typeof n||n.name)E.f.za(e);else{if(\"nodes\"in n){if(n=n.nodes||[],E.I(n))throw Error('The \"nodes\" option must be a plain, non-observable array.')}else n=E.f.childNodes(e);n=E.a.nc(n),new E.v.sa(e).nodes(n)}return{controlsDescendantBindings:!0}},update:function(e,t,n,r,i){var o=t();n=!0,r=null,\"string\"==typeof(t=E.a.c(o))?t={}:(o=t.name,\"if\"in t&&(n=E.a.c(t.if)),n&&\"ifnot\"in t&&(n=!E.a.c(t.ifnot))),\"foreach\"in t?r=E.pd(o||e,n&&t.foreach||[],t,e,i):n?(i=\"data\"in t?i.ac(t.data,t.as):i,r=E.Cb(o||e,i,t,e)):E.f.za(e),i=r,(t=E.a.e.get(e,a))&&\"function\"==typeof t.k&&t.k(),E.a.e.set(e,a,i&&i.ca()?i:j)}},E.h.va.template=function(e){return 1==(e=E.h.Ab(e)).length&&e[0].unknown||E.h.fd(e,\"name\")?null:\"This template engine does not support anonymous templates nested within its templates\"},E.f.aa.template=!0}(),E.b(\"setTemplateEngine\",E.Fb),E.b(\"renderTemplate\",E.Cb),E.a.hc=function(e,t,n){var r,i,o,a,s;if(e.length&&t.length)for(r=i=0;(!n||r<n)&&(a=e[i]);++i){for(o=0;s=t[o];++o)if(a.value===s.value){a.moved=s.index,s.moved=a.index,t.splice(o,1),r=o=0;break}r+=o}},E.a.lb=function(){function r(e,t,n,r,i){var o,a,s,u,c,l=Math.min,f=Math.max,p=[],d=e.length,h=t.length,v=h-d||1,g=d+h+1;for(o=0;o<=d;o++)for(u=s,p.push(s=[]),c=l(h,o+v),a=f(0,o-1);a<=c;a++)s[a]=a?o?e[o-1]===t[a-1]?u[a-1]:l(u[a]||g,s[a-1]||g)+1:a+1:o+1;for(l=[],f=[],v=[],o=d,a=h;o||a;)h=p[o][a]-1,a&&h===p[o][a-1]?f.push(l[l.length]={status:n,value:t[--a],index:a}):o&&h===p[o-1][a]?v.push(l[l.length]={status:r,value:e[--o],index:o}):(--a,--o,i.sparse||l.push({status:\"retained\",value:t[a]}));return E.a.hc(v,f,!i.dontLimitMoves&&10*d),l.reverse()}return function(e,t,n){return n=\"boolean\"==typeof n?{dontLimitMoves:n}:n||{},t=t||[],(e=e||[]).length<t.length?r(e,t,\"added\",\"deleted\",n):r(t,e,\"deleted\",\"added\",n)}}(),E.b(\"utils.compareArrays\",E.a.lb),function(){function T(t,n,r,i,o){var a=[],e=E.B(function(){var e=n(r,o,E.a.Ba(a,t))||[];0<a.length&&(E.a.uc(a,e),i&&E.l.w(i,null,[r,e,o])),a.length=0,E.a.ta(a,e)},null,{i:t,ya:function(){return!E.a.Tb(a)}});return{ea:a,B:e.ca()?e:j}}var k=E.a.e.J(),C=E.a.e.J();E.a.Db=function(n,e,t,r,i){function o(e,t){m=c[t],h!==t&&(w[e]=m),m.tb(h++),E.a.Ba(m.ea,n),p.push(m),g.push(m)}function a(t,n){if(t)for(var r=0,e=n.length;r<e;r++)n[r]&&E.a.r(n[r].ea,function(e){t(e,r,n[r].ka)})}e=e||[],r=r||{};var s,u=E.a.e.get(n,k)===j,c=E.a.e.get(n,k)||[],l=E.a.ib(c,function(e){return e.ka}),f=E.a.lb(l,e,r.dontLimitMoves),p=[],d=0,h=0,v=[],g=[];e=[];for(var m,y,b,w=[],x=(l=[],0);y=f[x];x++)switch(b=y.moved,y.status){case\"deleted\":b===j&&((m=c[d]).B&&(m.B.k(),m.B=j),E.a.Ba(m.ea,n).length&&(r.beforeRemove&&(p.push(m),g.push(m),m.ka===C?m=null:e[x]=m),m&&v.push.apply(v,m.ea))),d++;break;case\"retained\":o(x,d++);break;case\"added\":b!==j?o(x,b):(m={ka:y.value,tb:E.O(h++)},p.push(m),g.push(m),u||(l[x]=m))}for(E.a.e.set(n,k,p),a(r.beforeMove,w),E.a.r(v,r.beforeRemove?E.ba:E.removeNode),x=0,u=E.f.firstChild(n);m=g[x];x++){for(m.ea||E.a.extend(m,T(n,t,m.ka,i,m.tb)),d=0;f=m.ea[d];u=f.nextSibling,s=f,d++)f!==u&&E.f.kc(n,f,s);!m.ad&&i&&(i(m.ka,m.ea,m.tb),m.ad=!0)}for(a(r.beforeRemove,e),x=0;x<e.length;++x)e[x]&&(e[x].ka=C);a(r.afterMove,w),a(r.afterAdd,l)}}(),E.b(\"utils.setDomNodeChildrenFromArrayMapping\",E.a.Db),E.X=function(){this.allowTemplateRewriting=!1},E.X.prototype=new E.P,E.X.prototype.renderTemplateSource=function(e,t,n,r){return(t=E.a.C<9||!e.nodes?null:e.nodes())?E.a.W(t.cloneNode(!0).childNodes):(e=e.text(),E.a.na(e,r))},E.X.vb=new E.X,E.Fb(E.X.vb),E.b(\"nativeTemplateEngine\",E.X),function(){E.xb=function(){var o=this.ed=function(){if(!M||!M.tmpl)return 0;try{if(0<=M.tmpl.tag.tmpl.open.toString().indexOf(\"__\"))return 2}catch(e){}return 1}();this.renderTemplateSource=function(e,t,n,r){if(r=r||q,n=n||{},o<2)throw Error(\"Your version of jQuery.tmpl is too old. Please upgrade to jQuery.tmpl 1.0.0pre or later.\");var i=e.data(\"precompiled\");return i||(i=e.text()||\"\",i=M.template(null,\"{{ko_with $item.koBindingContext}}\"+i+\"{{/ko_with}}\"),e.data(\"precompiled\",i)),e=[t.$data],t=M.extend({koBindingContext:t},n.templateOptions),(t=M.tmpl(i,e,t)).appendTo(r.createElement(\"div\")),M.fragments={},t},this.createJavaScriptEvaluatorBlock=function(e){return\"{{ko_code ((function() { return \"+e+\" })()) }}\"},this.addTemplate=function(e,t){q.write(\"<script type='text/html' id='\"+e+\"'>\"+t+\"<\\/script>\")},0<o&&(M.tmpl.tag.ko_code={open:\"__.push($1 || '');\"},M.tmpl.tag.ko_with={open:\"with($1) {\",close:\"} \"})},E.xb.prototype=new E.P;var e=new E.xb;0<e.ed&&E.Fb(e),E.b(\"jqueryTmplTemplateEngine\",E.xb)}()},\"function\"==typeof define&&define.amd?define([\"exports\",\"require\"],e):\"object\"===(\"undefined\"==typeof exports?\"undefined\":_typeof(exports))&&\"object\"===(\"undefined\"==typeof module?\"undefined\":_typeof(module))?e(module.exports||exports):e(_.ko={})}(),function(e){if(\"function\"==typeof require&&\"object\"===(\"undefined\"==typeof exports?\"undefined\":_typeof(exports))&&\"object\"===(\"undefined\"==typeof module?\"undefined\":_typeof(module)))e(require(\"knockout\"),exports);else if(\"function\"==typeof define&&define.amd)define([\"knockout\",\"exports\"],e);else{if(\"undefined\"==typeof ko)throw new Error(\"Knockout is required, please ensure it is loaded before loading this mapping plug-in\");e(ko,ko.mapping={})}}(function(H,R){H.mapping=R;var I,$,u=!0,F=\"__ko_mapping__\",c=H.dependentObservable,o=0,a=[\"create\",\"update\",\"key\",\"arrayChanged\"],W={},e={include:[\"_destroy\"],ignore:[],copy:[],observe:[]},s=e;function l(){for(var e,t,n,r=arguments,i=r.length,o={},a=[];i--;)for(e=(n=r[i]).length;e--;)o[t=n[e]]||(o[t]=1,a.push(t));return a}function f(e,t){var n;for(var r in t)if(t.hasOwnProperty(r)&&t[r])if(n=R.getType(e[r]),r&&e[r]&&\"array\"!==n&&\"string\"!==n)f(e[r],t[r]);else{var i=\"array\"===R.getType(e[r])&&\"array\"===R.getType(t[r]);e[r]=i?l(e[r],t[r]):t[r]}}function V(e,t){var n={};return f(n,e),f(n,t),n}function g(e,t){for(var n=V({},e),r=a.length-1;0<=r;r--){var i=a[r];n[i]&&(n[\"\"]instanceof Object||(n[\"\"]={}),n[\"\"][i]=n[i],delete n[i])}return t&&(n.ignore=p(t.ignore,n.ignore),n.include=p(t.include,n.include),n.copy=p(t.copy,n.copy),n.observe=p(t.observe,n.observe)),n.ignore=p(n.ignore,s.ignore),n.include=p(n.include,s.include),n.copy=p(n.copy,s.copy),n.observe=p(n.observe,s.observe),n.mappedProperties=n.mappedProperties||{},n.copiedProperties=n.copiedProperties||{},n}function p(e,t){return void 0===e?e=[]:\"array\"!==R.getType(e)&&(e=[e]),void 0===t?t=[]:\"array\"!==R.getType(t)&&(t=[t]),H.utils.arrayGetDistinctValues(e.concat(t))}function U(s,e){var t=H.dependentObservable;H.dependentObservable=function(e,t,n){n=n||{},e&&\"object\"===_typeof(e)&&(n=e);var r=n.deferEvaluation,i=n.pure,o=!1;n.deferEvaluation=!0;var a=c(e,t,n);return r||i||(a=function(t){var e=H.dependentObservable;H.dependentObservable=c;var n=H.isWriteableObservable(t);H.dependentObservable=e;var r=c({read:function(){return o||(H.utils.arrayRemoveItem(s,t),o=!0),t.apply(t,arguments)},write:n&&function(e){return t(e)},deferEvaluation:!0});return u&&(r._wrapper=!0),r.__DO=t,r}(a),s.push(a)),a},H.dependentObservable.fn=c.fn,H.computed=H.dependentObservable;var n=e();return H.dependentObservable=t,H.computed=H.dependentObservable,n}function J(e,t,n){for(var r=0,i=e.length;r<i;r++)if(!0!==n[r]&&e[r]===t)return r;return null}function d(e,t){var n;return t&&(n=t(e)),\"undefined\"===R.getType(n)&&(n=e),H.utils.unwrapObservable(n)}function z(e,t,n){for(var r=0,i=(e=H.utils.unwrapObservable(e)).length;r<i;r++){var o=e[r];if(d(o,n)===t)return o}throw new Error(\"When calling ko.update*, the key '\"+t+\"' was not found!\")}function X(e,t){return H.utils.arrayMap(H.utils.unwrapObservable(e),function(e){return t?d(e,t):e})}function G(e,t){if(\"array\"===R.getType(e))for(var n=0;n<e.length;n++)t(n);else for(var r in e)e.hasOwnProperty(r)&&t(r)}function Q(e){if(null===e)return!1;var t=R.getType(e);return\"object\"===t||\"array\"===t}function Y(e){return(\"\"+e).replace(/~/g,\"~~\").replace(/\\[/g,\"~[\").replace(/]/g,\"~]\").replace(/\\./g,\"~.\")}function i(){var r=[],i=[];this.save=function(e,t){var n=H.utils.arrayIndexOf(r,e);0<=n?i[n]=t:(r.push(e),i.push(t))},this.get=function(e){var t=H.utils.arrayIndexOf(r,e);return 0<=t?i[t]:void 0}}function m(){var r={},n=function(e){var t;try{t=e}catch(e){t=\"$$$\"}var n=r[t];return r.hasOwnProperty(t)||(n=new i,r[t]=n),n};this.save=function(e,t){n(e).save(e,t)},this.get=function(e){return n(e).get(e)}}R.isMapped=function(e){var t=H.utils.unwrapObservable(e);return t&&t[F]},R.fromJS=function(e){if(0===arguments.length)throw new Error(\"When calling ko.fromJS, pass the object you want to convert.\");try{var t,n;o||(I=[],$=new m),o++,2===arguments.length&&(arguments[1][F]?n=arguments[1]:t=arguments[1]),3===arguments.length&&(t=arguments[1],n=arguments[2]),n&&(t=V(t,n[F]));var r=function o(a,s,u,r,t,c,e){var n=\"array\"===R.getType(H.utils.unwrapObservable(s));c=c||\"\";if(R.isMapped(a)){var i=H.utils.unwrapObservable(a)[F];u=V(i,u)}var l={data:s,parent:e||t};var f=function(){return u[r]&&u[r].create instanceof Function};var p=function(e){return U(I,function(){return H.utils.unwrapObservable(t)instanceof Array?u[r].create({data:e||l.data,parent:l.parent,skip:W}):u[r].create({data:e||l.data,parent:l.parent})})};var d=function(){return u[r]&&u[r].update instanceof Function};var h=function(e,t){var n={data:t||l.data,parent:l.parent,target:H.utils.unwrapObservable(e)};return H.isWriteableObservable(e)&&(n.observable=e),u[r].update(n)};var v=$.get(s);if(v)return v;r=r||\"\";if(n){var g=[],m=!1,y=function(e){return e};u[r]&&u[r].key&&(y=u[r].key,m=!0),H.isObservable(a)||((a=H.observableArray([])).mappedRemove=function(t){var n=\"function\"==typeof t?t:function(e){return e===y(t)};return a.remove(function(e){return n(y(e))})},a.mappedRemoveAll=function(e){var t=X(e,y);return a.remove(function(e){return-1!==H.utils.arrayIndexOf(t,y(e))})},a.mappedDestroy=function(t){var n=\"function\"==typeof t?t:function(e){return e===y(t)};return a.destroy(function(e){return n(y(e))})},a.mappedDestroyAll=function(e){var t=X(e,y);return a.destroy(function(e){return-1!==H.utils.arrayIndexOf(t,y(e))})},a.mappedIndexOf=function(e){var t=X(a(),y),n=y(e);return H.utils.arrayIndexOf(t,n)},a.mappedGet=function(e){return a()[a.mappedIndexOf(e)]},a.mappedCreate=function(e){if(-1!==a.mappedIndexOf(e))throw new Error(\"There already is an object with the key that you specified.\");var t=f()?p(e):e;if(d()){var n=h(t,e);H.isWriteableObservable(t)?t(n):t=n}return a.push(t),t});var b=X(H.utils.unwrapObservable(a),y).sort(),w=X(s,y);m&&w.sort();var x,T,k,C=H.utils.compareArrays(b,w),E={},S=H.utils.unwrapObservable(s),N={},D=!0;for(x=0,T=S.length;x<T;x++){if(void 0===(k=y(S[x]))||k instanceof Object){D=!1;break}N[k]=S[x]}var A,O,j=[],_=0;for(x=0,T=C.length;x<T;x++){var q;k=C[x];var L=c+\"[\"+Y(x)+\"]\";switch(k.status){case\"added\":A=D?N[k.value]:z(H.utils.unwrapObservable(s),k.value,y),q=o(void 0,A,u,r,a,L,t),f()||(q=H.utils.unwrapObservable(q)),O=J(H.utils.unwrapObservable(s),A,E),q===W?_++:j[O-_]=q,E[O]=!0;break;case\"retained\":A=D?N[k.value]:z(H.utils.unwrapObservable(s),k.value,y),q=z(a,k.value,y),o(q,A,u,r,a,L,t),O=J(H.utils.unwrapObservable(s),A,E),j[O]=q,E[O]=!0;break;case\"deleted\":q=z(a,k.value,y)}g.push({event:k.status,item:q})}a(j),u[r]&&u[r].arrayChanged&&H.utils.arrayForEach(g,function(e){u[r].arrayChanged(e.event,e.item)})}else if(Q(s)){if(!(a=H.utils.unwrapObservable(a))){if(f()){var M=p();return d()&&(M=h(M)),M}if(d())return h();a={}}if(d()&&(a=h(a)),$.save(s,a),d())return a;G(s,function(e){var t=c.length?c+\".\"+Y(e):Y(e);if(-1===H.utils.arrayIndexOf(u.ignore,t))if(-1===H.utils.arrayIndexOf(u.copy,t)){if(\"object\"!==_typeof(s[e])&&\"array\"!==R.getType(s[e])&&0<u.observe.length&&-1===H.utils.arrayIndexOf(u.observe,t))return a[e]=s[e],void(u.copiedProperties[t]=!0);var n=$.get(s[e]),r=o(a[e],s[e],u,e,a,t,a),i=n||r;if(0<u.observe.length&&-1===H.utils.arrayIndexOf(u.observe,t))return a[e]=H.utils.unwrapObservable(i),void(u.copiedProperties[t]=!0);H.isWriteableObservable(a[e])?(i=H.utils.unwrapObservable(i),a[e]()!==i&&a[e](i)):(i=void 0===a[e]?i:H.utils.unwrapObservable(i),a[e]=i),u.mappedProperties[t]=!0}else a[e]=s[e]})}else switch(R.getType(s)){case\"function\":a=d()?H.isWriteableObservable(s)?(s(h(s)),s):h(s):s;break;default:var P;if(H.isWriteableObservable(a))return P=d()?h(a):H.utils.unwrapObservable(s),a(P),P;var B=f()||d();if(a=f()?p():H.observable(H.utils.unwrapObservable(s)),d()&&a(h(a)),B)return a}return a}(n,e,t=g(t));if(n&&(r=n),!--o)for(;I.length;){var i=I.pop();i&&(i(),i.__DO.throttleEvaluation=i.throttleEvaluation)}return r[F]=V(r[F],t),r}catch(e){throw o=0,e}},R.fromJSON=function(e){var t=Array.prototype.slice.call(arguments,0);return t[0]=H.utils.parseJson(e),R.fromJS.apply(this,t)},R.toJS=function(e,t){if(s||R.resetDefaultOptions(),0===arguments.length)throw new Error(\"When calling ko.mapping.toJS, pass the object you want to convert.\");if(\"array\"!==R.getType(s.ignore))throw new Error(\"ko.mapping.defaultOptions().ignore should be an array.\");if(\"array\"!==R.getType(s.include))throw new Error(\"ko.mapping.defaultOptions().include should be an array.\");if(\"array\"!==R.getType(s.copy))throw new Error(\"ko.mapping.defaultOptions().copy should be an array.\");return t=g(t,e[F]),R.visitModel(e,function(e){return H.utils.unwrapObservable(e)},t)},R.toJSON=function(e,t,n,r){var i=R.toJS(e,t);return H.utils.stringifyJson(i,n,r)},R.defaultOptions=function(){if(!(0<arguments.length))return s;s=arguments[0]},R.resetDefaultOptions=function(){s={include:e.include.slice(0),ignore:e.ignore.slice(0),copy:e.copy.slice(0),observe:e.observe.slice(0)}},R.getType=function(e){if(e&&\"object\"===_typeof(e)){if(e.constructor===Date)return\"date\";if(e.constructor===Array)return\"array\"}return _typeof(e)},R.visitModel=function(e,f,p){var d;(p=p||{}).visitedObjects=p.visitedObjects||new m;var h=H.utils.unwrapObservable(e);if(!Q(h))return f(e,p.parentName);p=g(p,h[F]),f(e,p.parentName),d=\"array\"===R.getType(h)?[]:{},p.visitedObjects.save(e,d);var v=p.parentName;return G(h,function(e){var t=Y(e);if(!p.ignore||-1===H.utils.arrayIndexOf(p.ignore,t)){var n,r,i,o,a=h[e];if(p.parentName=(r=h,i=e,o=(n=v)||\"\",\"array\"===R.getType(r)?n&&(o+=\"[\"+Y(i)+\"]\"):(n&&(o+=\".\"),o+=Y(i)),o),-1===H.utils.arrayIndexOf(p.copy,t)&&-1===H.utils.arrayIndexOf(p.include,t)){var s=h[F];if(s){var u=s.mappedProperties;if(u&&!u[t]){var c=s.copiedProperties;if(c&&!c[t]&&\"array\"!==R.getType(h))return}}}switch(R.getType(H.utils.unwrapObservable(a))){case\"object\":case\"array\":case\"undefined\":var l=p.visitedObjects.get(a);d[e]=\"undefined\"!==R.getType(l)?l:R.visitModel(a,f,p);break;default:d[e]=f(a,p.parentName)}}}),d}}),BaseViewModel.prototype.update=function(){var e=0<arguments.length&&void 0!==arguments[0]?arguments[0]:function(){},t=this;t.fetching(!0),$.get(t.remoteUrl(),function(e){ko.mapping.fromJS(e,t)},\"json\").always(function(){t.fetching(!1),e()})},ConfigViewModel.prototype=Object.create(BaseViewModel.prototype),ConfigViewModel.prototype.constructor=ConfigViewModel,StatusViewModel.prototype=Object.create(BaseViewModel.prototype),StatusViewModel.prototype.constructor=StatusViewModel;\n"
   "//# sourceMappingURL=lib.js.map\n";
+static const char CONTENT_LIB_JS_GZ[] PROGMEM __attribute__((aligned(4))) = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbc, 0xbd, 0x8b, 0x76, 0xdb, 0x46, 
+  0x96, 0x36, 0xfa, 0x2a, 0x22, 0xda, 0xc3, 0x00, 0x66, 0x91, 0x22, 0xed, 0x24, 0x33, 0x0d, 0x0a, 
+  0xe1, 0x72, 0x64, 0x39, 0x49, 0x77, 0xee, 0x76, 0x3a, 0x49, 0x53, 0x8c, 0x17, 0x44, 0x16, 0x25, 
+  0x44, 0x14, 0xc0, 0x00, 0xa0, 0x64, 0x45, 0xe4, 0xbc, 0xd9, 0xbf, 0xce, 0x23, 0x9d, 0x57, 0x38, 
+  0xfb, 0xdb, 0x75, 0x41, 0x01, 0x04, 0x65, 0x77, 0xcf, 0xfc, 0xc7, 0xdd, 0x11, 0x71, 0x29, 0xd4, 
+  0x75, 0xd7, 0xbe, 0xd5, 0xbe, 0x78, 0x9b, 0x42, 0x1e, 0x15, 0x65, 0x9e, 0xcc, 0x4b, 0x6f, 0xbc, 
+  0xdc, 0xa4, 0xf3, 0x32, 0xc9, 0xd2, 0xa3, 0xb7, 0xe5, 0xfd, 0x5a, 0x66, 0x4b, 0x5f, 0x06, 0x0f, 
+  0xb9, 0x2c, 0x37, 0x79, 0xea, 0xeb, 0x27, 0x91, 0x67, 0xca, 0x78, 0x51, 0xa4, 0x1e, 0x1d, 0xbd, 
+  0xbe, 0xbf, 0xb9, 0xc8, 0x56, 0xdd, 0xae, 0x57, 0xf0, 0x45, 0xf3, 0xc5, 0x20, 0x29, 0x65, 0x1e, 
+  0x97, 0x59, 0x3e, 0x31, 0x9f, 0x56, 0xd5, 0x1e, 0xe9, 0x92, 0x72, 0x17, 0xb6, 0xbc, 0x94, 0x54, 
+  0xe7, 0xe1, 0xe6, 0xe4, 0x60, 0x9e, 0xa5, 0xd4, 0xf3, 0xcd, 0x9c, 0xea, 0x8e, 0xa2, 0xc8, 0x3e, 
+  0xef, 0x98, 0xeb, 0xc1, 0x3a, 0xcf, 0xca, 0x0c, 0x9f, 0x4d, 0x4c, 0xdf, 0x42, 0xdb, 0x60, 0x40, 
+  0x0d, 0xed, 0xec, 0x80, 0x3f, 0x8f, 0x0b, 0xf9, 0x8f, 0x44, 0xde, 0x7d, 0x93, 0x2d, 0xe4, 0xca, 
+  0x97, 0xa2, 0x0c, 0x1e, 0x6e, 0xe3, 0xfc, 0x28, 0x8d, 0x9e, 0x9d, 0xc4, 0xf9, 0xe5, 0xe6, 0x46, 
+  0xa6, 0x65, 0x31, 0x58, 0xc9, 0xf4, 0xb2, 0xbc, 0xea, 0x76, 0x6f, 0xb3, 0x64, 0x71, 0x34, 0xa4, 
+  0x66, 0xec, 0xab, 0xe9, 0xb3, 0xd9, 0xc4, 0xbd, 0x09, 0x1f, 0x76, 0xe3, 0xf2, 0x2a, 0x29, 0x06, 
+  0xb9, 0xbc, 0xc9, 0x4a, 0xf9, 0x53, 0xbe, 0x8a, 0x4a, 0x71, 0x9d, 0x0d, 0x6e, 0xe2, 0xf5, 0x3a, 
+  0x49, 0x2f, 0x07, 0xcb, 0x3c, 0xbb, 0xf9, 0xdb, 0x6b, 0x6a, 0x27, 0x15, 0x28, 0x16, 0xf0, 0xdf, 
+  0xc1, 0x52, 0x96, 0xf3, 0x2b, 0x7a, 0x1d, 0x51, 0xc9, 0xec, 0xa2, 0x90, 0xf9, 0x6d, 0x7c, 0xb1, 
+  0x92, 0x7e, 0x67, 0xe4, 0x74, 0xf4, 0x34, 0x4b, 0x97, 0xc9, 0xa5, 0xd3, 0x55, 0xd5, 0xd1, 0x12, 
+  0xdf, 0xac, 0x37, 0xb9, 0x3c, 0xcd, 0x6e, 0xd6, 0x9b, 0x52, 0x2e, 0x7c, 0x3b, 0x9f, 0xd5, 0x74, 
+  0xfa, 0x41, 0xcf, 0x3b, 0x9e, 0x73, 0x05, 0xde, 0x2e, 0x18, 0xd7, 0xc6, 0x3c, 0x98, 0xc7, 0xab, 
+  0x95, 0x8f, 0x6e, 0x88, 0x87, 0xa2, 0x48, 0x16, 0xa1, 0xe7, 0x89, 0x75, 0x5c, 0x14, 0xf8, 0xa5, 
+  0x31, 0xa4, 0xf3, 0x9b, 0xe2, 0x2d, 0x7a, 0x24, 0xf3, 0xd0, 0x5b, 0xc4, 0x65, 0x3c, 0xc8, 0xd6, 
+  0x32, 0x95, 0xb7, 0x05, 0x56, 0xe1, 0xe6, 0x58, 0x97, 0xa8, 0x8a, 0xc6, 0xeb, 0xe4, 0x5a, 0xde, 
+  0xbb, 0x1f, 0xa7, 0xd4, 0x8a, 0x7b, 0xbf, 0xa4, 0x81, 0xca, 0x7c, 0x9d, 0x27, 0x69, 0xe9, 0x3e, 
+  0x96, 0x29, 0xc6, 0xbc, 0x08, 0x87, 0xe2, 0xe6, 0x8f, 0xb2, 0xb4, 0x4d, 0x7a, 0xea, 0xb6, 0xcc, 
+  0xd6, 0xc9, 0xdc, 0xde, 0x11, 0xe8, 0x56, 0xaf, 0x4c, 0x67, 0xd5, 0x67, 0xd9, 0x2a, 0xae, 0x5e, 
+  0x5d, 0xe6, 0xc9, 0xe2, 0x6d, 0x22, 0xed, 0x7d, 0xd5, 0x46, 0x76, 0x75, 0x53, 0xbf, 0xd3, 0x9d, 
+  0xbe, 0xbb, 0xbb, 0xe3, 0xda, 0xd3, 0xf8, 0x46, 0x9a, 0x7b, 0x34, 0x70, 0x97, 0xe5, 0x3c, 0x33, 
+  0xcb, 0x24, 0xbf, 0xb9, 0x8b, 0x73, 0x7a, 0xd7, 0xa7, 0x69, 0x02, 0x94, 0xcd, 0xb3, 0x15, 0xdf, 
+  0xc8, 0x62, 0xbd, 0x5c, 0xc5, 0xc5, 0x15, 0x55, 0xb7, 0x48, 0x68, 0xc8, 0x25, 0x5d, 0x5c, 0x2e, 
+  0xe7, 0x09, 0xff, 0xe6, 0xd9, 0x26, 0x5d, 0xe0, 0x2a, 0x97, 0xab, 0xf8, 0x1e, 0x17, 0xb7, 0x04, 
+  0x30, 0xf8, 0x2d, 0xe5, 0xcd, 0x1a, 0xbf, 0x05, 0x2d, 0x83, 0x0c, 0x47, 0x22, 0x5b, 0x2e, 0x0b, 
+  0xa9, 0x0a, 0xe4, 0x05, 0xad, 0x62, 0xe8, 0x0d, 0x07, 0xf4, 0x3f, 0x6f, 0x47, 0x90, 0x59, 0x01, 
+  0xc3, 0xeb, 0x32, 0x2e, 0x37, 0x45, 0x0b, 0x30, 0xf0, 0x3a, 0xa6, 0x1f, 0x0c, 0x13, 0x05, 0xd7, 
+  0x73, 0x08, 0x26, 0xc4, 0xc3, 0x0d, 0xaf, 0xdd, 0xd9, 0x8f, 0x3f, 0xd2, 0x4c, 0x24, 0xcb, 0xe4, 
+  0xed, 0x7c, 0x95, 0x50, 0xbf, 0xdf, 0x12, 0x28, 0xa5, 0x72, 0x5e, 0xf2, 0xdc, 0x15, 0x39, 0x41, 
+  0x0d, 0xa6, 0x26, 0x59, 0xc7, 0x8b, 0x45, 0x2e, 0xd5, 0x62, 0xac, 0xe3, 0xf9, 0xb5, 0x2c, 0x01, 
+  0x39, 0x29, 0x06, 0x63, 0x6f, 0x37, 0xf3, 0x39, 0x4a, 0x0c, 0xed, 0xb2, 0xbb, 0x55, 0xf1, 0x1a, 
+  0xb9, 0x0f, 0xb0, 0x4a, 0x57, 0xd9, 0x86, 0x17, 0x74, 0x99, 0x4b, 0xf9, 0xf6, 0x4a, 0xc6, 0x6b, 
+  0x7a, 0x4e, 0x90, 0x77, 0x63, 0xaa, 0x56, 0xd7, 0xb6, 0xde, 0xf8, 0x06, 0x05, 0xd6, 0xc9, 0x2a, 
+  0x33, 0xb3, 0x3b, 0xd2, 0xbf, 0xcf, 0xf4, 0xef, 0x73, 0x74, 0x9a, 0xc6, 0x2d, 0xd1, 0x8b, 0x55, 
+  0xbc, 0x2e, 0xb8, 0xa9, 0xbb, 0xb8, 0x2c, 0x0b, 0x39, 0xd7, 0x57, 0xdc, 0xa8, 0x5a, 0xbf, 0x39, 
+  0x2d, 0x1d, 0xaa, 0x4a, 0xb3, 0xcb, 0x74, 0x61, 0x6e, 0x8a, 0x72, 0x33, 0xbf, 0x36, 0x37, 0x8b, 
+  0x84, 0xd6, 0xaa, 0xe4, 0xa9, 0x1a, 0x09, 0x05, 0x80, 0x58, 0x72, 0x05, 0x7a, 0xd4, 0xc1, 0x2b, 
+  0x42, 0x10, 0xf2, 0x6d, 0xae, 0x5a, 0x54, 0x85, 0xdf, 0x6e, 0xd6, 0x0b, 0xbe, 0xdf, 0x89, 0x94, 
+  0x70, 0xc0, 0x20, 0x29, 0x7e, 0x4e, 0x5e, 0x25, 0x67, 0x79, 0x4e, 0x08, 0xed, 0xbd, 0x6b, 0xc7, 
+  0xeb, 0x41, 0x78, 0xaf, 0x1c, 0xa0, 0x4d, 0x3f, 0xd8, 0x99, 0x1a, 0x96, 0xc9, 0x29, 0xaf, 0xcf, 
+  0x07, 0x54, 0xf1, 0xfa, 0xcd, 0x0b, 0xb7, 0x8a, 0xed, 0x16, 0x4f, 0x7a, 0x2f, 0xbe, 0x3f, 0x50, 
+  0xef, 0x0b, 0x9e, 0xde, 0xef, 0xb3, 0xe4, 0x83, 0x2a, 0xaf, 0x57, 0x73, 0xb8, 0xee, 0xe5, 0x66, 
+  0xb5, 0x02, 0xbc, 0x3d, 0x56, 0x65, 0x71, 0x97, 0x10, 0x6e, 0xf4, 0xcd, 0x77, 0xc1, 0xc3, 0x9c, 
+  0x00, 0x15, 0x2d, 0x84, 0xa6, 0x31, 0xee, 0xda, 0x11, 0xf7, 0xed, 0xc8, 0x7f, 0xf1, 0x7d, 0xe0, 
+  0x8d, 0xb9, 0x08, 0x46, 0x68, 0xca, 0xa8, 0x69, 0x39, 0xf2, 0xe9, 0x99, 0xf3, 0xba, 0xe7, 0xd4, 
+  0xa2, 0x4b, 0xf4, 0x8e, 0xea, 0xd5, 0xa9, 0x52, 0x81, 0xb7, 0xd3, 0xc5, 0x7e, 0x4a, 0xaf, 0xd3, 
+  0xec, 0x2e, 0x3d, 0xf2, 0xbd, 0x9e, 0xe9, 0x51, 0xcf, 0xa3, 0xd7, 0x1a, 0x8f, 0x4b, 0x86, 0xab, 
+  0xc7, 0x86, 0x83, 0x5d, 0x2a, 0xc7, 0x76, 0x50, 0x5c, 0xde, 0x8c, 0xea, 0x68, 0x18, 0xca, 0xc8, 
+  0xa3, 0xad, 0x9d, 0x97, 0x84, 0x22, 0xbd, 0xf1, 0x45, 0x2e, 0xe3, 0x6b, 0xee, 0xed, 0xd1, 0x08, 
+  0x6f, 0xbe, 0xcd, 0x4a, 0x50, 0x01, 0xb5, 0x3b, 0x6a, 0xaf, 0x9f, 0xe1, 0xf5, 0xd9, 0x3f, 0x0e, 
+  0xbc, 0x7d, 0x8e, 0xb7, 0xa7, 0x80, 0xc2, 0x66, 0xb5, 0x1f, 0xe3, 0xcd, 0x3f, 0x30, 0xf0, 0x1f, 
+  0xe5, 0x1f, 0x9b, 0x24, 0x6f, 0x7c, 0xf8, 0x09, 0x5e, 0xbf, 0x04, 0x32, 0x3b, 0x3a, 0xbd, 0x92, 
+  0xf3, 0xeb, 0xa3, 0x57, 0x71, 0xb2, 0x6a, 0x94, 0xf9, 0x14, 0x65, 0xbe, 0x78, 0x75, 0xfa, 0x15, 
+  0xbd, 0xdc, 0xac, 0xca, 0xda, 0xbb, 0xff, 0x54, 0xbd, 0x3e, 0x3a, 0xa3, 0x11, 0x5d, 0x1d, 0x7d, 
+  0xc1, 0x48, 0xb0, 0x56, 0xe0, 0xbf, 0xd4, 0x80, 0x69, 0x2f, 0x51, 0x07, 0x08, 0x31, 0xd6, 0x5e, 
+  0xfe, 0xd5, 0xd6, 0xfc, 0x5a, 0xae, 0x96, 0x47, 0x6f, 0x68, 0x72, 0xdb, 0x3a, 0x30, 0xe2, 0x59, 
+  0xfb, 0x8e, 0x76, 0x15, 0x15, 0xb9, 0x59, 0x83, 0xe3, 0xa0, 0xb9, 0xaf, 0x4f, 0xcf, 0x27, 0x3c, 
+  0xd0, 0x9f, 0xe3, 0x64, 0x6f, 0x62, 0x9f, 0x7d, 0xa2, 0x07, 0x59, 0x30, 0x2d, 0x30, 0xef, 0x16, 
+  0x72, 0x89, 0xd1, 0xe0, 0xd5, 0x57, 0xe9, 0x6d, 0xbc, 0x4a, 0x16, 0x06, 0x04, 0xc0, 0x40, 0x54, 
+  0x78, 0x18, 0xbb, 0xf6, 0xf5, 0x3c, 0x4e, 0x7f, 0x94, 0x05, 0x15, 0xaf, 0xe1, 0xe3, 0x36, 0xa2, 
+  0xff, 0xb0, 0x53, 0x54, 0x7f, 0xbf, 0x82, 0xff, 0x05, 0x54, 0x4e, 0xb5, 0x00, 0x91, 0x97, 0xc4, 
+  0x7a, 0xa0, 0x33, 0x45, 0xb4, 0xdf, 0x83, 0xe9, 0x4c, 0x3c, 0x80, 0xd0, 0xb5, 0xb0, 0x5c, 0x54, 
+  0x78, 0x53, 0x26, 0xab, 0x62, 0xb0, 0x49, 0xef, 0xf2, 0x78, 0xfd, 0x5d, 0xc5, 0x85, 0xc8, 0xc1, 
+  0x05, 0xf8, 0x82, 0x60, 0x27, 0xe6, 0x34, 0x37, 0x84, 0xb4, 0x5a, 0xbe, 0x4e, 0xe5, 0xdd, 0xe1, 
+  0xb9, 0x18, 0x80, 0x6d, 0x08, 0x76, 0x6a, 0xcb, 0x1f, 0xe4, 0x74, 0xe8, 0xa5, 0x42, 0x8a, 0x51, 
+  0x73, 0xbb, 0x44, 0xc3, 0x0f, 0x63, 0xc5, 0x86, 0x2e, 0x2b, 0x36, 0x9c, 0x85, 0x4e, 0x3d, 0xc4, 
+  0x94, 0xd9, 0xa6, 0xfd, 0xce, 0x30, 0x10, 0x4f, 0x06, 0x97, 0xb2, 0xf4, 0xe9, 0x95, 0x70, 0x47, 
+  0x33, 0x3c, 0x91, 0xb6, 0x01, 0xbf, 0x6d, 0x01, 0xed, 0xe4, 0x06, 0xd5, 0xe5, 0xa0, 0xc8, 0xf2, 
+  0xb2, 0x5a, 0x16, 0x66, 0x21, 0xcd, 0xca, 0x0c, 0x30, 0x73, 0x7e, 0xc0, 0x88, 0x4f, 0x5d, 0x4e, 
+  0xe4, 0x00, 0x04, 0xd3, 0x0f, 0x4e, 0x4a, 0x7d, 0x31, 0x19, 0x85, 0x7d, 0xda, 0xdf, 0xfa, 0xfd, 
+  0x89, 0x2d, 0x48, 0x0f, 0x47, 0xbb, 0x80, 0xa6, 0xdd, 0xfb, 0xbd, 0x20, 0x36, 0x38, 0x18, 0xc4, 
+  0xab, 0xbb, 0xf8, 0xbe, 0x70, 0x01, 0xc0, 0x1d, 0x14, 0xcd, 0x20, 0xe3, 0xd5, 0x5d, 0x1d, 0xb8, 
+  0xf6, 0xd8, 0x46, 0x51, 0x12, 0xef, 0x99, 0xab, 0xa9, 0x4d, 0x18, 0xc8, 0xc6, 0xc9, 0xe0, 0x82, 
+  0xf6, 0xc2, 0x59, 0xba, 0x58, 0x33, 0x82, 0x97, 0x22, 0x19, 0x28, 0x66, 0x91, 0x78, 0xd7, 0x64, 
+  0xa0, 0x78, 0x84, 0x28, 0xc5, 0x25, 0x2d, 0x6f, 0x94, 0xeb, 0x8b, 0x9f, 0xb0, 0x5a, 0xed, 0x4b, 
+  0x99, 0x28, 0x90, 0x69, 0xbc, 0xf1, 0x3c, 0xfb, 0x66, 0x50, 0x6c, 0x2e, 0x8a, 0x79, 0x9e, 0x5c, 
+  0x48, 0xdf, 0x9d, 0xff, 0x65, 0x96, 0xfb, 0x0a, 0xf8, 0x87, 0xe3, 0xf2, 0x44, 0x35, 0x63, 0xa6, 
+  0xd9, 0x0f, 0xf4, 0xd2, 0x8c, 0xcb, 0x5e, 0xcf, 0x30, 0xe9, 0xcd, 0x22, 0xd3, 0x72, 0x36, 0x4e, 
+  0x48, 0x7a, 0xa1, 0x09, 0x4f, 0x55, 0x4b, 0x84, 0x5c, 0xf5, 0x62, 0x30, 0xc4, 0x98, 0x91, 0xa9, 
+  0x49, 0x4e, 0xf5, 0x5c, 0x03, 0x38, 0xc7, 0xa8, 0x31, 0x8b, 0x52, 0xa2, 0x49, 0x22, 0x8e, 0x3a, 
+  0xa3, 0x31, 0x8f, 0x3c, 0x2f, 0x01, 0xd2, 0x2e, 0x48, 0xd6, 0x07, 0x0f, 0xf2, 0xe6, 0x53, 0xf1, 
+  0x61, 0x63, 0x52, 0x18, 0xc8, 0x50, 0x17, 0x41, 0x68, 0x46, 0xc0, 0x34, 0x5f, 0xc9, 0x38, 0x7f, 
+  0x93, 0xdc, 0xc8, 0x6c, 0x53, 0xfa, 0x59, 0x20, 0x54, 0x43, 0x81, 0xfe, 0x4a, 0x43, 0xbe, 0xbb, 
+  0xb4, 0x34, 0x8a, 0x98, 0xbe, 0xcb, 0x22, 0xe2, 0x06, 0xcd, 0x77, 0x4e, 0x8f, 0xc4, 0x73, 0xf9, 
+  0x3c, 0x08, 0x84, 0x07, 0x9a, 0x9a, 0xd8, 0x91, 0x9a, 0xf9, 0x93, 0x51, 0x7d, 0x9c, 0x04, 0xad, 
+  0xff, 0x2b, 0x33, 0xaa, 0x9b, 0x79, 0x30, 0x2d, 0x56, 0x73, 0xac, 0xf0, 0xe6, 0x6e, 0xd7, 0x9c, 
+  0x05, 0x92, 0x60, 0x00, 0xc2, 0xe8, 0x79, 0xb6, 0x6e, 0x4e, 0x25, 0xa6, 0x59, 0xec, 0xcf, 0xe7, 
+  0xfb, 0xa7, 0x0d, 0x15, 0x2a, 0xee, 0xbd, 0x5e, 0x25, 0x81, 0x90, 0x9c, 0x38, 0xb3, 0xe4, 0x07, 
+  0x61, 0xd5, 0xb2, 0xcf, 0x9f, 0xd1, 0x14, 0xcd, 0xa5, 0xda, 0x14, 0xad, 0x80, 0x4b, 0x05, 0xd5, 
+  0x5b, 0xc2, 0xb9, 0xef, 0xc7, 0xbd, 0x1d, 0xb3, 0x3d, 0x5c, 0x0e, 0xce, 0x0f, 0xba, 0x5d, 0x7a, 
+  0x01, 0x86, 0x59, 0x13, 0x64, 0x1e, 0x18, 0x0d, 0xa7, 0x5e, 0xdc, 0xb0, 0x6b, 0x18, 0x73, 0xad, 
+  0x63, 0x00, 0x48, 0xf4, 0xa5, 0x5e, 0xc3, 0x7b, 0xbb, 0x7b, 0x60, 0x53, 0xb9, 0x53, 0x05, 0xd1, 
+  0x37, 0xb0, 0x7b, 0x7a, 0xd0, 0xca, 0xd3, 0x1f, 0xa8, 0x86, 0x64, 0xf2, 0xbd, 0x31, 0xf1, 0xf2, 
+  0xd6, 0xd6, 0xc2, 0xaf, 0x77, 0x89, 0x46, 0x82, 0xd6, 0xe2, 0x5b, 0xf9, 0xad, 0x2c, 0x49, 0x86, 
+  0xba, 0x7e, 0x75, 0x18, 0xff, 0xd7, 0xca, 0xbd, 0x56, 0x0c, 0xfd, 0xfb, 0x8a, 0xb9, 0xd0, 0xa4, 
+  0xf7, 0x42, 0x0d, 0xee, 0x27, 0x24, 0x54, 0x11, 0x72, 0xf6, 0xbe, 0x27, 0x38, 0x82, 0xba, 0x43, 
+  0xae, 0xa8, 0xe7, 0x44, 0xad, 0xf8, 0x63, 0x2f, 0x08, 0xfd, 0xd6, 0xce, 0xf1, 0xe6, 0x6d, 0xeb, 
+  0x0e, 0x77, 0xe0, 0xc9, 0x60, 0x9d, 0x15, 0xd8, 0x8c, 0x2e, 0xd2, 0x54, 0x24, 0x98, 0x3e, 0x30, 
+  0x75, 0x6b, 0x61, 0xba, 0xb9, 0x0f, 0x59, 0x58, 0xb5, 0x0f, 0x71, 0x07, 0xb0, 0xac, 0xa3, 0x97, 
+  0x47, 0xd6, 0x46, 0xcf, 0x80, 0x0b, 0x2b, 0xea, 0x49, 0x73, 0x61, 0x0e, 0x0e, 0x60, 0x48, 0x2b, 
+  0x36, 0x58, 0x12, 0x1b, 0xe5, 0x02, 0xb3, 0x9e, 0x25, 0xc5, 0x5d, 0x1d, 0x95, 0xd9, 0x11, 0xbe, 
+  0x64, 0xf2, 0x71, 0xa4, 0xb5, 0x06, 0xf8, 0x6a, 0x9f, 0xfe, 0x1c, 0x98, 0x3d, 0xbb, 0xe9, 0xb1, 
+  0x45, 0xbe, 0x5b, 0x2e, 0x1d, 0xe9, 0xe1, 0xd1, 0xf5, 0xdf, 0x2f, 0xfe, 0x18, 0x18, 0xec, 0x97, 
+  0xae, 0xa3, 0xe9, 0xc3, 0x8d, 0xeb, 0xe9, 0x39, 0xd8, 0xdc, 0x7b, 0x96, 0x39, 0x5e, 0x93, 0x90, 
+  0xee, 0x81, 0x99, 0x73, 0xf7, 0x07, 0x74, 0x52, 0xd9, 0x8a, 0xf8, 0x87, 0xec, 0x92, 0x6e, 0x09, 
+  0x33, 0x77, 0x00, 0x8d, 0x66, 0xbb, 0x1b, 0xd9, 0x98, 0x40, 0xd2, 0x41, 0xe8, 0x4e, 0x7f, 0xef, 
+  0x92, 0x74, 0x91, 0xdd, 0xd1, 0xd7, 0xf3, 0x18, 0x4f, 0x22, 0xef, 0xf8, 0xd8, 0xeb, 0xb5, 0x7d, 
+  0xff, 0x78, 0xc7, 0x69, 0x79, 0x99, 0x34, 0x84, 0xef, 0x2b, 0xf5, 0x01, 0x40, 0xc0, 0x54, 0x93, 
+  0x86, 0x5a, 0x93, 0x89, 0x0e, 0x42, 0xc2, 0x63, 0xd3, 0x3d, 0x62, 0xbe, 0xa4, 0x53, 0xe7, 0x91, 
+  0xbc, 0xec, 0xe2, 0x77, 0x02, 0x57, 0xec, 0x5a, 0xdf, 0x23, 0xc9, 0x40, 0x2e, 0x93, 0x94, 0x38, 
+  0x70, 0xab, 0xee, 0x23, 0xf1, 0x6a, 0xb3, 0x92, 0x13, 0xe7, 0x55, 0x68, 0xb4, 0x93, 0xea, 0x55, 
+  0x40, 0x28, 0xd5, 0xa9, 0xa4, 0xfe, 0x72, 0x20, 0xdf, 0xad, 0x89, 0x2f, 0x2b, 0x82, 0x49, 0xfd, 
+  0x3e, 0x22, 0x76, 0x34, 0x9b, 0x33, 0x93, 0x38, 0x29, 0xa9, 0x23, 0x34, 0x17, 0x35, 0x86, 0x96, 
+  0x68, 0x5d, 0xa7, 0x2a, 0x12, 0x94, 0x57, 0x79, 0x76, 0xc7, 0xec, 0xad, 0x42, 0xed, 0xde, 0xef, 
+  0x3f, 0x6c, 0x64, 0x7e, 0x7f, 0x94, 0x2b, 0x79, 0xa9, 0x38, 0x8a, 0x8f, 0xd4, 0xca, 0xd1, 0x0f, 
+  0xc9, 0x38, 0xf1, 0x91, 0xf9, 0xd2, 0x0b, 0xc6, 0x46, 0xd3, 0x09, 0xa4, 0x1b, 0xf2, 0x5f, 0x77, 
+  0x9c, 0x1d, 0x33, 0x4e, 0xf5, 0xfd, 0x44, 0xfd, 0x84, 0x8a, 0xaf, 0xad, 0x20, 0xeb, 0x5a, 0x58, 
+  0x81, 0x80, 0xb8, 0xf7, 0xd3, 0xe8, 0xda, 0xf6, 0x4d, 0xe4, 0xd1, 0x77, 0x3c, 0x78, 0xb0, 0xb2, 
+  0xdf, 0x1b, 0x85, 0xe7, 0x77, 0x4b, 0x51, 0x80, 0xd9, 0x5c, 0x25, 0x73, 0x29, 0x6e, 0xe9, 0x8a, 
+  0xe0, 0x92, 0x40, 0x4a, 0x6c, 0xe8, 0x72, 0xbd, 0x29, 0xae, 0x04, 0xf1, 0x7c, 0x03, 0x6a, 0x4a, 
+  0xbe, 0xa3, 0x92, 0x69, 0x44, 0x40, 0x4c, 0x34, 0x75, 0x50, 0x66, 0xaf, 0xcb, 0x9c, 0x96, 0x4a, 
+  0x5c, 0xd2, 0xcd, 0x55, 0x5c, 0x7c, 0x77, 0x97, 0x52, 0x8d, 0x24, 0x4c, 0x95, 0xf7, 0xc4, 0x0c, 
+  0x5d, 0x56, 0xef, 0xe7, 0x51, 0xac, 0x94, 0x43, 0xaa, 0xe9, 0x40, 0xdc, 0xa0, 0x8a, 0xfb, 0x68, 
+  0x5f, 0x26, 0x68, 0x51, 0xe0, 0x42, 0xad, 0x9b, 0x6e, 0x6e, 0x2e, 0x64, 0x5e, 0x8d, 0x5e, 0x0e, 
+  0xa0, 0x1f, 0x7c, 0x43, 0x37, 0x3b, 0x71, 0x11, 0xb5, 0x89, 0x16, 0xcc, 0x0d, 0xd0, 0xa7, 0x60, 
+  0x41, 0xe4, 0x40, 0x4d, 0xd3, 0x4e, 0xac, 0xa2, 0x07, 0xd4, 0x10, 0x76, 0xa0, 0x81, 0x9a, 0xe3, 
+  0x27, 0xcd, 0xbe, 0xe1, 0x95, 0xa6, 0xeb, 0x5d, 0xa5, 0xd0, 0xbe, 0x53, 0x1c, 0xaf, 0x9a, 0x43, 
+  0x62, 0x5d, 0x23, 0x9f, 0x24, 0xab, 0xed, 0xf6, 0x34, 0x18, 0x28, 0x69, 0xe6, 0x6c, 0x25, 0x31, 
+  0x99, 0xbe, 0x07, 0x92, 0xb7, 0xc6, 0xb2, 0x11, 0x04, 0x10, 0x34, 0xcb, 0x77, 0x60, 0x84, 0x53, 
+  0x66, 0xa9, 0x88, 0x51, 0x4e, 0x8f, 0x56, 0x41, 0x3a, 0xcd, 0x67, 0x44, 0xc4, 0x13, 0xfa, 0x89, 
+  0x70, 0x0d, 0x59, 0xeb, 0x4a, 0xc6, 0x8b, 0x01, 0x49, 0x09, 0x32, 0x5d, 0x9c, 0x5e, 0x25, 0xab, 
+  0x85, 0x9f, 0x04, 0x84, 0xd5, 0x73, 0xaa, 0xf1, 0x5b, 0x1a, 0x16, 0x6b, 0x81, 0x6f, 0xa5, 0x79, 
+  0x53, 0x71, 0xe6, 0xef, 0x1a, 0x03, 0xa4, 0x91, 0x4d, 0x64, 0xcf, 0xf3, 0xc2, 0x16, 0x78, 0x96, 
+  0xd0, 0xa0, 0xb4, 0x4c, 0xe6, 0x24, 0x9d, 0x66, 0x6a, 0x2d, 0x64, 0x30, 0xa3, 0x22, 0xfa, 0xcb, 
+  0xb0, 0xfa, 0x6e, 0x87, 0x31, 0x2f, 0x23, 0xef, 0xf9, 0xe0, 0xf9, 0x60, 0xe4, 0x89, 0x33, 0x3b, 
+  0xbd, 0x24, 0x32, 0xf2, 0x9c, 0x38, 0xd2, 0x9b, 0x1c, 0x2c, 0x53, 0x82, 0x8b, 0xa4, 0xe4, 0x37, 
+  0x3b, 0xb1, 0x8e, 0x8e, 0x7f, 0x9b, 0x9e, 0x17, 0xe7, 0x9b, 0x57, 0x67, 0xaf, 0x5e, 0x9d, 0xbf, 
+  0x7b, 0x31, 0x9c, 0xf5, 0xb6, 0x8d, 0xfb, 0x27, 0xc7, 0x97, 0xd5, 0x3c, 0x2f, 0x2a, 0xc1, 0xb5, 
+  0xd3, 0xc1, 0x42, 0x2b, 0xd6, 0xd2, 0x4b, 0x58, 0x9b, 0x6f, 0xc4, 0x2a, 0x82, 0x38, 0x0c, 0x5d, 
+  0x6f, 0x8d, 0xce, 0x3d, 0x5d, 0x13, 0xaf, 0x74, 0xc1, 0x3f, 0xbe, 0x17, 0xe7, 0x79, 0x7c, 0x8f, 
+  0xa1, 0xa7, 0xdb, 0xed, 0x10, 0x32, 0x13, 0x8d, 0x4a, 0xc3, 0x8b, 0x1d, 0x76, 0xd9, 0xed, 0x0e, 
+  0x4f, 0xe8, 0x4f, 0xd9, 0x1f, 0x61, 0x55, 0x68, 0x90, 0x67, 0xd4, 0xf3, 0xe8, 0xac, 0x52, 0xf9, 
+  0x47, 0x0f, 0xbf, 0xff, 0x81, 0x3d, 0x1a, 0x2e, 0x85, 0x73, 0x4e, 0x10, 0x9e, 0x09, 0xd5, 0x05, 
+  0x68, 0x01, 0xb3, 0x17, 0x68, 0x29, 0xdc, 0x17, 0xa5, 0x8b, 0x4a, 0x1b, 0x4e, 0x73, 0x40, 0xfb, 
+  0x2a, 0x3c, 0x00, 0x91, 0x58, 0x30, 0xb7, 0x70, 0x28, 0x4f, 0x86, 0x13, 0x5c, 0x4d, 0x65, 0x8f, 
+  0x55, 0x41, 0xaa, 0xb1, 0x59, 0xa8, 0x9e, 0xcd, 0x68, 0x42, 0x69, 0xf3, 0xbd, 0x2e, 0xe3, 0xf9, 
+  0x75, 0xad, 0x4a, 0x35, 0x63, 0x67, 0x83, 0x1b, 0x99, 0x5f, 0x4a, 0xae, 0xca, 0x3d, 0xdc, 0x20, 
+  0x6c, 0x2f, 0x2b, 0x3c, 0x42, 0x43, 0x94, 0xb7, 0x6a, 0xdf, 0x29, 0xe5, 0x40, 0xb9, 0x13, 0x32, 
+  0x9e, 0x5f, 0xb5, 0xf5, 0xf1, 0x6c, 0x80, 0x37, 0x4a, 0xad, 0x4f, 0x73, 0x24, 0x48, 0x92, 0xad, 
+  0x8a, 0x55, 0x2b, 0xcf, 0x0d, 0xda, 0x9e, 0xf9, 0x67, 0x90, 0x78, 0xd5, 0x47, 0xad, 0xf2, 0x6c, 
+  0xaa, 0xe1, 0x8d, 0x76, 0x94, 0x54, 0x34, 0x9e, 0xf1, 0x4c, 0xcb, 0x44, 0x36, 0x2a, 0x2e, 0xb0, 
+  0x47, 0x56, 0xf7, 0xaa, 0x6a, 0x2b, 0xa4, 0xa3, 0x82, 0x65, 0x92, 0x17, 0xe5, 0xa1, 0x0a, 0xe4, 
+  0x1f, 0x3e, 0x08, 0xda, 0x2a, 0x7e, 0xb4, 0x48, 0x9f, 0xc8, 0x8b, 0x90, 0x7f, 0xb4, 0xcc, 0xab, 
+  0xb3, 0x12, 0x04, 0x79, 0x3d, 0xd9, 0xf3, 0x79, 0x99, 0xc2, 0x61, 0x35, 0xa9, 0xf5, 0x7e, 0x0e, 
+  0x4f, 0xa2, 0xb4, 0xdb, 0x4d, 0x4f, 0xca, 0xc9, 0x94, 0x17, 0x2e, 0x9d, 0xcd, 0xc2, 0xe9, 0x0c, 
+  0xd5, 0xa7, 0x8b, 0x83, 0xa3, 0xb4, 0xab, 0xb2, 0xdd, 0xee, 0x2f, 0xa0, 0x5a, 0xf8, 0x70, 0x23, 
+  0xa0, 0x25, 0x08, 0x4b, 0x56, 0x16, 0x88, 0x62, 0xcd, 0xd3, 0x46, 0x77, 0x7c, 0xb1, 0x13, 0xb4, 
+  0x5c, 0xef, 0x4a, 0x6a, 0x23, 0x02, 0x30, 0x9b, 0xeb, 0xa6, 0x1e, 0x44, 0x49, 0xee, 0x22, 0x11, 
+  0x19, 0xe1, 0x64, 0x57, 0xd3, 0xb1, 0xdd, 0x12, 0x0e, 0x2e, 0xa2, 0x11, 0x21, 0xf9, 0xa6, 0xa2, 
+  0x84, 0x10, 0x36, 0x89, 0xb2, 0x40, 0x62, 0xde, 0x45, 0x46, 0xec, 0x49, 0xec, 0x60, 0x10, 0xc8, 
+  0x97, 0x84, 0xcf, 0x6b, 0x95, 0x15, 0xba, 0x32, 0x12, 0x08, 0x45, 0x0b, 0x2e, 0x8a, 0x09, 0x17, 
+  0xdd, 0xf3, 0x5f, 0x12, 0x7a, 0x1f, 0x88, 0xf7, 0x2f, 0xe8, 0xe5, 0x86, 0xea, 0x89, 0x15, 0x44, 
+  0x16, 0xfd, 0x7e, 0x30, 0x2e, 0x4e, 0x36, 0x63, 0x54, 0x40, 0x88, 0x54, 0x21, 0x6f, 0x92, 0x1e, 
+  0xdd, 0x16, 0x94, 0x9c, 0x5a, 0xaa, 0xed, 0x9b, 0x46, 0x31, 0x89, 0x98, 0x22, 0x26, 0x6e, 0xc9, 
+  0xcf, 0x23, 0x49, 0xd7, 0x40, 0x05, 0xf3, 0x6e, 0x37, 0xa7, 0x9f, 0x33, 0x92, 0x93, 0xbe, 0x5f, 
+  0xc5, 0x49, 0xaa, 0xe6, 0xd7, 0xcf, 0xd1, 0x70, 0x12, 0xf1, 0xee, 0xa5, 0x57, 0xfc, 0x4b, 0x0f, 
+  0x83, 0x60, 0x42, 0x82, 0x72, 0x32, 0xa1, 0x57, 0x24, 0x50, 0xd2, 0x02, 0xd6, 0x0b, 0xa4, 0xc1, 
+  0x24, 0xc5, 0x2a, 0x86, 0xf4, 0xa6, 0x59, 0x23, 0xbf, 0xa3, 0x01, 0xa3, 0x13, 0x91, 0x59, 0x05, 
+  0x7f, 0x4e, 0x53, 0x4c, 0xd5, 0x86, 0x56, 0xc9, 0x84, 0xce, 0x70, 0x11, 0x7a, 0x6a, 0x40, 0x27, 
+  0xae, 0x96, 0xcd, 0x7f, 0x20, 0xee, 0x22, 0x26, 0xc2, 0x14, 0x6a, 0xfe, 0xc0, 0xeb, 0xf9, 0xcb, 
+  0xde, 0x37, 0x71, 0x79, 0x35, 0xc8, 0xf1, 0xf8, 0x86, 0xe4, 0x20, 0xa2, 0x05, 0xeb, 0x55, 0x3c, 
+  0x97, 0xfe, 0xf1, 0xf9, 0xcb, 0xe3, 0x4b, 0xc1, 0xca, 0x90, 0xe2, 0x47, 0x22, 0x1f, 0xf7, 0x20, 
+  0x5e, 0x12, 0xdc, 0x45, 0x0d, 0x82, 0x9b, 0x9c, 0x07, 0x76, 0x71, 0x9a, 0x65, 0xeb, 0x9a, 0x5a, 
+  0x4b, 0xd4, 0x46, 0xb3, 0xbf, 0x03, 0x44, 0x6a, 0x50, 0x2d, 0x71, 0x35, 0x84, 0x4d, 0xa7, 0x6a, 
+  0x49, 0x8f, 0x54, 0xf9, 0x19, 0x78, 0x54, 0x4b, 0x43, 0x58, 0x40, 0x25, 0xea, 0x88, 0xa6, 0x5a, 
+  0x49, 0x8e, 0x9f, 0x12, 0x27, 0xa0, 0x4f, 0x86, 0x3c, 0x07, 0xc8, 0x3d, 0xfa, 0xb2, 0x74, 0xa1, 
+  0x9e, 0xee, 0x35, 0x97, 0x90, 0x42, 0xf5, 0x35, 0x87, 0x2c, 0x50, 0x9c, 0xdd, 0xac, 0xcb, 0xfb, 
+  0x43, 0xfd, 0x1c, 0x3b, 0x10, 0xa1, 0x3b, 0x3c, 0x32, 0x3d, 0x1f, 0x12, 0x22, 0x5e, 0x65, 0x17, 
+  0xf1, 0xea, 0xec, 0x36, 0x5e, 0xd5, 0x3e, 0xbd, 0xe3, 0x49, 0x69, 0xa0, 0x40, 0x7b, 0x82, 0x4b, 
+  0xfc, 0xd1, 0x10, 0xc4, 0x1c, 0x94, 0x89, 0x21, 0x2e, 0x8d, 0x0c, 0x19, 0x1a, 0xe7, 0x27, 0x04, 
+  0x0b, 0x9d, 0x51, 0x07, 0x7a, 0x39, 0x35, 0x7c, 0xa2, 0xe7, 0xb4, 0xb7, 0x24, 0x93, 0xf5, 0x9c, 
+  0x80, 0x77, 0x2c, 0x57, 0x24, 0x30, 0x5a, 0xea, 0x2f, 0x01, 0xcd, 0x9d, 0x51, 0xd4, 0xfa, 0x41, 
+  0xa0, 0x94, 0xc6, 0x56, 0x41, 0x2c, 0x88, 0x57, 0xba, 0x79, 0x8c, 0x72, 0x10, 0xa1, 0xf7, 0x41, 
+  0xee, 0x2b, 0xa0, 0x58, 0x03, 0x20, 0x80, 0xa6, 0xaf, 0x65, 0x83, 0x36, 0x39, 0x47, 0xd2, 0x84, 
+  0x60, 0xa6, 0xb3, 0x71, 0x93, 0x2f, 0xa2, 0x01, 0x6a, 0x60, 0xa6, 0x71, 0x4e, 0x0c, 0x29, 0x49, 
+  0x85, 0x57, 0x30, 0xcb, 0xe6, 0x72, 0x0c, 0x44, 0x88, 0x42, 0x19, 0x84, 0x1b, 0xbd, 0x38, 0x84, 
+  0xc4, 0x03, 0x91, 0xd2, 0xe2, 0xa4, 0xfb, 0x6d, 0xba, 0xec, 0x01, 0xf7, 0xba, 0x84, 0x42, 0x32, 
+  0x31, 0xeb, 0x2f, 0x99, 0x49, 0xe0, 0xa6, 0x1a, 0x5d, 0x35, 0x3a, 0x28, 0xc2, 0xb7, 0xa5, 0x41, 
+  0x42, 0xb4, 0x12, 0xc4, 0x79, 0xb9, 0xb3, 0xcf, 0x73, 0x2c, 0xa7, 0x49, 0xaf, 0x37, 0x8b, 0x4a, 
+  0x9a, 0x43, 0x3b, 0x79, 0xba, 0x4c, 0x94, 0x08, 0x9a, 0xc7, 0x4b, 0x9a, 0x9e, 0xbd, 0x5e, 0x99, 
+  0x06, 0x72, 0x30, 0xc4, 0x09, 0xd5, 0x9c, 0xd9, 0x9a, 0xa1, 0xb8, 0x4b, 0xc7, 0xc9, 0x49, 0x36, 
+  0xa6, 0x8a, 0x83, 0x0e, 0xcd, 0xc8, 0x34, 0xa1, 0x32, 0x01, 0xd4, 0xc4, 0x84, 0x51, 0x18, 0xd1, 
+  0xf3, 0x33, 0xbb, 0x89, 0xf3, 0x06, 0x69, 0xac, 0x33, 0x8b, 0x54, 0xf5, 0x90, 0xea, 0x9c, 0xce, 
+  0x6a, 0x70, 0x94, 0x57, 0x23, 0xc9, 0x4e, 0xf2, 0x71, 0x46, 0x4d, 0x69, 0x3c, 0x47, 0xbc, 0x35, 
+  0x55, 0x9f, 0xcd, 0x08, 0x7d, 0xa4, 0x01, 0xef, 0x02, 0x6e, 0x31, 0x71, 0xa0, 0x29, 0xd3, 0x68, 
+  0xef, 0x7d, 0x1f, 0x18, 0xa5, 0xa5, 0x26, 0x9c, 0x34, 0xd4, 0x18, 0x1c, 0xc9, 0x26, 0x59, 0xe0, 
+  0x90, 0x71, 0xb3, 0x86, 0x30, 0x13, 0xde, 0x10, 0x06, 0x7e, 0xc4, 0x50, 0xc2, 0x07, 0x35, 0x99, 
+  0x36, 0x8c, 0x31, 0x30, 0xdf, 0xcd, 0x47, 0x81, 0xd0, 0xfc, 0x82, 0xf7, 0xb9, 0x22, 0x12, 0x47, 
+  0xdf, 0x32, 0xdb, 0x75, 0xa4, 0xb8, 0xfe, 0xa3, 0x57, 0x86, 0xcb, 0x63, 0x38, 0x39, 0x7a, 0x49, 
+  0x7c, 0xf3, 0xd1, 0x8f, 0xf2, 0xf2, 0xec, 0xdd, 0x5a, 0x63, 0x12, 0x85, 0xa3, 0x74, 0xc3, 0x1e, 
+  0x93, 0x35, 0x62, 0xa9, 0x8f, 0xbc, 0xa0, 0xc1, 0x47, 0xa4, 0x53, 0x8b, 0x82, 0xbc, 0x5e, 0xd9, 
+  0xf3, 0x66, 0x1e, 0x75, 0x87, 0xa4, 0x8b, 0xaf, 0xb3, 0x3b, 0x99, 0x9f, 0x92, 0xa0, 0x0d, 0x0d, 
+  0x36, 0x6b, 0x62, 0xaf, 0x22, 0x97, 0x5d, 0x51, 0xf4, 0x6f, 0x21, 0xee, 0x68, 0xa2, 0x12, 0x71, 
+  0x25, 0x96, 0xe2, 0x56, 0xbc, 0x13, 0x1b, 0x31, 0x17, 0x6f, 0xc4, 0xb5, 0x88, 0xc5, 0xa9, 0xb8, 
+  0x14, 0x85, 0x58, 0x89, 0x1b, 0x62, 0x72, 0xbd, 0x22, 0xf9, 0xf3, 0xcf, 0x95, 0xf4, 0x7a, 0xa3, 
+  0xa7, 0xc0, 0x9e, 0xe8, 0x2c, 0x09, 0x28, 0x69, 0x25, 0x37, 0xbd, 0xa6, 0x45, 0x05, 0x44, 0xae, 
+  0xa3, 0x98, 0xda, 0x23, 0xa9, 0x83, 0x7f, 0xbe, 0x55, 0x3f, 0x2f, 0xa3, 0x76, 0x4d, 0x3e, 0x76, 
+  0x3e, 0xd3, 0x4b, 0xe8, 0x0e, 0x08, 0x25, 0xbd, 0x20, 0xf2, 0xd7, 0x94, 0x94, 0x58, 0x44, 0xfb, 
+  0x0e, 0x82, 0x56, 0xb6, 0x16, 0xbf, 0x1b, 0x81, 0xeb, 0xad, 0xb9, 0xf8, 0xc3, 0xca, 0x65, 0x5f, 
+  0x47, 0x87, 0xf6, 0x0c, 0x7a, 0x66, 0xa1, 0x2b, 0x25, 0xe8, 0x4a, 0x15, 0x21, 0x95, 0xc4, 0x8a, 
+  0xa0, 0x0b, 0x46, 0x99, 0x6d, 0xf0, 0x7a, 0x7f, 0xb4, 0x13, 0xdf, 0x44, 0xde, 0x1c, 0xc7, 0x73, 
+  0x72, 0xb1, 0x55, 0x0a, 0x2e, 0xba, 0x88, 0x8b, 0xfb, 0x74, 0xbe, 0x8d, 0x37, 0x65, 0xb6, 0xa4, 
+  0x61, 0x17, 0x7c, 0x45, 0x98, 0xe6, 0x7e, 0x4b, 0x68, 0xba, 0xcc, 0xb3, 0x55, 0xb1, 0x25, 0x39, 
+  0x54, 0xe6, 0xdb, 0x85, 0x3e, 0xf8, 0xda, 0x5e, 0x25, 0x8b, 0x85, 0x4c, 0xb7, 0x49, 0x41, 0xdb, 
+  0x61, 0xbb, 0x22, 0x3a, 0xb3, 0xbd, 0xd9, 0xac, 0xca, 0x64, 0xbd, 0x92, 0x5b, 0x18, 0x7c, 0x6c, 
+  0x09, 0xc3, 0x2d, 0xb2, 0x74, 0x75, 0xbf, 0xd5, 0x92, 0x2f, 0xb5, 0x35, 0xa7, 0x17, 0x0b, 0x4f, 
+  0x7c, 0x1f, 0x79, 0xd3, 0xf3, 0xf3, 0x77, 0xcf, 0x86, 0xe7, 0xe7, 0xe5, 0xf9, 0x79, 0x7e, 0x7e, 
+  0x9e, 0x9e, 0x9f, 0x2f, 0x67, 0x9e, 0xf8, 0x3c, 0xf2, 0xfc, 0x49, 0x78, 0x4e, 0xff, 0x06, 0x24, 
+  0x39, 0x9c, 0xdf, 0xf5, 0x67, 0xdb, 0xe9, 0x6f, 0xe7, 0xc3, 0x3e, 0x95, 0x8d, 0x87, 0xb3, 0xa0, 
+  0xe7, 0x89, 0x2f, 0x23, 0xef, 0xfc, 0x7c, 0xea, 0xf5, 0xbe, 0xef, 0x79, 0x4f, 0x7d, 0xaf, 0xf7, 
+  0x79, 0xcf, 0x0b, 0xe8, 0x0b, 0x7d, 0x3f, 0x7d, 0xfa, 0xdb, 0x93, 0x6d, 0xe7, 0xbf, 0x67, 0x93, 
+  0x28, 0xd0, 0x4f, 0x26, 0xe1, 0x47, 0x7e, 0x55, 0xe3, 0x6f, 0xf8, 0xfd, 0x68, 0x16, 0x3c, 0x0d, 
+  0x3e, 0xda, 0x9e, 0x7b, 0xcd, 0x17, 0xe7, 0x1e, 0xde, 0x9c, 0x7b, 0x5b, 0x5d, 0x6f, 0xb0, 0xd5, 
+  0xb5, 0x9c, 0x9f, 0x53, 0xd7, 0x7e, 0x8c, 0x08, 0x01, 0xdb, 0x06, 0xcf, 0xcf, 0x7d, 0xdf, 0xff, 
+  0xd7, 0xab, 0x0e, 0xb6, 0xcd, 0x37, 0x7e, 0x40, 0xe3, 0x9c, 0xcd, 0xb6, 0x5e, 0xef, 0x4b, 0xaa, 
+  0xf9, 0x69, 0xb0, 0x1d, 0x50, 0xb9, 0x73, 0x34, 0x2d, 0xbe, 0x8a, 0x00, 0x8b, 0x6a, 0xcf, 0xf8, 
+  0xd4, 0x0f, 0x1a, 0xbd, 0x77, 0x49, 0xdb, 0xe3, 0x89, 0xfb, 0xdc, 0xfb, 0x8d, 0xfb, 0xd8, 0xe3, 
+  0x8a, 0x7f, 0xd3, 0x95, 0xce, 0x02, 0xd3, 0x0a, 0xd5, 0xa8, 0xde, 0x3f, 0xd1, 0x1f, 0xbf, 0x6a, 
+  0xf9, 0xf8, 0xa9, 0x50, 0x3f, 0xf4, 0xfa, 0xe7, 0xb6, 0xd7, 0xfe, 0xf4, 0xb3, 0xde, 0x7f, 0xa3, 
+  0x8b, 0xdf, 0xe3, 0xe0, 0xda, 0x14, 0xfd, 0x47, 0xad, 0x68, 0x64, 0x8a, 0x52, 0x07, 0x66, 0x1f, 
+  0xd1, 0x78, 0x9f, 0x4e, 0xdc, 0xd9, 0xe3, 0xb6, 0x7f, 0x72, 0xbf, 0xf8, 0x31, 0x10, 0x7f, 0x6b, 
+  0x36, 0x46, 0x93, 0xfb, 0x84, 0xca, 0xfd, 0x19, 0x3d, 0x7c, 0xf5, 0x32, 0xac, 0xbd, 0xfb, 0x8b, 
+  0x9e, 0x7a, 0x7a, 0x7b, 0xfa, 0xf5, 0x8b, 0xd7, 0xaf, 0xeb, 0x6f, 0x69, 0xa0, 0xd5, 0xfb, 0x37, 
+  0x2f, 0xbe, 0xa8, 0xbf, 0x55, 0xaf, 0xb6, 0xd3, 0xa7, 0x33, 0xbc, 0x7e, 0xf1, 0xe6, 0xcd, 0x8f, 
+  0x61, 0xa3, 0xdd, 0x2f, 0x03, 0xf1, 0xfd, 0xeb, 0xb3, 0x9f, 0x5e, 0x7e, 0xd7, 0x7c, 0x41, 0x9d, 
+  0x3c, 0xfd, 0xf2, 0xab, 0xaf, 0x1b, 0x9d, 0x09, 0x7d, 0x86, 0x6a, 0x16, 0x43, 0xb6, 0x10, 0x34, 
+  0xb6, 0x69, 0x79, 0x85, 0xff, 0xfa, 0xb8, 0x09, 0xfa, 0xfe, 0x1c, 0xc2, 0xfb, 0x36, 0x5b, 0xf6, 
+  0x81, 0x5c, 0x35, 0xb8, 0xe8, 0xf9, 0x91, 0xb7, 0xb4, 0x31, 0xb2, 0xc5, 0x82, 0xd6, 0x6b, 0xda, 
+  0x23, 0xf0, 0x0e, 0xfc, 0xf3, 0xf3, 0xc5, 0xd3, 0x20, 0xdd, 0x56, 0x10, 0xab, 0x5f, 0xe8, 0x7b, 
+  0x7a, 0xdd, 0x23, 0x70, 0xb0, 0x93, 0xc9, 0xa0, 0xe1, 0x25, 0x34, 0x12, 0x30, 0xe7, 0x8d, 0x91, 
+  0x62, 0x27, 0x7c, 0x43, 0xd3, 0xf0, 0x44, 0x17, 0x49, 0xa5, 0x5c, 0x14, 0xa7, 0xb4, 0x7d, 0x89, 
+  0xe7, 0x0c, 0x5b, 0x56, 0x56, 0x2d, 0x6c, 0x58, 0xf5, 0x4a, 0xfe, 0xb1, 0xbd, 0xa4, 0x31, 0xa9, 
+  0x11, 0x55, 0x03, 0xac, 0x8f, 0x81, 0x6e, 0x68, 0x47, 0x2e, 0x82, 0x09, 0x77, 0xdd, 0xe9, 0x98, 
+  0x3f, 0x89, 0xa6, 0xbf, 0x51, 0xdf, 0x9f, 0xe8, 0x2e, 0xee, 0xc4, 0x2f, 0xd1, 0x31, 0x7a, 0x95, 
+  0xa4, 0xeb, 0x4d, 0xa9, 0x31, 0xcd, 0x16, 0x9d, 0x89, 0x09, 0x37, 0x6c, 0x2f, 0x36, 0x65, 0x99, 
+  0xa5, 0xc1, 0x93, 0xe3, 0x44, 0x7c, 0x41, 0xe5, 0xae, 0xce, 0x17, 0xb8, 0xfc, 0x01, 0x5a, 0x84, 
+  0xdf, 0x1e, 0x66, 0xbd, 0xf3, 0x87, 0xf3, 0xe2, 0xe9, 0xf9, 0x34, 0x8d, 0xcb, 0xe4, 0x56, 0x1e, 
+  0x9d, 0xdf, 0x1d, 0x8b, 0x5f, 0x55, 0x6d, 0x7f, 0xf1, 0xa7, 0x40, 0x0d, 0x34, 0x2d, 0xfe, 0xf9, 
+  0x1d, 0xfd, 0xa5, 0xd5, 0xd7, 0x0f, 0xa8, 0x2e, 0xf1, 0xf7, 0xe8, 0x78, 0x4a, 0xa3, 0x3a, 0x16, 
+  0xff, 0xac, 0x81, 0x17, 0x6f, 0x36, 0xda, 0x6b, 0x8b, 0xb8, 0xbf, 0x9c, 0x3d, 0x8c, 0xc4, 0xa7, 
+  0x3b, 0xee, 0xf8, 0x64, 0xab, 0x46, 0x45, 0x1b, 0x8f, 0x3b, 0x0d, 0x38, 0x95, 0x32, 0x6a, 0x25, 
+  0xee, 0x91, 0x37, 0x7c, 0x47, 0x24, 0xa8, 0xff, 0xe9, 0x27, 0x9f, 0x3c, 0xff, 0xd4, 0x72, 0x03, 
+  0x9d, 0x28, 0xdf, 0x6e, 0x53, 0x92, 0x10, 0x73, 0x92, 0x13, 0x15, 0xf1, 0xe3, 0xc3, 0x5f, 0x58, 
+  0x4f, 0x9c, 0xc2, 0xdc, 0x23, 0xef, 0xf1, 0x07, 0x41, 0xd8, 0xfa, 0xf2, 0xb3, 0xcf, 0x46, 0xc3, 
+  0xed, 0x27, 0x9f, 0x3c, 0xfb, 0xeb, 0xa7, 0x62, 0x34, 0x7c, 0xf6, 0xbc, 0x9b, 0x6f, 0x3f, 0xf9, 
+  0xf4, 0xf9, 0x33, 0x88, 0xb0, 0xa5, 0x8c, 0x8e, 0xa9, 0xc7, 0x84, 0xfd, 0xde, 0x8d, 0x96, 0xe7, 
+  0xef, 0xfe, 0x73, 0x39, 0xdb, 0xfe, 0xd6, 0x9f, 0xd0, 0xbc, 0xd3, 0xcf, 0x13, 0x8d, 0x17, 0xf5, 
+  0x9b, 0xfe, 0xf9, 0xe6, 0x15, 0xfd, 0xc3, 0x24, 0x90, 0x9c, 0x90, 0xca, 0x76, 0x82, 0x54, 0x4e, 
+  0xbc, 0xf3, 0x21, 0x44, 0x33, 0xe2, 0x26, 0xff, 0xdf, 0xff, 0xe7, 0xff, 0x78, 0x38, 0x40, 0x06, 
+  0x6d, 0xf1, 0x87, 0x82, 0xe4, 0xe1, 0x1e, 0x4d, 0x91, 0xd7, 0x93, 0x83, 0xb9, 0xee, 0xda, 0x0b, 
+  0x62, 0x33, 0x34, 0x55, 0xa1, 0xb7, 0x56, 0x9d, 0xe7, 0x8f, 0x3e, 0xa5, 0xa2, 0x47, 0x5e, 0xa8, 
+  0x8a, 0xef, 0x44, 0x5e, 0x3b, 0x7d, 0x7f, 0xc3, 0x47, 0x66, 0x32, 0xba, 0xaf, 0x9f, 0x04, 0x19, 
+  0xbe, 0x9c, 0xf5, 0x71, 0x86, 0x80, 0x40, 0x7f, 0x43, 0x64, 0xec, 0x86, 0x15, 0x3e, 0x24, 0x3d, 
+  0xac, 0xe2, 0x0b, 0xb9, 0xf2, 0x94, 0x86, 0x46, 0x3c, 0x2c, 0x92, 0x3c, 0xf4, 0x2a, 0xbd, 0x98, 
+  0x47, 0xc3, 0x22, 0x20, 0xf6, 0x56, 0xf2, 0x92, 0xa4, 0x27, 0xb6, 0x5a, 0xc8, 0xef, 0x1f, 0xde, 
+  0x1a, 0x25, 0x41, 0xf4, 0x87, 0x62, 0x33, 0xef, 0x07, 0xbc, 0xf9, 0xf0, 0x45, 0x11, 0x88, 0xfa, 
+  0x5d, 0x39, 0x75, 0xef, 0x8d, 0xba, 0xa5, 0x52, 0x26, 0xce, 0x63, 0x58, 0xd8, 0x50, 0x6f, 0xdf, 
+  0x46, 0x0f, 0x5c, 0x6d, 0x68, 0xb8, 0xd1, 0x49, 0x7d, 0x3e, 0x7f, 0xd7, 0xad, 0x4a, 0xa1, 0x5b, 
+  0x2d, 0x83, 0x60, 0x77, 0x90, 0xa7, 0x95, 0x0e, 0x4b, 0x3b, 0x26, 0xa2, 0xac, 0xf9, 0x57, 0xfa, 
+  0x19, 0x13, 0x93, 0x67, 0x98, 0x57, 0x90, 0x65, 0xe7, 0x1c, 0x3e, 0x93, 0x8d, 0x63, 0x77, 0x48, 
+  0xf0, 0xc4, 0xaf, 0x80, 0x7f, 0x59, 0x89, 0x25, 0x18, 0x8b, 0x72, 0x90, 0xdd, 0xa5, 0x32, 0x7f, 
+  0x69, 0x78, 0x94, 0x35, 0xf1, 0xdb, 0xa5, 0x1d, 0x4d, 0xf8, 0x57, 0x30, 0xa0, 0x29, 0xf4, 0x62, 
+  0xc4, 0x61, 0x18, 0xc6, 0xbe, 0xd2, 0xa1, 0x6e, 0xb7, 0x90, 0xee, 0x20, 0xce, 0xac, 0xbb, 0xdd, 
+  0xbf, 0xaa, 0x9f, 0x11, 0xdf, 0x56, 0xfc, 0x02, 0xe4, 0x17, 0x88, 0xb1, 0x3e, 0x2a, 0xae, 0x35, 
+  0xb6, 0xdd, 0x96, 0xe1, 0x3d, 0x78, 0xe4, 0xeb, 0x6e, 0xf7, 0x0d, 0x0d, 0x5f, 0xb0, 0x86, 0xf4, 
+  0x5a, 0x9c, 0x06, 0xac, 0x0e, 0x1f, 0xe9, 0x7a, 0xfd, 0x4d, 0xf4, 0x2b, 0xc9, 0xbb, 0x72, 0x0e, 
+  0x3e, 0x18, 0x3c, 0x49, 0x12, 0x6d, 0xa6, 0xa3, 0x19, 0x97, 0xf9, 0x6b, 0x84, 0xb6, 0x58, 0x79, 
+  0x0e, 0x55, 0x00, 0x34, 0xd2, 0x5a, 0xb1, 0xfa, 0xf9, 0xfd, 0x57, 0x50, 0x7d, 0x06, 0xb5, 0x8e, 
+  0xc4, 0x83, 0x64, 0x81, 0xc3, 0x3a, 0xfb, 0x50, 0xb1, 0xbd, 0x31, 0xa4, 0x11, 0xe6, 0x94, 0xa9, 
+  0xcc, 0x92, 0xb5, 0x0a, 0xcb, 0x96, 0xaa, 0xba, 0xdd, 0x1b, 0x92, 0x40, 0x62, 0x66, 0x97, 0x1f, 
+  0xaf, 0x07, 0x1d, 0xda, 0x4c, 0x9f, 0xcd, 0xcc, 0x7b, 0x03, 0x61, 0xa9, 0x70, 0xbb, 0x58, 0x7c, 
+  0x7e, 0xff, 0x26, 0xbe, 0xfc, 0x36, 0xbe, 0x91, 0x3e, 0x0b, 0x44, 0xe8, 0x21, 0x0f, 0xee, 0x39, 
+  0x74, 0x11, 0x8b, 0x7a, 0xc9, 0x53, 0x42, 0xa1, 0x05, 0xca, 0x62, 0xcd, 0xda, 0xdf, 0xbc, 0xb7, 
+  0x35, 0x5b, 0x12, 0xa3, 0xa1, 0xae, 0x42, 0xb8, 0x18, 0xfc, 0x51, 0x90, 0x88, 0xd2, 0xf9, 0x76, 
+  0x2a, 0xb1, 0x21, 0xa1, 0x67, 0xee, 0x5c, 0xd2, 0xb2, 0x5e, 0x0e, 0x4a, 0x59, 0xb0, 0x64, 0xa7, 
+  0xd6, 0x82, 0xd7, 0x94, 0x20, 0x46, 0xac, 0x22, 0x39, 0x36, 0x53, 0x65, 0x14, 0x35, 0x2c, 0xce, 
+  0x02, 0x66, 0x50, 0x77, 0x9d, 0xab, 0x56, 0x30, 0xec, 0x17, 0x6a, 0x6d, 0x5e, 0x94, 0x04, 0x41, 
+  0x84, 0xb1, 0xa5, 0xef, 0x25, 0x0b, 0x62, 0x8e, 0x26, 0x45, 0x54, 0x58, 0x51, 0x94, 0xd8, 0xe5, 
+  0x94, 0x84, 0x44, 0xe2, 0x55, 0x9b, 0x05, 0x45, 0x11, 0x9d, 0xe1, 0x0c, 0x9e, 0xb8, 0x60, 0x6c, 
+  0x2d, 0x6b, 0x3e, 0x90, 0xf5, 0xfb, 0xe3, 0x60, 0x4e, 0x62, 0x4c, 0xe4, 0xfd, 0xc5, 0xeb, 0x15, 
+  0x18, 0x40, 0x8f, 0x06, 0x87, 0x27, 0xc1, 0x78, 0x15, 0xcd, 0x07, 0xbf, 0x67, 0x49, 0xea, 0x13, 
+  0x46, 0x26, 0x71, 0x20, 0xfa, 0xbb, 0x19, 0x51, 0xb7, 0x7b, 0x4b, 0x8d, 0x39, 0xda, 0xf2, 0x80, 
+  0x00, 0x11, 0x73, 0xb1, 0x0a, 0x80, 0x0d, 0xf6, 0x26, 0x71, 0x39, 0x60, 0xb5, 0xee, 0x6b, 0x26, 
+  0x3c, 0x59, 0xfe, 0x82, 0xb6, 0xea, 0x8a, 0xa7, 0xcf, 0x6e, 0xf5, 0xdd, 0x32, 0x49, 0x69, 0x07, 
+  0xdf, 0x3f, 0x40, 0x2b, 0x75, 0x86, 0x05, 0x52, 0xfa, 0xf7, 0xc6, 0x70, 0x69, 0x6b, 0x1a, 0xe9, 
+  0xca, 0x97, 0x76, 0xd8, 0x4f, 0x84, 0xf7, 0x64, 0x44, 0x3d, 0x54, 0xfb, 0xb4, 0xda, 0xbc, 0x90, 
+  0x0a, 0x1e, 0x8c, 0xbc, 0x69, 0x08, 0xc5, 0x01, 0x45, 0xba, 0x96, 0x30, 0x4b, 0xcc, 0x40, 0xf0, 
+  0xd9, 0x1d, 0xe1, 0x13, 0x62, 0xcc, 0xbf, 0xd6, 0x06, 0x45, 0x0b, 0xea, 0x38, 0xc9, 0x4d, 0x72, 
+  0x9a, 0x0f, 0x8a, 0xab, 0x64, 0x59, 0xfa, 0xc1, 0x4c, 0xc8, 0x29, 0x97, 0x9d, 0x45, 0xa9, 0x83, 
+  0x2e, 0x0a, 0xe9, 0x9a, 0xc2, 0x4f, 0xcf, 0x66, 0x30, 0x2f, 0x91, 0xd5, 0xfb, 0x8d, 0x74, 0x8c, 
+  0xbf, 0x9b, 0xc7, 0x18, 0xcb, 0x44, 0xae, 0x16, 0xb4, 0x72, 0x9e, 0xc2, 0xa9, 0x1a, 0x57, 0x77, 
+  0xa8, 0x9f, 0x41, 0x35, 0x51, 0x46, 0xc5, 0x62, 0x27, 0xcc, 0x5d, 0x06, 0xcc, 0xdb, 0x81, 0x23, 
+  0x0c, 0xc6, 0x0d, 0x10, 0x5d, 0x9d, 0xde, 0xce, 0xe5, 0x3e, 0x8e, 0xd4, 0xf2, 0xdf, 0x96, 0xa6, 
+  0x33, 0x27, 0xc9, 0xcb, 0x88, 0xfd, 0x00, 0x93, 0xbb, 0x41, 0x4c, 0xab, 0xf1, 0x65, 0x9c, 0x2e, 
+  0x56, 0x84, 0x3e, 0x49, 0xf2, 0x27, 0xfc, 0x59, 0x55, 0xb6, 0x92, 0x35, 0x7d, 0x47, 0xb7, 0x2b, 
+  0x51, 0x01, 0x21, 0x33, 0xa6, 0x35, 0x06, 0x1d, 0xaa, 0xfb, 0xd2, 0xb9, 0xa7, 0x26, 0xb3, 0x4d, 
+  0x3e, 0x97, 0x5f, 0xe1, 0x60, 0xab, 0x5f, 0xba, 0x77, 0xd8, 0xcd, 0xb9, 0xd9, 0x92, 0x39, 0xe3, 
+  0x51, 0x96, 0xe2, 0xc7, 0x84, 0x4e, 0x07, 0x20, 0x43, 0xaf, 0x93, 0x8b, 0x15, 0xa1, 0xd3, 0x31, 
+  0xeb, 0x2b, 0x1d, 0x19, 0xab, 0x3f, 0xb2, 0x4a, 0x09, 0x36, 0xd1, 0xaa, 0x7a, 0xb9, 0xc4, 0x6c, 
+  0x3e, 0x34, 0x40, 0xc1, 0x39, 0xf9, 0x62, 0x0e, 0xc9, 0xb3, 0x5d, 0xde, 0xdf, 0x8d, 0xe8, 0x30, 
+  0x1f, 0x55, 0x50, 0x6b, 0xce, 0x54, 0xae, 0xa5, 0xa3, 0x9a, 0xdf, 0xd7, 0x66, 0x1f, 0xaa, 0x4d, 
+  0x77, 0xd3, 0xaf, 0xda, 0xc5, 0xc1, 0x89, 0x62, 0xc8, 0xf8, 0xce, 0x6d, 0xcf, 0x05, 0xb4, 0xc5, 
+  0x7b, 0xc6, 0x61, 0xe9, 0xf9, 0x44, 0xd6, 0xe0, 0xa3, 0x33, 0xaa, 0x91, 0xfe, 0x89, 0x43, 0xec, 
+  0xdd, 0x6b, 0xe7, 0x9b, 0x5a, 0x05, 0xf6, 0x43, 0xf4, 0x2d, 0xdc, 0xbb, 0x4d, 0x8a, 0x97, 0xce, 
+  0x83, 0xed, 0xd6, 0x7d, 0x42, 0x18, 0xae, 0x43, 0x50, 0x91, 0x60, 0x07, 0xb4, 0x7d, 0xed, 0xb4, 
+  0x8e, 0x31, 0xbb, 0xef, 0x9c, 0x71, 0x5f, 0x49, 0x22, 0x11, 0xf6, 0xc8, 0xc7, 0x61, 0x6e, 0x32, 
+  0xfb, 0x34, 0x8b, 0x7a, 0x99, 0x70, 0x5f, 0xd5, 0x61, 0x9c, 0xa0, 0x32, 0x86, 0x4e, 0xc6, 0xb2, 
+  0x03, 0x59, 0x20, 0x92, 0x28, 0x37, 0x90, 0x9e, 0x00, 0xd2, 0x09, 0xbc, 0xa3, 0x7c, 0x9a, 0xcc, 
+  0x80, 0xcb, 0x59, 0x7c, 0xef, 0xf8, 0x25, 0x7e, 0x70, 0x0d, 0x03, 0x1f, 0xd7, 0x8e, 0xf4, 0x56, 
+  0xd6, 0xbd, 0x5f, 0xac, 0xe2, 0x59, 0xb6, 0xd2, 0x29, 0x1a, 0xdb, 0x0e, 0x7d, 0x91, 0x50, 0x26, 
+  0x2d, 0xa2, 0x0c, 0xa6, 0x3f, 0xac, 0x11, 0xc2, 0x61, 0x6c, 0x82, 0xfb, 0xa4, 0xf8, 0xe5, 0x9b, 
+  0xaf, 0xa3, 0x16, 0x18, 0x42, 0x67, 0x9a, 0xe4, 0x5f, 0x06, 0x56, 0x39, 0xa2, 0x9b, 0x32, 0xba, 
+  0x57, 0x4c, 0xb6, 0xf7, 0xe5, 0x9b, 0x6f, 0xbe, 0xae, 0xd3, 0x96, 0x9d, 0x78, 0xc3, 0x8d, 0xca, 
+  0xd2, 0x54, 0x12, 0xb5, 0xa8, 0x9e, 0xa1, 0xca, 0x98, 0xec, 0x37, 0x16, 0xde, 0x3b, 0xec, 0x36, 
+  0x78, 0x0e, 0x30, 0x0f, 0xb9, 0xb3, 0x99, 0xf3, 0x66, 0x6f, 0x98, 0x13, 0xf0, 0xaf, 0xa3, 0x7c, 
+  0xaf, 0x9f, 0xe2, 0x34, 0xea, 0x24, 0xfe, 0x35, 0x31, 0x87, 0xaa, 0x2a, 0xda, 0xc0, 0xd7, 0x03, 
+  0x6d, 0xbc, 0x0b, 0x9b, 0x47, 0x82, 0x7c, 0x1c, 0x6e, 0xaf, 0xe9, 0x6d, 0x8a, 0xb7, 0x83, 0x78, 
+  0xb1, 0x38, 0x83, 0xeb, 0xc5, 0xd7, 0x49, 0x51, 0x4a, 0xea, 0xd7, 0x64, 0xff, 0x11, 0x0e, 0xe9, 
+  0x57, 0x59, 0x4c, 0xe4, 0x2e, 0x97, 0xa2, 0x33, 0x0a, 0xc2, 0x14, 0x28, 0x8b, 0x30, 0x39, 0x97, 
+  0x42, 0x85, 0xce, 0x2d, 0xd1, 0xde, 0xb4, 0x2a, 0x4e, 0xe4, 0x68, 0xc1, 0xf8, 0x8d, 0xa9, 0x4d, 
+  0x11, 0x6d, 0xda, 0x18, 0x67, 0xda, 0x18, 0x73, 0xc3, 0x00, 0x44, 0x24, 0x59, 0x89, 0x8e, 0x6c, 
+  0xd0, 0x64, 0xfb, 0x1a, 0xc6, 0x16, 0x62, 0xd1, 0x0a, 0x02, 0x07, 0xeb, 0x76, 0x0f, 0xa3, 0x0d, 
+  0x75, 0x38, 0xcd, 0x6e, 0x14, 0x75, 0x20, 0x5a, 0xaf, 0x9b, 0xdb, 0xe7, 0x7d, 0xa0, 0x08, 0xd0, 
+  0x00, 0xbc, 0xdf, 0xaa, 0x65, 0x59, 0xa2, 0x1f, 0x14, 0xfd, 0xbe, 0x3e, 0xc4, 0xfc, 0xa8, 0x2f, 
+  0xc1, 0xab, 0x1d, 0xe8, 0x62, 0x5c, 0xeb, 0x22, 0xc1, 0x1e, 0xf1, 0x70, 0x67, 0xa2, 0xd3, 0xa8, 
+  0x10, 0x75, 0x11, 0xff, 0xd3, 0xf2, 0xd4, 0x3f, 0x6b, 0x76, 0x13, 0x8d, 0x4d, 0xfc, 0xbb, 0xc1, 
+  0x32, 0x59, 0x95, 0x32, 0x1f, 0x7c, 0xf5, 0xb2, 0x0d, 0xf0, 0x2d, 0xa1, 0xff, 0x27, 0xc9, 0x84, 
+  0xc1, 0xf8, 0x20, 0xd6, 0x3b, 0x92, 0x2d, 0x1c, 0x92, 0x42, 0x20, 0x02, 0x4d, 0xa4, 0x8b, 0x7a, 
+  0x03, 0xc0, 0x0b, 0x44, 0x39, 0xec, 0x8e, 0x6d, 0x32, 0xbf, 0xdd, 0xee, 0xa9, 0xa5, 0x67, 0x4d, 
+  0x66, 0xb6, 0xea, 0x47, 0x3a, 0x21, 0xac, 0x10, 0x4e, 0x67, 0xbb, 0x5d, 0x10, 0x3e, 0x3a, 0x92, 
+  0xf4, 0x43, 0x46, 0xa2, 0x86, 0x5c, 0x47, 0x22, 0x76, 0x44, 0x0a, 0x87, 0xef, 0x3f, 0x53, 0x23, 
+  0xb5, 0x07, 0xa3, 0x60, 0x03, 0x6e, 0xe3, 0xd5, 0x46, 0x13, 0x8d, 0xff, 0xe1, 0xd8, 0xd5, 0xb9, 
+  0x65, 0xeb, 0x0c, 0x50, 0x05, 0x19, 0x57, 0x43, 0x9b, 0x37, 0x3b, 0xd0, 0x2b, 0xde, 0xc7, 0xa6, 
+  0x37, 0x86, 0xc1, 0x26, 0xf6, 0x92, 0xcf, 0x8d, 0x92, 0xa8, 0x6c, 0x81, 0x12, 0x19, 0xb0, 0x8c, 
+  0x96, 0x45, 0x89, 0x16, 0xcf, 0xfe, 0xbd, 0x16, 0x34, 0xab, 0xc8, 0x2b, 0x63, 0xe6, 0xe0, 0xcd, 
+  0x8b, 0x2f, 0xa2, 0xf6, 0x5d, 0x39, 0x69, 0x95, 0xd5, 0x5b, 0xe7, 0xc7, 0xf9, 0xe8, 0xa0, 0x30, 
+  0x12, 0xb2, 0x58, 0x40, 0xef, 0xf7, 0x38, 0x5f, 0x69, 0x0e, 0x27, 0x77, 0x07, 0x8e, 0xbe, 0xec, 
+  0xd9, 0xc8, 0xc1, 0xca, 0x31, 0xf1, 0xb4, 0xe7, 0x3b, 0xd5, 0x70, 0x8f, 0xb2, 0xb1, 0xe6, 0x8c, 
+  0x32, 0x3e, 0x99, 0x19, 0x07, 0x23, 0x36, 0xfb, 0x75, 0x51, 0x33, 0x33, 0xb8, 0xa9, 0x7b, 0x7e, 
+  0xa2, 0x27, 0x85, 0x55, 0x79, 0xd1, 0x61, 0x69, 0xe9, 0xc3, 0xa0, 0xa6, 0xfe, 0xcd, 0x69, 0x60, 
+  0x6d, 0x1f, 0x0e, 0x08, 0x50, 0xd0, 0x2e, 0x14, 0x18, 0xec, 0x25, 0xfe, 0x28, 0x31, 0xaa, 0x42, 
+  0x51, 0xcd, 0x69, 0xe3, 0x33, 0xce, 0x06, 0x56, 0xda, 0x47, 0x47, 0x29, 0x11, 0x01, 0xd0, 0xbc, 
+  0xc8, 0x3b, 0x89, 0x8f, 0x08, 0x39, 0x7d, 0xe4, 0xf5, 0xce, 0x7a, 0xde, 0x47, 0x9f, 0x9d, 0x1c, 
+  0xc7, 0x9f, 0x9d, 0x68, 0x13, 0x52, 0xfb, 0xb8, 0x0f, 0x8d, 0xf7, 0x47, 0x47, 0x37, 0x05, 0xf1, 
+  0xd1, 0xd9, 0xdd, 0x3c, 0x5e, 0xc3, 0xfb, 0x24, 0xfa, 0x88, 0x4a, 0x67, 0x6b, 0xcd, 0xcd, 0x2b, 
+  0x95, 0x3c, 0x3f, 0x3b, 0x56, 0x0f, 0xe9, 0x42, 0x3d, 0xfe, 0xcc, 0x23, 0x16, 0x62, 0x6f, 0x71, 
+  0xbd, 0x69, 0xbd, 0xba, 0xdf, 0xe8, 0xdb, 0x99, 0x45, 0xce, 0xdd, 0xee, 0xa5, 0x5a, 0x05, 0x0f, 
+  0x2a, 0xf2, 0x59, 0x54, 0x69, 0xc7, 0xa1, 0xad, 0x3e, 0x67, 0xbd, 0x69, 0x6b, 0xa5, 0xa6, 0x27, 
+  0x55, 0x55, 0xdb, 0xad, 0xa9, 0xaa, 0xd2, 0xc3, 0x4f, 0x42, 0xde, 0x05, 0x5b, 0xa5, 0x7c, 0x3c, 
+  0x54, 0x57, 0xb2, 0xf8, 0xef, 0x48, 0x8d, 0xbf, 0xad, 0x36, 0x7a, 0xd7, 0xfe, 0x5d, 0xa8, 0x0f, 
+  0x2a, 0x5a, 0xbe, 0xa9, 0x5e, 0xb5, 0x7e, 0x19, 0xff, 0x85, 0x9b, 0xeb, 0x3d, 0x6d, 0xf9, 0x74, 
+  0xf0, 0x97, 0x41, 0x0f, 0x6a, 0x42, 0x26, 0x97, 0x8d, 0xe5, 0x95, 0x8d, 0xf5, 0xbc, 0xca, 0xe5, 
+  0x92, 0xa6, 0xf3, 0xc8, 0xb2, 0x86, 0x1f, 0x99, 0xab, 0xfa, 0x02, 0xb7, 0xbe, 0x57, 0xab, 0x77, 
+  0xec, 0x2c, 0xdf, 0xf8, 0x80, 0x18, 0xa6, 0x58, 0x71, 0x58, 0x88, 0xd5, 0xa5, 0x68, 0x70, 0xe1, 
+  0x24, 0x08, 0xab, 0xd3, 0x16, 0x1e, 0xaa, 0x0b, 0x7d, 0x65, 0xd0, 0x28, 0x0e, 0x37, 0x54, 0x2a, 
+  0xfe, 0xf2, 0xd0, 0x32, 0xe0, 0x7d, 0xb4, 0x68, 0x83, 0x0d, 0xfe, 0x52, 0xe9, 0x85, 0xed, 0x41, 
+  0x0a, 0xd5, 0xf2, 0x8c, 0xc9, 0x41, 0xcb, 0xc2, 0x68, 0x67, 0xd8, 0x96, 0x9a, 0xec, 0x2b, 0xe1, 
+  0x85, 0x66, 0x2e, 0xa8, 0xa6, 0xbd, 0x7d, 0x63, 0x67, 0x8c, 0xa4, 0xd5, 0x83, 0xcd, 0x54, 0x15, 
+  0x7c, 0x68, 0x3b, 0x6d, 0xd5, 0x3c, 0x15, 0xe1, 0x3b, 0x7a, 0x65, 0xbe, 0x14, 0x83, 0xa7, 0x21, 
+  0xd6, 0x3e, 0x00, 0x02, 0xb8, 0x81, 0x90, 0x2b, 0x0b, 0x53, 0xde, 0x20, 0x83, 0x55, 0x14, 0x9b, 
+  0x57, 0xdb, 0x6d, 0x3c, 0xb8, 0x93, 0x17, 0xd7, 0x49, 0xf9, 0x4d, 0xbd, 0x2c, 0x5e, 0xdc, 0x64, 
+  0x7f, 0xb6, 0x3c, 0xcd, 0xda, 0x4a, 0x16, 0x8d, 0x87, 0xc0, 0x2e, 0x0d, 0xe8, 0x5b, 0x60, 0x56, 
+  0xac, 0xf5, 0x36, 0x97, 0x8f, 0x56, 0xc6, 0x88, 0x8a, 0x4f, 0x5e, 0xaa, 0xbb, 0x69, 0xd1, 0xc1, 
+  0x3e, 0xe7, 0x91, 0x15, 0x7a, 0x64, 0x9d, 0xc8, 0x13, 0x3f, 0x02, 0xaa, 0x2f, 0xa3, 0x4b, 0x3b, 
+  0x61, 0x8e, 0x26, 0xfc, 0x52, 0xab, 0x56, 0xb6, 0x60, 0xec, 0xa0, 0xc4, 0x69, 0x29, 0x53, 0xb8, 
+  0x65, 0x4a, 0x33, 0x1f, 0x31, 0xdc, 0xb7, 0x21, 0x93, 0x19, 0xce, 0xfc, 0xfb, 0xac, 0x48, 0xd0, 
+  0x6d, 0x98, 0x74, 0x12, 0x9b, 0xee, 0x14, 0x4b, 0xcb, 0x38, 0x49, 0x8b, 0x60, 0xd2, 0x66, 0x92, 
+  0xf0, 0xd7, 0x9a, 0x60, 0x3e, 0x91, 0x4d, 0x06, 0x3d, 0x84, 0x00, 0x5f, 0xd6, 0x55, 0x0a, 0x63, 
+  0xe7, 0x4c, 0x95, 0x66, 0xb2, 0xe3, 0x77, 0x72, 0xa5, 0xbc, 0xac, 0x84, 0x00, 0x3c, 0x4d, 0x6d, 
+  0xd3, 0x93, 0xea, 0x92, 0x44, 0xf9, 0x50, 0x1e, 0xea, 0x7a, 0xb7, 0x3b, 0xfa, 0xb4, 0x7b, 0xf0, 
+  0x2d, 0x1b, 0x0a, 0x35, 0xc9, 0x25, 0xd1, 0xa1, 0x52, 0xa9, 0x03, 0xca, 0xa8, 0xd6, 0x47, 0xb0, 
+  0x0b, 0xa5, 0xc3, 0x0a, 0x74, 0x86, 0x63, 0xab, 0x35, 0x11, 0x2f, 0xa3, 0x72, 0xb2, 0x57, 0x8f, 
+  0x74, 0xcf, 0x67, 0x71, 0x4e, 0x2c, 0x86, 0x63, 0x35, 0x49, 0x9d, 0x83, 0x7d, 0xea, 0x77, 0xca, 
+  0x43, 0xaf, 0x2c, 0x67, 0xb8, 0xdd, 0xfa, 0x23, 0x08, 0x36, 0x6d, 0x72, 0x1b, 0x6c, 0xa7, 0xf7, 
+  0xb5, 0xb9, 0x70, 0x32, 0x3b, 0x34, 0x09, 0x65, 0x10, 0x8e, 0x02, 0x9a, 0xde, 0x05, 0x5b, 0xa2, 
+  0xbd, 0x94, 0x90, 0x64, 0xa0, 0xbd, 0x3f, 0xd8, 0x0f, 0x25, 0x69, 0xa7, 0x13, 0x0c, 0xef, 0x1a, 
+  0xd2, 0x78, 0xad, 0x35, 0x7a, 0x78, 0x0f, 0x7d, 0xec, 0xbd, 0x90, 0xec, 0xb1, 0x56, 0xaa, 0x52, 
+  0xe5, 0xa1, 0x52, 0x25, 0xdc, 0xdd, 0x36, 0x93, 0xaf, 0xfd, 0x0d, 0x7d, 0xd0, 0xc7, 0x0f, 0x75, 
+  0x68, 0x18, 0x7e, 0xdc, 0x4d, 0xd9, 0xdf, 0xad, 0x6d, 0x7d, 0x0e, 0xce, 0xab, 0x35, 0x2b, 0xa9, 
+  0x96, 0x8d, 0xf9, 0x1d, 0xe7, 0x36, 0x8e, 0xa6, 0x72, 0x06, 0x06, 0x41, 0x79, 0x31, 0x75, 0x12, 
+  0x1a, 0x79, 0x16, 0x38, 0xf0, 0x77, 0x6d, 0x3b, 0x4d, 0xfd, 0x4a, 0x70, 0x93, 0xb5, 0x75, 0x90, 
+  0x8d, 0x82, 0xa9, 0x94, 0xfd, 0x56, 0x2b, 0xaa, 0xc6, 0xda, 0xae, 0x88, 0x95, 0x49, 0x2e, 0xf4, 
+  0xc4, 0x83, 0x4d, 0xaa, 0xb4, 0x7c, 0xa9, 0x29, 0x54, 0xee, 0x15, 0x2a, 0x9a, 0x85, 0xc6, 0x31, 
+  0x6c, 0x8b, 0xa3, 0xa8, 0x80, 0x45, 0x4c, 0x40, 0x6c, 0xab, 0x65, 0xb3, 0x26, 0xd4, 0x20, 0x5e, 
+  0x0a, 0xbc, 0x0a, 0x42, 0x5d, 0xee, 0x1e, 0x1d, 0x2e, 0xcc, 0xf5, 0x28, 0x1c, 0x12, 0xa6, 0xb8, 
+  0xde, 0x09, 0x12, 0xcd, 0x35, 0xaa, 0x6b, 0x3f, 0x3b, 0xe2, 0xf3, 0x08, 0x76, 0x74, 0xe3, 0x3f, 
+  0x65, 0xe0, 0x7e, 0x62, 0x11, 0xe7, 0xde, 0x42, 0xb4, 0x01, 0xa0, 0x39, 0x35, 0x90, 0x7c, 0x6a, 
+  0x60, 0x25, 0x93, 0x7f, 0x08, 0x2f, 0xfa, 0xe8, 0xc9, 0x08, 0x5c, 0x8b, 0xd8, 0x43, 0xc9, 0xc4, 
+  0xd7, 0xb1, 0xa6, 0xbb, 0xb4, 0x9a, 0x6e, 0x42, 0xc9, 0x9d, 0x42, 0x21, 0x9c, 0x52, 0xd9, 0xa1, 
+  0x39, 0xba, 0x6f, 0x7a, 0xc2, 0x0a, 0x61, 0xb5, 0x97, 0x2c, 0xbe, 0x2c, 0x99, 0x81, 0xa5, 0xdd, 
+  0xd1, 0x82, 0x63, 0x01, 0xa6, 0x06, 0x11, 0xe9, 0x93, 0x90, 0xea, 0x81, 0x45, 0x32, 0xf6, 0xd4, 
+  0xc0, 0xd1, 0x20, 0xeb, 0x47, 0xc3, 0x93, 0x0c, 0x9a, 0xdd, 0x6b, 0x35, 0x41, 0x04, 0x43, 0x56, 
+  0xe4, 0xc4, 0x4c, 0x19, 0x64, 0xd4, 0x3a, 0xbb, 0xef, 0x99, 0xa5, 0x1b, 0x2e, 0xcb, 0xd5, 0x40, 
+  0x51, 0xd0, 0xa8, 0xe2, 0xf1, 0x8f, 0x35, 0x3a, 0xa9, 0xa9, 0x50, 0x1b, 0xd6, 0x33, 0x33, 0xa5, 
+  0x2f, 0x7d, 0xa1, 0x66, 0xc9, 0x2d, 0x29, 0x1a, 0x25, 0x83, 0x89, 0x3a, 0x10, 0xed, 0x9c, 0x1a, 
+  0x51, 0x62, 0xdc, 0x14, 0x57, 0xf2, 0x49, 0x1e, 0xba, 0xfa, 0x0c, 0x5a, 0x93, 0xd3, 0x49, 0x43, 
+  0x3c, 0xa6, 0xdd, 0xc1, 0x06, 0x51, 0x7b, 0x52, 0x15, 0x2f, 0x64, 0x3e, 0x28, 0xd6, 0x72, 0x9e, 
+  0x2c, 0x13, 0xb9, 0x98, 0xe4, 0x4a, 0xbc, 0x0a, 0x59, 0x7f, 0x8c, 0xf1, 0xcb, 0x82, 0xf8, 0x5b, 
+  0xd9, 0x62, 0xf3, 0xdf, 0xb0, 0x8d, 0x53, 0x07, 0x12, 0xea, 0x13, 0x8e, 0x90, 0xf0, 0x98, 0x99, 
+  0xa4, 0xf7, 0xfa, 0x9e, 0x16, 0xe7, 0xdd, 0x11, 0x97, 0x14, 0x47, 0x9b, 0x34, 0x97, 0xf3, 0xec, 
+  0x32, 0x4d, 0xfe, 0x94, 0x8b, 0x23, 0xf9, 0x6e, 0x0d, 0x1f, 0x1a, 0x44, 0xd5, 0x38, 0xf2, 0x7a, 
+  0xba, 0xca, 0x4d, 0x9a, 0x10, 0x83, 0xf1, 0x1a, 0xca, 0xb3, 0x16, 0x1d, 0x16, 0xa4, 0x0a, 0x85, 
+  0x66, 0x18, 0x07, 0x10, 0xfa, 0x21, 0x70, 0x93, 0x25, 0x81, 0xda, 0xcb, 0x0d, 0x6c, 0x77, 0x89, 
+  0xe7, 0x2b, 0xc4, 0x26, 0xd2, 0xe8, 0xf4, 0x75, 0x09, 0xae, 0x85, 0xd5, 0xd1, 0xea, 0x2c, 0x16, 
+  0xec, 0x0b, 0xbb, 0x07, 0xbf, 0x0c, 0xc4, 0x5c, 0xe9, 0x0f, 0x89, 0xd0, 0x48, 0x2d, 0x5d, 0x31, 
+  0x7d, 0x99, 0x26, 0xd8, 0x02, 0x50, 0x93, 0x6b, 0xd3, 0x2f, 0x8d, 0x0a, 0x58, 0x5b, 0x2e, 0xb5, 
+  0x85, 0xb0, 0x0f, 0x4d, 0xb9, 0x20, 0xf4, 0xa8, 0x97, 0x68, 0xa3, 0xfc, 0x54, 0x25, 0xbc, 0x37, 
+  0x32, 0x9e, 0xfc, 0x37, 0x70, 0x58, 0x68, 0x1b, 0x80, 0xe7, 0x59, 0x3c, 0x69, 0x00, 0x9f, 0xb1, 
+  0x99, 0x3a, 0x4f, 0xc2, 0xe9, 0xd9, 0x76, 0xfb, 0x57, 0xf5, 0x33, 0xe2, 0x5b, 0x7e, 0xb1, 0x6f, 
+  0x3c, 0xc8, 0x2e, 0x11, 0x6c, 0x7e, 0x90, 0x5a, 0x6c, 0x5c, 0x7b, 0xc8, 0xdd, 0x96, 0xd4, 0x0c, 
+  0x9b, 0x1a, 0x30, 0x5b, 0x38, 0x96, 0x63, 0x3c, 0x70, 0xb4, 0xec, 0x41, 0xda, 0x8b, 0x32, 0x48, 
+  0x6d, 0xe6, 0xec, 0xea, 0xb9, 0x6a, 0xfa, 0x63, 0xf7, 0x18, 0x4f, 0xf5, 0xf4, 0x1f, 0x80, 0x96, 
+  0x9d, 0x35, 0x9c, 0xe3, 0x79, 0x53, 0x92, 0x3c, 0xd7, 0x51, 0x56, 0xba, 0x93, 0x9d, 0xf0, 0xef, 
+  0x94, 0x3e, 0x52, 0x21, 0x98, 0x22, 0x7a, 0x70, 0x4e, 0x5e, 0xc2, 0x4f, 0x86, 0xda, 0x73, 0xfd, 
+  0xfb, 0x42, 0x6e, 0x16, 0x59, 0x58, 0x48, 0xc1, 0x18, 0x29, 0xfc, 0x53, 0x54, 0xdb, 0x03, 0x46, 
+  0xc0, 0x90, 0x63, 0xf1, 0x8b, 0x20, 0x2d, 0xb0, 0x53, 0x08, 0x1f, 0xbc, 0xcf, 0xbc, 0x70, 0xff, 
+  0xf0, 0x5a, 0xd9, 0xac, 0xc3, 0x30, 0x15, 0x67, 0xe7, 0x7b, 0xef, 0xe9, 0x71, 0xcf, 0x3e, 0xce, 
+  0xe5, 0x6d, 0x92, 0x6d, 0x0a, 0x3d, 0xfc, 0xda, 0xb7, 0xff, 0x7d, 0xa8, 0xd0, 0x6e, 0x27, 0xe8, 
+  0xd1, 0x2b, 0xd6, 0x01, 0x85, 0x0f, 0x6c, 0xe4, 0xd2, 0xa6, 0xa7, 0x9a, 0x8e, 0xa0, 0x4c, 0x1e, 
+  0xcd, 0xea, 0xfa, 0x20, 0x21, 0xa7, 0xcf, 0x67, 0xc4, 0x2c, 0xd0, 0x5f, 0xc2, 0x1e, 0xd3, 0x8f, 
+  0xf9, 0xef, 0x27, 0x70, 0x10, 0x71, 0xb6, 0x94, 0x2a, 0x09, 0x39, 0x8d, 0x41, 0xf0, 0x99, 0xd2, 
+  0x51, 0xd3, 0x77, 0x38, 0xba, 0xc3, 0x05, 0x9f, 0x60, 0x89, 0xca, 0xa6, 0xe0, 0x63, 0xda, 0x2c, 
+  0xca, 0x7a, 0xe6, 0xd1, 0x9e, 0xd4, 0x30, 0x8c, 0xf0, 0xd2, 0xf2, 0x4a, 0x35, 0x40, 0xaf, 0x4c, 
+  0x4d, 0xcf, 0x83, 0x89, 0xee, 0x9c, 0xd9, 0xcf, 0x74, 0x3b, 0x9c, 0xa1, 0xdf, 0x1f, 0xcf, 0xa2, 
+  0x9e, 0x8f, 0x9f, 0x09, 0x7a, 0x8c, 0xcb, 0x4f, 0xa9, 0xd8, 0x28, 0x08, 0x9f, 0x3d, 0xf5, 0x3d, 
+  0x98, 0xb5, 0xa8, 0xca, 0x9e, 0xb3, 0xb7, 0xcb, 0x62, 0x61, 0xee, 0x02, 0x7c, 0xfb, 0x89, 0xfa, 
+  0xf6, 0x3f, 0x67, 0xd4, 0xfd, 0xff, 0xda, 0x2b, 0x10, 0xe2, 0xa7, 0xdb, 0x6d, 0xb6, 0xb8, 0x33, 
+  0xa6, 0x42, 0x6d, 0x1b, 0xa7, 0x83, 0xe6, 0x69, 0x2f, 0xd3, 0xec, 0x18, 0x48, 0xfb, 0x73, 0xc0, 
+  0x73, 0xa0, 0x4f, 0x30, 0x51, 0xc7, 0x04, 0xfb, 0x30, 0xe4, 0x01, 0x4d, 0x50, 0x32, 0xaa, 0xcf, 
+  0x38, 0x4c, 0xce, 0x7f, 0x52, 0xc5, 0x53, 0xd0, 0xb5, 0x32, 0xba, 0xf2, 0x53, 0xf8, 0x9c, 0xa9, 
+  0x9b, 0xd4, 0x78, 0x62, 0xf9, 0x24, 0x69, 0x0b, 0x73, 0x50, 0xd6, 0x2f, 0x83, 0xbe, 0xb9, 0x0e, 
+  0x78, 0x61, 0x86, 0xa8, 0x77, 0x58, 0xcd, 0x61, 0x89, 0x11, 0x53, 0x63, 0xa9, 0xf3, 0xc4, 0x5d, 
+  0xad, 0xe7, 0xf0, 0x68, 0x17, 0x4b, 0x0d, 0x40, 0x30, 0xa2, 0x7a, 0xaf, 0x42, 0xb4, 0xf5, 0x48, 
+  0x89, 0x24, 0x14, 0xb6, 0x30, 0xd9, 0xf7, 0x7b, 0x1e, 0xb6, 0xc7, 0xed, 0xb2, 0x27, 0x04, 0xc0, 
+  0x81, 0xed, 0xa7, 0x55, 0x5a, 0x95, 0xaa, 0x2c, 0xbf, 0xf6, 0xbb, 0xb5, 0xd6, 0x07, 0xe0, 0x56, 
+  0x0f, 0x49, 0xec, 0x6f, 0x59, 0x33, 0xfe, 0xf1, 0x7f, 0xb3, 0xd6, 0x6b, 0x54, 0x54, 0x59, 0xfc, 
+  0xc0, 0x4a, 0x09, 0x73, 0xba, 0x26, 0x92, 0xd6, 0x16, 0x6c, 0x4c, 0x2d, 0x41, 0x0b, 0x52, 0x9b, 
+  0x57, 0xca, 0x26, 0xe7, 0x66, 0xbb, 0x3d, 0xa0, 0x3b, 0x6d, 0xea, 0x4d, 0xb5, 0xae, 0xde, 0x0b, 
+  0x78, 0x7b, 0xed, 0x68, 0x93, 0xd4, 0x77, 0x2b, 0xeb, 0x3d, 0x1f, 0x39, 0xd2, 0xd3, 0x5c, 0x00, 
+  0xd8, 0xb1, 0x60, 0xdc, 0x30, 0xb7, 0x86, 0xf0, 0x07, 0x09, 0x29, 0x84, 0x78, 0xe4, 0x97, 0x3d, 
+  0x60, 0x72, 0x4f, 0x3d, 0x9a, 0x80, 0x72, 0x24, 0xa1, 0x29, 0x31, 0x29, 0x3b, 0x7c, 0xfb, 0x9b, 
+  0xbe, 0x4d, 0xba, 0x5d, 0x76, 0x9f, 0xb2, 0xd0, 0x95, 0x04, 0xa1, 0xf7, 0xb4, 0x7a, 0xd9, 0x1f, 
+  0x9d, 0xd4, 0xdf, 0x3d, 0xa9, 0xde, 0x69, 0x13, 0x55, 0xbf, 0x9f, 0x18, 0x08, 0x54, 0x4d, 0xfd, 
+  0xb7, 0x2e, 0x42, 0xdf, 0xc2, 0xb0, 0xb7, 0x57, 0xf1, 0x7a, 0x5f, 0x01, 0x0b, 0xb2, 0x19, 0x51, 
+  0x50, 0xab, 0x74, 0xab, 0xbe, 0x60, 0x40, 0x67, 0x1c, 0x5f, 0x5a, 0xf8, 0x34, 0x75, 0xf7, 0x46, 
+  0x5c, 0x7b, 0xcf, 0xeb, 0x7b, 0x0c, 0xb1, 0x0d, 0x0c, 0x73, 0x25, 0xc0, 0xa0, 0xdc, 0x8a, 0x4b, 
+  0x35, 0x5d, 0x37, 0x11, 0x23, 0x14, 0x1a, 0xeb, 0x95, 0x03, 0xe9, 0xe2, 0x3e, 0xf2, 0x60, 0xd6, 
+  0xe6, 0x3e, 0xef, 0x7f, 0x0c, 0xb3, 0x5e, 0x4f, 0x1b, 0xed, 0x31, 0x0c, 0x9b, 0xd9, 0x05, 0x89, 
+  0xbb, 0x55, 0xf3, 0x73, 0xd9, 0x12, 0x97, 0xae, 0xd3, 0x71, 0xc5, 0x89, 0xdd, 0x61, 0xc3, 0x70, 
+  0x63, 0xc0, 0x13, 0xdd, 0x74, 0xc0, 0x7b, 0x7b, 0x0e, 0x8d, 0xf3, 0x5a, 0xd0, 0xfe, 0xaa, 0x2e, 
+  0xa6, 0x2c, 0xa3, 0x8b, 0xc3, 0x3b, 0x44, 0xac, 0xa3, 0x0e, 0xdc, 0x13, 0x2e, 0xc4, 0x82, 0xe3, 
+  0x50, 0xc0, 0x22, 0x02, 0x34, 0xf9, 0x46, 0x33, 0x10, 0xf3, 0xb1, 0xba, 0x88, 0x69, 0x54, 0x71, 
+  0x14, 0x4f, 0xe7, 0x4a, 0xb9, 0x7d, 0x31, 0x89, 0x0f, 0x6f, 0xb9, 0x65, 0x88, 0x81, 0xc7, 0x4d, 
+  0xde, 0x97, 0xaa, 0xdf, 0x44, 0x73, 0x9a, 0xa9, 0x74, 0xc5, 0x8e, 0x77, 0x57, 0xd4, 0xec, 0x06, 
+  0x5e, 0x9a, 0xce, 0x68, 0x76, 0x76, 0xcb, 0xc3, 0x9a, 0x26, 0x9a, 0xde, 0x4f, 0x56, 0x0e, 0x89, 
+  0x0f, 0x57, 0x03, 0xcc, 0x3e, 0x5f, 0xcf, 0x04, 0x49, 0x79, 0x6b, 0xd5, 0xb9, 0x45, 0xe4, 0x17, 
+  0xf0, 0xe8, 0x21, 0xb1, 0xc9, 0xcf, 0x22, 0xea, 0xeb, 0x2a, 0x98, 0x9e, 0xcd, 0xe0, 0x37, 0x04, 
+  0x83, 0x86, 0x87, 0x5d, 0x10, 0x4c, 0x63, 0xcd, 0x7b, 0x7d, 0xf5, 0x12, 0xcf, 0x33, 0xf7, 0x5e, 
+  0x15, 0xb8, 0x9a, 0xc1, 0xde, 0x29, 0x00, 0xfa, 0x8b, 0xa2, 0xd7, 0xc4, 0x4d, 0xc2, 0xdc, 0x08, 
+  0x3f, 0xcf, 0x66, 0x24, 0xd9, 0x15, 0xdd, 0xee, 0xca, 0x31, 0x01, 0x9b, 0x16, 0x33, 0x9a, 0x8d, 
+  0x5e, 0x8f, 0x1e, 0xc7, 0xf4, 0x7f, 0x9a, 0x15, 0xaa, 0x74, 0x11, 0x15, 0xd1, 0x90, 0x36, 0xe7, 
+  0x06, 0x26, 0xd9, 0x84, 0xd6, 0x02, 0xcd, 0xf3, 0xc4, 0x8e, 0x4e, 0xbb, 0xd7, 0x23, 0xf1, 0x37, 
+  0x66, 0x51, 0xff, 0x21, 0xa1, 0x36, 0xa3, 0xe9, 0x6b, 0x5a, 0xda, 0xc5, 0xcc, 0x84, 0xb4, 0x30, 
+  0x9c, 0x0a, 0x4c, 0xa0, 0x50, 0x9f, 0x3b, 0x28, 0xf9, 0xbf, 0x34, 0x28, 0xc1, 0x47, 0xea, 0x0b, 
+  0xa5, 0x89, 0xf0, 0xdf, 0x37, 0x0c, 0x10, 0x85, 0x47, 0x96, 0xbb, 0xc3, 0xcb, 0xdd, 0xa9, 0x2d, 
+  0x37, 0xb1, 0xee, 0x34, 0x4e, 0xaa, 0x0a, 0xa3, 0x50, 0xdd, 0x8f, 0xff, 0x8d, 0xae, 0x63, 0x6e, 
+  0x16, 0xd4, 0xdd, 0x98, 0x4f, 0x0d, 0x68, 0x3e, 0x8d, 0xed, 0xc1, 0xa2, 0x1f, 0x5d, 0x02, 0xce, 
+  0x6e, 0x49, 0x1e, 0xfb, 0x8f, 0xdb, 0x28, 0x1a, 0xc2, 0x4d, 0x33, 0x5a, 0x1c, 0xdf, 0xee, 0x76, 
+  0x2d, 0x44, 0x56, 0x64, 0x86, 0xcc, 0xc6, 0x24, 0xcd, 0xac, 0x99, 0x2d, 0x83, 0x97, 0xe4, 0x76, 
+  0x7b, 0x07, 0x05, 0xa8, 0xe2, 0x7c, 0xe8, 0x41, 0x43, 0xb6, 0x71, 0x58, 0x06, 0x8f, 0x24, 0x67, 
+  0x75, 0xe4, 0x4d, 0x7c, 0xbd, 0xaa, 0x40, 0xf1, 0xf4, 0xd6, 0x3b, 0x8b, 0x86, 0x35, 0x89, 0xfd, 
+  0x2c, 0x08, 0x47, 0x27, 0xb1, 0xb1, 0xfc, 0x23, 0x4c, 0x34, 0x95, 0x84, 0x54, 0x08, 0x93, 0x66, 
+  0x33, 0xe1, 0xb6, 0xd5, 0x30, 0xe5, 0xf7, 0x9b, 0xe6, 0x53, 0x93, 0xf7, 0xd8, 0x02, 0xc8, 0x43, 
+  0x16, 0x00, 0x5f, 0xd3, 0x2b, 0x58, 0x01, 0x04, 0xf6, 0xfc, 0x9f, 0xef, 0x76, 0x41, 0x1b, 0xfd, 
+  0x44, 0x3d, 0xa0, 0xe5, 0xf4, 0x36, 0x06, 0x13, 0xa8, 0x26, 0x26, 0x7c, 0x48, 0xb3, 0x32, 0x2c, 
+  0xea, 0x9a, 0x45, 0xc7, 0x03, 0x66, 0x0a, 0x0d, 0xc7, 0x72, 0xdf, 0x94, 0xc9, 0xce, 0x45, 0x81, 
+  0xb9, 0x68, 0x0c, 0x40, 0x59, 0x23, 0x9a, 0x41, 0xe0, 0x6c, 0xae, 0x30, 0x4a, 0x81, 0x5c, 0x4c, 
+  0xb1, 0xc4, 0x95, 0x1f, 0x42, 0x8c, 0xc1, 0x10, 0xd0, 0x10, 0x48, 0xcc, 0x14, 0x43, 0x12, 0xab, 
+  0xd1, 0xd0, 0x4f, 0x12, 0xd4, 0xc7, 0x52, 0xf3, 0x1c, 0xca, 0x99, 0x73, 0x11, 0x85, 0x9f, 0x6b, 
+  0x75, 0x03, 0x11, 0x43, 0xc1, 0x0f, 0xf9, 0xb6, 0x93, 0x28, 0x78, 0xc6, 0xd1, 0x1a, 0xcd, 0x7f, 
+  0x6d, 0x88, 0x8f, 0x19, 0xa6, 0x18, 0xf1, 0x5c, 0x5a, 0xa9, 0x9c, 0x2a, 0x30, 0x42, 0xf9, 0x81, 
+  0x5a, 0x5c, 0xed, 0x84, 0xe2, 0x7e, 0xf7, 0xeb, 0x05, 0x6d, 0xab, 0x89, 0x34, 0x6c, 0x7c, 0x82, 
+  0xe3, 0x03, 0x48, 0x57, 0x04, 0x7d, 0x6c, 0xf4, 0x66, 0x68, 0x5c, 0xc9, 0xfd, 0x5e, 0xc5, 0xe9, 
+  0x65, 0xad, 0xc9, 0x6a, 0xf4, 0x7f, 0xd3, 0x8c, 0x1f, 0xf3, 0x06, 0x87, 0x60, 0x97, 0xbf, 0x27, 
+  0xc8, 0x4d, 0x03, 0x01, 0xf5, 0xd0, 0x23, 0x3c, 0x99, 0xd8, 0xf7, 0x9a, 0x5b, 0x64, 0xac, 0xc0, 
+  0x8c, 0x20, 0x95, 0x73, 0x45, 0x4d, 0xee, 0xe4, 0xdd, 0xcd, 0x2a, 0xc4, 0x0b, 0xb4, 0xdf, 0x7c, 
+  0xa7, 0x9e, 0x6b, 0x42, 0x00, 0xaf, 0xf8, 0x06, 0xc8, 0x3b, 0x7e, 0xd8, 0x76, 0xcc, 0x29, 0x93, 
+  0xea, 0xdd, 0x1d, 0x61, 0x5d, 0xe9, 0xb3, 0xb0, 0xe7, 0x98, 0xef, 0x35, 0xcd, 0xb4, 0x82, 0x4a, 
+  0x63, 0x8a, 0xd8, 0x5f, 0x88, 0x82, 0xd8, 0xe2, 0xfa, 0x07, 0xfb, 0x30, 0x1d, 0xf4, 0x02, 0x47, 
+  0xb0, 0xe6, 0x1a, 0x1b, 0xf2, 0xaa, 0x76, 0x18, 0xad, 0x48, 0x3b, 0x73, 0x0c, 0xb4, 0x2a, 0x0b, 
+  0x12, 0xd3, 0xb2, 0xac, 0xd5, 0x3f, 0x1b, 0x7a, 0xbd, 0x98, 0xd8, 0x5f, 0x38, 0xbe, 0x1c, 0x7a, 
+  0x7f, 0x3d, 0x88, 0xe7, 0x10, 0xf1, 0x2a, 0x0b, 0x93, 0xce, 0x35, 0x9a, 0x7c, 0xc5, 0xde, 0x32, 
+  0xdb, 0xea, 0x9a, 0xb1, 0x6d, 0xa7, 0xe3, 0x2b, 0x03, 0x2a, 0xcc, 0x22, 0x4e, 0x90, 0xb6, 0xdb, 
+  0xff, 0xa6, 0x07, 0xf1, 0x05, 0x5b, 0x98, 0xb1, 0x7b, 0xb0, 0x0a, 0x25, 0xba, 0x50, 0xc1, 0x49, 
+  0xcc, 0xf1, 0x05, 0xdf, 0x0f, 0x09, 0x36, 0xd5, 0xd1, 0x56, 0xf8, 0x2f, 0xdb, 0x74, 0x39, 0x26, 
+  0x5d, 0xe8, 0x05, 0x0c, 0xba, 0x95, 0xa3, 0x0f, 0xc9, 0x37, 0x6b, 0xed, 0xf4, 0x65, 0x5e, 0x99, 
+  0xe3, 0xbd, 0x9d, 0x30, 0x57, 0xed, 0x2c, 0xba, 0x6b, 0xc9, 0x55, 0x33, 0xcb, 0x32, 0x9f, 0xf1, 
+  0xa0, 0x84, 0xb6, 0xef, 0xae, 0x6a, 0x45, 0xa0, 0xd2, 0x7a, 0xe8, 0xb8, 0x0f, 0x12, 0xf8, 0xa1, 
+  0xc1, 0xb5, 0x20, 0x71, 0xf2, 0x69, 0x9b, 0x7b, 0xa7, 0xea, 0x43, 0x4b, 0x6f, 0x3b, 0x96, 0x38, 
+  0x0c, 0xb8, 0x75, 0x3e, 0xee, 0x45, 0xc8, 0x05, 0x99, 0xb7, 0x8d, 0xed, 0x0b, 0x2d, 0x98, 0xd9, 
+  0x39, 0x85, 0xf9, 0x3a, 0x26, 0xb0, 0xad, 0xf0, 0x2f, 0x2d, 0x85, 0x95, 0xcd, 0xdc, 0xff, 0x70, 
+  0x99, 0x1c, 0xcb, 0x3b, 0x03, 0x34, 0xae, 0x31, 0x1e, 0x7c, 0x01, 0xde, 0xb5, 0xb9, 0xc0, 0x7e, 
+  0xb8, 0xf1, 0xa0, 0x87, 0x1a, 0xaa, 0xfa, 0x61, 0xd8, 0xc4, 0x32, 0x83, 0x5f, 0x46, 0xcd, 0x4d, 
+  0xce, 0xfc, 0x2f, 0xbb, 0xf3, 0x9a, 0x6f, 0x9a, 0xdb, 0xdc, 0xb8, 0xe0, 0x5f, 0xc9, 0xfd, 0xf0, 
+  0x56, 0x84, 0xa9, 0x19, 0xc5, 0x35, 0x5e, 0x3b, 0xda, 0xce, 0x69, 0xd9, 0x1f, 0xa1, 0x8c, 0xfc, 
+  0xa3, 0x59, 0xa2, 0x22, 0x03, 0xd3, 0xf4, 0x64, 0x38, 0x49, 0x7b, 0x65, 0x98, 0x72, 0x49, 0x92, 
+  0xe3, 0xf7, 0x6b, 0x73, 0x3c, 0xe0, 0xc6, 0xe9, 0x49, 0x39, 0x4e, 0x7b, 0xd1, 0xb3, 0x40, 0x36, 
+  0xad, 0x0d, 0x24, 0x7d, 0x4f, 0x72, 0xfd, 0x63, 0x9f, 0x8f, 0xde, 0xf3, 0xf9, 0xaa, 0x6c, 0xeb, 
+  0x68, 0xe5, 0x53, 0x6a, 0xfb, 0x3a, 0x26, 0xfe, 0xa5, 0xdf, 0xcf, 0xc7, 0xa6, 0x9a, 0xbc, 0x56, 
+  0xcd, 0xe5, 0x07, 0x57, 0xd3, 0xeb, 0xe5, 0xd4, 0xa1, 0xd6, 0x5a, 0x08, 0x2d, 0x5a, 0xf8, 0x26, 
+  0xc9, 0x26, 0x72, 0xa0, 0xfd, 0x0f, 0xf1, 0x90, 0xc7, 0x8b, 0x24, 0x83, 0x6f, 0x38, 0xef, 0xf9, 
+  0x8b, 0xec, 0x1d, 0xae, 0x49, 0xa6, 0xe7, 0x98, 0x27, 0x36, 0x26, 0x31, 0x22, 0xcf, 0xdd, 0xc4, 
+  0x97, 0x1c, 0xf5, 0x24, 0x70, 0x79, 0xa9, 0x68, 0xc9, 0x46, 0x1e, 0xc6, 0x4c, 0xf0, 0xa1, 0xd8, 
+  0x5c, 0xdc, 0x24, 0xd0, 0x3c, 0x89, 0x5c, 0x22, 0xc2, 0xf0, 0x5e, 0xf9, 0xb5, 0x2a, 0x6f, 0x4c, 
+  0x12, 0x2f, 0x61, 0xf7, 0x5c, 0x59, 0x28, 0xb2, 0xad, 0x85, 0x1b, 0xa0, 0x4f, 0xd4, 0x9c, 0x21, 
+  0x3c, 0x6f, 0x5c, 0x9e, 0xa4, 0x1c, 0x48, 0x2e, 0xef, 0xb1, 0x1b, 0xbf, 0xd2, 0xf6, 0x56, 0x76, 
+  0x22, 0xb6, 0xa6, 0x7b, 0xe9, 0x17, 0xc2, 0x1e, 0x21, 0x6e, 0xd8, 0x90, 0x34, 0x27, 0x41, 0x4a, 
+  0xa1, 0x0d, 0x92, 0x94, 0xe6, 0xc4, 0xe8, 0x2a, 0xaf, 0x08, 0x57, 0xab, 0x46, 0xa0, 0xbb, 0x22, 
+  0xc9, 0xc8, 0x39, 0x14, 0xd1, 0x88, 0x67, 0xd2, 0xb6, 0x0a, 0x40, 0x43, 0xd3, 0xcd, 0xcc, 0x32, 
+  0xfc, 0xd2, 0x39, 0x5a, 0x5c, 0x1a, 0x3d, 0x63, 0xa1, 0xbf, 0xa8, 0xe8, 0xd4, 0x63, 0xf2, 0x1e, 
+  0x78, 0xdf, 0xf5, 0x4c, 0x19, 0x10, 0xef, 0xb5, 0xd1, 0xd2, 0x48, 0xb7, 0x6b, 0xea, 0xb7, 0x47, 
+  0x88, 0x8e, 0x36, 0xf3, 0xd1, 0xfe, 0xf1, 0x69, 0x13, 0xb1, 0xe8, 0x52, 0xb1, 0xe8, 0xd2, 0xb2, 
+  0xe8, 0xb2, 0xc1, 0xa2, 0xcb, 0x3a, 0x8b, 0x2e, 0xe6, 0xdd, 0xee, 0xfc, 0x11, 0xd4, 0x11, 0xa8, 
+  0x56, 0x89, 0x8a, 0x8d, 0x8d, 0x7b, 0x04, 0x49, 0x33, 0xc9, 0x74, 0xa5, 0xc4, 0x2a, 0x57, 0x24, 
+  0x89, 0x1c, 0xe7, 0x91, 0x18, 0xba, 0x26, 0x48, 0x5d, 0xca, 0x33, 0x82, 0x8a, 0x47, 0x71, 0x80, 
+  0x67, 0xfb, 0x03, 0xac, 0x28, 0xbe, 0x5d, 0xef, 0x0b, 0xb8, 0x39, 0x18, 0xac, 0x3b, 0x3a, 0x49, 
+  0xda, 0xdc, 0x70, 0xea, 0x9b, 0x27, 0xa9, 0x59, 0x8c, 0xf3, 0xb9, 0xdd, 0x34, 0x9f, 0x35, 0xda, 
+  0x72, 0x08, 0x48, 0x98, 0x00, 0x51, 0x55, 0x21, 0x7f, 0xac, 0xbb, 0x0d, 0x74, 0x2f, 0xa6, 0x5a, 
+  0x5e, 0x41, 0x70, 0xca, 0x43, 0xb1, 0xa9, 0x20, 0x77, 0x1e, 0x29, 0x4f, 0xec, 0xd2, 0x46, 0xad, 
+  0xe0, 0x69, 0x2f, 0x98, 0xcf, 0x85, 0x10, 0x9e, 0xfa, 0x19, 0xd7, 0x03, 0x49, 0x49, 0x6d, 0xe1, 
+  0x8c, 0xa7, 0x59, 0xf9, 0xf4, 0xfa, 0x45, 0xe0, 0x06, 0x84, 0xa8, 0xe2, 0xfb, 0x48, 0x7f, 0x21, 
+  0xae, 0xa0, 0xba, 0x10, 0x37, 0xa2, 0xa2, 0x39, 0x97, 0x54, 0xe1, 0x25, 0x2d, 0x26, 0xd5, 0x7d, 
+  0x19, 0x51, 0x99, 0xcb, 0x20, 0x10, 0x37, 0xf4, 0xec, 0x46, 0x3d, 0xbb, 0xc1, 0xb3, 0x1b, 0xf6, 
+  0xca, 0x6f, 0xe5, 0xd6, 0x1d, 0xdf, 0x21, 0x0c, 0x65, 0x83, 0x3f, 0xf3, 0xc8, 0x7a, 0xd9, 0xaf, 
+  0x22, 0x00, 0xcf, 0xc1, 0x59, 0x1d, 0x72, 0xe8, 0x27, 0xeb, 0x82, 0x9f, 0xb0, 0x0b, 0xbe, 0x72, 
+  0x4d, 0xc2, 0xe1, 0x82, 0xa3, 0x80, 0xda, 0xf9, 0x57, 0x44, 0x30, 0x9e, 0x42, 0x23, 0x69, 0x4f, 
+  0xf6, 0x61, 0x9e, 0x98, 0xb2, 0x60, 0xb0, 0x8c, 0x3a, 0x0b, 0x38, 0x1c, 0x75, 0xbb, 0x57, 0x93, 
+  0x55, 0x48, 0x93, 0xbd, 0x82, 0xb8, 0xcc, 0x3d, 0xa4, 0xfd, 0x79, 0x3b, 0xb9, 0x01, 0xc4, 0x4e, 
+  0x16, 0x21, 0x6d, 0xe3, 0xcb, 0x60, 0x32, 0x9d, 0x85, 0x44, 0xec, 0x00, 0x38, 0xb7, 0xdd, 0xee, 
+  0xad, 0xbf, 0x14, 0x6b, 0x55, 0xf2, 0x32, 0x50, 0xa6, 0x7b, 0x77, 0x88, 0x7d, 0xb0, 0xa1, 0x7b, 
+  0x3f, 0xa1, 0xda, 0xd5, 0xbb, 0xac, 0x82, 0x00, 0x76, 0x2d, 0x21, 0x81, 0x38, 0x81, 0x2f, 0x09, 
+  0x4d, 0xd1, 0x7a, 0xba, 0xa1, 0x2b, 0x48, 0x1f, 0x4b, 0x7d, 0x15, 0x07, 0x7c, 0x10, 0xa8, 0x42, 
+  0x77, 0x51, 0xdb, 0x0b, 0x57, 0x57, 0xc2, 0xc2, 0x51, 0x16, 0xad, 0x9b, 0xd5, 0xad, 0x55, 0x75, 
+  0x89, 0x5a, 0xc4, 0x25, 0x5c, 0x57, 0xe2, 0x60, 0x7c, 0xc3, 0x74, 0x94, 0x06, 0x01, 0xb1, 0x8a, 
+  0x9d, 0x40, 0xe0, 0xb0, 0x7f, 0xf0, 0x6b, 0x88, 0x0b, 0x49, 0x74, 0x33, 0x81, 0x88, 0x17, 0x07, 
+  0x61, 0xa1, 0xbb, 0x88, 0x13, 0x1d, 0x96, 0x8e, 0x12, 0xee, 0x9c, 0x56, 0x20, 0xac, 0x79, 0xa4, 
+  0xa0, 0xbf, 0x93, 0xb5, 0x39, 0xd4, 0x99, 0x0b, 0x53, 0x75, 0x10, 0xae, 0x09, 0x12, 0x26, 0xba, 
+  0x03, 0x25, 0x4d, 0x52, 0x1e, 0x84, 0xd6, 0x1f, 0x4e, 0xac, 0x6b, 0xc6, 0xe2, 0x6f, 0x6a, 0xa8, 
+  0x38, 0x11, 0xda, 0xd4, 0xda, 0x9a, 0xa2, 0x13, 0x1d, 0x31, 0x27, 0x18, 0x53, 0x56, 0x1b, 0x83, 
+  0x09, 0x80, 0xc6, 0x24, 0x83, 0x7c, 0x6d, 0x5f, 0x41, 0xcb, 0x4a, 0x80, 0x84, 0xf3, 0x6e, 0x6c, 
+  0x89, 0xfb, 0x76, 0x7b, 0x62, 0xe8, 0xe7, 0x76, 0x04, 0x71, 0xcc, 0xc6, 0xb6, 0x17, 0xa2, 0x79, 
+  0xf8, 0x9a, 0x56, 0x0f, 0x0c, 0x94, 0x2a, 0xb7, 0x8a, 0xa6, 0xed, 0x3e, 0x97, 0x1d, 0xc4, 0xf4, 
+  0x24, 0xa1, 0x02, 0xfa, 0xca, 0x77, 0xd8, 0x52, 0xb0, 0xdd, 0x0c, 0x2a, 0x20, 0xdb, 0xe8, 0xe2, 
+  0xe1, 0xdc, 0x6c, 0x76, 0x03, 0x93, 0x89, 0x92, 0x18, 0xf3, 0xdd, 0x8c, 0x36, 0x6a, 0x6e, 0xc2, 
+  0xcb, 0x94, 0xf5, 0xa1, 0x16, 0x7a, 0xa8, 0x01, 0x75, 0x80, 0x7a, 0x4a, 0x88, 0x67, 0x45, 0x72, 
+  0x47, 0x30, 0xab, 0x90, 0x1d, 0x3e, 0x50, 0x6a, 0x71, 0xa7, 0xb8, 0xf1, 0x30, 0xe2, 0x13, 0x35, 
+  0x3c, 0xd5, 0xe7, 0xd5, 0x01, 0x94, 0x3b, 0x6a, 0xa2, 0x53, 0x68, 0x64, 0xe0, 0x8f, 0x4f, 0x9b, 
+  0xb5, 0xd6, 0x64, 0xaa, 0xeb, 0x60, 0x3f, 0x7d, 0xd3, 0x59, 0xda, 0xc5, 0xa3, 0x93, 0xa2, 0xdb, 
+  0x55, 0x1d, 0xe0, 0x4b, 0x90, 0x4f, 0xab, 0xb4, 0x2c, 0xe0, 0x83, 0xa9, 0xe2, 0xb2, 0xf9, 0x0f, 
+  0xea, 0x50, 0x94, 0x16, 0x83, 0x0f, 0x2b, 0x8a, 0xfe, 0x33, 0x55, 0xe3, 0x84, 0xf6, 0x5f, 0xe8, 
+  0x79, 0x3b, 0x27, 0x70, 0x4c, 0xe5, 0xa1, 0x54, 0x20, 0x7c, 0xc9, 0x9b, 0xaa, 0xca, 0x02, 0x53, 
+  0x25, 0xb8, 0x7b, 0x78, 0x1a, 0x99, 0xe7, 0xf6, 0xa9, 0x72, 0x6d, 0xdb, 0xad, 0xb4, 0x7f, 0x92, 
+  0x3d, 0x47, 0xe4, 0x1e, 0x9a, 0x9b, 0x4b, 0xe9, 0x04, 0xd1, 0x32, 0xf3, 0x54, 0x54, 0x5c, 0x49, 
+  0x4d, 0x61, 0xc2, 0x2a, 0xf9, 0x4b, 0x29, 0xae, 0xa0, 0xc3, 0x2e, 0xb3, 0x6b, 0x89, 0x23, 0xd6, 
+  0xa8, 0xd5, 0x16, 0xb5, 0xa6, 0x2e, 0xbd, 0x30, 0xfa, 0x7d, 0x9c, 0xa6, 0x5a, 0xf3, 0xce, 0xc9, 
+  0x30, 0x9c, 0xdb, 0x33, 0xd3, 0xb1, 0x56, 0x6e, 0x1a, 0x2c, 0x77, 0x37, 0xb0, 0xa7, 0x61, 0xe3, 
+  0x58, 0xeb, 0x3e, 0x39, 0x8c, 0x06, 0xf0, 0x33, 0xd1, 0xaf, 0x57, 0xca, 0x2b, 0x31, 0x06, 0x9b, 
+  0xeb, 0x73, 0xa4, 0x9e, 0x28, 0xd6, 0x95, 0x81, 0xa6, 0x99, 0x2d, 0xb6, 0xdd, 0xc6, 0xd6, 0xb0, 
+  0x0a, 0x78, 0x01, 0x73, 0x83, 0x78, 0x41, 0x54, 0xc3, 0xcf, 0xb6, 0x06, 0x76, 0x21, 0xb0, 0x0e, 
+  0x5a, 0x42, 0x23, 0x08, 0xbd, 0x48, 0xa9, 0xe0, 0x90, 0x73, 0x5c, 0xa9, 0xb3, 0x28, 0x47, 0x6c, 
+  0x77, 0x58, 0x35, 0x6a, 0xcf, 0x6e, 0x94, 0xc1, 0x30, 0xfa, 0x1d, 0xa0, 0x9f, 0x7f, 0x12, 0x82, 
+  0x70, 0xba, 0x0a, 0xf4, 0xa5, 0x06, 0x80, 0x2b, 0x58, 0x27, 0x51, 0xf7, 0xdf, 0xdb, 0x78, 0x26, 
+  0x34, 0x74, 0x86, 0xf9, 0x81, 0x46, 0xd9, 0xd0, 0x25, 0x55, 0x31, 0x69, 0x76, 0x76, 0x82, 0x8d, 
+  0x0e, 0x2c, 0x8c, 0x27, 0xd5, 0x29, 0x58, 0x10, 0x5e, 0xd0, 0x4a, 0x15, 0x81, 0x9d, 0x7a, 0x12, 
+  0x06, 0xa2, 0x4c, 0x19, 0x0f, 0x11, 0xa3, 0xd9, 0xba, 0x9c, 0xa0, 0x68, 0xf7, 0xe2, 0x02, 0xcb, 
+  0xaa, 0x90, 0x2b, 0x42, 0x93, 0x44, 0xdf, 0x3a, 0xcb, 0xda, 0x89, 0xd5, 0x1a, 0xa9, 0xa3, 0x9b, 
+  0x2b, 0xe5, 0x54, 0x59, 0x91, 0x9e, 0x54, 0x63, 0x51, 0x82, 0xd4, 0x92, 0x5d, 0x61, 0xa0, 0x9d, 
+  0x4a, 0x8c, 0xe7, 0x66, 0x98, 0x99, 0x2b, 0xe8, 0x41, 0xbf, 0xa5, 0x96, 0x89, 0x54, 0x66, 0xe2, 
+  0x3e, 0x1a, 0x9e, 0x10, 0x7d, 0x4c, 0x8c, 0xc6, 0x47, 0x5c, 0xd0, 0x83, 0xcb, 0x8a, 0xff, 0x6c, 
+  0x12, 0x4b, 0x50, 0x7e, 0x4d, 0xf5, 0x01, 0x78, 0x44, 0xfc, 0xe6, 0x91, 0x37, 0x64, 0x3d, 0x7c, 
+  0xb7, 0x4b, 0x3d, 0x5e, 0xa2, 0xdb, 0xeb, 0xe8, 0x9d, 0x58, 0x80, 0x68, 0x5e, 0x74, 0xbb, 0x95, 
+  0x69, 0x37, 0x8c, 0xa2, 0xa1, 0xa7, 0xba, 0x8a, 0x5e, 0xf7, 0x22, 0x25, 0x58, 0xad, 0x09, 0x47, 
+  0xd6, 0xa2, 0x39, 0x6d, 0xb7, 0x83, 0x91, 0xb8, 0x8d, 0x16, 0x66, 0x4c, 0x4c, 0x6b, 0x08, 0x76, 
+  0xde, 0x45, 0xc6, 0x00, 0x6a, 0xbb, 0x4d, 0x82, 0xf1, 0xbc, 0xc3, 0x87, 0x0d, 0x3a, 0xd8, 0x4b, 
+  0x16, 0x2d, 0xa6, 0xf3, 0x19, 0x3d, 0x45, 0xb4, 0x65, 0x28, 0xec, 0xbb, 0xdd, 0xcc, 0x68, 0xf2, 
+  0x87, 0x02, 0xfa, 0xa5, 0x3d, 0xab, 0x29, 0xaa, 0xc9, 0x7f, 0x03, 0x8e, 0x83, 0x20, 0xf5, 0x34, 
+  0x18, 0x17, 0xd1, 0xe5, 0x34, 0x36, 0xc6, 0xec, 0x05, 0x71, 0x26, 0xec, 0xa7, 0x4b, 0xbb, 0xfc, 
+  0x21, 0x37, 0xbc, 0x89, 0xd6, 0x5a, 0xa3, 0x33, 0xaf, 0xa3, 0xab, 0x60, 0x77, 0x0f, 0x7d, 0x6f, 
+  0x16, 0x75, 0x0a, 0x34, 0xd6, 0xed, 0x6e, 0xfa, 0x7d, 0x21, 0xa1, 0x38, 0xd7, 0xc5, 0x03, 0x56, 
+  0xea, 0xf7, 0xa2, 0x39, 0x54, 0xf7, 0xe8, 0xee, 0xc6, 0xf6, 0x88, 0x5a, 0xbb, 0xd1, 0xad, 0x15, 
+  0x44, 0xe3, 0x97, 0x8a, 0x55, 0xb6, 0xa4, 0x76, 0x78, 0xb2, 0x51, 0xea, 0xea, 0x39, 0xd6, 0x73, 
+  0xc5, 0x8a, 0xea, 0xa5, 0x52, 0x57, 0xe3, 0x27, 0xfa, 0x4e, 0x99, 0xa0, 0x20, 0x60, 0xd6, 0x12, 
+  0xb4, 0x6f, 0x19, 0xec, 0x0c, 0x41, 0xcb, 0xc5, 0x92, 0xa0, 0x9b, 0x60, 0x5f, 0x42, 0x4b, 0xbc, 
+  0xb4, 0x46, 0x8b, 0xa3, 0x93, 0x4d, 0xef, 0xc6, 0xde, 0xd5, 0x6c, 0x33, 0xa8, 0x1e, 0x03, 0xcb, 
+  0x7a, 0x68, 0xe2, 0x1d, 0x31, 0xa8, 0x62, 0xb5, 0x13, 0xf7, 0x50, 0x6d, 0x12, 0xb9, 0x84, 0x79, 
+  0x9f, 0x35, 0x01, 0x88, 0xe4, 0xae, 0x0a, 0xd3, 0x75, 0x5b, 0x19, 0x07, 0x44, 0x8f, 0x72, 0x55, 
+  0x8c, 0xa1, 0xda, 0x03, 0x57, 0x4a, 0x02, 0x1d, 0xf8, 0x4f, 0x13, 0x38, 0x47, 0x73, 0xdb, 0x0c, 
+  0xec, 0x73, 0x5c, 0xd7, 0x6c, 0xb0, 0xf2, 0x2b, 0xb3, 0x13, 0x31, 0x4b, 0xcf, 0x4e, 0x68, 0xf2, 
+  0x57, 0xe0, 0xac, 0x57, 0xce, 0x01, 0x6e, 0x50, 0x59, 0xbf, 0x7a, 0x5f, 0xbd, 0xe4, 0x08, 0xa8, 
+  0x44, 0x9d, 0x71, 0x9e, 0xac, 0x05, 0xfa, 0xbf, 0x36, 0xfc, 0x1b, 0x4f, 0x01, 0xa0, 0x96, 0xec, 
+  0x64, 0x7c, 0xd4, 0xce, 0x94, 0x4e, 0xb9, 0x5c, 0x97, 0x91, 0x6f, 0xdd, 0x33, 0x7c, 0x6b, 0xe7, 
+  0xea, 0xa2, 0x29, 0xa5, 0xf2, 0x2c, 0x03, 0x73, 0xf6, 0xe0, 0xf8, 0x63, 0xcf, 0xf9, 0x84, 0xae, 
+  0xe6, 0x88, 0x2b, 0x2a, 0x12, 0x92, 0x19, 0x74, 0xa4, 0xe4, 0x39, 0x33, 0xb6, 0x9d, 0xe2, 0xae, 
+  0xfe, 0x1c, 0xb8, 0x51, 0x29, 0x8c, 0x67, 0x2f, 0x61, 0xf3, 0xcc, 0x51, 0x84, 0x33, 0x46, 0xce, 
+  0x10, 0x89, 0xc9, 0xa5, 0x9d, 0x05, 0xa1, 0x2e, 0x35, 0x06, 0x25, 0x40, 0x6d, 0x22, 0x35, 0x04, 
+  0xcd, 0x7b, 0x13, 0x56, 0x7c, 0x6c, 0x24, 0xda, 0x8b, 0x38, 0x33, 0xec, 0x4d, 0xbb, 0x37, 0xb1, 
+  0xf6, 0x9a, 0xce, 0x0c, 0xc3, 0x95, 0x88, 0x51, 0x20, 0x3a, 0xb4, 0x82, 0xb9, 0x9d, 0x7f, 0xa2, 
+  0x8c, 0x59, 0xe5, 0x9d, 0x5e, 0x79, 0x1b, 0xe7, 0x70, 0x04, 0xd7, 0x27, 0x40, 0x5a, 0x45, 0x4a, 
+  0x0c, 0x2d, 0x01, 0xbf, 0x58, 0x05, 0x01, 0x41, 0x30, 0x0c, 0xa7, 0x08, 0x7e, 0x3a, 0xb4, 0x03, 
+  0x1f, 0xf7, 0x68, 0xe6, 0x08, 0x5b, 0xae, 0x79, 0x50, 0x74, 0x66, 0xfc, 0x63, 0xbd, 0xc0, 0x18, 
+  0x07, 0x69, 0x13, 0x5d, 0x76, 0x34, 0x3a, 0x13, 0xfb, 0x26, 0x46, 0x51, 0xa7, 0x33, 0x17, 0x6f, 
+  0xfc, 0x40, 0xd4, 0xcd, 0x36, 0x0f, 0x78, 0x58, 0x8d, 0x1e, 0x31, 0x82, 0x7d, 0xc4, 0x61, 0xb8, 
+  0xc5, 0x7a, 0xde, 0x4a, 0xda, 0x6d, 0x46, 0xf4, 0x7f, 0x51, 0x16, 0xf3, 0x9e, 0xf0, 0xfe, 0xa2, 
+  0x94, 0x51, 0x95, 0x1e, 0xb0, 0xa1, 0x85, 0x42, 0x79, 0x10, 0xc9, 0xed, 0x76, 0xae, 0x75, 0x52, 
+  0x5b, 0xd6, 0xa2, 0x5e, 0xc9, 0xe4, 0xf2, 0xaa, 0xdc, 0xde, 0x25, 0x8b, 0xf2, 0xca, 0x13, 0x4d, 
+  0x9e, 0x51, 0xd1, 0xb1, 0x76, 0xaf, 0xac, 0x52, 0x78, 0xe6, 0x68, 0xb7, 0xa1, 0xd0, 0x22, 0x54, 
+  0xfd, 0x4c, 0xb9, 0xcd, 0x55, 0x86, 0x6b, 0x7b, 0x76, 0xd9, 0xad, 0xe3, 0x62, 0xcd, 0xdb, 0x31, 
+  0xbb, 0x64, 0x38, 0x23, 0xa9, 0x1b, 0xe4, 0xf3, 0x26, 0xf0, 0x38, 0x7a, 0x9f, 0xf7, 0x9e, 0x41, 
+  0xab, 0xa2, 0x76, 0xd4, 0xfa, 0xcb, 0xd6, 0x41, 0x12, 0x1a, 0x78, 0xaf, 0xda, 0xaf, 0x9a, 0x08, 
+  0xe3, 0xdf, 0xc8, 0xf6, 0x51, 0x87, 0x96, 0x4c, 0x87, 0x9a, 0x6b, 0xf4, 0xa9, 0xb2, 0xab, 0xd7, 
+  0xdd, 0xfa, 0x46, 0xb4, 0x72, 0xea, 0x63, 0x77, 0xee, 0x95, 0x26, 0x78, 0x5a, 0xce, 0x26, 0x8d, 
+  0xa9, 0xfe, 0xb7, 0x2c, 0xff, 0x48, 0xbc, 0x93, 0x3b, 0xff, 0x3a, 0x18, 0x9f, 0xf1, 0x76, 0x27, 
+  0x44, 0x8e, 0x28, 0x8a, 0xeb, 0x1c, 0x87, 0xf7, 0xc6, 0x7e, 0x4b, 0x3f, 0x9a, 0x12, 0x07, 0xac, 
+  0xa2, 0x32, 0xae, 0x73, 0xcb, 0x84, 0x9e, 0xb9, 0x16, 0x7b, 0xe6, 0x86, 0x3e, 0xae, 0x9e, 0x52, 
+  0x11, 0x0e, 0xdf, 0x7b, 0x65, 0xec, 0xe2, 0xc4, 0x99, 0xf2, 0x87, 0xa5, 0xcd, 0x40, 0x0f, 0xf9, 
+  0x92, 0x1e, 0x59, 0x2b, 0xce, 0x2b, 0x7b, 0x89, 0x76, 0xd9, 0x28, 0xd1, 0x1a, 0xc1, 0x5e, 0xe9, 
+  0x07, 0x6c, 0x7a, 0xf9, 0x26, 0x7a, 0x4f, 0x2c, 0x3a, 0x6b, 0x35, 0x92, 0x8e, 0xc1, 0x85, 0xab, 
+  0x60, 0x96, 0x7f, 0xed, 0xb8, 0xea, 0x9d, 0x16, 0x8d, 0x0f, 0x03, 0x01, 0x51, 0xb5, 0x33, 0xf6, 
+  0x3e, 0x2a, 0xc0, 0xb5, 0xeb, 0x80, 0x82, 0x3a, 0x60, 0x9d, 0x25, 0x7d, 0xf9, 0x4e, 0xbc, 0x3e, 
+  0x18, 0x3a, 0x6c, 0x3a, 0x6b, 0xd1, 0xbe, 0x37, 0x1d, 0xe7, 0x91, 0x23, 0x8f, 0x7d, 0x58, 0x75, 
+  0xcd, 0x8e, 0x0d, 0xdd, 0xb7, 0x66, 0xa6, 0x19, 0xe9, 0xd6, 0x10, 0x7b, 0xa5, 0x15, 0x7c, 0xd9, 
+  0xc8, 0x6f, 0xf2, 0x61, 0xf6, 0x3e, 0x8d, 0x08, 0x6f, 0xe8, 0xef, 0x8b, 0xe8, 0xf8, 0xb7, 0x13, 
+  0x7f, 0x1a, 0xf7, 0xff, 0x9c, 0x4d, 0x7f, 0x3b, 0x3f, 0x3e, 0x1f, 0x7e, 0x16, 0x72, 0x0c, 0xb1, 
+  0xf2, 0x3c, 0x3f, 0x4f, 0xcf, 0x97, 0xb3, 0xa7, 0xc1, 0xb4, 0x7e, 0x7f, 0x7e, 0x3c, 0xf9, 0xcc, 
+  0x9f, 0x84, 0x27, 0x54, 0x76, 0xf4, 0xd9, 0x16, 0x81, 0x86, 0xaa, 0x5e, 0x7d, 0xc7, 0x09, 0xf5, 
+  0x72, 0xdb, 0x2f, 0x8e, 0xf9, 0x79, 0x36, 0x40, 0xf8, 0xc0, 0x9a, 0x41, 0x50, 0xd5, 0xf5, 0x4e, 
+  0xa7, 0x16, 0xcb, 0x16, 0xc6, 0xae, 0x3b, 0x78, 0xfa, 0x5a, 0x51, 0xb4, 0xe5, 0xeb, 0x9a, 0x50, 
+  0x9c, 0xea, 0x4f, 0xf6, 0x82, 0xb1, 0xa4, 0x8f, 0x7d, 0xda, 0x87, 0xfe, 0xcb, 0x06, 0x5f, 0xd4, 
+  0x55, 0x9c, 0x69, 0x21, 0x01, 0xcf, 0xa0, 0x75, 0x30, 0xf7, 0x07, 0x02, 0x17, 0x95, 0x44, 0xf3, 
+  0xec, 0xb2, 0x41, 0xdf, 0x10, 0x79, 0x61, 0x9a, 0x11, 0x26, 0x87, 0x39, 0x14, 0x1c, 0xb6, 0x54, 
+  0x70, 0x04, 0xcb, 0x54, 0xd5, 0xbc, 0xab, 0x27, 0x6a, 0xd7, 0x35, 0x4d, 0xb2, 0x89, 0xa0, 0x11, 
+  0xd9, 0x9e, 0xe6, 0x70, 0x41, 0x0d, 0xeb, 0x45, 0xa8, 0x71, 0x3d, 0xa0, 0xb2, 0x6d, 0x2e, 0xea, 
+  0x00, 0xc6, 0x31, 0x81, 0x9d, 0x18, 0xb6, 0xfe, 0x03, 0xdb, 0x54, 0xb6, 0x3b, 0x87, 0xbb, 0xd1, 
+  0x79, 0x4d, 0x26, 0x9a, 0xca, 0xf2, 0xb4, 0x8a, 0x6e, 0x13, 0x1c, 0x08, 0x56, 0x8c, 0xed, 0xa2, 
+  0x67, 0xce, 0x39, 0xb9, 0x60, 0xc9, 0x83, 0xb3, 0x9d, 0xe4, 0xac, 0x8e, 0xa6, 0x2a, 0xab, 0xbd, 
+  0xee, 0x27, 0x08, 0x36, 0xcb, 0x11, 0x9b, 0x2b, 0x9d, 0x65, 0x60, 0x2d, 0xf4, 0xeb, 0x0d, 0x40, 
+  0xd9, 0xe5, 0xd6, 0xa4, 0xe6, 0x85, 0xe6, 0x83, 0x2b, 0xa9, 0xf4, 0x65, 0xa3, 0x93, 0x7c, 0xe2, 
+  0x62, 0x25, 0x02, 0xbe, 0x30, 0xb5, 0xe6, 0x77, 0x6d, 0xe6, 0x68, 0xf5, 0x76, 0xbe, 0xd3, 0x61, 
+  0x9a, 0x99, 0x83, 0xec, 0x8c, 0x02, 0x0e, 0xf4, 0x5a, 0xfe, 0xcb, 0x1f, 0x0e, 0x39, 0xe7, 0x42, 
+  0xdb, 0x89, 0x67, 0xa7, 0xa3, 0x4b, 0xee, 0x1b, 0xc0, 0x75, 0xbb, 0xdf, 0x5a, 0xae, 0x0d, 0x13, 
+  0x1a, 0xda, 0x5e, 0x54, 0x47, 0xeb, 0x8c, 0xfb, 0x7e, 0x17, 0x6f, 0x55, 0xc0, 0xae, 0xf3, 0xe2, 
+  0xa9, 0x7f, 0x32, 0x3d, 0xbf, 0x3b, 0xff, 0x79, 0xd6, 0xfb, 0x2c, 0x98, 0xfe, 0xf6, 0xd9, 0xec, 
+  0xe9, 0xf6, 0x2f, 0x4e, 0xcc, 0xae, 0x31, 0x47, 0x9d, 0xe4, 0x50, 0xe2, 0xd1, 0x01, 0x6d, 0x3a, 
+  0x53, 0x97, 0xda, 0xb2, 0x5a, 0x1e, 0xfa, 0x77, 0x71, 0x78, 0xfd, 0x1d, 0x3f, 0x23, 0x1e, 0x8e, 
+  0x32, 0x2e, 0x70, 0xa0, 0x28, 0x1a, 0xa9, 0xa5, 0x0d, 0x71, 0x50, 0x38, 0xa9, 0x90, 0xf1, 0x00, 
+  0xc1, 0x0b, 0xef, 0x27, 0xfa, 0x97, 0x47, 0xe9, 0x9f, 0x61, 0xdf, 0xd9, 0x70, 0xab, 0xbe, 0xaa, 
+  0x47, 0xc9, 0xce, 0x44, 0xd5, 0xbc, 0x13, 0xa5, 0x8e, 0x19, 0x92, 0x84, 0xee, 0x7d, 0xa6, 0xae, 
+  0xab, 0x00, 0x5a, 0xf4, 0xf0, 0xf9, 0x89, 0x55, 0xb8, 0x4d, 0xa6, 0x4a, 0x73, 0xc4, 0x26, 0x0e, 
+  0xb3, 0xf0, 0xad, 0x8d, 0x91, 0xb4, 0xdd, 0x76, 0xa0, 0x49, 0xef, 0x76, 0x8d, 0xbd, 0x34, 0x98, 
+  0xc5, 0x72, 0xa0, 0xa2, 0x93, 0x4f, 0x20, 0x1e, 0xa7, 0x81, 0x06, 0xa9, 0x20, 0xdc, 0x8b, 0x1c, 
+  0x5d, 0xda, 0x77, 0x1c, 0xc1, 0xc4, 0x44, 0x5a, 0x22, 0x4e, 0xfd, 0x88, 0x00, 0xb9, 0x8c, 0xd3, 
+  0x39, 0x26, 0xe7, 0x6c, 0x02, 0x74, 0x10, 0x82, 0xc4, 0x55, 0x21, 0xc4, 0xe9, 0x86, 0x78, 0xbf, 
+  0x42, 0x82, 0xaf, 0xe1, 0x2f, 0x05, 0x1f, 0xa0, 0xdb, 0xd9, 0x6b, 0x89, 0xff, 0x74, 0xca, 0xf0, 
+  0x23, 0x5e, 0x28, 0x60, 0xd0, 0x86, 0x56, 0xcd, 0x60, 0xc9, 0x65, 0x50, 0x85, 0xc3, 0x2f, 0x03, 
+  0x15, 0xcd, 0x1b, 0xee, 0x28, 0x13, 0x7d, 0xe1, 0x97, 0xec, 0x9c, 0xc2, 0x43, 0x61, 0xb3, 0xc6, 
+  0x9c, 0x55, 0xcb, 0xb5, 0x60, 0xdb, 0x86, 0x99, 0x4e, 0xa2, 0xd3, 0xa6, 0x2f, 0x38, 0x4e, 0x18, 
+  0x94, 0x61, 0xac, 0x5e, 0xdc, 0xa4, 0xbe, 0xb8, 0x2a, 0xc9, 0x1e, 0xce, 0xcc, 0xac, 0x96, 0x0a, 
+  0xa0, 0x26, 0x7e, 0x8f, 0xce, 0xfc, 0x53, 0x05, 0xa5, 0x7f, 0x28, 0x18, 0x55, 0x1c, 0x78, 0xb1, 
+  0x85, 0x19, 0x1e, 0xdd, 0xfe, 0x94, 0x96, 0xc9, 0x6a, 0xcb, 0xfe, 0xbf, 0xc7, 0xe2, 0xeb, 0xe8, 
+  0x81, 0x8d, 0xc6, 0xa8, 0x04, 0x1f, 0xae, 0x29, 0x4b, 0x8f, 0x82, 0x33, 0x08, 0xe0, 0x60, 0x16, 
+  0x87, 0x6b, 0xf4, 0x59, 0x3d, 0x8b, 0xc0, 0x37, 0x15, 0xb1, 0x75, 0x28, 0xfb, 0xa8, 0x41, 0xd9, 
+  0xab, 0xa3, 0xbd, 0x1a, 0x0a, 0x84, 0x69, 0x4b, 0x4b, 0xcc, 0x77, 0x03, 0x73, 0xae, 0x6e, 0xc4, 
+  0xdd, 0xe7, 0xed, 0xa8, 0x4d, 0x67, 0x44, 0x1b, 0xcb, 0x93, 0x74, 0x2c, 0xf7, 0xd0, 0x9b, 0x0a, 
+  0x0b, 0x0f, 0x7f, 0x15, 0x07, 0xbd, 0xed, 0xc4, 0x7c, 0x95, 0x15, 0xd2, 0x8d, 0xa1, 0x5e, 0x8f, 
+  0x92, 0xac, 0xb1, 0x6f, 0xa5, 0x40, 0x66, 0x95, 0xce, 0xfe, 0x46, 0x54, 0x2c, 0x0a, 0xef, 0x11, 
+  0x8b, 0x35, 0x94, 0x0e, 0xc0, 0x1c, 0x27, 0x54, 0x78, 0x14, 0x1e, 0x4c, 0x30, 0xe8, 0x00, 0xbf, 
+  0xd1, 0x70, 0x7c, 0xe2, 0x40, 0x3b, 0x95, 0x49, 0xc0, 0x68, 0x04, 0x01, 0x11, 0x86, 0xa5, 0xb1, 
+  0xb2, 0x33, 0x01, 0xfe, 0x6c, 0x3a, 0x9e, 0x1f, 0x20, 0x5b, 0x1c, 0xc2, 0x38, 0x78, 0xc8, 0xec, 
+  0x49, 0x6f, 0x5d, 0xeb, 0x55, 0x47, 0x97, 0xa3, 0x13, 0x23, 0x95, 0xd6, 0xd1, 0x75, 0x16, 0x84, 
+  0x19, 0x5b, 0x0a, 0x50, 0xdb, 0xad, 0x26, 0x13, 0x93, 0x96, 0x50, 0xca, 0x9a, 0x8c, 0x9f, 0xb1, 
+  0xe7, 0x93, 0x82, 0xd7, 0xc0, 0x86, 0x47, 0x66, 0xac, 0x6c, 0x36, 0x3a, 0xb0, 0x48, 0xa8, 0x77, 
+  0x38, 0x23, 0x14, 0x7d, 0xe1, 0x86, 0xc7, 0xd1, 0x0b, 0x4e, 0x92, 0x84, 0x1f, 0x70, 0x40, 0x79, 
+  0xb8, 0xb9, 0x1a, 0x14, 0x8c, 0xd8, 0x43, 0x22, 0x5e, 0x2c, 0xc2, 0xf6, 0x40, 0x80, 0xcd, 0x10, 
+  0xfe, 0xce, 0xc8, 0x6a, 0x79, 0x05, 0x90, 0xf0, 0x2e, 0x10, 0x0c, 0x76, 0x01, 0x3c, 0x21, 0x51, 
+  0xe5, 0xe7, 0xcd, 0x7c, 0x04, 0x6e, 0xa5, 0xf4, 0xde, 0x37, 0x11, 0xab, 0x1b, 0x91, 0xee, 0xc3, 
+  0xc6, 0xbd, 0x01, 0x56, 0xc9, 0xa9, 0xd4, 0x4c, 0x34, 0xe1, 0x87, 0x16, 0xc3, 0x0e, 0x63, 0x4f, 
+  0xb1, 0xef, 0x0e, 0x6a, 0x3c, 0xb5, 0x5c, 0x44, 0xa5, 0x9d, 0x85, 0xf4, 0x7e, 0x6e, 0xeb, 0xe9, 
+  0x1b, 0xb8, 0xce, 0x3a, 0xc7, 0xc4, 0x81, 0x2d, 0xcd, 0xbb, 0xfe, 0x90, 0x65, 0x5a, 0xf3, 0x33, 
+  0x0e, 0x67, 0x9d, 0x36, 0x0d, 0x33, 0x74, 0x61, 0xec, 0xfe, 0x9a, 0x49, 0x6c, 0xb0, 0x53, 0x38, 
+  0xe2, 0x50, 0xd9, 0xa6, 0xf9, 0xaf, 0xae, 0x9b, 0x16, 0xf5, 0xe0, 0x10, 0x5a, 0xaa, 0x7f, 0xac, 
+  0xf8, 0x81, 0x16, 0xde, 0x3f, 0x66, 0xb7, 0x1d, 0x95, 0xe8, 0x83, 0x6a, 0xfa, 0x80, 0xa9, 0x6a, 
+  0x1a, 0x34, 0xe3, 0xd3, 0x42, 0xdd, 0xb4, 0xae, 0xcb, 0x6b, 0xb8, 0x0b, 0x56, 0x13, 0x8c, 0xac, 
+  0x02, 0x81, 0x23, 0x2b, 0xf3, 0x69, 0x91, 0xc5, 0xc3, 0xad, 0xdf, 0xbb, 0xa2, 0x35, 0x0a, 0x1b, 
+  0x44, 0xdd, 0x52, 0x18, 0x52, 0x89, 0x97, 0x2c, 0x73, 0x0e, 0x99, 0x33, 0x51, 0x0e, 0x7a, 0x54, 
+  0xd6, 0x10, 0xb8, 0xd0, 0xe7, 0x02, 0x48, 0xfe, 0xbb, 0x8a, 0x4b, 0xe9, 0xf1, 0x29, 0x5d, 0x64, 
+  0x8b, 0x41, 0x89, 0x67, 0xe9, 0x27, 0x07, 0x75, 0x72, 0x02, 0x4d, 0xb2, 0x23, 0x85, 0x69, 0x91, 
+  0xd5, 0xca, 0x1c, 0x54, 0x3b, 0x9f, 0xb5, 0x29, 0xc7, 0x23, 0x27, 0x81, 0x46, 0x52, 0xa5, 0xee, 
+  0xf0, 0x78, 0x7e, 0x3d, 0xf6, 0x70, 0xd6, 0x06, 0xea, 0x9f, 0x28, 0x07, 0x10, 0x20, 0x0f, 0xe4, 
+  0x4f, 0x6f, 0xa0, 0x97, 0x92, 0x8f, 0x21, 0xac, 0x5c, 0xc0, 0x27, 0x61, 0x62, 0x74, 0xe2, 0x20, 
+  0x69, 0x2a, 0xf0, 0x35, 0x75, 0x62, 0xbb, 0x6d, 0x30, 0x9e, 0xe2, 0x0f, 0x4d, 0xc1, 0x39, 0x9e, 
+  0x09, 0x2d, 0x9a, 0xcc, 0x59, 0x79, 0x20, 0x1a, 0x68, 0x22, 0xb5, 0x29, 0x0f, 0xbf, 0x8f, 0x8e, 
+  0x49, 0x00, 0x73, 0x45, 0xad, 0x9e, 0x9b, 0xd7, 0xe5, 0x73, 0x17, 0x11, 0x56, 0x67, 0x90, 0x5f, 
+  0x56, 0xbe, 0x77, 0xce, 0xd3, 0x1f, 0x1b, 0x5a, 0x55, 0x0e, 0x41, 0x47, 0xd8, 0xfb, 0xde, 0x67, 
+  0x37, 0xdd, 0x3c, 0xbb, 0x49, 0x0a, 0xe2, 0xcc, 0x12, 0x93, 0x72, 0x60, 0xb0, 0xc8, 0x52, 0xc9, 
+  0x9c, 0x0e, 0x72, 0x51, 0x11, 0xda, 0xb7, 0x65, 0xcb, 0x2b, 0x99, 0x56, 0x05, 0xd5, 0xa1, 0x60, 
+  0xa9, 0x95, 0x73, 0x3a, 0x45, 0x12, 0x51, 0x39, 0x73, 0xca, 0x13, 0x38, 0xb1, 0xed, 0xd2, 0xbd, 
+  0x52, 0x34, 0xd4, 0xb3, 0xc1, 0x29, 0x55, 0x74, 0x41, 0x23, 0x77, 0x9c, 0x36, 0x73, 0x13, 0x57, 
+  0x3c, 0x1d, 0xe7, 0xd1, 0xde, 0x1a, 0xe4, 0x13, 0xe8, 0x09, 0x55, 0x8a, 0x24, 0x8d, 0xcf, 0xb4, 
+  0x8f, 0xac, 0xff, 0x3d, 0xab, 0x51, 0xf7, 0x42, 0x9b, 0x97, 0x08, 0xd4, 0x47, 0xd8, 0x2f, 0x05, 
+  0x6b, 0x69, 0x88, 0xff, 0x8e, 0x26, 0x63, 0x6c, 0xce, 0x69, 0x9b, 0x47, 0xf7, 0xfd, 0x91, 0x58, 
+  0x45, 0x0d, 0x02, 0x1f, 0x47, 0xf1, 0x76, 0x9b, 0x0f, 0x32, 0xe2, 0xef, 0x70, 0x10, 0x4e, 0x55, 
+  0x8e, 0x37, 0x86, 0x3d, 0xc0, 0x17, 0x2a, 0x79, 0x46, 0xb4, 0x31, 0x7a, 0xd9, 0x71, 0xaf, 0x37, 
+  0x3f, 0x31, 0x60, 0x31, 0x0e, 0xd8, 0x90, 0xbc, 0x98, 0xce, 0xcd, 0xa9, 0x26, 0xd8, 0x43, 0xe2, 
+  0x08, 0x94, 0xe1, 0x3c, 0xe7, 0x42, 0xfc, 0x2e, 0x7d, 0x15, 0xaf, 0x0a, 0xc9, 0xc1, 0xcc, 0x2d, 
+  0xcd, 0x2f, 0x23, 0x62, 0xf9, 0xc7, 0x24, 0xfb, 0xcb, 0x9b, 0x2c, 0xbf, 0xe7, 0x83, 0x1b, 0xce, 
+  0xb2, 0x86, 0x03, 0x32, 0xe4, 0x09, 0x29, 0xa2, 0x12, 0x47, 0xf9, 0x9c, 0xa4, 0x60, 0x19, 0x3d, 
+  0xd4, 0xa8, 0x51, 0x15, 0x4a, 0x0d, 0x30, 0x8d, 0xdc, 0x87, 0xb5, 0xba, 0x69, 0x90, 0x1b, 0x73, 
+  0xee, 0x58, 0x19, 0xb1, 0x1e, 0xf1, 0xfe, 0x35, 0x13, 0xdb, 0x98, 0x4b, 0xea, 0x76, 0x30, 0xc9, 
+  0x35, 0x64, 0x77, 0xbb, 0x4b, 0x58, 0x63, 0xfa, 0x50, 0x5e, 0x17, 0xa6, 0xa2, 0x90, 0x39, 0x5a, 
+  0xab, 0x44, 0xb7, 0xac, 0x4a, 0xf4, 0xce, 0x47, 0xb8, 0x3b, 0x58, 0xfe, 0x12, 0xe3, 0xe3, 0x57, 
+  0xa9, 0x66, 0x84, 0xee, 0xd8, 0xca, 0x6c, 0x06, 0xb8, 0xf9, 0x21, 0xb2, 0x61, 0xcb, 0x38, 0x74, 
+  0xaf, 0xec, 0xc7, 0xe2, 0x80, 0xca, 0x65, 0x0c, 0x0b, 0x00, 0xec, 0x53, 0x9d, 0x40, 0x81, 0x36, 
+  0x2a, 0x9f, 0xc4, 0xc2, 0xb3, 0xdb, 0xf8, 0x6d, 0x42, 0xe3, 0x9c, 0x9e, 0x44, 0x30, 0xcc, 0xe9, 
+  0xf7, 0x77, 0xa6, 0xe9, 0x26, 0x4b, 0x68, 0x39, 0x0d, 0xaa, 0xb1, 0xaa, 0x0e, 0x47, 0x73, 0xe1, 
+  0xd0, 0x2e, 0xee, 0x9e, 0x09, 0x66, 0x6d, 0xe2, 0x01, 0x57, 0xa6, 0x7a, 0xad, 0xe6, 0x6b, 0x29, 
+  0x19, 0x47, 0x1b, 0x65, 0x05, 0x53, 0xc2, 0x9d, 0xa8, 0x56, 0xba, 0x65, 0x45, 0x3b, 0xf4, 0x76, 
+  0x95, 0xb9, 0x2c, 0x42, 0xb3, 0x22, 0x9c, 0x73, 0x11, 0xb4, 0xa8, 0xfa, 0x4c, 0xf3, 0xf8, 0xa4, 
+  0xb5, 0xba, 0x4e, 0xcc, 0xd6, 0x86, 0xf2, 0xe7, 0xa4, 0xbc, 0x6a, 0xe7, 0x66, 0x62, 0x06, 0xbd, 
+  0xa9, 0x14, 0x2a, 0x4d, 0x17, 0x0d, 0x49, 0xed, 0xf1, 0x89, 0xb1, 0xff, 0xa5, 0x95, 0x9f, 0x55, 
+  0xf0, 0x24, 0xa8, 0x71, 0x67, 0x45, 0x51, 0x77, 0x4b, 0x5f, 0x97, 0x03, 0xd3, 0x68, 0x33, 0x01, 
+  0x91, 0xf3, 0x5d, 0x6b, 0x7f, 0xb3, 0xdd, 0xce, 0xc6, 0xd7, 0x72, 0xd3, 0xbd, 0xbc, 0x44, 0xf0, 
+  0xfc, 0xbc, 0xc5, 0xa2, 0x97, 0x78, 0xe7, 0xa9, 0x47, 0xd2, 0x7b, 0xb2, 0xbc, 0xf7, 0x40, 0x35, 
+  0xb3, 0x4b, 0x78, 0x1c, 0x7b, 0xc2, 0x41, 0x40, 0xbe, 0xa7, 0x36, 0x99, 0x17, 0x1c, 0x78, 0xfa, 
+  0x6c, 0x26, 0xa6, 0x1e, 0x7d, 0x96, 0xad, 0x6e, 0xa1, 0x6a, 0x06, 0x8e, 0x6c, 0x54, 0x00, 0xe4, 
+  0x70, 0xd4, 0x5e, 0x4b, 0xfd, 0xd5, 0x50, 0x98, 0x8a, 0x16, 0x9e, 0xaa, 0x95, 0x03, 0xc5, 0x0a, 
+  0x0f, 0x08, 0xf7, 0xdf, 0xad, 0x74, 0x24, 0x74, 0x3d, 0xa8, 0x14, 0x6a, 0x4f, 0x0f, 0x71, 0x60, 
+  0x98, 0x2b, 0x88, 0xa3, 0x07, 0x4e, 0x69, 0xde, 0xb2, 0x08, 0xb0, 0x22, 0xe1, 0xb4, 0x81, 0xad, 
+  0x69, 0xb7, 0x98, 0x10, 0x54, 0xeb, 0xa2, 0x08, 0xc2, 0xde, 0x3a, 0x31, 0x92, 0x6f, 0x75, 0x9c, 
+  0x60, 0x82, 0xa1, 0x4d, 0x38, 0xc0, 0xd4, 0x24, 0xeb, 0x5a, 0x1f, 0x54, 0xb2, 0x63, 0x5b, 0xdf, 
+  0xd8, 0x6e, 0x74, 0xb3, 0x90, 0xbe, 0x4b, 0x15, 0xf4, 0xfe, 0xcf, 0x44, 0x1b, 0x89, 0xbf, 0x87, 
+  0x0e, 0x69, 0xfa, 0xf1, 0x8c, 0xed, 0x87, 0xd4, 0xd5, 0xb8, 0x98, 0x02, 0xc3, 0xce, 0xf6, 0x12, 
+  0xbd, 0x73, 0x32, 0xa9, 0xf6, 0xd4, 0x57, 0x63, 0x26, 0x75, 0x0e, 0x51, 0xb4, 0x97, 0x2c, 0x01, 
+  0x28, 0xb8, 0xf1, 0xa1, 0xb8, 0x03, 0x2c, 0x69, 0x4a, 0x99, 0x0f, 0xf4, 0x6a, 0xea, 0x09, 0xc2, 
+  0x3d, 0xa7, 0xe1, 0x0b, 0xf3, 0x29, 0x10, 0x7d, 0xcf, 0x03, 0x90, 0x7b, 0x33, 0xd5, 0x58, 0xca, 
+  0xf9, 0x5e, 0xaa, 0x26, 0x77, 0x9c, 0xac, 0x55, 0xc5, 0x6f, 0x0d, 0xaa, 0xd6, 0x90, 0x93, 0xdc, 
+  0xe5, 0xc1, 0x1c, 0x02, 0xbe, 0x21, 0x41, 0xb3, 0x0a, 0xf4, 0xea, 0xeb, 0x53, 0xd2, 0x7d, 0xcf, 
+  0x0c, 0x1b, 0xe0, 0x0e, 0xcd, 0xe6, 0xd5, 0x3c, 0x0b, 0xd9, 0x92, 0xc4, 0x4a, 0xe9, 0x58, 0x92, 
+  0x93, 0x4d, 0xa0, 0xa3, 0x4a, 0x44, 0xb1, 0x73, 0xea, 0x06, 0x7d, 0x71, 0x56, 0x75, 0xce, 0x49, 
+  0xc0, 0x08, 0x89, 0x40, 0xfb, 0xf8, 0xbf, 0xb9, 0x52, 0x06, 0xf7, 0x08, 0xae, 0xb5, 0xec, 0xf3, 
+  0x9c, 0x6c, 0xf8, 0xc4, 0x36, 0x18, 0xab, 0x10, 0x97, 0xff, 0x42, 0x1a, 0x3d, 0x15, 0x1c, 0x95, 
+  0x2a, 0x14, 0x4c, 0x75, 0x8a, 0x89, 0x49, 0xf0, 0x23, 0xe6, 0xfe, 0x86, 0x06, 0xfc, 0x39, 0x0d, 
+  0x58, 0x5f, 0x7e, 0x49, 0x97, 0x41, 0xe8, 0x6f, 0x7a, 0x3d, 0xf1, 0x78, 0x21, 0xfb, 0x34, 0xd3, 
+  0xeb, 0x87, 0x65, 0x09, 0xf0, 0x2d, 0x1c, 0xa7, 0x3e, 0x67, 0xee, 0x4e, 0xf3, 0x27, 0x39, 0x22, 
+  0x94, 0x04, 0xc2, 0x2f, 0x70, 0xfc, 0xaf, 0x57, 0x97, 0x4b, 0xab, 0xd9, 0x20, 0xee, 0xb3, 0x8c, 
+  0x8a, 0x49, 0x0d, 0x98, 0x99, 0xa9, 0xf2, 0x1d, 0x96, 0xa7, 0x02, 0x63, 0x42, 0x50, 0x73, 0xc9, 
+  0x8e, 0x01, 0x5f, 0x66, 0xd9, 0x35, 0xc4, 0xe6, 0xf6, 0x37, 0x9c, 0xca, 0xbc, 0x00, 0x27, 0xf8, 
+  0x26, 0x8f, 0xe7, 0xc4, 0x85, 0x6e, 0x4e, 0xa2, 0xa4, 0xc7, 0x82, 0x38, 0x75, 0xf0, 0xcb, 0x96, 
+  0x0e, 0x66, 0x1a, 0xd4, 0x18, 0x8b, 0xea, 0xae, 0x8d, 0x93, 0x49, 0x89, 0x53, 0x20, 0xa7, 0x15, 
+  0x12, 0x32, 0x99, 0xc1, 0x54, 0xcd, 0xfb, 0x6e, 0x23, 0xd1, 0x81, 0x62, 0x40, 0xdf, 0xd7, 0x03, 
+  0x27, 0x2b, 0x2a, 0x02, 0xb0, 0xef, 0x1e, 0xd9, 0xa1, 0x34, 0x62, 0x9c, 0xfb, 0x4e, 0x9f, 0xcf, 
+  0x58, 0x44, 0x9d, 0xfb, 0x43, 0x21, 0x05, 0xf2, 0x80, 0x4d, 0xf2, 0xf0, 0x73, 0x21, 0x6b, 0x53, 
+  0x2e, 0x70, 0x56, 0xde, 0x2c, 0x49, 0xcb, 0x5c, 0x86, 0x9f, 0xf3, 0xcb, 0x67, 0x7b, 0x2f, 0x39, 
+  0x23, 0xd8, 0x97, 0x38, 0x0c, 0x75, 0xb7, 0x88, 0xbe, 0x0c, 0x0f, 0x27, 0xa8, 0x9c, 0x58, 0xea, 
+  0xc0, 0xd6, 0x80, 0xf0, 0xdf, 0x2a, 0x88, 0x77, 0x1c, 0xd7, 0x79, 0x8a, 0x76, 0x9c, 0x52, 0xc2, 
+  0xa3, 0x11, 0x9a, 0xfd, 0x4f, 0x66, 0xe3, 0x58, 0xe1, 0x92, 0x88, 0x03, 0x93, 0x8a, 0x9c, 0x11, 
+  0xc8, 0xa2, 0x96, 0x7a, 0x3a, 0x89, 0xf2, 0x1d, 0x75, 0xfd, 0x79, 0x5f, 0xce, 0xe8, 0x3b, 0x13, 
+  0x77, 0xcb, 0x3c, 0x79, 0xee, 0x3e, 0x19, 0x72, 0x09, 0xd0, 0x63, 0x61, 0xa6, 0x0c, 0x37, 0xc4, 
+  0x92, 0x70, 0xa5, 0x25, 0x1e, 0x80, 0xf8, 0x05, 0xa2, 0x60, 0x04, 0x32, 0x8b, 0x5a, 0x90, 0xf3, 
+  0x3e, 0x6a, 0x01, 0x8b, 0xa9, 0xf5, 0xab, 0x61, 0x3b, 0x45, 0xad, 0x7f, 0x44, 0x83, 0x31, 0x14, 
+  0x18, 0x46, 0x4b, 0x76, 0x62, 0xa9, 0xb8, 0x72, 0xbc, 0xc6, 0x5e, 0x2a, 0xb0, 0x71, 0xe8, 0xd3, 
+  0xbb, 0x2b, 0xb9, 0xef, 0x82, 0x91, 0xee, 0x67, 0xb6, 0x2b, 0x23, 0x28, 0xaf, 0x34, 0xe3, 0x05, 
+  0xc4, 0xa6, 0xf3, 0x31, 0x3a, 0x7d, 0xc9, 0x1c, 0x98, 0xf3, 0x61, 0x2d, 0xf5, 0x3e, 0xf7, 0x32, 
+  0xf0, 0xf0, 0x4a, 0x7a, 0xc3, 0xd5, 0xe8, 0xa4, 0xd9, 0xe8, 0x64, 0xaf, 0x8d, 0x50, 0x8a, 0x7e, 
+  0x3f, 0x6d, 0x6c, 0x5e, 0x16, 0x14, 0xb1, 0x3f, 0x96, 0x3e, 0xf1, 0x7e, 0xd8, 0x56, 0x90, 0x8c, 
+  0x32, 0x4d, 0xe5, 0x00, 0xe0, 0xa6, 0xb4, 0xdd, 0x57, 0xa2, 0x43, 0xc2, 0x9b, 0x25, 0xa4, 0x8c, 
+  0x04, 0x99, 0x92, 0xfa, 0x9c, 0x71, 0x0f, 0xdd, 0x61, 0x72, 0x33, 0x53, 0x92, 0x91, 0x3d, 0x0d, 
+  0xce, 0x14, 0xe1, 0xd3, 0x31, 0x43, 0x4a, 0x98, 0xe2, 0xfc, 0xa8, 0x0e, 0x39, 0xd0, 0x8c, 0xad, 
+  0xdd, 0xaa, 0x26, 0x1d, 0xd4, 0x6a, 0x04, 0xc0, 0xaf, 0xa0, 0x33, 0x45, 0x6e, 0xb5, 0xed, 0x57, 
+  0x24, 0x0e, 0xe7, 0x29, 0x5d, 0xfc, 0x18, 0xa7, 0x97, 0x72, 0xfb, 0x23, 0x66, 0x4e, 0x12, 0xe9, 
+  0xdf, 0xaa, 0x98, 0x2a, 0x5b, 0x36, 0x4f, 0xff, 0xe9, 0xc7, 0xaf, 0x02, 0x46, 0xc3, 0x4f, 0x8e, 
+  0xc7, 0x87, 0xd0, 0x4b, 0x43, 0x36, 0xbe, 0x1e, 0xe8, 0xe4, 0xc8, 0xdd, 0xae, 0xbd, 0x1c, 0xdc, 
+  0xc5, 0x39, 0x51, 0x47, 0x7a, 0xf4, 0x95, 0x75, 0xc4, 0x81, 0x13, 0x4e, 0xb3, 0x88, 0xc9, 0xb8, 
+  0x6b, 0x5b, 0x3a, 0xb2, 0x2d, 0xb1, 0xc3, 0x27, 0x49, 0x2c, 0x45, 0x11, 0x5f, 0x4a, 0x44, 0x3f, 
+  0x00, 0x46, 0xe1, 0xe0, 0x3a, 0x67, 0x4a, 0xd3, 0x7f, 0x66, 0x4a, 0xd6, 0x02, 0xa3, 0xd4, 0x70, 
+  0x8d, 0x8b, 0x56, 0xb5, 0x34, 0x1b, 0xec, 0x78, 0x5a, 0x9e, 0xd4, 0x60, 0xa7, 0x22, 0x83, 0xaf, 
+  0xa8, 0xe8, 0xa9, 0x8e, 0x8a, 0xde, 0x88, 0x1b, 0xfc, 0xf2, 0xbb, 0x6f, 0xb4, 0xe3, 0xe0, 0xd7, 
+  0x59, 0xbc, 0x40, 0x24, 0xbb, 0x57, 0x40, 0x6d, 0xad, 0x65, 0x55, 0xc8, 0xe0, 0x57, 0x81, 0xe9, 
+  0xab, 0xaf, 0x12, 0x99, 0xaa, 0x9b, 0xb6, 0x3c, 0xb8, 0x4f, 0xd4, 0x4a, 0x13, 0xe9, 0x57, 0x78, 
+  0xdf, 0x2d, 0xd2, 0x1c, 0xaf, 0x4a, 0xf3, 0xae, 0x76, 0x62, 0xc5, 0xb4, 0xda, 0x74, 0x83, 0x23, 
+  0xc1, 0xc5, 0x7f, 0x8e, 0x93, 0x32, 0xd4, 0xd7, 0xb5, 0x0d, 0xe7, 0xab, 0x13, 0xff, 0x49, 0xbf, 
+  0xaf, 0x2b, 0xe6, 0x92, 0x38, 0x0d, 0xe0, 0x0a, 0x60, 0xa7, 0x68, 0x6f, 0x90, 0x0f, 0x0b, 0x6a, 
+  0x70, 0x58, 0x72, 0xd5, 0xca, 0x6f, 0xb7, 0x4f, 0x6a, 0x5b, 0xe2, 0x54, 0xc0, 0x9a, 0x56, 0x69, 
+  0x07, 0xb9, 0x10, 0x8f, 0x27, 0x52, 0xc3, 0x42, 0x3e, 0xc1, 0x9b, 0x35, 0xe2, 0xe3, 0x03, 0xf4, 
+  0x4f, 0x55, 0x81, 0xd7, 0x80, 0x7f, 0xa4, 0x12, 0xa1, 0xa9, 0xd2, 0xd2, 0x9d, 0xfb, 0x86, 0xe4, 
+  0xb9, 0xd3, 0x66, 0xb8, 0x39, 0xba, 0x7f, 0x3d, 0xcf, 0xb3, 0xd5, 0x6a, 0x52, 0x5b, 0x65, 0xdd, 
+  0x22, 0x91, 0xaa, 0xd3, 0x96, 0x70, 0xcf, 0x07, 0x96, 0x6d, 0xbf, 0xa0, 0x59, 0x33, 0xb5, 0x6f, 
+  0x7e, 0x6e, 0xa4, 0xd3, 0xad, 0x0c, 0x5d, 0x2d, 0xf3, 0x54, 0xb7, 0xce, 0x57, 0xba, 0x54, 0xb6, 
+  0xad, 0x70, 0xf8, 0x93, 0x77, 0x50, 0x5f, 0x60, 0xf7, 0x6e, 0x70, 0xac, 0x92, 0x21, 0xbe, 0x59, 
+  0x1e, 0xa8, 0x0a, 0x37, 0x22, 0x9f, 0x6e, 0x70, 0xb2, 0xc7, 0x95, 0xda, 0x74, 0x0f, 0xf6, 0x60, 
+  0x0b, 0x72, 0x36, 0x7f, 0x40, 0x08, 0x22, 0x60, 0x29, 0x8c, 0xad, 0xaf, 0x99, 0x7a, 0x17, 0x13, 
+  0x3f, 0x35, 0xc9, 0xfa, 0x92, 0x80, 0xcf, 0xa6, 0x68, 0xf8, 0xd4, 0x09, 0x71, 0x40, 0xcd, 0xb7, 
+  0x72, 0x14, 0xda, 0x29, 0x07, 0x53, 0x4c, 0xb5, 0x72, 0x7f, 0x73, 0x32, 0x1f, 0x6f, 0x90, 0xe4, 
+  0x8e, 0xe8, 0xc5, 0x06, 0x49, 0x0f, 0x8b, 0x49, 0x62, 0x55, 0xdd, 0x78, 0xb2, 0x11, 0xe6, 0x95, 
+  0xe3, 0x0d, 0x91, 0x11, 0x8d, 0x5d, 0x4d, 0x4c, 0x1f, 0x82, 0x70, 0x3e, 0x49, 0x95, 0x32, 0x22, 
+  0x07, 0x71, 0x14, 0xff, 0x20, 0xac, 0xd3, 0xbf, 0x29, 0xfa, 0xc7, 0xe2, 0xa7, 0xe8, 0xb8, 0xaf, 
+  0x0c, 0x01, 0x02, 0x57, 0xf1, 0xf4, 0xb7, 0xba, 0x96, 0x7b, 0x50, 0x66, 0x3f, 0xad, 0xd7, 0xd6, 
+  0x84, 0xc0, 0x16, 0xfb, 0xb3, 0x66, 0xce, 0xe3, 0xc4, 0x1f, 0xa3, 0xba, 0x9d, 0x80, 0x37, 0x3f, 
+  0x89, 0xbf, 0x29, 0xbb, 0x83, 0x5f, 0xa2, 0xf7, 0x1e, 0x62, 0xab, 0x78, 0x48, 0xee, 0x7d, 0xa7, 
+  0xe7, 0x1c, 0x71, 0x57, 0x5d, 0xfc, 0x82, 0xb1, 0x06, 0x92, 0xd0, 0xaa, 0xec, 0x9f, 0xca, 0x80, 
+  0x02, 0x57, 0xbd, 0x2f, 0x06, 0x9b, 0x64, 0xd1, 0xeb, 0xed, 0xf8, 0x37, 0x1a, 0x89, 0x2f, 0xdc, 
+  0xfc, 0xc4, 0x1c, 0x9c, 0xa8, 0x4d, 0x2b, 0x3e, 0x75, 0x6b, 0x6b, 0x84, 0x40, 0x79, 0xd8, 0x89, 
+  0x5f, 0x54, 0x9e, 0x64, 0x37, 0xde, 0x62, 0xfd, 0x8b, 0xa8, 0x0c, 0xb5, 0x3e, 0x5e, 0x65, 0x19, 
+  0xaf, 0xdc, 0xd9, 0x85, 0x5b, 0x4e, 0x68, 0x93, 0xe2, 0x12, 0x4a, 0xd5, 0x65, 0x72, 0xb9, 0xc9, 
+  0x59, 0x5b, 0xc0, 0x47, 0xe1, 0x01, 0xb2, 0x0a, 0x17, 0xb2, 0x3c, 0xe4, 0x09, 0xa5, 0x4e, 0x8a, 
+  0x78, 0x04, 0x26, 0x86, 0xf0, 0x9e, 0xf6, 0x32, 0x48, 0xa6, 0x7f, 0xd2, 0x92, 0x13, 0xd9, 0x6f, 
+  0x64, 0xd1, 0x54, 0x6f, 0xf2, 0xa0, 0x9e, 0xf3, 0x31, 0x69, 0x66, 0x5a, 0xde, 0x0b, 0x9d, 0xcc, 
+  0x6e, 0x13, 0xb5, 0x86, 0xc3, 0xc6, 0xc8, 0x11, 0xa7, 0xa7, 0xf6, 0x40, 0xf5, 0x80, 0x64, 0x4e, 
+  0xce, 0x47, 0x7f, 0x48, 0xb7, 0x5d, 0x55, 0xbf, 0xdd, 0x1e, 0x50, 0xc4, 0xda, 0x22, 0xe9, 0xc4, 
+  0x1e, 0xa3, 0xa0, 0x87, 0xa1, 0x3a, 0x55, 0x29, 0xd4, 0x2d, 0xd5, 0x29, 0xaa, 0x03, 0x67, 0xe2, 
+  0x20, 0x41, 0x86, 0x9a, 0x0a, 0xa6, 0xda, 0xa9, 0x5b, 0x73, 0xb1, 0xdd, 0x8d, 0x9d, 0x37, 0x02, 
+  0x24, 0x07, 0x0f, 0x29, 0x9c, 0x3b, 0xeb, 0x69, 0x6d, 0xc1, 0xc5, 0xb2, 0xba, 0xf9, 0x4f, 0xf4, 
+  0x25, 0xc2, 0x78, 0x83, 0x04, 0xa1, 0x02, 0x89, 0xfa, 0x87, 0x65, 0x4d, 0x55, 0x19, 0xb8, 0x76, 
+  0xca, 0xca, 0x00, 0x5b, 0x67, 0x23, 0x81, 0xdc, 0x98, 0xce, 0x66, 0x3b, 0xdf, 0x9d, 0x09, 0x20, 
+  0x77, 0x27, 0x5d, 0xab, 0xcf, 0x91, 0x4d, 0x1f, 0x03, 0x3b, 0xcd, 0x0a, 0xda, 0x0c, 0x27, 0xb5, 
+  0xb7, 0x90, 0x61, 0xae, 0xe2, 0xe2, 0x65, 0x5c, 0xc6, 0x1f, 0x0e, 0xf3, 0xd5, 0xd8, 0x09, 0xcd, 
+  0x37, 0xfb, 0x03, 0xcf, 0x7b, 0x46, 0xc1, 0x3f, 0xb0, 0x17, 0xc2, 0x17, 0xe2, 0x57, 0xfd, 0xfb, 
+  0x77, 0x6d, 0xa2, 0xf0, 0xa0, 0xec, 0x13, 0x9e, 0x9e, 0xef, 0xb6, 0xe7, 0x53, 0x73, 0x3d, 0x43, 
+  0x42, 0xb1, 0x7f, 0x46, 0xc7, 0xd3, 0x17, 0xfd, 0x7f, 0xce, 0x5c, 0x4c, 0x23, 0x65, 0x8b, 0x7d, 
+  0x42, 0xb5, 0xec, 0x7b, 0x6e, 0xed, 0x38, 0x8e, 0x8f, 0xbc, 0x05, 0x8d, 0xa7, 0xef, 0xc6, 0xc1, 
+  0xf9, 0xa7, 0xf0, 0xfa, 0x4f, 0xba, 0x5e, 0xd3, 0x6b, 0xbf, 0x09, 0x53, 0x9c, 0x86, 0xb6, 0x66, 
+  0x95, 0x07, 0xac, 0xc9, 0x42, 0x5d, 0x1a, 0x79, 0x65, 0xbe, 0x61, 0x12, 0xe8, 0x93, 0x9c, 0xce, 
+  0x02, 0x2b, 0x54, 0xb5, 0x9e, 0xc6, 0xf5, 0x1e, 0xb0, 0x38, 0xde, 0x26, 0x2a, 0xec, 0x14, 0x22, 
+  0x52, 0xf6, 0x92, 0x9e, 0xe7, 0x4d, 0x7a, 0x49, 0xa8, 0xad, 0x50, 0x93, 0x60, 0xf2, 0xb7, 0xd7, 
+  0xdf, 0x7d, 0xab, 0x0c, 0x00, 0x10, 0x87, 0x27, 0x71, 0x04, 0xc5, 0xdd, 0xaf, 0x0e, 0xbc, 0x2a, 
+  0xbf, 0x24, 0x23, 0xe7, 0x55, 0x86, 0x60, 0x67, 0xee, 0xc1, 0xf5, 0xde, 0xaa, 0xe9, 0x62, 0xbf, 
+  0x0e, 0xf4, 0x4b, 0x96, 0xab, 0x7f, 0x70, 0xee, 0x76, 0x62, 0x51, 0xff, 0xa6, 0xb6, 0xe1, 0x7e, 
+  0x1d, 0xa8, 0x0d, 0x69, 0xfa, 0xa0, 0xf7, 0xc8, 0xcb, 0xe6, 0x27, 0xc1, 0xc3, 0xaf, 0x9a, 0x6f, 
+  0xd2, 0xf1, 0x12, 0xdf, 0x3e, 0x56, 0xeb, 0x0f, 0xcd, 0x5a, 0xdf, 0x1e, 0xac, 0xf6, 0x87, 0x5a, 
+  0xb5, 0xcc, 0x8d, 0x38, 0x47, 0xf5, 0xf5, 0x46, 0x70, 0xba, 0xac, 0xed, 0x95, 0x74, 0xf8, 0x7a, 
+  0x75, 0x72, 0x0b, 0x57, 0xaa, 0x6e, 0x37, 0x73, 0x0c, 0x4c, 0x6b, 0xbb, 0xd7, 0xd8, 0x4d, 0xb6, 
+  0x28, 0x21, 0x52, 0x65, 0x2b, 0xa1, 0x64, 0x41, 0x87, 0xf7, 0x54, 0xeb, 0xa2, 0xb4, 0x36, 0x88, 
+  0xa7, 0xf1, 0x73, 0x33, 0x09, 0xbb, 0x71, 0x12, 0x87, 0x35, 0xb3, 0x83, 0x93, 0xac, 0x6d, 0x8c, 
+  0x6d, 0x9c, 0x30, 0xc1, 0xaf, 0x8c, 0xa3, 0x38, 0xa3, 0x2c, 0xd1, 0x60, 0xf7, 0x0d, 0x41, 0x7a, 
+  0xfd, 0xf1, 0xf8, 0xbd, 0xbd, 0xe1, 0x44, 0xef, 0x3b, 0xa1, 0x4d, 0x5c, 0xf6, 0x25, 0x22, 0xf5, 
+  0x86, 0xf8, 0x0e, 0x74, 0xad, 0x7e, 0x40, 0x95, 0x98, 0x9e, 0x28, 0x93, 0xb4, 0xcc, 0x39, 0xce, 
+  0xef, 0xfc, 0xa0, 0xfb, 0xe8, 0x69, 0xc0, 0xc1, 0x6e, 0x28, 0xbc, 0x20, 0x30, 0xf6, 0x5b, 0xc6, 
+  0x5d, 0x45, 0x89, 0x34, 0x31, 0x8b, 0x3f, 0x18, 0x30, 0xed, 0x3c, 0xdc, 0x28, 0x59, 0xa1, 0x8a, 
+  0x9e, 0xa6, 0x36, 0xa3, 0xb2, 0x1b, 0x27, 0x02, 0xa3, 0x75, 0xc5, 0x9f, 0x20, 0x28, 0x9a, 0x54, 
+  0x0e, 0x9c, 0x9c, 0xa7, 0x79, 0xfc, 0x03, 0x8f, 0xac, 0xd9, 0x2c, 0xba, 0xbf, 0xab, 0x88, 0x51, 
+  0x2b, 0xec, 0x34, 0xb2, 0xce, 0xef, 0xcd, 0x98, 0x86, 0x2a, 0x75, 0xf4, 0x1f, 0xec, 0xcc, 0x31, 
+  0xb8, 0x86, 0xab, 0x3f, 0x36, 0x72, 0x23, 0xc3, 0x83, 0xa6, 0xb6, 0x95, 0x2d, 0x54, 0x04, 0xb3, 
+  0x20, 0x6f, 0xf9, 0x0e, 0x01, 0xb5, 0xf8, 0x23, 0x44, 0x6f, 0xfc, 0xc1, 0x12, 0x1d, 0x24, 0x37, 
+  0xe7, 0x70, 0xc9, 0x7b, 0x19, 0xce, 0x51, 0xca, 0xd9, 0x04, 0xae, 0x6d, 0x13, 0x2d, 0x78, 0x68, 
+  0x03, 0xf7, 0x07, 0x22, 0x07, 0x45, 0xa0, 0x5d, 0x2a, 0xf7, 0x3b, 0x45, 0x68, 0x28, 0xd2, 0xed, 
+  0x8f, 0xcd, 0x81, 0x26, 0x97, 0x52, 0x8d, 0x57, 0xb9, 0x9c, 0xa0, 0x46, 0xb4, 0x7e, 0x4a, 0xe0, 
+  0x7b, 0xde, 0x72, 0x31, 0xc8, 0x7e, 0x85, 0x8a, 0xcd, 0x0a, 0x83, 0x66, 0xa3, 0xfd, 0x8e, 0x14, 
+  0xfa, 0x72, 0xbf, 0xc9, 0xfb, 0x7d, 0x76, 0x01, 0xf1, 0xd1, 0x56, 0xa4, 0x6d, 0x52, 0x4d, 0x34, 
+  0x5c, 0xf7, 0xdb, 0x40, 0x68, 0xaa, 0x92, 0xf1, 0xe1, 0x95, 0xb0, 0x47, 0x82, 0xce, 0xec, 0x9f, 
+  0x0d, 0xf4, 0x60, 0x4c, 0x6c, 0x55, 0x64, 0x39, 0xc9, 0x69, 0x87, 0x62, 0x93, 0xf2, 0x99, 0x09, 
+  0xab, 0x1f, 0xa0, 0xc7, 0x71, 0xfa, 0xd9, 0x9e, 0x62, 0x5b, 0x4f, 0x3b, 0x97, 0xf0, 0xc6, 0x16, 
+  0xbf, 0xa8, 0x05, 0x48, 0x19, 0xd7, 0xd9, 0x69, 0x4e, 0xc5, 0x83, 0x3a, 0x91, 0x39, 0xac, 0x2c, 
+  0x6f, 0xea, 0x6e, 0x1c, 0xf4, 0x33, 0x2d, 0xed, 0x12, 0xa7, 0x33, 0x95, 0x0f, 0xa8, 0x89, 0x8e, 
+  0x1a, 0x2b, 0x64, 0x81, 0x46, 0x46, 0xcf, 0xcc, 0xd1, 0x72, 0xd3, 0x48, 0x47, 0x1d, 0x1d, 0x97, 
+  0xa2, 0x8c, 0x30, 0xb3, 0x42, 0x62, 0x9e, 0x9b, 0x7b, 0xf6, 0x04, 0xca, 0x2a, 0x35, 0x61, 0x06, 
+  0xa3, 0x95, 0x26, 0x08, 0xac, 0x65, 0x74, 0xc2, 0x56, 0x40, 0x57, 0xad, 0xbb, 0x5f, 0x2b, 0xb7, 
+  0xa0, 0x3a, 0x04, 0xa8, 0xe7, 0xc8, 0x4d, 0x6d, 0x16, 0xd7, 0x5d, 0xd2, 0x8e, 0xb1, 0xac, 0xab, 
+  0xd6, 0x4d, 0x7f, 0x00, 0x4c, 0xb3, 0x0f, 0x97, 0x8f, 0x6f, 0xbd, 0x46, 0x25, 0x0a, 0x5d, 0xcd, 
+  0x57, 0x32, 0xce, 0x7f, 0x78, 0xb4, 0x1e, 0x0d, 0x30, 0x0a, 0xda, 0xe1, 0xd8, 0xdc, 0xa6, 0xe4, 
+  0x73, 0x19, 0xb6, 0x11, 0x01, 0x7d, 0x4d, 0x9d, 0xa4, 0xe8, 0x01, 0x11, 0x03, 0xd7, 0x78, 0xaa, 
+  0x70, 0x35, 0x68, 0xfd, 0x3e, 0x6d, 0xb6, 0xa4, 0x26, 0x06, 0x67, 0x02, 0x6e, 0xc2, 0x3b, 0xe6, 
+  0xc4, 0xda, 0x2c, 0xac, 0x80, 0xa5, 0x85, 0xd4, 0x44, 0x99, 0x1d, 0x71, 0xf4, 0x7e, 0x54, 0x41, 
+  0x98, 0x52, 0x8d, 0x0c, 0x10, 0x8a, 0x49, 0xc8, 0x1a, 0xb0, 0xaa, 0x14, 0x26, 0x0c, 0x90, 0xc0, 
+  0x83, 0xbd, 0x9e, 0xd0, 0x77, 0x0c, 0x83, 0x85, 0x13, 0x0e, 0x4a, 0xf9, 0x16, 0x6a, 0x3d, 0x50, 
+  0x69, 0x15, 0x41, 0xc8, 0x51, 0x8a, 0x74, 0xb5, 0x13, 0xb0, 0x50, 0x8b, 0xa7, 0xe7, 0x83, 0x6d, 
+  0x70, 0xbe, 0xe8, 0xd1, 0xcd, 0x54, 0x9e, 0xcd, 0xf8, 0x05, 0xdd, 0x6e, 0x83, 0x63, 0x9d, 0x5d, 
+  0x0d, 0xa9, 0x49, 0x9b, 0x19, 0x6b, 0x39, 0xdd, 0x6d, 0x10, 0x6d, 0x03, 0x9f, 0x38, 0x23, 0x98, 
+  0x23, 0xb3, 0x60, 0xf7, 0x1f, 0xb3, 0xa7, 0x36, 0x8b, 0x6d, 0x2e, 0xa3, 0xa9, 0xf7, 0x26, 0x5b, 
+  0xd3, 0xed, 0x8f, 0x70, 0xfe, 0xa0, 0xdf, 0xcf, 0xb3, 0xb2, 0xcc, 0x6e, 0xe8, 0xe2, 0x6b, 0xb9, 
+  0x2c, 0xbd, 0x19, 0x32, 0x8e, 0xb6, 0xc9, 0x02, 0x5e, 0x8a, 0x83, 0x30, 0xd0, 0x00, 0x19, 0xa9, 
+  0xa4, 0x55, 0x45, 0x79, 0xbf, 0xe2, 0x24, 0x5f, 0x9c, 0xd9, 0x7a, 0xab, 0x1d, 0x32, 0x6a, 0x4f, 
+  0x01, 0x64, 0xd6, 0x3a, 0xae, 0x11, 0x5c, 0x59, 0x40, 0x9a, 0xb2, 0xb5, 0x52, 0x39, 0xde, 0xd4, 
+  0x9e, 0xfe, 0xd2, 0xe3, 0xf0, 0xc0, 0x8f, 0xf9, 0x8b, 0x41, 0xbb, 0x6b, 0x7d, 0x51, 0x4b, 0x22, 
+  0x52, 0xc4, 0x09, 0xeb, 0xe6, 0x91, 0xd2, 0xbd, 0xba, 0x24, 0x69, 0x47, 0xa7, 0xaa, 0xe1, 0xa2, 
+  0xc0, 0x83, 0x26, 0xe7, 0x28, 0x23, 0x63, 0x38, 0x66, 0x39, 0xa5, 0x51, 0x51, 0x25, 0x1b, 0x8d, 
+  0xdd, 0x4c, 0x84, 0x2d, 0x9d, 0x78, 0x36, 0x24, 0x98, 0xcb, 0xf7, 0x43, 0x74, 0x1e, 0xe5, 0x83, 
+  0xf9, 0x26, 0xf7, 0xdd, 0x88, 0xea, 0xce, 0x01, 0xf7, 0x5c, 0xd3, 0x09, 0x3e, 0xd0, 0xdf, 0x44, 
+  0x00, 0x89, 0x39, 0x9f, 0x56, 0x71, 0x74, 0x55, 0x9f, 0x0b, 0xa8, 0x1c, 0xf0, 0xf0, 0xfb, 0xf0, 
+  0x10, 0xd2, 0x10, 0x79, 0x09, 0x56, 0x51, 0xe3, 0x15, 0xcd, 0x3a, 0xbd, 0xa0, 0x1d, 0x3d, 0xef, 
+  0x76, 0x7b, 0x1b, 0x40, 0xa0, 0x54, 0xf6, 0xaf, 0xb6, 0x09, 0xe5, 0x90, 0xba, 0xea, 0x76, 0x57, 
+  0x54, 0x35, 0x0a, 0x2a, 0x12, 0xbf, 0x39, 0x8e, 0x9e, 0x51, 0x93, 0xf3, 0xed, 0x16, 0xcf, 0xa9, 
+  0xe2, 0xde, 0x66, 0xbb, 0x1d, 0x29, 0x28, 0x3f, 0x53, 0x73, 0xc1, 0x1d, 0x5c, 0xf5, 0xe6, 0x81, 
+  0xf0, 0x47, 0xfd, 0x2c, 0x78, 0x4a, 0x7f, 0x7d, 0x84, 0x29, 0x0b, 0x8e, 0xa9, 0xe8, 0x80, 0x88, 
+  0xfb, 0x09, 0xc2, 0xcc, 0xc1, 0x55, 0x91, 0x3a, 0x76, 0x1c, 0x65, 0xe3, 0xd5, 0x53, 0xaa, 0x73, 
+  0xef, 0x63, 0xed, 0x9b, 0xb7, 0x73, 0x4c, 0xe6, 0xa9, 0xb5, 0xd5, 0x76, 0x8b, 0x16, 0x61, 0xfb, 
+  0x98, 0x4e, 0x47, 0xb3, 0xc9, 0xaa, 0xe7, 0xe3, 0xb7, 0x37, 0x0a, 0x9e, 0xa6, 0xd3, 0x67, 0xb3, 
+  0xb0, 0x97, 0xb2, 0x4e, 0x1e, 0x3b, 0x09, 0x76, 0x08, 0x65, 0x34, 0x17, 0x30, 0x9f, 0x88, 0xf3, 
+  0x32, 0x5a, 0xd1, 0x15, 0xa1, 0x67, 0x84, 0x3e, 0x13, 0x09, 0x2b, 0x15, 0x0a, 0xc9, 0xb0, 0xe0, 
+  0x26, 0x68, 0x6c, 0x84, 0x88, 0xab, 0xf9, 0x40, 0x4f, 0x31, 0xde, 0xa1, 0x58, 0x56, 0x11, 0xd6, 
+  0x56, 0x27, 0xcb, 0xf1, 0x0a, 0xc1, 0x27, 0x20, 0x17, 0xae, 0x66, 0x1a, 0xb4, 0x8d, 0x33, 0xb2, 
+  0x0b, 0xd0, 0xa2, 0x9c, 0xf8, 0x16, 0x66, 0x31, 0x96, 0x39, 0xc2, 0x71, 0x28, 0xa4, 0x90, 0x3b, 
+  0xc0, 0xbb, 0xdd, 0x32, 0x63, 0x86, 0xb7, 0xf0, 0x8a, 0xae, 0x57, 0x12, 0x71, 0x22, 0x30, 0xde, 
+  0x2f, 0x79, 0x73, 0xbf, 0x24, 0x92, 0x8d, 0x87, 0x54, 0xbd, 0xfe, 0x26, 0x22, 0x5e, 0xd7, 0x1c, 
+  0x05, 0xc5, 0x10, 0x4b, 0xf2, 0xa0, 0xb1, 0x8b, 0x8a, 0x28, 0xb1, 0xae, 0x1f, 0x82, 0x3e, 0x28, 
+  0x38, 0x7c, 0x06, 0xc2, 0x93, 0x10, 0x17, 0x77, 0x91, 0x2d, 0xee, 0x6b, 0x89, 0x42, 0xe2, 0x86, 
+  0xff, 0x19, 0xe1, 0x25, 0x82, 0x3f, 0x05, 0x2d, 0x99, 0xd3, 0x7f, 0x91, 0x1d, 0x4a, 0x42, 0x99, 
+  0x21, 0xb0, 0xb0, 0x9e, 0x80, 0x0d, 0xa7, 0xa5, 0xf5, 0x2e, 0x70, 0xa8, 0x81, 0xb4, 0x19, 0x68, 
+  0x3a, 0xda, 0xc0, 0xbc, 0x31, 0x54, 0x65, 0x3a, 0xce, 0x24, 0xa9, 0x27, 0x42, 0xf1, 0x80, 0xce, 
+  0x5c, 0x81, 0x23, 0x56, 0x0a, 0x74, 0x5a, 0x15, 0xbb, 0x14, 0xea, 0x58, 0x07, 0x1f, 0x72, 0x4c, 
+  0x87, 0xd5, 0xac, 0x31, 0x85, 0x78, 0x73, 0xc8, 0xe2, 0xb7, 0xb8, 0xca, 0xee, 0x5a, 0xb6, 0x9d, 
+  0xa1, 0x51, 0x60, 0x37, 0xc5, 0x55, 0xb2, 0x90, 0x87, 0xcb, 0xe0, 0x54, 0x36, 0xbb, 0xbc, 0x5c, 
+  0xb5, 0xd1, 0x2f, 0x0f, 0xc9, 0xc2, 0x65, 0xec, 0x1e, 0x62, 0x4e, 0xb4, 0x85, 0x26, 0x1a, 0xf6, 
+  0xb5, 0x05, 0x36, 0x1a, 0x30, 0xd7, 0x4d, 0xa2, 0x99, 0xe8, 0x56, 0x26, 0x67, 0xea, 0xd7, 0x7c, 
+  0x68, 0x6e, 0xd5, 0xb7, 0x3b, 0x4b, 0x1a, 0xe6, 0x52, 0x49, 0xd6, 0x26, 0x14, 0xd1, 0x96, 0x83, 
+  0x13, 0x71, 0xb6, 0xef, 0x15, 0xbd, 0xaa, 0x3b, 0xf2, 0xd4, 0x8d, 0xc9, 0x02, 0x2a, 0xb3, 0xc4, 
+  0xe7, 0x4f, 0xb6, 0xbf, 0xdd, 0x64, 0x8b, 0xcd, 0x4a, 0x3e, 0xd9, 0x9e, 0x1f, 0x53, 0x5d, 0xbf, 
+  0xc7, 0xb7, 0xf1, 0x56, 0xce, 0x6f, 0xe2, 0xa0, 0x98, 0xe7, 0xc9, 0xba, 0xa4, 0x72, 0x50, 0x8e, 
+  0xa9, 0xb8, 0x66, 0xe1, 0x74, 0x24, 0x3c, 0x93, 0x8b, 0xe7, 0x66, 0xb3, 0x2a, 0x93, 0x35, 0x35, 
+  0xf4, 0x91, 0xb9, 0xfa, 0x08, 0x5e, 0x87, 0x55, 0x16, 0x1e, 0xb8, 0x74, 0xc8, 0x78, 0xa1, 0x3e, 
+  0x62, 0x27, 0x4b, 0xf5, 0x5e, 0x5f, 0xce, 0xc4, 0x3c, 0x5b, 0x85, 0xd3, 0x67, 0xf6, 0xe5, 0x09, 
+  0xdd, 0x5f, 0xe6, 0xd9, 0x66, 0xad, 0x8a, 0xd9, 0x3b, 0xe7, 0x8b, 0x32, 0xaf, 0x7d, 0x50, 0x02, 
+  0x90, 0x75, 0xa5, 0x7c, 0xe9, 0x16, 0xa5, 0x86, 0x9f, 0x37, 0x8b, 0x9e, 0x94, 0xb9, 0x2e, 0x9e, 
+  0x7f, 0xd6, 0xf2, 0xcd, 0x5b, 0xed, 0xc4, 0x17, 0x4e, 0x87, 0x88, 0x46, 0xe9, 0x79, 0x33, 0x07, 
+  0x7f, 0x2c, 0xdc, 0x2c, 0xa8, 0x56, 0x30, 0x8f, 0xde, 0x93, 0x14, 0x72, 0x72, 0x20, 0xaf, 0x5f, 
+  0xc9, 0xb1, 0x5c, 0x82, 0xd0, 0xf9, 0xbc, 0x99, 0x51, 0x67, 0xd2, 0x92, 0x64, 0xc7, 0x7c, 0x46, 
+  0xc8, 0xaa, 0xa1, 0x25, 0x53, 0x3e, 0x60, 0x13, 0x6b, 0x31, 0x29, 0xe1, 0x0c, 0x13, 0xa6, 0xb5, 
+  0xfc, 0x9a, 0xcd, 0xa0, 0x5e, 0x4e, 0x80, 0x12, 0x84, 0xd1, 0xe0, 0x70, 0x19, 0x6a, 0x23, 0x22, 
+  0x86, 0x86, 0xf0, 0x2e, 0x57, 0xd9, 0x45, 0xbc, 0xc2, 0x29, 0x94, 0xc7, 0x3e, 0xb5, 0x0a, 0xa1, 
+  0x95, 0xcd, 0x77, 0x41, 0xb0, 0x5b, 0x13, 0x15, 0x5f, 0x97, 0xbc, 0x5e, 0x91, 0xba, 0xa6, 0x26, 
+  0x09, 0x72, 0x06, 0x3c, 0xc7, 0x78, 0x54, 0x2e, 0xb3, 0xac, 0xc4, 0x85, 0x59, 0x57, 0xbe, 0x8e, 
+  0xd5, 0x49, 0xd0, 0x9a, 0x0f, 0xfb, 0xe3, 0x05, 0x7f, 0x71, 0xc5, 0xb7, 0x0b, 0x06, 0xf1, 0x5b, 
+  0x29, 0x2e, 0xa5, 0xb8, 0x01, 0x34, 0x6f, 0xbb, 0x7f, 0x99, 0x9c, 0xdf, 0xf5, 0xc6, 0xc7, 0x63, 
+  0x37, 0x68, 0x55, 0x7b, 0x4c, 0x21, 0x37, 0x8d, 0xb7, 0x46, 0x6d, 0x06, 0x33, 0xbe, 0xca, 0xe3, 
+  0x4b, 0xc6, 0x71, 0x81, 0x0a, 0x29, 0xb3, 0xa0, 0x69, 0xb8, 0xaa, 0xa6, 0x61, 0x71, 0x42, 0xff, 
+  0x29, 0x0b, 0x7e, 0x8e, 0x39, 0xb4, 0x00, 0xd2, 0x1c, 0x72, 0x92, 0x91, 0xe6, 0x09, 0x01, 0x09, 
+  0x34, 0x66, 0xb6, 0xd7, 0x22, 0x73, 0x82, 0xf2, 0x64, 0xb3, 0x30, 0xab, 0x0e, 0x06, 0xe0, 0x7a, 
+  0xc7, 0x5e, 0xd1, 0x81, 0x63, 0x4a, 0xb8, 0xac, 0x67, 0x98, 0x6a, 0xba, 0xff, 0x2e, 0x92, 0x5b, 
+  0x95, 0x3b, 0xc8, 0x5f, 0x69, 0xca, 0x9d, 0x41, 0x65, 0xa8, 0x60, 0x32, 0xd8, 0x8f, 0xe9, 0xbe, 
+  0xa1, 0x29, 0x23, 0x24, 0xbb, 0xdd, 0xd2, 0xcc, 0x19, 0x20, 0x16, 0xb1, 0xe3, 0x47, 0x8b, 0x9c, 
+  0xe0, 0xbd, 0xb3, 0xc1, 0x55, 0x79, 0xb3, 0xfa, 0x3e, 0x97, 0xda, 0x82, 0x35, 0x0b, 0x7a, 0xc8, 
+  0xc3, 0x4d, 0x64, 0x6f, 0x03, 0xef, 0xb5, 0x15, 0x0b, 0xf5, 0x10, 0xf2, 0x4d, 0xe8, 0xe0, 0x71, 
+  0x35, 0xbe, 0xb8, 0x96, 0xe7, 0x9d, 0x73, 0x80, 0x3b, 0x86, 0xc0, 0x6e, 0x78, 0x4e, 0x22, 0x63, 
+  0x3a, 0xb8, 0x8e, 0xb6, 0x07, 0xd3, 0x83, 0x83, 0xcf, 0x27, 0x7b, 0xa2, 0x66, 0x1a, 0xaf, 0x2f, 
+  0x1b, 0x5f, 0x61, 0x29, 0xc6, 0x59, 0xb4, 0x9e, 0x2e, 0x4c, 0x30, 0x85, 0x9c, 0xc3, 0xf9, 0x54, 
+  0xa6, 0x77, 0x19, 0xce, 0x32, 0x12, 0x1b, 0x21, 0xc8, 0x99, 0xe4, 0x79, 0xe4, 0x70, 0x94, 0x8d, 
+  0x88, 0x0d, 0x08, 0x02, 0x1b, 0x47, 0xd4, 0x70, 0x7d, 0xd2, 0x41, 0xb1, 0x14, 0x8e, 0xf3, 0x38, 
+  0x76, 0x14, 0xe7, 0x9f, 0x15, 0x2a, 0x0d, 0xf1, 0x8a, 0x7b, 0x12, 0x4f, 0x57, 0xdc, 0x93, 0xa5, 
+  0x59, 0x41, 0x13, 0x38, 0xd0, 0x0b, 0xac, 0xb3, 0x66, 0x56, 0xa5, 0x7a, 0xdc, 0xdd, 0xca, 0xe8, 
+  0xf4, 0x20, 0xb4, 0xd5, 0xda, 0x3e, 0x3d, 0xb0, 0xe0, 0xfe, 0x65, 0x55, 0x45, 0x33, 0x6b, 0x59, 
+  0xd0, 0x9e, 0xb4, 0x8c, 0x71, 0x3e, 0xd2, 0x6e, 0xc9, 0xc6, 0x7b, 0x93, 0xb9, 0x4d, 0x78, 0x55, 
+  0x0e, 0xb7, 0xbd, 0x42, 0x3a, 0x95, 0x19, 0xa6, 0xe0, 0xb6, 0x9e, 0xf5, 0xec, 0x12, 0x69, 0x51, 
+  0x54, 0x64, 0xcb, 0xd3, 0x15, 0x91, 0xe8, 0xe8, 0x16, 0xa1, 0xd8, 0xe9, 0x82, 0xd7, 0x90, 0x88, 
+  0x65, 0xe3, 0xce, 0x02, 0x8d, 0x89, 0x86, 0x89, 0x0a, 0x5d, 0x47, 0x6e, 0x2c, 0x36, 0xf1, 0x0e, 
+  0xf1, 0x67, 0xef, 0x08, 0xe3, 0x9a, 0x6b, 0x8f, 0xda, 0x48, 0x33, 0x6e, 0xe0, 0x54, 0x7d, 0x16, 
+  0x75, 0x3a, 0x7b, 0x2d, 0x55, 0x75, 0xbb, 0x5e, 0xd6, 0x8c, 0x20, 0x2e, 0x30, 0x61, 0xcd, 0xfc, 
+  0xb3, 0x77, 0xa0, 0x6c, 0xd7, 0xf2, 0xfe, 0x58, 0xbc, 0xd3, 0x24, 0xf2, 0x26, 0xdb, 0x14, 0x72, 
+  0xbb, 0xce, 0x12, 0x1c, 0xa6, 0x6f, 0xe7, 0xca, 0x81, 0x96, 0xca, 0x6e, 0xb6, 0x0b, 0x5a, 0x21, 
+  0xfa, 0x93, 0xad, 0x83, 0xed, 0x7c, 0x95, 0xcc, 0xaf, 0x8f, 0xc5, 0x1b, 0xfe, 0x66, 0xfa, 0xdb, 
+  0x80, 0x04, 0x24, 0x08, 0x5d, 0x03, 0x7f, 0xd0, 0x0b, 0x48, 0xc2, 0xaa, 0xf0, 0xce, 0xb5, 0x74, 
+  0x63, 0xee, 0xdb, 0xc7, 0xa7, 0xce, 0x63, 0x27, 0x31, 0xf5, 0x99, 0xd4, 0xe6, 0x41, 0x1a, 0x50, 
+  0x4e, 0xeb, 0x51, 0x4e, 0x1d, 0x45, 0x70, 0xf5, 0xcd, 0x6b, 0x07, 0xb3, 0x99, 0xb8, 0xcc, 0x84, 
+  0xd5, 0x1a, 0xa7, 0x94, 0x46, 0x81, 0x59, 0x6a, 0xd4, 0x52, 0x90, 0x20, 0xb3, 0xef, 0xfa, 0xca, 
+  0xfa, 0x37, 0x12, 0x69, 0x52, 0x91, 0x5a, 0x09, 0xb6, 0x0c, 0xb8, 0x85, 0x82, 0x5b, 0x28, 0x09, 
+  0x75, 0x88, 0xcc, 0x61, 0x9b, 0x60, 0x21, 0xa1, 0x8e, 0x45, 0x55, 0x98, 0x14, 0xe8, 0xb6, 0xa1, 
+  0x28, 0x82, 0xae, 0xc9, 0x54, 0x11, 0xea, 0x17, 0xd0, 0x16, 0x35, 0x0f, 0x68, 0x52, 0x94, 0xce, 
+  0xa9, 0xb4, 0x29, 0xab, 0x6f, 0x9d, 0x1e, 0xe8, 0xe0, 0xda, 0x49, 0x90, 0x44, 0xa7, 0xd2, 0x6e, 
+  0xe3, 0x4e, 0x95, 0x6d, 0xc4, 0x0d, 0x0d, 0x9f, 0xb1, 0x40, 0x91, 0x08, 0xaa, 0xa6, 0x45, 0x71, 
+  0x70, 0x46, 0x9b, 0x2b, 0x5b, 0x42, 0x5f, 0x27, 0xe2, 0x76, 0xb3, 0xbe, 0x5d, 0x30, 0xb8, 0xc4, 
+  0x89, 0x5f, 0xcc, 0x3f, 0x1c, 0x34, 0x8e, 0xef, 0xcf, 0xf8, 0x87, 0xb0, 0x3d, 0xd2, 0x34, 0xec, 
+  0xab, 0x30, 0x10, 0x14, 0xb3, 0x54, 0x26, 0x39, 0x4a, 0xa5, 0x92, 0xd0, 0x64, 0x41, 0x13, 0xbc, 
+  0xd3, 0xef, 0xa2, 0x07, 0x45, 0x05, 0x91, 0x9e, 0xa4, 0x66, 0x7c, 0x5d, 0x0a, 0xd9, 0x12, 0xef, 
+  0x46, 0x51, 0x24, 0xb1, 0x16, 0x3a, 0x0a, 0x9d, 0x16, 0x10, 0x54, 0xce, 0x24, 0x15, 0x7a, 0x0d, 
+  0x11, 0x76, 0x91, 0xf8, 0x24, 0x67, 0x29, 0x83, 0x28, 0x50, 0x1a, 0x98, 0x27, 0x48, 0x21, 0x6d, 
+  0x9d, 0xf1, 0x59, 0x4d, 0x77, 0xc0, 0xfd, 0xea, 0x42, 0xf2, 0xd9, 0xb2, 0x19, 0x6b, 0xda, 0x18, 
+  0x2b, 0xa4, 0x81, 0x4b, 0xd5, 0xff, 0x02, 0x02, 0x41, 0x75, 0xc7, 0xc1, 0x0a, 0x69, 0xa2, 0x2f, 
+  0x75, 0x93, 0x1c, 0x5e, 0xcf, 0xde, 0xb5, 0x4d, 0xbd, 0xe5, 0x5e, 0xce, 0xd0, 0x1b, 0x35, 0x5f, 
+  0x04, 0x0b, 0x97, 0x97, 0x32, 0xe7, 0xb4, 0xe0, 0x2a, 0x14, 0xea, 0xc4, 0xbc, 0x02, 0x97, 0xce, 
+  0x6e, 0xec, 0x26, 0x84, 0x9a, 0x63, 0xb1, 0xa3, 0x13, 0xa7, 0x42, 0xe2, 0xf5, 0x65, 0xe4, 0x2b, 
+  0x34, 0xeb, 0x9e, 0x97, 0x81, 0xf2, 0x59, 0x93, 0x7b, 0x3e, 0x2c, 0x8b, 0x6e, 0x11, 0xce, 0xfe, 
+  0x8d, 0xa6, 0x90, 0x12, 0x61, 0x7c, 0x54, 0x24, 0x95, 0xd1, 0x8c, 0x48, 0xba, 0x5f, 0x10, 0x6d, 
+  0x53, 0xb5, 0xe8, 0xc8, 0x1e, 0x03, 0x13, 0xda, 0x23, 0x10, 0x0b, 0x9a, 0xdf, 0x65, 0x64, 0xfa, 
+  0xc5, 0x41, 0x11, 0xe2, 0x15, 0x11, 0x7b, 0x78, 0xc4, 0x10, 0x1d, 0xf2, 0x93, 0xc9, 0x72, 0x00, 
+  0x15, 0xe7, 0x25, 0x08, 0x17, 0x22, 0x3c, 0x2d, 0x07, 0x17, 0x34, 0xd7, 0x3a, 0x6a, 0xfb, 0x42, 
+  0x1c, 0xfc, 0x76, 0x15, 0x55, 0xfa, 0x65, 0x0e, 0x0d, 0xb5, 0x10, 0x19, 0x4d, 0x08, 0xd7, 0x71, 
+  0xab, 0x0e, 0x61, 0x72, 0xa1, 0x57, 0x34, 0x4c, 0x05, 0xd6, 0x24, 0x54, 0x2b, 0x24, 0xcc, 0xda, 
+  0x86, 0x89, 0x70, 0xdd, 0xfc, 0x43, 0x5e, 0xe9, 0x03, 0x31, 0x00, 0xcc, 0xf1, 0x92, 0x00, 0x22, 
+  0xa7, 0xc9, 0x9d, 0xcb, 0xf0, 0x4a, 0x87, 0x2d, 0x19, 0xb0, 0xae, 0x84, 0x16, 0x74, 0x4d, 0xe4, 
+  0x9d, 0xd9, 0x18, 0x5f, 0x5f, 0xc2, 0x26, 0xdd, 0x8e, 0xee, 0x34, 0xdb, 0xa4, 0x08, 0x1c, 0xba, 
+  0x04, 0x65, 0xd8, 0xac, 0x91, 0x47, 0x1e, 0xa1, 0xea, 0xd5, 0x9d, 0xb1, 0x55, 0xa0, 0x2e, 0x8b, 
+  0x18, 0x71, 0x53, 0xf6, 0xec, 0x2f, 0x60, 0xf0, 0xbf, 0x67, 0x93, 0xb1, 0xa0, 0xc2, 0x01, 0xd5, 
+  0x48, 0x2f, 0x30, 0xcf, 0xf8, 0x35, 0x35, 0xad, 0x90, 0x5c, 0x51, 0x8f, 0xdf, 0x40, 0x68, 0xfd, 
+  0x41, 0xa4, 0xa6, 0x03, 0x62, 0x7c, 0x15, 0x94, 0x6f, 0x5d, 0xef, 0x6f, 0xaf, 0x27, 0x86, 0x54, 
+  0x55, 0xa8, 0x59, 0x8c, 0x15, 0x6b, 0xf5, 0x79, 0x39, 0xd4, 0x86, 0xc4, 0x20, 0x59, 0x9e, 0x6b, 
+  0x39, 0xec, 0xfd, 0xb0, 0x8d, 0x59, 0x1d, 0x9d, 0x75, 0xbb, 0x5a, 0xd1, 0xac, 0xb6, 0x29, 0xcb, 
+  0xb6, 0x76, 0xff, 0x28, 0xbc, 0x3b, 0xc7, 0x31, 0x0e, 0xf3, 0xe6, 0xef, 0x01, 0x59, 0xaa, 0xa0, 
+  0x01, 0xb5, 0xe5, 0xbf, 0x04, 0xb5, 0xaa, 0xb9, 0x83, 0xc0, 0xc7, 0xcb, 0x1b, 0xf9, 0xf9, 0xe3, 
+  0xc0, 0xcb, 0xa9, 0x0e, 0x90, 0x97, 0x92, 0x33, 0x0c, 0x35, 0x92, 0xb8, 0x9c, 0x9f, 0x0f, 0x02, 
+  0xaf, 0x67, 0x60, 0x88, 0xee, 0x88, 0x02, 0x0e, 0x9e, 0x9e, 0x43, 0xed, 0x88, 0xd3, 0x0f, 0x1f, 
+  0x57, 0x48, 0xeb, 0x82, 0xd3, 0xb6, 0x46, 0x0c, 0xc6, 0x15, 0x87, 0x60, 0x14, 0xf0, 0xe7, 0xb8, 
+  0xed, 0x20, 0xe2, 0x92, 0x01, 0x7c, 0x22, 0x3d, 0xe0, 0x97, 0xb0, 0xaa, 0xfc, 0x5c, 0x2d, 0x7b, 
+  0x41, 0xa0, 0xa6, 0xd3, 0xcb, 0xad, 0x06, 0x16, 0x7c, 0xa9, 0x83, 0x04, 0x53, 0x39, 0x97, 0x2b, 
+  0x6c, 0x6a, 0x3a, 0xdf, 0x7b, 0xca, 0x39, 0x91, 0x91, 0x98, 0xb2, 0x7a, 0x0e, 0x90, 0xb6, 0x10, 
+  0x92, 0xc1, 0xa7, 0xc3, 0xfd, 0xa6, 0x01, 0x32, 0xfd, 0x3e, 0x01, 0xa4, 0x02, 0x07, 0xf8, 0xae, 
+  0xa8, 0x2b, 0x73, 0x6c, 0xb1, 0x22, 0x96, 0x34, 0xa6, 0xfe, 0xac, 0xab, 0x73, 0x32, 0x70, 0xa7, 
+  0x71, 0xbe, 0x20, 0x4e, 0xd2, 0x6e, 0x09, 0xf3, 0xc0, 0x7c, 0x75, 0x25, 0x1c, 0x4c, 0x79, 0xe6, 
+  0x5a, 0x94, 0xd1, 0xcb, 0x45, 0xf5, 0xd2, 0x1c, 0x96, 0xf0, 0x36, 0xac, 0xa2, 0xcd, 0x2e, 0xa0, 
+  0x76, 0xdc, 0x04, 0x66, 0x2d, 0xed, 0x11, 0xc4, 0xa2, 0x07, 0xa0, 0x60, 0x30, 0xc5, 0x09, 0x5e, 
+  0xf3, 0x9c, 0x7d, 0xc3, 0x10, 0x69, 0x4b, 0x7b, 0xaa, 0x91, 0x23, 0x05, 0x90, 0x1e, 0xce, 0xf5, 
+  0x0d, 0x9a, 0x6d, 0x8f, 0xf0, 0x60, 0x94, 0x5e, 0x16, 0x88, 0x96, 0xc9, 0x3b, 0xd0, 0xce, 0x0d, 
+  0xeb, 0x8d, 0x15, 0xa3, 0xdd, 0x3c, 0x9b, 0x60, 0xac, 0xac, 0xa9, 0x15, 0x87, 0x2c, 0x30, 0xad, 
+  0xb1, 0x07, 0xe1, 0xb4, 0x50, 0x31, 0xa3, 0x18, 0xae, 0x56, 0x7b, 0xc0, 0x69, 0xdf, 0x6a, 0xcd, 
+  0x2c, 0x84, 0x8d, 0x88, 0xc8, 0x69, 0x34, 0x1a, 0x97, 0x7b, 0x27, 0x97, 0x1c, 0xd3, 0x61, 0x03, 
+  0x3b, 0x4f, 0xfb, 0x46, 0xa7, 0x89, 0x2c, 0x2a, 0x98, 0xe6, 0xa0, 0xf5, 0x4a, 0xcf, 0x4f, 0xe0, 
+  0xb0, 0xce, 0xe5, 0x4b, 0x3d, 0x62, 0x02, 0x8f, 0x11, 0x83, 0x8e, 0xf3, 0xcc, 0xf1, 0xfe, 0x2d, 
+  0xac, 0x08, 0x66, 0xfa, 0xa8, 0x11, 0x4f, 0xe1, 0x16, 0x12, 0x73, 0x15, 0x61, 0x82, 0xb8, 0x8d, 
+  0x78, 0x4a, 0xdd, 0x81, 0x4f, 0x01, 0x41, 0x6a, 0x52, 0xc0, 0x70, 0x27, 0xbe, 0xe4, 0x40, 0xf8, 
+  0xaf, 0xcb, 0x8c, 0x78, 0x65, 0x98, 0x20, 0x32, 0xd9, 0x2e, 0xa0, 0xd5, 0x85, 0x5e, 0x4c, 0x77, 
+  0x2d, 0x19, 0x50, 0x57, 0x6f, 0x04, 0xe2, 0x66, 0xfb, 0x88, 0x9b, 0x6a, 0x9a, 0x99, 0xa6, 0x4e, 
+  0x75, 0x5f, 0xdd, 0xdc, 0xc8, 0x45, 0x82, 0x0c, 0x68, 0xad, 0xf5, 0x16, 0x83, 0xdc, 0xee, 0x0a, 
+  0xfe, 0xa2, 0xba, 0x35, 0xe2, 0x88, 0xbb, 0x6b, 0xfc, 0x42, 0xb7, 0x42, 0x60, 0x12, 0x65, 0x82, 
+  0x66, 0x8b, 0xd0, 0x17, 0x71, 0x0c, 0xf8, 0xa9, 0x8c, 0x60, 0x90, 0x26, 0xc5, 0x6f, 0x2e, 0x50, 
+  0x66, 0x77, 0xea, 0x4c, 0x79, 0x84, 0xaa, 0x8a, 0x60, 0x3e, 0xab, 0x3b, 0x1e, 0x68, 0x8a, 0xad, 
+  0xc7, 0xb5, 0xe1, 0xf0, 0xfb, 0xe0, 0xcc, 0xa8, 0xd5, 0x5c, 0x16, 0xc4, 0x91, 0x47, 0xac, 0x9e, 
+  0x54, 0xde, 0xc7, 0x70, 0xf2, 0x54, 0x7c, 0xba, 0x8f, 0xd8, 0x8e, 0x38, 0x21, 0x74, 0x86, 0xe8, 
+  0x3b, 0xe6, 0x68, 0xb4, 0x50, 0x59, 0x51, 0x9a, 0x95, 0xe2, 0x08, 0x78, 0xce, 0x7d, 0x6d, 0xe5, 
+  0x84, 0x69, 0x89, 0x0d, 0x57, 0xd4, 0x74, 0x86, 0x8f, 0x46, 0xb6, 0x54, 0x2e, 0x7d, 0x65, 0x1d, 
+  0x0d, 0x70, 0x48, 0x6b, 0x95, 0xf5, 0x00, 0x40, 0xb5, 0xe9, 0x76, 0xe7, 0xee, 0x09, 0x38, 0x52, 
+  0x47, 0x91, 0x10, 0xe0, 0x86, 0x71, 0x1f, 0x21, 0xa8, 0x84, 0x0a, 0x15, 0xaf, 0x4d, 0xef, 0x10, 
+  0x91, 0x8f, 0xe3, 0x63, 0xcc, 0xa3, 0x79, 0xcd, 0x9b, 0x96, 0xd5, 0x74, 0x3a, 0x92, 0x90, 0x5b, 
+  0xad, 0xa9, 0xb5, 0x53, 0x05, 0x9f, 0xef, 0x60, 0x35, 0xe6, 0x36, 0x3d, 0xb3, 0x06, 0x4c, 0xed, 
+  0xe4, 0x4f, 0xa8, 0x5c, 0x85, 0x5c, 0xdf, 0xb0, 0x4a, 0xc6, 0x6a, 0x7a, 0xe2, 0x69, 0x82, 0x15, 
+  0xe4, 0x00, 0x8d, 0x16, 0xd3, 0x99, 0x7c, 0x9d, 0x31, 0x42, 0xdb, 0xe6, 0x35, 0xee, 0x80, 0x1d, 
+  0xd7, 0x7c, 0x15, 0xb0, 0x41, 0x9f, 0xcb, 0xfb, 0xf3, 0x40, 0x87, 0x92, 0xd1, 0xcf, 0x75, 0x32, 
+  0xcd, 0xb9, 0xa5, 0x54, 0x84, 0xda, 0x39, 0xfb, 0x61, 0x66, 0x63, 0xa3, 0x67, 0x16, 0x2b, 0x6a, 
+  0x4f, 0xbf, 0x07, 0x40, 0x41, 0x38, 0xaf, 0xd6, 0x21, 0xdb, 0xd9, 0xa3, 0xfa, 0xb9, 0xda, 0x97, 
+  0x9b, 0x93, 0xf2, 0xbd, 0x5f, 0x19, 0xef, 0xb1, 0x0d, 0xec, 0x62, 0x0b, 0x66, 0xa1, 0x01, 0x27, 
+  0x35, 0x36, 0x3a, 0x78, 0x68, 0xb7, 0x9d, 0x3b, 0x1b, 0x30, 0xa2, 0xad, 0x0c, 0xf8, 0x88, 0xb0, 
+  0x3f, 0x90, 0x3c, 0x77, 0x23, 0x8d, 0xd9, 0x5c, 0xd3, 0x8c, 0x8e, 0xcd, 0xd9, 0x38, 0x06, 0x89, 
+  0xab, 0x72, 0xd5, 0xe6, 0x11, 0xd8, 0x00, 0x49, 0x0a, 0x7d, 0x96, 0x9b, 0x48, 0xb1, 0xed, 0x5d, 
+  0xed, 0xe4, 0xe6, 0xd1, 0xcf, 0xf7, 0xdf, 0x10, 0x26, 0x6b, 0x9a, 0xf1, 0x1d, 0x1a, 0x9f, 0x96, 
+  0x38, 0xde, 0x33, 0xa4, 0xbb, 0x3c, 0x29, 0xcd, 0xb5, 0xb2, 0x1e, 0x54, 0x01, 0xec, 0xe1, 0x3c, 
+  0xd7, 0x1e, 0x35, 0x61, 0x6a, 0xad, 0x21, 0x67, 0x13, 0x19, 0x72, 0x86, 0xce, 0x81, 0x26, 0x59, 
+  0xf0, 0x1d, 0x57, 0x18, 0x21, 0x7c, 0x80, 0x51, 0x2d, 0x32, 0xdc, 0x7c, 0xbe, 0xb9, 0xd0, 0x46, 
+  0x88, 0x3a, 0x73, 0xc7, 0x83, 0x66, 0xef, 0x5b, 0x66, 0x01, 0x62, 0x00, 0x67, 0x42, 0x50, 0x71, 
+  0x13, 0x50, 0xbc, 0x36, 0x15, 0x4b, 0x95, 0xb9, 0x43, 0x20, 0x57, 0x73, 0x8d, 0x3d, 0xf1, 0xf8, 
+  0x0d, 0x89, 0xae, 0x3b, 0x71, 0xb1, 0xda, 0xe4, 0x8f, 0xb5, 0x11, 0xd5, 0xda, 0x40, 0xe9, 0x5a, 
+  0x13, 0x78, 0x70, 0xb8, 0x85, 0x6c, 0x53, 0x7a, 0x38, 0x85, 0xa6, 0xad, 0x78, 0xa8, 0x0d, 0xcf, 
+  0xe8, 0xd2, 0xf9, 0x84, 0x1c, 0x55, 0x2a, 0x24, 0xa0, 0xcc, 0x1c, 0xf1, 0x25, 0x34, 0xad, 0x8a, 
+  0x06, 0x1a, 0xbd, 0x8c, 0xdb, 0x01, 0x2e, 0xa2, 0x7b, 0x60, 0xb5, 0xc9, 0xed, 0xbe, 0xf1, 0x1a, 
+  0x0b, 0x09, 0x2f, 0x66, 0xa2, 0x7d, 0x21, 0x09, 0x01, 0xc8, 0x4d, 0xaa, 0x66, 0xde, 0x45, 0x83, 
+  0x75, 0x32, 0x5e, 0xe9, 0x8b, 0x15, 0x3a, 0x84, 0xa7, 0x46, 0x0d, 0xc8, 0xd8, 0x28, 0xb0, 0xf6, 
+  0x64, 0xa0, 0x1a, 0x65, 0xa5, 0x89, 0xfd, 0x8e, 0xda, 0xdc, 0x29, 0x9b, 0x7c, 0xcb, 0xb5, 0xec, 
+  0x45, 0x06, 0x92, 0x6d, 0x56, 0xf2, 0x68, 0xb0, 0xcd, 0x78, 0x5e, 0xd9, 0x78, 0x69, 0x68, 0xda, 
+  0xcf, 0x53, 0xdc, 0xe1, 0x59, 0xab, 0x45, 0xc9, 0x51, 0x45, 0xab, 0xa0, 0x97, 0x2e, 0x30, 0xc2, 
+  0x5a, 0x85, 0xbd, 0x50, 0x4a, 0x1b, 0x59, 0xa8, 0x3e, 0x28, 0x13, 0x64, 0x88, 0x8d, 0x77, 0x55, 
+  0x31, 0xf5, 0x20, 0x29, 0x34, 0xf1, 0xf9, 0x5e, 0x91, 0x22, 0xb9, 0x88, 0x6c, 0x74, 0x3e, 0xfb, 
+  0xc8, 0xe4, 0x12, 0x64, 0x3c, 0xdf, 0x7c, 0xa9, 0x69, 0x9b, 0x74, 0xe7, 0x6d, 0x72, 0x2d, 0xc3, 
+  0x53, 0xd3, 0xa4, 0x22, 0xf2, 0x66, 0x05, 0xbb, 0xdd, 0xe7, 0x8a, 0x5c, 0xf0, 0x9d, 0x9b, 0x76, 
+  0x5d, 0x3f, 0xa9, 0x48, 0x44, 0x68, 0x57, 0x5d, 0x41, 0x4b, 0x8d, 0x69, 0x90, 0xf5, 0x7b, 0x55, 
+  0x84, 0x23, 0x73, 0xca, 0x85, 0x2d, 0x52, 0xbb, 0xd7, 0xe7, 0x48, 0x6a, 0x0a, 0xe0, 0x4b, 0x6d, 
+  0x65, 0x4f, 0x63, 0xeb, 0xa1, 0xde, 0x27, 0x37, 0xf2, 0x75, 0x19, 0xdf, 0xac, 0x23, 0x35, 0xa3, 
+  0xe6, 0x76, 0xbb, 0x25, 0x11, 0x07, 0x26, 0x94, 0x77, 0xbe, 0x0e, 0x97, 0x52, 0x21, 0x07, 0x38, 
+  0xcd, 0x8b, 0x3d, 0x24, 0x1b, 0x3d, 0x38, 0xc1, 0x90, 0x42, 0xfd, 0x5a, 0xec, 0xcf, 0x38, 0xa6, 
+  0xaa, 0x8d, 0x5f, 0x52, 0xcf, 0x1f, 0x61, 0x7c, 0x54, 0x81, 0xd7, 0xc9, 0xcd, 0x86, 0x87, 0x09, 
+  0xaf, 0x88, 0x3a, 0x47, 0x11, 0xee, 0x99, 0xbd, 0xec, 0x83, 0xc6, 0xf8, 0x10, 0x1c, 0x5c, 0x4b, 
+  0x78, 0x36, 0x75, 0xf4, 0x6b, 0xdb, 0x0a, 0x67, 0xdc, 0x69, 0xf0, 0x2d, 0x84, 0x0b, 0xeb, 0x6c, 
+  0xcb, 0xbf, 0xd2, 0xf0, 0xfe, 0xb8, 0x1e, 0x6b, 0x7a, 0x8f, 0x3f, 0x52, 0x6d, 0xb7, 0xcd, 0xd2, 
+  0xbf, 0xd2, 0x89, 0x47, 0x66, 0xf9, 0x7d, 0xbd, 0x69, 0xfb, 0x54, 0x83, 0x48, 0x4b, 0x6f, 0x6d, 
+  0x24, 0x86, 0x87, 0x78, 0x55, 0xfe, 0x5d, 0xde, 0x83, 0x18, 0x5d, 0x30, 0xdd, 0xe0, 0xf8, 0x4d, 
+  0x73, 0x6c, 0xf7, 0x95, 0xa5, 0x60, 0x57, 0xf0, 0x62, 0x5a, 0xbc, 0xc9, 0x36, 0x1c, 0x2e, 0x1b, 
+  0x4f, 0xca, 0x7c, 0xa5, 0xbf, 0x5a, 0xc8, 0x32, 0x4e, 0x56, 0xb8, 0xe2, 0xc5, 0xf8, 0x9e, 0x84, 
+  0x70, 0xfe, 0xe8, 0x86, 0x9e, 0xeb, 0x22, 0xd4, 0xae, 0xfc, 0xc5, 0x5c, 0xfc, 0x8a, 0x0b, 0xb6, 
+  0x4e, 0xd3, 0x6f, 0x6f, 0x13, 0x79, 0xa7, 0x5b, 0xc9, 0xcd, 0xef, 0x29, 0xf6, 0x1d, 0x5d, 0x5f, 
+  0xab, 0x22, 0xf4, 0x63, 0x9e, 0xe8, 0xc4, 0x42, 0xf6, 0x4a, 0x75, 0x67, 0x95, 0x50, 0xd3, 0xbf, 
+  0x54, 0x97, 0xdc, 0x48, 0xb6, 0x5c, 0x12, 0xdd, 0xfe, 0xa5, 0xba, 0xe4, 0xa7, 0x5a, 0x9f, 0xfc, 
+  0xd5, 0xc2, 0xb9, 0x61, 0x7a, 0x83, 0x6e, 0xcd, 0x73, 0x29, 0xd3, 0x5f, 0xaa, 0x4b, 0xfe, 0x42, 
+  0xed, 0x7e, 0x67, 0xf4, 0x65, 0xa6, 0xd5, 0xc0, 0xea, 0xc6, 0x3e, 0xbf, 0xbb, 0x4a, 0xda, 0x04, 
+  0x38, 0xcb, 0x8a, 0x8e, 0x1b, 0x11, 0x45, 0xb9, 0x7c, 0xb7, 0x7b, 0x27, 0x8d, 0xdf, 0x16, 0xc7, 
+  0xdf, 0x9d, 0x68, 0x37, 0xc8, 0x81, 0x99, 0x88, 0x49, 0x75, 0x49, 0xb8, 0xc8, 0xce, 0x85, 0xfd, 
+  0xde, 0xb5, 0xf0, 0x7e, 0xd7, 0xa8, 0x6b, 0xd4, 0x2d, 0x11, 0xc6, 0x95, 0xfe, 0x3e, 0x0f, 0x3f, 
+  0xa6, 0xbf, 0xcf, 0xc2, 0x61, 0xa8, 0x3f, 0x54, 0x30, 0x60, 0xd4, 0xa5, 0x00, 0x8f, 0x2a, 0xdc, 
+  0x10, 0xab, 0xde, 0xb1, 0xff, 0xf2, 0xd0, 0xe3, 0x6b, 0xa2, 0x1c, 0xb9, 0x27, 0xf8, 0x72, 0x25, 
+  0xe3, 0x5b, 0x69, 0x1e, 0x13, 0x31, 0x35, 0x93, 0xa8, 0x8b, 0xeb, 0x3b, 0xf5, 0x81, 0xbe, 0xd1, 
+  0x9f, 0x98, 0x57, 0x4c, 0xd2, 0x1d, 0x62, 0x93, 0x54, 0x8a, 0x5b, 0x23, 0xde, 0xc8, 0x59, 0xf4, 
+  0x50, 0xe3, 0x06, 0x12, 0x61, 0xd4, 0x21, 0x74, 0xa9, 0xb8, 0xd1, 0xd6, 0x5c, 0xc3, 0x0d, 0x6c, 
+  0xcb, 0xa7, 0xa5, 0x56, 0xc6, 0x72, 0x83, 0x3d, 0xa6, 0x9a, 0x59, 0x80, 0x16, 0xa0, 0x1e, 0xf5, 
+  0x2b, 0xe5, 0xf8, 0xf1, 0x6a, 0x06, 0x89, 0x39, 0x37, 0x72, 0x16, 0xc9, 0x97, 0xb9, 0x55, 0x7a, 
+  0xb5, 0xaa, 0xac, 0x85, 0xfe, 0x26, 0x81, 0xeb, 0xc7, 0x9e, 0x09, 0x62, 0x2d, 0x1d, 0x96, 0xb1, 
+  0x3e, 0x32, 0x31, 0x7a, 0x8c, 0xcd, 0x9d, 0x7e, 0xbe, 0x13, 0x59, 0x2a, 0x3f, 0xb8, 0x38, 0xd2, 
+  0x99, 0x03, 0xc4, 0xc3, 0x47, 0xa2, 0x04, 0xca, 0x7d, 0x84, 0x89, 0x27, 0x76, 0x6a, 0x0c, 0x41, 
+  0xaf, 0xcd, 0x17, 0x62, 0x5c, 0x35, 0x24, 0x78, 0xa5, 0xb6, 0xcf, 0x2b, 0x31, 0x76, 0x52, 0xcd, 
+  0x50, 0xcf, 0x1b, 0x78, 0x3d, 0xe7, 0x55, 0xe8, 0x4c, 0x5e, 0x6e, 0x65, 0x1f, 0x61, 0x67, 0x51, 
+  0x61, 0x27, 0xf7, 0x7c, 0xa4, 0xe3, 0x7a, 0x99, 0xdb, 0xfc, 0x34, 0x0a, 0xb4, 0x2b, 0x97, 0xf3, 
+  0xca, 0x44, 0x93, 0xe3, 0xfc, 0xc3, 0x44, 0xd3, 0x9c, 0x91, 0x30, 0x13, 0xa0, 0x96, 0xf7, 0x54, 
+  0xc7, 0x13, 0x3b, 0x78, 0x48, 0x50, 0x33, 0x34, 0xa6, 0x79, 0x84, 0xd5, 0xa4, 0x8a, 0x3f, 0x0f, 
+  0x25, 0x8f, 0x0c, 0x14, 0x9a, 0xa6, 0xd1, 0x22, 0xe0, 0x0c, 0x72, 0x91, 0xd4, 0xc3, 0xef, 0x69, 
+  0x83, 0x8e, 0x6f, 0xd9, 0x6a, 0x63, 0xd2, 0xc1, 0xd1, 0xd8, 0xf6, 0x02, 0xe7, 0x54, 0xab, 0xad, 
+  0xbc, 0xb9, 0x20, 0x76, 0xe5, 0x2a, 0xdf, 0x26, 0x37, 0x97, 0x5b, 0x66, 0x39, 0xb7, 0xab, 0x24, 
+  0xbd, 0xde, 0x02, 0x27, 0x6e, 0x89, 0xb3, 0x88, 0x6f, 0x02, 0xff, 0xb0, 0xa1, 0xc7, 0x53, 0x15, 
+  0x0b, 0x32, 0x38, 0x3f, 0xfe, 0xec, 0xf8, 0x32, 0x11, 0x2f, 0xd1, 0x80, 0x3a, 0xf4, 0xdc, 0x9e, 
+  0xb0, 0xe5, 0xcc, 0xf6, 0x04, 0xb5, 0x1d, 0x27, 0xe2, 0x05, 0xbd, 0xd2, 0x27, 0x77, 0x08, 0x26, 
+  0x39, 0x09, 0xa7, 0xbf, 0x45, 0xb3, 0x6d, 0x44, 0xd7, 0xe6, 0x40, 0x6f, 0x00, 0xa3, 0x91, 0xef, 
+  0x70, 0x38, 0x46, 0x0f, 0x4f, 0x3a, 0x38, 0x1a, 0x9b, 0x9e, 0xbe, 0x7c, 0xf1, 0xe6, 0xc5, 0xf9, 
+  0x74, 0xdb, 0xef, 0x07, 0x5b, 0x3c, 0x98, 0x9d, 0xcf, 0x70, 0xfd, 0x19, 0x95, 0x78, 0xe2, 0x7a, 
+  0x73, 0xfc, 0x2e, 0x6b, 0x0e, 0x44, 0x2a, 0xf2, 0x13, 0x68, 0x02, 0x8e, 0x52, 0x5f, 0xfa, 0xfb, 
+  0x21, 0xc6, 0x4a, 0x37, 0x2c, 0x95, 0x57, 0xe6, 0x28, 0xc7, 0xb1, 0x45, 0x4d, 0x78, 0x2a, 0xdf, 
+  0x63, 0xd3, 0x02, 0x0f, 0x71, 0xd3, 0xb7, 0x5b, 0x27, 0xdc, 0xd1, 0x5b, 0x59, 0x73, 0x3e, 0xe3, 
+  0x5d, 0xe4, 0x2b, 0x3c, 0x78, 0x28, 0x11, 0x5b, 0xcf, 0x3b, 0x86, 0xd3, 0x2a, 0xf3, 0x90, 0x4e, 
+  0x4d, 0x7f, 0x38, 0x35, 0xb1, 0x0f, 0xc8, 0xb1, 0x32, 0x74, 0xac, 0x8e, 0x81, 0x6d, 0xf2, 0x90, 
+  0x4f, 0x10, 0x2a, 0xc2, 0x61, 0x45, 0xad, 0xad, 0x7b, 0x68, 0x98, 0xe5, 0xbd, 0x56, 0xdd, 0x96, 
+  0xbe, 0x96, 0x07, 0x73, 0x73, 0x8c, 0xb5, 0x3e, 0xa1, 0xac, 0x47, 0x26, 0xae, 0x6b, 0xa8, 0xfd, 
+  0xcc, 0x31, 0x34, 0x87, 0x6e, 0x56, 0x59, 0x71, 0xf0, 0xd1, 0xf7, 0x3c, 0xca, 0xac, 0xb6, 0xda, 
+  0x42, 0xa4, 0xd6, 0x48, 0xc6, 0x7a, 0xfb, 0x88, 0xb8, 0x3a, 0x02, 0x12, 0x73, 0x1d, 0x30, 0x10, 
+  0xe6, 0x21, 0x73, 0x02, 0xd5, 0xa6, 0x85, 0x48, 0xed, 0x60, 0x8c, 0xba, 0x8a, 0x32, 0xd0, 0x48, 
+  0x8c, 0x7f, 0xad, 0xf7, 0xa9, 0x88, 0x7e, 0x75, 0xfa, 0xb4, 0x89, 0xdc, 0xf0, 0x4b, 0x84, 0xe0, 
+  0xb4, 0x3f, 0x03, 0x94, 0x49, 0xce, 0xc1, 0xe7, 0x37, 0xd2, 0xb7, 0x87, 0x9e, 0x79, 0x74, 0xab, 
+  0x91, 0xe3, 0x74, 0x66, 0x02, 0x36, 0x01, 0x1b, 0x59, 0x9d, 0x3d, 0x9b, 0xeb, 0x59, 0xeb, 0xf7, 
+  0x75, 0xb4, 0xec, 0x8f, 0xc4, 0x22, 0x42, 0x26, 0x10, 0x71, 0x15, 0xdd, 0xfb, 0x0b, 0xd6, 0xd8, 
+  0x5f, 0x6d, 0xb7, 0xa3, 0x93, 0x65, 0x8b, 0x1b, 0x19, 0xf8, 0x7c, 0xf7, 0x84, 0xbb, 0xdb, 0x7d, 
+  0xa1, 0x29, 0xde, 0xa2, 0x92, 0x49, 0x1a, 0x3b, 0xde, 0xc9, 0x8f, 0x29, 0xff, 0xc0, 0x91, 0x00, 
+  0x54, 0xc5, 0x9c, 0xa3, 0x6b, 0xe1, 0x46, 0x19, 0x14, 0x25, 0x9b, 0x5a, 0x40, 0xd5, 0x25, 0xbe, 
+  0x91, 0xbe, 0xf6, 0x54, 0x01, 0x4e, 0xa0, 0x0e, 0x2d, 0xd9, 0x9e, 0xd8, 0x97, 0xc8, 0xdb, 0x93, 
+  0x0b, 0xa4, 0xf3, 0x6b, 0xd8, 0x2b, 0x10, 0xd3, 0x9b, 0xc2, 0x5c, 0xde, 0xdd, 0x02, 0x4a, 0x20, 
+  0xa9, 0x6c, 0x30, 0x2a, 0x45, 0x35, 0xf1, 0x80, 0x01, 0xe7, 0xa9, 0x30, 0x87, 0xc0, 0x11, 0xeb, 
+  0x37, 0xe1, 0x83, 0xc6, 0x26, 0x4b, 0x95, 0x91, 0xc3, 0x5b, 0x69, 0x53, 0x1c, 0x58, 0x83, 0xba, 
+  0x0d, 0x09, 0x0e, 0xd8, 0x19, 0x6b, 0x3e, 0xd7, 0x38, 0x53, 0x07, 0xef, 0xfe, 0x06, 0xee, 0xad, 
+  0x70, 0x5b, 0x2d, 0x20, 0x53, 0x28, 0x1b, 0x90, 0x98, 0xd8, 0x33, 0x7a, 0x61, 0xab, 0xc3, 0x01, 
+  0x8d, 0x8e, 0x9a, 0x3c, 0x5d, 0xc1, 0xdd, 0x74, 0xc5, 0xa3, 0x2b, 0x02, 0x75, 0x22, 0x12, 0x4f, 
+  0xe3, 0x2a, 0x34, 0x6b, 0x63, 0x80, 0xaa, 0x77, 0xb1, 0xf8, 0x43, 0xc2, 0x78, 0x15, 0xd6, 0x7d, 
+  0x85, 0xee, 0x4c, 0x8c, 0xaa, 0x8c, 0xbd, 0xc5, 0xc6, 0xb5, 0xb7, 0xe8, 0x58, 0x00, 0xdf, 0xd4, 
+  0x8d, 0x8f, 0x6a, 0xc6, 0xc4, 0x73, 0x01, 0xf5, 0x38, 0x7d, 0x59, 0xe4, 0x73, 0x5a, 0x72, 0x65, 
+  0xda, 0x06, 0x52, 0xe0, 0x56, 0xd6, 0x08, 0x4d, 0x7f, 0x36, 0x78, 0x2b, 0xa9, 0xa6, 0x9f, 0xf2, 
+  0x15, 0xaa, 0x32, 0xd7, 0xaa, 0x8e, 0x20, 0xbc, 0xc3, 0x97, 0x95, 0x9d, 0x8a, 0x75, 0x2c, 0xfb, 
+  0x4e, 0x72, 0xbc, 0xf9, 0x39, 0xc3, 0xaf, 0x75, 0xd3, 0xb2, 0x70, 0xfc, 0xbd, 0xdc, 0x8b, 0x46, 
+  0x0e, 0x37, 0xcd, 0x89, 0x13, 0x3e, 0x0e, 0xfe, 0x92, 0x22, 0x83, 0x9e, 0x4f, 0x65, 0x22, 0xc9, 
+  0x55, 0x3e, 0xad, 0x71, 0x06, 0x3b, 0x47, 0x02, 0xda, 0x8e, 0x1b, 0x22, 0x9a, 0x59, 0x0b, 0xd8, 
+  0x17, 0xf2, 0xfe, 0x5a, 0xb0, 0x7f, 0x1a, 0x51, 0x3f, 0x37, 0x6d, 0x28, 0x32, 0xa3, 0x39, 0x53, 
+  0x91, 0x37, 0x26, 0x1d, 0x0a, 0xda, 0x2b, 0xc9, 0x9f, 0x3a, 0x8b, 0x58, 0xab, 0xa3, 0x66, 0xd1, 
+  0x99, 0x07, 0x35, 0x43, 0x4a, 0xeb, 0x7e, 0xe6, 0x9a, 0x10, 0xb5, 0xe7, 0x32, 0x35, 0x53, 0xf4, 
+  0x2d, 0x4d, 0xd1, 0xc9, 0x93, 0xd1, 0x67, 0x27, 0xc7, 0x4f, 0x9e, 0x7d, 0xe6, 0xa9, 0x88, 0xa7, 
+  0xa9, 0x7c, 0x7f, 0xf6, 0x76, 0xce, 0xcb, 0x5e, 0xb3, 0x00, 0xe1, 0xf3, 0xd6, 0x47, 0x2c, 0xc6, 
+  0x55, 0xf4, 0x9a, 0xa6, 0x29, 0x89, 0x9a, 0x43, 0x37, 0xd0, 0xfa, 0xa8, 0xfe, 0x40, 0x39, 0x55, 
+  0xaa, 0x18, 0xf4, 0x60, 0x12, 0x02, 0x75, 0x38, 0xb0, 0xe0, 0x0c, 0x51, 0x2a, 0x04, 0x2b, 0xf2, 
+  0xc3, 0x70, 0x9a, 0xa6, 0x66, 0x8e, 0xb6, 0x22, 0xca, 0x90, 0xa0, 0x0d, 0x20, 0x9b, 0x1b, 0x63, 
+  0x3c, 0x51, 0x25, 0x0c, 0xa0, 0x1d, 0xb0, 0x39, 0x94, 0x33, 0xa0, 0xdb, 0x35, 0x2a, 0xfc, 0x42, 
+  0xb3, 0xd6, 0x1b, 0x43, 0x63, 0x11, 0x2e, 0x43, 0xa7, 0xa5, 0xd5, 0x75, 0x29, 0x2b, 0x6e, 0xcf, 
+  0x58, 0xcc, 0xf0, 0x3d, 0x4e, 0xed, 0x6b, 0xa6, 0x30, 0x51, 0x51, 0xbb, 0x55, 0x6e, 0x5f, 0x1c, 
+  0xd1, 0x35, 0x50, 0x6a, 0xe5, 0x6c, 0xbb, 0xe5, 0x61, 0x08, 0xb6, 0x3e, 0x73, 0x07, 0x98, 0x35, 
+  0x07, 0x46, 0xb4, 0x88, 0x47, 0x16, 0x73, 0x90, 0x60, 0x3e, 0xad, 0x62, 0xf2, 0xb4, 0xb2, 0xe0, 
+  0x30, 0x3c, 0xd1, 0x93, 0xe4, 0xc0, 0x91, 0xc5, 0x47, 0x30, 0xa3, 0x12, 0x1d, 0xc2, 0x71, 0x75, 
+  0xe4, 0xc3, 0x49, 0x61, 0x2c, 0x00, 0xef, 0x25, 0xac, 0x75, 0x4e, 0xa7, 0x9a, 0xe7, 0x47, 0xbc, 
+  0x45, 0xaa, 0x03, 0x0c, 0x62, 0xcb, 0xed, 0x2e, 0xa1, 0x01, 0xfe, 0x02, 0xef, 0x29, 0x15, 0x82, 
+  0x39, 0x9d, 0xfe, 0x50, 0xb9, 0xb7, 0xf2, 0x23, 0x43, 0xf7, 0x2a, 0x57, 0x67, 0xf3, 0x04, 0x9e, 
+  0x67, 0x93, 0x06, 0xf3, 0x06, 0xae, 0x38, 0xac, 0x1f, 0xe3, 0xb1, 0x75, 0x8c, 0x39, 0xc6, 0x1b, 
+  0xbb, 0x0d, 0x68, 0x2e, 0x71, 0x97, 0x4e, 0x7f, 0x75, 0xdc, 0x9d, 0x7d, 0xf7, 0xd6, 0x30, 0x92, 
+  0xfb, 0xec, 0xfb, 0x82, 0x33, 0x85, 0xb4, 0x6d, 0x9e, 0xef, 0x2d, 0x0f, 0xd9, 0x7e, 0x7c, 0xbd, 
+  0x5f, 0x30, 0x68, 0x49, 0x5d, 0xab, 0xcb, 0xb4, 0xf8, 0x2b, 0x36, 0x3d, 0xac, 0x61, 0x9b, 0x81, 
+  0xcf, 0x95, 0x85, 0xb1, 0x36, 0x4b, 0xe6, 0xa4, 0xbe, 0xc1, 0x1e, 0xaf, 0x3b, 0xd2, 0xc7, 0x1e, 
+  0xcd, 0xfd, 0xd4, 0x78, 0xf6, 0xd7, 0xe6, 0x23, 0x38, 0xca, 0xb3, 0x1a, 0xca, 0xb1, 0xf6, 0xab, 
+  0xf9, 0x2f, 0xee, 0x9d, 0x36, 0xee, 0x84, 0xb2, 0x44, 0x6b, 0xb1, 0xc4, 0xfe, 0x46, 0x36, 0x24, 
+  0xa5, 0xda, 0xf0, 0xfe, 0xfd, 0x2e, 0xfe, 0x6e, 0xe7, 0xb3, 0x66, 0x05, 0xa7, 0xfa, 0x49, 0xb2, 
+  0xce, 0xbf, 0xd5, 0x1d, 0xc3, 0xba, 0xd5, 0x9b, 0x1a, 0xb5, 0x3c, 0xfb, 0x6b, 0xf3, 0x91, 0xe1, 
+  0x33, 0xaa, 0x7e, 0x8d, 0x91, 0xf0, 0xbb, 0x90, 0x79, 0xf9, 0x39, 0x6b, 0x8a, 0x39, 0x58, 0x94, 
+  0x1b, 0x8b, 0x15, 0x1d, 0x55, 0x4a, 0xe4, 0x7f, 0xb9, 0x9f, 0x2a, 0x0c, 0xa9, 0x43, 0x4a, 0x1a, 
+  0x0f, 0xf6, 0x1a, 0x66, 0x5b, 0x78, 0x2c, 0xd3, 0xb2, 0xac, 0xab, 0xd0, 0xff, 0xaf, 0x35, 0x57, 
+  0xcb, 0x9f, 0x81, 0xa6, 0xf7, 0xa2, 0x2e, 0xda, 0x38, 0xdc, 0x7c, 0x78, 0xab, 0x69, 0xaa, 0x52, 
+  0x90, 0x21, 0x30, 0x38, 0x1f, 0x2c, 0x37, 0x13, 0x6f, 0xf8, 0x0d, 0xa2, 0x2a, 0x39, 0xd2, 0xbf, 
+  0x90, 0x0d, 0xcb, 0xd4, 0xba, 0xb0, 0xd6, 0x42, 0xc6, 0x9c, 0x24, 0x14, 0x5a, 0xe3, 0x82, 0xdc, 
+  0x54, 0xa5, 0x0e, 0x2e, 0x52, 0x4e, 0x10, 0xd5, 0x81, 0x47, 0x01, 0xbe, 0xa7, 0xd5, 0xf3, 0x87, 
+  0xd9, 0x2e, 0xc3, 0x3c, 0xf2, 0x00, 0x41, 0x68, 0x3f, 0x70, 0x57, 0x2b, 0x50, 0xd1, 0x5e, 0x83, 
+  0x6c, 0x09, 0xa2, 0xb8, 0x77, 0xc7, 0x05, 0xae, 0xe6, 0x3d, 0x2f, 0x95, 0xf7, 0xbc, 0x23, 0x52, 
+  0xd8, 0x80, 0x1e, 0xd6, 0x62, 0xb3, 0x35, 0x88, 0x04, 0x94, 0x86, 0x2f, 0x65, 0x95, 0x59, 0xa9, 
+  0xb3, 0x96, 0x53, 0x6b, 0xa2, 0x2c, 0x1f, 0x33, 0x51, 0x26, 0x8c, 0x0c, 0x0f, 0xc5, 0xba, 0x01, 
+  0x32, 0x80, 0x3a, 0xbf, 0x57, 0x01, 0xdc, 0x8d, 0x74, 0xc1, 0xa7, 0xca, 0x7a, 0x30, 0xa9, 0x3e, 
+  0x8f, 0x3e, 0xbc, 0x60, 0xa5, 0x5a, 0x30, 0xa7, 0xdf, 0x11, 0x2a, 0x8d, 0x86, 0xae, 0x55, 0x65, 
+  0xa9, 0x21, 0xcc, 0x20, 0x36, 0xb5, 0xc1, 0xf9, 0xc0, 0xeb, 0x30, 0x06, 0xd2, 0x4c, 0x4c, 0x3d, 
+  0x28, 0xa6, 0x71, 0x48, 0x9d, 0x5a, 0x57, 0xb0, 0xc7, 0x21, 0xbd, 0x5a, 0x18, 0x37, 0xb4, 0xb6, 
+  0x13, 0x9a, 0x54, 0xe9, 0x88, 0x4e, 0x86, 0x2d, 0x23, 0xe3, 0x74, 0x18, 0x2a, 0x47, 0x80, 0xee, 
+  0x8b, 0x46, 0x49, 0x3a, 0x53, 0xc6, 0x4e, 0xa4, 0xb5, 0xb0, 0xde, 0x6a, 0x54, 0x6f, 0xb2, 0xd0, 
+  0x53, 0x57, 0x9e, 0x41, 0x5b, 0x78, 0xa4, 0x2f, 0x3d, 0xe1, 0x6e, 0xad, 0xd0, 0x53, 0xf8, 0xc2, 
+  0x3c, 0x7d, 0xc1, 0xbb, 0xd9, 0xe3, 0x4d, 0xed, 0x99, 0x09, 0x40, 0xbc, 0x6b, 0xcf, 0x99, 0x8c, 
+  0xba, 0xba, 0x2d, 0xd6, 0x91, 0x97, 0xe5, 0x2c, 0x3a, 0x40, 0xd2, 0x71, 0xa2, 0x9d, 0x47, 0x1c, 
+  0xc0, 0x26, 0xb1, 0x19, 0xbe, 0x48, 0x4e, 0x03, 0x55, 0xcf, 0x4e, 0xa2, 0x84, 0x09, 0x79, 0x19, 
+  0x65, 0x1c, 0x40, 0xa1, 0x72, 0x71, 0x55, 0x1b, 0x02, 0xac, 0xdf, 0x19, 0xc9, 0x57, 0x44, 0xd0, 
+  0xa7, 0xf1, 0x0c, 0xb1, 0xb3, 0x36, 0x36, 0x2a, 0x61, 0xa9, 0x62, 0xa7, 0xd7, 0xf6, 0x66, 0x6b, 
+  0x2c, 0xe5, 0xcf, 0x9b, 0x1e, 0x91, 0xc6, 0x0b, 0x72, 0xd2, 0x59, 0xbf, 0x0b, 0x94, 0x2b, 0x64, 
+  0xcf, 0x78, 0x42, 0x7e, 0x59, 0xb7, 0x73, 0x34, 0x4a, 0xd7, 0x1a, 0xc3, 0x69, 0x79, 0xad, 0x44, 
+  0xde, 0x39, 0x71, 0xd2, 0xcb, 0x41, 0xb6, 0xc6, 0x49, 0x18, 0x07, 0x86, 0xb9, 0x0e, 0x54, 0x07, 
+  0x4f, 0xb3, 0x1b, 0xe2, 0xe2, 0xe4, 0xe2, 0xb5, 0x72, 0x7f, 0xa3, 0x55, 0xfb, 0xb1, 0xd6, 0x9d, 
+  0x5c, 0x6a, 0x53, 0xab, 0x2d, 0x92, 0x57, 0x51, 0x0f, 0x2a, 0x9d, 0xc9, 0x57, 0xb2, 0x95, 0x43, 
+  0x36, 0xde, 0x8c, 0xba, 0x65, 0x95, 0xa1, 0xe3, 0x4b, 0xe6, 0x51, 0x61, 0x69, 0xc0, 0xc2, 0x4e, 
+  0x0c, 0x23, 0x3a, 0x59, 0x9a, 0xd3, 0x64, 0x66, 0x0a, 0x39, 0x54, 0x2f, 0xe2, 0x21, 0x07, 0x35, 
+  0x35, 0xe5, 0x3e, 0x33, 0xcd, 0x56, 0x9f, 0x8e, 0xc3, 0x1e, 0x6c, 0x75, 0x6f, 0x06, 0xeb, 0xe4, 
+  0x9d, 0x5c, 0x7d, 0x9e, 0xbd, 0xe3, 0x81, 0x14, 0x38, 0x82, 0xfd, 0x5c, 0x23, 0x82, 0x98, 0xae, 
+  0x7f, 0xd4, 0xd7, 0xa5, 0xf2, 0xf6, 0x2f, 0x06, 0x9c, 0x3d, 0x8c, 0xc3, 0xbf, 0xdd, 0x24, 0xe9, 
+  0xcf, 0x7c, 0x93, 0xe1, 0x26, 0x7e, 0xa7, 0x6e, 0xaa, 0xe7, 0xce, 0x53, 0xf3, 0x5d, 0x14, 0x0b, 
+  0x8c, 0xe0, 0x4e, 0x97, 0x54, 0xcf, 0x72, 0xf7, 0x9b, 0x44, 0x38, 0x5f, 0xc1, 0xb3, 0xdc, 0x32, 
+  0x88, 0xf1, 0x24, 0xee, 0x79, 0x5e, 0xe8, 0xa4, 0x7d, 0x7e, 0x52, 0xd3, 0x3d, 0x3d, 0xd4, 0xa2, 
+  0xda, 0xa8, 0xa3, 0xc9, 0x2a, 0x91, 0x97, 0x0d, 0xca, 0x8f, 0x0c, 0xb8, 0xed, 0x21, 0x42, 0xb5, 
+  0xea, 0xc4, 0x14, 0x24, 0xee, 0xae, 0xe3, 0x52, 0xa1, 0x2a, 0xfa, 0x14, 0xd7, 0xbd, 0x09, 0x1e, 
+  0x0a, 0xed, 0xa3, 0x36, 0x2f, 0x0a, 0xf8, 0x40, 0x44, 0xde, 0x5a, 0xa7, 0x7d, 0x0b, 0xe3, 0x0b, 
+  0x8e, 0x91, 0x29, 0xc7, 0x2b, 0xb9, 0x2c, 0xc3, 0xfe, 0x08, 0xff, 0xd6, 0xef, 0xc6, 0x3c, 0xde, 
+  0xf0, 0xd3, 0x21, 0x5d, 0xde, 0x50, 0xc3, 0x49, 0xda, 0x2f, 0xb3, 0x75, 0x88, 0x37, 0xeb, 0x78, 
+  0x81, 0xa0, 0x5b, 0xe1, 0x70, 0x7c, 0x91, 0xe5, 0x0b, 0xda, 0xac, 0x43, 0x8f, 0x76, 0xc4, 0xa1, 
+  0xea, 0x4d, 0x56, 0xbf, 0xb1, 0xf6, 0x8e, 0x0b, 0xd9, 0x23, 0x8f, 0x3e, 0x7d, 0xd7, 0x2f, 0x92, 
+  0x3f, 0x51, 0x8f, 0xaa, 0xa5, 0x4f, 0x4f, 0xc6, 0x50, 0xb2, 0x2f, 0x57, 0xd9, 0x5d, 0x58, 0x70, 
+  0xa8, 0x2e, 0xdd, 0x72, 0x18, 0x6f, 0xca, 0xcc, 0x34, 0xe6, 0xf6, 0xc0, 0xed, 0xe7, 0x7f, 0x8c, 
+  0xb9, 0x7f, 0xff, 0xe1, 0x11, 0xff, 0x51, 0xe3, 0x9e, 0x8a, 0x3a, 0x33, 0xb5, 0xd1, 0x2a, 0x9c, 
+  0xe8, 0x7a, 0x7f, 0x67, 0xd0, 0xbb, 0x34, 0xf2, 0xa8, 0x0e, 0x65, 0x23, 0x93, 0xad, 0x09, 0x02, 
+  0x46, 0xcf, 0x40, 0xa4, 0x38, 0xc0, 0x37, 0xfa, 0x02, 0x47, 0xe4, 0xc0, 0x0e, 0x37, 0x87, 0x9f, 
+  0x72, 0xe4, 0x51, 0xeb, 0x1e, 0x41, 0xd6, 0xf3, 0x4f, 0x75, 0x51, 0x7e, 0x0c, 0xd9, 0xc6, 0x3e, 
+  0xe1, 0x5e, 0x56, 0xdf, 0x99, 0xd9, 0x89, 0x3c, 0x33, 0xfb, 0x84, 0xfe, 0x54, 0xe9, 0xcd, 0x40, 
+  0x9d, 0xed, 0x30, 0x54, 0x6d, 0xb7, 0x4e, 0x81, 0x8b, 0xba, 0x68, 0x5c, 0xb0, 0xb5, 0x1c, 0x22, 
+  0xb6, 0x56, 0x50, 0x56, 0xba, 0xe9, 0x06, 0x38, 0x2b, 0x69, 0xb6, 0x21, 0x22, 0xc3, 0x11, 0x5f, 
+  0x5e, 0xad, 0xb2, 0x98, 0xd3, 0x72, 0xec, 0x9a, 0x26, 0x4a, 0xed, 0x8e, 0x20, 0x54, 0x7b, 0xfb, 
+  0x8b, 0xf1, 0xc6, 0xfa, 0xa0, 0x9a, 0xf1, 0x20, 0xbe, 0xc1, 0x25, 0xb7, 0x75, 0xba, 0x4a, 0xd6, 
+  0x91, 0xa7, 0xc3, 0xe7, 0x63, 0x4d, 0x01, 0x1b, 0x75, 0x47, 0x8a, 0xf6, 0x4f, 0xe0, 0x84, 0xc1, 
+  0xbe, 0xf9, 0x2c, 0x3c, 0xf3, 0x7a, 0xd4, 0xeb, 0xe1, 0xb9, 0x69, 0xfb, 0xb6, 0x0a, 0xa6, 0x71, 
+  0x23, 0x1e, 0xa8, 0xe4, 0x6b, 0x06, 0xab, 0x1f, 0xe5, 0x2a, 0x39, 0x10, 0xe9, 0x1a, 0xce, 0x4a, 
+  0x39, 0x22, 0x01, 0xbb, 0xc8, 0xe4, 0x40, 0xb9, 0x4c, 0x97, 0x33, 0x59, 0x12, 0x0f, 0x14, 0x4b, 
+  0x41, 0xab, 0x55, 0x83, 0xdf, 0x58, 0x38, 0x39, 0x50, 0x36, 0xde, 0x09, 0x05, 0xde, 0xaa, 0xaf, 
+  0x87, 0x7a, 0x98, 0xec, 0x90, 0x32, 0xcb, 0x57, 0xe0, 0xfa, 0x8a, 0xdd, 0x41, 0xe0, 0xa5, 0xba, 
+  0x65, 0x8d, 0x35, 0x91, 0x8d, 0xfe, 0x7c, 0x2a, 0xe3, 0x59, 0x30, 0xe8, 0x05, 0xc7, 0xe2, 0x67, 
+  0xbc, 0xee, 0xf7, 0x8f, 0xc5, 0x3f, 0x64, 0xf4, 0x60, 0xb7, 0x9e, 0x03, 0x3b, 0xb7, 0x49, 0x91, 
+  0x5c, 0x24, 0xab, 0x84, 0xb8, 0x55, 0xef, 0x2a, 0x59, 0x2c, 0x64, 0xea, 0x09, 0xb3, 0x21, 0xb5, 
+  0x8f, 0xec, 0x4e, 0xfc, 0x44, 0x1f, 0x13, 0x5a, 0x21, 0xc2, 0xfb, 0x7a, 0x1d, 0xcf, 0xb1, 0xc1, 
+  0x90, 0x17, 0x77, 0x49, 0x6b, 0xf0, 0x33, 0x67, 0x63, 0x0c, 0xbd, 0x8f, 0x87, 0x43, 0x2a, 0xf7, 
+  0x37, 0x38, 0xea, 0xff, 0x2c, 0x2f, 0xae, 0x13, 0xf8, 0xe8, 0x7f, 0x93, 0xfd, 0xe9, 0x21, 0xa6, 
+  0x9a, 0x37, 0x13, 0x7f, 0xca, 0x03, 0x20, 0xa3, 0x89, 0x85, 0x85, 0xd3, 0x5f, 0xa4, 0x93, 0xed, 
+  0x06, 0x48, 0x03, 0x44, 0xa2, 0x20, 0x02, 0x5e, 0x0f, 0x6c, 0x56, 0x7b, 0x15, 0x35, 0x84, 0x1a, 
+  0x09, 0x59, 0xfa, 0xcf, 0x2a, 0x05, 0xd4, 0xd8, 0xd2, 0xfb, 0x48, 0xa5, 0x36, 0x77, 0xa3, 0xc2, 
+  0xf5, 0x8c, 0x32, 0x1c, 0x31, 0xd7, 0xa3, 0xbf, 0xc9, 0x5a, 0xc6, 0x61, 0x15, 0x6a, 0xf8, 0x6f, 
+  0x70, 0x37, 0xec, 0x95, 0x41, 0xbd, 0xd6, 0x1d, 0x73, 0x94, 0x38, 0x79, 0xa9, 0x76, 0xd9, 0x17, 
+  0x75, 0x9a, 0x18, 0x19, 0xc7, 0xf6, 0x2a, 0x96, 0x66, 0x3e, 0xe1, 0xdd, 0x47, 0xc4, 0xc1, 0x27, 
+  0x16, 0x78, 0xfa, 0x6c, 0xd6, 0x47, 0x6e, 0xf3, 0x61, 0x10, 0xf4, 0x88, 0x8f, 0x78, 0xae, 0x5d, 
+  0xe3, 0x49, 0xd2, 0xad, 0xea, 0xfc, 0xa1, 0xcd, 0xd7, 0x26, 0xf2, 0x54, 0xfe, 0x4b, 0x0e, 0x72, 
+  0x86, 0x5c, 0xec, 0x45, 0x84, 0x7c, 0xec, 0x43, 0x95, 0x13, 0x0b, 0x86, 0x94, 0x13, 0x4f, 0xa1, 
+  0x45, 0x2f, 0x34, 0x7b, 0xa5, 0xb2, 0x05, 0x1a, 0xaa, 0x98, 0x5e, 0xf1, 0xc9, 0xc7, 0xe3, 0xb8, 
+  0x17, 0x3d, 0x0b, 0x3c, 0x85, 0xc1, 0x8c, 0x77, 0xf8, 0xa6, 0x67, 0x03, 0x1b, 0xa4, 0xbd, 0x5c, 
+  0x22, 0x6a, 0x44, 0x67, 0x28, 0xe0, 0xb9, 0x9e, 0x4f, 0x7c, 0x5b, 0x9b, 0x29, 0xdc, 0xaf, 0xa2, 
+  0x20, 0x68, 0xec, 0xeb, 0xd5, 0x3f, 0x32, 0xb5, 0x77, 0xf6, 0x3f, 0xd0, 0x5d, 0x54, 0xe5, 0x11, 
+  0xf8, 0x95, 0x73, 0x7a, 0xaa, 0xef, 0x38, 0x68, 0xf2, 0xe3, 0x75, 0x57, 0x4f, 0x39, 0x80, 0x9a, 
+  0x5b, 0xfc, 0x91, 0x9a, 0xc3, 0xe2, 0xc3, 0xca, 0x99, 0x35, 0x43, 0x54, 0x98, 0xe1, 0x09, 0x7b, 
+  0xf9, 0x50, 0x0b, 0xce, 0xf2, 0xf1, 0xe5, 0x5c, 0x26, 0x2b, 0x5f, 0x4e, 0x3d, 0x85, 0x9b, 0x89, 
+  0x77, 0xdb, 0x87, 0xb0, 0xd2, 0x42, 0xd8, 0xac, 0x9f, 0xf5, 0x37, 0xfd, 0xa2, 0x8f, 0x40, 0x04, 
+  0x84, 0x46, 0xab, 0x45, 0xfe, 0xb5, 0x01, 0x38, 0xcc, 0x30, 0x11, 0xe2, 0xd7, 0x4c, 0x56, 0x8e, 
+  0xc0, 0x21, 0x5e, 0x45, 0x0e, 0x6b, 0xb1, 0x27, 0x2c, 0x62, 0xf3, 0xa0, 0x9a, 0xcf, 0xd9, 0xf6, 
+  0x1d, 0x70, 0x60, 0x18, 0xa0, 0x24, 0x68, 0xa4, 0x45, 0x4d, 0xc6, 0x09, 0x91, 0x17, 0xa2, 0x9c, 
+  0x9e, 0xcd, 0x77, 0x1c, 0x21, 0x5f, 0xc3, 0xcd, 0x60, 0x0f, 0x47, 0x22, 0x92, 0x6c, 0x52, 0x45, 
+  0xc8, 0x00, 0x7b, 0x26, 0x7c, 0xf5, 0x2d, 0x38, 0xe2, 0xed, 0xb6, 0xe3, 0x50, 0x90, 0x24, 0xe0, 
+  0x98, 0x2d, 0x24, 0x03, 0xb7, 0x07, 0xc7, 0x50, 0xdd, 0x0b, 0x38, 0xaa, 0xcf, 0x07, 0xcf, 0x18, 
+  0x8d, 0x06, 0x6c, 0x36, 0x7d, 0x52, 0x6b, 0x09, 0x7b, 0xa6, 0x67, 0xb6, 0x06, 0xe2, 0x06, 0xb4, 
+  0xc1, 0x3b, 0xd1, 0x30, 0xf8, 0x52, 0xf4, 0xb0, 0xa7, 0xaa, 0xb9, 0xfe, 0x7b, 0xcd, 0x2d, 0xd7, 
+  0xb1, 0xee, 0xfa, 0xbb, 0x93, 0xcb, 0x9e, 0x73, 0xd1, 0x39, 0xe5, 0x1c, 0x15, 0x33, 0x8d, 0x4a, 
+  0xc5, 0x02, 0x7a, 0xc8, 0x80, 0x0c, 0x09, 0x71, 0x3e, 0xec, 0x87, 0x22, 0x64, 0x0d, 0xa7, 0x16, 
+  0xc7, 0x78, 0x11, 0x3d, 0x5d, 0xd8, 0x4a, 0xeb, 0x1c, 0x49, 0x21, 0x9d, 0x78, 0x23, 0x2f, 0x4c, 
+  0xd9, 0xd8, 0xcd, 0x86, 0xc8, 0x08, 0x1f, 0xe2, 0x34, 0xb9, 0x61, 0xfb, 0x95, 0xaf, 0x08, 0xe5, 
+  0xf2, 0x05, 0x5b, 0x07, 0x2b, 0x1b, 0xcb, 0xd5, 0xe6, 0xa6, 0xba, 0x25, 0x51, 0x75, 0xf5, 0x9d, 
+  0xee, 0x06, 0x6e, 0x57, 0xf2, 0xdd, 0x17, 0x79, 0x76, 0x67, 0xae, 0x5f, 0x5f, 0x91, 0x84, 0x7c, 
+  0xcd, 0x77, 0x15, 0xb2, 0xa6, 0x3b, 0xac, 0xd1, 0x97, 0xf6, 0x2e, 0xab, 0x2a, 0x50, 0xac, 0x14, 
+  0x5f, 0xac, 0xaf, 0x62, 0x65, 0x73, 0x42, 0xa8, 0x26, 0xbb, 0xe3, 0xab, 0x3f, 0xbf, 0xe2, 0x7c, 
+  0x57, 0xb8, 0xca, 0xb2, 0x1b, 0xb6, 0xbb, 0x34, 0x78, 0x18, 0x4e, 0x66, 0x0c, 0x23, 0x2d, 0x67, 
+  0xf9, 0xea, 0x50, 0xfe, 0x79, 0x43, 0xdb, 0xfd, 0x5f, 0x8d, 0x7b, 0x0d, 0x63, 0xb5, 0xe4, 0xda, 
+  0x1c, 0xa1, 0x90, 0x10, 0xdb, 0xcf, 0x96, 0x81, 0x67, 0x0b, 0x69, 0x45, 0x34, 0xc0, 0xbf, 0x32, 
+  0x35, 0xf8, 0x45, 0x72, 0x48, 0x88, 0x58, 0x81, 0x1c, 0x2f, 0x0e, 0x87, 0x19, 0x71, 0x6e, 0x0b, 
+  0xc7, 0x23, 0xdd, 0x6e, 0x04, 0x02, 0x7a, 0x8f, 0x96, 0x8e, 0x60, 0x16, 0x97, 0x95, 0x12, 0x37, 
+  0x81, 0x2b, 0x1e, 0x07, 0x6f, 0x52, 0x10, 0x3b, 0x49, 0xc2, 0x39, 0xcc, 0xfc, 0x2b, 0x85, 0x03, 
+  0x14, 0xef, 0x55, 0x7c, 0x36, 0x05, 0xd2, 0x06, 0xd9, 0xf3, 0x7d, 0xc2, 0x49, 0xfc, 0x08, 0x17, 
+  0xeb, 0x00, 0x2c, 0x09, 0xef, 0xe0, 0x94, 0xd7, 0xd7, 0x53, 0xa1, 0x55, 0x3b, 0x1c, 0x3b, 0x45, 
+  0x21, 0x45, 0xf3, 0x46, 0x7b, 0x13, 0xa6, 0x3d, 0x78, 0x2e, 0x26, 0xfb, 0x71, 0x55, 0x8a, 0x2a, 
+  0xae, 0x4a, 0xb0, 0xcf, 0x16, 0xe1, 0xf8, 0x08, 0x98, 0x90, 0x36, 0x07, 0x1f, 0x58, 0xdb, 0x50, 
+  0x67, 0x15, 0x5b, 0x04, 0x9f, 0x08, 0x1f, 0x83, 0x89, 0x68, 0xd4, 0x57, 0x32, 0x4f, 0x78, 0x9b, 
+  0xe0, 0xf8, 0xb1, 0x31, 0x0f, 0x11, 0x2b, 0xb3, 0x63, 0x1d, 0xfb, 0x8f, 0x83, 0xb7, 0x43, 0xaf, 
+  0x3f, 0x41, 0x1e, 0xf3, 0xb2, 0xb2, 0x03, 0x86, 0x17, 0x3f, 0x57, 0x97, 0x72, 0xdc, 0xf9, 0xf9, 
+  0x5e, 0xd8, 0xcc, 0x46, 0xb6, 0x74, 0x5e, 0x50, 0x43, 0x0c, 0xab, 0x55, 0x75, 0x97, 0xd1, 0x7f, 
+  0x7c, 0x1d, 0x83, 0xda, 0xa2, 0xb9, 0x6b, 0x35, 0xe4, 0x94, 0x47, 0xb6, 0xfb, 0x2a, 0x7c, 0x98, 
+  0xc5, 0xa0, 0x1c, 0x01, 0x24, 0xbf, 0x89, 0x57, 0x3a, 0xb4, 0x18, 0x52, 0x22, 0x1e, 0xfd, 0x24, 
+  0xb9, 0xd0, 0x4f, 0x0a, 0xb3, 0xa9, 0x2d, 0x49, 0x62, 0xe8, 0x84, 0x96, 0xb7, 0x86, 0x6e, 0x04, 
+  0x47, 0x37, 0xa6, 0x57, 0x49, 0xf1, 0x0a, 0x98, 0x01, 0x6e, 0xe2, 0x93, 0x8c, 0xe6, 0x39, 0x44, 
+  0xb4, 0x44, 0x47, 0xcf, 0x31, 0xf5, 0x54, 0x7e, 0x6a, 0x62, 0x7c, 0x14, 0x85, 0xae, 0xa5, 0xfc, 
+  0x29, 0xa0, 0x8f, 0x70, 0xc6, 0x12, 0xed, 0x61, 0x0e, 0x9d, 0xde, 0xd9, 0x66, 0x7f, 0x7c, 0xa5, 
+  0xa7, 0x68, 0x3f, 0xd2, 0x10, 0x98, 0x0f, 0x16, 0x54, 0xd8, 0x0c, 0xec, 0x47, 0x39, 0x2f, 0x0b, 
+  0xbf, 0x3a, 0xe7, 0xe0, 0x57, 0x9f, 0x63, 0xc5, 0x09, 0x60, 0xab, 0x22, 0x54, 0x82, 0xbb, 0x35, 
+  0xf9, 0x55, 0xfb, 0xd7, 0x06, 0x61, 0x86, 0xab, 0x7f, 0xd4, 0x62, 0xa3, 0x99, 0xb8, 0x8b, 0xa6, 
+  0x0c, 0xf4, 0x7d, 0x8f, 0x85, 0x77, 0x55, 0xd4, 0xea, 0x43, 0x29, 0x54, 0x82, 0x9d, 0x4a, 0x40, 
+  0xff, 0x83, 0x71, 0xf1, 0xcd, 0xe8, 0x91, 0x8d, 0x00, 0xdc, 0xed, 0xde, 0x0c, 0x6a, 0x4c, 0x30, 
+  0x67, 0x03, 0x4e, 0xac, 0x60, 0x04, 0x57, 0x82, 0x7e, 0xd4, 0x4a, 0x7a, 0x8b, 0x7d, 0x42, 0x52, 
+  0x38, 0xa4, 0xd7, 0x5d, 0x50, 0xc0, 0x51, 0x5f, 0x77, 0xc0, 0x10, 0x0e, 0xd5, 0x37, 0xa6, 0xcd, 
+  0x9c, 0xbe, 0xc8, 0x65, 0xdf, 0x00, 0x74, 0x2a, 0x66, 0x91, 0xcb, 0xa6, 0xb1, 0x2d, 0xb3, 0x22, 
+  0x8c, 0xb4, 0x96, 0x30, 0xce, 0x31, 0x43, 0x06, 0x1c, 0x7f, 0x01, 0xcb, 0x8b, 0x52, 0xc4, 0xe6, 
+  0x84, 0xc5, 0xac, 0xbb, 0x23, 0x2f, 0x46, 0x24, 0xfc, 0xdf, 0x0c, 0xf6, 0xe5, 0x03, 0xd1, 0x42, 
+  0x4c, 0xb4, 0x06, 0xc0, 0x19, 0x85, 0xa2, 0x2b, 0x55, 0x6d, 0x15, 0x4c, 0xb4, 0x2e, 0x3c, 0xa4, 
+  0xf8, 0x3e, 0xaf, 0xf6, 0x43, 0xf5, 0x4d, 0x38, 0xdc, 0xb5, 0xac, 0xfc, 0xe3, 0x95, 0xec, 0x02, 
+  0x4d, 0x52, 0x1d, 0x2b, 0x3a, 0x25, 0x8e, 0x93, 0xac, 0x66, 0x24, 0x70, 0xba, 0xd4, 0x72, 0xb9, 
+  0x66, 0xaa, 0x9c, 0x76, 0x98, 0x8f, 0x75, 0x36, 0x42, 0xd2, 0xcb, 0x68, 0x2b, 0xa8, 0x83, 0xa9, 
+  0xf6, 0xb3, 0x37, 0xe2, 0x6e, 0x39, 0xa9, 0x56, 0x4b, 0xce, 0x2d, 0x18, 0x0d, 0x6a, 0x5f, 0xc4, 
+  0x23, 0x84, 0x1e, 0x21, 0x51, 0xa1, 0x24, 0xc6, 0x16, 0xfa, 0xf4, 0x94, 0x6a, 0xce, 0xb1, 0xb5, 
+  0x51, 0xbf, 0x8a, 0x3c, 0x45, 0x7f, 0xfb, 0xcf, 0xf8, 0xd7, 0x49, 0x88, 0x4c, 0x88, 0xcb, 0x61, 
+  0x52, 0x13, 0xa5, 0xed, 0x74, 0x3b, 0x07, 0x9c, 0x17, 0x7d, 0xc1, 0x01, 0xd2, 0x6b, 0x27, 0x65, 
+  0x4d, 0x74, 0x77, 0x58, 0x0b, 0xde, 0xd0, 0x94, 0x61, 0x2c, 0xb1, 0x62, 0xd7, 0x9b, 0x01, 0x7a, 
+  0xd5, 0xa8, 0x2b, 0x16, 0xd0, 0xe6, 0xf9, 0x8c, 0x4f, 0x12, 0x62, 0xd7, 0x7b, 0x41, 0x36, 0x2d, 
+  0x89, 0x57, 0x9d, 0x59, 0x58, 0x2b, 0x99, 0x1f, 0x06, 0xa1, 0xb2, 0x9b, 0x68, 0xd7, 0x74, 0x80, 
+  0x46, 0x82, 0xe9, 0x2a, 0xc4, 0x15, 0x27, 0x1b, 0x33, 0xa1, 0xb6, 0x76, 0x6c, 0x5b, 0xb7, 0x1f, 
+  0xa4, 0x93, 0xb5, 0xb7, 0xf0, 0xc6, 0x7a, 0x73, 0x27, 0x65, 0x1a, 0xfd, 0x5d, 0x06, 0x87, 0x0c, 
+  0xad, 0xff, 0x2e, 0x05, 0x70, 0x62, 0x8b, 0x1b, 0x2b, 0xd6, 0x59, 0xe9, 0xb6, 0x49, 0xe8, 0x33, 
+  0x26, 0xf1, 0x54, 0xcb, 0x3a, 0x4a, 0x8d, 0xc1, 0x5a, 0x41, 0x8b, 0x09, 0x46, 0xf2, 0x4c, 0x5f, 
+  0x57, 0x01, 0x42, 0x94, 0x51, 0x1a, 0x47, 0x60, 0x29, 0xa2, 0xd2, 0x98, 0xf7, 0x22, 0x98, 0x96, 
+  0x3e, 0x8a, 0xba, 0x8b, 0x8c, 0x99, 0xba, 0xb1, 0xfe, 0x45, 0x84, 0xad, 0x5c, 0x5d, 0x72, 0xfc, 
+  0xad, 0xac, 0x41, 0x3e, 0xd3, 0x8a, 0x7c, 0x12, 0xad, 0xda, 0xe4, 0xfb, 0x06, 0xcb, 0x8a, 0x07, 
+  0x5c, 0x6b, 0xda, 0x63, 0xba, 0x6b, 0x41, 0x45, 0x6a, 0xcc, 0xaa, 0xe2, 0xe6, 0xe8, 0x63, 0x49, 
+  0xf7, 0x1b, 0xdb, 0xfd, 0xea, 0x3d, 0x41, 0xed, 0x26, 0x6d, 0xb5, 0xe0, 0x7c, 0x4f, 0x63, 0xee, 
+  0x04, 0x0c, 0x16, 0x1b, 0xc5, 0x08, 0xea, 0xac, 0x9a, 0x19, 0xb2, 0x67, 0x99, 0x39, 0x9b, 0x3a, 
+  0x73, 0x39, 0x33, 0x27, 0x52, 0xcd, 0x0f, 0x9f, 0x4a, 0x31, 0x14, 0xa3, 0xf6, 0x77, 0xfa, 0x68, 
+  0x55, 0xd5, 0x6a, 0x4e, 0xb4, 0x68, 0x7e, 0x7d, 0x33, 0xab, 0xfd, 0x6a, 0xf6, 0x83, 0xa7, 0x65, 
+  0xaf, 0xba, 0xab, 0xd7, 0x57, 0x94, 0x72, 0xad, 0x4f, 0x33, 0xdc, 0x47, 0x95, 0xed, 0x91, 0x72, 
+  0xd0, 0x33, 0xf5, 0x9b, 0x5c, 0xb6, 0x70, 0xbf, 0xa5, 0x1d, 0x36, 0x49, 0x6d, 0x0c, 0xd9, 0x43, 
+  0x93, 0x6a, 0xdf, 0x0b, 0x6d, 0x98, 0xc8, 0x7c, 0xba, 0x03, 0x98, 0x2e, 0x0f, 0x2f, 0x7c, 0xb7, 
+  0x92, 0xe8, 0xc1, 0x7a, 0xbc, 0x34, 0xa8, 0xae, 0x89, 0x93, 0x6b, 0x42, 0x3a, 0x30, 0x5f, 0x8a, 
+  0x8e, 0x3a, 0x27, 0xa0, 0xc6, 0x52, 0x19, 0x8f, 0xa7, 0xaa, 0xd6, 0x99, 0x89, 0x3e, 0xa1, 0x0b, 
+  0x2b, 0x42, 0xa0, 0xdf, 0x4d, 0xea, 0x45, 0x43, 0xdf, 0xd2, 0x06, 0x35, 0x05, 0xea, 0x39, 0x6c, 
+  0x74, 0x40, 0x5a, 0x58, 0xa0, 0xea, 0x70, 0xc0, 0x72, 0x20, 0xe4, 0xa6, 0x0f, 0x16, 0xe1, 0x9c, 
+  0x77, 0x3c, 0x91, 0xb6, 0xf6, 0xbd, 0x27, 0x08, 0x6f, 0x7e, 0xb0, 0xe3, 0x8d, 0x2e, 0xba, 0xca, 
+  0x13, 0xf5, 0xf5, 0x8c, 0x03, 0x66, 0x5b, 0x94, 0xd7, 0x3e, 0x06, 0x66, 0xd6, 0xef, 0x42, 0x8b, 
+  0x48, 0x6a, 0x03, 0xe1, 0x77, 0x3d, 0xc9, 0xdb, 0x8e, 0x09, 0x9e, 0x26, 0xe2, 0x6f, 0x68, 0xaf, 
+  0xd7, 0x96, 0x52, 0x3d, 0x66, 0xe2, 0xf7, 0xd0, 0x1c, 0x67, 0xa3, 0xf3, 0xd8, 0x6b, 0xfc, 0xa0, 
+  0x66, 0x46, 0xd4, 0xd6, 0x29, 0x63, 0xe5, 0xcf, 0xc8, 0xe4, 0x01, 0xc2, 0x4d, 0xdc, 0x6e, 0xfc, 
+  0x43, 0x73, 0x7b, 0x07, 0xea, 0xb4, 0xff, 0x6e, 0xf0, 0x49, 0x5f, 0x31, 0x15, 0x19, 0xad, 0xd1, 
+  0x53, 0xbe, 0xfc, 0xfe, 0xab, 0xe0, 0xf8, 0x99, 0xe3, 0x28, 0xe5, 0xf1, 0xb7, 0x1e, 0x27, 0xab, 
+  0x7f, 0x17, 0xed, 0x49, 0x8b, 0xc2, 0x2e, 0x0a, 0x02, 0xfb, 0x01, 0xa4, 0xfe, 0x29, 0x05, 0x1c, 
+  0x65, 0x68, 0xab, 0x13, 0x03, 0x5a, 0xaa, 0x50, 0x2f, 0x2a, 0x42, 0xdb, 0x16, 0xb1, 0xd3, 0xb6, 
+  0x88, 0x98, 0x86, 0x00, 0xe3, 0x84, 0xa9, 0x8e, 0xab, 0xa0, 0x9c, 0x4f, 0x9c, 0x50, 0x2e, 0x19, 
+  0xd1, 0xdc, 0x07, 0xf8, 0xf0, 0xf8, 0x6c, 0xee, 0x7b, 0x3a, 0x50, 0x2a, 0x3a, 0x24, 0x3c, 0xc9, 
+  0x11, 0xc1, 0xb4, 0x28, 0x5f, 0x18, 0x51, 0xf1, 0x15, 0x32, 0x99, 0x4e, 0x0e, 0x3c, 0xf7, 0xb3, 
+  0x32, 0x08, 0x6b, 0xe9, 0x2d, 0x32, 0xdd, 0x5f, 0xb6, 0x53, 0xbf, 0x8d, 0x39, 0x46, 0x01, 0xdd, 
+  0x96, 0xec, 0x20, 0xe6, 0xe4, 0x4a, 0x88, 0xcb, 0x8a, 0x2d, 0x38, 0x94, 0x05, 0xe5, 0x9f, 0x26, 
+  0xf6, 0x28, 0x51, 0x0c, 0xba, 0xae, 0xdc, 0x76, 0xaa, 0x6a, 0x8a, 0x72, 0x3f, 0x7f, 0xf4, 0x83, 
+  0x62, 0x95, 0x43, 0xa9, 0x1c, 0xaf, 0x4b, 0xa5, 0xca, 0x1a, 0xe7, 0x44, 0xbd, 0xf3, 0x5e, 0xf4, 
+  0xac, 0x8f, 0xc8, 0xff, 0x86, 0x2e, 0xf7, 0x10, 0xd5, 0x50, 0xc2, 0xe6, 0x67, 0x16, 0xd1, 0x53, 
+  0xab, 0x0d, 0x4a, 0x09, 0x02, 0x9c, 0x43, 0x2e, 0x3f, 0x19, 0x68, 0x61, 0x96, 0x58, 0x46, 0x75, 
+  0x30, 0x03, 0x22, 0x5a, 0xf5, 0x63, 0x53, 0xb6, 0x19, 0xbe, 0xf9, 0xf3, 0x72, 0x50, 0x82, 0xcc, 
+  0xc1, 0x09, 0xba, 0x9c, 0xa9, 0xf0, 0xf7, 0x44, 0xe2, 0xe6, 0x34, 0x7a, 0xf7, 0x95, 0xf7, 0xd4, 
+  0x43, 0x5a, 0xab, 0x08, 0x61, 0x0d, 0x13, 0x1b, 0x5d, 0xe0, 0x24, 0x36, 0xe6, 0x3e, 0xca, 0x46, 
+  0x4e, 0x9b, 0x1d, 0xc2, 0x94, 0xda, 0xaa, 0xdc, 0xf2, 0xaa, 0x0b, 0x73, 0x04, 0x93, 0x76, 0x26, 
+  0x23, 0xd6, 0xd3, 0x31, 0x07, 0x1e, 0xd3, 0x67, 0xcf, 0x4e, 0x68, 0x58, 0x37, 0x7c, 0xec, 0x40, 
+  0x65, 0xc3, 0x73, 0xe7, 0xde, 0x38, 0xef, 0xf3, 0xae, 0xd8, 0x41, 0x56, 0xae, 0x9f, 0x1e, 0xc5, 
+  0xd6, 0xb6, 0x7c, 0x5c, 0xa5, 0x02, 0xff, 0x27, 0x21, 0x06, 0x2c, 0x2c, 0x71, 0xac, 0x8e, 0x3e, 
+  0x6b, 0xae, 0x50, 0x3a, 0x16, 0xb8, 0x37, 0xb7, 0xb4, 0xa1, 0x8f, 0xdc, 0x1e, 0xd1, 0xa8, 0xef, 
+  0x97, 0xc7, 0xd5, 0x43, 0xa8, 0x5f, 0x4c, 0xb7, 0xd5, 0xf4, 0x14, 0x4d, 0x43, 0x2d, 0xf3, 0x9c, 
+  0xd6, 0x6c, 0x40, 0x04, 0x10, 0x89, 0xb6, 0x6d, 0xe6, 0xbe, 0x2a, 0xdb, 0x16, 0x62, 0xdb, 0xce, 
+  0x61, 0x91, 0x3e, 0x43, 0xca, 0xcb, 0x11, 0x09, 0xbd, 0x84, 0x02, 0xfd, 0x04, 0x59, 0x3b, 0x9b, 
+  0x85, 0x46, 0x62, 0x38, 0xd3, 0x7e, 0xd6, 0x6e, 0x64, 0xdc, 0xf9, 0x0c, 0xb6, 0xf0, 0xa0, 0xe7, 
+  0x51, 0x61, 0x03, 0xd4, 0x2a, 0x67, 0xde, 0x0c, 0xd1, 0x79, 0xd7, 0x45, 0x2d, 0xb3, 0x2a, 0x04, 
+  0x95, 0x75, 0xe9, 0x3c, 0x23, 0xb1, 0xf1, 0x41, 0xdb, 0x72, 0x9d, 0x31, 0x02, 0x81, 0x26, 0x43, 
+  0xa1, 0x92, 0x70, 0x8f, 0x29, 0xd9, 0xc1, 0x6b, 0xcd, 0xf8, 0x33, 0x69, 0x29, 0x38, 0x91, 0x05, 
+  0x2c, 0x25, 0xf5, 0xc3, 0xef, 0x14, 0xdd, 0x0b, 0x4b, 0x61, 0x27, 0x33, 0xb4, 0xd3, 0x6d, 0xa6, 
+  0x2f, 0x2c, 0xed, 0x4c, 0x0a, 0x35, 0x4b, 0x08, 0x99, 0xa7, 0x03, 0x91, 0xe1, 0x3e, 0x6c, 0x4f, 
+  0x14, 0xcc, 0xef, 0x68, 0xd0, 0x73, 0x90, 0x57, 0xe5, 0x14, 0xa1, 0x2e, 0x07, 0xb5, 0x11, 0x4c, 
+  0xe1, 0x29, 0xaf, 0x5f, 0xa8, 0x01, 0xd8, 0xb9, 0xb7, 0xab, 0xa5, 0x43, 0x7b, 0xe3, 0x7c, 0x02, 
+  0x3e, 0x53, 0x2d, 0xbe, 0x3c, 0x60, 0xb9, 0xe5, 0xa4, 0xb1, 0xbc, 0x21, 0xf3, 0xac, 0xb1, 0xeb, 
+  0x55, 0x3a, 0x56, 0x66, 0x89, 0x9d, 0x21, 0xf1, 0xdd, 0x29, 0xf3, 0xdd, 0x76, 0xe9, 0x4b, 0xb5, 
+  0xf4, 0xa3, 0xca, 0x54, 0x73, 0xe2, 0x7f, 0xf8, 0xc2, 0x0a, 0xa4, 0xa4, 0x0f, 0x0b, 0x37, 0x89, 
+  0x9c, 0x79, 0x6c, 0xc8, 0xbf, 0x58, 0xc1, 0xc7, 0x1d, 0x8b, 0xcc, 0xbd, 0xe8, 0x3c, 0xe2, 0x71, 
+  0xcf, 0x05, 0x52, 0xe5, 0xef, 0x40, 0x43, 0x48, 0x90, 0x4e, 0x24, 0xfa, 0x93, 0xa6, 0x60, 0x26, 
+  0x10, 0x49, 0x2f, 0x9d, 0x89, 0x3a, 0x27, 0x9e, 0x29, 0xad, 0x0e, 0x72, 0xc1, 0xe9, 0x02, 0x11, 
+  0xd2, 0xa1, 0xd1, 0x8c, 0x75, 0x38, 0xf2, 0x94, 0x0f, 0x6c, 0x14, 0x65, 0xc2, 0x26, 0xb0, 0x48, 
+  0x67, 0x4d, 0xdd, 0x45, 0xce, 0xca, 0x0a, 0x25, 0xd7, 0xb0, 0xbe, 0x22, 0xb0, 0x7d, 0x40, 0x9c, 
+  0x53, 0xf5, 0x02, 0x91, 0xde, 0x6c, 0x1d, 0x39, 0x22, 0x5d, 0xa9, 0x4e, 0xc2, 0x31, 0x47, 0x35, 
+  0x9a, 0x22, 0x19, 0x2f, 0x5d, 0x25, 0xda, 0xde, 0x11, 0x79, 0x50, 0xa2, 0x64, 0xe7, 0xaf, 0x5a, 
+  0x17, 0x3f, 0xb0, 0x3b, 0x90, 0xcf, 0x02, 0x6a, 0x58, 0x05, 0x7b, 0x91, 0x91, 0xd3, 0x9c, 0x66, 
+  0xc4, 0x7c, 0x6e, 0x71, 0xd4, 0xbd, 0x9f, 0xb2, 0xff, 0x5c, 0xc0, 0x02, 0x90, 0x1b, 0x9b, 0x7b, 
+  0xae, 0x68, 0xbd, 0x6e, 0x8e, 0x5f, 0x04, 0x5c, 0x34, 0x52, 0x5f, 0x70, 0x00, 0x17, 0x0e, 0x14, 
+  0x9f, 0x56, 0xb9, 0xeb, 0x60, 0x4c, 0xb4, 0x12, 0x9b, 0x12, 0x01, 0x2b, 0xee, 0x7d, 0xd3, 0x55, 
+  0x66, 0x21, 0x11, 0xd6, 0xa0, 0xba, 0x55, 0x5d, 0xca, 0x50, 0x6e, 0x5e, 0xa5, 0xb1, 0xd4, 0x25, 
+  0xcc, 0xbd, 0xce, 0x66, 0xa9, 0x9f, 0xe2, 0xda, 0x74, 0xc7, 0x64, 0x81, 0xd2, 0xf9, 0x2d, 0xf5, 
+  0x53, 0x5c, 0x5b, 0x7c, 0xa9, 0x9f, 0xa9, 0x3b, 0x4b, 0xe9, 0x6e, 0x64, 0xee, 0x5b, 0x34, 0xb0, 
+  0x11, 0x06, 0x67, 0x40, 0xf9, 0x1a, 0xce, 0x85, 0x8a, 0x28, 0xee, 0x0e, 0x19, 0xf9, 0x8d, 0xe6, 
+  0xbb, 0xb3, 0x81, 0x25, 0xad, 0x95, 0xcf, 0xc0, 0xbc, 0x14, 0x0f, 0x86, 0x4a, 0x84, 0x0f, 0x44, 
+  0x26, 0xc2, 0x69, 0x6b, 0xa4, 0x78, 0x96, 0x57, 0xaa, 0x6d, 0xae, 0x1c, 0x89, 0x8d, 0x36, 0x52, 
+  0xd2, 0xfc, 0x2b, 0x9e, 0x4a, 0x54, 0x9a, 0x07, 0xc1, 0x7b, 0x74, 0xb6, 0x13, 0xba, 0xfa, 0xf0, 
+  0x40, 0x5e, 0x61, 0x63, 0x10, 0x2c, 0x23, 0x0e, 0x22, 0xc0, 0x21, 0xc1, 0x15, 0xbd, 0x0a, 0xab, 
+  0x14, 0xd4, 0x7b, 0x66, 0xc2, 0x30, 0x57, 0x25, 0x98, 0x73, 0x69, 0x1c, 0x01, 0x5a, 0xfd, 0x96, 
+  0xe3, 0xa6, 0xd4, 0x1f, 0xd9, 0xa8, 0xfb, 0xa5, 0x32, 0x3f, 0xd4, 0xe0, 0x55, 0x1f, 0xf4, 0x01, 
+  0xe3, 0x69, 0xb1, 0x34, 0x87, 0x57, 0x09, 0x9f, 0xe6, 0x19, 0x85, 0x19, 0xee, 0xc4, 0x5a, 0x85, 
+  0x67, 0x58, 0x40, 0x3e, 0xbe, 0x32, 0x8a, 0x5e, 0x71, 0x5b, 0xd3, 0x13, 0x27, 0x2c, 0x18, 0x5f, 
+  0xda, 0x0c, 0x07, 0xde, 0xf2, 0x1d, 0xb8, 0x29, 0x4f, 0x79, 0x34, 0xb1, 0x21, 0x6d, 0xaa, 0x16, 
+  0x0c, 0x3e, 0x53, 0xcc, 0xfe, 0xf2, 0xb6, 0xac, 0xa7, 0x1b, 0xe0, 0x7c, 0x09, 0x01, 0x0d, 0x84, 
+  0x9f, 0x22, 0x10, 0x54, 0x6c, 0x6f, 0x22, 0x9c, 0xa7, 0xc5, 0x4e, 0x16, 0x00, 0xe1, 0xde, 0xb8, 
+  0x04, 0xb6, 0xfa, 0x86, 0x28, 0x16, 0x82, 0xdf, 0x8a, 0xea, 0x49, 0xaf, 0x27, 0xd6, 0x2d, 0x04, 
+  0xbb, 0xed, 0x59, 0xf5, 0x51, 0xbf, 0x2f, 0xaa, 0xf4, 0x09, 0xdc, 0x47, 0xbd, 0x64, 0x44, 0x41, 
+  0xea, 0x69, 0x09, 0x38, 0xdd, 0x56, 0x69, 0x51, 0xd9, 0x8c, 0x38, 0xcc, 0xda, 0x79, 0x8f, 0x31, 
+  0x04, 0x61, 0x9c, 0x02, 0x49, 0xd8, 0x53, 0xac, 0x27, 0xab, 0x3f, 0x05, 0x0e, 0x75, 0xfc, 0xdb, 
+  0x09, 0x8e, 0x7c, 0x25, 0x49, 0xc4, 0x6a, 0x02, 0x55, 0x8c, 0x01, 0xbe, 0xee, 0xa8, 0xd3, 0x9d, 
+  0x4b, 0xc7, 0x13, 0xfd, 0x12, 0xf8, 0x0c, 0x67, 0x2b, 0x49, 0x8a, 0xe8, 0x86, 0x70, 0xc1, 0x5e, 
+  0x00, 0x13, 0x5d, 0x76, 0xbb, 0x97, 0x3a, 0xad, 0xbc, 0x51, 0x31, 0xe4, 0x01, 0x82, 0xf4, 0xf9, 
+  0x9b, 0xa8, 0x25, 0x0d, 0x4f, 0x40, 0xd5, 0x36, 0x9f, 0x2e, 0x82, 0xca, 0x08, 0x7a, 0xd9, 0xcc, 
+  0x9d, 0x03, 0x7d, 0xf8, 0xc0, 0xd8, 0x7f, 0x44, 0xd3, 0x2b, 0x7b, 0x2d, 0xaa, 0xcb, 0x5f, 0x9c, 
+  0xeb, 0x5f, 0x67, 0x42, 0xaf, 0xfa, 0x9c, 0xfb, 0x66, 0xa2, 0x2f, 0x73, 0x80, 0xea, 0x0a, 0x6a, 
+  0x2a, 0x45, 0x6a, 0x15, 0x1a, 0xda, 0x5f, 0xb5, 0x84, 0x74, 0xe7, 0xef, 0x26, 0x44, 0x68, 0x42, 
+  0x7f, 0xa3, 0x22, 0xd7, 0xe2, 0x40, 0x6a, 0xde, 0x8c, 0x1a, 0x4f, 0x14, 0x57, 0xb4, 0x7d, 0x2e, 
+  0xd4, 0x47, 0x38, 0xf0, 0xf3, 0x9d, 0xd3, 0xb1, 0x15, 0x2d, 0x88, 0xba, 0xeb, 0xab, 0x53, 0x76, 
+  0x3c, 0x53, 0x12, 0x65, 0x27, 0x9a, 0xb7, 0x06, 0x99, 0x5f, 0x42, 0xeb, 0xc7, 0x5a, 0xc7, 0x0d, 
+  0x87, 0x96, 0x62, 0x84, 0xe8, 0x40, 0xd1, 0x55, 0x15, 0x67, 0x7a, 0x17, 0xe8, 0x39, 0x98, 0x73, 
+  0xe4, 0x72, 0xfb, 0x86, 0xba, 0x6d, 0xeb, 0x5d, 0x41, 0x17, 0xb2, 0xa2, 0x6e, 0x55, 0xdf, 0xd5, 
+  0x7b, 0x04, 0x74, 0x6e, 0x67, 0x95, 0xea, 0xa9, 0xa6, 0x38, 0xb2, 0xa6, 0x02, 0x6d, 0xd0, 0xec, 
+  0x94, 0xab, 0xbe, 0x67, 0xaf, 0xa7, 0x6a, 0xbd, 0xdc, 0x37, 0x23, 0xf7, 0xcd, 0xaf, 0xee, 0x9b, 
+  0x67, 0xb3, 0x1d, 0x87, 0xfa, 0xee, 0x8c, 0xc4, 0x22, 0xc0, 0xa0, 0x2f, 0x27, 0xa6, 0x65, 0x82, 
+  0x14, 0x04, 0x3b, 0xbb, 0x45, 0x00, 0x40, 0x7e, 0x12, 0x84, 0x97, 0x6e, 0x3a, 0x13, 0x83, 0x15, 
+  0xc4, 0x83, 0xb1, 0x66, 0xc0, 0xa4, 0xe0, 0x70, 0xc5, 0x7c, 0x10, 0x75, 0x6e, 0x03, 0x71, 0xdb, 
+  0xed, 0x3a, 0x8b, 0xba, 0x3f, 0xa7, 0x16, 0x2c, 0x6f, 0xb7, 0x5b, 0xbd, 0x90, 0xc2, 0x0d, 0x6f, 
+  0x65, 0x70, 0x0f, 0xf5, 0xcf, 0x01, 0x7f, 0x81, 0x8d, 0x11, 0xa8, 0xbe, 0x93, 0xc4, 0x71, 0x3b, 
+  0xc1, 0x06, 0x09, 0x87, 0xf4, 0x62, 0x4d, 0x6c, 0x33, 0xaa, 0xbb, 0xc4, 0x60, 0xb0, 0x7b, 0x36, 
+  0x5a, 0x8f, 0x72, 0xcb, 0x46, 0x33, 0x50, 0x60, 0x99, 0x27, 0xfa, 0x37, 0x1a, 0x92, 0x38, 0x36, 
+  0xab, 0xb0, 0x6c, 0x33, 0xf9, 0xca, 0xa4, 0x2e, 0x37, 0x18, 0xcc, 0x2c, 0x83, 0xb0, 0xfe, 0x82, 
+  0x19, 0x3e, 0xa9, 0x6d, 0x32, 0x89, 0x63, 0x20, 0x34, 0xd7, 0x8a, 0xad, 0x61, 0x7e, 0xdb, 0x9a, 
+  0x0a, 0x79, 0x52, 0x67, 0xa3, 0xc3, 0x07, 0x43, 0x78, 0x43, 0x12, 0x07, 0x3a, 0x24, 0x93, 0x96, 
+  0xc8, 0x3a, 0xca, 0xb9, 0x91, 0x2b, 0x46, 0x57, 0x1a, 0x56, 0x5a, 0xbd, 0x47, 0x66, 0xae, 0x7b, 
+  0x36, 0xc3, 0x2b, 0x9d, 0x2c, 0xb7, 0x44, 0x8d, 0xb3, 0xe5, 0x72, 0x92, 0x5b, 0xa6, 0x38, 0x1a, 
+  0x86, 0xe6, 0x44, 0xcc, 0x7a, 0xc0, 0x56, 0x6f, 0x39, 0xbe, 0xbe, 0xb9, 0xc1, 0x64, 0x2a, 0xc1, 
+  0x1b, 0x43, 0x2a, 0xdc, 0x4a, 0x9c, 0xc7, 0xd3, 0xea, 0xf1, 0x2c, 0x6c, 0x2f, 0x62, 0x79, 0x7c, 
+  0x73, 0x3a, 0x97, 0x2b, 0x3c, 0x4c, 0x3d, 0xe6, 0xf4, 0x6a, 0x96, 0xa4, 0xe8, 0x2b, 0xce, 0x95, 
+  0x02, 0x07, 0xa5, 0x6c, 0xb5, 0xa0, 0xb7, 0x66, 0x32, 0x44, 0x75, 0xe9, 0x12, 0x8a, 0x7b, 0x9f, 
+  0x0b, 0xd2, 0xc0, 0xf9, 0xb7, 0xd2, 0x88, 0xa1, 0x06, 0xdd, 0x4e, 0x23, 0x2b, 0x89, 0x7e, 0x0e, 
+  0xfd, 0xe1, 0xae, 0xae, 0x76, 0x5e, 0xc6, 0x84, 0x19, 0xb3, 0xc3, 0x4e, 0xd3, 0x2a, 0x9e, 0x8d, 
+  0x32, 0x62, 0x4e, 0xe0, 0x94, 0x5a, 0x20, 0xc5, 0x8c, 0x3e, 0x7f, 0x16, 0x43, 0x13, 0xb9, 0x1d, 
+  0xd0, 0x06, 0x99, 0x92, 0xd9, 0x19, 0x92, 0x99, 0xcc, 0x31, 0x70, 0xb9, 0x53, 0xf1, 0x41, 0x61, 
+  0x41, 0xaf, 0xde, 0xed, 0x85, 0x0e, 0x35, 0xd9, 0xd1, 0xf7, 0xd1, 0x3b, 0x67, 0xf6, 0xe1, 0x19, 
+  0xd5, 0xc7, 0x86, 0x6e, 0x06, 0x5d, 0xa3, 0x65, 0x9d, 0xeb, 0x40, 0x6d, 0x2e, 0x44, 0xe1, 0xd3, 
+  0x60, 0x0c, 0xd1, 0xcf, 0x8d, 0xe4, 0xb6, 0x4c, 0xd2, 0xa4, 0xb8, 0x62, 0x24, 0xac, 0x82, 0x3f, 
+  0xc0, 0x50, 0xcc, 0x82, 0x4e, 0x3c, 0x50, 0xef, 0xa3, 0x58, 0x80, 0x5a, 0xa9, 0x8c, 0x51, 0x3c, 
+  0x6b, 0x4e, 0xca, 0xac, 0x58, 0x6b, 0x37, 0xd5, 0xd4, 0xea, 0xf7, 0x38, 0x96, 0x69, 0x08, 0x3e, 
+  0x09, 0x0d, 0xcd, 0xda, 0xd7, 0xb4, 0x59, 0xd9, 0xa2, 0xb8, 0xb1, 0xaf, 0x54, 0x77, 0x02, 0x71, 
+  0xb3, 0x77, 0x87, 0xd2, 0xea, 0xa8, 0x54, 0x9b, 0xc8, 0xcc, 0x02, 0x7a, 0x6b, 0xb3, 0xb3, 0xe8, 
+  0x80, 0x7d, 0x89, 0x56, 0x94, 0xaa, 0x6e, 0x25, 0x55, 0x4e, 0x19, 0xf1, 0x48, 0x12, 0x1d, 0x44, 
+  0x61, 0xd0, 0x36, 0xfc, 0x38, 0x20, 0xae, 0xe5, 0x72, 0x11, 0x00, 0x67, 0xe6, 0x6a, 0x0b, 0x9b, 
+  0xff, 0x89, 0x21, 0x4c, 0xb9, 0x5b, 0xe5, 0x9c, 0x0f, 0x0b, 0x7f, 0xb9, 0xeb, 0xdd, 0x6e, 0xec, 
+  0xe7, 0xec, 0x79, 0x60, 0x23, 0xfe, 0xf1, 0x89, 0x68, 0xbe, 0x5f, 0x30, 0x29, 0x2b, 0xeb, 0x59, 
+  0xf3, 0x91, 0x52, 0xd8, 0xa4, 0xb5, 0x8c, 0x5b, 0xb0, 0xde, 0x65, 0x06, 0xb6, 0x63, 0xe2, 0x0d, 
+  0xd8, 0x9e, 0xf2, 0x2b, 0xee, 0xab, 0x62, 0x2c, 0x7c, 0x7e, 0x00, 0xe8, 0x52, 0x8b, 0x9a, 0x21, 
+  0x6b, 0x0d, 0x1c, 0x4b, 0x4d, 0xbc, 0xc4, 0x52, 0x8c, 0x82, 0x60, 0xdc, 0xa1, 0xc9, 0xca, 0xc0, 
+  0x58, 0xd4, 0x36, 0x46, 0x12, 0xa8, 0x10, 0x52, 0x58, 0xf9, 0x6a, 0xf9, 0xe2, 0x2a, 0xb8, 0x31, 
+  0xec, 0x6c, 0x39, 0x26, 0x6f, 0xac, 0xf3, 0x62, 0x3d, 0x32, 0xa5, 0x34, 0x9f, 0xce, 0x54, 0x09, 
+  0xe4, 0xd5, 0x8e, 0x4d, 0x8e, 0x25, 0x95, 0x5f, 0x3b, 0xae, 0xcd, 0xf2, 0x8c, 0x5d, 0xc0, 0xf4, 
+  0x34, 0x67, 0x48, 0xdb, 0x58, 0x49, 0xc6, 0x3c, 0x29, 0x06, 0x24, 0x69, 0xa9, 0x6a, 0x29, 0x8f, 
+  0x62, 0x5e, 0x5b, 0x44, 0x8f, 0xd4, 0xd3, 0xaa, 0x7e, 0x1d, 0xbf, 0xdc, 0x0e, 0xe7, 0xee, 0xb1, 
+  0x7a, 0x25, 0xc9, 0x16, 0x68, 0x44, 0x71, 0xd4, 0xe9, 0x89, 0x9a, 0x53, 0x58, 0x05, 0x48, 0x3d, 
+  0x95, 0x91, 0x1a, 0x26, 0x3f, 0xa8, 0xa6, 0x12, 0xb5, 0x24, 0x66, 0x1a, 0x25, 0x4f, 0x23, 0xfa, 
+  0x25, 0xa3, 0xe1, 0x58, 0x9e, 0x64, 0x63, 0xc9, 0xe7, 0x62, 0x12, 0xca, 0x6b, 0x7c, 0xa7, 0x3a, 
+  0x5b, 0xbb, 0x71, 0x70, 0x93, 0xb5, 0x26, 0xd6, 0xaf, 0x76, 0x41, 0xed, 0xa8, 0x5b, 0x33, 0x94, 
+  0x42, 0xb1, 0x8c, 0x42, 0x31, 0x93, 0xb5, 0x03, 0x6f, 0x07, 0x51, 0x2c, 0x53, 0xa4, 0xef, 0xd4, 
+  0xbf, 0xd1, 0x81, 0xa4, 0x7c, 0x5a, 0x5b, 0x4d, 0xcb, 0xd6, 0x92, 0xaf, 0x22, 0x69, 0x37, 0x79, 
+  0x56, 0xbb, 0xdb, 0x60, 0xb1, 0x02, 0x69, 0x3a, 0x78, 0x26, 0x55, 0x5a, 0x3f, 0xe7, 0x90, 0xb2, 
+  0x58, 0x51, 0xff, 0x5e, 0x66, 0x77, 0x69, 0x48, 0x85, 0x34, 0xcb, 0x2b, 0xf8, 0xe1, 0x4f, 0x6b, 
+  0x7e, 0xc4, 0xfd, 0xd7, 0x8f, 0xde, 0xa8, 0x4c, 0x1a, 0x78, 0xac, 0x87, 0x19, 0x08, 0xe0, 0xdd, 
+  0xaf, 0xd2, 0xca, 0xee, 0x47, 0xd5, 0xb1, 0xe3, 0xe7, 0xdf, 0x6d, 0x4a, 0xe7, 0x05, 0xd7, 0xa4, 
+  0x5e, 0xe8, 0x8a, 0xaa, 0x77, 0xba, 0xba, 0xdd, 0xae, 0x31, 0x51, 0xfb, 0x9e, 0x0a, 0xb5, 0xa9, 
+  0xa9, 0x8d, 0x32, 0xaf, 0x0d, 0x4f, 0x41, 0x23, 0x5c, 0x19, 0xac, 0x0e, 0x37, 0x6a, 0x81, 0xf3, 
+  0xa1, 0x83, 0x21, 0x18, 0x26, 0x6a, 0xba, 0x5a, 0x68, 0x6f, 0xdc, 0x28, 0x97, 0x04, 0x31, 0x6c, 
+  0x8e, 0xef, 0x6b, 0xbb, 0xfc, 0x0e, 0xaf, 0x4b, 0xb5, 0x41, 0x49, 0x52, 0x19, 0x05, 0xe3, 0xd4, 
+  0x8a, 0x27, 0x5a, 0xfb, 0x4d, 0x10, 0xc8, 0x4a, 0x60, 0xad, 0x10, 0x76, 0x64, 0xed, 0xa8, 0x7e, 
+  0xa4, 0xa1, 0xfa, 0x61, 0xd8, 0x12, 0xa3, 0x3c, 0x8f, 0x73, 0x8e, 0x6e, 0x54, 0x53, 0x4d, 0x47, 
+  0xa3, 0xe7, 0xce, 0x6b, 0x77, 0x64, 0x12, 0xd6, 0xa0, 0xb2, 0xc4, 0x5e, 0x83, 0xa6, 0xdc, 0x7c, 
+  0xc8, 0x9a, 0x89, 0x5a, 0x31, 0x65, 0x0e, 0x2d, 0x1c, 0x72, 0x1f, 0x11, 0x38, 0x64, 0x77, 0xe1, 
+  0xa7, 0xc3, 0x21, 0xad, 0x52, 0x51, 0x86, 0xcf, 0xe8, 0xc2, 0x6a, 0xfa, 0x3f, 0x1e, 0x0e, 0x35, 
+  0xc9, 0xa5, 0x0d, 0x10, 0x3b, 0xa9, 0xb5, 0x73, 0x51, 0x1d, 0x26, 0xe4, 0xcc, 0x3d, 0x70, 0x9c, 
+  0xeb, 0x8a, 0xcd, 0xc0, 0xd1, 0x72, 0x95, 0x80, 0x4b, 0xb8, 0x59, 0xc3, 0x44, 0x9b, 0x46, 0xa0, 
+  0xa6, 0x52, 0x07, 0x18, 0x8c, 0xcb, 0xbd, 0xee, 0x5f, 0x2b, 0x3b, 0x1f, 0x53, 0x2a, 0x55, 0xce, 
+  0x74, 0x65, 0x79, 0x30, 0x16, 0xbf, 0x48, 0x5b, 0xde, 0xa9, 0xa0, 0x24, 0xde, 0x7b, 0x22, 0xfd, 
+  0xab, 0x63, 0x3b, 0xb0, 0xfe, 0x65, 0xa9, 0x22, 0x46, 0x54, 0x31, 0xe7, 0x4c, 0xc0, 0xfd, 0xef, 
+  0xd2, 0x88, 0xed, 0x8c, 0xa8, 0x04, 0x47, 0xf5, 0xa3, 0xe7, 0xf4, 0x99, 0x0a, 0xf0, 0x4d, 0x5c, 
+  0x25, 0x7c, 0x63, 0xf5, 0xb5, 0xf0, 0x1f, 0xe9, 0x65, 0xa0, 0xbe, 0x8e, 0xbc, 0xd2, 0xab, 0x1a, 
+  0x53, 0xf9, 0x02, 0xa8, 0x46, 0xbe, 0xf8, 0x87, 0x29, 0x10, 0x55, 0xad, 0xf1, 0xc9, 0xca, 0xaa, 
+  0x14, 0xcb, 0x32, 0xd2, 0x71, 0xa7, 0x91, 0x52, 0xf3, 0x4b, 0x76, 0x82, 0x1d, 0xd7, 0xd8, 0x24, 
+  0x3c, 0x7f, 0xf4, 0x78, 0xfe, 0x8c, 0x3f, 0x3d, 0x78, 0xfe, 0x2d, 0xaa, 0xd0, 0x18, 0xff, 0x42, 
+  0x66, 0xb9, 0xea, 0xa3, 0x43, 0x89, 0x1d, 0xf7, 0xfa, 0x55, 0x37, 0x0d, 0xa8, 0x24, 0x5f, 0x10, 
+  0x6e, 0x58, 0xcd, 0x65, 0xca, 0x58, 0x8e, 0x7e, 0x9e, 0xe1, 0x27, 0xd8, 0x73, 0x93, 0xad, 0xc5, 
+  0x0d, 0x21, 0x3e, 0x1d, 0x1a, 0x51, 0x73, 0xd2, 0xef, 0xeb, 0x10, 0xf5, 0x35, 0x5f, 0x72, 0xda, 
+  0x36, 0xc0, 0xc9, 0x3c, 0x73, 0xea, 0xf4, 0xb9, 0xe1, 0x0f, 0xc7, 0x07, 0xe7, 0x4e, 0x54, 0x6f, 
+  0xa0, 0x63, 0xc3, 0x05, 0x4c, 0x56, 0x26, 0x15, 0x68, 0x50, 0x4f, 0x60, 0xcc, 0xc8, 0x9b, 0x2e, 
+  0xf8, 0x59, 0x6d, 0x26, 0x38, 0xf9, 0x71, 0x52, 0x99, 0x99, 0x25, 0xae, 0xb9, 0x5d, 0x4e, 0x34, 
+  0xcf, 0x98, 0x99, 0x95, 0x41, 0x30, 0xc9, 0x43, 0xbf, 0x91, 0x08, 0x82, 0x06, 0xd2, 0x43, 0x38, 
+  0x83, 0x54, 0x55, 0x72, 0x69, 0x2b, 0xd1, 0x81, 0x53, 0xb8, 0x0a, 0x93, 0xef, 0x12, 0x15, 0x68, 
+  0x05, 0x00, 0x6f, 0x51, 0x04, 0xa1, 0x8f, 0x4d, 0x27, 0x82, 0x89, 0xce, 0x3b, 0xcc, 0xdc, 0xad, 
+  0x19, 0x7e, 0xa8, 0x82, 0xa1, 0x3f, 0x14, 0x6d, 0x76, 0x9c, 0x1d, 0x17, 0x18, 0xa9, 0x75, 0x05, 
+  0xa2, 0x2a, 0x45, 0x21, 0x47, 0x8a, 0x31, 0xf0, 0xac, 0xb7, 0xb4, 0xd4, 0x70, 0x6a, 0x6d, 0x69, 
+  0xda, 0x12, 0x63, 0xe8, 0xb4, 0x9c, 0xba, 0x6c, 0x94, 0xaa, 0x38, 0x4a, 0x07, 0x40, 0xae, 0x79, 
+  0x70, 0xc6, 0xde, 0x5c, 0x46, 0xa7, 0x07, 0x20, 0x49, 0xf6, 0xf2, 0x0d, 0x2b, 0xa7, 0xc5, 0x28, 
+  0x99, 0xe6, 0x9c, 0x23, 0x64, 0x3f, 0xcc, 0x8b, 0xa2, 0x1d, 0xab, 0xbd, 0x53, 0x58, 0x97, 0xe6, 
+  0x30, 0x43, 0x8d, 0xa0, 0x10, 0xb5, 0x95, 0x4c, 0xa1, 0x51, 0xac, 0x8d, 0x29, 0x55, 0x4a, 0x4a, 
+  0x1b, 0x69, 0x6d, 0x1f, 0x72, 0x54, 0xf6, 0x3f, 0xdd, 0xe7, 0xe3, 0xf3, 0xbb, 0xde, 0xf1, 0x65, 
+  0xd0, 0x82, 0x0f, 0x89, 0xef, 0x2e, 0xb5, 0xc5, 0x9f, 0x5d, 0xb6, 0x31, 0x3f, 0x8a, 0x0e, 0xef, 
+  0x97, 0x06, 0xe8, 0x5a, 0xab, 0x1e, 0x86, 0xf1, 0x25, 0xd2, 0xe8, 0x09, 0xfe, 0xab, 0x72, 0x3c, 
+  0x30, 0xc0, 0xc4, 0xba, 0x96, 0x49, 0xc6, 0x90, 0xa2, 0xdf, 0x27, 0x70, 0xfe, 0xd0, 0x5e, 0x79, 
+  0x6b, 0x7d, 0x5c, 0xab, 0x42, 0x1a, 0x29, 0x7c, 0xb6, 0x35, 0x51, 0x0e, 0xb6, 0x3a, 0xde, 0x2e, 
+  0x52, 0x59, 0x2d, 0x74, 0xc1, 0x78, 0x8b, 0x37, 0x78, 0x54, 0x9d, 0xde, 0x5e, 0x39, 0x5e, 0x37, 
+  0xbe, 0x6c, 0x64, 0xd7, 0x56, 0x7e, 0x75, 0x47, 0x9e, 0x73, 0x48, 0x7a, 0x5b, 0xd6, 0x02, 0x55, 
+  0xb8, 0x9b, 0x5a, 0xdb, 0x9d, 0xb8, 0x09, 0x54, 0x56, 0x71, 0xc1, 0x21, 0xae, 0x3d, 0xc7, 0xb6, 
+  0xf9, 0xd2, 0xad, 0xa1, 0x7e, 0x9e, 0x41, 0x02, 0xbc, 0x0c, 0xdb, 0x5c, 0x66, 0xeb, 0x1d, 0xab, 
+  0x27, 0x25, 0x5b, 0xd7, 0x02, 0xde, 0xb6, 0xa2, 0x50, 0x75, 0xfc, 0xff, 0x38, 0x0a, 0xad, 0xc7, 
+  0xcd, 0x7d, 0x0f, 0x0a, 0x75, 0x3c, 0xd8, 0xa6, 0xaa, 0xfa, 0x57, 0xc9, 0x3b, 0x3e, 0xd2, 0x92, 
+  0xb3, 0x26, 0x2a, 0xdd, 0xeb, 0xdf, 0xbf, 0x89, 0x4a, 0x0f, 0xe0, 0x48, 0x90, 0x18, 0xd3, 0x01, 
+  0x80, 0x65, 0xc9, 0xcc, 0xbf, 0x63, 0xb3, 0x33, 0xab, 0x21, 0xc0, 0x0f, 0x47, 0x70, 0x92, 0x4d, 
+  0x66, 0x3f, 0x10, 0x99, 0x49, 0x0e, 0xcc, 0x6b, 0x5b, 0x25, 0x64, 0x15, 0x5f, 0x28, 0x43, 0xec, 
+  0x76, 0x43, 0x96, 0x06, 0xd2, 0x43, 0x24, 0x2b, 0xb6, 0x04, 0x76, 0x1c, 0xc5, 0x27, 0x6c, 0x46, 
+  0xf8, 0x55, 0x8a, 0x08, 0x47, 0xa3, 0x61, 0x10, 0xae, 0x4b, 0x13, 0x4c, 0xcf, 0x04, 0x05, 0x41, 
+  0x28, 0xfe, 0xfd, 0x87, 0x1c, 0x48, 0x2d, 0x97, 0xcb, 0xc9, 0x30, 0xec, 0x8f, 0x80, 0xaf, 0xf4, 
+  0xec, 0x84, 0x50, 0x94, 0x11, 0xdb, 0x5b, 0xde, 0xac, 0x5e, 0x65, 0xb9, 0x27, 0x18, 0x38, 0x43, 
+  0x05, 0xa3, 0xf8, 0xd0, 0xc3, 0xb2, 0xd5, 0xd8, 0x04, 0x26, 0x30, 0x8e, 0x59, 0x88, 0xe1, 0x1e, 
+  0x0e, 0x0c, 0x49, 0xba, 0x1e, 0xca, 0xae, 0x53, 0x6b, 0xcd, 0x51, 0xdf, 0xf5, 0xd2, 0x37, 0x35, 
+  0xf2, 0x4c, 0x09, 0xc5, 0xff, 0x15, 0xef, 0xaf, 0x1b, 0x46, 0x04, 0x65, 0xe3, 0xe3, 0x0f, 0x6d, 
+  0xa5, 0x21, 0x1d, 0xe9, 0x55, 0x42, 0x16, 0x24, 0x19, 0x2f, 0xbe, 0x4b, 0x57, 0xf7, 0x70, 0x87, 
+  0x8a, 0xdf, 0x7d, 0xcd, 0x9b, 0x03, 0x99, 0x8f, 0xe4, 0x6a, 0xa5, 0x1d, 0xaa, 0xf4, 0xdd, 0xf7, 
+  0xda, 0xae, 0x81, 0x3e, 0xc9, 0xee, 0xe8, 0x55, 0x8a, 0xe7, 0xd9, 0x4a, 0x5f, 0x6d, 0x0a, 0xf9, 
+  0x4d, 0x8c, 0x2c, 0xa8, 0x4b, 0xd8, 0x74, 0x7c, 0xae, 0xcd, 0x56, 0x8d, 0xbf, 0xc3, 0xd9, 0x42, 
+  0x45, 0x5b, 0x76, 0x25, 0x30, 0x30, 0x24, 0x16, 0x80, 0x39, 0xca, 0x45, 0x8d, 0xca, 0xb3, 0x48, 
+  0xd9, 0x34, 0x6a, 0xa4, 0x2e, 0x9c, 0xf2, 0xf2, 0x55, 0x4a, 0x1f, 0x23, 0x43, 0xd4, 0x82, 0x7f, 
+  0x29, 0xf3, 0x45, 0x36, 0x59, 0x3c, 0xbc, 0x9d, 0xc1, 0xea, 0xeb, 0xfc, 0x80, 0xa6, 0x5e, 0xbf, 
+  0xac, 0xc5, 0xa2, 0xba, 0xd5, 0xa2, 0x77, 0xa0, 0xe3, 0x4f, 0x91, 0xdc, 0x71, 0xc9, 0xe7, 0x04, 
+  0x06, 0x89, 0x68, 0x52, 0xc6, 0xf8, 0x60, 0x63, 0x72, 0x6f, 0x25, 0xd1, 0x2d, 0x38, 0x61, 0xa4, 
+  0xd8, 0x05, 0xcb, 0xe1, 0x1c, 0x16, 0x10, 0x4a, 0xed, 0x5d, 0xe1, 0x14, 0x04, 0x91, 0xc7, 0x4d, 
+  0x40, 0x7d, 0xe4, 0xcb, 0x92, 0x24, 0xc9, 0xe3, 0xeb, 0xbc, 0xb2, 0x8b, 0xa7, 0xa2, 0x19, 0x17, 
+  0x63, 0x17, 0xf7, 0xbc, 0x17, 0xa9, 0xbb, 0x71, 0x82, 0x6d, 0x58, 0x44, 0x54, 0x4d, 0xae, 0x32, 
+  0xe4, 0x16, 0x2d, 0xa8, 0x57, 0x14, 0x36, 0xb2, 0x92, 0x0a, 0xbc, 0xa0, 0x7d, 0x30, 0xff, 0x6f, 
+  0xcc, 0x9d, 0x53, 0xf5, 0x7b, 0xa6, 0xaf, 0xb3, 0x87, 0x84, 0x6b, 0xf2, 0x23, 0x50, 0x82, 0xe9, 
+  0x3f, 0x22, 0x47, 0xfc, 0xff, 0x31, 0xe1, 0x5c, 0x5f, 0x7f, 0x74, 0xd2, 0x36, 0xf1, 0xb4, 0x1c, 
+  0x51, 0x6e, 0x43, 0x32, 0xd9, 0xe7, 0xe2, 0x7f, 0xb0, 0x0c, 0x4a, 0xbe, 0x6e, 0x2c, 0x43, 0x62, 
+  0x58, 0x8c, 0xca, 0x6f, 0x83, 0xed, 0xd0, 0x1d, 0x97, 0x8e, 0xac, 0x99, 0x21, 0xdd, 0x5a, 0xa5, 
+  0xef, 0x2b, 0x23, 0x08, 0x4b, 0xc4, 0x93, 0x52, 0x29, 0x19, 0x2d, 0x5c, 0x27, 0x5a, 0x15, 0xe1, 
+  0x2e, 0x16, 0x3d, 0x43, 0x45, 0x93, 0xc7, 0x97, 0xd7, 0xe9, 0xb2, 0x9f, 0xb4, 0x2e, 0x2f, 0x47, 
+  0x4b, 0xa6, 0x25, 0x0e, 0x1f, 0xd3, 0x64, 0x01, 0xc6, 0x94, 0x79, 0x86, 0x52, 0xcf, 0xb1, 0xc0, 
+  0x6f, 0xb4, 0xcc, 0x58, 0x64, 0x58, 0x10, 0xc0, 0x10, 0x9a, 0x97, 0x05, 0xc9, 0x9c, 0x0a, 0xd5, 
+  0x26, 0x42, 0xb1, 0xd6, 0xba, 0x2d, 0x83, 0x30, 0xad, 0x06, 0x26, 0xb5, 0x92, 0xd0, 0x52, 0x34, 
+  0xd0, 0x2d, 0x33, 0x27, 0x1d, 0x9e, 0x39, 0x40, 0x91, 0x05, 0x45, 0x64, 0x00, 0x29, 0xac, 0x0a, 
+  0xf7, 0xed, 0x5b, 0x4b, 0x06, 0xde, 0xbe, 0xf5, 0x84, 0x89, 0x55, 0x59, 0xd4, 0xb8, 0x9b, 0xbd, 
+  0x47, 0x76, 0x79, 0xa5, 0x56, 0xec, 0x26, 0x38, 0xae, 0x72, 0x55, 0xc3, 0xf5, 0x7a, 0x99, 0x11, 
+  0x0a, 0x54, 0x68, 0x12, 0x3d, 0xac, 0xf6, 0x04, 0x23, 0x91, 0xd6, 0xd3, 0x45, 0x00, 0x36, 0x09, 
+  0x60, 0x33, 0xb0, 0x9e, 0x1b, 0x58, 0x6f, 0x42, 0x38, 0xc1, 0xae, 0xaf, 0xa1, 0x9c, 0x37, 0x81, 
+  0x82, 0x74, 0x0b, 0xcd, 0x76, 0x13, 0x77, 0x86, 0x63, 0x9b, 0x5f, 0x4d, 0xf3, 0x91, 0x37, 0xc4, 
+  0x1e, 0x9e, 0xe7, 0xc7, 0x97, 0x75, 0xc9, 0x94, 0x98, 0xfe, 0xaa, 0x73, 0x96, 0x63, 0x91, 0x84, 
+  0x1f, 0x6c, 0x9c, 0x14, 0xab, 0xe2, 0x6e, 0x6c, 0x67, 0xe4, 0x2e, 0xbb, 0xc7, 0x46, 0x6c, 0x87, 
+  0x28, 0x65, 0xc9, 0xba, 0x17, 0xc2, 0x07, 0x67, 0xa8, 0x4a, 0x24, 0x2a, 0x69, 0x22, 0xd3, 0x1a, 
+  0x88, 0x19, 0x20, 0xa4, 0x4e, 0xf9, 0x01, 0xad, 0x3b, 0x01, 0x6b, 0x04, 0x2b, 0x69, 0xeb, 0x92, 
+  0x64, 0x60, 0x7e, 0x52, 0xf6, 0xf0, 0xa2, 0x69, 0xb0, 0xce, 0xf1, 0x02, 0x95, 0xb9, 0x47, 0xd9, 
+  0x16, 0xcd, 0x49, 0xeb, 0xf4, 0xb0, 0x7c, 0x34, 0xdd, 0x1e, 0x4e, 0xc5, 0x58, 0x30, 0xa3, 0xf6, 
+  0x1c, 0xcb, 0x67, 0x9d, 0x84, 0xa5, 0xf9, 0xb8, 0x3d, 0x46, 0x19, 0xdb, 0xd5, 0x68, 0x4e, 0x2b, 
+  0x77, 0x38, 0xad, 0xbc, 0x02, 0xbb, 0x52, 0x78, 0x2c, 0x5a, 0xb1, 0xc3, 0x13, 0x57, 0xa5, 0x24, 
+  0xad, 0x12, 0x30, 0x42, 0xdb, 0x68, 0xd2, 0xe8, 0x43, 0x5b, 0x07, 0x1e, 0x6b, 0xfd, 0x72, 0xbf, 
+  0x75, 0x1f, 0x31, 0x74, 0x19, 0x3e, 0x6d, 0xdb, 0x6d, 0x3c, 0x37, 0xa2, 0xfe, 0xa8, 0xce, 0x20, 
+  0x2a, 0xa7, 0x41, 0x7d, 0x37, 0x9c, 0x57, 0x3b, 0x74, 0x27, 0xcb, 0x24, 0x1d, 0xab, 0x71, 0xbc, 
+  0xa6, 0x77, 0xa1, 0x49, 0x7a, 0xfb, 0x61, 0x3c, 0xa0, 0xee, 0x8f, 0x1b, 0x97, 0xb9, 0xc3, 0xe6, 
+  0xc6, 0x57, 0xf0, 0x2d, 0xe2, 0x18, 0x5b, 0x92, 0x3d, 0xb8, 0x14, 0x43, 0x73, 0xa0, 0x56, 0x1d, 
+  0x02, 0xcd, 0x64, 0x50, 0x2d, 0x98, 0xc5, 0xae, 0xf3, 0x4a, 0x40, 0xa9, 0xfc, 0xa0, 0xaf, 0x8f, 
+  0x99, 0x75, 0xe0, 0xd2, 0x22, 0x8a, 0x59, 0x41, 0x10, 0x72, 0xda, 0x93, 0x78, 0x92, 0xf5, 0x46, 
+  0xa1, 0x55, 0x75, 0x2b, 0x8f, 0x87, 0xec, 0x64, 0x38, 0xd9, 0x84, 0xf4, 0x8a, 0x8d, 0x40, 0x37, 
+  0xc6, 0x86, 0xc9, 0xf7, 0x59, 0x8e, 0xb5, 0x39, 0x45, 0xc0, 0x3b, 0xe6, 0x9c, 0xf2, 0xb4, 0xdb, 
+  0xed, 0xa4, 0x36, 0x47, 0x09, 0x6c, 0x64, 0x53, 0x97, 0x35, 0x33, 0x2f, 0x08, 0x7f, 0xbc, 0xf4, 
+  0xdd, 0x37, 0xf0, 0xc5, 0x54, 0xc9, 0x60, 0x11, 0x26, 0x52, 0x45, 0x67, 0x3b, 0xa3, 0x2d, 0xa5, 
+  0x76, 0x80, 0xa8, 0x8c, 0xdb, 0xc6, 0x5a, 0x3d, 0x59, 0x5a, 0x0a, 0x53, 0xec, 0x3b, 0x42, 0x35, 
+  0x52, 0x76, 0xd7, 0x26, 0x07, 0xbb, 0xe2, 0x5a, 0x9a, 0x8d, 0xe2, 0x1a, 0x8d, 0x72, 0xce, 0x72, 
+  0x9f, 0x0d, 0x46, 0x63, 0x67, 0x64, 0x51, 0x2d, 0xa1, 0x68, 0x05, 0x8b, 0xba, 0x4e, 0x95, 0xb1, 
+  0x1b, 0x07, 0x65, 0x01, 0x3b, 0x17, 0x22, 0x01, 0x93, 0x23, 0xee, 0x36, 0xd6, 0x82, 0x2a, 0x43, 
+  0x98, 0x82, 0x5d, 0x8d, 0x2b, 0xd5, 0x0a, 0xb6, 0x4a, 0xab, 0xd7, 0xe0, 0x16, 0x6b, 0xdb, 0x6f, 
+  0x16, 0xb5, 0xab, 0x44, 0xf6, 0x7c, 0x56, 0xac, 0xcc, 0x6a, 0x02, 0x05, 0xd6, 0xc7, 0x81, 0xc8, 
+  0xb8, 0x6a, 0x72, 0x61, 0x1c, 0x5e, 0xe9, 0x11, 0x59, 0x08, 0xa8, 0xb7, 0xc8, 0xd1, 0x4d, 0x0e, 
+  0x62, 0x91, 0xbd, 0x10, 0xb9, 0x1a, 0xae, 0x27, 0x5e, 0x96, 0xd2, 0x8e, 0x51, 0xdb, 0x0a, 0xa6, 
+  0x31, 0xd4, 0x86, 0x4e, 0xdb, 0x11, 0xd1, 0x2b, 0x93, 0xc1, 0x83, 0x36, 0xec, 0x35, 0xa3, 0xe5, 
+  0x7b, 0x2d, 0xb5, 0xeb, 0x17, 0xfc, 0xb3, 0x35, 0x59, 0x38, 0x38, 0x6f, 0xc7, 0x93, 0x63, 0x71, 
+  0x51, 0xef, 0x48, 0x5b, 0x28, 0xfc, 0xb1, 0xdd, 0x98, 0x3a, 0x5a, 0x9f, 0xd8, 0xcf, 0xdc, 0xd1, 
+  0xe6, 0x06, 0x59, 0x25, 0x75, 0x8b, 0xa6, 0x34, 0x0b, 0xa7, 0x48, 0xf4, 0x7b, 0x69, 0x12, 0x77, 
+  0xe9, 0x08, 0xbc, 0x3a, 0x64, 0x6f, 0x28, 0xc5, 0x95, 0xf3, 0xce, 0x86, 0x9c, 0xe6, 0x02, 0x55, 
+  0xce, 0xa5, 0x2a, 0x1d, 0x1b, 0xed, 0x30, 0x30, 0x01, 0x59, 0xb4, 0x8c, 0xe2, 0x88, 0xc3, 0xef, 
+  0x9c, 0x0a, 0x88, 0xbe, 0x69, 0xc3, 0xf7, 0xd6, 0xbd, 0xef, 0xdc, 0x6b, 0x59, 0x6f, 0xd1, 0xdb, 
+  0x4b, 0x94, 0x08, 0x50, 0xa3, 0xe5, 0x5c, 0x54, 0xdc, 0xdb, 0x80, 0x8d, 0x50, 0x16, 0x91, 0x7f, 
+  0x15, 0x2d, 0x9c, 0x86, 0x71, 0xae, 0x0c, 0xd3, 0x03, 0x58, 0x94, 0xa8, 0x94, 0x70, 0xb0, 0x7f, 
+  0x70, 0xbe, 0x0b, 0x15, 0xa3, 0x8d, 0xb5, 0xea, 0x2d, 0x04, 0xe1, 0xc1, 0x47, 0xf2, 0xbd, 0x2c, 
+  0x44, 0xab, 0x11, 0x02, 0x09, 0xa0, 0xd4, 0x4e, 0x52, 0xbc, 0x51, 0xbd, 0x8b, 0xf2, 0xc9, 0xb3, 
+  0xf0, 0xb9, 0x70, 0x26, 0x22, 0x72, 0x12, 0x0c, 0xd2, 0xf3, 0x2a, 0x2b, 0x55, 0xe4, 0x14, 0x9a, 
+  0xfc, 0x9b, 0x69, 0xe5, 0x94, 0xb6, 0xc8, 0xe4, 0x28, 0x31, 0x29, 0xee, 0x4d, 0xd6, 0x0c, 0x15, 
+  0x4a, 0x5d, 0xa5, 0xc2, 0x00, 0x81, 0xb6, 0xf1, 0xd5, 0xa6, 0x72, 0x16, 0xd6, 0x50, 0x81, 0x60, 
+  0x3b, 0x92, 0xd5, 0xa1, 0x44, 0x79, 0x2a, 0x8f, 0x9c, 0x5e, 0x00, 0x9b, 0x34, 0x4c, 0xdf, 0x57, 
+  0x11, 0xa6, 0x34, 0xf2, 0x42, 0x7c, 0x02, 0x2a, 0x6e, 0xb2, 0xe1, 0xd0, 0xcd, 0x05, 0x47, 0x9d, 
+  0x54, 0xd1, 0x76, 0x57, 0xb5, 0x5c, 0x7b, 0x48, 0x0e, 0x69, 0x96, 0xba, 0xe8, 0x2d, 0x40, 0x1b, 
+  0xb3, 0x28, 0x73, 0x70, 0x63, 0x30, 0xce, 0xc6, 0x8d, 0x27, 0x6b, 0x93, 0x4a, 0x98, 0x03, 0x0b, 
+  0xc4, 0xec, 0x18, 0x5c, 0x8f, 0xca, 0x44, 0x10, 0x16, 0x20, 0xa3, 0x1d, 0x97, 0x8b, 0xdd, 0xf8, 
+  0x53, 0xb0, 0x5a, 0x53, 0x55, 0xfd, 0x4c, 0x50, 0x90, 0xd1, 0xfd, 0xff, 0x47, 0xdb, 0xb7, 0xb0, 
+  0xb7, 0x6d, 0x64, 0x59, 0xfe, 0x15, 0x12, 0xeb, 0xb5, 0x01, 0x13, 0x82, 0xa4, 0x24, 0xd3, 0x93, 
+  0x80, 0x42, 0xf8, 0xf9, 0xd9, 0x71, 0xda, 0x8a, 0xdd, 0xb1, 0xf2, 0x6a, 0x5a, 0xed, 0x0f, 0x24, 
+  0x21, 0x09, 0x12, 0x05, 0xc8, 0x20, 0x68, 0x59, 0x91, 0xf8, 0xdf, 0xf7, 0x9e, 0x7b, 0xab, 0x0a, 
+  0x55, 0x00, 0x28, 0xa7, 0x67, 0x77, 0x67, 0x3a, 0x16, 0x01, 0x14, 0x0a, 0x85, 0x42, 0x3d, 0xee, 
+  0xf3, 0x9c, 0x8b, 0x60, 0xc3, 0x30, 0xcf, 0xc2, 0x3d, 0x76, 0x35, 0xcd, 0x15, 0xe5, 0x58, 0xb6, 
+  0x9d, 0xc1, 0x2c, 0x29, 0x35, 0xdc, 0xfc, 0xfe, 0x41, 0x3e, 0x59, 0xc5, 0x4b, 0xc3, 0x17, 0x88, 
+  0xd7, 0xf1, 0x0d, 0xf7, 0x5b, 0xd9, 0x26, 0x7e, 0x93, 0xbb, 0x8e, 0x35, 0x45, 0x62, 0xa9, 0xd9, 
+  0xe8, 0x38, 0x9c, 0x60, 0xae, 0x3a, 0xb2, 0x84, 0x68, 0x0d, 0x3c, 0xd4, 0x87, 0x0f, 0xcb, 0xe9, 
+  0xfa, 0xb8, 0xb9, 0xf2, 0xf0, 0xe1, 0xef, 0x12, 0x04, 0x6c, 0xbe, 0xb7, 0x73, 0x8b, 0x21, 0x61, 
+  0xd1, 0x34, 0x37, 0x6d, 0x8e, 0x8e, 0x26, 0xe8, 0x59, 0x1a, 0xbf, 0xc0, 0x77, 0xcd, 0x7a, 0x88, 
+  0x3f, 0xe0, 0x61, 0x5b, 0x9a, 0xf0, 0x13, 0x15, 0x1e, 0xd0, 0x9c, 0x50, 0x0f, 0xa5, 0xee, 0x65, 
+  0xdf, 0x1a, 0x92, 0xa5, 0x87, 0xc0, 0x15, 0xbd, 0xbb, 0xa3, 0x26, 0xd3, 0x40, 0x00, 0x6d, 0x9f, 
+  0xfa, 0xe8, 0xd4, 0x58, 0x80, 0x6b, 0xc9, 0x6b, 0xf8, 0xf8, 0xcb, 0x63, 0xb0, 0xe1, 0x9f, 0x34, 
+  0x93, 0x9a, 0x5a, 0xb3, 0xad, 0xc7, 0xc1, 0x3f, 0xd8, 0xc3, 0x99, 0x39, 0x83, 0xc9, 0x9a, 0x9e, 
+  0xe5, 0x07, 0xf7, 0xde, 0xd9, 0xc7, 0xbd, 0x23, 0x37, 0x77, 0xdb, 0xa0, 0xe6, 0x4f, 0xaa, 0xdb, 
+  0x9a, 0x32, 0xb8, 0xa1, 0xe1, 0x51, 0x5b, 0x29, 0xe2, 0x8f, 0x7e, 0x03, 0x5f, 0x13, 0x7c, 0x6b, 
+  0x2d, 0x1b, 0xb4, 0xd0, 0xde, 0xaa, 0x45, 0xd3, 0xe1, 0x69, 0xd9, 0xdb, 0x80, 0xa9, 0xd0, 0x79, 
+  0x3e, 0xc0, 0xad, 0x31, 0x9b, 0xeb, 0xa0, 0x03, 0x80, 0xda, 0xb7, 0x84, 0x7f, 0xc9, 0xed, 0xe3, 
+  0xd6, 0x8d, 0x86, 0x1a, 0x18, 0x4a, 0x75, 0xf2, 0x07, 0x45, 0xab, 0xba, 0x2d, 0x30, 0x18, 0x42, 
+  0x3f, 0x63, 0xe2, 0x9a, 0xb8, 0xa8, 0x6e, 0x9d, 0x05, 0x03, 0xaf, 0xda, 0xdb, 0x9b, 0x64, 0x4e, 
+  0xc2, 0xbd, 0x2d, 0x0c, 0x58, 0x86, 0xad, 0x4a, 0xc8, 0xaa, 0x6c, 0x6a, 0xa9, 0x46, 0xe3, 0x68, 
+  0xfc, 0xf2, 0xae, 0x4f, 0x56, 0xad, 0x46, 0xaa, 0xdf, 0xe0, 0xed, 0xd4, 0x84, 0x40, 0x2e, 0x1b, 
+  0xa3, 0x6c, 0x7c, 0xce, 0xd2, 0x55, 0x89, 0xac, 0xb0, 0xbe, 0xda, 0x46, 0x02, 0xe3, 0x2e, 0x18, 
+  0x22, 0xa3, 0xdb, 0x01, 0x7b, 0x70, 0x7d, 0x62, 0x7e, 0x74, 0x86, 0x5e, 0x41, 0x6a, 0x11, 0x1c, 
+  0xfa, 0x76, 0xd9, 0x10, 0x74, 0xa6, 0x7b, 0xc1, 0x68, 0x9f, 0xf1, 0x65, 0x85, 0xf7, 0xf2, 0x7f, 
+  0xfe, 0xe0, 0x9d, 0xfd, 0x71, 0x3d, 0x71, 0xaa, 0xaf, 0x83, 0xd8, 0xef, 0xe7, 0x91, 0x6a, 0x5a, 
+  0x63, 0x82, 0x00, 0xab, 0x80, 0x33, 0xde, 0x58, 0xb0, 0xb8, 0xae, 0x93, 0x8b, 0x68, 0x59, 0xce, 
+  0x25, 0xb7, 0xe3, 0x73, 0x6d, 0x39, 0xd8, 0xc3, 0x23, 0xe8, 0x82, 0x93, 0x5d, 0xea, 0x3a, 0xb6, 
+  0xbe, 0xfe, 0x7e, 0xf8, 0xba, 0x1b, 0x66, 0xc4, 0x26, 0x1c, 0x78, 0x8f, 0xdb, 0xc1, 0x44, 0x06, 
+  0x78, 0x08, 0x83, 0x96, 0x71, 0x29, 0xeb, 0x84, 0x47, 0xfe, 0x45, 0xf4, 0xfc, 0xcd, 0xe1, 0x5b, 
+  0x54, 0x58, 0x05, 0x52, 0xf1, 0xcb, 0xaa, 0xbc, 0x7c, 0xc7, 0xb7, 0xb3, 0x30, 0x41, 0xa3, 0x7a, 
+  0xf7, 0xf3, 0xe5, 0xd2, 0x0b, 0x1a, 0xd0, 0x49, 0xbd, 0x75, 0x6d, 0x1a, 0x4b, 0xea, 0x90, 0x33, 
+  0x56, 0x95, 0x8f, 0x76, 0xf5, 0xf4, 0xe6, 0x28, 0x3d, 0x85, 0xe6, 0xe3, 0x7b, 0x5c, 0x65, 0x95, 
+  0x55, 0x55, 0x59, 0x59, 0xc1, 0xc8, 0xf4, 0xf9, 0x71, 0xc6, 0xf7, 0x5e, 0x15, 0x24, 0x73, 0x51, 
+  0x5d, 0xf4, 0x36, 0x31, 0x14, 0x6a, 0x38, 0xb2, 0xb8, 0x27, 0x2e, 0xf0, 0xb6, 0xd3, 0xf7, 0xc7, 
+  0x24, 0x48, 0x3d, 0x63, 0x25, 0x78, 0xf2, 0xbe, 0xd8, 0x3d, 0x0d, 0x5f, 0x28, 0xc9, 0x6b, 0xb5, 
+  0x9e, 0x5d, 0xe6, 0xb5, 0xf2, 0xa4, 0xdc, 0xe5, 0x97, 0xe9, 0x69, 0x76, 0x47, 0x33, 0x9f, 0x76, 
+  0xd1, 0x93, 0x7c, 0x99, 0xb1, 0x6b, 0xe5, 0xdd, 0xbd, 0x3e, 0x98, 0x8b, 0xec, 0xe6, 0x34, 0x2b, 
+  0x02, 0xdb, 0xdf, 0xf2, 0x13, 0x20, 0x91, 0xb3, 0x86, 0x3f, 0xb7, 0xee, 0xe6, 0x57, 0xd3, 0xd8, 
+  0x55, 0xf3, 0xa5, 0xed, 0x8f, 0xa7, 0xc5, 0xf9, 0x42, 0xed, 0x8c, 0xa4, 0x02, 0xe7, 0xbc, 0xc1, 
+  0xc6, 0xa8, 0x71, 0xe4, 0x4d, 0xbd, 0x51, 0x3f, 0xaf, 0xb9, 0xb6, 0xd9, 0x03, 0x42, 0xd5, 0x83, 
+  0xa4, 0x70, 0xec, 0x85, 0xb5, 0xe0, 0xc5, 0x04, 0x86, 0x35, 0x9c, 0x2a, 0xb6, 0x48, 0x3f, 0x78, 
+  0xfa, 0xa0, 0xf6, 0xac, 0x1d, 0x79, 0x95, 0x05, 0xe6, 0x69, 0x35, 0xd7, 0x04, 0xbb, 0xbf, 0x06, 
+  0x9f, 0x61, 0x2a, 0x8d, 0xa4, 0xdf, 0x25, 0x38, 0x45, 0x4c, 0x52, 0xdf, 0xaa, 0x02, 0xd1, 0x7c, 
+  0x42, 0x3b, 0x51, 0x5c, 0x8f, 0xab, 0xa9, 0x06, 0xb7, 0x3c, 0x4e, 0xb2, 0x62, 0x4e, 0xfb, 0xfa, 
+  0x2f, 0x3f, 0xbf, 0x02, 0xc6, 0x1d, 0x69, 0x69, 0xcc, 0xae, 0x37, 0xf2, 0x12, 0xfa, 0x7a, 0xdd, 
+  0x2b, 0x22, 0xc3, 0x14, 0x50, 0x48, 0x0b, 0x9a, 0xf6, 0x3d, 0x1d, 0x8a, 0x49, 0x7b, 0xfe, 0x71, 
+  0x9d, 0x55, 0x37, 0x9c, 0x45, 0x4a, 0x5b, 0xc3, 0x32, 0xcd, 0x0b, 0x15, 0x10, 0xd8, 0xdb, 0xdf, 
+  0x24, 0xb6, 0x88, 0x4a, 0x0e, 0x81, 0x2c, 0x6c, 0x94, 0x73, 0xd3, 0x6b, 0x56, 0xaa, 0x8e, 0x7c, 
+  0x53, 0xce, 0x81, 0xb1, 0x60, 0x22, 0x2a, 0x25, 0xaa, 0x3d, 0xf4, 0x82, 0x56, 0x6c, 0x24, 0x8d, 
+  0x55, 0x5a, 0x8e, 0xfa, 0xc1, 0xd3, 0x54, 0x37, 0xfa, 0xca, 0xd8, 0xa4, 0x0a, 0xca, 0x7b, 0x04, 
+  0x8c, 0x71, 0x61, 0x9f, 0xea, 0xa9, 0xa0, 0x0f, 0x24, 0x57, 0x96, 0x1a, 0xe5, 0x73, 0x57, 0xf4, 
+  0xb3, 0x6a, 0x16, 0x79, 0x56, 0xde, 0x93, 0x2d, 0xff, 0x65, 0x62, 0xc6, 0xdb, 0x04, 0x3a, 0x48, 
+  0xb3, 0x7f, 0xe5, 0xc2, 0x30, 0x73, 0x72, 0xc1, 0xd1, 0x5d, 0xe8, 0x63, 0x65, 0xb0, 0xc9, 0x57, 
+  0x24, 0x52, 0x6b, 0x2d, 0x17, 0x22, 0xf9, 0x3b, 0x1d, 0xa8, 0x67, 0x5b, 0x4e, 0x20, 0x1b, 0xbc, 
+  0xa8, 0x1b, 0x50, 0x5c, 0xb9, 0x3a, 0xd7, 0x18, 0xf4, 0xc3, 0xb9, 0x01, 0xcc, 0x05, 0x11, 0xbd, 
+  0xf3, 0x72, 0x76, 0xee, 0x99, 0x6d, 0x24, 0x72, 0xd9, 0x9d, 0xc4, 0xf1, 0xdf, 0x32, 0x0b, 0x15, 
+  0xc1, 0x44, 0x4c, 0x42, 0x45, 0x8f, 0x49, 0xe8, 0x16, 0x2f, 0x12, 0xd7, 0xf2, 0xf9, 0x15, 0x31, 
+  0xa4, 0x31, 0x84, 0x3c, 0xab, 0x43, 0x0f, 0xf4, 0x30, 0xa0, 0x1d, 0x0c, 0xe2, 0x9e, 0xa2, 0x45, 
+  0x7f, 0x51, 0xc1, 0x5b, 0xd5, 0xeb, 0xf0, 0x73, 0x5a, 0x3b, 0xfe, 0xf7, 0x57, 0x7b, 0xb4, 0xe0, 
+  0x3c, 0xa1, 0x5f, 0xff, 0x2b, 0x7a, 0x4c, 0xcb, 0xd0, 0x1b, 0xfa, 0xe5, 0x4f, 0x27, 0x0f, 0x8f, 
+  0x83, 0x0f, 0xc9, 0xf4, 0xdf, 0x0f, 0x8f, 0x1f, 0xef, 0x86, 0xe7, 0xbc, 0xc4, 0x44, 0x8f, 0x27, 
+  0xa4, 0x35, 0x0d, 0xde, 0xd7, 0xc7, 0x8f, 0xfd, 0xe9, 0xbf, 0x51, 0xe3, 0xf1, 0x63, 0x5a, 0x81, 
+  0x4e, 0x2f, 0xc3, 0x0f, 0x6a, 0x09, 0xfa, 0xfb, 0x8b, 0xa3, 0xbb, 0x1f, 0x5e, 0x3c, 0x79, 0x0e, 
+  0xb5, 0xf0, 0x23, 0xce, 0xbd, 0xdf, 0x7d, 0xbf, 0xbb, 0x1b, 0xbe, 0xae, 0x91, 0xa8, 0x72, 0xc8, 
+  0xff, 0xbe, 0xad, 0x13, 0xef, 0xf1, 0xae, 0xa7, 0xd3, 0x46, 0xbd, 0xc7, 0xa4, 0x7f, 0x3c, 0xed, 
+  0x89, 0x7e, 0x49, 0x6d, 0x10, 0xd5, 0x1f, 0x10, 0x40, 0xaa, 0x47, 0x97, 0xdb, 0xef, 0xdd, 0x1d, 
+  0x80, 0x0d, 0x6d, 0x08, 0x27, 0x45, 0xdd, 0x63, 0x3b, 0x20, 0xa0, 0x65, 0xa0, 0x72, 0x1c, 0xba, 
+  0xc6, 0xd1, 0xd0, 0x0a, 0x09, 0xf0, 0x46, 0x8c, 0x76, 0x43, 0x52, 0xc7, 0x04, 0x20, 0xad, 0x06, 
+  0x28, 0x85, 0x56, 0xab, 0xc7, 0x5e, 0xe8, 0x97, 0x3a, 0xf7, 0x4c, 0xbc, 0xd5, 0x4d, 0xc2, 0x0f, 
+  0xed, 0x8c, 0xad, 0x6b, 0xda, 0x46, 0xd2, 0xb8, 0xa1, 0x7f, 0xae, 0x99, 0x7a, 0xa5, 0x04, 0x00, 
+  0x2f, 0xda, 0xc9, 0xc4, 0x2d, 0xeb, 0xa4, 0xa6, 0x07, 0x1e, 0xd6, 0xcd, 0xdb, 0xcf, 0xf5, 0xb6, 
+  0x57, 0x99, 0xd4, 0x50, 0x04, 0xc0, 0x71, 0xe4, 0x24, 0xaf, 0x19, 0xf5, 0x54, 0xd1, 0x36, 0xf7, 
+  0xca, 0x4c, 0xbe, 0x3c, 0x61, 0x5b, 0xf8, 0x2d, 0x89, 0x46, 0xeb, 0xbb, 0x3b, 0xa4, 0x2b, 0x4d, 
+  0xd6, 0x93, 0x21, 0xe0, 0x5c, 0x02, 0x65, 0x51, 0x8b, 0xfd, 0x9c, 0x89, 0x87, 0xa1, 0x42, 0x34, 
+  0x11, 0xf3, 0xa4, 0xb2, 0x01, 0xbc, 0x89, 0x93, 0x49, 0x11, 0x09, 0xa0, 0x33, 0x26, 0xed, 0xc2, 
+  0x48, 0x00, 0xa4, 0x39, 0x23, 0x99, 0xc0, 0xa4, 0x29, 0xf0, 0x67, 0x6e, 0xde, 0xfb, 0x55, 0xdd, 
+  0x4a, 0x3c, 0x44, 0x8c, 0xcd, 0x79, 0xfa, 0xf9, 0x5d, 0x56, 0xd7, 0xd4, 0xb6, 0x55, 0x74, 0x42, 
+  0x72, 0x95, 0xca, 0x10, 0x35, 0x84, 0xd3, 0xbc, 0xd0, 0xd5, 0x41, 0xc3, 0x6d, 0x46, 0x2d, 0x86, 
+  0x20, 0x9f, 0xa3, 0xe5, 0x59, 0x0c, 0xc0, 0xde, 0x8a, 0xfa, 0x2f, 0x08, 0xd0, 0xeb, 0x4c, 0xae, 
+  0x6b, 0x56, 0x41, 0x8b, 0x52, 0x11, 0xac, 0x74, 0x88, 0xb6, 0xce, 0x36, 0x4f, 0x6b, 0x76, 0xd1, 
+  0x26, 0xd7, 0xf2, 0xd7, 0x0e, 0x3c, 0x9a, 0x03, 0x6f, 0x35, 0xde, 0x0b, 0x97, 0xe9, 0xaa, 0x3e, 
+  0x2c, 0x17, 0xf9, 0x49, 0x4e, 0xc2, 0x31, 0xa2, 0xf9, 0xeb, 0x94, 0xd3, 0x5e, 0xed, 0xb6, 0xc6, 
+  0xb7, 0xeb, 0x6a, 0x19, 0xeb, 0x4a, 0x58, 0xa8, 0xf6, 0x68, 0x1a, 0x78, 0x24, 0x58, 0xbf, 0x26, 
+  0xf9, 0x66, 0x19, 0x4b, 0xd8, 0xc3, 0x8c, 0x64, 0xcb, 0x3b, 0xd2, 0x50, 0xf0, 0xdf, 0xce, 0xaa, 
+  0x2e, 0x2b, 0x6c, 0xe4, 0xd1, 0x68, 0x87, 0x9f, 0xb9, 0x42, 0xaa, 0x30, 0xf6, 0x73, 0x6c, 0xed, 
+  0x77, 0xd7, 0xf9, 0x82, 0x59, 0x21, 0x1f, 0xec, 0xca, 0x8a, 0x73, 0xad, 0x80, 0x1b, 0xe6, 0x25, 
+  0x69, 0x28, 0xc2, 0x99, 0xc2, 0x4c, 0x75, 0x55, 0x09, 0x39, 0x8c, 0x89, 0x18, 0xe8, 0x30, 0x5d, 
+  0xdd, 0x14, 0x73, 0xc5, 0x2e, 0x0b, 0x37, 0xa7, 0x30, 0xa6, 0x42, 0x27, 0xca, 0x45, 0xca, 0xda, 
+  0xfd, 0xbc, 0x73, 0x7d, 0x7d, 0xbd, 0x43, 0x5d, 0x79, 0xb9, 0x43, 0x4d, 0x96, 0x3d, 0x6c, 0x31, 
+  0x1e, 0x80, 0x49, 0x0e, 0xb8, 0x2d, 0xbf, 0x1c, 0xbd, 0xdc, 0xf9, 0xd6, 0x0b, 0x21, 0xdd, 0x21, 
+  0xf1, 0x97, 0xb3, 0xf3, 0xde, 0xd6, 0x42, 0x4b, 0x20, 0xd2, 0xd1, 0x15, 0x36, 0x2c, 0x4f, 0x20, 
+  0xcd, 0xe5, 0x0c, 0x7e, 0x7a, 0xe1, 0x67, 0x1c, 0x3b, 0x4f, 0xba, 0x5c, 0x86, 0x03, 0x23, 0x50, 
+  0x85, 0xe7, 0x2b, 0xc6, 0xd2, 0xb4, 0x0a, 0xe0, 0x8c, 0x2a, 0x71, 0x9e, 0x7e, 0x4a, 0x15, 0xbd, 
+  0xc4, 0x46, 0xb7, 0x9d, 0x9e, 0x8e, 0x3a, 0x77, 0xdf, 0xcf, 0xe8, 0xcf, 0xfb, 0xd9, 0xae, 0x3c, 
+  0x92, 0x0e, 0xf1, 0x77, 0x57, 0xea, 0xa3, 0x23, 0xfc, 0xa5, 0xab, 0xf0, 0x28, 0xae, 0x68, 0x1b, 
+  0x26, 0x89, 0x2e, 0xcf, 0x96, 0x0b, 0x75, 0xb3, 0xa7, 0x4f, 0x92, 0xc4, 0xe5, 0xa9, 0xb7, 0xd0, 
+  0xa7, 0x80, 0xb0, 0xab, 0x9b, 0xa5, 0xcf, 0xfd, 0xf8, 0xee, 0xcd, 0x4f, 0xd2, 0x82, 0x4f, 0x59, 
+  0x55, 0xab, 0xfc, 0x44, 0x6e, 0xa2, 0x17, 0x8b, 0x94, 0x28, 0x32, 0xe2, 0x80, 0xdf, 0x19, 0x1d, 
+  0x2d, 0x87, 0xa8, 0xc5, 0x8b, 0x71, 0xb7, 0x48, 0x95, 0xea, 0x34, 0x5e, 0x3c, 0x6e, 0x24, 0x58, 
+  0xd2, 0x2a, 0x9a, 0x21, 0x2d, 0x43, 0x46, 0x7f, 0xaa, 0xcf, 0xc0, 0x96, 0xdb, 0x98, 0x41, 0xb5, 
+  0xde, 0x12, 0x48, 0x52, 0x4f, 0x68, 0xd6, 0xf0, 0xc4, 0x71, 0xe7, 0x0a, 0x34, 0xdd, 0xf8, 0x15, 
+  0xac, 0xd3, 0xf6, 0x59, 0x66, 0x94, 0xc0, 0x89, 0x86, 0xe4, 0x85, 0xd6, 0xd0, 0xd7, 0x30, 0xae, 
+  0xd2, 0xc9, 0xa3, 0x2a, 0x2d, 0xe8, 0xad, 0xab, 0x1a, 0x27, 0x0f, 0xd5, 0xc9, 0xd6, 0x63, 0xb7, 
+  0x98, 0x95, 0xd4, 0xd2, 0xaa, 0xa3, 0xf4, 0xeb, 0xa4, 0xe6, 0x09, 0xca, 0xc1, 0x86, 0xb0, 0xd3, 
+  0x91, 0xea, 0x45, 0x0a, 0x7c, 0x78, 0x16, 0x7e, 0xe2, 0x85, 0xed, 0xb4, 0x99, 0xd9, 0xeb, 0x2b, 
+  0x95, 0xbe, 0x70, 0x09, 0x33, 0x9d, 0xbc, 0xf9, 0xdd, 0xdd, 0x69, 0x78, 0xd3, 0x1c, 0x32, 0xb8, 
+  0x62, 0x83, 0xc9, 0x71, 0xa9, 0xe4, 0x25, 0xda, 0x23, 0xfd, 0x4b, 0x60, 0xf1, 0x88, 0xe9, 0x70, 
+  0xe6, 0xe4, 0xfa, 0x87, 0xd7, 0x74, 0xf8, 0x2c, 0x5d, 0x2e, 0x01, 0xde, 0x86, 0xfc, 0x8d, 0x62, 
+  0x9e, 0x0d, 0x2e, 0x49, 0xe7, 0xa8, 0x90, 0x54, 0xf6, 0x99, 0x2a, 0x5f, 0xd5, 0x69, 0xbd, 0x5e, 
+  0x3d, 0x63, 0x6e, 0x6f, 0xc6, 0x13, 0x02, 0x04, 0x9f, 0xac, 0xb4, 0x9e, 0xd0, 0x5a, 0x92, 0x58, 
+  0x10, 0x1e, 0x25, 0xb7, 0x08, 0x3f, 0xb8, 0x79, 0x57, 0x43, 0x95, 0x66, 0x9e, 0xe9, 0x9f, 0xd5, 
+  0xd0, 0xf8, 0x81, 0xce, 0xb7, 0x58, 0x72, 0x8c, 0xd8, 0x7c, 0xa6, 0x41, 0x23, 0x85, 0x6d, 0x8b, 
+  0xba, 0xa2, 0x4e, 0xce, 0x6b, 0xc9, 0x4a, 0xbd, 0x0a, 0x38, 0xd8, 0xbf, 0x8b, 0xa2, 0x4f, 0xcb, 
+  0xd3, 0x57, 0xc7, 0x63, 0x70, 0x9d, 0xb4, 0x5d, 0x26, 0x1b, 0x47, 0x64, 0xa8, 0x45, 0x64, 0xa8, 
+  0x37, 0x68, 0xcd, 0x93, 0xe5, 0xd2, 0x6d, 0x50, 0x1f, 0xe2, 0xee, 0xd9, 0xe4, 0x2a, 0x36, 0x31, 
+  0x1c, 0x3f, 0x0b, 0xc4, 0x45, 0xa7, 0xf9, 0xd6, 0xa8, 0x92, 0xe7, 0x08, 0x01, 0xd5, 0xaa, 0xd3, 
+  0x9a, 0x9e, 0x53, 0x24, 0xc5, 0x86, 0x29, 0x76, 0x1f, 0x45, 0x4b, 0xbb, 0x09, 0x91, 0x85, 0x56, 
+  0xe5, 0x8b, 0xec, 0x30, 0xbf, 0x14, 0x62, 0xc6, 0xad, 0x56, 0xe9, 0x33, 0xce, 0x2a, 0xbb, 0x54, 
+  0xe5, 0x92, 0x4c, 0xd7, 0xd0, 0x7c, 0xa0, 0xfe, 0x3e, 0xe6, 0x44, 0xf4, 0xb3, 0xe0, 0x48, 0xe7, 
+  0xd0, 0x65, 0xd3, 0x23, 0xf5, 0x51, 0x8f, 0xbb, 0xca, 0x01, 0x22, 0x90, 0x92, 0x29, 0xfe, 0x65, 
+  0xc5, 0xe0, 0xd8, 0x25, 0x7d, 0xa0, 0x75, 0xb8, 0xea, 0x8d, 0x6d, 0xa1, 0x4d, 0xd0, 0xd0, 0xd9, 
+  0x83, 0xc1, 0x9e, 0x0b, 0x32, 0x8e, 0x22, 0xd0, 0xc9, 0x74, 0x22, 0x3d, 0x5a, 0x33, 0x33, 0xe8, 
+  0x09, 0x47, 0xb4, 0x1c, 0x47, 0x34, 0x95, 0x13, 0xdf, 0xa7, 0xfb, 0xf9, 0xe7, 0xdd, 0x9d, 0xda, 
+  0x09, 0x02, 0x04, 0x62, 0x1a, 0x09, 0xec, 0x63, 0x1d, 0x5a, 0xab, 0xf8, 0xc8, 0xdb, 0xdd, 0xf5, 
+  0x70, 0x2f, 0xdb, 0xbb, 0xea, 0xe8, 0x32, 0xab, 0xcf, 0x4a, 0x92, 0x31, 0x6b, 0x45, 0x6e, 0x75, 
+  0x6a, 0xce, 0x48, 0x11, 0x2a, 0x69, 0x76, 0xd6, 0xc4, 0x6f, 0x0e, 0x58, 0x04, 0x09, 0xb6, 0xcb, 
+  0x34, 0x9e, 0xa7, 0x53, 0x3c, 0x69, 0x86, 0x55, 0x25, 0xed, 0x15, 0xe5, 0x25, 0xad, 0xe0, 0xa0, 
+  0x64, 0xeb, 0x15, 0xb7, 0xa0, 0x2d, 0x57, 0xb2, 0x29, 0xf2, 0xcb, 0x84, 0xea, 0x40, 0xfe, 0x84, 
+  0x4e, 0x25, 0xc9, 0xd3, 0xd6, 0xfb, 0x8c, 0xb0, 0x9f, 0x96, 0xab, 0x1a, 0x09, 0x61, 0xee, 0x85, 
+  0x8a, 0xcf, 0x37, 0x5a, 0xb5, 0x5b, 0x0f, 0xd6, 0x3e, 0xea, 0x55, 0x79, 0x2b, 0xa4, 0xa1, 0x5a, 
+  0xfb, 0x5a, 0x43, 0xf7, 0x66, 0xa4, 0x15, 0x5d, 0x4e, 0xdd, 0x90, 0x68, 0x5d, 0x45, 0x0e, 0xd1, 
+  0xa7, 0xf0, 0xdc, 0xe0, 0xe3, 0xa6, 0xc8, 0xd9, 0xfc, 0x19, 0x8b, 0x5e, 0x78, 0x4a, 0x4a, 0x11, 
+  0x7d, 0x2c, 0x13, 0xe3, 0x71, 0x64, 0x48, 0x1d, 0xfd, 0x4f, 0xda, 0xb8, 0x8c, 0x47, 0xcb, 0xe6, 
+  0x4a, 0xab, 0xdc, 0x1e, 0xd2, 0x49, 0x45, 0x0c, 0x18, 0x8d, 0x58, 0x7a, 0x70, 0x4c, 0x4c, 0x1e, 
+  0x2f, 0x69, 0x88, 0xb2, 0x6f, 0x3e, 0xa3, 0xfc, 0x71, 0x71, 0xf5, 0xe8, 0x1a, 0x9c, 0xec, 0x8a, 
+  0x81, 0x64, 0xf8, 0x41, 0xa9, 0x17, 0x52, 0x14, 0x74, 0x58, 0xdc, 0xcd, 0x66, 0x94, 0x3c, 0x61, 
+  0xdf, 0xa6, 0x73, 0xd3, 0x64, 0x4b, 0xbf, 0x30, 0xee, 0xa4, 0x5a, 0x37, 0x65, 0xaf, 0x17, 0x4e, 
+  0x34, 0xe3, 0x43, 0xf8, 0xe2, 0xc6, 0xcf, 0xbe, 0x09, 0xd5, 0x89, 0xf2, 0xc7, 0xb4, 0xe3, 0x39, 
+  0xb5, 0x63, 0xe4, 0xb1, 0x04, 0xab, 0x5a, 0x28, 0x42, 0xef, 0x89, 0x8e, 0x7c, 0x09, 0xad, 0xaf, 
+  0x60, 0x35, 0xab, 0x31, 0xc7, 0x24, 0xee, 0xe7, 0xc2, 0xa3, 0x4e, 0x46, 0x89, 0x7f, 0xa4, 0x3a, 
+  0xe0, 0x24, 0x98, 0x90, 0x4a, 0x1a, 0x7b, 0x13, 0x2f, 0x18, 0xa9, 0x0f, 0xa7, 0xa2, 0x19, 0x55, 
+  0x79, 0xb1, 0x1a, 0xc3, 0x9b, 0x43, 0x0a, 0x18, 0x6e, 0x4e, 0x4e, 0x1a, 0xca, 0x36, 0x6a, 0xdd, 
+  0x83, 0x7d, 0x0f, 0x19, 0x74, 0xbd, 0x15, 0x7a, 0x1f, 0x48, 0x43, 0xff, 0x5c, 0x8f, 0x46, 0xa3, 
+  0x52, 0xcf, 0xcf, 0x13, 0xf9, 0x99, 0x9f, 0x68, 0x61, 0x8e, 0x91, 0x1b, 0x6c, 0xe9, 0x6e, 0x7a, 
+  0x42, 0xb2, 0xe4, 0x51, 0xd4, 0x5e, 0x34, 0x7d, 0xef, 0xd5, 0xc9, 0x8e, 0x2e, 0xb3, 0xf3, 0x2e, 
+  0xa7, 0xcd, 0xc2, 0x0b, 0x3b, 0x77, 0xb2, 0xcd, 0x96, 0x44, 0xc3, 0xfb, 0x2a, 0xf9, 0xa9, 0x2c, 
+  0x32, 0x20, 0x27, 0xcd, 0xcf, 0xbc, 0xa6, 0x34, 0x5c, 0xfc, 0xcd, 0x07, 0x6e, 0xbe, 0xba, 0xb2, 
+  0x6d, 0xb7, 0xbe, 0x6f, 0x6d, 0x1f, 0x06, 0xfd, 0x4f, 0x52, 0x15, 0xec, 0x1c, 0x71, 0xf4, 0xb4, 
+  0x53, 0x41, 0x10, 0xf6, 0xdd, 0xf0, 0x84, 0xc5, 0x3d, 0xcf, 0x5e, 0x62, 0x48, 0x78, 0x47, 0x73, 
+  0x94, 0x20, 0x38, 0x75, 0xaf, 0x1c, 0x4f, 0xb6, 0x5e, 0x19, 0x41, 0xca, 0xe7, 0x66, 0xdb, 0xa7, 
+  0x27, 0x5e, 0x38, 0xf0, 0x46, 0x6f, 0xeb, 0x91, 0x37, 0x1e, 0x7c, 0x4c, 0xf6, 0xa2, 0xbd, 0x7d, 
+  0x0f, 0x36, 0xa0, 0xb8, 0xa9, 0x46, 0xd0, 0x82, 0xe8, 0xfd, 0x65, 0x57, 0x0b, 0x7a, 0x9a, 0x99, 
+  0x37, 0x97, 0x99, 0x75, 0x95, 0x17, 0x0c, 0xa1, 0x3d, 0x79, 0x47, 0x22, 0xbb, 0xc6, 0x7d, 0xb2, 
+  0xcf, 0x89, 0x27, 0xf0, 0x32, 0x3c, 0x0a, 0x4f, 0x69, 0x2d, 0x3c, 0x33, 0xbe, 0xd7, 0x23, 0xb5, 
+  0xb4, 0x73, 0x25, 0x6b, 0xf0, 0x07, 0xd0, 0x91, 0x17, 0x5e, 0x33, 0x11, 0xe6, 0x69, 0x83, 0x92, 
+  0x41, 0xbd, 0xc5, 0x49, 0xce, 0x24, 0x3f, 0xac, 0xd9, 0xe0, 0x89, 0x33, 0x8c, 0x9c, 0x71, 0x2a, 
+  0x36, 0x3d, 0x38, 0xa6, 0x7e, 0x86, 0xf8, 0xa4, 0x96, 0x17, 0x16, 0x04, 0x8e, 0xa2, 0x46, 0x88, 
+  0x48, 0xf6, 0x91, 0xad, 0x7c, 0xd3, 0x5a, 0x35, 0x98, 0xbf, 0x65, 0x4a, 0xad, 0x3a, 0x76, 0x16, 
+  0x24, 0xea, 0x0e, 0x08, 0xf0, 0x80, 0xd0, 0x3e, 0xe5, 0x9c, 0x1f, 0xd2, 0x17, 0xd8, 0x79, 0xb8, 
+  0x0d, 0x4c, 0x4a, 0xbf, 0x87, 0xa7, 0x0a, 0xc3, 0xc2, 0x63, 0xee, 0x0c, 0x64, 0x31, 0x3f, 0x43, 
+  0xae, 0x20, 0xcd, 0x5e, 0x68, 0x35, 0x69, 0x38, 0xb7, 0x2c, 0x9b, 0xbc, 0xa1, 0xd6, 0x67, 0x55, 
+  0x79, 0x3d, 0xc8, 0xc6, 0x73, 0x7f, 0x67, 0x1f, 0x02, 0xe3, 0x86, 0xf7, 0x52, 0x3e, 0xf2, 0x7e, 
+  0x2a, 0x07, 0x46, 0x4a, 0xb4, 0x35, 0xf1, 0xf9, 0x56, 0x3f, 0x6d, 0x52, 0x8f, 0xcf, 0x48, 0x07, 
+  0xe3, 0x8c, 0xbe, 0x05, 0x90, 0xb7, 0x9c, 0x6c, 0x9c, 0x05, 0xba, 0x4b, 0x39, 0x32, 0xae, 0x12, 
+  0xd8, 0xfa, 0x48, 0xe4, 0xb2, 0x3b, 0x6b, 0xef, 0x20, 0x9b, 0x7c, 0x13, 0x43, 0x4b, 0xff, 0x6a, 
+  0x6f, 0xef, 0x80, 0xa9, 0x97, 0x0e, 0xbe, 0xde, 0xdb, 0xbb, 0xbb, 0xfb, 0x7a, 0xef, 0x1b, 0x78, 
+  0x90, 0x38, 0x0f, 0x60, 0xd5, 0x89, 0x6f, 0xb7, 0xe0, 0xa9, 0x0c, 0xb1, 0x8a, 0xd6, 0x22, 0x48, 
+  0xc0, 0xcb, 0x9a, 0xb1, 0x38, 0xa6, 0x71, 0x06, 0x0a, 0x04, 0xf8, 0x0f, 0x82, 0xb5, 0xf1, 0xc1, 
+  0x9a, 0xec, 0x90, 0x8a, 0xb1, 0x4c, 0x33, 0x23, 0x9f, 0x60, 0xc2, 0x75, 0x84, 0xc0, 0xd6, 0x0c, 
+  0x0b, 0x78, 0x14, 0x55, 0x0d, 0x23, 0xeb, 0x0a, 0xa2, 0x0a, 0xc6, 0xe8, 0xc3, 0x87, 0xf8, 0x57, 
+  0x56, 0xa7, 0x8a, 0xc6, 0xc6, 0xda, 0xe8, 0xcf, 0x79, 0x30, 0x9e, 0xd1, 0x7b, 0x5f, 0x60, 0xd7, 
+  0x43, 0x63, 0x80, 0xc3, 0x11, 0x94, 0xd2, 0x2e, 0x7c, 0x80, 0x5b, 0x53, 0x99, 0x60, 0xdc, 0x0e, 
+  0xd7, 0xc2, 0x8d, 0x1b, 0x35, 0xaa, 0xc9, 0x34, 0x47, 0x64, 0xd5, 0x08, 0x17, 0x8e, 0x83, 0xdb, 
+  0x32, 0xc9, 0x55, 0x8d, 0x29, 0x93, 0xbe, 0xe4, 0xc1, 0x86, 0x81, 0x2c, 0x52, 0x3c, 0xc1, 0x84, 
+  0x6e, 0x97, 0x43, 0x79, 0xf7, 0x87, 0x0f, 0x9b, 0xa6, 0x94, 0x70, 0x55, 0x95, 0xc7, 0x1b, 0xff, 
+  0x94, 0xa6, 0x09, 0x60, 0x69, 0xda, 0xfd, 0xdb, 0xf7, 0x99, 0x49, 0x70, 0x5e, 0xda, 0xfd, 0xaa, 
+  0x36, 0x07, 0xee, 0x89, 0x25, 0xc9, 0xba, 0x42, 0xbf, 0xc8, 0xc2, 0x98, 0xd5, 0xe4, 0x60, 0x3e, 
+  0x4d, 0xdb, 0xd2, 0xa5, 0xf3, 0x4a, 0xe9, 0xf1, 0x58, 0x48, 0x0e, 0x97, 0xfa, 0xd3, 0x8c, 0x4b, 
+  0x8e, 0x32, 0x63, 0x4f, 0x97, 0xa5, 0xde, 0x4d, 0x15, 0x45, 0x5f, 0xcf, 0x79, 0x96, 0x4a, 0x87, 
+  0xeb, 0x87, 0x0f, 0x2b, 0x38, 0x1a, 0xd1, 0xc2, 0x97, 0xac, 0xfb, 0x88, 0xda, 0x62, 0x9d, 0x40, 
+  0x7e, 0xb6, 0x79, 0x03, 0x76, 0xbf, 0x97, 0xa1, 0xf5, 0x64, 0x3c, 0x56, 0x46, 0x4b, 0x89, 0x2f, 
+  0x63, 0x4c, 0xd4, 0xb2, 0xbe, 0x51, 0xfd, 0x6b, 0x0e, 0x8a, 0xe7, 0xaf, 0x43, 0x1d, 0x3e, 0x9f, 
+  0xae, 0xf9, 0x7b, 0x94, 0x80, 0x93, 0xa2, 0xe5, 0x8c, 0x7f, 0x5a, 0x34, 0xbd, 0x73, 0x0e, 0xcf, 
+  0x59, 0x25, 0xb9, 0x05, 0xc0, 0x0a, 0x6e, 0x2d, 0x85, 0x62, 0xdd, 0x54, 0xc0, 0xcb, 0xa8, 0xa9, 
+  0x83, 0x8f, 0x68, 0xe8, 0x30, 0xa6, 0x72, 0x3a, 0x49, 0x99, 0xc6, 0x37, 0xe6, 0x2c, 0xfb, 0x39, 
+  0x8f, 0x30, 0xea, 0x2c, 0x94, 0xa1, 0x19, 0xae, 0x3f, 0xe8, 0x0a, 0xfd, 0x6f, 0x8d, 0x2f, 0x2e, 
+  0x9c, 0xe2, 0xf1, 0x29, 0x7a, 0x84, 0x27, 0xfc, 0x2a, 0xa8, 0x93, 0x14, 0xe8, 0xd2, 0x02, 0x92, 
+  0xc4, 0x1e, 0x12, 0x1c, 0x37, 0x8b, 0x83, 0xb2, 0x3e, 0xae, 0x58, 0x13, 0x72, 0x1c, 0x1b, 0x21, 
+  0xff, 0x89, 0x53, 0xd8, 0xf1, 0x69, 0x85, 0x90, 0xcf, 0x07, 0xeb, 0xc5, 0xe0, 0x84, 0x64, 0x62, 
+  0x0c, 0x49, 0x7a, 0x8f, 0xba, 0x44, 0x07, 0x6c, 0x36, 0x1b, 0xb7, 0x1e, 0xb5, 0x8c, 0x7a, 0x21, 
+  0xfa, 0x9d, 0x74, 0x1a, 0x8c, 0xba, 0x15, 0x8d, 0xbb, 0x3c, 0x08, 0xf3, 0x89, 0xdf, 0xda, 0x9d, 
+  0x69, 0x65, 0x3e, 0xea, 0x9b, 0x7d, 0xaf, 0x69, 0xe7, 0x35, 0x1b, 0xb2, 0x60, 0x8e, 0x74, 0xb6, 
+  0xe3, 0x64, 0x4d, 0xdb, 0xea, 0x96, 0xfb, 0xb1, 0xf1, 0xea, 0xdb, 0xd4, 0x26, 0x4c, 0xc5, 0x83, 
+  0xf0, 0x2b, 0x59, 0x64, 0x68, 0x59, 0x82, 0xf9, 0xd2, 0xe3, 0xbd, 0x04, 0x22, 0xcc, 0x84, 0x81, 
+  0x40, 0x34, 0x52, 0x7e, 0xac, 0xd6, 0x22, 0x39, 0x5b, 0x5f, 0xea, 0x76, 0xc4, 0x3e, 0x40, 0xd5, 
+  0xf8, 0x3d, 0x99, 0x1f, 0x89, 0x25, 0x9a, 0x3c, 0xc1, 0xd8, 0x58, 0xa9, 0xcd, 0x02, 0xd2, 0x14, 
+  0x7d, 0xc1, 0x10, 0xa9, 0xda, 0x60, 0xfe, 0xa4, 0x1a, 0x74, 0x97, 0x72, 0x50, 0x75, 0x06, 0xfc, 
+  0x0a, 0xde, 0xa2, 0x59, 0xb1, 0xa1, 0xf5, 0x4e, 0xff, 0x64, 0x3a, 0x20, 0xf8, 0xf1, 0xe6, 0xd0, 
+  0x29, 0xa8, 0xaf, 0x66, 0x0e, 0x02, 0xd8, 0x65, 0x38, 0x2d, 0xc3, 0x79, 0x78, 0x74, 0x1c, 0xc4, 
+  0x33, 0x1b, 0x02, 0xec, 0x12, 0x9b, 0xcc, 0x3c, 0x4c, 0x8f, 0x9b, 0x4a, 0xa1, 0x61, 0xf9, 0x9f, 
+  0xa1, 0x14, 0xab, 0x85, 0xd8, 0xd9, 0x9e, 0xf2, 0x89, 0x6c, 0x50, 0xea, 0x33, 0xc5, 0x7c, 0xf4, 
+  0x42, 0xda, 0x88, 0xfd, 0x8a, 0x9e, 0x5c, 0xc6, 0xa8, 0xee, 0x9a, 0xa1, 0x75, 0xac, 0x87, 0x1c, 
+  0x33, 0x3e, 0x88, 0xdf, 0xda, 0xe9, 0x9e, 0xa9, 0x9d, 0xd4, 0xec, 0x76, 0x3b, 0x3b, 0x5a, 0xa6, 
+  0x66, 0xbf, 0x58, 0x9f, 0x44, 0x5d, 0x72, 0xa8, 0x99, 0x56, 0x82, 0x8f, 0x58, 0xef, 0x85, 0x69, 
+  0x65, 0x4b, 0xe2, 0xd5, 0xe0, 0x85, 0x4e, 0x00, 0xa1, 0xa5, 0xca, 0x63, 0x4b, 0x4c, 0xc0, 0xf7, 
+  0xbc, 0x63, 0x83, 0x52, 0xbf, 0xca, 0xab, 0xef, 0x51, 0x7d, 0x50, 0x37, 0xec, 0xa6, 0x4e, 0x00, 
+  0x18, 0x02, 0x17, 0x43, 0xb0, 0x30, 0xd5, 0x6e, 0xaa, 0x76, 0x1e, 0xdc, 0xbe, 0xa0, 0xd9, 0x97, 
+  0x6c, 0x45, 0x95, 0xb8, 0xd1, 0xf4, 0x59, 0xb4, 0xc9, 0x15, 0xa1, 0x4b, 0x46, 0x2f, 0xc6, 0x90, 
+  0x06, 0x4d, 0x8b, 0x0d, 0x41, 0x99, 0x58, 0x0d, 0xf3, 0x50, 0x2f, 0x48, 0x71, 0xa5, 0xe6, 0x48, 
+  0xa8, 0xe6, 0x4c, 0x5c, 0xc0, 0x7b, 0xd3, 0xf6, 0x18, 0x71, 0x8c, 0x8f, 0xb4, 0x59, 0xd3, 0x1d, 
+  0xf7, 0x45, 0x84, 0xa9, 0x67, 0xda, 0x8f, 0x12, 0x03, 0xa5, 0x79, 0x9c, 0xee, 0x80, 0x90, 0xc5, 
+  0x6d, 0xcb, 0x98, 0xb8, 0x6f, 0xcc, 0x8d, 0x00, 0xc4, 0xad, 0x84, 0xdd, 0x60, 0xd3, 0x76, 0x25, 
+  0x5d, 0x57, 0xe9, 0x15, 0xf8, 0xe5, 0xb6, 0x22, 0xc5, 0x2a, 0xaf, 0x3d, 0x86, 0x88, 0xd8, 0x90, 
+  0x10, 0x64, 0x64, 0x42, 0x6b, 0x61, 0x2b, 0x86, 0x21, 0xe9, 0x85, 0x42, 0xe4, 0xed, 0x30, 0x69, 
+  0x07, 0x20, 0xe9, 0xde, 0x0b, 0x2c, 0x32, 0x39, 0x5d, 0xcc, 0x4d, 0x37, 0x71, 0xf8, 0x26, 0x75, 
+  0xcd, 0x61, 0xdd, 0x76, 0x44, 0x35, 0xf0, 0x8e, 0x8c, 0xca, 0x97, 0x09, 0xfd, 0xa6, 0x52, 0x84, 
+  0x39, 0xdd, 0x77, 0x1c, 0xa0, 0x81, 0xdd, 0xd3, 0x06, 0x1d, 0xd5, 0x90, 0x0f, 0x6a, 0x7a, 0x3f, 
+  0xb6, 0x2d, 0xa0, 0x1f, 0x5e, 0x15, 0x0e, 0xf6, 0x58, 0x61, 0x8d, 0x8a, 0xe2, 0x4b, 0xd1, 0xed, 
+  0xe6, 0x7e, 0xdf, 0x09, 0x3c, 0x0e, 0xee, 0x0f, 0x67, 0x37, 0x91, 0xeb, 0xb5, 0x25, 0xf9, 0x20, 
+  0x4d, 0x5d, 0x07, 0x42, 0xd7, 0x91, 0xfa, 0x40, 0x3e, 0x67, 0x24, 0xaa, 0x96, 0x0b, 0x5a, 0x3d, 
+  0xae, 0x74, 0x72, 0x30, 0xc4, 0x21, 0x3a, 0xfe, 0x4b, 0x09, 0x17, 0xa6, 0xea, 0x89, 0x93, 0x6e, 
+  0x41, 0x0d, 0xe6, 0xfa, 0xd7, 0x85, 0xfb, 0x84, 0x56, 0x4a, 0x9b, 0x7c, 0x3f, 0x44, 0x3d, 0xd2, 
+  0x6a, 0xea, 0x7b, 0xb3, 0x72, 0x71, 0xe3, 0x75, 0x19, 0x6b, 0x9b, 0xe4, 0x0e, 0x43, 0x5f, 0xa8, 
+  0x9d, 0x73, 0x9a, 0x47, 0x1d, 0x9e, 0x08, 0x0d, 0x75, 0xa8, 0xb2, 0x2a, 0xaf, 0x56, 0xd9, 0x7a, 
+  0x51, 0xae, 0x34, 0x88, 0x51, 0xb7, 0x09, 0xc3, 0x56, 0x41, 0x66, 0x78, 0x52, 0xec, 0x7e, 0xfd, 
+  0x97, 0xfa, 0x2a, 0x19, 0x82, 0x7a, 0xcf, 0xe6, 0x1b, 0xd3, 0x87, 0x42, 0x1b, 0x72, 0x0f, 0xf9, 
+  0x00, 0x3f, 0xc6, 0xf1, 0x7a, 0x7c, 0x3e, 0xab, 0xec, 0x7c, 0x76, 0x36, 0xc7, 0x34, 0xb4, 0x2b, 
+  0x17, 0xd1, 0xef, 0x87, 0xaf, 0x7f, 0xa8, 0xeb, 0x2b, 0xa5, 0x1a, 0xd9, 0xdc, 0x98, 0x6c, 0x7f, 
+  0x7d, 0x50, 0x27, 0xb7, 0x7b, 0x9c, 0xa0, 0xbf, 0xff, 0xd5, 0x57, 0x5f, 0xd3, 0x8f, 0x6f, 0x36, 
+  0xe1, 0xcb, 0x3a, 0xe9, 0x3e, 0x84, 0x46, 0xc7, 0x25, 0x0d, 0x95, 0x6a, 0x95, 0x0c, 0x87, 0x2f, 
+  0x49, 0xcb, 0xf0, 0xae, 0xa9, 0x4b, 0x9f, 0x55, 0x19, 0xf5, 0x53, 0x9d, 0xa7, 0xcb, 0x15, 0xe2, 
+  0x3f, 0x5f, 0xd6, 0xe1, 0x25, 0xdf, 0x98, 0x50, 0x15, 0x28, 0xa6, 0x1a, 0x6b, 0x94, 0x82, 0xe6, 
+  0x0b, 0xa9, 0x28, 0x02, 0x60, 0x47, 0x92, 0xa0, 0x21, 0x35, 0xdf, 0xdd, 0xa1, 0xe2, 0x61, 0xee, 
+  0xd8, 0x9d, 0xb4, 0x3c, 0xe0, 0x90, 0xf0, 0x3a, 0x2e, 0xfa, 0x5c, 0x35, 0x0f, 0x42, 0x35, 0xf3, 
+  0x30, 0xfa, 0xb9, 0x58, 0xc0, 0x72, 0xb6, 0x47, 0xe5, 0xa2, 0x24, 0xe1, 0x88, 0xa6, 0x3a, 0xfb, 
+  0x3a, 0x73, 0x1a, 0x44, 0xab, 0xd5, 0x75, 0x59, 0x2d, 0x00, 0xe7, 0x41, 0x77, 0x8b, 0x30, 0xd8, 
+  0x20, 0x48, 0xda, 0x27, 0x2b, 0x86, 0x87, 0x6c, 0x4e, 0xd0, 0xe1, 0xd8, 0x2a, 0xa8, 0x25, 0x7f, 
+  0x06, 0x1f, 0x6a, 0x59, 0x35, 0xfb, 0xce, 0xf9, 0xcd, 0x2d, 0x78, 0xb8, 0xf5, 0xaa, 0xf4, 0xd9, 
+  0xa7, 0xde, 0xef, 0x3b, 0xea, 0x4b, 0x65, 0x8b, 0x1d, 0xe6, 0xdc, 0x3c, 0x66, 0xac, 0xca, 0x9e, 
+  0xf3, 0x89, 0xe7, 0x7e, 0x5a, 0x84, 0x64, 0x06, 0x55, 0x57, 0x0d, 0x16, 0x0f, 0x3f, 0x09, 0xc6, 
+  0x7d, 0xeb, 0xbc, 0x35, 0x72, 0x4a, 0x96, 0x0d, 0xd3, 0x84, 0x9a, 0x5c, 0x2c, 0xcb, 0x74, 0xc1, 
+  0x3f, 0x58, 0xdc, 0xe0, 0x5f, 0xac, 0x38, 0xf2, 0x2f, 0xa5, 0x2e, 0xf2, 0x6f, 0xd6, 0xc5, 0x58, 
+  0x86, 0x99, 0x9f, 0xa5, 0xc5, 0xa9, 0x70, 0xe0, 0x86, 0x4a, 0x3f, 0x66, 0xa9, 0xa7, 0xd2, 0xaa, 
+  0x73, 0xac, 0x64, 0x17, 0x3e, 0xdb, 0x83, 0x40, 0x25, 0xe2, 0xc6, 0xa4, 0xf6, 0xf7, 0x42, 0x55, 
+  0x92, 0x16, 0x04, 0x5f, 0x9f, 0x0f, 0x2b, 0x4b, 0xb2, 0xc1, 0x85, 0x07, 0xf5, 0x54, 0x9f, 0x02, 
+  0x2e, 0x44, 0x5f, 0x31, 0xf1, 0xaa, 0x08, 0xb1, 0x84, 0x91, 0xfb, 0x95, 0xd9, 0x8b, 0xaf, 0x04, 
+  0x3d, 0xb1, 0x40, 0x56, 0x49, 0x2a, 0x32, 0xb9, 0x9d, 0xe5, 0x45, 0x5a, 0xdd, 0xc4, 0xcd, 0xe9, 
+  0x4d, 0x7c, 0xcb, 0xfe, 0x17, 0xb7, 0xe0, 0x26, 0xe4, 0xf4, 0x84, 0xae, 0xbd, 0xdd, 0x0f, 0x38, 
+  0xf4, 0xdf, 0xf4, 0x6a, 0x89, 0x28, 0xf8, 0x56, 0xdf, 0xea, 0x1e, 0x2d, 0x7d, 0xfd, 0xe6, 0xa1, 
+  0x95, 0x76, 0xa1, 0xfa, 0x7e, 0xd2, 0x7c, 0x85, 0x34, 0xee, 0xed, 0x7b, 0xeb, 0x63, 0x42, 0xe2, 
+  0xac, 0x2c, 0x4d, 0x19, 0xaa, 0x75, 0xbf, 0x49, 0xa0, 0x04, 0xee, 0x10, 0xaf, 0xbb, 0x25, 0x9e, 
+  0x2f, 0x5f, 0x4e, 0x9b, 0x75, 0xd9, 0x08, 0x90, 0x3b, 0x46, 0x26, 0x71, 0xd8, 0x0a, 0xfc, 0x90, 
+  0x6b, 0x1b, 0x28, 0xb5, 0x6d, 0x60, 0xd3, 0x31, 0x99, 0xf3, 0x63, 0x4a, 0x5f, 0xb3, 0x75, 0x38, 
+  0x3e, 0x26, 0xdf, 0x8d, 0x03, 0xb7, 0x26, 0x04, 0x87, 0x87, 0xea, 0xdd, 0x29, 0x12, 0x79, 0x23, 
+  0x11, 0x0f, 0xb2, 0xe3, 0x20, 0x32, 0xde, 0x47, 0x29, 0xa2, 0xdc, 0x8c, 0x8d, 0x8f, 0x30, 0x1c, 
+  0x38, 0x6e, 0xc4, 0x2d, 0xe7, 0xb3, 0xf9, 0x65, 0xef, 0xf9, 0xcf, 0x3b, 0xcd, 0x15, 0xc7, 0xdb, 
+  0xa8, 0x9e, 0xb6, 0xfb, 0x7e, 0xe6, 0x4f, 0x62, 0xd4, 0x7a, 0x87, 0x82, 0x81, 0x9c, 0x66, 0x17, 
+  0xa3, 0xe3, 0x17, 0x64, 0x0f, 0x9f, 0xaa, 0x26, 0xee, 0x15, 0xb9, 0x44, 0x6e, 0x7a, 0x81, 0x30, 
+  0x90, 0x0c, 0xce, 0xe6, 0xbe, 0xce, 0x32, 0x62, 0x97, 0x23, 0x38, 0x35, 0x60, 0x15, 0xda, 0xf8, 
+  0xa9, 0x7e, 0xa1, 0xbb, 0xc2, 0x6e, 0xa7, 0x0a, 0x1e, 0x08, 0x04, 0xba, 0xa6, 0x33, 0x9b, 0x45, 
+  0xba, 0xfb, 0x8c, 0x26, 0xf1, 0x9b, 0xa3, 0x28, 0xff, 0xe2, 0x02, 0x0d, 0xee, 0x5f, 0xef, 0x40, 
+  0x2a, 0xfb, 0xde, 0x0b, 0x24, 0x8a, 0xe7, 0x56, 0xb9, 0x8e, 0xe3, 0x42, 0x7d, 0xd1, 0x67, 0x72, 
+  0x1c, 0xae, 0xaa, 0x39, 0x9d, 0xa3, 0x15, 0x9b, 0x24, 0x25, 0xaa, 0xc1, 0xc3, 0x6c, 0x19, 0x28, 
+  0x75, 0xc7, 0x8d, 0xa5, 0xac, 0x74, 0x78, 0x20, 0x28, 0x3c, 0x24, 0x6a, 0x9c, 0x44, 0x39, 0xdf, 
+  0x5a, 0x5f, 0x44, 0x0d, 0xfb, 0x66, 0xef, 0x1b, 0xde, 0xd9, 0xe4, 0x10, 0x6f, 0xfa, 0x8c, 0x0d, 
+  0x82, 0x0e, 0x4a, 0x0b, 0xc8, 0x4a, 0x82, 0x9e, 0x01, 0x0b, 0x08, 0x30, 0xbf, 0x89, 0x3d, 0xfc, 
+  0xad, 0x0e, 0x7f, 0xad, 0x11, 0x0d, 0xf6, 0x0b, 0x02, 0x5d, 0x92, 0xe0, 0xfd, 0xc4, 0x9f, 0x24, 
+  0x0f, 0xef, 0x1e, 0x04, 0x77, 0xef, 0x27, 0x12, 0x77, 0x68, 0x0d, 0x48, 0x28, 0x15, 0x57, 0xb1, 
+  0x37, 0x57, 0x0e, 0x46, 0xf1, 0x1a, 0x5f, 0x69, 0x7f, 0x63, 0x37, 0x96, 0xf2, 0xd7, 0x5a, 0xe2, 
+  0x8f, 0x59, 0xc5, 0x91, 0x90, 0xfd, 0x91, 0xf7, 0x41, 0x0c, 0xd2, 0x8e, 0x3c, 0x2c, 0x01, 0x1c, 
+  0x59, 0xef, 0xc0, 0xc0, 0x33, 0xd8, 0xb1, 0x7c, 0xe5, 0x85, 0xf7, 0x40, 0xc5, 0x26, 0x43, 0xa1, 
+  0x32, 0xe0, 0x92, 0x34, 0x18, 0x7e, 0x31, 0x89, 0xe8, 0xd4, 0xf5, 0xc1, 0xc4, 0xa3, 0x7f, 0xbd, 
+  0x1e, 0x28, 0x03, 0x65, 0x70, 0x66, 0x17, 0x42, 0xf6, 0x7f, 0xeb, 0x42, 0x68, 0x9e, 0xa9, 0x0c, 
+  0xfd, 0x1e, 0xfe, 0x4a, 0xc6, 0x2c, 0x1c, 0x02, 0xf2, 0x16, 0xfc, 0x21, 0x9d, 0xe8, 0x10, 0x03, 
+  0x0e, 0xa4, 0x9a, 0xaf, 0x7b, 0x14, 0xb0, 0xbc, 0xee, 0x19, 0xe4, 0x6f, 0x38, 0x27, 0x7c, 0x88, 
+  0xb1, 0xce, 0x99, 0x30, 0x9d, 0x80, 0x97, 0x10, 0x99, 0xb4, 0xc7, 0xc6, 0x4f, 0xf0, 0x8b, 0xf8, 
+  0x09, 0x46, 0x55, 0x10, 0xb7, 0xfa, 0x89, 0xfb, 0xc7, 0x72, 0x47, 0xe8, 0xfe, 0xd2, 0x1e, 0x04, 
+  0x55, 0x92, 0x43, 0xfd, 0x2a, 0x9e, 0x73, 0x8d, 0x99, 0x4a, 0x4d, 0x28, 0x71, 0xfb, 0x1f, 0x27, 
+  0x5d, 0x0f, 0x6c, 0xd9, 0x04, 0x7d, 0x56, 0x23, 0x6f, 0x70, 0x9d, 0xae, 0x06, 0x24, 0xdc, 0x0e, 
+  0x30, 0x80, 0xd0, 0x63, 0x21, 0xc0, 0xb1, 0x37, 0xa1, 0xdb, 0x1b, 0x89, 0xe8, 0xae, 0x34, 0x05, 
+  0x2e, 0x00, 0x43, 0x7b, 0xe1, 0x20, 0x7f, 0xc1, 0xc0, 0x67, 0xb2, 0x1b, 0x37, 0x61, 0xd1, 0x83, 
+  0x24, 0xda, 0x70, 0x79, 0x4d, 0x5e, 0xf8, 0x17, 0x3a, 0x0d, 0x1a, 0xa1, 0xe7, 0x3e, 0xbd, 0x3d, 
+  0x57, 0x97, 0x87, 0x40, 0x30, 0xe6, 0x97, 0x77, 0xfb, 0xbb, 0x6e, 0x75, 0x25, 0x06, 0x30, 0x02, 
+  0x95, 0xc0, 0x04, 0x56, 0x22, 0x70, 0x1e, 0x74, 0x85, 0xb9, 0x2f, 0x98, 0xde, 0x65, 0x92, 0x37, 
+  0x14, 0x06, 0x7a, 0x6d, 0xe1, 0x30, 0x6b, 0x71, 0x27, 0x82, 0xba, 0x5d, 0xab, 0x6d, 0x89, 0xef, 
+  0xff, 0x86, 0xb8, 0xae, 0x1c, 0x66, 0x00, 0x9c, 0xe0, 0x91, 0xd4, 0x53, 0xd0, 0xc7, 0xa8, 0x83, 
+  0xec, 0x1f, 0x58, 0xfc, 0xef, 0xde, 0x01, 0x06, 0xdb, 0xf7, 0x07, 0xbb, 0xf2, 0xc7, 0x3e, 0xf0, 
+  0x42, 0x30, 0x0a, 0xff, 0x56, 0x5b, 0xf2, 0xbf, 0x71, 0x4c, 0xa9, 0x88, 0x0b, 0xae, 0xa2, 0xdf, 
+  0x66, 0xd0, 0x8d, 0x17, 0x9b, 0x4c, 0x8f, 0x63, 0xbf, 0x37, 0x77, 0xd9, 0x17, 0xed, 0x1d, 0x0b, 
+  0x2f, 0xb2, 0x56, 0xfa, 0xde, 0x72, 0x82, 0xe4, 0x34, 0xff, 0x2f, 0xbf, 0x67, 0xd0, 0xf6, 0xbb, 
+  0xce, 0xd2, 0x15, 0xcc, 0xc8, 0xe2, 0x68, 0x7d, 0x66, 0x42, 0xa2, 0x55, 0x34, 0x51, 0xcf, 0x1a, 
+  0x87, 0xa4, 0xcc, 0xe4, 0x19, 0x3e, 0x05, 0xb0, 0x44, 0x69, 0x15, 0xf3, 0xf3, 0xe4, 0x89, 0xc4, 
+  0x1b, 0x90, 0xaa, 0x38, 0x99, 0xd6, 0xad, 0x27, 0x80, 0x61, 0x2f, 0xa0, 0x17, 0xcc, 0x93, 0x1b, 
+  0x01, 0x70, 0xad, 0xc3, 0x92, 0xbf, 0x6c, 0x69, 0x48, 0xd0, 0x5e, 0xd0, 0x7e, 0xdf, 0xac, 0xc3, 
+  0x2f, 0xa2, 0xcb, 0xac, 0x3a, 0xa5, 0xb2, 0xc7, 0x90, 0x69, 0x1b, 0x15, 0x2b, 0x90, 0xd5, 0x93, 
+  0xd7, 0x1e, 0x65, 0x01, 0x60, 0x29, 0xe8, 0xbe, 0x05, 0x8a, 0xb5, 0x41, 0x98, 0xe4, 0xad, 0x8c, 
+  0x76, 0xad, 0x59, 0xee, 0xec, 0x1f, 0xac, 0xd8, 0x4e, 0x02, 0xf8, 0x17, 0x65, 0x44, 0x86, 0x32, 
+  0x0d, 0xdd, 0x5b, 0x8e, 0xf6, 0x98, 0x1f, 0x8c, 0xa3, 0x73, 0x7d, 0xc7, 0x8e, 0x12, 0xd7, 0xbd, 
+  0xd8, 0xab, 0xb5, 0x40, 0xd1, 0x7b, 0x6f, 0xdf, 0xbc, 0xa3, 0xdd, 0x30, 0xdc, 0x3b, 0x48, 0x9b, 
+  0x57, 0xec, 0x1a, 0x41, 0x00, 0x25, 0xd9, 0xb2, 0x83, 0x48, 0x38, 0x93, 0xb2, 0x4f, 0x06, 0x2d, 
+  0x90, 0xdb, 0xcc, 0x99, 0x88, 0x61, 0x1a, 0xa1, 0xb4, 0x5f, 0x4d, 0xb0, 0x31, 0x2e, 0xf2, 0x4f, 
+  0xdf, 0x1b, 0xc8, 0x30, 0xdf, 0x1a, 0x84, 0xf8, 0x26, 0x9c, 0x61, 0x8a, 0x89, 0x88, 0x7d, 0x4b, 
+  0xcf, 0x5e, 0xfa, 0x76, 0xee, 0x0e, 0x9b, 0x76, 0xf4, 0xde, 0xc2, 0xc6, 0xf1, 0xa3, 0x65, 0xc5, 
+  0xb2, 0x78, 0xb3, 0x48, 0x5c, 0x03, 0xe1, 0x7f, 0x63, 0x54, 0xdf, 0xc6, 0x74, 0xd5, 0x78, 0xa7, 
+  0xc3, 0xc6, 0xae, 0x16, 0xb6, 0x8c, 0x72, 0xb6, 0x79, 0xcf, 0x31, 0xfc, 0x85, 0x8d, 0x9f, 0xaa, 
+  0x1d, 0x50, 0xc8, 0xd0, 0x7b, 0xf5, 0x71, 0xb2, 0x4d, 0x9f, 0x17, 0xe0, 0xd3, 0xa0, 0x47, 0x0b, 
+  0x57, 0x80, 0x7c, 0xd6, 0x68, 0x71, 0x0c, 0x72, 0xb4, 0x66, 0xfb, 0x06, 0x2d, 0xb2, 0xaf, 0xf6, 
+  0x44, 0x73, 0xf3, 0x6c, 0xb4, 0xfa, 0x8c, 0xf7, 0x15, 0x4d, 0x9b, 0x13, 0x2a, 0xde, 0xf0, 0xcf, 
+  0xf8, 0x8b, 0xc0, 0xea, 0x16, 0x53, 0xae, 0x62, 0xca, 0xf3, 0x38, 0xc3, 0xcc, 0x67, 0x7f, 0xfc, 
+  0xed, 0x06, 0xe4, 0x95, 0x34, 0x03, 0xe7, 0x18, 0x57, 0xf3, 0x86, 0xb8, 0xce, 0x22, 0x1c, 0xd7, 
+  0x7c, 0xec, 0x40, 0x40, 0x4c, 0x96, 0xaa, 0x0d, 0xbe, 0x00, 0xba, 0xaa, 0xaa, 0xd9, 0x8e, 0x19, 
+  0xae, 0x9b, 0x13, 0x4b, 0xa6, 0x9d, 0x03, 0xee, 0x7c, 0x43, 0x29, 0x8d, 0x07, 0x00, 0xfe, 0x2e, 
+  0xff, 0x4c, 0xfb, 0x02, 0x0e, 0x02, 0xc9, 0xa0, 0x2f, 0x47, 0x6b, 0x7b, 0x13, 0x06, 0xe5, 0x11, 
+  0x8d, 0xff, 0x14, 0x78, 0x37, 0x4b, 0xd3, 0x0c, 0x52, 0x45, 0x98, 0x5e, 0xbd, 0x62, 0xa6, 0x39, 
+  0xb6, 0x2d, 0x5b, 0x8c, 0x77, 0x25, 0x78, 0x5f, 0x43, 0xeb, 0xc4, 0x9a, 0x89, 0x60, 0x43, 0x93, 
+  0x86, 0x5e, 0xeb, 0x3c, 0xc9, 0xc2, 0xc1, 0x96, 0xc5, 0x24, 0x57, 0xa8, 0xbe, 0x40, 0x8b, 0xc2, 
+  0x5e, 0x79, 0x82, 0xbf, 0x72, 0xb4, 0x03, 0x58, 0x94, 0xab, 0x51, 0xda, 0x14, 0xc1, 0xb3, 0xb9, 
+  0x0c, 0x7e, 0xa8, 0xe3, 0x9d, 0x15, 0xff, 0x19, 0x81, 0x76, 0x18, 0x09, 0x36, 0xa7, 0x8c, 0x58, 
+  0x3f, 0xa9, 0x23, 0x3e, 0xd0, 0xcf, 0x3d, 0x09, 0xe2, 0x25, 0x77, 0xce, 0x89, 0x70, 0x12, 0x59, 
+  0xe6, 0xc4, 0xb2, 0xf5, 0x25, 0x25, 0x95, 0x76, 0x1b, 0x5c, 0x87, 0xd9, 0xfa, 0x04, 0x65, 0x22, 
+  0xde, 0x62, 0xae, 0x52, 0x9f, 0x29, 0x32, 0x23, 0x45, 0x67, 0xbf, 0x73, 0x30, 0xbd, 0x41, 0x1e, 
+  0x69, 0xa3, 0x0a, 0x54, 0x93, 0x6a, 0x9b, 0xf9, 0x66, 0xa2, 0xd3, 0xd8, 0xfb, 0xf8, 0xff, 0xc2, 
+  0x02, 0xca, 0x9e, 0x6d, 0xc4, 0xb4, 0xb3, 0xfd, 0xc2, 0x5b, 0x00, 0xea, 0x66, 0xdc, 0x9b, 0x48, 
+  0xb8, 0x3e, 0xcd, 0xfe, 0x90, 0x46, 0x85, 0xe8, 0xb9, 0x38, 0x93, 0x0e, 0x94, 0x2b, 0xbf, 0xcb, 
+  0x15, 0x84, 0x78, 0xe3, 0xa6, 0x3d, 0x29, 0xb2, 0xb7, 0xd1, 0x49, 0xef, 0xe1, 0x55, 0x0f, 0xaf, 
+  0x3a, 0x52, 0xb5, 0x95, 0xfd, 0xd3, 0xc6, 0xbc, 0xd0, 0x6f, 0x07, 0x4e, 0x21, 0xa7, 0x32, 0x08, 
+  0x6b, 0xcd, 0x40, 0x94, 0x51, 0x5b, 0xd9, 0x33, 0x24, 0xa8, 0xb7, 0xbf, 0x6b, 0xe3, 0xb4, 0x54, 
+  0x8c, 0x73, 0x66, 0x46, 0x74, 0x3a, 0x21, 0x44, 0x97, 0xc9, 0xe5, 0xb7, 0x6c, 0xfa, 0x03, 0x50, 
+  0xe6, 0x42, 0x5d, 0x54, 0x1b, 0xd6, 0x98, 0x55, 0x1e, 0x46, 0x96, 0x80, 0x4c, 0x70, 0x77, 0x27, 
+  0xbf, 0x5b, 0xa5, 0x18, 0xd8, 0xc0, 0x4c, 0xd4, 0x9e, 0x39, 0x2d, 0x36, 0x5c, 0x0b, 0xb0, 0x08, 
+  0x0e, 0x65, 0x61, 0x24, 0xe9, 0xc0, 0xe6, 0x03, 0xe3, 0x0f, 0x46, 0x48, 0xdd, 0x70, 0x9e, 0x5a, 
+  0x1d, 0xf2, 0xeb, 0xa3, 0xf2, 0xca, 0xd0, 0x5e, 0xc3, 0xdc, 0xc3, 0x1f, 0xa9, 0x5d, 0x08, 0x84, 
+  0x5d, 0x4d, 0x29, 0xed, 0xc9, 0xe0, 0xde, 0x96, 0x39, 0x94, 0xf3, 0xbf, 0xa6, 0x8b, 0x85, 0xb6, 
+  0xe9, 0x08, 0xeb, 0x33, 0x6a, 0xe5, 0xef, 0xa1, 0xe6, 0x91, 0x3c, 0xa1, 0x5d, 0x94, 0x09, 0x2c, 
+  0x25, 0xbb, 0x8d, 0xd4, 0x7c, 0xab, 0x2b, 0xff, 0x62, 0x1a, 0x86, 0x6b, 0xfd, 0x76, 0x3e, 0x06, 
+  0xba, 0xe8, 0xaf, 0x74, 0xaa, 0x73, 0x8f, 0xb6, 0x89, 0xdf, 0xdd, 0xcd, 0xb2, 0x8d, 0x0b, 0x23, 
+  0x6b, 0x18, 0xcc, 0xe0, 0x43, 0x34, 0x23, 0xd9, 0x0b, 0x0d, 0xe3, 0x99, 0x9c, 0x57, 0x63, 0xdf, 
+  0x4e, 0xbc, 0xab, 0x75, 0x66, 0x52, 0x99, 0x38, 0x45, 0x20, 0xe1, 0x8e, 0xef, 0xd9, 0x84, 0xee, 
+  0xa3, 0x93, 0xe4, 0xd0, 0x3d, 0x20, 0xb8, 0x90, 0xca, 0x11, 0x7f, 0xd7, 0x1e, 0x02, 0xd0, 0x43, 
+  0xac, 0x19, 0x1a, 0xf4, 0xb0, 0x20, 0xd3, 0x5a, 0x00, 0xff, 0x2b, 0x82, 0x0a, 0xc7, 0x58, 0x17, 
+  0xf4, 0x6b, 0xf8, 0x25, 0x1d, 0x58, 0x2f, 0x18, 0x17, 0x61, 0x39, 0x29, 0xe2, 0xca, 0x9e, 0xd8, 
+  0x81, 0x42, 0x32, 0xdb, 0x60, 0xc5, 0x09, 0x7b, 0x29, 0x24, 0x2d, 0xb4, 0x60, 0x6c, 0xd6, 0xbc, 
+  0x63, 0x38, 0xfb, 0x6f, 0xe1, 0x70, 0x81, 0x16, 0xc7, 0x42, 0x8a, 0x7a, 0x45, 0xb3, 0x76, 0xf9, 
+  0x56, 0x7d, 0xa1, 0xed, 0x7c, 0xa8, 0xb4, 0x83, 0x32, 0x0d, 0x6a, 0x11, 0x84, 0x4f, 0x0d, 0x9b, 
+  0xf0, 0x84, 0x47, 0x7d, 0xb3, 0xa5, 0x50, 0xa5, 0x4c, 0x58, 0x0a, 0xe1, 0xc7, 0xfa, 0x90, 0x8a, 
+  0x00, 0xdb, 0x30, 0xf6, 0xf2, 0xf8, 0x8e, 0x15, 0x39, 0x89, 0xf5, 0xd5, 0x52, 0xe1, 0xed, 0x95, 
+  0x9b, 0x0c, 0xbf, 0x29, 0x8b, 0xf4, 0xde, 0x28, 0xd5, 0xd6, 0x96, 0x78, 0x15, 0x02, 0x35, 0xa5, 
+  0xa4, 0x2d, 0x10, 0xa7, 0xad, 0xfb, 0x2b, 0xa1, 0x3b, 0x3d, 0x41, 0x48, 0x42, 0x6f, 0x9e, 0x56, 
+  0xbb, 0xdf, 0xf0, 0xdd, 0x2c, 0x08, 0x64, 0x2b, 0x07, 0x90, 0x56, 0x38, 0xe4, 0x03, 0xb0, 0xe7, 
+  0x1c, 0xc0, 0x38, 0xb2, 0x41, 0x68, 0x92, 0xb4, 0x58, 0x53, 0xd9, 0x36, 0x0c, 0xcb, 0xf7, 0x0d, 
+  0x1c, 0x55, 0x86, 0x07, 0xcf, 0x1e, 0x43, 0xa7, 0x9b, 0xdd, 0x59, 0xde, 0x82, 0x34, 0xd4, 0xa9, 
+  0x79, 0x4f, 0x1a, 0x21, 0x66, 0xb1, 0x6a, 0xaf, 0x5a, 0x53, 0x6f, 0xce, 0x0b, 0x27, 0x17, 0x73, 
+  0xc7, 0xe0, 0x44, 0x86, 0xa0, 0x5b, 0x3e, 0x34, 0xac, 0x63, 0x19, 0x2f, 0x86, 0xac, 0x7d, 0xd2, 
+  0xa0, 0xc3, 0xfd, 0x61, 0xe5, 0x1c, 0xe9, 0x02, 0x9a, 0xe4, 0x57, 0x0a, 0xb8, 0x47, 0xcd, 0xc3, 
+  0x03, 0x9d, 0xe2, 0x91, 0x08, 0xe7, 0xa9, 0x22, 0x39, 0xa5, 0x69, 0x17, 0x3b, 0x04, 0xa8, 0x48, 
+  0xaa, 0x03, 0xf7, 0xf0, 0x44, 0x83, 0xac, 0x08, 0x96, 0x72, 0x33, 0x38, 0x3c, 0x64, 0xcf, 0x0e, 
+  0x38, 0x79, 0x76, 0xa0, 0x32, 0x6a, 0x07, 0x3a, 0x95, 0x76, 0x40, 0xd2, 0x6a, 0xfe, 0x67, 0x36, 
+  0x90, 0x56, 0x0e, 0xe8, 0xe9, 0xf3, 0x8b, 0xc1, 0x62, 0xb6, 0x94, 0x1f, 0x97, 0xe5, 0x7a, 0x95, 
+  0x21, 0x1f, 0x55, 0x7e, 0xad, 0xaf, 0xe4, 0x2f, 0x94, 0x10, 0xf9, 0x05, 0x6b, 0xbb, 0xfa, 0x45, 
+  0x75, 0xf1, 0x0f, 0xa4, 0x81, 0xab, 0x73, 0xf4, 0xc5, 0xa9, 0xa0, 0x58, 0x4b, 0x07, 0x92, 0xf3, 
+  0x38, 0x90, 0x5c, 0xc9, 0xc1, 0x45, 0x76, 0xc3, 0xf5, 0xd2, 0xdf, 0x2b, 0x50, 0x22, 0xe1, 0x07, 
+  0x55, 0xaf, 0x62, 0xcc, 0xa9, 0x5f, 0xd7, 0x9e, 0x15, 0x88, 0xd1, 0x99, 0x62, 0x34, 0xfe, 0x8a, 
+  0xf6, 0xf8, 0x53, 0x43, 0x60, 0xaf, 0x03, 0xdd, 0x38, 0xd1, 0x72, 0x6f, 0x21, 0x59, 0xd2, 0x0c, 
+  0xe0, 0x2a, 0x59, 0x69, 0xca, 0xb3, 0x5d, 0x74, 0xf3, 0xa6, 0xcf, 0xf0, 0x6a, 0xf7, 0x64, 0x4d, 
+  0x37, 0xef, 0x8a, 0xf9, 0xd9, 0xbc, 0x2e, 0x82, 0x00, 0xb2, 0x6e, 0x75, 0xc8, 0xf2, 0x8f, 0xef, 
+  0x43, 0xc3, 0x96, 0x77, 0xe3, 0x24, 0x6e, 0x7c, 0xbf, 0x70, 0x5d, 0x74, 0x6e, 0x69, 0xdd, 0x70, 
+  0x72, 0x62, 0xee, 0xa0, 0xf2, 0x1a, 0x19, 0xe1, 0x0b, 0x4c, 0x0a, 0x16, 0xed, 0x01, 0x9e, 0xb1, 
+  0xe5, 0x2e, 0x73, 0x0f, 0xb6, 0xe1, 0x2d, 0xdd, 0xc9, 0x8f, 0xf7, 0x1e, 0x3f, 0xf6, 0x54, 0x5f, 
+  0xe2, 0x44, 0x1d, 0x72, 0xbc, 0xf3, 0x63, 0xcf, 0xc0, 0x79, 0x5f, 0x55, 0xe5, 0xe7, 0x9b, 0x64, 
+  0x0b, 0x95, 0x19, 0x8b, 0x34, 0x6d, 0xd3, 0x97, 0xa8, 0xf4, 0x9c, 0x2f, 0x2a, 0x69, 0x0c, 0x05, 
+  0x64, 0x62, 0x8b, 0x7d, 0x30, 0x59, 0x89, 0x80, 0xda, 0xa8, 0x79, 0x5f, 0x05, 0x50, 0xb0, 0xfb, 
+  0xa8, 0x9f, 0x95, 0x72, 0xa6, 0x52, 0xa5, 0x2b, 0x9d, 0xd0, 0xd6, 0xae, 0x81, 0x11, 0xe7, 0xa2, 
+  0xd3, 0x75, 0xbe, 0x00, 0x28, 0x4b, 0xf3, 0x07, 0x66, 0x22, 0xfc, 0x1d, 0x8d, 0xc2, 0x1c, 0x12, 
+  0xf0, 0x59, 0xb9, 0x5c, 0xfc, 0x0c, 0x23, 0xbf, 0x0b, 0xa6, 0xc2, 0xa8, 0xb2, 0x74, 0xf6, 0xb7, 
+  0x34, 0xaf, 0x47, 0xa3, 0x58, 0x1d, 0x31, 0xbb, 0x03, 0x87, 0x04, 0x70, 0x1a, 0x61, 0xe2, 0x24, 
+  0x15, 0x6a, 0x23, 0x08, 0x02, 0x27, 0x12, 0x2b, 0x31, 0xe5, 0x85, 0xc9, 0x75, 0x4c, 0x9e, 0xf3, 
+  0xbd, 0x2f, 0xd5, 0x83, 0x92, 0x1b, 0x3e, 0x14, 0xe8, 0x89, 0x64, 0x06, 0x0e, 0x6e, 0x2a, 0xb4, 
+  0x44, 0x98, 0x56, 0xf2, 0x27, 0x70, 0xd3, 0x61, 0x62, 0xfe, 0xcc, 0xf7, 0x5f, 0x9b, 0x44, 0x6d, 
+  0xbe, 0xe5, 0x27, 0x7a, 0xc7, 0x2a, 0x9f, 0x27, 0x7d, 0xb8, 0x4a, 0xb8, 0x0b, 0x90, 0x68, 0x0a, 
+  0xd7, 0xb5, 0xc1, 0xc9, 0x42, 0xca, 0x88, 0x85, 0x27, 0x07, 0x59, 0x6e, 0x48, 0x55, 0xa5, 0x3f, 
+  0xf9, 0x99, 0x4d, 0x3e, 0x0e, 0xc7, 0x77, 0xe8, 0xe9, 0x9a, 0x9b, 0x8f, 0x48, 0xdb, 0x74, 0x5e, 
+  0xd0, 0x9e, 0x2d, 0x7f, 0xa3, 0xf4, 0x72, 0xa1, 0x7f, 0xfb, 0x9e, 0xe4, 0x8b, 0x80, 0x1e, 0xa2, 
+  0x87, 0xad, 0xfb, 0x85, 0x92, 0xf4, 0x7f, 0x44, 0xee, 0xf9, 0xf9, 0x3f, 0x51, 0x32, 0xfc, 0x13, 
+  0xbf, 0x1f, 0x34, 0x14, 0x2b, 0x45, 0xf9, 0xac, 0x2c, 0x4e, 0x68, 0x81, 0xea, 0x05, 0xd7, 0xa1, 
+  0xa2, 0x10, 0x8c, 0x68, 0x14, 0xe1, 0xd7, 0x9f, 0x35, 0xb3, 0x54, 0xe8, 0xba, 0xcc, 0x15, 0x75, 
+  0xf8, 0x23, 0xb0, 0x1c, 0x36, 0x18, 0xb5, 0xcd, 0x39, 0xdc, 0xf6, 0x02, 0xa7, 0xad, 0x65, 0xe7, 
+  0x5c, 0xcb, 0xe8, 0x1f, 0x14, 0x1b, 0x84, 0xbf, 0x17, 0x22, 0x9c, 0x23, 0xf0, 0x3d, 0x1c, 0xd3, 
+  0x0a, 0xf5, 0x31, 0xf9, 0x60, 0x76, 0x86, 0xf0, 0x35, 0x1d, 0x14, 0xe9, 0xa7, 0x9c, 0xa6, 0x56, 
+  0x59, 0x85, 0x87, 0x74, 0xa4, 0x5e, 0xe5, 0x2d, 0xfd, 0xc4, 0xd7, 0x1e, 0xdb, 0x7e, 0x6a, 0xcc, 
+  0x51, 0x13, 0xbb, 0xe9, 0xcc, 0x74, 0x5f, 0x23, 0x05, 0xdd, 0xdd, 0x35, 0xf9, 0x3d, 0x60, 0xdc, 
+  0x41, 0x5c, 0x09, 0x3e, 0x4b, 0x93, 0xae, 0x57, 0x5a, 0x73, 0x6b, 0xdc, 0xf5, 0x36, 0x02, 0x9e, 
+  0x08, 0x88, 0xf9, 0xe9, 0x16, 0xb7, 0x54, 0x91, 0x9c, 0x87, 0x60, 0xe2, 0x02, 0x12, 0x8b, 0x95, 
+  0xfc, 0x98, 0xde, 0x5f, 0x6b, 0x0b, 0xcb, 0x3d, 0xec, 0x3c, 0x81, 0x49, 0xb9, 0x2d, 0xc6, 0x52, 
+  0xc5, 0xf3, 0xf3, 0xf0, 0x61, 0x4d, 0x62, 0xfe, 0xe5, 0xc4, 0x93, 0x50, 0xe0, 0x67, 0xbc, 0x43, 
+  0x78, 0x46, 0x41, 0x8c, 0xde, 0xcc, 0x74, 0x5e, 0x71, 0xf4, 0xa3, 0x34, 0x41, 0x0e, 0xde, 0xe2, 
+  0x7c, 0x53, 0x5d, 0x2e, 0xd5, 0x29, 0xac, 0x59, 0x86, 0x50, 0xbd, 0xe0, 0x7f, 0x1c, 0xb6, 0xd6, 
+  0x0e, 0x69, 0xdd, 0xe1, 0x1c, 0xe0, 0xc9, 0xd3, 0x23, 0x12, 0x11, 0xa3, 0x23, 0x8d, 0xa8, 0x56, 
+  0xce, 0x14, 0x70, 0xdf, 0x9b, 0x94, 0x96, 0x9e, 0x89, 0x5f, 0x44, 0xef, 0x66, 0xbc, 0x54, 0x36, 
+  0x27, 0x03, 0xeb, 0xb7, 0xf8, 0x41, 0x76, 0x76, 0xd4, 0xbd, 0x01, 0x89, 0x92, 0xc2, 0xb6, 0x6a, 
+  0xee, 0xab, 0xa2, 0x7a, 0x72, 0xfb, 0x20, 0xce, 0x36, 0x71, 0x11, 0xdd, 0xb0, 0xdd, 0x8f, 0xf6, 
+  0xff, 0x1f, 0x38, 0xc4, 0xef, 0x87, 0xb9, 0x43, 0x4b, 0x8b, 0x6e, 0x62, 0x0c, 0x25, 0xec, 0x6c, 
+  0x0b, 0x38, 0x1d, 0x6e, 0x5d, 0x0e, 0x72, 0x18, 0x47, 0x32, 0xb6, 0x09, 0x0a, 0xb2, 0x74, 0xb8, 
+  0xb2, 0x98, 0x09, 0xbb, 0xc1, 0x26, 0x39, 0x93, 0xa1, 0xe2, 0x4b, 0xe0, 0xb1, 0xf4, 0x51, 0x48, 
+  0xe9, 0x1b, 0xce, 0x87, 0xc9, 0xb0, 0x0e, 0x87, 0xab, 0x60, 0xec, 0x4b, 0x32, 0x69, 0xcd, 0x51, 
+  0x87, 0x58, 0x6c, 0x61, 0x79, 0xfb, 0x9c, 0x46, 0xcf, 0x52, 0xa0, 0x9e, 0xf8, 0x2b, 0xbe, 0xf3, 
+  0x3a, 0xf5, 0x69, 0xff, 0xb2, 0x4c, 0x8b, 0x80, 0xea, 0x82, 0xb6, 0x14, 0xd6, 0x13, 0x9f, 0x81, 
+  0x3a, 0x4e, 0xa2, 0x93, 0x94, 0x5a, 0xa6, 0x0a, 0xc3, 0x08, 0x48, 0xeb, 0xe3, 0xcc, 0x5f, 0x4e, 
+  0x40, 0x7f, 0x48, 0x5f, 0xaf, 0x04, 0x96, 0x44, 0x8c, 0x72, 0x7f, 0xa6, 0x3e, 0x53, 0xe7, 0x60, 
+  0x9b, 0xe2, 0x6e, 0xbb, 0xcd, 0xe3, 0x8a, 0x66, 0x17, 0x88, 0xd7, 0x6b, 0x12, 0x3b, 0x56, 0xcf, 
+  0xb3, 0xd5, 0x9c, 0x76, 0xc9, 0xb4, 0xa8, 0x9f, 0xe6, 0xac, 0xba, 0x72, 0x08, 0x13, 0xdb, 0x1c, 
+  0xce, 0xa2, 0x4f, 0x9c, 0xc9, 0x34, 0xdc, 0xc7, 0x7e, 0x1a, 0xa5, 0x72, 0xb0, 0xb7, 0xc1, 0x9b, 
+  0x2a, 0xd4, 0xa9, 0x70, 0xc1, 0x99, 0x6c, 0x2f, 0x12, 0xe3, 0xc3, 0xcd, 0x48, 0x14, 0xba, 0x05, 
+  0xac, 0xc7, 0x2c, 0xd9, 0x82, 0x6e, 0x96, 0xd8, 0x20, 0x53, 0x34, 0x1a, 0x5e, 0x84, 0x00, 0xf1, 
+  0xc9, 0x0d, 0x6b, 0xc4, 0xce, 0xfe, 0x38, 0x1f, 0x8d, 0x80, 0xe7, 0x39, 0x2d, 0x48, 0xa1, 0xa0, 
+  0x91, 0x42, 0x7f, 0x9b, 0x8b, 0x08, 0x62, 0x45, 0xeb, 0x7e, 0xe8, 0x18, 0x56, 0xb5, 0x0a, 0xf1, 
+  0x22, 0x52, 0x41, 0x97, 0x89, 0xf7, 0x75, 0xf4, 0x4d, 0xf4, 0x15, 0x12, 0x0a, 0x66, 0xbe, 0xa7, 
+  0x4e, 0x7a, 0xcd, 0x75, 0x74, 0x9b, 0x26, 0x86, 0xbf, 0x5d, 0x20, 0x63, 0xee, 0x97, 0xab, 0x05, 
+  0x2d, 0xdf, 0x2b, 0xc4, 0x73, 0x91, 0x50, 0x01, 0xa8, 0xdd, 0x9f, 0xd8, 0x96, 0xc5, 0xd8, 0x1d, 
+  0x38, 0xcd, 0x31, 0x29, 0xf6, 0x76, 0x67, 0x46, 0xd2, 0x49, 0xeb, 0x35, 0x25, 0xdb, 0x2a, 0x83, 
+  0x43, 0xf9, 0xcd, 0x75, 0xa1, 0x38, 0x5e, 0x6f, 0x18, 0x5c, 0x47, 0x43, 0x11, 0x58, 0xe3, 0x30, 
+  0xb3, 0x34, 0x12, 0xa7, 0x8a, 0x3a, 0xa8, 0xfb, 0xaa, 0x10, 0x4e, 0x4f, 0x27, 0x8b, 0x37, 0x73, 
+  0x47, 0x75, 0x6d, 0x6d, 0xc5, 0x1f, 0x3e, 0x70, 0xc6, 0xd1, 0x07, 0x5a, 0x41, 0xc3, 0xac, 0x35, 
+  0x87, 0x6d, 0x1a, 0x26, 0xf4, 0xa0, 0x4a, 0x90, 0x9a, 0x4b, 0xd2, 0x37, 0x86, 0x18, 0xe2, 0xad, 
+  0xf4, 0xc9, 0xd0, 0xb5, 0x1a, 0xd1, 0xc5, 0x94, 0x09, 0x8f, 0x2a, 0xc8, 0xbc, 0xfc, 0x01, 0x72, 
+  0x0b, 0x91, 0x5c, 0xbe, 0xf7, 0xad, 0x79, 0x7c, 0x3c, 0x3d, 0xde, 0xe4, 0x05, 0xa9, 0xd0, 0xc5, 
+  0x1c, 0x3b, 0x95, 0xec, 0xc6, 0x55, 0xd2, 0xb3, 0x89, 0xbd, 0xbb, 0xb9, 0x9c, 0x95, 0xcb, 0xb0, 
+  0x4c, 0x54, 0x42, 0xe2, 0xb8, 0x9c, 0xbe, 0x7e, 0xf8, 0x70, 0xf7, 0x65, 0x5e, 0xd1, 0xaa, 0xf5, 
+  0xf9, 0xfd, 0xee, 0x57, 0xbb, 0xb9, 0x68, 0x69, 0xaf, 0x39, 0xd4, 0xe5, 0xc9, 0x29, 0x6c, 0x1e, 
+  0x13, 0xef, 0x1f, 0xd9, 0xcd, 0xac, 0x4c, 0x2b, 0x41, 0x7e, 0x21, 0x3d, 0xe6, 0x97, 0x57, 0xf2, 
+  0xe5, 0xbc, 0xe3, 0x64, 0xea, 0xb1, 0x98, 0x4b, 0xaa, 0xa3, 0x92, 0x7f, 0xe5, 0x17, 0x4b, 0xc0, 
+  0xa4, 0x48, 0x96, 0xd1, 0x21, 0xe4, 0x48, 0x29, 0x9e, 0x78, 0xff, 0x1f, 0x84, 0x71, 0x57, 0xa8, 
+  0xa6, 0x89, 0xda, 0x55, 0x46, 0x6d, 0xe4, 0x5c, 0xe9, 0xbb, 0x3d, 0x58, 0xa5, 0x34, 0xd8, 0x5f, 
+  0x71, 0x50, 0x8d, 0x0b, 0x9a, 0x1a, 0xb4, 0x08, 0xd2, 0x87, 0x3f, 0x4e, 0x32, 0xb5, 0x61, 0xd3, 
+  0xe8, 0xbd, 0x52, 0x83, 0x43, 0x04, 0x7e, 0x4c, 0xe1, 0x70, 0x9d, 0x7c, 0xb4, 0x6c, 0xe8, 0xb6, 
+  0x65, 0xe3, 0x6b, 0x5a, 0xa2, 0x3e, 0xb6, 0x1d, 0x2d, 0x8b, 0xfc, 0x93, 0xc7, 0xbc, 0x45, 0x5b, 
+  0xf0, 0x5b, 0x72, 0x44, 0x4a, 0xd8, 0x0e, 0xa8, 0xf7, 0x9f, 0xbf, 0x9e, 0x0f, 0x77, 0x76, 0xa6, 
+  0xf9, 0xc9, 0xe0, 0xb4, 0x1e, 0xbc, 0x7a, 0x31, 0xf0, 0x46, 0x83, 0x11, 0x90, 0x50, 0x8f, 0xbf, 
+  0x3f, 0xc8, 0xbf, 0x3f, 0xd8, 0xa5, 0xff, 0x86, 0x53, 0x5a, 0x5a, 0xf2, 0x93, 0xe3, 0x9d, 0x1d, 
+  0x2a, 0x9c, 0x91, 0x64, 0xca, 0xb9, 0x05, 0x7a, 0xc0, 0x7e, 0x73, 0x80, 0xc5, 0xe2, 0x7c, 0xe3, 
+  0x83, 0x05, 0x71, 0xf7, 0xfd, 0xbb, 0xd1, 0xee, 0xa9, 0xba, 0x74, 0x7b, 0x3a, 0x8f, 0xa7, 0x30, 
+  0xed, 0x9e, 0x21, 0xe2, 0x0a, 0x74, 0x37, 0x1f, 0xea, 0xf2, 0x02, 0x3c, 0x81, 0xbb, 0xff, 0xfe, 
+  0xf0, 0x41, 0xc5, 0xfc, 0xfc, 0x4a, 0x92, 0xd5, 0x89, 0xf2, 0xbf, 0x1e, 0xe1, 0xaa, 0xff, 0x21, 
+  0x7a, 0x1c, 0x4c, 0x1e, 0xec, 0x92, 0x2e, 0xb7, 0x0d, 0x59, 0x91, 0xfb, 0x33, 0x6b, 0xf7, 0x67, 
+  0xcd, 0xb3, 0x89, 0x45, 0xff, 0xb2, 0x0b, 0x52, 0xd8, 0x33, 0x3a, 0x45, 0x9c, 0xb4, 0x69, 0xdb, 
+  0x59, 0xdf, 0x0d, 0x1c, 0xc0, 0xfc, 0xce, 0x65, 0x6d, 0xdb, 0xad, 0x83, 0xf1, 0x17, 0x1a, 0x84, 
+  0xa8, 0x7e, 0xcc, 0x6f, 0x08, 0x7f, 0x3a, 0xc2, 0xcd, 0x78, 0x85, 0x36, 0xe1, 0xaf, 0xb3, 0x78, 
+  0x6b, 0x9a, 0x87, 0xc2, 0x71, 0x68, 0xf1, 0xb3, 0xf2, 0xe0, 0x52, 0x74, 0xe2, 0xcc, 0xd4, 0x5a, 
+  0x35, 0x58, 0x8b, 0xa0, 0x53, 0xb2, 0xd2, 0x50, 0x37, 0xe1, 0x4f, 0xe9, 0x16, 0xda, 0xe8, 0x34, 
+  0x12, 0x49, 0x67, 0xbc, 0x77, 0x40, 0x1a, 0xaf, 0x66, 0xf0, 0x29, 0xc2, 0xfd, 0x20, 0x66, 0x45, 
+  0x99, 0xb9, 0xd5, 0x24, 0x43, 0x60, 0x13, 0xfe, 0x36, 0x73, 0x22, 0x3f, 0x74, 0x03, 0x39, 0xb0, 
+  0x40, 0x5e, 0xdb, 0x67, 0x7e, 0x1b, 0x20, 0x3f, 0xb4, 0x5e, 0x5f, 0x9e, 0x54, 0xcb, 0x1a, 0x89, 
+  0xe8, 0x6f, 0xe5, 0x72, 0xcd, 0xec, 0xe5, 0x8e, 0x36, 0x81, 0x7c, 0xb6, 0xf5, 0x3b, 0x4f, 0x8f, 
+  0x1b, 0x22, 0x5b, 0xf7, 0x21, 0x86, 0xb2, 0x56, 0xe1, 0x4d, 0xf8, 0xba, 0x3f, 0x4c, 0x27, 0x6c, 
+  0xc2, 0xc3, 0xf4, 0xff, 0xa2, 0x62, 0x53, 0x23, 0x90, 0xa6, 0x55, 0xbb, 0xab, 0x63, 0xbb, 0xfa, 
+  0x3a, 0xed, 0x8e, 0x32, 0x64, 0xe7, 0xba, 0x0b, 0x23, 0xed, 0x1d, 0xb8, 0x5b, 0xe9, 0x51, 0xdc, 
+  0xef, 0x26, 0x97, 0xf7, 0x9e, 0xc5, 0x21, 0x53, 0xef, 0xe5, 0x6e, 0x0d, 0x61, 0x95, 0x6e, 0x85, 
+  0x3f, 0x43, 0x67, 0xe3, 0xdf, 0xa7, 0x90, 0xf0, 0x98, 0x48, 0xf8, 0x60, 0x6f, 0xc2, 0x1f, 0x53, 
+  0x21, 0x72, 0x80, 0x98, 0xd1, 0x7c, 0xee, 0x2a, 0x04, 0x58, 0xd6, 0x32, 0x8d, 0x69, 0x24, 0xb1, 
+  0x82, 0x1d, 0x67, 0xe1, 0x03, 0xc4, 0x62, 0xa7, 0xb3, 0xb8, 0x98, 0xd4, 0x74, 0xf4, 0x3c, 0x3e, 
+  0x09, 0x5f, 0xf4, 0xbc, 0xe2, 0xd0, 0x60, 0x4f, 0x65, 0x06, 0x75, 0xc4, 0xc6, 0xae, 0xd8, 0xb2, 
+  0x5b, 0xfa, 0x1c, 0x95, 0xa8, 0xe7, 0x28, 0xe2, 0x7d, 0x8d, 0xf7, 0x81, 0x5e, 0xab, 0x3b, 0xca, 
+  0x74, 0xc4, 0xb2, 0x0a, 0x55, 0xd6, 0xac, 0x23, 0x90, 0xa4, 0x7c, 0xfb, 0x12, 0x24, 0xa2, 0xf9, 
+  0x96, 0x31, 0x0a, 0x18, 0x6a, 0x74, 0xc9, 0x6f, 0x90, 0x1d, 0x39, 0x34, 0x3b, 0xeb, 0x84, 0x5d, 
+  0xdf, 0xdd, 0x7d, 0x0c, 0xb6, 0x2d, 0xa2, 0xfd, 0xcb, 0x8c, 0xe3, 0xa8, 0x26, 0x99, 0x24, 0x95, 
+  0x11, 0x6d, 0x0f, 0xe9, 0xeb, 0xf4, 0x2f, 0x2d, 0x5d, 0x34, 0xfe, 0x68, 0x73, 0xd6, 0x15, 0x2b, 
+  0x53, 0x30, 0x2a, 0x93, 0x20, 0x70, 0x7e, 0x57, 0x80, 0xba, 0xe6, 0xea, 0x13, 0x4e, 0xf8, 0x69, 
+  0x25, 0x49, 0x86, 0x26, 0x79, 0x20, 0x07, 0xad, 0x58, 0xf7, 0x23, 0xf1, 0x9e, 0xae, 0x06, 0xc2, 
+  0x17, 0x47, 0x9a, 0xfd, 0x3e, 0x3c, 0xe0, 0x68, 0xd7, 0x99, 0xf7, 0x2e, 0x1e, 0x96, 0x21, 0x0f, 
+  0x28, 0x96, 0xcc, 0xa3, 0xb1, 0x67, 0x44, 0x3e, 0x7b, 0xfd, 0x2a, 0xc4, 0x01, 0x53, 0xd9, 0x40, 
+  0xbb, 0x25, 0x35, 0x20, 0x6d, 0x1a, 0x50, 0x1e, 0xa4, 0xe3, 0x12, 0xab, 0x5a, 0x2b, 0xa4, 0x1d, 
+  0x14, 0x2d, 0x55, 0xa0, 0xd2, 0xa4, 0x70, 0x47, 0xd1, 0xbe, 0xc3, 0x19, 0x0c, 0xb0, 0xa3, 0xc2, 
+  0xbb, 0xf6, 0xb4, 0xa7, 0x1b, 0x32, 0xa7, 0x65, 0x75, 0xf2, 0x2d, 0xd6, 0x62, 0xcb, 0x20, 0x6e, 
+  0x93, 0x37, 0x90, 0x3c, 0x3f, 0xce, 0x8c, 0xc9, 0x35, 0x73, 0x03, 0xef, 0xa1, 0x1c, 0x81, 0x37, 
+  0x47, 0xcd, 0x9e, 0x3d, 0x90, 0x9d, 0xf1, 0x28, 0xdd, 0x3f, 0xb0, 0xef, 0xc9, 0x1a, 0xf9, 0xb6, 
+  0xe7, 0x66, 0x75, 0x6d, 0x07, 0xbd, 0xd6, 0xdc, 0x67, 0xfa, 0x16, 0x3d, 0x46, 0x63, 0xc3, 0xae, 
+  0x44, 0xb8, 0xfa, 0xd4, 0x31, 0x89, 0xd7, 0x4c, 0x36, 0x3f, 0xd6, 0x8b, 0x03, 0xab, 0x8b, 0x45, 
+  0x54, 0xd0, 0x04, 0x7e, 0x97, 0xcf, 0x96, 0x24, 0xf5, 0x8f, 0x33, 0x1d, 0xd5, 0xa2, 0xd3, 0x92, 
+  0xb0, 0x68, 0x5c, 0xb7, 0x3f, 0xe6, 0xfa, 0xe0, 0xbf, 0x27, 0x6d, 0x22, 0x22, 0x8d, 0x15, 0x0c, 
+  0x32, 0xa2, 0xb8, 0x81, 0x0e, 0x86, 0x94, 0x3e, 0x9f, 0xc5, 0xf7, 0x40, 0xf0, 0x8a, 0xeb, 0xea, 
+  0x9c, 0x31, 0xaa, 0x61, 0x0e, 0xbc, 0x9c, 0xc8, 0x1f, 0x8e, 0x5f, 0xaa, 0x4b, 0x05, 0x3d, 0xd7, 
+  0x80, 0x04, 0xec, 0xfe, 0x7b, 0xfa, 0x7e, 0xf5, 0xfe, 0x73, 0xba, 0x77, 0x3c, 0xba, 0x33, 0xbf, 
+  0x1e, 0xec, 0x9e, 0x22, 0x29, 0x7c, 0x13, 0xae, 0xb6, 0x18, 0xec, 0x84, 0x44, 0xcd, 0x0b, 0x87, 
+  0x46, 0xbc, 0xfa, 0xde, 0x74, 0x20, 0x6f, 0x58, 0xeb, 0x99, 0xd8, 0x5a, 0x80, 0x63, 0xa0, 0x2f, 
+  0xb0, 0x7e, 0x1f, 0xfe, 0x3c, 0xef, 0x19, 0x18, 0xd6, 0xa6, 0x3c, 0x64, 0xf6, 0x85, 0xfd, 0x16, 
+  0x65, 0x92, 0x86, 0x6e, 0x1f, 0xcb, 0xa6, 0x4b, 0x7a, 0x56, 0x4a, 0xc3, 0xd4, 0xf8, 0x19, 0xcc, 
+  0x19, 0xff, 0x6b, 0xd7, 0xc0, 0x6d, 0x7b, 0xe3, 0xe2, 0x2c, 0xd0, 0xb7, 0x5f, 0xe2, 0xac, 0x5e, 
+  0x73, 0xb4, 0x23, 0xc3, 0xf0, 0xcd, 0xfc, 0x2d, 0x49, 0xfc, 0xfd, 0xbf, 0x3d, 0xdc, 0x5a, 0x10, 
+  0xeb, 0x97, 0x8c, 0x37, 0xf1, 0xef, 0xd5, 0x1d, 0xbf, 0x9f, 0x8e, 0xd3, 0xa7, 0xcf, 0xfd, 0x71, 
+  0xd6, 0x1f, 0xac, 0x99, 0x46, 0x3f, 0x23, 0xad, 0x35, 0x6b, 0x7b, 0x6c, 0x5b, 0x2e, 0xc7, 0x4d, 
+  0x78, 0xd4, 0x57, 0xc1, 0x70, 0x88, 0x1a, 0x7e, 0x9d, 0x09, 0x32, 0x4b, 0xf4, 0x71, 0x46, 0x05, 
+  0x9f, 0xf4, 0x3d, 0x88, 0x39, 0x84, 0x6a, 0x91, 0x37, 0xad, 0x9f, 0x6e, 0x56, 0xe4, 0x26, 0xfc, 
+  0xd7, 0x96, 0x56, 0x96, 0x05, 0x47, 0x6b, 0x4c, 0xfa, 0x33, 0x04, 0xb2, 0x7e, 0xd2, 0x47, 0x0b, 
+  0xcb, 0x90, 0x03, 0x7a, 0x4d, 0x35, 0x50, 0xcc, 0xd5, 0x4f, 0x15, 0xa1, 0x1a, 0x67, 0x0c, 0x1a, 
+  0xa2, 0xcc, 0x2b, 0x4e, 0x0e, 0x4b, 0x5b, 0x8d, 0xd3, 0x03, 0x7d, 0xcb, 0x33, 0x1b, 0x3c, 0x57, 
+  0x35, 0xc8, 0x7b, 0xec, 0xa7, 0x85, 0x35, 0x03, 0x36, 0xf4, 0x78, 0xbf, 0x77, 0x70, 0x5b, 0xe6, 
+  0x1e, 0xf4, 0xed, 0xbf, 0xd4, 0xc2, 0x4d, 0xba, 0xd8, 0xc2, 0xdd, 0xda, 0xfa, 0x2d, 0x4f, 0x5f, 
+  0x7a, 0xe7, 0x10, 0x56, 0xd4, 0x8f, 0x2d, 0xd6, 0x5e, 0x5b, 0x70, 0xf8, 0x17, 0xd0, 0x62, 0x39, 
+  0x4e, 0x16, 0x59, 0x9f, 0x08, 0xda, 0x6c, 0x54, 0xea, 0xa8, 0x47, 0x83, 0xbe, 0xbb, 0x03, 0xc7, 
+  0xf3, 0x21, 0xe4, 0xd1, 0x02, 0xb1, 0x1d, 0x5a, 0xb2, 0x36, 0xae, 0xa9, 0xba, 0x83, 0xdb, 0xc9, 
+  0xb3, 0xae, 0x89, 0x62, 0x00, 0x12, 0x7d, 0x3a, 0x3f, 0xe3, 0x22, 0x2a, 0x08, 0x5b, 0x1a, 0xec, 
+  0x3d, 0x45, 0xfe, 0x15, 0x69, 0x5c, 0x8b, 0x32, 0x5b, 0x15, 0x8f, 0xe0, 0xed, 0xb8, 0x42, 0x88, 
+  0xef, 0xa0, 0x5d, 0xe1, 0xa0, 0xac, 0x06, 0x56, 0x25, 0x0a, 0x02, 0xad, 0x1d, 0x76, 0x2b, 0xc9, 
+  0x3a, 0x0c, 0x13, 0x54, 0x26, 0x8c, 0x34, 0x9d, 0x8d, 0x9d, 0x87, 0x93, 0x02, 0x97, 0x73, 0x68, 
+  0x6a, 0xf4, 0xf7, 0xe8, 0x63, 0x6a, 0x53, 0x16, 0x50, 0xbf, 0x46, 0x8b, 0xcc, 0x2d, 0xb8, 0x09, 
+  0x24, 0x79, 0xbc, 0xfb, 0x7e, 0x8c, 0x13, 0x3a, 0xdc, 0x57, 0xc2, 0xdd, 0x21, 0x89, 0x5b, 0x0c, 
+  0x4b, 0xcc, 0xa6, 0xc9, 0x4d, 0xf8, 0xb2, 0x57, 0x8e, 0xa2, 0x3e, 0xb4, 0x16, 0x1c, 0xa7, 0x17, 
+  0x14, 0x66, 0xe0, 0xe0, 0x72, 0xbd, 0xaa, 0x07, 0xb3, 0x6c, 0x90, 0x0e, 0x9e, 0xbf, 0x39, 0x1c, 
+  0xa0, 0xec, 0xe0, 0x9a, 0xb4, 0x29, 0x8e, 0xb3, 0xa4, 0x41, 0x35, 0x50, 0xee, 0x17, 0xbb, 0x0b, 
+  0x0a, 0xf9, 0x90, 0x43, 0xcd, 0xac, 0x38, 0x64, 0x90, 0x8f, 0xe8, 0x09, 0x63, 0x33, 0x0e, 0x33, 
+  0x05, 0xbe, 0x22, 0xaa, 0xb1, 0x37, 0x6c, 0xf3, 0xa5, 0xe1, 0x8a, 0xc6, 0x82, 0x1f, 0x26, 0x70, 
+  0x23, 0x48, 0x28, 0xb2, 0x61, 0xba, 0x1b, 0x26, 0xb6, 0xc1, 0xa5, 0x7f, 0x74, 0x0c, 0x0f, 0x69, 
+  0x84, 0x04, 0xfd, 0x4a, 0x97, 0xd1, 0x58, 0xf9, 0xd3, 0xbb, 0x9a, 0xd9, 0xd0, 0x0a, 0xde, 0xcd, 
+  0x57, 0x57, 0x98, 0xd3, 0x3d, 0x23, 0xe4, 0xe8, 0x2c, 0xe3, 0x51, 0xb1, 0xcc, 0xb3, 0xc5, 0x40, 
+  0x77, 0x54, 0x7b, 0xb8, 0x38, 0xf7, 0x7b, 0x30, 0xd9, 0x25, 0xce, 0x93, 0xfd, 0x94, 0x6d, 0x8d, 
+  0x1e, 0x94, 0x60, 0x65, 0x5c, 0x00, 0x92, 0x78, 0x91, 0xd7, 0x72, 0xb9, 0x0e, 0x87, 0x7b, 0xf8, 
+  0xdf, 0x87, 0x70, 0xcf, 0xfc, 0xff, 0x70, 0xbf, 0xf9, 0xdf, 0x1e, 0x98, 0x4b, 0x5a, 0xcd, 0x84, 
+  0x13, 0x4c, 0xe7, 0x50, 0xb3, 0xe0, 0xcd, 0x7d, 0x1c, 0xa8, 0xbf, 0x3a, 0x84, 0xc4, 0x9e, 0x07, 
+  0x2c, 0xc8, 0x66, 0xff, 0xc1, 0x2c, 0x50, 0xdf, 0x1b, 0x9f, 0x5e, 0x83, 0x5b, 0x8f, 0xad, 0x4a, 
+  0x7c, 0x1e, 0xe2, 0xb5, 0x6a, 0xc6, 0x21, 0xfc, 0x6a, 0xda, 0x41, 0x87, 0x85, 0x7d, 0xde, 0xbf, 
+  0xe4, 0xbe, 0x62, 0x36, 0x38, 0xec, 0xd7, 0x24, 0x45, 0xcd, 0xee, 0x2b, 0x13, 0x5d, 0x49, 0xa9, 
+  0x93, 0x59, 0xff, 0x6a, 0xc2, 0x51, 0x2d, 0x7d, 0x21, 0x8b, 0x11, 0x93, 0xb3, 0x60, 0xb2, 0x04, 
+  0x70, 0x01, 0x5b, 0xc7, 0xd3, 0x62, 0xe2, 0xd1, 0x64, 0xf2, 0x00, 0x51, 0x06, 0x99, 0xce, 0x3b, 
+  0x0e, 0xc5, 0x5a, 0x95, 0xf5, 0x5b, 0xab, 0xf4, 0x9c, 0x6e, 0x6a, 0xe0, 0xe0, 0xa6, 0xa0, 0x1b, 
+  0x01, 0xae, 0x8a, 0xf0, 0xe6, 0x83, 0xf8, 0xd3, 0x5f, 0xd3, 0xe5, 0x24, 0xf7, 0xad, 0xb3, 0xa1, 
+  0xa7, 0x4e, 0x7b, 0xfc, 0x0a, 0x71, 0x0e, 0xaa, 0x8e, 0x86, 0xa4, 0x8c, 0x4f, 0x52, 0xaf, 0xcd, 
+  0x66, 0x5b, 0x15, 0xe9, 0x39, 0x32, 0x08, 0x95, 0xf1, 0x9c, 0xbe, 0x38, 0xc4, 0xb3, 0x73, 0x76, 
+  0x13, 0x78, 0x6a, 0x32, 0x32, 0xe5, 0xa4, 0xa5, 0xad, 0xc0, 0x53, 0x34, 0xac, 0xee, 0xee, 0xbe, 
+  0x06, 0x7e, 0x50, 0x03, 0x01, 0x86, 0x42, 0x96, 0x18, 0x47, 0xf2, 0xdb, 0x44, 0x99, 0x87, 0xb3, 
+  0x70, 0xda, 0xde, 0xb0, 0x65, 0x14, 0x23, 0x36, 0x52, 0xe4, 0xdf, 0xe0, 0x18, 0xb6, 0x73, 0x46, 
+  0xb8, 0x29, 0xb8, 0xef, 0x7e, 0x9b, 0x73, 0x76, 0xdf, 0xa7, 0x3e, 0xb9, 0x87, 0xa1, 0x33, 0x93, 
+  0x3a, 0x5c, 0x1f, 0x24, 0xff, 0x1d, 0x60, 0x63, 0xcd, 0x24, 0x0e, 0xd6, 0x48, 0x82, 0x2b, 0xbf, 
+  0x63, 0x53, 0x3a, 0xe0, 0x85, 0x64, 0xc0, 0x77, 0x3e, 0xa2, 0x15, 0x94, 0xeb, 0x18, 0x79, 0x8f, 
+  0x76, 0xbf, 0xf7, 0x04, 0x1f, 0xd1, 0x4a, 0xd1, 0x0b, 0x7f, 0x73, 0x07, 0xd9, 0x77, 0x07, 0xd8, 
+  0x52, 0x48, 0xde, 0xda, 0x77, 0xa5, 0xa4, 0xd8, 0x96, 0x5e, 0x02, 0x71, 0xc6, 0x5b, 0x71, 0x88, 
+  0x7f, 0x96, 0xe5, 0x65, 0x62, 0x1f, 0xd0, 0xfb, 0xbc, 0x73, 0x6b, 0x06, 0xae, 0x84, 0xcd, 0xc6, 
+  0x8e, 0x92, 0x1c, 0xac, 0x31, 0x76, 0x8e, 0x12, 0x64, 0x53, 0xd8, 0xc7, 0xc0, 0x12, 0xef, 0xb8, 
+  0x85, 0xb3, 0xc6, 0xd8, 0x5f, 0x37, 0x5f, 0xb6, 0x65, 0x2f, 0x20, 0x29, 0xeb, 0x80, 0x44, 0x2f, 
+  0xcb, 0xec, 0x50, 0xd9, 0xf6, 0x80, 0xdf, 0xbe, 0x64, 0x29, 0xe9, 0x51, 0x25, 0x7b, 0x0d, 0x22, 
+  0xb3, 0xde, 0x79, 0x5a, 0x4d, 0xc4, 0x9a, 0x0a, 0xbf, 0x0e, 0x4d, 0xc1, 0xcf, 0x8b, 0xf8, 0x6f, 
+  0xc0, 0xf9, 0x08, 0x6f, 0x16, 0xf1, 0x7f, 0xf3, 0x8f, 0x67, 0xf1, 0x3a, 0xcc, 0xe7, 0x5b, 0x15, 
+  0x4f, 0xa5, 0x08, 0x6f, 0xb3, 0x0b, 0x6a, 0x16, 0x5e, 0xe5, 0xdf, 0xbd, 0xbf, 0xb4, 0x86, 0x5d, 
+  0x46, 0x1a, 0x3b, 0x2c, 0xbf, 0x9d, 0xa9, 0x37, 0xe9, 0x13, 0x0c, 0x65, 0xec, 0x41, 0x26, 0xef, 
+  0x4d, 0x95, 0x35, 0xf4, 0x82, 0x80, 0xa9, 0xdd, 0xb0, 0x6e, 0x0c, 0x4a, 0xf5, 0xc6, 0x9f, 0xb0, 
+  0x77, 0x90, 0x94, 0xe3, 0x72, 0x67, 0x27, 0xa8, 0x44, 0xe9, 0x43, 0x6a, 0x97, 0x28, 0x42, 0x38, 
+  0x1a, 0x37, 0x1a, 0xf1, 0xc5, 0xa2, 0xe7, 0x01, 0x7d, 0x64, 0x97, 0xca, 0x3e, 0x30, 0x9f, 0x71, 
+  0x50, 0xf9, 0xdb, 0x87, 0x0f, 0xdf, 0x8a, 0x13, 0x79, 0xa2, 0xfe, 0x32, 0xf3, 0x55, 0x76, 0x3d, 
+  0xd0, 0x2e, 0x64, 0xdf, 0x53, 0x0f, 0x01, 0xb4, 0xb5, 0x1f, 0x28, 0x0c, 0xba, 0xbf, 0x77, 0x0d, 
+  0x79, 0xd8, 0xdf, 0xdf, 0xd2, 0x46, 0xf8, 0x36, 0x92, 0xa7, 0xe6, 0x27, 0x37, 0xee, 0x02, 0xff, 
+  0x2c, 0x2d, 0x90, 0x2f, 0x81, 0x98, 0xe9, 0x01, 0x3b, 0xaf, 0x4d, 0x39, 0x52, 0x95, 0x06, 0xef, 
+  0xca, 0xcb, 0x6c, 0x30, 0x93, 0x3d, 0x60, 0x35, 0xc0, 0x67, 0x88, 0x42, 0xd8, 0x66, 0x0f, 0x06, 
+  0xdf, 0x06, 0xb4, 0x27, 0xd8, 0x3b, 0x42, 0x8e, 0x89, 0x89, 0xcd, 0x77, 0x79, 0x13, 0x0e, 0x68, 
+  0x02, 0x0f, 0x6e, 0xca, 0x35, 0x89, 0x07, 0xc5, 0x00, 0xb6, 0xec, 0x39, 0xea, 0x81, 0xdc, 0x3a, 
+  0x98, 0xdd, 0x0c, 0x24, 0x54, 0x89, 0x44, 0x09, 0x95, 0xdb, 0x51, 0xc1, 0x55, 0x92, 0x01, 0x47, 
+  0xb0, 0x2e, 0x39, 0xd1, 0xe3, 0xab, 0xe8, 0x7c, 0x15, 0x0e, 0x60, 0x1f, 0x47, 0xc4, 0x3b, 0x70, 
+  0x84, 0x05, 0xef, 0xe2, 0xac, 0xae, 0xaf, 0xe2, 0xdd, 0xdd, 0xeb, 0xeb, 0x6b, 0x4e, 0xa2, 0x88, 
+  0xca, 0xea, 0x74, 0x57, 0x97, 0x6f, 0x82, 0x8b, 0xac, 0x57, 0xf5, 0x9b, 0xc9, 0xc4, 0xe6, 0xd8, 
+  0xe5, 0x62, 0x8b, 0xd5, 0xca, 0x67, 0x42, 0x92, 0xdb, 0x4d, 0x20, 0xf0, 0x66, 0x8c, 0x82, 0x8a, 
+  0x0c, 0x29, 0xda, 0x88, 0xe7, 0xcb, 0xf5, 0x42, 0x41, 0x9e, 0x48, 0xec, 0x41, 0x74, 0x3a, 0x07, 
+  0xc1, 0x10, 0x47, 0x3c, 0x98, 0x1d, 0xc6, 0xc6, 0x6c, 0xf4, 0x90, 0x36, 0x21, 0x21, 0x7d, 0x22, 
+  0xee, 0x20, 0x92, 0x3d, 0x63, 0x2c, 0x86, 0xb2, 0x30, 0x73, 0xb9, 0x61, 0xdd, 0x91, 0x11, 0x95, 
+  0x82, 0x7c, 0xc7, 0xd8, 0x48, 0xc4, 0x75, 0x97, 0x43, 0x4f, 0x62, 0x2a, 0x9e, 0x70, 0x9d, 0xac, 
+  0x9c, 0xe2, 0xeb, 0xf1, 0x1a, 0x03, 0x70, 0xba, 0x9a, 0xae, 0x8f, 0x79, 0xa4, 0x02, 0x3d, 0x90, 
+  0x7e, 0x0a, 0xd5, 0x8c, 0xb5, 0x76, 0xb0, 0x7b, 0xad, 0x6b, 0x9f, 0xe7, 0x36, 0x36, 0x2b, 0xcb, 
+  0x92, 0x81, 0x53, 0xd4, 0xfa, 0x04, 0x61, 0x02, 0xfc, 0xe2, 0x5e, 0x01, 0xb2, 0xa4, 0x70, 0xae, 
+  0x9a, 0x9e, 0x94, 0xf4, 0x53, 0xa0, 0xf2, 0x12, 0x41, 0x6a, 0xa0, 0x89, 0x4d, 0x23, 0xf7, 0xe3, 
+  0x56, 0x26, 0x6d, 0x49, 0x96, 0x93, 0x94, 0x70, 0x4f, 0xd1, 0xa1, 0x24, 0x60, 0x2a, 0x11, 0xd2, 
+  0x2b, 0x96, 0x76, 0x67, 0xea, 0x23, 0xd5, 0xd3, 0x25, 0x80, 0x09, 0xe6, 0x8e, 0x15, 0x88, 0x76, 
+  0xa9, 0x13, 0xbf, 0xea, 0xc5, 0xd9, 0xdd, 0xf6, 0xd4, 0x71, 0xd1, 0x7a, 0x6c, 0x21, 0x8f, 0xa5, 
+  0x4d, 0x54, 0x73, 0x6d, 0xb5, 0x1e, 0x82, 0xdc, 0xfc, 0xf0, 0x23, 0x07, 0x74, 0x39, 0xe7, 0x69, 
+  0xc3, 0x2f, 0x22, 0x09, 0x72, 0xaa, 0xb3, 0x6a, 0x62, 0xfd, 0xa6, 0x4b, 0xf1, 0x5c, 0x1d, 0xfa, 
+  0x41, 0xd8, 0xaf, 0x0d, 0xcd, 0x6d, 0xd6, 0x27, 0xc5, 0x62, 0xa7, 0xea, 0x65, 0x4d, 0x68, 0xb3, 
+  0xe1, 0xec, 0x8f, 0x99, 0xef, 0xad, 0xeb, 0x7c, 0xb9, 0x82, 0x23, 0x31, 0xb5, 0x4f, 0x44, 0x29, 
+  0xcc, 0xb6, 0x2f, 0xcb, 0xea, 0x45, 0x2a, 0x28, 0x66, 0x24, 0x8c, 0xf4, 0x5c, 0xc7, 0x96, 0x2e, 
+  0x57, 0x7f, 0x9d, 0xf5, 0x5d, 0x46, 0x8a, 0x9b, 0x5c, 0x3f, 0xec, 0xa9, 0xfe, 0xef, 0x59, 0xfd, 
+  0x9c, 0x44, 0x17, 0x1a, 0xe6, 0x35, 0x13, 0x49, 0x4b, 0x33, 0xa2, 0xdf, 0x7a, 0xaa, 0x7a, 0x25, 
+  0x6e, 0x07, 0x29, 0x50, 0x76, 0xaf, 0x33, 0x07, 0x28, 0x8f, 0xda, 0x9e, 0x9b, 0xdf, 0xd2, 0xf2, 
+  0xf8, 0x64, 0xb9, 0x94, 0x02, 0x75, 0x4f, 0x43, 0x7e, 0xe6, 0x0e, 0x7a, 0x55, 0x67, 0x97, 0x52, 
+  0xe6, 0x27, 0xb7, 0x8c, 0xd8, 0x86, 0xe5, 0x92, 0xfc, 0x76, 0x2e, 0x9f, 0xf0, 0xfc, 0x7c, 0x25, 
+  0x93, 0x75, 0x81, 0x2c, 0xef, 0x1f, 0x69, 0x5d, 0x78, 0x5b, 0xea, 0xae, 0x39, 0x9d, 0x3b, 0xc5, 
+  0x69, 0x33, 0xa1, 0x7e, 0xbd, 0x94, 0x59, 0xad, 0x1a, 0xed, 0x96, 0xb8, 0xca, 0xb2, 0x8b, 0x37, 
+  0x33, 0x5a, 0xf5, 0x3e, 0x31, 0x77, 0x69, 0x28, 0x06, 0x6d, 0xb7, 0x08, 0xd5, 0xfe, 0xe3, 0x4a, 
+  0x3c, 0xc0, 0x69, 0xb4, 0x74, 0x1b, 0x24, 0x11, 0x41, 0xe6, 0xea, 0x85, 0x7b, 0xb5, 0xca, 0x4e, 
+  0xa1, 0xae, 0x89, 0xba, 0xa4, 0x08, 0x38, 0xa4, 0xe0, 0x47, 0xa7, 0x9c, 0x59, 0xc8, 0x9a, 0x9a, 
+  0xfe, 0xee, 0x36, 0xa2, 0xe2, 0x70, 0x0b, 0xbe, 0xd2, 0xea, 0x12, 0x21, 0x6f, 0x7c, 0x5e, 0x5e, 
+  0x62, 0xfc, 0x3d, 0x5b, 0x09, 0xf7, 0xa0, 0x94, 0x3c, 0x71, 0xeb, 0x70, 0x74, 0x37, 0x2e, 0xf0, 
+  0xd2, 0xed, 0x7c, 0x81, 0x95, 0x68, 0x77, 0x87, 0xdb, 0x61, 0xb2, 0x12, 0x3a, 0xa3, 0xf5, 0xb9, 
+  0xfb, 0x95, 0x17, 0x8b, 0x37, 0x55, 0xfb, 0x2b, 0x57, 0xee, 0x83, 0x30, 0x91, 0xe8, 0xeb, 0xaa, 
+  0x8c, 0x69, 0x29, 0x32, 0x33, 0x8d, 0xe5, 0x56, 0x98, 0x67, 0xeb, 0xad, 0xd0, 0x72, 0x8c, 0x41, 
+  0xd1, 0x25, 0xa9, 0x77, 0xcb, 0x95, 0xa4, 0x0b, 0xbc, 0xc1, 0x88, 0x24, 0x8a, 0x59, 0x71, 0x5b, 
+  0xc6, 0x43, 0x9f, 0x2d, 0x45, 0xd9, 0x61, 0x6c, 0x23, 0x8c, 0x92, 0xb2, 0xdb, 0xbe, 0x3a, 0xce, 
+  0xac, 0x6a, 0x07, 0xb9, 0xed, 0x07, 0x3d, 0x01, 0x38, 0xe2, 0x4b, 0xad, 0x74, 0x2e, 0x96, 0x45, 
+  0xd3, 0xe3, 0xb8, 0x6d, 0x9a, 0x47, 0x86, 0x4d, 0x3b, 0x74, 0x94, 0x22, 0xcd, 0x8d, 0x04, 0x62, 
+  0x42, 0x5f, 0x40, 0x41, 0xe5, 0xd8, 0xcf, 0x49, 0x50, 0x61, 0x4e, 0x0f, 0x98, 0x4d, 0x20, 0x3c, 
+  0x30, 0xe8, 0x3a, 0xc9, 0x09, 0x29, 0x44, 0x40, 0x96, 0x1a, 0x8c, 0xab, 0xf0, 0x7c, 0x2c, 0xe5, 
+  0x13, 0xef, 0xa2, 0xf4, 0x46, 0xf9, 0x68, 0x14, 0xa2, 0x50, 0x72, 0x6b, 0x2c, 0xbb, 0x38, 0xdc, 
+  0x88, 0xd1, 0x63, 0x0f, 0xd6, 0x8d, 0x0f, 0x1f, 0x2e, 0xca, 0x0f, 0x1f, 0xbc, 0x11, 0xf3, 0x80, 
+  0x20, 0x7e, 0x8d, 0x41, 0xf0, 0xb1, 0x42, 0x72, 0x02, 0xff, 0xed, 0xc6, 0xb8, 0x65, 0x3b, 0x24, 
+  0x6e, 0xd2, 0x3a, 0x34, 0x75, 0xd8, 0x74, 0x52, 0xc1, 0x66, 0xdd, 0xf3, 0xb8, 0x60, 0xc2, 0xe9, 
+  0xbe, 0xb4, 0x23, 0x2e, 0xf1, 0xf0, 0xa1, 0xba, 0x2f, 0x11, 0xe5, 0x87, 0x8f, 0xf6, 0x02, 0x8e, 
+  0xe2, 0x80, 0xce, 0x89, 0x00, 0xa7, 0x3e, 0x28, 0x5a, 0x74, 0x85, 0x32, 0x2d, 0xd2, 0x5b, 0xd3, 
+  0x8d, 0x0a, 0x1b, 0x33, 0x15, 0x4c, 0xdb, 0x52, 0x91, 0x15, 0x51, 0x15, 0x3f, 0xf6, 0x04, 0xfd, 
+  0xe7, 0x00, 0xbe, 0x94, 0x00, 0x17, 0x33, 0x8c, 0x17, 0xe5, 0x25, 0xf0, 0x39, 0xd5, 0x6a, 0x15, 
+  0xf4, 0x5c, 0x12, 0xb0, 0x3e, 0x55, 0x40, 0x0e, 0x94, 0xf1, 0xe7, 0xaf, 0x7d, 0x3f, 0xb9, 0x4f, 
+  0x80, 0x95, 0x4a, 0xb7, 0xa3, 0x1e, 0x3e, 0x94, 0xb0, 0xcb, 0xe9, 0xb1, 0xaa, 0x5d, 0x28, 0xbe, 
+  0x4b, 0x06, 0x9c, 0x2b, 0x9c, 0x68, 0x0d, 0x45, 0x32, 0xa8, 0xba, 0x2d, 0x68, 0x34, 0x85, 0xda, 
+  0x8c, 0x42, 0x68, 0x0c, 0xa4, 0x26, 0x34, 0xce, 0x1a, 0x68, 0x0b, 0xf4, 0xbd, 0x7d, 0xb1, 0x28, 
+  0x5b, 0xed, 0xf7, 0x33, 0x6d, 0xbe, 0xc2, 0x61, 0xf1, 0x82, 0x16, 0xe9, 0xaa, 0x48, 0x97, 0x78, 
+  0x5b, 0x5c, 0x02, 0xb4, 0xb1, 0xd6, 0xba, 0x8e, 0x15, 0x11, 0xac, 0xe3, 0x59, 0xcb, 0x60, 0x4c, 
+  0xc6, 0x39, 0x4b, 0xff, 0x0c, 0xbf, 0x6d, 0x25, 0x0e, 0xa0, 0xd1, 0x1b, 0x71, 0x4f, 0xc9, 0xa3, 
+  0x7f, 0x94, 0x21, 0xb5, 0x0f, 0x14, 0xa5, 0x6f, 0xf1, 0xcf, 0x77, 0x1c, 0xac, 0xb0, 0x52, 0xa7, 
+  0xf8, 0x48, 0x0f, 0xb7, 0x8f, 0xe9, 0x7d, 0xde, 0xf8, 0xc6, 0x66, 0xd8, 0x16, 0x90, 0x25, 0x53, 
+  0xd7, 0x32, 0x81, 0x99, 0x7b, 0xa8, 0xe7, 0x65, 0x90, 0x19, 0xb2, 0x81, 0xb0, 0x9e, 0xdf, 0x3b, 
+  0xa4, 0x0b, 0x86, 0x42, 0xc3, 0xf6, 0xc6, 0x4c, 0x2e, 0xe1, 0x5e, 0x62, 0x14, 0x0b, 0xce, 0x9a, 
+  0xb4, 0xbe, 0xd7, 0x39, 0xeb, 0xfc, 0x69, 0x5b, 0xd7, 0x4c, 0xed, 0x8e, 0x44, 0x02, 0x66, 0xb7, 
+  0x77, 0xf5, 0xd0, 0x56, 0x01, 0x37, 0x75, 0xca, 0xf8, 0x7b, 0xfd, 0x1a, 0xd4, 0x63, 0x2f, 0x68, 
+  0xc7, 0x0f, 0x74, 0x3c, 0x73, 0xb9, 0xf2, 0xc6, 0x59, 0xee, 0x5f, 0xe3, 0xf6, 0x8a, 0xdd, 0x08, 
+  0x9e, 0x19, 0x7f, 0xec, 0xcc, 0x81, 0x8a, 0xca, 0xb6, 0x09, 0x42, 0x99, 0x9a, 0x96, 0xce, 0x60, 
+  0x71, 0x2a, 0x3c, 0x84, 0x34, 0xdd, 0x31, 0xdd, 0x1d, 0xca, 0x10, 0x13, 0x68, 0x5e, 0xeb, 0x00, 
+  0xf9, 0xb6, 0x81, 0x9a, 0x8b, 0xa9, 0x48, 0x97, 0xf4, 0x23, 0xb4, 0xbd, 0x74, 0xea, 0x6c, 0x73, 
+  0x42, 0x26, 0x27, 0x57, 0x81, 0x43, 0x0e, 0xee, 0xd2, 0x9b, 0x52, 0x53, 0xca, 0x73, 0x2a, 0x69, 
+  0xcf, 0x68, 0x9c, 0x23, 0x29, 0x8a, 0x04, 0x82, 0x54, 0x49, 0x38, 0x7f, 0xbf, 0xaf, 0x08, 0xb6, 
+  0x42, 0xf9, 0x9d, 0x3d, 0x33, 0x38, 0x07, 0xda, 0xf2, 0x7b, 0xef, 0x8d, 0xd2, 0x84, 0x2d, 0xf7, 
+  0xd6, 0x73, 0x04, 0xbe, 0x4c, 0xf7, 0x42, 0x0f, 0x1c, 0xda, 0xa0, 0x6e, 0xbc, 0xad, 0x91, 0xcf, 
+  0x1c, 0x2f, 0x93, 0xe9, 0x7e, 0xe8, 0x1d, 0x30, 0x0b, 0xfb, 0xf7, 0x74, 0xed, 0x60, 0x57, 0xfd, 
+  0x3c, 0x0e, 0x6b, 0x08, 0xbd, 0xf1, 0x32, 0xac, 0x4f, 0xca, 0xb2, 0xc6, 0xdf, 0x2a, 0x9e, 0x7e, 
+  0x65, 0xca, 0x1e, 0xf0, 0x65, 0x75, 0x0b, 0xff, 0xb4, 0x6f, 0x25, 0x5d, 0x2a, 0x99, 0x7e, 0xdd, 
+  0x2e, 0x7c, 0x50, 0x57, 0xea, 0x86, 0xea, 0xfb, 0xbe, 0xbb, 0xce, 0xe2, 0x93, 0x50, 0x51, 0xc4, 
+  0x5e, 0x49, 0xbb, 0x54, 0x36, 0xc1, 0xe5, 0x7a, 0x59, 0xe7, 0x57, 0xcb, 0x2c, 0x79, 0xa4, 0x7f, 
+  0x3d, 0x92, 0x8a, 0xe4, 0x3a, 0x6e, 0xd6, 0xfc, 0xa8, 0xf1, 0xd5, 0x26, 0x3c, 0xe3, 0x2f, 0xf9, 
+  0xec, 0x20, 0xf9, 0x56, 0x84, 0x9f, 0xb4, 0x2f, 0x32, 0x1d, 0x4b, 0xd4, 0x21, 0xcf, 0x9a, 0xc3, 
+  0x26, 0x47, 0x38, 0x28, 0x92, 0x43, 0x3b, 0x63, 0x98, 0xa9, 0xeb, 0xa6, 0xc7, 0x06, 0x75, 0xd2, 
+  0xc7, 0x75, 0x1e, 0x10, 0x92, 0xbf, 0xcd, 0x1c, 0xdf, 0x9c, 0xdb, 0xe7, 0x7a, 0x95, 0xc7, 0x95, 
+  0x33, 0xca, 0xf7, 0xf7, 0x19, 0x72, 0xc6, 0x1a, 0xea, 0x7a, 0x42, 0x0a, 0x99, 0xb8, 0xed, 0x23, 
+  0x73, 0x6e, 0xac, 0xb6, 0x4d, 0x8f, 0x4a, 0x41, 0xc4, 0xde, 0x22, 0x1b, 0x3b, 0x60, 0x73, 0xde, 
+  0x47, 0x58, 0x39, 0x8a, 0x16, 0x77, 0x61, 0xe1, 0x52, 0x1b, 0x7e, 0x18, 0x2b, 0x08, 0xd1, 0xc6, 
+  0xa4, 0xe0, 0x9a, 0xd6, 0xd9, 0x93, 0xdd, 0x17, 0x69, 0xa0, 0x5c, 0xdd, 0x7e, 0x9e, 0x30, 0xfd, 
+  0xa2, 0x98, 0x3d, 0x77, 0xff, 0x7d, 0xe0, 0x4f, 0xd3, 0x9d, 0x3f, 0x8f, 0x47, 0xc1, 0x74, 0xf0, 
+  0xfd, 0xf1, 0x2e, 0xba, 0x63, 0x31, 0x2d, 0xa7, 0xfb, 0x0c, 0x9d, 0x19, 0x88, 0x7b, 0xdd, 0xcb, 
+  0x4f, 0x8b, 0xb2, 0xca, 0x16, 0x92, 0x99, 0x3d, 0x42, 0x12, 0xfc, 0x28, 0xa3, 0x3f, 0x5f, 0x1d, 
+  0x8f, 0xe8, 0x0b, 0xf2, 0xc9, 0xbe, 0xd8, 0xf2, 0x4a, 0x02, 0xc0, 0xde, 0x9d, 0xe5, 0x9f, 0x26, 
+  0xa9, 0x9b, 0x77, 0xdf, 0x5c, 0xf1, 0x73, 0x80, 0x39, 0x9e, 0x21, 0xfc, 0xc5, 0x2e, 0x41, 0x33, 
+  0x25, 0xb5, 0xe2, 0xc7, 0xf2, 0x90, 0x4a, 0xa4, 0xdb, 0xba, 0x32, 0xa5, 0x45, 0xae, 0x04, 0xb7, 
+  0x6d, 0x9a, 0xa4, 0x8c, 0x5f, 0x29, 0x7b, 0x8e, 0x36, 0x46, 0x59, 0xe7, 0x1c, 0x94, 0xb3, 0xc6, 
+  0xa6, 0x86, 0x72, 0x2f, 0xda, 0x31, 0xa8, 0x4e, 0x7c, 0x83, 0xb2, 0xbe, 0xfa, 0x8d, 0xea, 0x1d, 
+  0x48, 0x6c, 0xf4, 0x79, 0x60, 0xe5, 0x46, 0x0c, 0xed, 0xdc, 0x88, 0x9a, 0x9d, 0x1e, 0xda, 0x2d, 
+  0x17, 0x84, 0x87, 0x01, 0x5b, 0xca, 0x39, 0xd1, 0xbd, 0x1b, 0x9e, 0x23, 0xc3, 0x9c, 0x97, 0x72, 
+  0x17, 0xaf, 0x8f, 0xc9, 0xc3, 0x2b, 0x13, 0xfd, 0xc0, 0x76, 0x41, 0x37, 0x98, 0xa2, 0x40, 0xc4, 
+  0xd0, 0xa6, 0xa3, 0x9f, 0xfc, 0x40, 0x0f, 0x7a, 0x59, 0xa5, 0xa7, 0x97, 0x46, 0xd8, 0x2e, 0x3a, 
+  0xf2, 0xf8, 0x0f, 0x9c, 0xa3, 0x2f, 0xaf, 0x8f, 0x6b, 0x3f, 0x25, 0xfe, 0x27, 0x44, 0x51, 0xde, 
+  0xde, 0xcc, 0xda, 0x3b, 0x53, 0x9f, 0xff, 0xc4, 0xdd, 0x4b, 0xff, 0xd0, 0x26, 0xa1, 0x62, 0x79, 
+  0x33, 0x00, 0x90, 0x98, 0xb5, 0x99, 0xc2, 0xf8, 0x73, 0x41, 0x83, 0x8e, 0xbe, 0x5a, 0xfe, 0xa7, 
+  0x80, 0x32, 0xc8, 0x6f, 0x1a, 0xb1, 0xca, 0x88, 0x5d, 0x27, 0xfe, 0x37, 0x5f, 0x7d, 0xf7, 0xcd, 
+  0x77, 0x7f, 0xfb, 0xef, 0xaf, 0xbe, 0xfb, 0xdb, 0x63, 0x7f, 0x7f, 0xc4, 0xf9, 0x5a, 0x15, 0x40, 
+  0x5f, 0x2e, 0xa9, 0xff, 0xee, 0xf6, 0x82, 0xa6, 0x3b, 0xf7, 0xff, 0x16, 0x58, 0xbe, 0xf8, 0xfd, 
+  0x60, 0xf4, 0x3f, 0xbf, 0x55, 0x8b, 0x57, 0x9f, 0x20, 0x4a, 0x66, 0xa1, 0x89, 0x54, 0x24, 0x29, 
+  0x17, 0x2d, 0x8c, 0x85, 0x18, 0x4d, 0x05, 0x25, 0x6e, 0xc2, 0xa7, 0xfd, 0x12, 0xc0, 0x27, 0x5a, 
+  0x4c, 0xc4, 0x23, 0x86, 0x21, 0xe1, 0x8a, 0x18, 0xe5, 0x7a, 0xb9, 0x80, 0x2d, 0x8d, 0xad, 0x70, 
+  0x69, 0x71, 0xc3, 0x84, 0x1a, 0x03, 0xc0, 0xc4, 0x0d, 0x5e, 0x3d, 0x17, 0x3e, 0xf8, 0x68, 0xf0, 
+  0x36, 0xab, 0xce, 0xd2, 0xab, 0xd5, 0x20, 0xaf, 0x1f, 0x51, 0xbf, 0x2d, 0x39, 0x31, 0x85, 0xe4, 
+  0x91, 0xac, 0x18, 0xac, 0x0b, 0xd5, 0x53, 0x8b, 0x48, 0xe3, 0x4f, 0xb9, 0x9a, 0x8a, 0xa4, 0x16, 
+  0x71, 0x78, 0x19, 0x49, 0x2b, 0x1b, 0x7a, 0x0c, 0xed, 0x1d, 0x37, 0xb7, 0x4a, 0xd0, 0x45, 0xcb, 
+  0x68, 0xd3, 0x7c, 0xd6, 0xdf, 0x6e, 0x5a, 0x19, 0x87, 0x96, 0x43, 0x5a, 0x5b, 0x15, 0x6b, 0x8c, 
+  0xea, 0x6f, 0xed, 0x28, 0x96, 0x40, 0x66, 0x00, 0x13, 0x98, 0xff, 0x14, 0x5d, 0xd1, 0x0c, 0xe0, 
+  0x4b, 0x6c, 0x56, 0x08, 0x9a, 0xe8, 0xb5, 0xdb, 0x7f, 0xce, 0xe3, 0x3a, 0x3c, 0x5b, 0x20, 0x6e, 
+  0xdc, 0xac, 0xb9, 0xfb, 0x4e, 0x45, 0x6e, 0xf4, 0xa1, 0x0d, 0x3c, 0x02, 0x44, 0x94, 0x26, 0x40, 
+  0xae, 0x94, 0xa1, 0xee, 0x83, 0x86, 0x1b, 0xf6, 0x3d, 0x4e, 0x29, 0x1b, 0xbb, 0x77, 0x17, 0xed, 
+  0x78, 0x3a, 0x15, 0xdd, 0x84, 0x29, 0x11, 0xfd, 0x73, 0x4e, 0x6b, 0x21, 0xe4, 0xff, 0x5a, 0x84, 
+  0x2f, 0x12, 0x21, 0xd2, 0x90, 0x39, 0x41, 0x7f, 0x8a, 0x9e, 0xce, 0x79, 0xda, 0x44, 0x67, 0x8b, 
+  0x90, 0x26, 0x45, 0xd9, 0xbc, 0x4b, 0x42, 0xfb, 0x6b, 0xe9, 0xac, 0xe0, 0xe5, 0xb6, 0x65, 0xa7, 
+  0x44, 0x3c, 0xd0, 0x55, 0x9f, 0x15, 0x9d, 0x31, 0x39, 0xf5, 0x02, 0xfb, 0x5e, 0x0f, 0xa5, 0xf7, 
+  0x31, 0x93, 0x7e, 0x81, 0x9d, 0x10, 0x1c, 0xed, 0xb4, 0x8a, 0x8a, 0x65, 0x77, 0xa3, 0x66, 0xa5, 
+  0x35, 0x39, 0x30, 0x27, 0x7f, 0xea, 0x9e, 0xd6, 0x73, 0x86, 0x2f, 0x47, 0x37, 0xb3, 0x9e, 0x12, 
+  0x66, 0xb4, 0x78, 0xea, 0x3d, 0x7b, 0xca, 0xf0, 0xf2, 0x70, 0x48, 0x27, 0x84, 0xba, 0x47, 0x3e, 
+  0xe8, 0x7d, 0x75, 0x29, 0x3b, 0xc3, 0x93, 0x62, 0xd1, 0x64, 0x00, 0xac, 0xe4, 0xc6, 0x67, 0x7c, 
+  0xe3, 0xbf, 0x7a, 0xa3, 0xdc, 0x33, 0x5f, 0xe1, 0x9f, 0x99, 0x68, 0xe2, 0xb0, 0x4e, 0x4a, 0x56, 
+  0x3a, 0x56, 0x07, 0x0a, 0x8f, 0x3a, 0xc9, 0xa7, 0x2b, 0xb0, 0xf1, 0xf2, 0xa8, 0x3b, 0x58, 0xf1, 
+  0xdf, 0xff, 0xca, 0xbe, 0x3e, 0x48, 0x46, 0x23, 0x1a, 0x8a, 0x2b, 0x2a, 0x8e, 0x4f, 0xb7, 0x98, 
+  0xfb, 0x6a, 0x36, 0x3d, 0x3a, 0x2a, 0x4b, 0x92, 0x26, 0xe6, 0x67, 0x83, 0x2a, 0x9b, 0xaf, 0x39, 
+  0x32, 0xff, 0xd1, 0x20, 0x3d, 0x41, 0xf4, 0xb4, 0x22, 0x4f, 0x80, 0xf5, 0xd9, 0x1b, 0x15, 0xc0, 
+  0x4e, 0x4e, 0x57, 0x17, 0x03, 0x96, 0x29, 0x56, 0x60, 0x8a, 0x56, 0x48, 0xce, 0xd4, 0x84, 0x0d, 
+  0xbb, 0xa4, 0x7c, 0xcb, 0xa5, 0xa4, 0x1e, 0x02, 0x55, 0xdb, 0x8e, 0x8c, 0x0f, 0x50, 0x8a, 0xf4, 
+  0x8d, 0x66, 0x60, 0x26, 0x92, 0xd2, 0x20, 0x44, 0x5b, 0xec, 0x3a, 0x40, 0xec, 0xd8, 0x3e, 0x95, 
+  0xd9, 0xd3, 0x9a, 0xc8, 0x6a, 0x7e, 0x96, 0x2d, 0xd6, 0x60, 0x5d, 0xfd, 0x10, 0x1d, 0xae, 0x05, 
+  0xc1, 0x46, 0xcc, 0x2b, 0x59, 0x25, 0xd8, 0x2b, 0xd5, 0xd6, 0x88, 0x6a, 0x52, 0x0f, 0xdb, 0xb7, 
+  0x80, 0x24, 0xbe, 0x94, 0xdf, 0x7e, 0x15, 0xde, 0xa6, 0xc6, 0x85, 0xc6, 0xf0, 0xb1, 0x4e, 0x6a, 
+  0x56, 0xe3, 0xad, 0x54, 0x06, 0x22, 0x58, 0x82, 0x4b, 0x60, 0x99, 0xc5, 0x1f, 0x99, 0x02, 0xbb, 
+  0x0d, 0x8d, 0x07, 0x38, 0x89, 0x4e, 0x53, 0x34, 0x82, 0xef, 0xa4, 0xab, 0x4e, 0x6f, 0x2d, 0x3b, 
+  0xae, 0xbf, 0x00, 0xbc, 0x57, 0x6f, 0x05, 0x45, 0xfc, 0xd8, 0x8e, 0x0d, 0x72, 0x26, 0x59, 0xad, 
+  0x39, 0xad, 0x25, 0xeb, 0xa9, 0x5b, 0xd8, 0x09, 0x2b, 0x0c, 0x36, 0xdb, 0x02, 0x59, 0x32, 0x0e, 
+  0x4f, 0xf9, 0x57, 0xda, 0xe7, 0x13, 0x62, 0x94, 0xa9, 0x7f, 0x45, 0xe6, 0xbb, 0xe1, 0xa1, 0xf9, 
+  0xb4, 0xa4, 0x61, 0x49, 0x1b, 0x42, 0x3a, 0x1a, 0x91, 0x1e, 0xc3, 0xcc, 0x46, 0x6e, 0xdd, 0x07, 
+  0x89, 0x9f, 0xed, 0x24, 0xe9, 0x0e, 0xe8, 0x9a, 0xb3, 0x03, 0xa0, 0x44, 0xe6, 0xc8, 0x79, 0x11, 
+  0xfc, 0xbf, 0x90, 0x69, 0x45, 0x5f, 0x96, 0xd5, 0x51, 0x06, 0xfb, 0xeb, 0x69, 0x17, 0xdb, 0xac, 
+  0xdc, 0x31, 0xc9, 0x41, 0xee, 0xf8, 0x42, 0x28, 0x4d, 0xb5, 0x88, 0xb3, 0xc6, 0x82, 0x8c, 0x71, 
+  0xcc, 0xd3, 0xed, 0x5f, 0xf6, 0x09, 0xd3, 0x5e, 0xbe, 0x12, 0xfd, 0x2b, 0x75, 0x2e, 0x56, 0xeb, 
+  0xe2, 0x45, 0x5a, 0x2d, 0x6f, 0xe4, 0x62, 0xc5, 0xd6, 0xc3, 0x27, 0x69, 0xc2, 0x51, 0x3c, 0x75, 
+  0xbd, 0xcc, 0x6c, 0xcf, 0x7a, 0x81, 0xcf, 0xa3, 0x2f, 0x00, 0x66, 0x6f, 0xcd, 0x03, 0x30, 0x29, 
+  0x94, 0xd9, 0x8b, 0xd9, 0x5f, 0x8d, 0x8f, 0xfe, 0xa9, 0xcf, 0xdc, 0x4e, 0xb4, 0xcc, 0x5f, 0x57, 
+  0x79, 0xed, 0xaa, 0x88, 0x4e, 0x9e, 0x59, 0xc5, 0x09, 0x3b, 0x5b, 0x33, 0xd9, 0x6a, 0xd6, 0x10, 
+  0x25, 0x05, 0x3a, 0xac, 0x68, 0x50, 0xbc, 0xce, 0x2f, 0xf3, 0x3a, 0xde, 0x96, 0x82, 0xda, 0xa4, 
+  0x3c, 0x1a, 0xef, 0x1f, 0x4d, 0xa5, 0x18, 0xf3, 0x49, 0x13, 0x35, 0xb0, 0x76, 0x2b, 0x2e, 0x0c, 
+  0x68, 0xa9, 0xa7, 0x33, 0x64, 0x23, 0xe5, 0x8c, 0x2e, 0x9e, 0x9f, 0xdc, 0xfc, 0x76, 0x96, 0x15, 
+  0x92, 0xc0, 0xb6, 0x62, 0x0c, 0x1f, 0x92, 0xe7, 0x27, 0x69, 0x0c, 0x9a, 0xef, 0xdf, 0x52, 0xbf, 
+  0x67, 0x54, 0xe4, 0xbc, 0xe1, 0x6c, 0x38, 0x65, 0x57, 0xf8, 0xb1, 0xec, 0x44, 0x2f, 0x11, 0x8a, 
+  0x18, 0x12, 0x3e, 0xeb, 0x06, 0x8e, 0x3c, 0xd2, 0xb7, 0x3c, 0x1a, 0x88, 0x3d, 0x1b, 0x91, 0x44, 
+  0x10, 0x8b, 0x14, 0x24, 0xe3, 0x80, 0x74, 0xb7, 0x01, 0xfb, 0x2b, 0x06, 0x8f, 0xea, 0x6a, 0x9d, 
+  0x3d, 0x0a, 0x69, 0xaf, 0x9f, 0xa7, 0x6b, 0xec, 0x97, 0xf5, 0x20, 0x17, 0x94, 0x33, 0xe5, 0x7b, 
+  0xcb, 0x16, 0x10, 0x9e, 0xb8, 0x49, 0x52, 0x6b, 0xba, 0x1c, 0x94, 0x27, 0x27, 0x03, 0xe6, 0xe6, 
+  0xca, 0x0a, 0x26, 0xe2, 0x84, 0x64, 0x50, 0xd1, 0x0b, 0xc3, 0x30, 0xc6, 0xef, 0x4d, 0x9a, 0x7e, 
+  0xfb, 0xb5, 0x78, 0x06, 0xd3, 0xe2, 0x3b, 0xdc, 0xef, 0xb1, 0x4f, 0x0a, 0xed, 0xd6, 0x2d, 0xc6, 
+  0x8a, 0x8c, 0x75, 0x99, 0x78, 0x32, 0xb0, 0x60, 0x0e, 0xc2, 0x8a, 0x59, 0x48, 0xbd, 0xd2, 0x9d, 
+  0xef, 0x48, 0x86, 0xa2, 0xc9, 0x3f, 0x03, 0x94, 0xe7, 0x79, 0x48, 0xeb, 0x57, 0x55, 0xdf, 0x80, 
+  0x96, 0x50, 0x49, 0x1f, 0x78, 0xce, 0x06, 0x28, 0x81, 0xf8, 0xc6, 0x7c, 0x43, 0xdb, 0x17, 0x1e, 
+  0x65, 0x1f, 0xd7, 0xe9, 0x32, 0xaf, 0x6f, 0x9e, 0x49, 0x34, 0x62, 0x95, 0x78, 0x02, 0xe7, 0xe4, 
+  0x19, 0xae, 0xae, 0x42, 0x81, 0xf1, 0x9e, 0x26, 0xb7, 0x48, 0x81, 0x46, 0x5a, 0xea, 0x22, 0xde, 
+  0x0f, 0x15, 0x46, 0x01, 0xfd, 0x92, 0x31, 0x41, 0x3f, 0x44, 0x9c, 0x8b, 0xf7, 0x39, 0x99, 0xcc, 
+  0xf7, 0x74, 0xa7, 0xf3, 0xac, 0x79, 0xc2, 0x33, 0xe3, 0xcf, 0x79, 0x27, 0x07, 0x8c, 0xfd, 0x7d, 
+  0x0f, 0x12, 0x95, 0x3a, 0x78, 0x3e, 0x4b, 0x84, 0x3f, 0x3b, 0x7a, 0x3b, 0x4f, 0x0a, 0xf9, 0x75, 
+  0x24, 0xf9, 0x6c, 0x3f, 0x28, 0x8e, 0xd5, 0x85, 0xe8, 0xe6, 0x9e, 0x5c, 0xbc, 0x60, 0xa1, 0xfb, 
+  0xcf, 0xb9, 0x65, 0x10, 0xbe, 0x70, 0x96, 0x3c, 0x55, 0xc3, 0x9e, 0xae, 0xd5, 0xe7, 0x1b, 0xfe, 
+  0x91, 0x38, 0x1c, 0xde, 0xa4, 0x19, 0xcd, 0xa4, 0xfa, 0x9b, 0x20, 0xbc, 0x89, 0xd6, 0x72, 0xa0, 
+  0x4c, 0xce, 0x97, 0x89, 0xa7, 0x16, 0xea, 0xf0, 0x86, 0xfa, 0xc0, 0x15, 0xca, 0xb3, 0xe8, 0x65, 
+  0x72, 0xab, 0x72, 0x78, 0xa6, 0x0c, 0x83, 0xf7, 0xcf, 0x59, 0xb2, 0xbf, 0x09, 0xff, 0xd8, 0xe2, 
+  0x06, 0x65, 0x7b, 0x38, 0xbb, 0x42, 0x2f, 0x55, 0x14, 0x9b, 0x90, 0x98, 0xff, 0x39, 0xa7, 0xf1, 
+  0x5c, 0x4f, 0xc4, 0x8e, 0x8e, 0x08, 0x7e, 0x87, 0x35, 0x57, 0xd9, 0xb3, 0xaa, 0xe8, 0x25, 0x42, 
+  0xea, 0x73, 0x9a, 0xd3, 0xd1, 0x3f, 0x52, 0xe8, 0xb5, 0xff, 0x48, 0xd9, 0xb7, 0xd6, 0xb0, 0xe3, 
+  0xae, 0xf9, 0xf4, 0x1a, 0xa7, 0x43, 0x29, 0xce, 0xc3, 0x11, 0x3f, 0x12, 0xc8, 0xa6, 0xf2, 0x53, 
+  0xe4, 0x44, 0xf0, 0x14, 0xe8, 0x81, 0x61, 0x8d, 0xa4, 0xae, 0x09, 0xcf, 0x67, 0x52, 0xbc, 0x4b, 
+  0x98, 0x7d, 0x2f, 0x55, 0xe2, 0xe7, 0x3f, 0x66, 0xbe, 0xca, 0xf0, 0xfc, 0x19, 0x54, 0x0b, 0xc6, 
+  0xdc, 0x6f, 0x15, 0x79, 0x39, 0x57, 0xde, 0xdc, 0x97, 0x48, 0x52, 0x33, 0x46, 0x77, 0x0c, 0xe2, 
+  0x17, 0xd1, 0x32, 0xfa, 0x9d, 0x6a, 0x18, 0x5b, 0x64, 0x27, 0xd8, 0xbb, 0x13, 0xe4, 0x0f, 0x8e, 
+  0x47, 0xa3, 0x3c, 0xe0, 0x64, 0xd3, 0x8a, 0xc6, 0x03, 0xe7, 0xb0, 0xaa, 0xf1, 0x8c, 0xdb, 0x00, 
+  0x10, 0xc0, 0x16, 0xa8, 0xb7, 0xe9, 0x36, 0x80, 0x98, 0x7f, 0xce, 0x68, 0x93, 0x99, 0x6f, 0xc5, 
+  0xe8, 0x7e, 0x9b, 0xfa, 0x01, 0x56, 0x8c, 0x4d, 0xf8, 0x8f, 0x99, 0x5d, 0xc5, 0x68, 0x64, 0xee, 
+  0xfe, 0x2d, 0x8d, 0x7b, 0x66, 0x6d, 0xc8, 0xb8, 0x5b, 0x02, 0x01, 0x07, 0xe3, 0xd7, 0x2b, 0x92, 
+  0xaa, 0xc6, 0x65, 0xf4, 0x23, 0x48, 0x4a, 0xf0, 0x27, 0x29, 0xbb, 0xd3, 0x32, 0xec, 0x39, 0x97, 
+  0xac, 0x75, 0x16, 0x58, 0xe6, 0x80, 0xdd, 0x46, 0x3f, 0x00, 0x00, 0x33, 0xa4, 0x2f, 0x98, 0x2b, 
+  0x22, 0x8d, 0x9c, 0xaa, 0x3c, 0x9c, 0x4d, 0xf0, 0x8f, 0x1f, 0xc4, 0xa5, 0xaf, 0x10, 0xeb, 0x32, 
+  0x8c, 0x9f, 0x32, 0xfa, 0x05, 0x29, 0xa5, 0x79, 0x30, 0x46, 0xb7, 0xd3, 0x7d, 0x2c, 0x26, 0xff, 
+  0x48, 0xe7, 0x12, 0x66, 0xa1, 0x2e, 0xa3, 0xb7, 0x33, 0x27, 0x44, 0xb2, 0xa4, 0x2f, 0x42, 0xf5, 
+  0xbd, 0x9c, 0x5e, 0x36, 0x5f, 0x23, 0xe4, 0x87, 0xd6, 0x98, 0x1f, 0x39, 0xcd, 0xc1, 0x15, 0x66, 
+  0x47, 0x19, 0xbd, 0x71, 0x6f, 0xac, 0x99, 0x88, 0x34, 0x0b, 0x4b, 0xc9, 0x2f, 0x76, 0xf3, 0x90, 
+  0x03, 0xbe, 0xe3, 0x87, 0xb9, 0x03, 0xef, 0x28, 0x4d, 0x23, 0xa1, 0x1d, 0x39, 0x0d, 0x9c, 0x36, 
+  0x9b, 0x30, 0xc0, 0x4f, 0xf8, 0x73, 0xba, 0xf5, 0xb3, 0xbc, 0x9c, 0xc2, 0xd8, 0x6a, 0x7e, 0x1a, 
+  0x50, 0xb4, 0xdf, 0x3b, 0xb1, 0x40, 0x26, 0x2b, 0xe5, 0x9e, 0xfb, 0xee, 0xee, 0xf6, 0xc6, 0xca, 
+  0xde, 0x3a, 0xb6, 0xc2, 0xa2, 0x9f, 0x4b, 0xfe, 0xf2, 0xcb, 0x96, 0xbf, 0x5b, 0xad, 0x9c, 0x18, 
+  0x15, 0x68, 0xec, 0xc8, 0x18, 0x68, 0xe1, 0xb7, 0x2e, 0x36, 0xe1, 0x2f, 0x69, 0x6f, 0xa8, 0xfa, 
+  0x50, 0xb0, 0xb9, 0x5a, 0x4b, 0xe8, 0xdd, 0x5d, 0xff, 0x79, 0xc9, 0xef, 0xd6, 0x39, 0x38, 0xed, 
+  0xf1, 0xa5, 0x96, 0x86, 0x26, 0xb2, 0x5a, 0x9a, 0x9b, 0x85, 0xfd, 0x01, 0x69, 0x4f, 0x90, 0xdb, 
+  0x3b, 0xee, 0x31, 0xf8, 0x14, 0x8c, 0xfd, 0x83, 0xdd, 0x11, 0x06, 0xad, 0x4a, 0x18, 0x6d, 0xb1, 
+  0x22, 0xff, 0xe0, 0xdf, 0x84, 0xde, 0x4a, 0x8f, 0x42, 0x5a, 0xcb, 0xa2, 0x3f, 0x82, 0x50, 0x9d, 
+  0xd6, 0xbe, 0xdf, 0x1b, 0xcb, 0xf3, 0xcb, 0x17, 0xc0, 0x3c, 0x21, 0xb7, 0x48, 0x10, 0x28, 0xe9, 
+  0xd1, 0x30, 0x64, 0xdc, 0x44, 0xbf, 0xcf, 0xc5, 0x17, 0xb1, 0x4c, 0xa5, 0xa5, 0x0f, 0x52, 0x2a, 
+  0xde, 0x75, 0x0b, 0xa2, 0xd0, 0x3f, 0xa2, 0x13, 0x01, 0x64, 0x58, 0xce, 0x93, 0x2d, 0xc9, 0x05, 
+  0x43, 0xf4, 0x7b, 0xcf, 0xcb, 0x64, 0xd1, 0x1f, 0x5b, 0xce, 0x77, 0x26, 0x95, 0xb2, 0xbd, 0xe8, 
+  0x17, 0xd4, 0x4e, 0xd4, 0x7f, 0x28, 0x81, 0x2c, 0x5f, 0xbd, 0x6b, 0x5d, 0x59, 0xf2, 0x1b, 0x7c, 
+  0xc6, 0x44, 0x5e, 0x26, 0x5b, 0xdc, 0x41, 0x80, 0x2c, 0x54, 0x7e, 0x07, 0xe0, 0x6b, 0xd8, 0xae, 
+  0x1d, 0x9a, 0x16, 0x30, 0x13, 0x02, 0x19, 0x77, 0xa3, 0x77, 0x75, 0x51, 0x45, 0xb4, 0x0a, 0xf2, 
+  0xfb, 0x2c, 0x26, 0x11, 0x85, 0x3e, 0x75, 0x1e, 0xae, 0x3a, 0x63, 0x58, 0x05, 0x06, 0xa3, 0x19, 
+  0x08, 0x5f, 0x71, 0x84, 0x17, 0x44, 0xd9, 0x0e, 0xec, 0x17, 0xc1, 0x40, 0x2f, 0x4e, 0x57, 0x6c, 
+  0xd8, 0x49, 0xe7, 0xf5, 0x20, 0x5d, 0x91, 0x14, 0x02, 0x89, 0x3b, 0x2b, 0xe6, 0x79, 0xb6, 0x62, 
+  0xc9, 0xff, 0x7c, 0xa6, 0xa3, 0x25, 0x5f, 0xcf, 0x43, 0x84, 0xfe, 0xff, 0x1d, 0xa4, 0x2c, 0xf8, 
+  0x93, 0x80, 0x37, 0x0e, 0x93, 0xef, 0xba, 0xb3, 0x27, 0x59, 0x86, 0x8c, 0xca, 0x87, 0xb8, 0xa6, 
+  0xdd, 0x9d, 0x05, 0x5b, 0x32, 0xcc, 0xc2, 0xcb, 0x60, 0xc3, 0xe1, 0xb3, 0xb4, 0x0d, 0xc9, 0xd6, 
+  0xe4, 0x48, 0x5c, 0x72, 0x46, 0xfc, 0x26, 0xfc, 0xf5, 0x9e, 0x32, 0xbf, 0xa6, 0x56, 0x44, 0x06, 
+  0xd2, 0x1f, 0x48, 0x81, 0x5a, 0x3c, 0x13, 0x10, 0x1b, 0x8f, 0xbf, 0x45, 0xff, 0x35, 0xf8, 0x55, 
+  0x9e, 0x5b, 0xef, 0xab, 0x06, 0xa1, 0xca, 0xc3, 0xdf, 0x72, 0x4f, 0xbe, 0x7a, 0x55, 0xe4, 0x00, 
+  0xff, 0x57, 0x05, 0x7f, 0xd5, 0x05, 0xc5, 0x8e, 0x6a, 0xd7, 0x87, 0x12, 0xd7, 0x0b, 0x8c, 0x83, 
+  0xe8, 0x5a, 0x16, 0xd8, 0x19, 0x8b, 0xcc, 0xb3, 0xb9, 0xef, 0x7d, 0x58, 0x22, 0xbd, 0x5c, 0x22, 
+  0x37, 0xa8, 0x9f, 0x5f, 0x44, 0x6f, 0x9c, 0x31, 0xec, 0xa8, 0xa9, 0xdb, 0x31, 0x75, 0xe8, 0xab, 
+  0xd0, 0x8a, 0x58, 0x4f, 0x67, 0xc7, 0x8d, 0x77, 0x19, 0xf6, 0x6e, 0x58, 0x28, 0xa3, 0x3c, 0xc5, 
+  0x56, 0x4a, 0xd7, 0x12, 0xfb, 0x1a, 0xa0, 0x52, 0x53, 0x5f, 0x51, 0x71, 0x04, 0x31, 0x48, 0x81, 
+  0x48, 0xd9, 0xe0, 0x81, 0x48, 0x45, 0x8d, 0xe1, 0x94, 0xef, 0xcb, 0xd4, 0x54, 0x84, 0x0a, 0xa5, 
+  0x83, 0x37, 0xfc, 0x5a, 0x4d, 0x3d, 0x3d, 0x05, 0x59, 0xaa, 0x91, 0x49, 0x0b, 0x61, 0x27, 0xbc, 
+  0xb6, 0x63, 0xbb, 0xed, 0x5c, 0x7a, 0x4c, 0xe8, 0x27, 0x69, 0xa4, 0xa5, 0x67, 0x8e, 0x8f, 0xa6, 
+  0xa7, 0x8a, 0x30, 0x74, 0x9d, 0xdc, 0xb6, 0xd7, 0xb5, 0xb8, 0x08, 0xaf, 0xb6, 0x6c, 0xc5, 0xd4, 
+  0xb8, 0x4d, 0x78, 0xe6, 0x0c, 0x09, 0x45, 0x51, 0xdf, 0x96, 0x5e, 0x55, 0x69, 0x04, 0x03, 0xfe, 
+  0x07, 0xc5, 0xdb, 0x7b, 0x11, 0x2f, 0x74, 0xce, 0xa2, 0x74, 0xad, 0x7b, 0x81, 0x5b, 0xff, 0x99, 
+  0xbe, 0xeb, 0x9b, 0xe8, 0x72, 0xa1, 0x3c, 0xe8, 0x2a, 0xc9, 0xdd, 0x1b, 0x5f, 0x4f, 0x3f, 0x1f, 
+  0xe3, 0x12, 0x15, 0xfe, 0x67, 0x9a, 0x6c, 0xe5, 0x95, 0x95, 0xfd, 0x01, 0x49, 0x5e, 0xe7, 0x48, 
+  0x01, 0xfb, 0x7c, 0x2c, 0xbf, 0x7c, 0xfc, 0x14, 0x14, 0x18, 0xdc, 0xcf, 0x87, 0x0c, 0x0d, 0x42, 
+  0xd5, 0xbd, 0xea, 0x27, 0xb0, 0x41, 0x29, 0xba, 0xfa, 0x86, 0xcb, 0x3c, 0x4f, 0xfb, 0x79, 0x38, 
+  0xfa, 0x16, 0x3e, 0x79, 0x2e, 0x47, 0xbe, 0xbd, 0xb1, 0xf3, 0x31, 0x7a, 0x4b, 0x3c, 0x85, 0x67, 
+  0xf0, 0xc1, 0x5c, 0xdb, 0xa5, 0x4b, 0x27, 0xbc, 0xe4, 0x8d, 0x59, 0x19, 0xdd, 0xb0, 0x93, 0x57, 
+  0xe6, 0xfc, 0x6f, 0x50, 0x2d, 0x71, 0xda, 0x2d, 0xf0, 0x3c, 0x75, 0x4a, 0xdc, 0x53, 0xa0, 0x79, 
+  0x20, 0x7d, 0x01, 0x4f, 0x46, 0xdc, 0x0f, 0xf4, 0x49, 0x3c, 0xc4, 0xfe, 0x80, 0xa1, 0xf0, 0xca, 
+  0x9c, 0x61, 0x3d, 0xec, 0x87, 0x74, 0xc5, 0x86, 0x17, 0xa4, 0xa6, 0x5d, 0xd3, 0xf0, 0x77, 0xaf, 
+  0xfe, 0x96, 0x2f, 0x97, 0x72, 0x19, 0x57, 0x73, 0xbe, 0x7a, 0xe9, 0x76, 0x9d, 0x15, 0x30, 0x38, 
+  0x6c, 0x02, 0x06, 0x55, 0xda, 0x2f, 0xed, 0xcb, 0xbe, 0x27, 0x13, 0xd2, 0xe3, 0xe4, 0xd5, 0xae, 
+  0xca, 0xa8, 0x27, 0x20, 0x5b, 0xce, 0x49, 0xe7, 0xe3, 0x04, 0x8c, 0x5c, 0xd6, 0x91, 0xfc, 0x4f, 
+  0x0e, 0xa9, 0x2c, 0x06, 0xcd, 0x5b, 0x0d, 0x38, 0xae, 0xaa, 0x71, 0x5b, 0x17, 0x72, 0x22, 0x44, 
+  0xc2, 0x0a, 0x9b, 0x4b, 0xf0, 0xc3, 0x28, 0x4d, 0x51, 0x13, 0x40, 0x09, 0x27, 0xe9, 0x1b, 0xed, 
+  0xce, 0x4f, 0x25, 0xd1, 0xea, 0x32, 0xe5, 0xc9, 0x9a, 0x19, 0x14, 0xac, 0xba, 0x4a, 0xe7, 0x17, 
+  0x1c, 0xed, 0xa2, 0x34, 0x66, 0x43, 0x55, 0xc4, 0x45, 0xc1, 0xee, 0x0c, 0x13, 0x8d, 0x83, 0x2b, 
+  0xda, 0x02, 0x43, 0xbc, 0x62, 0xcc, 0x4a, 0x8e, 0x68, 0xee, 0x73, 0xc3, 0x63, 0xbc, 0xbe, 0x02, 
+  0x6c, 0x5e, 0x5f, 0x08, 0xaf, 0x44, 0xef, 0xd6, 0x0a, 0xeb, 0xc3, 0x04, 0x34, 0xe7, 0x76, 0xfa, 
+  0x2a, 0x09, 0xeb, 0x95, 0x0f, 0xdb, 0x8b, 0xcf, 0xe9, 0xe4, 0xc6, 0xcd, 0xce, 0x0f, 0xe7, 0x75, 
+  0x4d, 0xed, 0x9f, 0x25, 0x5e, 0x4c, 0x65, 0x54, 0xe6, 0xe1, 0x3e, 0x29, 0x1e, 0x3b, 0x3b, 0x8d, 
+  0xf3, 0xc7, 0xbd, 0xef, 0x8c, 0xef, 0xd3, 0x1e, 0x70, 0x87, 0x87, 0x49, 0x65, 0x5e, 0xb3, 0xcb, 
+  0xc7, 0xb0, 0x88, 0xf3, 0x4d, 0x0a, 0xec, 0xb9, 0xe7, 0x45, 0xf6, 0x0e, 0x12, 0x93, 0x9e, 0x0e, 
+  0x23, 0xdc, 0xf4, 0x78, 0xdc, 0xe9, 0xa1, 0xac, 0x13, 0x13, 0xd4, 0xbc, 0x81, 0x95, 0x09, 0x6a, 
+  0xd2, 0x10, 0x43, 0xa7, 0xa1, 0x0b, 0xda, 0x20, 0xaa, 0xf2, 0xa6, 0x43, 0x3b, 0xe4, 0x3c, 0xe2, 
+  0x7f, 0xda, 0xff, 0x63, 0xd3, 0x12, 0xcb, 0xec, 0x9e, 0x39, 0x81, 0xaa, 0xd5, 0xb8, 0xa2, 0xde, 
+  0x2c, 0x24, 0x6b, 0x9d, 0x97, 0xa3, 0xea, 0x38, 0xfa, 0xa0, 0x5a, 0x05, 0xc1, 0x7b, 0x6c, 0x9a, 
+  0x6b, 0x1a, 0xdb, 0xee, 0x56, 0x0b, 0x96, 0xf8, 0x5c, 0x7a, 0x54, 0x15, 0xf4, 0x3b, 0x2b, 0x3b, 
+  0x46, 0x61, 0x5c, 0x6f, 0x29, 0x74, 0x5f, 0xbf, 0xd3, 0xda, 0x2e, 0x01, 0x8e, 0x3d, 0x31, 0x42, 
+  0xa8, 0xcd, 0x0f, 0x6c, 0x51, 0x5d, 0xdd, 0x18, 0xaa, 0x64, 0xd2, 0x5e, 0xcf, 0x89, 0xf4, 0x8d, 
+  0xc2, 0x2e, 0xcc, 0x00, 0x73, 0x80, 0xdc, 0x0c, 0xbf, 0xf9, 0x78, 0xfa, 0x03, 0x70, 0x42, 0x7a, 
+  0xf3, 0xd5, 0x04, 0xa2, 0xd7, 0xd9, 0x28, 0xd4, 0xac, 0xc2, 0xc2, 0xa8, 0x36, 0x4d, 0x64, 0xa6, 
+  0x78, 0x24, 0xe0, 0x0d, 0x30, 0x82, 0x07, 0x55, 0x06, 0x0c, 0x9a, 0x6c, 0xc0, 0x70, 0x09, 0x83, 
+  0x15, 0xe2, 0xb1, 0x65, 0x5c, 0x0c, 0x14, 0x55, 0x61, 0x3f, 0x04, 0x1f, 0xdb, 0x73, 0xb8, 0x66, 
+  0x07, 0x83, 0xaf, 0x3d, 0x40, 0xc6, 0xad, 0x26, 0xff, 0x31, 0x63, 0x28, 0xe3, 0x26, 0x14, 0x6d, 
+  0xac, 0x43, 0xa9, 0x48, 0x79, 0xef, 0x06, 0xaa, 0x39, 0xa3, 0x96, 0x87, 0x25, 0xe3, 0x4b, 0x2b, 
+  0x00, 0x61, 0x1d, 0xb9, 0x56, 0xf9, 0x53, 0x8f, 0xc7, 0xb9, 0x0d, 0xc3, 0x59, 0x37, 0x0d, 0xac, 
+  0xb7, 0x34, 0xb0, 0xf9, 0x2e, 0x0c, 0x37, 0xd3, 0x7d, 0xbc, 0xf1, 0x9e, 0x34, 0x4b, 0x23, 0xaf, 
+  0x5b, 0x1e, 0xaf, 0x55, 0x62, 0xf5, 0x8c, 0x3a, 0xcb, 0x59, 0xd2, 0xb1, 0xe4, 0x55, 0xd1, 0xc5, 
+  0x0c, 0x9e, 0xcf, 0xcc, 0x06, 0x43, 0xb7, 0xe3, 0xbe, 0x2d, 0xf1, 0x06, 0x65, 0x91, 0x98, 0x85, 
+  0xbf, 0xd4, 0xf3, 0xf0, 0xa6, 0x40, 0x8b, 0x1d, 0x56, 0xd4, 0x77, 0x5a, 0x63, 0xcf, 0xc3, 0x13, 
+  0x28, 0xc6, 0x57, 0x62, 0xbb, 0x5e, 0x24, 0x7b, 0x0c, 0xe0, 0xbb, 0x4e, 0x49, 0x4a, 0x87, 0xe9, 
+  0x64, 0x8c, 0xdf, 0xce, 0xfe, 0x81, 0xc4, 0x1e, 0x11, 0xa3, 0xd1, 0xa4, 0xd0, 0x4b, 0x9b, 0xe6, 
+  0x32, 0xe3, 0x83, 0x03, 0xcf, 0x02, 0xf9, 0xfd, 0x84, 0x96, 0x5c, 0x51, 0x9e, 0x7b, 0x4c, 0x72, 
+  0x7d, 0x66, 0xba, 0x7e, 0xe1, 0x42, 0x63, 0x7c, 0xdd, 0xdd, 0x8d, 0x46, 0x0b, 0x90, 0x42, 0xf5, 
+  0x66, 0xa1, 0x8e, 0xb5, 0xbb, 0x50, 0x67, 0x6e, 0x54, 0x11, 0xf3, 0x72, 0xd0, 0xde, 0x36, 0x56, 
+  0xef, 0x08, 0x54, 0xe3, 0x3f, 0xba, 0x16, 0xc7, 0x71, 0x66, 0xdd, 0x25, 0xbb, 0x21, 0x35, 0xee, 
+  0xe7, 0xd4, 0x77, 0xde, 0x10, 0x6b, 0x87, 0x3f, 0xbc, 0xba, 0xbb, 0xdb, 0x3f, 0x58, 0xe0, 0xf7, 
+  0x15, 0x4f, 0xe0, 0xe5, 0x0c, 0x10, 0x24, 0xdc, 0xcf, 0xcc, 0x6a, 0x77, 0xc5, 0x0b, 0xa6, 0xdd, 
+  0xa9, 0x8c, 0x25, 0xa6, 0x97, 0xf0, 0x3e, 0xd3, 0x64, 0xed, 0xf6, 0x24, 0xec, 0xb9, 0x1b, 0xac, 
+  0x45, 0xf8, 0x08, 0xae, 0x89, 0x02, 0x26, 0x8c, 0x2d, 0xfd, 0x3f, 0xe4, 0x04, 0xf4, 0x9e, 0x56, 
+  0x93, 0x9a, 0x93, 0x43, 0xe9, 0xed, 0xe9, 0xec, 0x9c, 0x3e, 0xcc, 0x39, 0x18, 0xf3, 0x2e, 0xfc, 
+  0x80, 0xc7, 0x02, 0x3f, 0xf4, 0x8f, 0x59, 0x97, 0x74, 0xd7, 0x89, 0x01, 0xb4, 0x30, 0x1d, 0xf3, 
+  0xa9, 0x76, 0x0a, 0x1c, 0x27, 0xb7, 0xc2, 0xde, 0x14, 0x67, 0x21, 0xcb, 0x23, 0xd8, 0x1b, 0xb1, 
+  0xf4, 0xc0, 0x42, 0x4a, 0x63, 0xe1, 0xe4, 0xe1, 0xc3, 0xe1, 0x42, 0xe3, 0x32, 0xb1, 0x26, 0x68, 
+  0xb0, 0x1f, 0x1a, 0x5c, 0x03, 0x76, 0x51, 0xad, 0xae, 0x73, 0x78, 0xbc, 0xe8, 0xf3, 0xcf, 0xc1, 
+  0x95, 0x80, 0xe5, 0xc5, 0x8b, 0x57, 0x49, 0x39, 0xe6, 0x43, 0xbd, 0x9c, 0xc4, 0x12, 0xc1, 0xb7, 
+  0x37, 0xae, 0x0f, 0xd2, 0x71, 0x0d, 0x7c, 0x2d, 0x1f, 0xd9, 0x73, 0x90, 0x8d, 0x30, 0x55, 0xc3, 
+  0xd5, 0xa8, 0x56, 0xde, 0x34, 0xb9, 0x8f, 0x56, 0x2a, 0xae, 0x85, 0xf6, 0x04, 0x3e, 0x56, 0xb5, 
+  0x94, 0x08, 0xda, 0xf4, 0xc4, 0x0f, 0x4d, 0xb7, 0x66, 0xd3, 0x15, 0xdd, 0xea, 0xdc, 0x28, 0xcb, 
+  0x98, 0x17, 0xd7, 0x89, 0x80, 0xb3, 0xe6, 0x85, 0x6f, 0x50, 0x5a, 0xf7, 0x18, 0x01, 0xe8, 0x60, 
+  0x6f, 0x52, 0x8e, 0xf0, 0x23, 0x2e, 0x84, 0x34, 0x03, 0xd8, 0xf0, 0x1c, 0xd1, 0x3b, 0x29, 0x63, 
+  0x73, 0x53, 0x3d, 0xf2, 0x8b, 0xe9, 0xfe, 0x31, 0xe3, 0xb2, 0x97, 0x0c, 0x61, 0x36, 0x4a, 0x77, 
+  0xbe, 0xa2, 0x37, 0x36, 0xb5, 0x95, 0x61, 0xda, 0xec, 0x62, 0x6b, 0x74, 0xd2, 0x1c, 0xff, 0x2c, 
+  0x93, 0xaf, 0xe8, 0x25, 0x57, 0xe3, 0xd1, 0xa8, 0x0e, 0x47, 0xa3, 0x65, 0x50, 0xc3, 0x91, 0x33, 
+  0x57, 0x69, 0x57, 0x4e, 0xdb, 0x6b, 0x96, 0xab, 0x43, 0xea, 0x11, 0x90, 0xfe, 0xea, 0x02, 0xa6, 
+  0x57, 0x96, 0x7c, 0x99, 0x55, 0x80, 0xb3, 0xb9, 0x3f, 0x0f, 0xd7, 0xfa, 0x3d, 0x55, 0xf4, 0x4e, 
+  0x2c, 0x1f, 0x75, 0x73, 0x95, 0xe4, 0x30, 0x8b, 0xf3, 0x7c, 0x3a, 0x6a, 0x54, 0x3d, 0xf6, 0x8a, 
+  0xb1, 0x92, 0x77, 0x09, 0xe1, 0xf9, 0xbe, 0x41, 0xc2, 0xb3, 0xbf, 0xab, 0xe8, 0x6d, 0x0b, 0xd2, 
+  0xc8, 0x7b, 0x33, 0x82, 0xd8, 0x75, 0x33, 0x48, 0x95, 0x0f, 0xa2, 0x2e, 0xe9, 0xe7, 0x45, 0x19, 
+  0x69, 0x45, 0x96, 0xf6, 0x95, 0x25, 0xb0, 0x5e, 0x91, 0xe4, 0xb3, 0xba, 0xca, 0xe6, 0x34, 0xb4, 
+  0xa9, 0xc0, 0x23, 0xbe, 0xe9, 0xd1, 0x40, 0x14, 0xb7, 0x68, 0xf0, 0xea, 0x84, 0x0b, 0x5c, 0xe7, 
+  0xb4, 0x45, 0x51, 0x0d, 0x70, 0x0a, 0xb1, 0x5f, 0x63, 0xbe, 0xae, 0xe0, 0x2f, 0x97, 0xba, 0x43, 
+  0x95, 0x48, 0x24, 0xf1, 0x20, 0x05, 0x02, 0x43, 0xaa, 0xf4, 0x32, 0x03, 0xfd, 0x8b, 0x25, 0x94, 
+  0xea, 0x65, 0xa7, 0x8c, 0x56, 0x33, 0x3b, 0x08, 0x9a, 0xb9, 0x18, 0xcc, 0xc6, 0xcc, 0x5a, 0x68, 
+  0x15, 0x84, 0x54, 0xec, 0x57, 0x18, 0x21, 0x6b, 0x4c, 0xf9, 0x77, 0xd8, 0x53, 0xf1, 0xe3, 0x17, 
+  0xd0, 0x06, 0x44, 0x87, 0x1b, 0x27, 0x73, 0xc7, 0x5a, 0xc2, 0x27, 0xb4, 0x74, 0xc4, 0x3a, 0x15, 
+  0x28, 0x64, 0x63, 0x1b, 0xe3, 0x7f, 0x26, 0x40, 0xfc, 0xeb, 0xe9, 0x38, 0xb9, 0xea, 0xf6, 0xde, 
+  0xdb, 0x76, 0x54, 0xcb, 0x59, 0x8a, 0x0c, 0x27, 0xb4, 0xcf, 0xf6, 0xe9, 0x40, 0xc0, 0xa2, 0x03, 
+  0xab, 0x47, 0x4d, 0xe2, 0x78, 0x11, 0x71, 0x2f, 0x02, 0xac, 0xec, 0x30, 0x3e, 0x0f, 0x17, 0x29, 
+  0x02, 0x59, 0x7f, 0xc5, 0x3f, 0x47, 0x29, 0x90, 0xe4, 0x7e, 0x98, 0xe1, 0xdf, 0x23, 0xfc, 0xf3, 
+  0x07, 0x9f, 0xa8, 0xf1, 0x4f, 0xb9, 0x88, 0xa5, 0x39, 0xe1, 0x6a, 0x16, 0x33, 0xd0, 0x3b, 0x07, 
+  0x09, 0x85, 0x39, 0x9d, 0x56, 0x4e, 0x09, 0xb8, 0xb7, 0xe0, 0xa4, 0x7f, 0xb5, 0x92, 0x30, 0xfc, 
+  0x05, 0x4a, 0xe5, 0xc2, 0x47, 0x16, 0xde, 0xa4, 0x6e, 0x41, 0x5c, 0xbb, 0x49, 0xc3, 0xab, 0x19, 
+  0x47, 0x20, 0x84, 0xab, 0x98, 0x7a, 0xe4, 0x75, 0xbc, 0x17, 0x9e, 0xcc, 0x25, 0x24, 0xc1, 0x18, 
+  0xf5, 0xa7, 0x47, 0xc7, 0x49, 0x49, 0xeb, 0xd6, 0x83, 0x79, 0x1f, 0xf0, 0x5a, 0xde, 0xa7, 0xfc, 
+  0x57, 0x3d, 0xca, 0x7f, 0x65, 0xd4, 0x8d, 0x2a, 0xbc, 0x10, 0xc9, 0xbc, 0xca, 0x26, 0xf4, 0x1d, 
+  0xff, 0x48, 0xb1, 0x85, 0xd1, 0xa7, 0xc4, 0x1f, 0xa7, 0x92, 0x67, 0x41, 0x10, 0x17, 0x62, 0x09, 
+  0x68, 0x5c, 0x92, 0xee, 0x36, 0x1c, 0xbe, 0xfb, 0xab, 0x76, 0x84, 0x8a, 0xed, 0x08, 0x65, 0x84, 
+  0xc5, 0xba, 0x8c, 0x7e, 0x98, 0xc9, 0x43, 0x73, 0x2b, 0x37, 0x96, 0x4e, 0xe7, 0x2a, 0x14, 0x1c, 
+  0xcd, 0x51, 0x71, 0x77, 0xf6, 0xb3, 0xb1, 0x01, 0xc8, 0x18, 0xcb, 0x31, 0xdc, 0xe6, 0x8c, 0xc2, 
+  0x68, 0x52, 0xfa, 0xe9, 0x2c, 0x8c, 0xce, 0x33, 0x07, 0x9d, 0x81, 0x01, 0x2e, 0x61, 0x04, 0xe5, 
+  0x8f, 0x7f, 0xd1, 0x6b, 0xbf, 0x78, 0xb6, 0xcd, 0x97, 0x40, 0x5d, 0x1f, 0xbd, 0xde, 0x84, 0xef, 
+  0x7a, 0xd3, 0xfe, 0x74, 0x81, 0x3f, 0x68, 0x35, 0x82, 0xbc, 0xc5, 0x96, 0x1a, 0x67, 0xa8, 0x3e, 
+  0x19, 0x3c, 0x42, 0x27, 0x3f, 0x1a, 0x98, 0x49, 0xcd, 0xba, 0x22, 0x26, 0x3f, 0xe9, 0x8b, 0xc2, 
+  0xa0, 0xa4, 0x63, 0x28, 0x90, 0xd6, 0x87, 0xec, 0x75, 0x5d, 0x2b, 0x13, 0x6a, 0x15, 0x41, 0xf4, 
+  0x4a, 0x48, 0x67, 0xb8, 0x25, 0xa3, 0x11, 0x3e, 0x1b, 0x80, 0x75, 0xde, 0xb2, 0x30, 0xff, 0x2e, 
+  0xed, 0xf8, 0xb4, 0xd1, 0x3a, 0x73, 0xc3, 0x4a, 0x50, 0x65, 0x84, 0x7a, 0x9d, 0xc9, 0xd1, 0x5a, 
+  0x70, 0x4d, 0x99, 0xb0, 0x67, 0x14, 0x1c, 0x86, 0xc9, 0xe8, 0x9c, 0x78, 0x97, 0xe8, 0x41, 0xf4, 
+  0x43, 0x0a, 0xb6, 0xf8, 0x07, 0xd1, 0xbf, 0x10, 0x64, 0x74, 0x95, 0x06, 0x81, 0x41, 0x50, 0xd9, 
+  0x84, 0xa7, 0x8b, 0x8e, 0x85, 0x06, 0xb7, 0x0d, 0xf5, 0x53, 0x8f, 0x52, 0xa5, 0xc9, 0x95, 0xa9, 
+  0xcf, 0x5b, 0xee, 0xbc, 0xdb, 0x4c, 0xdd, 0xc4, 0x26, 0x07, 0x83, 0x56, 0x93, 0x3d, 0x52, 0x33, 
+  0xa9, 0xb7, 0x3f, 0x76, 0xeb, 0xff, 0x21, 0x9d, 0xe8, 0xda, 0x7f, 0x55, 0x02, 0x3e, 0x7e, 0x2f, 
+  0x30, 0x72, 0x35, 0x97, 0x2c, 0xbb, 0xf6, 0x6e, 0x3a, 0x96, 0xd6, 0x61, 0xc6, 0x3e, 0x59, 0x7d, 
+  0x4b, 0x6e, 0x20, 0xad, 0x48, 0x50, 0x52, 0x37, 0x8a, 0x8d, 0x4d, 0x8b, 0xd8, 0xfa, 0xfc, 0xe9, 
+  0x22, 0xd4, 0x1e, 0x47, 0x76, 0xab, 0xb2, 0x9e, 0xa8, 0xae, 0x7d, 0x5c, 0xa8, 0x7b, 0x94, 0xad, 
+  0xf7, 0x01, 0x09, 0x05, 0x0e, 0x77, 0x9a, 0x88, 0x1c, 0x05, 0x0f, 0x3e, 0x52, 0x36, 0xb2, 0x79, 
+  0x7f, 0x0f, 0x30, 0xc7, 0x6d, 0xd7, 0xeb, 0x8f, 0x68, 0x29, 0xd2, 0x65, 0xea, 0x89, 0xef, 0x38, 
+  0xf3, 0xf5, 0x3b, 0x9c, 0xcc, 0x15, 0x63, 0x30, 0xff, 0xbe, 0xc7, 0xbd, 0x9f, 0xd1, 0x64, 0x61, 
+  0x60, 0x65, 0xda, 0x16, 0xe3, 0x8c, 0xbe, 0xc7, 0x24, 0xe3, 0x8f, 0xb2, 0x87, 0x23, 0x75, 0xe9, 
+  0x97, 0x2d, 0xda, 0x18, 0x55, 0xce, 0xe0, 0x82, 0xb4, 0x44, 0x55, 0x89, 0x80, 0xe3, 0x0c, 0x6b, 
+  0xfe, 0xb6, 0xf8, 0xa3, 0xe0, 0x0f, 0x69, 0x16, 0x0e, 0x05, 0x23, 0x06, 0x07, 0x24, 0x8a, 0x41, 
+  0x82, 0xa6, 0xbd, 0x40, 0xf2, 0x5b, 0x68, 0x92, 0x3b, 0xac, 0x26, 0xe2, 0xb1, 0xf5, 0x0d, 0xb2, 
+  0x06, 0xd6, 0x80, 0xfd, 0x31, 0x2a, 0xa5, 0xcf, 0x28, 0x51, 0x75, 0xa2, 0x11, 0xfd, 0x3a, 0xb7, 
+  0xdd, 0x7e, 0x52, 0x60, 0xdf, 0x98, 0x3c, 0xa3, 0xd7, 0xca, 0xb1, 0x88, 0x2e, 0xae, 0xa8, 0x77, 
+  0x7f, 0x9d, 0xdf, 0xfb, 0x0e, 0xb4, 0x76, 0x23, 0x28, 0xe1, 0x8f, 0x74, 0x72, 0x1e, 0x53, 0xa3, 
+  0x5e, 0x83, 0x2d, 0xe4, 0x70, 0xce, 0xa3, 0x26, 0x7c, 0x93, 0xc6, 0x75, 0xb4, 0x0a, 0x4b, 0x5a, 
+  0xd1, 0x69, 0xe8, 0x8d, 0xad, 0x6d, 0xee, 0xf7, 0x99, 0x7f, 0xfb, 0x7a, 0x1e, 0xe7, 0xe1, 0xf9, 
+  0x2c, 0x5e, 0x85, 0x97, 0x52, 0xfc, 0xd7, 0x94, 0xc1, 0x58, 0xe9, 0x16, 0xe8, 0x29, 0x74, 0x8b, 
+  0xc4, 0xcf, 0xa1, 0x31, 0xbf, 0xcc, 0x99, 0xe5, 0x41, 0xa6, 0x11, 0xac, 0xbd, 0xd1, 0x61, 0x98, 
+  0x8b, 0x85, 0x57, 0x41, 0x6a, 0xf7, 0x49, 0xc6, 0x54, 0xa8, 0x65, 0xc3, 0xa4, 0x5a, 0x0f, 0x49, 
+  0x70, 0xa5, 0xbb, 0x26, 0xc6, 0xd3, 0x1a, 0x67, 0x6a, 0x46, 0xf5, 0xd6, 0x80, 0x91, 0x89, 0xa5, 
+  0xb5, 0xba, 0xaf, 0x10, 0x09, 0xd3, 0xd7, 0xe9, 0x05, 0xea, 0x87, 0x3f, 0xab, 0x1d, 0x88, 0x88, 
+  0xbe, 0xd7, 0xb8, 0x5f, 0x65, 0xc3, 0x0b, 0x4d, 0x92, 0xc0, 0x44, 0x29, 0x44, 0xf8, 0x4d, 0x9b, 
+  0x81, 0xdf, 0xe3, 0x8d, 0xa5, 0xb6, 0x02, 0x10, 0x18, 0x80, 0x23, 0xda, 0x6d, 0x55, 0x47, 0x6f, 
+  0x52, 0x74, 0x06, 0x58, 0xe1, 0xa8, 0xca, 0x5f, 0x39, 0x10, 0x21, 0xbc, 0xda, 0xfe, 0x99, 0x34, 
+  0xa8, 0x76, 0xcd, 0xf3, 0x1b, 0x78, 0x29, 0xd4, 0xb9, 0x01, 0xd6, 0xa0, 0x5a, 0xbd, 0x95, 0x92, 
+  0x31, 0xa4, 0x7b, 0xf9, 0xa1, 0x87, 0x1d, 0x47, 0xad, 0xda, 0xec, 0x7e, 0x4b, 0x1d, 0xea, 0x66, 
+  0xf9, 0x24, 0x87, 0xb3, 0x64, 0xfb, 0x1a, 0xbf, 0x90, 0xf5, 0x05, 0x15, 0xc7, 0x66, 0xa1, 0x49, 
+  0x98, 0x24, 0x5c, 0x0e, 0xe8, 0x59, 0x6a, 0x49, 0x73, 0x5d, 0xa3, 0x0a, 0x80, 0xd9, 0x14, 0x6b, 
+  0x26, 0xe6, 0xaf, 0xcc, 0x86, 0xd8, 0x59, 0xac, 0x42, 0x8d, 0xcd, 0x2c, 0x11, 0x06, 0x9b, 0xf0, 
+  0x62, 0xfb, 0xda, 0x28, 0x3d, 0x4a, 0x3d, 0x6f, 0xbc, 0x81, 0xd1, 0xaa, 0xe5, 0x0f, 0xb4, 0x40, 
+  0x9c, 0xd1, 0xdb, 0x39, 0xe7, 0x82, 0xcc, 0xf4, 0x9e, 0x58, 0xd3, 0x3c, 0xa2, 0x3d, 0x11, 0xa7, 
+  0xd8, 0x90, 0xa5, 0x82, 0xb8, 0x78, 0xd8, 0x66, 0x12, 0x16, 0xc1, 0x5f, 0x08, 0xde, 0x63, 0x79, 
+  0xdf, 0x2c, 0x12, 0x5f, 0xb2, 0xda, 0x88, 0xe1, 0xf5, 0x49, 0x6e, 0xd7, 0x5d, 0x77, 0xb8, 0x0c, 
+  0x7a, 0x04, 0x8b, 0xa2, 0xa1, 0x98, 0xed, 0x65, 0x74, 0x04, 0xed, 0x0d, 0x44, 0x66, 0x73, 0xad, 
+  0x31, 0x2b, 0xee, 0x55, 0xa9, 0xb3, 0xa4, 0x27, 0xdd, 0xdd, 0xe5, 0xf2, 0x21, 0x4b, 0xdd, 0x98, 
+  0x52, 0xe6, 0x10, 0x7a, 0x1e, 0x49, 0xfe, 0x18, 0xed, 0x02, 0x9e, 0x62, 0x62, 0x63, 0xe5, 0xd5, 
+  0xcb, 0xce, 0xab, 0x93, 0x16, 0x44, 0x9b, 0x23, 0x83, 0xaa, 0x2a, 0xf3, 0x46, 0xd1, 0xeb, 0x2c, 
+  0x2d, 0x79, 0x2b, 0x65, 0x2e, 0xe6, 0x9b, 0x39, 0x6d, 0x81, 0x0f, 0x10, 0xa6, 0x83, 0x5d, 0x35, 
+  0x44, 0x5e, 0x00, 0xc7, 0xfa, 0x87, 0x52, 0x26, 0xa1, 0xb9, 0xbd, 0x29, 0x11, 0x79, 0x90, 0xf7, 
+  0x4c, 0xa2, 0xd2, 0x9a, 0x44, 0xd4, 0x2f, 0xff, 0xe8, 0x76, 0x8a, 0xd9, 0x78, 0xc7, 0x05, 0x2a, 
+  0xd1, 0xfd, 0x30, 0x84, 0xe2, 0xaa, 0x63, 0x25, 0xf4, 0x49, 0xa8, 0xad, 0xf2, 0x66, 0x45, 0xff, 
+  0x47, 0xc5, 0x79, 0x86, 0xb7, 0x7e, 0x40, 0x4b, 0xd3, 0x83, 0xf0, 0x15, 0x16, 0xaa, 0x57, 0x24, 
+  0x2e, 0xe2, 0xef, 0x55, 0xba, 0x11, 0xa5, 0x96, 0xfd, 0xd3, 0x22, 0xb8, 0x6d, 0x99, 0xfa, 0xe7, 
+  0xd4, 0xe6, 0xd5, 0x32, 0xcb, 0xae, 0xd8, 0x53, 0xff, 0xf6, 0xaf, 0xec, 0xc4, 0x35, 0xa3, 0x73, 
+  0xe0, 0x63, 0xf5, 0x4e, 0x3c, 0x35, 0xc9, 0xde, 0x5a, 0x93, 0x0c, 0xfd, 0xf1, 0xae, 0x33, 0x4e, 
+  0xac, 0xf7, 0xa7, 0x41, 0xe1, 0xac, 0x72, 0x4d, 0x97, 0xc0, 0x7f, 0xda, 0xf1, 0xda, 0x5c, 0x38, 
+  0x5e, 0x9b, 0x9f, 0xc2, 0xe7, 0xca, 0x6f, 0x03, 0xd5, 0x6c, 0xfa, 0x5c, 0x5c, 0x35, 0x17, 0xf2, 
+  0xe3, 0x12, 0x96, 0xa7, 0xc5, 0xbd, 0x5e, 0x96, 0x4b, 0x36, 0x9a, 0xcf, 0xbf, 0x54, 0x08, 0x8e, 
+  0x93, 0xa3, 0x63, 0xf9, 0x97, 0x36, 0x8b, 0x8d, 0xeb, 0x57, 0x64, 0x5b, 0x96, 0x32, 0x73, 0x69, 
+  0xe7, 0x6b, 0xed, 0xfa, 0x3d, 0x2e, 0x8d, 0x5f, 0xe4, 0x99, 0x75, 0xd3, 0x6c, 0x61, 0x4e, 0xbf, 
+  0x25, 0x59, 0xd0, 0xbe, 0x34, 0x5f, 0xb4, 0x9c, 0x97, 0xec, 0x26, 0xb9, 0x10, 0xb7, 0xc7, 0x85, 
+  0x76, 0x93, 0x5c, 0x68, 0x37, 0xc9, 0x85, 0x15, 0xfc, 0x74, 0x11, 0x35, 0xc5, 0xf2, 0xd5, 0x93, 
+  0x39, 0xf3, 0xb7, 0xd1, 0xd9, 0x79, 0x6a, 0x4e, 0xf7, 0x7b, 0x4d, 0x2f, 0x94, 0xcb, 0xb4, 0x9a, 
+  0xf7, 0x9a, 0xa2, 0xfa, 0x3c, 0x4a, 0x13, 0x00, 0xa7, 0x43, 0xb0, 0xbc, 0x85, 0x30, 0xcb, 0x5e, 
+  0x88, 0x58, 0xe3, 0x6d, 0x36, 0x54, 0x6b, 0xe0, 0x05, 0xc4, 0x75, 0x51, 0x22, 0xf8, 0x86, 0x40, 
+  0x7b, 0x9e, 0xae, 0x5a, 0x2f, 0x5e, 0xcd, 0x9d, 0x98, 0x59, 0x0b, 0x7e, 0x9e, 0x43, 0x6c, 0x64, 
+  0xd5, 0x48, 0x4a, 0x12, 0x27, 0xb2, 0x6b, 0x12, 0x69, 0xbb, 0x3e, 0x1d, 0x9a, 0xcc, 0x20, 0x8e, 
+  0x14, 0xcd, 0x0a, 0x74, 0xd2, 0xa4, 0x18, 0x48, 0x52, 0x6a, 0x65, 0xc3, 0xb2, 0xfe, 0x9c, 0x9d, 
+  0xbe, 0xf8, 0x7c, 0xd5, 0x3a, 0x89, 0x7c, 0xd9, 0xd6, 0x29, 0x49, 0x4b, 0x68, 0x9d, 0xfc, 0x89, 
+  0xe3, 0xda, 0x5a, 0x27, 0x9f, 0x4a, 0xd8, 0x9b, 0xe1, 0xd7, 0x18, 0x0b, 0xd0, 0x44, 0xd5, 0x01, 
+  0x83, 0x05, 0x07, 0xa7, 0xc9, 0xc3, 0x1d, 0xd0, 0xfa, 0x92, 0x72, 0xe8, 0x70, 0x1a, 0x74, 0x51, 
+  0xa4, 0xb3, 0x2e, 0x92, 0xac, 0x8d, 0x22, 0x3a, 0x2e, 0x1a, 0xef, 0x8b, 0x80, 0x1f, 0xd3, 0xbc, 
+  0xe8, 0x0d, 0x8a, 0xa8, 0x4b, 0xe0, 0x8b, 0x30, 0xdd, 0xb0, 0xfc, 0xf4, 0x94, 0xa8, 0x65, 0x21, 
+  0xb6, 0x32, 0x74, 0x95, 0x03, 0xf8, 0xa0, 0x77, 0x62, 0xea, 0x51, 0x64, 0xf7, 0x69, 0xf3, 0x54, 
+  0xc3, 0x41, 0xa9, 0xec, 0x54, 0x9a, 0x95, 0x28, 0xe6, 0x23, 0x15, 0x09, 0x2a, 0x07, 0x2a, 0xf5, 
+  0x46, 0x0e, 0x4c, 0xcb, 0x62, 0xc6, 0x9f, 0xaf, 0x6d, 0x5b, 0x93, 0xfa, 0x90, 0xb1, 0xb2, 0x74, 
+  0x29, 0xcf, 0x98, 0x17, 0xeb, 0x95, 0x1a, 0xf9, 0xb6, 0x75, 0x30, 0xe6, 0x1b, 0x19, 0x62, 0x69, 
+  0x52, 0xc4, 0xb0, 0x1f, 0x62, 0x50, 0xc0, 0xca, 0x9c, 0x6e, 0x9c, 0xc0, 0x76, 0x91, 0x02, 0xb3, 
+  0x9b, 0x15, 0xcc, 0x48, 0x7c, 0xf0, 0x7a, 0x46, 0x3f, 0x37, 0xa4, 0x78, 0xce, 0xdb, 0x8e, 0xc1, 
+  0xbd, 0x9e, 0x04, 0x74, 0x47, 0x59, 0xfb, 0xcd, 0x46, 0x5b, 0xbb, 0x28, 0xb9, 0x37, 0x43, 0xb1, 
+  0x99, 0xc0, 0x90, 0x20, 0x4d, 0x17, 0x6b, 0x4b, 0x5a, 0xd4, 0xb0, 0xb6, 0x28, 0x16, 0x5d, 0xcb, 
+  0x86, 0xb2, 0x72, 0x02, 0x76, 0x6c, 0x68, 0xa0, 0xbd, 0xb1, 0x20, 0x6b, 0xd1, 0xd7, 0x39, 0xd8, 
+  0xdf, 0x63, 0x83, 0x5e, 0x96, 0x64, 0x96, 0x69, 0x5d, 0x5c, 0x7b, 0xf2, 0xdd, 0xb6, 0x30, 0xbd, 
+  0xb2, 0xdf, 0xf0, 0xc9, 0xdc, 0xe4, 0x01, 0xcf, 0xd4, 0x65, 0x84, 0x1d, 0x9a, 0x90, 0x9b, 0xe4, 
+  0x16, 0x43, 0xed, 0x1e, 0x40, 0x68, 0xd3, 0x69, 0xa1, 0xf2, 0x98, 0x4c, 0x54, 0xcf, 0xb1, 0x93, 
+  0x24, 0x6e, 0xae, 0x2b, 0xc8, 0xa2, 0x40, 0xf7, 0xac, 0x0e, 0x85, 0xa1, 0xe7, 0xb9, 0x79, 0xe5, 
+  0xb6, 0xcf, 0x47, 0xad, 0x0b, 0xee, 0x63, 0x02, 0xf3, 0x88, 0xec, 0x38, 0x3e, 0xb7, 0xa2, 0x40, 
+  0xf0, 0xba, 0x1c, 0x1e, 0x3a, 0xb7, 0x4e, 0xd0, 0xb8, 0x35, 0x3d, 0x81, 0xd3, 0xe7, 0xb4, 0xb3, 
+  0xb8, 0x61, 0xdf, 0x32, 0x42, 0x1b, 0xf0, 0x17, 0x19, 0x5b, 0x57, 0x32, 0xea, 0xb4, 0xa2, 0xca, 
+  0x89, 0xcd, 0x92, 0x29, 0x4f, 0x5a, 0xef, 0x73, 0x49, 0x0b, 0x7f, 0xc3, 0x85, 0x38, 0x9c, 0xe3, 
+  0xc3, 0x87, 0x89, 0x9d, 0xe4, 0xfd, 0x22, 0x5a, 0x18, 0x33, 0xc6, 0x9f, 0x33, 0x90, 0x31, 0x70, 
+  0xf2, 0x23, 0xe0, 0x53, 0x4f, 0x2d, 0xf8, 0x54, 0x06, 0xe2, 0x12, 0x87, 0xb4, 0xc7, 0x70, 0xa4, 
+  0x5b, 0x2f, 0x46, 0x62, 0xb5, 0xcb, 0xb3, 0xc5, 0x44, 0xc1, 0xb1, 0x00, 0x25, 0x95, 0x16, 0xcc, 
+  0x58, 0x1d, 0x2a, 0xf3, 0x2b, 0x27, 0x5f, 0xea, 0x66, 0xa3, 0x0b, 0x1b, 0x48, 0x56, 0x06, 0x04, 
+  0xa1, 0x56, 0x9e, 0x47, 0x6b, 0xda, 0x91, 0x55, 0xeb, 0xa6, 0xad, 0xeb, 0xc7, 0x41, 0x7c, 0xde, 
+  0xb2, 0x70, 0x0e, 0xd4, 0x13, 0x68, 0x5b, 0x3e, 0xef, 0xc2, 0x48, 0xdf, 0xdf, 0x7d, 0xdb, 0xa6, 
+  0xbf, 0x9e, 0xe3, 0x76, 0x0a, 0xb5, 0xdb, 0x67, 0xe1, 0x79, 0x10, 0x7a, 0xf7, 0x76, 0x38, 0xfb, 
+  0xdd, 0x41, 0x6e, 0xc3, 0x59, 0x51, 0x5f, 0xf8, 0x3a, 0x06, 0xc4, 0xa6, 0x6e, 0x59, 0x71, 0xef, 
+  0x69, 0x01, 0x08, 0x6c, 0xee, 0xaf, 0x55, 0x64, 0x5e, 0xa9, 0xb8, 0x27, 0x9c, 0xbd, 0x8e, 0x3d, 
+  0x6f, 0x63, 0x1b, 0xc7, 0xd5, 0xd7, 0xf1, 0x3c, 0x21, 0x4d, 0xd1, 0xf4, 0x29, 0x60, 0x42, 0x49, 
+  0xce, 0xdd, 0x00, 0xd6, 0x9d, 0x7d, 0x95, 0x89, 0x62, 0x3e, 0x95, 0x8d, 0x66, 0x8c, 0x28, 0x2c, 
+  0xc4, 0xd2, 0x22, 0x1c, 0xdf, 0xfd, 0x9e, 0xe5, 0x71, 0x10, 0x08, 0x87, 0x90, 0xc7, 0x74, 0x8e, 
+  0xec, 0x84, 0xa5, 0x35, 0x2b, 0x29, 0x55, 0xb6, 0x0c, 0xa0, 0x37, 0x69, 0x5c, 0xe4, 0x24, 0x32, 
+  0x09, 0xfe, 0x00, 0x20, 0x85, 0xc1, 0x44, 0x16, 0x08, 0x8e, 0x9a, 0x3d, 0x1a, 0x92, 0xbc, 0x6d, 
+  0xf4, 0xb6, 0x18, 0x5f, 0x14, 0x68, 0x5d, 0x0d, 0xd0, 0xba, 0xa6, 0x7b, 0x0d, 0xb6, 0x82, 0x54, 
+  0x84, 0x54, 0xf1, 0x02, 0x39, 0x3d, 0x1c, 0x18, 0x75, 0x1e, 0xf4, 0x5f, 0x63, 0x4b, 0xa8, 0x84, 
+  0x45, 0x85, 0xfc, 0x42, 0xdb, 0xca, 0xb1, 0xa9, 0xd5, 0x2a, 0x78, 0xce, 0xe2, 0xc7, 0xd9, 0xf6, 
+  0x90, 0xbb, 0xfd, 0xaf, 0xbe, 0x66, 0x22, 0x77, 0x0b, 0xaf, 0x2b, 0x22, 0x49, 0xb2, 0x7a, 0x86, 
+  0xec, 0xa7, 0xda, 0xdf, 0xe3, 0x97, 0x36, 0x2e, 0xfb, 0xfd, 0x70, 0x67, 0x5f, 0x85, 0xc5, 0xd6, 
+  0x3a, 0xd6, 0x41, 0xe7, 0x7d, 0x9d, 0x04, 0x26, 0x3f, 0x08, 0x2a, 0x0a, 0xd8, 0xbd, 0x64, 0x0d, 
+  0xf3, 0x42, 0x0b, 0x98, 0x29, 0x65, 0xa7, 0x0c, 0xed, 0xe1, 0xd3, 0x15, 0x62, 0x8f, 0x57, 0xb2, 
+  0x5a, 0xae, 0x93, 0xd4, 0x7d, 0x2a, 0x6a, 0xf8, 0xe6, 0x1b, 0xc0, 0xaf, 0x89, 0x78, 0x72, 0x90, 
+  0xec, 0x35, 0xe1, 0x81, 0x50, 0x5d, 0x54, 0xac, 0xd7, 0x2d, 0xad, 0x79, 0x71, 0xad, 0x5c, 0x44, 
+  0x9a, 0x5b, 0x83, 0x36, 0xe2, 0xf8, 0x76, 0x5d, 0x5c, 0x14, 0xe5, 0x75, 0x01, 0xdb, 0xb1, 0x75, 
+  0x1e, 0x3e, 0xb5, 0x92, 0xcd, 0x08, 0xa4, 0xeb, 0x00, 0x6a, 0x38, 0x2f, 0x30, 0x71, 0x75, 0xde, 
+  0xde, 0x7f, 0x7d, 0x6b, 0x1e, 0x39, 0x2c, 0x61, 0x7b, 0x11, 0xba, 0xcf, 0xdc, 0x78, 0x1c, 0x68, 
+  0xe3, 0x96, 0x30, 0xc4, 0xf6, 0xcd, 0xdf, 0x30, 0x56, 0xdc, 0xc3, 0x87, 0x2b, 0x8c, 0x97, 0xd4, 
+  0x84, 0xa2, 0xad, 0xf1, 0xa2, 0x40, 0xad, 0x96, 0x3e, 0xba, 0x82, 0x6c, 0x3f, 0x5c, 0x4c, 0xd7, 
+  0xd3, 0xbd, 0x63, 0x80, 0x1d, 0xf8, 0x02, 0xf3, 0xaf, 0xd2, 0x33, 0xfd, 0x86, 0xe8, 0x3a, 0x0d, 
+  0x46, 0xd4, 0xd1, 0xa6, 0x67, 0x83, 0xa6, 0x27, 0xa9, 0xff, 0x68, 0xe8, 0xa7, 0x89, 0xb7, 0xeb, 
+  0x05, 0xf1, 0x37, 0x58, 0x77, 0xd7, 0x77, 0x77, 0xf2, 0x15, 0xe9, 0xc7, 0x77, 0x68, 0xee, 0x7a, 
+  0x42, 0xc3, 0x3f, 0xfe, 0x66, 0x5f, 0x5f, 0xfb, 0x2f, 0x75, 0x8d, 0xcb, 0x4c, 0x76, 0x76, 0x4a, 
+  0xe9, 0x14, 0x1d, 0xbb, 0xfb, 0xf5, 0x37, 0x43, 0x6e, 0xfa, 0xd7, 0xdf, 0x0d, 0xb9, 0x9c, 0x8f, 
+  0xa4, 0x62, 0xe7, 0x7b, 0x2b, 0x38, 0xb8, 0xb4, 0x41, 0xbf, 0x2e, 0x84, 0xe6, 0x26, 0x99, 0x7a, 
+  0x48, 0xe6, 0x40, 0x32, 0x74, 0xba, 0x84, 0xa4, 0x2c, 0xe0, 0x2b, 0xa1, 0x25, 0x6d, 0xc0, 0xe3, 
+  0xb4, 0xfb, 0x6f, 0x7f, 0x12, 0x4f, 0x1f, 0x7c, 0x40, 0xda, 0xf5, 0xf4, 0xc1, 0xfb, 0xeb, 0xe3, 
+  0xc7, 0x77, 0x7e, 0x34, 0x0a, 0xfc, 0xf7, 0xd1, 0xfb, 0xd5, 0x63, 0xf7, 0xfc, 0xfb, 0x69, 0x34, 
+  0x7a, 0x4f, 0x53, 0xf4, 0xc1, 0x2e, 0xfc, 0xc9, 0x22, 0x52, 0xfa, 0xde, 0x7b, 0x0f, 0x15, 0xfc, 
+  0xfb, 0xbd, 0xf7, 0x9e, 0xfe, 0xef, 0xf8, 0x0e, 0xff, 0x46, 0xc1, 0xe3, 0xf7, 0xde, 0xdd, 0x23, 
+  0x3e, 0xff, 0xc8, 0x39, 0xfd, 0xe8, 0x6e, 0x97, 0xcf, 0xee, 0x3a, 0x67, 0x77, 0xaf, 0x1f, 0xdf, 
+  0x51, 0x0d, 0xef, 0x57, 0x71, 0xb8, 0x7b, 0x3c, 0xfd, 0x77, 0xf8, 0xde, 0x7b, 0x74, 0x4b, 0x3b, 
+  0xe3, 0x6e, 0x3c, 0xa5, 0x42, 0xc7, 0x8f, 0xf9, 0x52, 0xeb, 0xa4, 0x94, 0x3f, 0xa6, 0xd7, 0x39, 
+  0xa5, 0x7e, 0xbf, 0x4a, 0x76, 0xa7, 0xd4, 0x32, 0xef, 0xd1, 0x93, 0x9d, 0x7f, 0x51, 0x83, 0xf7, 
+  0x76, 0xbe, 0xfb, 0xf0, 0x00, 0x00, 0xdb, 0x00, 0x26, 0xc8, 0x91, 0x9a, 0x21, 0x5d, 0x43, 0x3f, 
+  0x64, 0x7d, 0x8b, 0xf7, 0x91, 0xd5, 0xdf, 0xa0, 0xc3, 0x7c, 0x4a, 0x63, 0x9a, 0x1d, 0xa7, 0x69, 
+  0x7c, 0x16, 0x3e, 0x41, 0xb0, 0xea, 0xef, 0x1d, 0x2c, 0xfb, 0x16, 0x79, 0x94, 0x49, 0xf9, 0x1f, 
+  0xae, 0x1b, 0x50, 0x61, 0xb0, 0xe8, 0x0a, 0x13, 0x91, 0xc2, 0x59, 0x52, 0xc8, 0x25, 0x15, 0x27, 
+  0xde, 0x57, 0x99, 0x4a, 0x09, 0xa4, 0x51, 0x06, 0x24, 0x14, 0xeb, 0x0c, 0xe3, 0x89, 0xe6, 0xc6, 
+  0xb4, 0x3c, 0x06, 0x73, 0x3a, 0x24, 0x50, 0x45, 0x53, 0x5f, 0x25, 0x80, 0xb6, 0x35, 0x61, 0x24, 
+  0x73, 0xc0, 0xab, 0x98, 0x05, 0x18, 0x31, 0xce, 0x6a, 0x2c, 0x2e, 0x03, 0xe1, 0x1c, 0xd8, 0x3f, 
+  0x9e, 0x78, 0x6f, 0x58, 0x48, 0xf3, 0xbd, 0x11, 0x0e, 0x47, 0x5e, 0x80, 0x1f, 0x5f, 0x1d, 0xc7, 
+  0x00, 0x66, 0xa9, 0x38, 0x79, 0x9d, 0xc7, 0xec, 0x23, 0xce, 0xf7, 0x7d, 0xd4, 0xbc, 0xec, 0x87, 
+  0x3f, 0x49, 0x5b, 0x45, 0xba, 0x62, 0xf2, 0xe1, 0xcf, 0x0d, 0xcd, 0xc9, 0x15, 0x5b, 0xc5, 0xbd, 
+  0xae, 0xbd, 0x88, 0x13, 0x91, 0x07, 0x54, 0x04, 0x7e, 0x06, 0xa7, 0x2e, 0xc6, 0x62, 0x95, 0xb8, 
+  0x28, 0xea, 0xd3, 0x14, 0xff, 0xac, 0x12, 0x49, 0x9c, 0x00, 0xe8, 0x1d, 0x2f, 0x07, 0x4f, 0x98, 
+  0x8f, 0xbc, 0xac, 0x56, 0xe1, 0x3a, 0xa9, 0x39, 0xd3, 0x83, 0x3a, 0xed, 0x2d, 0xc3, 0xe1, 0x21, 
+  0x42, 0xa8, 0x83, 0x5a, 0x38, 0xa9, 0x18, 0x01, 0xd2, 0x8e, 0x8a, 0x71, 0x8d, 0x1c, 0xb4, 0x2c, 
+  0xd0, 0x0c, 0xa5, 0x05, 0x07, 0x74, 0x0f, 0x6a, 0x79, 0xd1, 0xeb, 0x3a, 0x56, 0x96, 0x86, 0x2e, 
+  0x3e, 0xf7, 0x3d, 0x15, 0xf1, 0xc8, 0x86, 0xff, 0x0f, 0xbc, 0x2a, 0x23, 0x35, 0xc7, 0xa3, 0x17, 
+  0x4f, 0xd5, 0x6a, 0x44, 0x73, 0xd9, 0xbc, 0x9d, 0x39, 0xb3, 0x09, 0x4f, 0x16, 0xdb, 0x29, 0x0e, 
+  0xda, 0xca, 0x89, 0x22, 0x42, 0x41, 0x9b, 0x1c, 0xd8, 0x75, 0x8d, 0xb1, 0xbe, 0x09, 0xff, 0x9e, 
+  0x76, 0x58, 0x17, 0x41, 0x8e, 0xcb, 0x11, 0xef, 0x0c, 0x3d, 0x3b, 0x44, 0x04, 0x21, 0x43, 0x18, 
+  0x8b, 0x35, 0xcb, 0x0f, 0x44, 0xc1, 0xcb, 0xc0, 0x38, 0x4f, 0x6b, 0x13, 0xc7, 0x03, 0x6f, 0x79, 
+  0x9d, 0x80, 0xb5, 0xf8, 0xe2, 0x58, 0xfe, 0x65, 0x7c, 0x07, 0x23, 0x6b, 0x82, 0xbe, 0x1d, 0xa9, 
+  0xa9, 0x65, 0xf1, 0x73, 0x86, 0xf2, 0xe8, 0x6b, 0xec, 0x44, 0xdb, 0x2f, 0xeb, 0x4f, 0x24, 0x27, 
+  0xb0, 0x89, 0xe5, 0x0b, 0x90, 0xd4, 0xf1, 0xc6, 0x08, 0xb2, 0xad, 0x7b, 0x6e, 0xe5, 0x88, 0x14, 
+  0x19, 0x8e, 0xaf, 0xd1, 0x36, 0x09, 0x44, 0x3e, 0x8b, 0x9e, 0xcc, 0xee, 0xbb, 0xa9, 0xca, 0xde, 
+  0xca, 0xdc, 0xd0, 0xdc, 0x5e, 0x72, 0xd3, 0xef, 0xf7, 0x3d, 0xe9, 0x43, 0x7d, 0x5d, 0xfe, 0x96, 
+  0xde, 0xb8, 0x77, 0x9c, 0xea, 0x3b, 0x80, 0xde, 0xf8, 0xe2, 0xfe, 0x37, 0xdf, 0x52, 0x44, 0x71, 
+  0x35, 0x68, 0x5f, 0x91, 0x19, 0xbc, 0xaf, 0x0a, 0x12, 0xcd, 0x15, 0x5a, 0x9a, 0x34, 0xad, 0x6f, 
+  0x2b, 0x2f, 0x2d, 0xb5, 0xe0, 0x5b, 0x17, 0x62, 0xa8, 0x50, 0x74, 0xbd, 0x13, 0x23, 0x0e, 0x37, 
+  0x59, 0xec, 0x0e, 0x9b, 0xde, 0xb6, 0x0a, 0xf2, 0xbf, 0x54, 0x41, 0xd5, 0xa1, 0x31, 0xa3, 0x25, 
+  0x65, 0x5f, 0x11, 0x71, 0xb4, 0xc8, 0x14, 0x04, 0xf7, 0x87, 0xd9, 0x4b, 0x68, 0xff, 0xda, 0xd9, 
+  0xa9, 0xb4, 0x82, 0x9f, 0xeb, 0x9d, 0xa6, 0xa0, 0x49, 0xc1, 0xd7, 0xab, 0xd1, 0x68, 0x23, 0xe8, 
+  0x5d, 0x5b, 0x51, 0x3e, 0xe7, 0xcb, 0x92, 0x33, 0xa0, 0xe7, 0xe5, 0x25, 0x47, 0x93, 0xd6, 0xe9, 
+  0x29, 0xd4, 0x45, 0x5e, 0xae, 0xe2, 0x01, 0xc3, 0xea, 0x9a, 0xf6, 0x3a, 0x4c, 0x3e, 0xfd, 0x3c, 
+  0x7c, 0xf2, 0x22, 0xa6, 0xe0, 0xa4, 0xa1, 0xe1, 0x98, 0x38, 0x3c, 0x6b, 0xf6, 0x1b, 0xc5, 0x0e, 
+  0xca, 0x93, 0x38, 0x94, 0x55, 0xfa, 0xf0, 0xc3, 0x87, 0x1a, 0x5f, 0x01, 0xbd, 0xa8, 0x40, 0x15, 
+  0x68, 0x8a, 0xe9, 0xbc, 0xe2, 0x67, 0xd2, 0x6a, 0x40, 0xbf, 0xae, 0x6a, 0x52, 0x63, 0xd0, 0xc5, 
+  0xf0, 0x04, 0x4d, 0x76, 0xff, 0xad, 0xee, 0xa3, 0x2d, 0xf2, 0xa2, 0xa4, 0x0d, 0xed, 0xfd, 0x6a, 
+  0xe4, 0x83, 0xd7, 0xe1, 0xdd, 0xf1, 0x88, 0x54, 0x3c, 0x3a, 0x2b, 0x95, 0x3d, 0xd8, 0x8d, 0xa9, 
+  0xe8, 0xb6, 0x32, 0xb4, 0x3d, 0xe5, 0xad, 0xca, 0xde, 0xef, 0x5e, 0x94, 0x9d, 0xbb, 0xd5, 0x49, 
+  0x2a, 0xbe, 0x26, 0xfd, 0x6f, 0x09, 0xef, 0x7c, 0xb9, 0x64, 0xb0, 0xa9, 0x17, 0xd1, 0x49, 0x72, 
+  0x9b, 0xa6, 0xf0, 0x97, 0x37, 0xb8, 0x05, 0xbd, 0x39, 0xc5, 0xcc, 0x8e, 0xcd, 0x6b, 0xa8, 0x85, 
+  0x70, 0xb0, 0x09, 0xff, 0xec, 0x40, 0x3e, 0xa1, 0xa4, 0x85, 0xce, 0x85, 0x40, 0x31, 0x16, 0x40, 
+  0x1d, 0x52, 0x3f, 0x08, 0xa2, 0x6a, 0xa9, 0xab, 0x0f, 0x0a, 0x56, 0xe1, 0x5d, 0xae, 0x1a, 0xd0, 
+  0x1e, 0x0a, 0xe0, 0x82, 0x01, 0x2d, 0xe9, 0xe7, 0x6c, 0xe1, 0xc7, 0xdd, 0x2a, 0xba, 0xbf, 0xcc, 
+  0x46, 0x87, 0x72, 0xc1, 0xb9, 0x34, 0x3c, 0x43, 0x97, 0x09, 0xa9, 0x41, 0x43, 0x68, 0x31, 0xaa, 
+  0x08, 0x4e, 0x83, 0x69, 0xc4, 0x49, 0xaa, 0xd2, 0x8e, 0x3e, 0xb6, 0x5d, 0x3e, 0xa5, 0x82, 0xf9, 
+  0xde, 0x56, 0x53, 0xe8, 0x34, 0x05, 0x5d, 0xd8, 0x40, 0x89, 0x4d, 0x7a, 0x0a, 0x5b, 0x3c, 0x3d, 
+  0x71, 0xd6, 0xce, 0x08, 0x0f, 0x2f, 0xe6, 0x5d, 0x48, 0xb9, 0xc9, 0x17, 0x9b, 0x50, 0xb8, 0x4d, 
+  0x70, 0x0e, 0x27, 0x5f, 0x2a, 0xdd, 0x6e, 0x04, 0xd3, 0x2b, 0x7e, 0x9c, 0xab, 0xfe, 0x68, 0x9a, 
+  0xbb, 0x75, 0xe4, 0x0c, 0x9d, 0x1e, 0xb8, 0xbb, 0x4b, 0x7d, 0xb7, 0x4b, 0x24, 0x3f, 0x36, 0x6b, 
+  0x4d, 0xbb, 0xa6, 0xe2, 0x4d, 0x68, 0x5f, 0xd9, 0xf2, 0x14, 0x56, 0x66, 0x56, 0x8a, 0xf1, 0xd2, 
+  0x2a, 0x4f, 0xd2, 0xca, 0x97, 0x1f, 0xb7, 0x09, 0xff, 0x98, 0xc7, 0x65, 0xf8, 0x69, 0xd1, 0x8f, 
+  0x7f, 0xd1, 0xbf, 0x42, 0x2a, 0xb1, 0xa9, 0x70, 0xf0, 0x2f, 0xc2, 0xb2, 0x0b, 0xb9, 0x3d, 0xd5, 
+  0x16, 0x82, 0xe3, 0x06, 0x7c, 0xdb, 0x82, 0x93, 0xe3, 0xe4, 0x9e, 0x45, 0x79, 0xab, 0xd0, 0x1d, 
+  0x2d, 0x74, 0x11, 0x9d, 0x31, 0x2e, 0x49, 0xeb, 0x8c, 0xc8, 0x52, 0xdb, 0xe3, 0x43, 0x6e, 0xa2, 
+  0x35, 0x56, 0x2f, 0xad, 0x06, 0xa5, 0x04, 0x4b, 0xac, 0x76, 0x30, 0xad, 0x48, 0xd4, 0x61, 0x4a, 
+  0xa4, 0x49, 0x91, 0xe4, 0x71, 0x95, 0x00, 0x03, 0x91, 0xcb, 0xa5, 0x8a, 0x65, 0x2a, 0x61, 0xc8, 
+  0xb4, 0x6b, 0xaa, 0x32, 0xf3, 0x5b, 0x0b, 0xba, 0xa2, 0xb8, 0xa8, 0x78, 0x4e, 0xc3, 0xf9, 0x6b, 
+  0xcf, 0x2a, 0x97, 0xbd, 0x52, 0xb8, 0x2b, 0xdb, 0xa3, 0x09, 0x89, 0xa8, 0x61, 0xd5, 0x1e, 0x44, 
+  0x38, 0x4b, 0x22, 0x85, 0x3c, 0xb2, 0x76, 0xab, 0x85, 0xa8, 0x61, 0x64, 0x8d, 0x4f, 0x79, 0x55, 
+  0xaf, 0xd3, 0xa5, 0x46, 0x83, 0xc3, 0x56, 0x79, 0xd2, 0x7f, 0x29, 0x4a, 0x97, 0xcb, 0xf2, 0x3a, 
+  0x5b, 0xd8, 0xdb, 0x37, 0xa8, 0x3b, 0xb7, 0x94, 0xce, 0x2e, 0xaf, 0xea, 0x1b, 0x8d, 0x97, 0x86, 
+  0xe5, 0x63, 0x4b, 0x39, 0x79, 0x99, 0x27, 0x27, 0x0a, 0x9a, 0xf6, 0x24, 0xba, 0x98, 0x6f, 0x29, 
+  0x09, 0x79, 0x5c, 0x01, 0xbf, 0x62, 0x7a, 0x6c, 0x29, 0xb5, 0xca, 0x6a, 0x0d, 0x74, 0x8a, 0x9e, 
+  0xa8, 0xb2, 0x42, 0x6e, 0x38, 0xe1, 0x06, 0xbc, 0xeb, 0xa4, 0x5c, 0xff, 0x63, 0x0e, 0xf8, 0x4a, 
+  0x3b, 0x9a, 0x88, 0x4a, 0x35, 0x46, 0xca, 0xf0, 0x16, 0x83, 0xe5, 0x87, 0xd4, 0xc8, 0x39, 0x7d, 
+  0xf6, 0x3d, 0x8b, 0x31, 0x83, 0x4d, 0x50, 0x83, 0xfd, 0xd8, 0xcd, 0x19, 0x74, 0x6c, 0x6f, 0xbe, 
+  0x07, 0x5c, 0xfc, 0x1d, 0x88, 0x6c, 0x70, 0xae, 0x91, 0x5e, 0x82, 0xcb, 0xf0, 0x3a, 0x94, 0x05, 
+  0x96, 0x97, 0xf4, 0x32, 0x7b, 0x59, 0x56, 0xb2, 0x50, 0x07, 0x6c, 0xdc, 0x19, 0x7c, 0x1b, 0x1b, 
+  0xc9, 0xfa, 0x24, 0xfa, 0x03, 0x76, 0xd5, 0x96, 0x1d, 0x8d, 0xbd, 0xd6, 0x8d, 0x7e, 0xb3, 0xea, 
+  0xb5, 0xaa, 0xfa, 0x2a, 0x0e, 0xdd, 0x2a, 0xa7, 0x60, 0x8e, 0xd8, 0x05, 0x22, 0xa6, 0x4f, 0x16, 
+  0x07, 0x5b, 0x97, 0x8b, 0x10, 0x11, 0xee, 0xb1, 0x8b, 0xec, 0x70, 0x1a, 0xfd, 0x2c, 0x01, 0xb7, 
+  0x35, 0xe3, 0xed, 0x5b, 0x4f, 0x37, 0x02, 0xd8, 0xff, 0x87, 0x56, 0x84, 0xb7, 0xae, 0x82, 0x22, 
+  0x4e, 0x9e, 0xed, 0x2d, 0xdb, 0x73, 0x5a, 0xa6, 0xaa, 0xfa, 0xcf, 0xbe, 0xe1, 0x3d, 0x5f, 0xaf, 
+  0xe7, 0xeb, 0x7c, 0x5a, 0x74, 0xbf, 0xce, 0x40, 0x79, 0xa8, 0x7b, 0xde, 0xaa, 0xc5, 0x59, 0x01, 
+  0xc2, 0x54, 0x1d, 0xe2, 0xa0, 0x53, 0xb8, 0x69, 0x88, 0x72, 0x8c, 0xaa, 0xe8, 0xa9, 0xee, 0xeb, 
+  0xc3, 0x14, 0xc7, 0x4b, 0xc8, 0x10, 0x29, 0xd8, 0x40, 0x07, 0x97, 0x6e, 0x86, 0xe2, 0xe6, 0x01, 
+  0x34, 0xca, 0x7f, 0x30, 0x97, 0x3c, 0xc3, 0xe0, 0x56, 0x0e, 0xd1, 0x7a, 0xd6, 0xf4, 0xd4, 0xea, 
+  0x4b, 0x5a, 0x95, 0x48, 0xc7, 0xd4, 0x80, 0x8a, 0xb4, 0x2a, 0x5a, 0x1b, 0xbc, 0xf1, 0x2a, 0x71, 
+  0x11, 0xe6, 0x75, 0x25, 0xa4, 0x66, 0x3d, 0x50, 0xec, 0x26, 0x5e, 0xb8, 0x86, 0xd1, 0x0a, 0xcf, 
+  0x4c, 0x4c, 0xd4, 0xa5, 0x42, 0xc1, 0x68, 0x31, 0x1f, 0x81, 0xce, 0x61, 0xb5, 0x4a, 0x4f, 0xb3, 
+  0xc4, 0xfb, 0xa5, 0x90, 0x34, 0xd1, 0x72, 0xc0, 0x7d, 0x31, 0x50, 0x7a, 0xcb, 0x2a, 0x7a, 0x5f, 
+  0xe8, 0x7e, 0x91, 0xa8, 0xc8, 0x58, 0x34, 0xd8, 0xf7, 0xc5, 0xa1, 0xdc, 0x2a, 0xd2, 0xa8, 0xaa, 
+  0x07, 0x9c, 0x49, 0xec, 0x4b, 0x7f, 0x17, 0x69, 0x87, 0x94, 0x42, 0x27, 0x78, 0x27, 0x8b, 0x82, 
+  0xd6, 0x58, 0xab, 0xf2, 0x53, 0xbe, 0x90, 0x85, 0xe5, 0x5d, 0xbf, 0xf4, 0x6f, 0x0b, 0xef, 0x3d, 
+  0x54, 0xf3, 0x16, 0xbe, 0xcf, 0xa9, 0x9d, 0xf3, 0xe2, 0x52, 0x51, 0x17, 0x0e, 0xa3, 0xd5, 0x8b, 
+  0x94, 0x73, 0x20, 0xaf, 0x21, 0x89, 0xf7, 0x06, 0xd1, 0xf7, 0xc0, 0x08, 0xfb, 0xc0, 0xa6, 0x05, 
+  0xb6, 0x89, 0xa9, 0xf5, 0xd2, 0x65, 0x63, 0xf2, 0xdb, 0x73, 0x46, 0xe1, 0x2f, 0x70, 0xe0, 0x08, 
+  0x3b, 0x30, 0x5d, 0xce, 0x70, 0x03, 0xe4, 0x40, 0xdf, 0xa8, 0x45, 0xf7, 0x51, 0x07, 0x8c, 0x07, 
+  0xd8, 0xf4, 0x5d, 0x08, 0x40, 0x80, 0xc6, 0xda, 0xc1, 0xb8, 0x84, 0xd0, 0x32, 0x14, 0xe9, 0x61, 
+  0x95, 0xe4, 0xe3, 0x40, 0x6a, 0x71, 0xf9, 0x40, 0x42, 0xe5, 0x58, 0x07, 0x27, 0xf4, 0xb8, 0xe7, 
+  0x31, 0x9b, 0x2f, 0xdc, 0xbe, 0x66, 0x82, 0xa2, 0x22, 0x68, 0x31, 0x89, 0x37, 0x18, 0x14, 0x9c, 
+  0xaf, 0xe0, 0x6e, 0xd9, 0xe3, 0x1c, 0xea, 0xf7, 0x49, 0x54, 0x72, 0x86, 0x29, 0xe2, 0xe9, 0x99, 
+  0xb6, 0xba, 0x79, 0x99, 0xa8, 0xb5, 0x5e, 0x0b, 0xf8, 0x1e, 0x6d, 0xad, 0x88, 0x7a, 0x92, 0xa8, 
+  0x12, 0x7a, 0x40, 0xb4, 0x3a, 0x03, 0xd0, 0x1a, 0x0a, 0x59, 0x20, 0x55, 0x6c, 0x7b, 0x19, 0x9e, 
+  0x28, 0x71, 0xa2, 0x0e, 0x48, 0x3b, 0x97, 0xce, 0x1c, 0xe6, 0x56, 0x23, 0xe7, 0x4c, 0x4b, 0x5c, 
+  0xea, 0x15, 0x2d, 0x0d, 0x57, 0xf4, 0x16, 0xcc, 0xf4, 0x1d, 0xda, 0x68, 0xbc, 0x79, 0x78, 0x23, 
+  0x33, 0x53, 0x84, 0x94, 0xa2, 0x17, 0xfe, 0x0e, 0x9a, 0x18, 0x07, 0x33, 0x9b, 0x99, 0x60, 0xc0, 
+  0x2f, 0x07, 0xc0, 0xa9, 0x59, 0x31, 0x9a, 0x0b, 0xc8, 0x85, 0x68, 0x57, 0xd0, 0xc4, 0x42, 0x91, 
+  0x27, 0xa1, 0xe3, 0xe2, 0x5a, 0xa0, 0xe7, 0xf0, 0x32, 0xc7, 0xa0, 0x2c, 0x8c, 0xf8, 0xfb, 0x22, 
+  0xfa, 0x8c, 0x36, 0x22, 0x95, 0xcd, 0x4e, 0x4a, 0xb7, 0x90, 0xf8, 0xd2, 0x24, 0x6b, 0x62, 0x57, 
+  0x4e, 0xdc, 0xc1, 0x70, 0x95, 0x9c, 0x44, 0x3d, 0x6b, 0xf9, 0xdd, 0xdd, 0x65, 0x88, 0xd4, 0xe3, 
+  0xa7, 0xdd, 0x3c, 0x2b, 0x3f, 0x05, 0x37, 0x37, 0x93, 0x51, 0xc5, 0x57, 0x32, 0x24, 0x4e, 0xd8, 
+  0x11, 0x1a, 0x20, 0xce, 0xe6, 0x9f, 0xfc, 0x0f, 0xa0, 0x26, 0x1b, 0x9e, 0xf0, 0x7c, 0x13, 0x8c, 
+  0xd3, 0x87, 0x0f, 0x17, 0x1c, 0x17, 0x0b, 0x98, 0x65, 0x05, 0x84, 0x24, 0xa3, 0x0e, 0x8d, 0x3a, 
+  0x4b, 0x16, 0x7d, 0xc9, 0x66, 0xdd, 0xa9, 0x73, 0xea, 0x2f, 0x68, 0xf2, 0x30, 0xd8, 0x6b, 0x9f, 
+  0xe4, 0x0a, 0x07, 0xed, 0x26, 0xfc, 0xd4, 0x13, 0x51, 0xa5, 0xa6, 0xea, 0x62, 0x42, 0xf7, 0xc7, 
+  0x69, 0x78, 0x8a, 0xb4, 0x15, 0xbc, 0x78, 0xb2, 0xa5, 0x96, 0x87, 0x0f, 0x4f, 0x7d, 0x2c, 0x6a, 
+  0x60, 0xb1, 0x41, 0x74, 0x6a, 0x5f, 0x39, 0x0e, 0x60, 0xa5, 0xf7, 0xac, 0x92, 0x34, 0x54, 0x69, 
+  0x03, 0xa4, 0xfb, 0x2d, 0x35, 0x00, 0xf3, 0x73, 0xcb, 0x9d, 0x0d, 0x26, 0x6d, 0x31, 0x96, 0xcf, 
+  0xd1, 0x7a, 0xe3, 0xf8, 0xec, 0x35, 0x52, 0x16, 0x1c, 0x65, 0xc3, 0xc0, 0x65, 0xf4, 0x6b, 0x69, 
+  0xfc, 0x9d, 0x9a, 0x43, 0x9b, 0xaf, 0x84, 0x2d, 0xb1, 0x98, 0x9d, 0xe4, 0xf8, 0xb1, 0xb3, 0xaf, 
+  0xf8, 0xb6, 0x4a, 0x7f, 0x19, 0xb6, 0xb3, 0x49, 0x95, 0x39, 0x60, 0x5e, 0x5e, 0xd2, 0x08, 0xcc, 
+  0x78, 0xac, 0x9d, 0x94, 0x90, 0xf4, 0x60, 0x17, 0xd0, 0x83, 0xb2, 0x01, 0x1c, 0xa2, 0xeb, 0x37, 
+  0x83, 0xb3, 0xf4, 0x13, 0xd2, 0x01, 0xe6, 0x37, 0x20, 0x91, 0x6a, 0x32, 0xfc, 0x6f, 0xb0, 0x48, 
+  0x2f, 0xb5, 0x41, 0x6e, 0x00, 0x10, 0x35, 0x86, 0x6d, 0xa2, 0xa5, 0x7a, 0x69, 0x88, 0x26, 0x69, 
+  0xda, 0x2b, 0xf0, 0x3f, 0xb8, 0x1f, 0xb2, 0xf0, 0x7c, 0x1e, 0x17, 0x1b, 0x90, 0x3d, 0x28, 0x0a, 
+  0x78, 0x76, 0x33, 0xac, 0xd5, 0x9b, 0xd5, 0x3d, 0xde, 0xff, 0x2c, 0x3a, 0x9f, 0x33, 0x29, 0x16, 
+  0x87, 0xb9, 0xd2, 0xef, 0x35, 0x47, 0x71, 0xb3, 0x37, 0x85, 0xaa, 0x1c, 0x0b, 0x16, 0x61, 0x92, 
+  0x5b, 0x66, 0x98, 0xa1, 0x22, 0x99, 0xaf, 0x8e, 0xbb, 0x99, 0xb4, 0xea, 0x15, 0x07, 0x8f, 0xbc, 
+  0x51, 0x35, 0xf2, 0x1e, 0xe9, 0x49, 0x39, 0xcb, 0x06, 0x6b, 0x4e, 0xac, 0x05, 0xf0, 0xa2, 0x92, 
+  0x31, 0xf5, 0xfc, 0x5b, 0x29, 0x64, 0xc5, 0x9e, 0xd0, 0x06, 0x9e, 0x7d, 0x58, 0xfb, 0xbb, 0xc1, 
+  0x4b, 0x34, 0x23, 0x41, 0xce, 0x13, 0x7e, 0x0a, 0xcb, 0x88, 0x77, 0x61, 0xa0, 0x75, 0xc3, 0x0a, 
+  0xc9, 0xac, 0x5c, 0xb4, 0xbf, 0x56, 0xe5, 0x72, 0xd5, 0x2c, 0x46, 0x7a, 0xfd, 0xe2, 0x2f, 0xb8, 
+  0x1a, 0x76, 0x80, 0x22, 0x0f, 0xf5, 0x32, 0x61, 0x16, 0x0e, 0xdf, 0x1b, 0xad, 0x46, 0xde, 0x80, 
+  0x46, 0xcd, 0x80, 0xdf, 0x25, 0x18, 0x90, 0xba, 0x3a, 0xa0, 0x86, 0x32, 0x29, 0x1b, 0x07, 0x01, 
+  0xe0, 0x19, 0xf4, 0xbd, 0xf4, 0x33, 0x9a, 0x7b, 0x55, 0x0e, 0x82, 0xb3, 0xca, 0x0c, 0xac, 0x35, 
+  0x4a, 0x7d, 0x7a, 0x6b, 0xc7, 0xa6, 0x1a, 0x69, 0xa8, 0x9e, 0x31, 0x54, 0x55, 0xef, 0x0a, 0xb5, 
+  0x4a, 0x2a, 0x7c, 0xcc, 0x7e, 0xe4, 0x8f, 0xd6, 0x3a, 0x52, 0xf4, 0x75, 0x8e, 0xb3, 0x5c, 0x6c, 
+  0x97, 0x29, 0x1e, 0x59, 0x32, 0x85, 0x6c, 0x60, 0xe6, 0x9b, 0x7a, 0x8f, 0xd0, 0x0f, 0x18, 0x95, 
+  0xf8, 0xf6, 0xa3, 0x47, 0xb6, 0x38, 0xf1, 0xc8, 0x15, 0x27, 0x74, 0x8e, 0xef, 0x6d, 0xef, 0xc6, 
+  0x10, 0xaf, 0xe0, 0xce, 0xb4, 0x84, 0x81, 0x65, 0x8b, 0x5c, 0xd2, 0x0e, 0x8c, 0x79, 0x11, 0xfd, 
+  0x3c, 0xc9, 0x62, 0x91, 0x47, 0x7e, 0xc6, 0xf8, 0x7f, 0x11, 0x2d, 0xe0, 0xcb, 0x90, 0xb5, 0xf6, 
+  0x56, 0x30, 0x4a, 0x60, 0x25, 0xd2, 0x8c, 0x45, 0xf2, 0xfb, 0xf2, 0x0a, 0x08, 0x0e, 0xca, 0x6e, 
+  0xd4, 0x59, 0x05, 0xfa, 0x43, 0xc2, 0x16, 0xbc, 0xba, 0xd1, 0x63, 0x9a, 0xcb, 0x0a, 0xfc, 0x27, 
+  0x6c, 0x63, 0x3e, 0xc8, 0x28, 0x9c, 0x4f, 0x0a, 0x50, 0x04, 0x19, 0x42, 0xa9, 0xc6, 0xac, 0x57, 
+  0x4d, 0xfc, 0x0a, 0x6b, 0x75, 0xc5, 0x6b, 0xb5, 0xa5, 0x0e, 0xad, 0x43, 0x6c, 0xd5, 0xd1, 0x3f, 
+  0x13, 0x80, 0x3b, 0xac, 0xa3, 0x07, 0x62, 0x04, 0xe1, 0x40, 0x16, 0x3a, 0xaa, 0xca, 0xb2, 0x06, 
+  0x75, 0x57, 0x74, 0x41, 0x32, 0x45, 0xc0, 0x67, 0xd2, 0x6b, 0xf8, 0xb2, 0x93, 0x0c, 0x07, 0xcc, 
+  0x00, 0x56, 0x87, 0xc8, 0xa4, 0x58, 0x93, 0x4a, 0x9a, 0x40, 0xf6, 0xc0, 0xa6, 0x4a, 0x95, 0xc2, 
+  0x05, 0xae, 0x4a, 0x6c, 0xf4, 0x3e, 0xba, 0x96, 0x60, 0xcd, 0xde, 0xf4, 0x91, 0x82, 0xe7, 0xf1, 
+  0x2b, 0x56, 0xc2, 0x31, 0x65, 0xb2, 0xcf, 0xc0, 0x3b, 0xb3, 0x03, 0xc7, 0x26, 0xf4, 0x9e, 0xb1, 
+  0xbf, 0xe2, 0x4d, 0x4a, 0xed, 0xf5, 0xb7, 0x37, 0x7d, 0x09, 0x13, 0xa9, 0x0a, 0x06, 0x3f, 0x9a, 
+  0xc1, 0x2f, 0x17, 0xe6, 0xac, 0x44, 0x04, 0x2a, 0x49, 0xc3, 0xf7, 0xe5, 0x65, 0xbb, 0x88, 0x63, 
+  0x5c, 0xa3, 0x38, 0x4c, 0xa2, 0xe7, 0x6e, 0xd8, 0x4e, 0xea, 0x2c, 0xc9, 0x9c, 0xe3, 0xe1, 0xc6, 
+  0xd7, 0x28, 0x60, 0xac, 0x14, 0x51, 0xbe, 0xa9, 0x71, 0x1f, 0xfa, 0x12, 0x1a, 0xce, 0x0f, 0xa4, 
+  0x09, 0xbe, 0x09, 0x24, 0xb6, 0xe6, 0x67, 0x0b, 0x24, 0x4c, 0x99, 0x3a, 0x21, 0x52, 0x29, 0xc4, 
+  0x90, 0xa4, 0xed, 0x95, 0x68, 0xc4, 0x48, 0x3d, 0xe6, 0x24, 0x1f, 0xa0, 0x0e, 0xdb, 0x20, 0x6a, 
+  0xea, 0xe3, 0xe9, 0x8a, 0x60, 0x0d, 0x53, 0xa7, 0x48, 0xc4, 0x92, 0x79, 0x97, 0x35, 0x5f, 0xd8, 
+  0xaf, 0xcd, 0x6f, 0xa1, 0x23, 0x37, 0x60, 0x4c, 0x4d, 0xa1, 0x48, 0x65, 0x01, 0xfa, 0xe6, 0x54, 
+  0x10, 0x72, 0x68, 0x3d, 0x67, 0x44, 0x77, 0xde, 0x46, 0xc6, 0x54, 0x62, 0x67, 0x1d, 0xb7, 0xda, 
+  0x2e, 0xd0, 0x56, 0x2a, 0xe6, 0x52, 0x9a, 0xc4, 0x2f, 0xc3, 0x9d, 0xdf, 0x79, 0x1f, 0x3d, 0xd8, 
+  0x6a, 0xf3, 0xd3, 0x1e, 0xba, 0x59, 0xef, 0xea, 0x23, 0x53, 0xa0, 0xa7, 0xab, 0xd3, 0xf9, 0x96, 
+  0xa4, 0x57, 0x34, 0xa5, 0xfb, 0x1d, 0xa4, 0xfb, 0x79, 0x94, 0x75, 0xc7, 0xa2, 0x40, 0x20, 0xf0, 
+  0x9c, 0xbf, 0xb1, 0xf8, 0x09, 0x8a, 0xe6, 0xf7, 0x18, 0x62, 0x5a, 0x17, 0x45, 0xfa, 0xab, 0xe1, 
+  0x56, 0xfa, 0x11, 0x3b, 0x08, 0xa8, 0xb0, 0x45, 0x40, 0x28, 0x8e, 0xc0, 0x5b, 0xc1, 0xfc, 0xa5, 
+  0x7f, 0x68, 0x70, 0x72, 0xf7, 0xbf, 0x88, 0x5e, 0xa7, 0xdb, 0x02, 0xb4, 0xf6, 0x5b, 0x6c, 0x0a, 
+  0x4a, 0xa6, 0xa6, 0xd1, 0xc9, 0x76, 0xc7, 0x70, 0x09, 0xed, 0x85, 0xb5, 0x67, 0x9a, 0x73, 0xf3, 
+  0x6d, 0xb5, 0x14, 0x09, 0x97, 0xc3, 0x83, 0xe8, 0x0a, 0xa9, 0xa0, 0x05, 0xb2, 0x49, 0x7b, 0x7a, 
+  0x1d, 0xa6, 0xad, 0x60, 0xb2, 0xa2, 0x25, 0x86, 0xd5, 0x16, 0xee, 0x35, 0x96, 0x10, 0x63, 0x25, 
+  0x86, 0x21, 0xe0, 0x30, 0x08, 0x55, 0x1c, 0x2d, 0xaf, 0x60, 0x78, 0xf2, 0x59, 0x1b, 0x66, 0x1b, 
+  0x92, 0x8c, 0x4d, 0x96, 0xfd, 0xad, 0x73, 0x7c, 0x77, 0x47, 0x12, 0x8e, 0x50, 0x7c, 0xa9, 0xa6, 
+  0xff, 0xd2, 0x83, 0xd3, 0x3d, 0x3c, 0x7c, 0xf8, 0xf0, 0x43, 0x74, 0xfe, 0xcf, 0x75, 0x56, 0xdd, 
+  0xd0, 0x74, 0x3f, 0x4c, 0xf4, 0x41, 0x80, 0x04, 0xe1, 0xfb, 0x9f, 0xe0, 0xee, 0xc1, 0x17, 0xa5, 
+  0x64, 0x22, 0x1a, 0xab, 0xcb, 0x80, 0xf5, 0x9f, 0x26, 0x6b, 0x71, 0x20, 0xbb, 0x09, 0xa4, 0x89, 
+  0x9b, 0x72, 0x5d, 0x91, 0x20, 0x41, 0xa3, 0xfc, 0x92, 0xea, 0x5a, 0x8e, 0x07, 0xab, 0x8c, 0x36, 
+  0xe4, 0x45, 0x6f, 0xd9, 0x86, 0x59, 0x15, 0x92, 0x06, 0x3c, 0xb3, 0x1f, 0x0c, 0x92, 0x29, 0x73, 
+  0x53, 0x91, 0xea, 0xe4, 0xbe, 0x67, 0xe1, 0x02, 0xa1, 0x6d, 0xb7, 0x69, 0x28, 0x83, 0x85, 0x88, 
+  0x52, 0xac, 0x28, 0x28, 0x3e, 0x68, 0x03, 0x53, 0xc1, 0x32, 0x89, 0x4d, 0x84, 0x68, 0x46, 0x5f, 
+  0x31, 0x73, 0x2f, 0x68, 0xad, 0xff, 0x1c, 0x2d, 0x78, 0xd3, 0x87, 0x99, 0xc5, 0xae, 0x89, 0x42, 
+  0x98, 0xec, 0x32, 0x99, 0xcd, 0xf1, 0xf9, 0xc6, 0xd1, 0xd1, 0xd5, 0xfe, 0xc6, 0xe6, 0x44, 0x1d, 
+  0x65, 0xec, 0x74, 0xaa, 0xc7, 0x9f, 0xb1, 0xef, 0xca, 0x51, 0xd9, 0x02, 0x18, 0x3e, 0xeb, 0x2b, 
+  0x66, 0x34, 0x98, 0xa3, 0x52, 0x9b, 0x23, 0x5f, 0xa7, 0xfd, 0xd5, 0xe9, 0xeb, 0xaf, 0xe6, 0x26, 
+  0xdc, 0x99, 0x67, 0xfa, 0xcb, 0x92, 0x4d, 0x08, 0x85, 0xae, 0x1e, 0xef, 0xa1, 0xce, 0xbd, 0x99, 
+  0x07, 0xb0, 0xa5, 0x9a, 0x57, 0x5f, 0x39, 0x41, 0x42, 0x8c, 0x17, 0x20, 0xb6, 0x1c, 0x9a, 0x19, 
+  0xb4, 0x77, 0xcc, 0xdb, 0x79, 0x6d, 0x55, 0x30, 0x99, 0x93, 0x6c, 0x12, 0xaf, 0xc6, 0xe9, 0x24, 
+  0x8d, 0xfe, 0x80, 0x0b, 0xc8, 0x27, 0x7d, 0x0a, 0xe7, 0x94, 0x49, 0xe3, 0x1f, 0x01, 0x9f, 0xa6, 
+  0x89, 0xd5, 0x67, 0x4d, 0x13, 0x9e, 0x9a, 0x61, 0x1d, 0xad, 0x6e, 0x8a, 0x39, 0x8d, 0xcd, 0xa2, 
+  0x5c, 0xaf, 0x82, 0xf1, 0x12, 0xb7, 0xdf, 0x72, 0x18, 0x09, 0x73, 0x75, 0x93, 0x9c, 0xbd, 0x58, 
+  0xc4, 0x8c, 0x00, 0xc2, 0x01, 0x6d, 0xa8, 0x3e, 0x44, 0xba, 0x27, 0x3d, 0xb3, 0x1b, 0x89, 0x9f, 
+  0x61, 0x56, 0x32, 0x94, 0xa7, 0xb5, 0x75, 0xf6, 0x17, 0xc4, 0x22, 0xba, 0xf6, 0x3d, 0xb6, 0x5f, 
+  0x16, 0x27, 0xf9, 0xa9, 0x17, 0x4e, 0x8b, 0xa4, 0x72, 0x51, 0x1b, 0xea, 0x09, 0x95, 0x00, 0x7b, 
+  0x9f, 0x31, 0x71, 0xa2, 0x54, 0x58, 0x1f, 0x3b, 0x1b, 0x64, 0x29, 0xee, 0x0e, 0x80, 0x07, 0xf2, 
+  0xea, 0x20, 0x0a, 0x21, 0x4c, 0x4c, 0x18, 0xe2, 0x96, 0x85, 0xc0, 0x38, 0xe2, 0x73, 0xe4, 0xd3, 
+  0x43, 0x63, 0x8a, 0x50, 0x39, 0x52, 0x84, 0xf5, 0xfe, 0xa4, 0xc1, 0x07, 0xf3, 0x48, 0xf6, 0x26, 
+  0x91, 0xb3, 0x1b, 0x34, 0x98, 0x9a, 0x13, 0x41, 0x4a, 0xa5, 0xbf, 0xab, 0x9c, 0xb1, 0xd2, 0xe0, 
+  0x45, 0x14, 0x1a, 0x80, 0xc0, 0xd9, 0xe1, 0x27, 0x15, 0x37, 0x2c, 0xd0, 0x61, 0x6a, 0x2a, 0xe8, 
+  0xa1, 0x69, 0x10, 0x89, 0x10, 0x74, 0x1a, 0x11, 0x19, 0x9c, 0xa6, 0x3a, 0x44, 0x68, 0xd2, 0x15, 
+  0x3b, 0xab, 0x5f, 0x73, 0xfb, 0x5e, 0x7c, 0x06, 0x9a, 0x2b, 0x42, 0xcd, 0xda, 0x2a, 0x98, 0xee, 
+  0x97, 0x81, 0x7a, 0x11, 0x49, 0xbe, 0x64, 0x3e, 0xe1, 0x1b, 0x31, 0x87, 0x31, 0x59, 0x62, 0x5e, 
+  0x7c, 0x2a, 0x2f, 0x58, 0x98, 0x3f, 0x93, 0x9c, 0x4c, 0x50, 0x7e, 0x84, 0x92, 0xa4, 0x79, 0xa3, 
+  0x12, 0x8b, 0x71, 0x59, 0xdd, 0x61, 0x8d, 0x88, 0xe5, 0x4d, 0xa4, 0x23, 0xac, 0xad, 0xf6, 0xf2, 
+  0xb1, 0x7a, 0x2b, 0x15, 0x93, 0xc4, 0xda, 0xea, 0x2d, 0x4b, 0xa0, 0xc9, 0x56, 0x4e, 0xa6, 0x65, 
+  0x37, 0x39, 0x73, 0xb2, 0x44, 0xc0, 0xec, 0x6a, 0x4c, 0x9b, 0x6b, 0xb4, 0x58, 0x4c, 0x3a, 0x3a, 
+  0x50, 0xed, 0x73, 0x86, 0xac, 0x1a, 0x8e, 0xf8, 0xcc, 0xdd, 0x11, 0xd6, 0x2d, 0xa3, 0x91, 0x08, 
+  0x1f, 0xb8, 0x50, 0xa6, 0x6a, 0x10, 0x2f, 0x59, 0xf8, 0xfd, 0x69, 0x16, 0xaf, 0xb1, 0xa2, 0x98, 
+  0x51, 0x20, 0xca, 0xb6, 0xca, 0x55, 0xe0, 0x6e, 0xe5, 0xb5, 0xe1, 0x34, 0x68, 0x9f, 0xc5, 0x4e, 
+  0xca, 0x57, 0xf0, 0xa3, 0x7b, 0x95, 0x13, 0x1a, 0x9f, 0xa5, 0x80, 0x4d, 0x7e, 0x6e, 0x5a, 0x25, 
+  0xe5, 0x1f, 0xcc, 0xdc, 0x49, 0xef, 0xc6, 0x1f, 0x6d, 0x8b, 0x5b, 0x55, 0xe8, 0xd7, 0xb1, 0xb5, 
+  0x9b, 0x17, 0x70, 0x9d, 0xb1, 0x75, 0x56, 0x82, 0x38, 0x0d, 0x87, 0x69, 0xa7, 0x90, 0x44, 0xca, 
+  0xe8, 0x52, 0xa2, 0x2b, 0x78, 0xb1, 0x78, 0x68, 0x59, 0x7b, 0x84, 0xe4, 0x65, 0x0b, 0x0a, 0xd7, 
+  0x69, 0x73, 0xa1, 0x8f, 0xc8, 0xa2, 0x29, 0x63, 0x5d, 0xeb, 0x0d, 0x8a, 0xf8, 0x10, 0x69, 0x7a, 
+  0x09, 0x4d, 0x10, 0x31, 0x71, 0xf4, 0x9d, 0xf6, 0xd5, 0x98, 0x19, 0x50, 0x1c, 0xf9, 0xa2, 0xc7, 
+  0xc2, 0xd7, 0x43, 0x8d, 0x5c, 0x91, 0xc4, 0x9d, 0x57, 0x34, 0xaf, 0xb0, 0xdf, 0xe9, 0x03, 0xdf, 
+  0x3e, 0x0a, 0xfc, 0xa9, 0x29, 0x06, 0xf7, 0x71, 0x9c, 0xf9, 0xde, 0x2f, 0x2b, 0x1a, 0xeb, 0xea, 
+  0x9c, 0xb0, 0x8d, 0x16, 0xe5, 0xe0, 0xc9, 0xe1, 0x73, 0x35, 0x99, 0x80, 0x8f, 0x8c, 0x49, 0xc8, 
+  0x94, 0xdb, 0x71, 0xc1, 0x66, 0xc9, 0xc6, 0xf8, 0xdb, 0x63, 0x94, 0x35, 0x2a, 0x66, 0x67, 0x76, 
+  0x3e, 0x62, 0x93, 0xf4, 0x23, 0x36, 0x45, 0x07, 0x1b, 0x41, 0x76, 0x57, 0x93, 0xc5, 0xd0, 0xf8, 
+  0xf5, 0x88, 0x1b, 0xad, 0xf8, 0x8b, 0x57, 0xc5, 0x27, 0x84, 0xe7, 0x40, 0x1d, 0xa7, 0x05, 0x73, 
+  0x5d, 0x71, 0x1e, 0x2d, 0x12, 0x1f, 0xb8, 0x5a, 0x61, 0xd2, 0x3a, 0x8d, 0xae, 0x67, 0x1d, 0xb4, 
+  0xc5, 0xa6, 0x21, 0x1c, 0xc9, 0x85, 0x17, 0xd3, 0xd4, 0x0f, 0xfa, 0xe9, 0x0c, 0x1d, 0x50, 0x70, 
+  0x32, 0x83, 0xcc, 0x89, 0xeb, 0x59, 0x2f, 0x92, 0x65, 0x77, 0x02, 0x4b, 0xf1, 0xb5, 0x9b, 0x7a, 
+  0xa4, 0x26, 0x1a, 0x27, 0x5d, 0xcb, 0xb8, 0x37, 0x25, 0xe7, 0x73, 0x5e, 0x1f, 0x64, 0xd5, 0x6f, 
+  0xe7, 0x68, 0xf6, 0xa5, 0x6f, 0x4f, 0x50, 0x4b, 0xac, 0xf0, 0xce, 0x9d, 0xdd, 0xa0, 0x9f, 0xb6, 
+  0x3b, 0xc1, 0xc7, 0x19, 0xaf, 0xb1, 0x85, 0x3a, 0xfb, 0xc4, 0xb0, 0xeb, 0x30, 0x71, 0xc0, 0x2e, 
+  0x39, 0x2a, 0x06, 0xd8, 0xc2, 0x60, 0x5c, 0x90, 0x05, 0x9f, 0x16, 0xb5, 0x34, 0x01, 0xbe, 0x07, 
+  0xe2, 0x79, 0x64, 0xea, 0x70, 0x5c, 0x0d, 0xa4, 0xb1, 0x43, 0x08, 0x63, 0xe1, 0x6a, 0x82, 0x71, 
+  0xb9, 0x6a, 0x69, 0x6c, 0xa7, 0xd1, 0x4f, 0x33, 0xd9, 0xb9, 0x8e, 0xf4, 0x8c, 0x0b, 0xa7, 0xf4, 
+  0xd4, 0xd6, 0xc6, 0x65, 0x2a, 0x25, 0xc9, 0x17, 0xf8, 0x93, 0x58, 0xb9, 0x72, 0xc8, 0xfa, 0x5c, 
+  0x69, 0xb1, 0xb5, 0xd2, 0x5f, 0xf5, 0xe3, 0x7b, 0x6b, 0x9d, 0xce, 0x8f, 0xdd, 0xfa, 0x36, 0x70, 
+  0xd0, 0x84, 0x1a, 0x65, 0xdc, 0x6e, 0x55, 0x5f, 0xca, 0x7f, 0x96, 0x30, 0xfb, 0x56, 0x77, 0x96, 
+  0x05, 0x85, 0xaf, 0xd9, 0x63, 0x82, 0xc6, 0x9d, 0x5d, 0x77, 0x33, 0x7b, 0x0a, 0xc3, 0x3b, 0xc3, 
+  0xab, 0x0c, 0x95, 0x2e, 0x14, 0x03, 0xb3, 0xb3, 0x9e, 0x58, 0x75, 0x44, 0xca, 0xfa, 0x13, 0x30, 
+  0x95, 0x9c, 0x39, 0x0c, 0x3f, 0x44, 0xcc, 0x68, 0x2f, 0x47, 0x13, 0xe7, 0x51, 0xd6, 0x85, 0x98, 
+  0xd1, 0x79, 0x6a, 0x21, 0x23, 0x93, 0xd8, 0x61, 0x9b, 0x50, 0xc4, 0xcf, 0x9d, 0x06, 0xf7, 0xbc, 
+  0x98, 0x1a, 0x37, 0x1f, 0x2d, 0x76, 0xb3, 0xa7, 0x37, 0xaf, 0xe0, 0x88, 0x18, 0x57, 0x13, 0xdc, 
+  0x5f, 0x05, 0xbc, 0x60, 0xd8, 0x01, 0x50, 0xaa, 0x89, 0x16, 0xbf, 0x8a, 0x26, 0xaa, 0xc7, 0xca, 
+  0x22, 0x71, 0x8a, 0xa6, 0x10, 0x9e, 0xc4, 0x7e, 0x29, 0xd5, 0x0c, 0xab, 0x88, 0x1e, 0x02, 0x96, 
+  0xf3, 0x4a, 0x7d, 0x24, 0xf3, 0x95, 0x3b, 0x5f, 0xa9, 0x45, 0xa5, 0x82, 0x91, 0xec, 0x80, 0xb2, 
+  0x34, 0x1a, 0x6b, 0x50, 0xf5, 0xe1, 0x96, 0x41, 0x3c, 0x64, 0x3d, 0xdb, 0xea, 0x95, 0x9e, 0x9b, 
+  0x69, 0x20, 0x31, 0x39, 0xf5, 0xfc, 0xd8, 0x2a, 0xa7, 0x3f, 0x81, 0xc7, 0x80, 0x0b, 0xb7, 0x1a, 
+  0x6d, 0x44, 0x9f, 0x1e, 0x57, 0x7e, 0x0f, 0xbd, 0xe1, 0x46, 0xba, 0xc6, 0x33, 0xf3, 0x86, 0xef, 
+  0x9e, 0x48, 0x44, 0x4b, 0x33, 0x99, 0xaa, 0x20, 0xae, 0x9b, 0x9e, 0x31, 0xe7, 0x9b, 0xae, 0x41, 
+  0x5e, 0x57, 0x6a, 0x98, 0x98, 0x37, 0x8a, 0x96, 0xd8, 0x13, 0x0d, 0xbb, 0x99, 0x15, 0xe3, 0xf6, 
+  0x8e, 0xac, 0x57, 0x39, 0xd9, 0x84, 0xf5, 0x51, 0x77, 0xe7, 0xce, 0x57, 0x3f, 0x37, 0xeb, 0xa1, 
+  0x5a, 0x06, 0xbb, 0xa5, 0xd6, 0x85, 0x5b, 0xdf, 0x7a, 0xd1, 0x2d, 0xa3, 0xdc, 0xb8, 0x22, 0xbf, 
+  0x79, 0x6a, 0xe1, 0x0b, 0x6c, 0x69, 0x43, 0xec, 0x3e, 0xf6, 0x85, 0x17, 0xf3, 0xa4, 0x68, 0x49, 
+  0x07, 0xf7, 0xb8, 0xf8, 0x93, 0xae, 0x81, 0x5b, 0x8b, 0x0d, 0xd6, 0x56, 0x50, 0xc3, 0x2e, 0x05, 
+  0x33, 0x7e, 0x6d, 0xa2, 0xdc, 0xbd, 0x1d, 0x04, 0x0f, 0x78, 0x53, 0x95, 0xed, 0x85, 0x89, 0xa4, 
+  0xba, 0x5c, 0x8d, 0xfd, 0x63, 0x1a, 0x03, 0x1e, 0xed, 0x14, 0x02, 0xb7, 0x02, 0x76, 0x34, 0x58, 
+  0xcd, 0xd4, 0xfc, 0xc2, 0xe4, 0x32, 0xe2, 0x82, 0xda, 0x2b, 0x7e, 0x9e, 0xf5, 0x58, 0x96, 0xb6, 
+  0xc4, 0xcc, 0x88, 0xdc, 0xbd, 0x2d, 0x6c, 0xa1, 0xe6, 0xb6, 0xe7, 0x02, 0xc9, 0xce, 0xa8, 0x96, 
+  0x88, 0x2c, 0x36, 0xfd, 0xea, 0x6c, 0x6b, 0x8f, 0x9e, 0x39, 0x16, 0xe6, 0x41, 0xd3, 0xfd, 0x9e, 
+  0xb1, 0xe3, 0x62, 0xab, 0x1e, 0xcc, 0x49, 0x26, 0x2e, 0x2f, 0xcd, 0x64, 0xe4, 0xd8, 0x20, 0xe1, 
+  0x0e, 0x37, 0x77, 0x3c, 0x12, 0xc1, 0x9f, 0x56, 0x7c, 0xd0, 0x3c, 0xc7, 0x79, 0x28, 0x0c, 0xde, 
+  0xb1, 0x65, 0x1c, 0xd5, 0x44, 0x97, 0x45, 0xcb, 0xa9, 0x2f, 0x25, 0x3d, 0xc3, 0x97, 0x98, 0xf6, 
+  0x86, 0x20, 0xc8, 0x96, 0xd3, 0x0d, 0x41, 0x08, 0x9d, 0x10, 0x69, 0xa1, 0x5a, 0xa9, 0x34, 0xff, 
+  0xd7, 0x8b, 0xb4, 0xe5, 0xc7, 0x30, 0x12, 0x18, 0x7c, 0xbc, 0xda, 0xc6, 0x5d, 0x60, 0x9d, 0x0f, 
+  0xbb, 0xe5, 0x1b, 0x88, 0x46, 0x86, 0xdf, 0x33, 0xd0, 0x12, 0x30, 0x56, 0x72, 0xbe, 0xab, 0xf0, 
+  0x6b, 0xf4, 0xfb, 0xb7, 0xe6, 0x7e, 0x8d, 0xd4, 0x6b, 0xc5, 0xbd, 0xa1, 0xc2, 0x95, 0x2d, 0x6c, 
+  0x38, 0xc8, 0x3a, 0x7e, 0xc0, 0x9b, 0x3a, 0xb7, 0x20, 0xce, 0x48, 0x89, 0x69, 0x30, 0xfa, 0x5b, 
+  0x9b, 0xb8, 0x07, 0x1b, 0x1b, 0xe7, 0x83, 0x57, 0x6c, 0x6e, 0x83, 0x35, 0xb7, 0xd2, 0x76, 0x73, 
+  0x9c, 0x88, 0x6f, 0x11, 0x59, 0xc4, 0xb3, 0x7a, 0x9c, 0x35, 0xdf, 0x3b, 0xa9, 0x26, 0xdd, 0xe6, 
+  0x95, 0x9b, 0xb8, 0xdc, 0x34, 0x34, 0x92, 0xca, 0xee, 0x53, 0x03, 0x82, 0x4c, 0x3c, 0xf9, 0x63, 
+  0x19, 0xb6, 0xdf, 0x31, 0x4b, 0xa6, 0x25, 0x60, 0x71, 0xaf, 0x36, 0xc7, 0x7d, 0x3d, 0xdb, 0x26, 
+  0x9e, 0xc1, 0x52, 0xb3, 0x05, 0xaa, 0x0e, 0x6c, 0xdf, 0x52, 0xb8, 0x2d, 0xc6, 0x22, 0x72, 0x7f, 
+  0xdb, 0xb5, 0xb0, 0x0b, 0x66, 0x93, 0x54, 0xca, 0xbc, 0x87, 0x15, 0xc0, 0x46, 0xb3, 0xe9, 0x85, 
+  0xb2, 0xa9, 0x3b, 0x2d, 0x34, 0x5f, 0x16, 0x24, 0x18, 0x54, 0xd5, 0x4f, 0xc9, 0x1e, 0xe7, 0x8c, 
+  0x35, 0xbd, 0x78, 0x0b, 0x1d, 0xa4, 0xf9, 0xd0, 0xcb, 0x50, 0x46, 0xe3, 0x89, 0x25, 0x00, 0x5d, 
+  0x19, 0x43, 0xff, 0x02, 0xde, 0x55, 0x95, 0x84, 0x3d, 0xde, 0x82, 0xbe, 0x2b, 0xae, 0x5a, 0x5a, 
+  0xf6, 0xce, 0x12, 0x71, 0xc0, 0xb2, 0xbc, 0xb4, 0x08, 0xcf, 0xc2, 0x4f, 0x8a, 0x0c, 0xaf, 0x15, 
+  0x57, 0xba, 0x0c, 0x1c, 0xe0, 0x4b, 0x36, 0x73, 0x2f, 0x43, 0x4e, 0xfa, 0xbe, 0x6c, 0x7b, 0xbc, 
+  0x56, 0xe1, 0x3a, 0xcc, 0x92, 0x66, 0x10, 0x8e, 0xfb, 0x36, 0xed, 0x6c, 0xb2, 0x02, 0xcc, 0xd6, 
+  0x4a, 0x7b, 0x23, 0x98, 0x9e, 0x1d, 0x04, 0xf7, 0xfa, 0x58, 0xa6, 0x65, 0x10, 0x84, 0xc3, 0x16, 
+  0x60, 0xd1, 0x4f, 0x65, 0x33, 0xed, 0x07, 0xb8, 0x6b, 0x60, 0x92, 0x18, 0x3d, 0x4d, 0x74, 0x7f, 
+  0x96, 0x8c, 0x46, 0x3f, 0x8d, 0xd5, 0x42, 0xe5, 0xaf, 0xda, 0xfe, 0xd1, 0x33, 0x5a, 0xd7, 0xe6, 
+  0xfc, 0x0b, 0xc0, 0xa7, 0xc3, 0x96, 0x6d, 0x4f, 0xef, 0x5f, 0x73, 0x5b, 0xfc, 0x5f, 0x91, 0xf8, 
+  0x4f, 0xd5, 0x0f, 0x7b, 0x04, 0xae, 0xa1, 0x50, 0xf8, 0x29, 0x39, 0x60, 0xab, 0xe8, 0xae, 0xb2, 
+  0x30, 0x06, 0x34, 0x26, 0xa0, 0xa7, 0x18, 0x55, 0x8e, 0xf6, 0xe6, 0x44, 0xa9, 0x64, 0xac, 0x8b, 
+  0x22, 0x60, 0x8d, 0x97, 0xab, 0x8d, 0x8f, 0x00, 0x8f, 0xa5, 0x61, 0xbd, 0xab, 0x92, 0x65, 0x98, 
+  0x27, 0x9f, 0xc2, 0x32, 0x59, 0x87, 0x7e, 0x8a, 0x68, 0xaa, 0x2c, 0x88, 0x5a, 0x5b, 0x67, 0x30, 
+  0x51, 0x91, 0x19, 0x30, 0x3a, 0xdd, 0xaa, 0x15, 0x33, 0xae, 0x8c, 0x93, 0x49, 0xe2, 0x90, 0x73, 
+  0x18, 0x5b, 0xf0, 0xdc, 0x93, 0x3e, 0xe3, 0x76, 0x1d, 0x32, 0x12, 0xce, 0x5e, 0xe8, 0x92, 0x88, 
+  0x3c, 0x68, 0xc6, 0x23, 0x7b, 0x0f, 0xcc, 0xe1, 0x91, 0x5d, 0x77, 0xf2, 0x89, 0x26, 0xd6, 0x22, 
+  0xa9, 0xd9, 0x26, 0xe7, 0xa3, 0xf9, 0x0d, 0x0f, 0x16, 0xec, 0x60, 0x1b, 0xcb, 0xb9, 0xb7, 0xa4, 
+  0xa2, 0xb7, 0xdb, 0xfd, 0x9f, 0x58, 0x4c, 0x39, 0x3e, 0x0f, 0x1e, 0x5c, 0x6b, 0x36, 0x0c, 0x85, 
+  0x36, 0xe1, 0x49, 0x72, 0xcb, 0x34, 0x56, 0xb1, 0xc7, 0x7f, 0xb0, 0x0b, 0x79, 0x21, 0xcd, 0xbe, 
+  0xd8, 0x03, 0x75, 0x22, 0x8c, 0x74, 0xd0, 0xcf, 0x16, 0x11, 0x88, 0xb0, 0x92, 0x5b, 0x71, 0x15, 
+  0xb7, 0x98, 0x79, 0x9a, 0x5d, 0x97, 0x46, 0x1c, 0x08, 0x00, 0xef, 0x6e, 0x37, 0x0a, 0xcb, 0xa3, 
+  0xee, 0xc5, 0xe9, 0x18, 0x62, 0x47, 0xb4, 0xc9, 0x1d, 0x4d, 0x76, 0x7f, 0xad, 0x12, 0x1f, 0xe1, 
+  0xb0, 0xaf, 0x54, 0xc4, 0x75, 0xb3, 0xc9, 0x28, 0xef, 0x90, 0xda, 0x8a, 0xb1, 0x3a, 0x3c, 0x99, 
+  0xd0, 0xf6, 0xf8, 0x04, 0xea, 0x55, 0x31, 0xe9, 0x2b, 0x1f, 0x57, 0xac, 0xcb, 0x91, 0xde, 0x0a, 
+  0x3c, 0xb1, 0x95, 0xbd, 0x63, 0x65, 0xa1, 0x4b, 0x18, 0xe9, 0x61, 0x12, 0x28, 0xec, 0x4f, 0x3c, 
+  0xe5, 0x13, 0x78, 0x5a, 0x8a, 0x89, 0xe7, 0xc5, 0x4e, 0xb9, 0x8d, 0x20, 0xca, 0x82, 0xdb, 0x32, 
+  0x9b, 0x5f, 0x64, 0x8b, 0xe4, 0x96, 0x63, 0x07, 0xe2, 0xa9, 0x4a, 0x06, 0x0e, 0x3d, 0xf4, 0x94, 
+  0x77, 0x1c, 0xba, 0x8b, 0x0d, 0x7f, 0xb5, 0x16, 0x59, 0x9b, 0xb6, 0xb1, 0xa9, 0x9a, 0x80, 0xb8, 
+  0x39, 0x59, 0x01, 0x02, 0x68, 0x2c, 0x84, 0x01, 0x8c, 0x65, 0xcf, 0x1e, 0xb5, 0xe1, 0xfa, 0xee, 
+  0x2e, 0x0b, 0x9a, 0x18, 0x07, 0x18, 0x87, 0xc4, 0xf9, 0x3d, 0xd7, 0x52, 0xfb, 0x72, 0x52, 0x60, 
+  0x7f, 0x8b, 0x8b, 0xf1, 0x09, 0x0c, 0xee, 0x13, 0xb8, 0xc5, 0x85, 0x51, 0x13, 0xbe, 0x01, 0x41, 
+  0x76, 0x37, 0x87, 0x27, 0xcc, 0x51, 0x1d, 0x9e, 0x24, 0xb5, 0xf8, 0x0f, 0x54, 0x19, 0xea, 0xdf, 
+  0x25, 0x5e, 0xfe, 0xb9, 0xc4, 0xdd, 0x16, 0xc8, 0xaa, 0x51, 0xf1, 0xe5, 0x67, 0xd1, 0xdf, 0x31, 
+  0x9d, 0xd2, 0xd0, 0x53, 0xad, 0xf5, 0x94, 0xed, 0x7c, 0x23, 0xfc, 0x26, 0x40, 0x7a, 0xe8, 0x11, 
+  0x79, 0x53, 0xac, 0xdd, 0xbe, 0xbe, 0x47, 0x61, 0xeb, 0x4f, 0xe4, 0xbb, 0xa7, 0x92, 0xdd, 0xe3, 
+  0x5e, 0x0b, 0x62, 0x75, 0xcb, 0xa7, 0xbe, 0xb2, 0x9f, 0x74, 0xa1, 0x5c, 0x65, 0x3d, 0x23, 0xd6, 
+  0x41, 0x6a, 0x98, 0x95, 0x9f, 0x3d, 0x04, 0x2d, 0x70, 0xcc, 0xe9, 0x3a, 0xf1, 0xaa, 0x74, 0x91, 
+  0x97, 0xe6, 0x0c, 0x5b, 0xe8, 0xef, 0xee, 0xd6, 0x06, 0x29, 0xc6, 0x07, 0xbf, 0xaf, 0x02, 0x31, 
+  0x9a, 0xd3, 0xdb, 0xb6, 0xb5, 0xb7, 0x70, 0x99, 0x0c, 0xfd, 0xb9, 0x26, 0x5a, 0xc4, 0x5f, 0x01, 
+  0xcf, 0x44, 0xa7, 0xcd, 0xf9, 0x2b, 0x9d, 0x87, 0x57, 0x48, 0x58, 0x9c, 0x8f, 0xd7, 0x0f, 0x1f, 
+  0x0e, 0x73, 0x5e, 0x78, 0x51, 0xdd, 0x82, 0xe4, 0xe2, 0xfc, 0xe3, 0x3a, 0xc3, 0x44, 0xe2, 0x28, 
+  0x0b, 0xfa, 0xf4, 0xbd, 0xc0, 0xca, 0xa1, 0x2b, 0xbe, 0xe4, 0x4a, 0x78, 0xf9, 0x48, 0xe5, 0x3d, 
+  0x84, 0x85, 0x5c, 0x78, 0x61, 0xd6, 0xbb, 0x31, 0xe8, 0x4d, 0x81, 0x49, 0x62, 0xcc, 0xe8, 0xa1, 
+  0x56, 0x99, 0x04, 0x3a, 0xa6, 0x77, 0x01, 0x72, 0x73, 0x16, 0xaf, 0x38, 0xa7, 0x2a, 0x73, 0x42, 
+  0x01, 0x68, 0x97, 0x3d, 0x97, 0x25, 0x01, 0xd9, 0x43, 0xa6, 0x82, 0xe1, 0x9e, 0x3d, 0xae, 0x85, 
+  0x9e, 0xb1, 0x33, 0xe1, 0x95, 0xdf, 0x50, 0xf2, 0x89, 0x2d, 0x09, 0x49, 0xcd, 0x89, 0xd5, 0xaa, 
+  0x7b, 0x4b, 0xd1, 0xb7, 0x46, 0x8c, 0x9b, 0x5c, 0xe5, 0x2e, 0x00, 0x70, 0x2d, 0x9f, 0xbd, 0xbb, 
+  0x7c, 0x34, 0x4b, 0x06, 0xf7, 0xd5, 0x89, 0x8a, 0x52, 0x85, 0x82, 0xaf, 0x97, 0x93, 0x99, 0xaf, 
+  0x45, 0x4d, 0x0e, 0xed, 0xb4, 0x0a, 0x16, 0x2a, 0x5d, 0x9c, 0x1a, 0xc9, 0x2f, 0x87, 0x39, 0xd0, 
+  0x39, 0xc9, 0x4b, 0xae, 0xba, 0x81, 0x07, 0xb8, 0x7e, 0x35, 0xa1, 0xfe, 0xda, 0xd2, 0x21, 0x0d, 
+  0xe8, 0x82, 0xda, 0xab, 0x0b, 0x48, 0x07, 0x24, 0x3d, 0x30, 0x5d, 0xd8, 0x24, 0xeb, 0xac, 0x4c, 
+  0x9e, 0xbe, 0xe6, 0xf1, 0xd2, 0xd4, 0x94, 0x65, 0x26, 0x0f, 0x7d, 0xa0, 0xa8, 0x74, 0xf0, 0x78, 
+  0x75, 0x6a, 0xcb, 0xf3, 0x9b, 0x06, 0xaa, 0x60, 0x1e, 0x3f, 0xeb, 0x19, 0x74, 0xd6, 0xe7, 0x32, 
+  0x6f, 0xf5, 0xa9, 0x47, 0x30, 0x42, 0x6c, 0x1e, 0x07, 0x13, 0xe8, 0xcf, 0x56, 0xfa, 0x5b, 0xd6, 
+  0xf4, 0xbc, 0xc7, 0x0c, 0x99, 0xcb, 0xa4, 0xfa, 0x48, 0xd5, 0xe4, 0x61, 0x1f, 0x23, 0x1a, 0xd5, 
+  0x06, 0x38, 0x79, 0x0e, 0xe9, 0x33, 0xb1, 0xba, 0x95, 0x66, 0x0f, 0x6e, 0x90, 0xae, 0x57, 0x89, 
+  0x8a, 0x6e, 0x08, 0x2b, 0xe3, 0x24, 0x5f, 0x31, 0x3f, 0xa1, 0x12, 0x45, 0x57, 0xf0, 0x8f, 0x6b, 
+  0x8c, 0x32, 0xe6, 0x86, 0x13, 0x3c, 0xa3, 0xab, 0x8a, 0x5f, 0xeb, 0xb9, 0xe8, 0x9e, 0x93, 0xf6, 
+  0x09, 0xac, 0xb0, 0x91, 0x74, 0x89, 0x7c, 0x72, 0x44, 0x5f, 0xf3, 0x96, 0x24, 0xab, 0x4c, 0x3e, 
+  0xf2, 0x9e, 0xae, 0x67, 0x40, 0xfa, 0x91, 0xa4, 0x7b, 0x61, 0x68, 0x93, 0x53, 0x82, 0x29, 0x40, 
+  0x7a, 0xd4, 0x15, 0xa4, 0xd1, 0xf4, 0x54, 0xc1, 0x64, 0x76, 0x4e, 0xf1, 0x94, 0x68, 0xba, 0x19, 
+  0x89, 0x06, 0xe9, 0xfc, 0x2c, 0xb9, 0xbd, 0xb4, 0x72, 0x2f, 0x8a, 0xbe, 0xa0, 0x3c, 0x45, 0xfa, 
+  0xe4, 0x07, 0x2a, 0xc2, 0xe4, 0xe9, 0xcc, 0x16, 0x6d, 0x69, 0xb2, 0x28, 0x20, 0x83, 0x06, 0x5a, 
+  0xde, 0xa4, 0x7b, 0xeb, 0x80, 0x94, 0xf0, 0x56, 0x3d, 0x8e, 0x36, 0x2e, 0xee, 0xbe, 0x74, 0x45, 
+  0xbf, 0xd2, 0x15, 0xed, 0x48, 0xf3, 0xe5, 0x7a, 0x91, 0x3d, 0x17, 0x24, 0xf7, 0x6c, 0x11, 0x43, 
+  0x19, 0x76, 0x4f, 0x85, 0xbc, 0x99, 0x3d, 0x59, 0xe0, 0x9a, 0xfe, 0x19, 0x0a, 0x9e, 0x93, 0xe0, 
+  0x9c, 0xd2, 0x79, 0xfb, 0x50, 0xca, 0xff, 0xcc, 0xec, 0x6f, 0xfa, 0x16, 0x39, 0x52, 0x77, 0x1d, 
+  0xda, 0xf7, 0x1c, 0x9a, 0x3b, 0xd4, 0x69, 0xf3, 0xdb, 0x48, 0x56, 0x2f, 0x8a, 0xd3, 0xbc, 0x80, 
+  0xa6, 0xf5, 0x7b, 0xf4, 0x69, 0x46, 0xd3, 0xda, 0xbc, 0xcb, 0xb6, 0x22, 0x9b, 0x4d, 0xd8, 0x1e, 
+  0xbd, 0xb5, 0x1d, 0xe0, 0x63, 0x24, 0x4a, 0x59, 0x8c, 0x33, 0xfb, 0x7b, 0x44, 0x97, 0x73, 0x01, 
+  0x39, 0xe9, 0x99, 0x54, 0xda, 0x49, 0xd6, 0x57, 0x93, 0x99, 0x63, 0x9d, 0xba, 0xb4, 0x67, 0x68, 
+  0xa3, 0xd2, 0x46, 0xcd, 0x97, 0x67, 0x62, 0x3b, 0x96, 0xc0, 0xcc, 0x19, 0x59, 0x6e, 0x69, 0xb3, 
+  0x3b, 0x21, 0xe5, 0x68, 0xd5, 0x9e, 0x84, 0x0a, 0x1e, 0xc9, 0x12, 0x18, 0xa0, 0x9e, 0xc9, 0x6a, 
+  0xa5, 0xef, 0x61, 0xf8, 0x55, 0x9a, 0x7c, 0x5a, 0x96, 0x43, 0xd2, 0xb5, 0x43, 0x67, 0xcd, 0x3a, 
+  0x43, 0xca, 0x90, 0x51, 0x4a, 0x51, 0x82, 0xc5, 0xc9, 0xa4, 0x77, 0x0b, 0xcb, 0x20, 0x7d, 0x06, 
+  0xbb, 0x44, 0x13, 0x28, 0x86, 0x4b, 0x70, 0x96, 0x6f, 0x68, 0x40, 0x22, 0x31, 0x77, 0x03, 0xe4, 
+  0x20, 0x86, 0x74, 0x80, 0x30, 0x50, 0xd3, 0x2a, 0xe1, 0xe9, 0x96, 0xd0, 0x5e, 0xc5, 0x12, 0x46, 
+  0xab, 0x81, 0xaf, 0x53, 0x45, 0xa8, 0x83, 0x8c, 0xcc, 0x6d, 0x6d, 0xdf, 0xdf, 0xe8, 0xb8, 0xc4, 
+  0x26, 0xb4, 0x01, 0x75, 0x15, 0xee, 0x99, 0x7d, 0x09, 0xd8, 0xf8, 0x48, 0x3d, 0xe3, 0xa9, 0x67, 
+  0xd6, 0x7a, 0xcb, 0xd4, 0xa7, 0xf2, 0xc2, 0x3d, 0x39, 0x5b, 0xae, 0x2b, 0x2f, 0x2c, 0xda, 0xc5, 
+  0xca, 0x75, 0xed, 0x31, 0x98, 0xce, 0x3d, 0x8b, 0xf9, 0xd0, 0x5a, 0x2e, 0xc7, 0x59, 0x7f, 0xdb, 
+  0xb1, 0x70, 0x6f, 0x79, 0xdf, 0x04, 0xc0, 0xc7, 0x7e, 0x41, 0x8b, 0x0f, 0x5f, 0xe0, 0x35, 0x07, 
+  0xad, 0x81, 0xa2, 0xc4, 0x0b, 0x46, 0xff, 0x7d, 0xb8, 0xe2, 0x7c, 0x41, 0xfe, 0x00, 0xba, 0x8e, 
+  0x50, 0x24, 0x3f, 0x34, 0xec, 0x65, 0x2a, 0x3b, 0xfa, 0x34, 0x83, 0x8c, 0xaa, 0x5f, 0x3e, 0x6e, 
+  0xde, 0xef, 0x38, 0x08, 0x9a, 0x2d, 0xde, 0x0c, 0xb2, 0x66, 0xd0, 0xbd, 0xe4, 0x63, 0x7b, 0x04, 
+  0x5a, 0x85, 0x5f, 0x3a, 0x85, 0x49, 0x0f, 0x68, 0x8f, 0x4e, 0x93, 0xfc, 0xf0, 0x05, 0xbd, 0x23, 
+  0xdc, 0xb2, 0x5d, 0x81, 0x01, 0x1d, 0xbf, 0x45, 0x74, 0x20, 0xc9, 0x2e, 0x3f, 0x01, 0x1e, 0x26, 
+  0xfe, 0x16, 0x25, 0x7d, 0x1c, 0x9a, 0x2e, 0x8c, 0xa0, 0xe8, 0x73, 0x0e, 0x06, 0x1d, 0xef, 0xe1, 
+  0x54, 0xef, 0x1c, 0x47, 0xd8, 0x11, 0x9c, 0x52, 0xa2, 0xe0, 0xbd, 0x11, 0x7f, 0x92, 0x81, 0x8a, 
+  0xe9, 0xec, 0x6d, 0x62, 0x23, 0x56, 0x60, 0x2f, 0x2a, 0xac, 0xf7, 0x49, 0xc7, 0x55, 0xa4, 0xee, 
+  0x36, 0x06, 0x34, 0x6c, 0x38, 0x79, 0xb6, 0x12, 0x56, 0xd1, 0xba, 0x1c, 0xbc, 0x7b, 0xf1, 0xfa, 
+  0xc5, 0xb3, 0x23, 0x3b, 0x9e, 0x95, 0x43, 0xf5, 0xf7, 0x9a, 0x14, 0xf9, 0x40, 0x6f, 0xfa, 0x0d, 
+  0xd5, 0xc8, 0x7f, 0xdc, 0x59, 0x15, 0xa3, 0x26, 0xf4, 0x52, 0x4f, 0xa1, 0xd9, 0x87, 0xe0, 0x89, 
+  0x54, 0x2d, 0xed, 0xb3, 0xe2, 0x34, 0x78, 0x31, 0x9b, 0xad, 0xd9, 0x0d, 0x96, 0xcc, 0x35, 0xee, 
+  0xe2, 0xc2, 0x55, 0x13, 0x58, 0x56, 0xe2, 0x66, 0x8f, 0xaf, 0x26, 0x70, 0xfe, 0xc7, 0x45, 0x53, 
+  0x5d, 0xe3, 0xa7, 0x5b, 0x3c, 0x7c, 0x38, 0x0f, 0x04, 0xf7, 0x85, 0x51, 0xa9, 0x31, 0x7b, 0x72, 
+  0x57, 0x6e, 0xe7, 0x2c, 0x3f, 0x6d, 0x43, 0xbf, 0x32, 0xc0, 0x26, 0x0a, 0x61, 0x40, 0x8b, 0xaf, 
+  0x57, 0x02, 0x33, 0xe3, 0xd7, 0x80, 0xa0, 0x97, 0x59, 0x7f, 0x3d, 0xe7, 0x23, 0x4c, 0x65, 0x7a, 
+  0xcc, 0xb0, 0xd0, 0x51, 0xc2, 0xce, 0x54, 0xa8, 0x42, 0x8d, 0x43, 0x78, 0xac, 0xf4, 0x92, 0x94, 
+  0x16, 0x44, 0x9d, 0x0e, 0x00, 0xec, 0x97, 0x21, 0x1d, 0x6b, 0x9c, 0x84, 0x94, 0x14, 0xc6, 0xd5, 
+  0x9c, 0x3e, 0xc7, 0xf2, 0xa8, 0xbc, 0x12, 0x60, 0xee, 0xb5, 0x25, 0xa0, 0x92, 0x7a, 0x60, 0x37, 
+  0xfe, 0x09, 0x22, 0xba, 0x7f, 0x29, 0x48, 0x83, 0xf4, 0x18, 0xbd, 0xd2, 0xd6, 0x51, 0x48, 0x57, 
+  0x50, 0x45, 0xd5, 0xc7, 0x78, 0xd5, 0xda, 0x55, 0xd9, 0x38, 0xa1, 0x03, 0x58, 0x49, 0x6d, 0x00, 
+  0xfc, 0x0b, 0xa0, 0x4e, 0x26, 0xc2, 0xbb, 0x90, 0xcf, 0xb0, 0xca, 0x28, 0x6c, 0x9d, 0x18, 0x34, 
+  0x2f, 0x2e, 0xd0, 0xcf, 0xc3, 0x87, 0x57, 0xda, 0x4a, 0x8e, 0x6e, 0x31, 0xdf, 0x7c, 0x5a, 0xb5, 
+  0xe1, 0xa1, 0xa8, 0xd9, 0xa4, 0x8d, 0xf8, 0x62, 0x78, 0x00, 0xe0, 0x8a, 0x79, 0x5b, 0x7f, 0x9d, 
+  0x4c, 0xd7, 0xc7, 0xd0, 0x5e, 0xd4, 0xc8, 0x59, 0xf7, 0x8d, 0x98, 0x25, 0xad, 0x68, 0x02, 0xae, 
+  0xa7, 0xf4, 0x71, 0xc0, 0xb3, 0x6a, 0x53, 0x92, 0xe6, 0x99, 0xe1, 0xa0, 0x12, 0xe9, 0x00, 0xd5, 
+  0x90, 0x67, 0xa9, 0x20, 0x4a, 0x59, 0xa0, 0x1d, 0xba, 0x2b, 0xdd, 0x8e, 0x31, 0x05, 0x91, 0xd9, 
+  0xb0, 0x16, 0x4e, 0xad, 0x13, 0x23, 0xdc, 0xbd, 0x51, 0x71, 0x27, 0x0b, 0x04, 0x94, 0x64, 0x8e, 
+  0x9c, 0xe1, 0x3a, 0x61, 0x1d, 0xca, 0x6a, 0xd8, 0x5e, 0xd7, 0x49, 0xd1, 0x6a, 0xd2, 0x93, 0x46, 
+  0x12, 0x41, 0xb3, 0xfa, 0xd0, 0xd4, 0x9d, 0x96, 0xb5, 0xca, 0x53, 0xfb, 0x5b, 0x10, 0xa4, 0xfe, 
+  0x9e, 0xec, 0x2c, 0x18, 0x75, 0xf7, 0xdc, 0xaa, 0x86, 0x22, 0x0f, 0x56, 0xd0, 0x87, 0xbd, 0x21, 
+  0x1d, 0xec, 0xfc, 0x58, 0x5b, 0xa6, 0x9f, 0xcf, 0x58, 0xf9, 0xde, 0x16, 0x0c, 0xd8, 0x7c, 0xad, 
+  0xab, 0x64, 0x08, 0xe5, 0x93, 0x6a, 0x31, 0x9f, 0x78, 0x32, 0x95, 0xcf, 0xcf, 0xc4, 0x0c, 0xc7, 
+  0x80, 0x73, 0x59, 0x08, 0xca, 0x6c, 0x7b, 0xd3, 0x6f, 0x93, 0x86, 0x2b, 0xb8, 0xaf, 0x20, 0xc4, 
+  0xa7, 0x7d, 0x23, 0x72, 0xe2, 0x0c, 0xbc, 0x70, 0xdb, 0xbe, 0x8d, 0x02, 0x6f, 0xa2, 0x12, 0xe7, 
+  0xa4, 0x45, 0xfa, 0x90, 0xd8, 0xb3, 0x56, 0x61, 0xa5, 0xad, 0x8b, 0x86, 0xaa, 0x0a, 0x6b, 0x55, 
+  0x1a, 0x0f, 0xea, 0xde, 0x71, 0x84, 0xec, 0xb7, 0x40, 0xef, 0xc5, 0xfc, 0x7c, 0x64, 0x42, 0x23, 
+  0x6b, 0x8b, 0x56, 0xb9, 0xb5, 0xee, 0x5a, 0x6b, 0x87, 0x99, 0x4f, 0xbe, 0xbc, 0x98, 0xc4, 0x98, 
+  0x44, 0x0d, 0xa9, 0x94, 0xaf, 0xd3, 0xf6, 0x0f, 0xf4, 0xc9, 0xb8, 0xb9, 0xda, 0x9d, 0x58, 0x93, 
+  0x2f, 0x4e, 0x28, 0xfa, 0x82, 0x57, 0x60, 0xc3, 0xb8, 0x6a, 0xc8, 0x46, 0x3b, 0xb5, 0x28, 0x5c, 
+  0xfa, 0x97, 0x68, 0xa8, 0xc1, 0x7c, 0x55, 0x1f, 0xfc, 0x1d, 0x33, 0x28, 0xac, 0x1e, 0x3e, 0xfc, 
+  0x6a, 0xef, 0x80, 0xc9, 0x31, 0xd2, 0xd9, 0xca, 0x5f, 0xed, 0x58, 0x2b, 0x0f, 0xe7, 0x56, 0x35, 
+  0x87, 0xc9, 0x4a, 0xeb, 0x0c, 0x0d, 0xd6, 0x99, 0x15, 0xfe, 0x8a, 0x0b, 0xfa, 0xe1, 0x6f, 0xf4, 
+  0x0e, 0xa7, 0x0d, 0x50, 0xea, 0x0e, 0x00, 0x22, 0x89, 0x8c, 0xd9, 0xb1, 0x42, 0x29, 0x99, 0x56, 
+  0xa4, 0xa1, 0xc2, 0xb4, 0xb6, 0x63, 0x8d, 0x67, 0x5b, 0x7c, 0xad, 0x21, 0x79, 0x91, 0x20, 0xd3, 
+  0xb8, 0x84, 0x57, 0x4f, 0x6f, 0x8e, 0xc4, 0x07, 0x66, 0x0d, 0x2d, 0xd7, 0xc6, 0xa9, 0x5b, 0x08, 
+  0x33, 0xbd, 0xb5, 0x70, 0x65, 0x81, 0x74, 0x0b, 0x8b, 0x8f, 0xd0, 0x0e, 0xbd, 0xd6, 0xab, 0x78, 
+  0xac, 0xca, 0x6f, 0x11, 0x1a, 0x9c, 0x6d, 0xbb, 0x7f, 0xd7, 0xd6, 0x91, 0x5e, 0x7f, 0x79, 0xd3, 
+  0x6e, 0xeb, 0xed, 0x9c, 0x03, 0x63, 0xbe, 0x05, 0xb4, 0xf8, 0x0e, 0x70, 0x5c, 0x33, 0x49, 0xa5, 
+  0x6b, 0xb2, 0xff, 0xa4, 0x6b, 0x14, 0xe6, 0x84, 0xde, 0xe8, 0x8a, 0xd0, 0x74, 0xcc, 0xb8, 0xe9, 
+  0xb5, 0xa1, 0xb6, 0x4b, 0x5d, 0x2b, 0x04, 0x03, 0x06, 0x74, 0x36, 0x03, 0xa4, 0x6a, 0xc4, 0xba, 
+  0xf6, 0x48, 0x50, 0x02, 0xdb, 0xaa, 0xbe, 0xe9, 0xb3, 0x14, 0xf4, 0xd9, 0x61, 0xd8, 0xb1, 0xb8, 
+  0xc5, 0x56, 0xab, 0x97, 0x72, 0xcb, 0x4e, 0xab, 0x80, 0xe5, 0x68, 0x07, 0xde, 0x37, 0xd0, 0x78, 
+  0x00, 0x98, 0x2b, 0xe4, 0x99, 0x12, 0x37, 0xa3, 0x07, 0xf0, 0x6a, 0x3d, 0xbb, 0xcc, 0xeb, 0x3e, 
+  0xbd, 0x06, 0xcb, 0x5e, 0xb9, 0x95, 0x41, 0xc5, 0xef, 0xa1, 0xeb, 0x13, 0xa2, 0x0f, 0xc4, 0xf8, 
+  0xa4, 0x03, 0xa9, 0xd7, 0x7c, 0x65, 0xc3, 0xc9, 0x67, 0xd4, 0x68, 0xcf, 0xd2, 0x14, 0xa4, 0xb0, 
+  0xd7, 0x6b, 0x88, 0xc8, 0x7d, 0x49, 0x43, 0x82, 0x45, 0x41, 0xf2, 0x30, 0xb5, 0xbd, 0xe1, 0xff, 
+  0x99, 0x59, 0xc1, 0x74, 0x06, 0xa7, 0x0b, 0xfc, 0x3f, 0x17, 0xa2, 0x67, 0x96, 0x10, 0xad, 0xd4, 
+  0x4b, 0x7e, 0xd0, 0x70, 0x2f, 0x74, 0xe9, 0xab, 0x3e, 0x20, 0x62, 0xbb, 0x48, 0x3f, 0xe5, 0xa7, 
+  0x40, 0x35, 0x0a, 0x64, 0x92, 0x6f, 0x23, 0x5b, 0x66, 0xc7, 0xed, 0xcb, 0x65, 0x09, 0x06, 0xa9, 
+  0xe9, 0x3e, 0x98, 0x3a, 0x97, 0xc9, 0x87, 0x08, 0xce, 0xb7, 0x14, 0xd5, 0xf0, 0x8f, 0x08, 0x1c, 
+  0x69, 0x6c, 0xfb, 0xe0, 0xd2, 0xaf, 0x68, 0xa3, 0x69, 0x5d, 0x61, 0x46, 0xd3, 0xc4, 0x7a, 0x6a, 
+  0xb4, 0x5e, 0x65, 0xd5, 0x93, 0x53, 0xf6, 0xfe, 0x25, 0x99, 0x5f, 0x2b, 0x74, 0x0a, 0xc6, 0x67, 
+  0xf3, 0x27, 0x43, 0x84, 0x5a, 0x5e, 0x66, 0x41, 0x14, 0x3c, 0x56, 0x15, 0xbc, 0xdf, 0xf5, 0xa7, 
+  0xff, 0x1e, 0x1c, 0x3f, 0x0e, 0x06, 0xab, 0xf4, 0x24, 0xad, 0xf2, 0xdd, 0x3c, 0x00, 0x10, 0x9a, 
+  0x75, 0xe7, 0xcb, 0xbc, 0x22, 0x19, 0xe1, 0xb3, 0x29, 0xb8, 0x1b, 0x28, 0x9f, 0x3f, 0x7c, 0x04, 
+  0xfb, 0x7b, 0x41, 0x63, 0x58, 0x92, 0xd5, 0x33, 0xb7, 0x7e, 0x97, 0x49, 0x3f, 0x42, 0xbd, 0xab, 
+  0x0c, 0x8f, 0xe1, 0x94, 0x52, 0x34, 0x28, 0x02, 0x59, 0x0b, 0x18, 0x33, 0xec, 0x34, 0x10, 0x3b, 
+  0x16, 0xbd, 0x11, 0xc5, 0x2d, 0x0d, 0x6e, 0xdc, 0xdc, 0x8c, 0x80, 0x00, 0x05, 0x06, 0x2e, 0x79, 
+  0x07, 0x58, 0x8f, 0xb5, 0x61, 0x9e, 0x17, 0x64, 0x99, 0xd1, 0x54, 0xa1, 0x5e, 0x99, 0x4b, 0x65, 
+  0xc1, 0xd4, 0x79, 0x0a, 0x39, 0x16, 0x84, 0xb1, 0x1e, 0x51, 0xaf, 0x8a, 0xab, 0x75, 0x67, 0x58, 
+  0x15, 0x9c, 0x1a, 0xe4, 0x58, 0x0e, 0xf4, 0x78, 0xf9, 0xa8, 0xed, 0xa5, 0x4e, 0xc4, 0x17, 0x58, 
+  0xcd, 0x11, 0xdb, 0x25, 0x0c, 0x42, 0x69, 0x9b, 0x65, 0xa2, 0x0c, 0xbf, 0x71, 0xb3, 0xa3, 0x69, 
+  0x6b, 0xb6, 0xb9, 0x2a, 0x52, 0xc0, 0x02, 0xa6, 0xc9, 0xb9, 0x26, 0x2c, 0x57, 0x90, 0xa7, 0x6b, 
+  0xc5, 0xb1, 0xbd, 0x66, 0xd2, 0x5a, 0x5e, 0xf3, 0x79, 0x57, 0x09, 0x3d, 0xd3, 0x72, 0x58, 0xb8, 
+  0x03, 0x2b, 0x77, 0x49, 0x37, 0x61, 0x9e, 0x7c, 0x27, 0x8a, 0xd9, 0xb3, 0x49, 0x1e, 0x97, 0x63, 
+  0xfd, 0x3d, 0x27, 0x3e, 0xe2, 0x0c, 0x94, 0x17, 0xb8, 0xb3, 0x75, 0x01, 0x86, 0x5c, 0x44, 0x03, 
+  0x8e, 0x9c, 0xd4, 0xe5, 0x24, 0x18, 0x8a, 0xf3, 0x39, 0x82, 0xf0, 0x5b, 0x55, 0x2d, 0xe6, 0xb3, 
+  0xef, 0x5d, 0x64, 0x37, 0xeb, 0x2b, 0x8f, 0xd3, 0x7c, 0xf9, 0x60, 0x41, 0xdf, 0x4d, 0x7a, 0xfc, 
+  0xdb, 0x03, 0x53, 0x6e, 0x41, 0x5d, 0x36, 0xe7, 0x12, 0x8b, 0x2a, 0x3d, 0x65, 0xf8, 0x0c, 0x00, 
+  0xd9, 0xc5, 0xa8, 0x20, 0x97, 0x97, 0xa0, 0x0a, 0x4e, 0x0e, 0xfe, 0x8b, 0xf6, 0x0a, 0x13, 0x7d, 
+  0x9a, 0x68, 0xbd, 0xb2, 0x08, 0x26, 0xbe, 0x5d, 0x79, 0xce, 0x35, 0x5d, 0x91, 0xba, 0x9f, 0xe9, 
+  0x83, 0x39, 0xaa, 0xa0, 0x2a, 0xe3, 0xe5, 0xc1, 0xfe, 0xfe, 0xc4, 0x2d, 0x1c, 0x5f, 0x1d, 0x7c, 
+  0x23, 0x6d, 0x7d, 0xfe, 0xe6, 0xf0, 0xc9, 0xba, 0x2e, 0xe1, 0x07, 0x45, 0x48, 0xa1, 0x6e, 0x35, 
+  0xda, 0xb4, 0xa0, 0x37, 0x6d, 0x8e, 0xe5, 0x77, 0x20, 0x55, 0x9b, 0x41, 0xe4, 0xf8, 0x11, 0x8c, 
+  0xf3, 0x49, 0xaf, 0xec, 0x95, 0x6b, 0x90, 0x77, 0xc1, 0x43, 0x57, 0xb2, 0xe2, 0xc3, 0x2d, 0xb7, 
+  0x9a, 0xb4, 0x86, 0x46, 0x46, 0x43, 0x23, 0x56, 0x5f, 0x4d, 0xad, 0x93, 0xeb, 0x84, 0x83, 0x99, 
+  0xc4, 0x96, 0x6e, 0x79, 0x29, 0x8b, 0x8d, 0x65, 0x8f, 0x68, 0xc6, 0xae, 0xda, 0xb2, 0x70, 0x22, 
+  0x97, 0xc1, 0xdc, 0xe4, 0xd1, 0x77, 0x71, 0x84, 0x7c, 0x77, 0xec, 0x68, 0x18, 0x16, 0xdb, 0xe7, 
+  0xd2, 0x35, 0x66, 0x2b, 0x2a, 0x51, 0xdf, 0xf8, 0xcf, 0xbc, 0x8b, 0xf2, 0x83, 0xdc, 0xf0, 0xc1, 
+  0x1b, 0x0d, 0x46, 0xa3, 0x96, 0xd3, 0xe6, 0xa7, 0xf9, 0x58, 0xf9, 0xff, 0x38, 0x56, 0x50, 0x2d, 
+  0xe0, 0x4e, 0x01, 0x15, 0x5a, 0x20, 0x6f, 0xf9, 0x1f, 0xc8, 0x5f, 0xca, 0x0b, 0x28, 0x01, 0x64, 
+  0x78, 0x89, 0x21, 0xfc, 0x53, 0x22, 0x32, 0x44, 0x75, 0xf9, 0xba, 0xbc, 0xce, 0xaa, 0x67, 0xe9, 
+  0x8a, 0x37, 0xe6, 0xc6, 0xad, 0x35, 0x54, 0x4e, 0x2c, 0x1a, 0x61, 0xe2, 0xd5, 0xd2, 0x27, 0xb4, 
+  0xb4, 0x36, 0x35, 0x7a, 0x6f, 0x58, 0x27, 0xb6, 0xab, 0x4c, 0xf8, 0x99, 0x98, 0xd0, 0x66, 0xb8, 
+  0x1f, 0x0a, 0x0f, 0x03, 0x18, 0x67, 0x7a, 0xa2, 0xff, 0x18, 0x07, 0x11, 0xb0, 0x56, 0xbc, 0xdc, 
+  0xd4, 0x02, 0x26, 0xa5, 0x02, 0x10, 0x7e, 0xe3, 0x58, 0x5a, 0x89, 0x30, 0xb1, 0x13, 0xc1, 0x15, 
+  0xb1, 0x03, 0x2a, 0x57, 0x93, 0xbf, 0x54, 0x86, 0x6b, 0x48, 0x35, 0x39, 0xb6, 0x61, 0x25, 0xeb, 
+  0xa5, 0xa1, 0x76, 0x8f, 0x62, 0xf9, 0x62, 0x95, 0xf2, 0x19, 0xbd, 0xe2, 0x97, 0x3b, 0x81, 0x41, 
+  0x33, 0xf4, 0xfb, 0xd2, 0x71, 0x79, 0x72, 0xc2, 0x4e, 0xbd, 0x94, 0x26, 0xc3, 0x5c, 0x4d, 0x06, 
+  0xe0, 0x89, 0x52, 0x8f, 0x5f, 0xc2, 0x95, 0xa4, 0x2e, 0xe3, 0xb0, 0x55, 0x06, 0xd1, 0x5f, 0xda, 
+  0x3d, 0xd6, 0x5e, 0x45, 0xf4, 0xaa, 0xcc, 0xce, 0xb7, 0xad, 0x2b, 0x0c, 0x2c, 0xa2, 0xca, 0x73, 
+  0xa7, 0x8a, 0x2a, 0x3b, 0xa4, 0x5b, 0x62, 0xdf, 0x2e, 0x21, 0x16, 0x48, 0xbb, 0x00, 0x22, 0x6b, 
+  0x91, 0xea, 0xa0, 0x32, 0xb4, 0xb3, 0x1e, 0x01, 0xb1, 0xe2, 0x01, 0xb8, 0xe2, 0xfc, 0x3b, 0x1e, 
+  0x5c, 0x9e, 0x90, 0x37, 0x39, 0x5d, 0xaf, 0x3b, 0x39, 0x6c, 0xcd, 0xc9, 0x2a, 0x44, 0x46, 0x53, 
+  0x03, 0xec, 0x0a, 0x5f, 0xd8, 0x7f, 0x05, 0x4d, 0x93, 0x94, 0x48, 0x79, 0xef, 0x82, 0x00, 0xd7, 
+  0x22, 0xc7, 0xe2, 0xa8, 0xef, 0x08, 0x5f, 0x8d, 0x2c, 0x0f, 0x2b, 0xb5, 0x12, 0x04, 0x9d, 0x95, 
+  0xc0, 0xb2, 0xec, 0x60, 0x01, 0x61, 0x16, 0x2a, 0x2d, 0xb0, 0x9b, 0xf5, 0x30, 0x0f, 0x4c, 0x74, 
+  0xf2, 0x16, 0xe3, 0xca, 0x98, 0xf4, 0x4d, 0x27, 0xf2, 0x8f, 0x55, 0x40, 0xda, 0xf6, 0x20, 0x95, 
+  0x05, 0xa0, 0x01, 0x92, 0x10, 0x01, 0xdd, 0xb6, 0xf6, 0x92, 0x54, 0x50, 0x43, 0xe2, 0x1e, 0xe3, 
+  0x50, 0x6e, 0x1b, 0x87, 0x94, 0x53, 0x5b, 0x57, 0xdd, 0xca, 0x94, 0x56, 0x57, 0x5f, 0xe3, 0xda, 
+  0xad, 0xed, 0x0e, 0x8d, 0xcb, 0x3e, 0xed, 0x24, 0xb8, 0x6d, 0x16, 0x36, 0x59, 0x11, 0xd4, 0xa2, 
+  0xf6, 0x29, 0x5f, 0xe5, 0x7f, 0xdd, 0x67, 0x08, 0xe6, 0xe6, 0xa2, 0x2c, 0x98, 0x31, 0x43, 0xc4, 
+  0x69, 0x0e, 0x3f, 0x5a, 0xa6, 0x37, 0xd0, 0x43, 0x86, 0xc0, 0xad, 0x72, 0xce, 0xd2, 0xe2, 0x1c, 
+  0xc3, 0x10, 0x56, 0x09, 0x32, 0xb4, 0x7b, 0x89, 0x2b, 0x32, 0x5e, 0x59, 0x78, 0x93, 0x7b, 0xd6, 
+  0xc5, 0x1e, 0x17, 0x07, 0x0b, 0xb4, 0xec, 0x29, 0xb1, 0x79, 0x75, 0xba, 0xfa, 0x61, 0xc3, 0x77, 
+  0x90, 0xa9, 0xea, 0x61, 0xc1, 0x82, 0x9b, 0xb9, 0xf1, 0x7f, 0xbc, 0xb5, 0xbf, 0x23, 0x9f, 0xb0, 
+  0x52, 0x45, 0x2b, 0xb6, 0x97, 0xe8, 0x98, 0x97, 0x77, 0xe5, 0xba, 0x9a, 0x67, 0x2e, 0xb4, 0x94, 
+  0xa5, 0x01, 0xbc, 0x21, 0x89, 0xb0, 0xca, 0x17, 0xd9, 0xa0, 0xef, 0x2e, 0x2f, 0x68, 0xd7, 0x2d, 
+  0xf6, 0x8f, 0x1f, 0xd3, 0x4f, 0xe9, 0x3b, 0xce, 0x18, 0x51, 0x6c, 0x5b, 0x65, 0xf5, 0x74, 0x59, 
+  0x52, 0x4b, 0xbf, 0xf8, 0x94, 0xfb, 0xef, 0xef, 0x3e, 0xef, 0x32, 0xbd, 0xc8, 0xb6, 0xbd, 0x49, 
+  0xa3, 0xba, 0xb6, 0x23, 0xb7, 0x0c, 0x9c, 0x13, 0xe7, 0x27, 0x7e, 0x0c, 0xda, 0x51, 0xd7, 0x12, 
+  0xbf, 0x3a, 0x2c, 0xb6, 0x83, 0x4f, 0x9a, 0x98, 0xe9, 0x26, 0xf8, 0xda, 0x42, 0x99, 0xe4, 0x20, 
+  0xc0, 0x4f, 0x11, 0xfc, 0x8c, 0x1b, 0x09, 0x42, 0xcd, 0xac, 0x3c, 0x4f, 0x07, 0x67, 0x33, 0x68, 
+  0xdd, 0xb3, 0x62, 0xa8, 0xc2, 0xde, 0x68, 0x2e, 0xf3, 0x4c, 0x1d, 0xcb, 0x9d, 0x05, 0xf7, 0x7f, 
+  0xda, 0xed, 0xc9, 0xd6, 0x8a, 0x13, 0xb9, 0xdb, 0x7b, 0x40, 0xb5, 0x51, 0x54, 0x04, 0x7d, 0x1f, 
+  0xdc, 0x54, 0xd4, 0x7e, 0x70, 0xbe, 0xd2, 0x05, 0x05, 0xd9, 0xb4, 0xce, 0x8a, 0xde, 0x7c, 0x64, 
+  0xf6, 0xf5, 0x8a, 0xac, 0x8f, 0x85, 0xc7, 0xbd, 0x89, 0xdd, 0x3a, 0xdb, 0x1b, 0x56, 0x07, 0xec, 
+  0x53, 0x05, 0xc7, 0x8b, 0x79, 0x88, 0xd7, 0xd3, 0x05, 0x1c, 0x30, 0xba, 0xa5, 0x0f, 0x10, 0xc7, 
+  0x50, 0x23, 0xae, 0x77, 0xfb, 0x63, 0x8a, 0x40, 0xd0, 0x38, 0x7d, 0x06, 0x0b, 0x94, 0x78, 0x32, 
+  0xe1, 0xd8, 0x6a, 0x3f, 0x5b, 0x27, 0xb0, 0x82, 0x51, 0xc1, 0x71, 0x90, 0x22, 0xda, 0xfa, 0x2d, 
+  0xd6, 0xf9, 0x57, 0xb3, 0x64, 0x0b, 0x70, 0x93, 0xfe, 0x20, 0xd8, 0xe5, 0x81, 0x57, 0x6b, 0x03, 
+  0x54, 0xe6, 0x89, 0x78, 0x30, 0x19, 0x52, 0xbd, 0x6c, 0xfc, 0x1a, 0xa5, 0x66, 0x85, 0x4f, 0x93, 
+  0x6c, 0x5a, 0x1e, 0x6b, 0xc4, 0x90, 0xbc, 0x1d, 0xa4, 0x99, 0x6a, 0x20, 0xad, 0x24, 0x9f, 0xa6, 
+  0xec, 0xed, 0xef, 0xb1, 0xc1, 0x0a, 0x38, 0x47, 0x0a, 0x54, 0x44, 0xd4, 0x25, 0x39, 0x5a, 0xce, 
+  0x80, 0x4f, 0x03, 0x83, 0x8f, 0xde, 0x8e, 0x60, 0x3c, 0xa2, 0xde, 0x6b, 0xc6, 0x63, 0xc6, 0x2f, 
+  0x3d, 0x58, 0x94, 0xd9, 0x8a, 0x13, 0xfa, 0x90, 0xfc, 0x07, 0xea, 0x6e, 0x84, 0x44, 0x3f, 0xf2, 
+  0x46, 0x29, 0x62, 0x06, 0xb5, 0xc9, 0x00, 0xf3, 0x25, 0x27, 0xdd, 0xa7, 0x6e, 0xee, 0x5f, 0x79, 
+  0x16, 0xbe, 0x38, 0x24, 0xc4, 0xe8, 0xc3, 0x87, 0xba, 0xfa, 0x90, 0x5e, 0xce, 0xea, 0x62, 0xd5, 
+  0x58, 0x25, 0x35, 0x8e, 0x57, 0xa8, 0x51, 0xbc, 0x4c, 0xa2, 0x6e, 0x57, 0xab, 0x1f, 0x18, 0x60, 
+  0xb0, 0x7e, 0xd0, 0x35, 0x00, 0x30, 0x0f, 0xb0, 0xa5, 0x6d, 0x42, 0x6a, 0x60, 0xe1, 0x8a, 0x3e, 
+  0xd4, 0xdc, 0xc0, 0x0b, 0xab, 0x2f, 0xac, 0x65, 0x34, 0xb7, 0x47, 0xb5, 0x72, 0x9f, 0xee, 0xfa, 
+  0x07, 0xfe, 0x14, 0x60, 0xe6, 0xa3, 0xf7, 0x8b, 0xc7, 0x81, 0xc2, 0x63, 0x9d, 0x0c, 0x0d, 0xd8, 
+  0xda, 0xfb, 0xd5, 0xe3, 0x84, 0xfe, 0x0b, 0xa6, 0x82, 0x1f, 0xfe, 0x7e, 0xe7, 0x98, 0x2e, 0xc7, 
+  0x09, 0x0a, 0x7a, 0x40, 0x37, 0x3f, 0x06, 0xa4, 0xf9, 0xfb, 0x47, 0xf4, 0xf3, 0x11, 0xfd, 0x7c, 
+  0x74, 0x37, 0xfd, 0xf7, 0xf7, 0xa4, 0x52, 0x07, 0x93, 0xe0, 0x31, 0x55, 0x14, 0xb4, 0xab, 0xf1, 
+  0xa7, 0xde, 0xa3, 0xe3, 0x40, 0xe1, 0xbd, 0x3e, 0x9e, 0x04, 0xef, 0xbf, 0xde, 0x3d, 0xcd, 0x49, 
+  0x64, 0xd8, 0xb5, 0x81, 0x63, 0xdf, 0xcf, 0xb8, 0xa4, 0x29, 0xa3, 0x81, 0x5f, 0x77, 0x4f, 0xb5, 
+  0x47, 0xec, 0xa8, 0x0b, 0x16, 0x5a, 0xf7, 0xcd, 0x63, 0x9e, 0x12, 0xe0, 0x88, 0x6b, 0xcd, 0xac, 
+  0x96, 0xf8, 0x64, 0x76, 0xb2, 0x57, 0xb3, 0xe8, 0x7c, 0xa1, 0x92, 0x1f, 0xe1, 0xe8, 0x3d, 0x77, 
+  0x80, 0xad, 0x4b, 0xcb, 0x45, 0xa6, 0x48, 0xe7, 0x5b, 0xd6, 0xaf, 0xd6, 0xd6, 0x28, 0x02, 0x48, 
+  0x01, 0x4c, 0x95, 0xc0, 0xdc, 0x51, 0xf4, 0xfb, 0x23, 0x61, 0x0a, 0xd7, 0xb0, 0xbb, 0x83, 0x8b, 
+  0x72, 0xa0, 0x60, 0x77, 0x43, 0xef, 0x7f, 0x29, 0x90, 0x60, 0x8f, 0xab, 0xd9, 0x84, 0x3f, 0xce, 
+  0x1d, 0xab, 0x98, 0xd5, 0xfa, 0x9f, 0xa2, 0x9b, 0x99, 0xdf, 0x6f, 0x5a, 0xb0, 0xa1, 0x8c, 0x99, 
+  0xc3, 0x1c, 0x6b, 0x78, 0x57, 0x72, 0x06, 0x7e, 0x0f, 0xcc, 0x16, 0xaf, 0x53, 0x65, 0x0e, 0xd8, 
+  0xd8, 0xf8, 0xd8, 0xd6, 0xd0, 0xe6, 0x6c, 0xed, 0x59, 0xf4, 0xe3, 0xbc, 0x95, 0x6f, 0xf1, 0x29, 
+  0xe1, 0x2d, 0x9b, 0xf6, 0x8f, 0xb6, 0x99, 0x48, 0xd8, 0xc7, 0x92, 0x6e, 0xb6, 0x85, 0x50, 0x6c, 
+  0xce, 0x12, 0x9d, 0xa7, 0x89, 0x45, 0x76, 0xb2, 0x1f, 0x3b, 0x5a, 0x71, 0x3d, 0xf9, 0x2a, 0x6e, 
+  0xd2, 0x2f, 0x59, 0x63, 0x34, 0x49, 0x96, 0x26, 0xe9, 0x51, 0x27, 0x5d, 0xea, 0xed, 0x69, 0xf2, 
+  0x75, 0xfc, 0xcd, 0x46, 0xb5, 0xc6, 0x5a, 0x64, 0x5d, 0x28, 0x0f, 0x2d, 0x99, 0x98, 0xb5, 0x3d, 
+  0x9b, 0x4d, 0x44, 0x7b, 0x88, 0xbf, 0xb2, 0x4f, 0x89, 0x1a, 0x12, 0x93, 0xea, 0x51, 0x64, 0x15, 
+  0x92, 0x3e, 0xbc, 0xf1, 0x16, 0xca, 0x20, 0x1b, 0xbc, 0x02, 0xb9, 0x77, 0x2a, 0xc4, 0xc2, 0x94, 
+  0x9b, 0xee, 0x1d, 0x8f, 0xad, 0x6a, 0xd0, 0xf4, 0x89, 0xf2, 0x6c, 0xcb, 0x3d, 0xd4, 0xed, 0xb1, 
+  0xb9, 0x3b, 0xa9, 0x37, 0xe3, 0xa6, 0xc3, 0xd8, 0x06, 0x35, 0xf2, 0x3e, 0x20, 0x47, 0xc7, 0x7d, 
+  0x2b, 0x06, 0x7c, 0x69, 0x75, 0x39, 0xc7, 0x26, 0x7d, 0x11, 0xd3, 0x42, 0x3f, 0x14, 0x42, 0x40, 
+  0x63, 0x32, 0x6a, 0xce, 0x36, 0x51, 0xfb, 0x6c, 0xd4, 0xb3, 0x8c, 0xdf, 0x1a, 0x4e, 0xc3, 0x6d, 
+  0x49, 0xc1, 0x81, 0xc8, 0xbd, 0x24, 0x72, 0x51, 0x71, 0x7f, 0xa7, 0xf9, 0x2e, 0xd2, 0x86, 0xa4, 
+  0xaf, 0x5c, 0xce, 0x48, 0xcb, 0xfa, 0xda, 0xfa, 0x16, 0xe6, 0x4b, 0xc7, 0xdf, 0xd8, 0x67, 0xe3, 
+  0xf3, 0x36, 0x34, 0xc7, 0xed, 0xe5, 0x2c, 0xb6, 0xbb, 0x5d, 0x90, 0x47, 0x20, 0xa7, 0x74, 0x29, 
+  0x1a, 0x0b, 0x04, 0x3b, 0xca, 0x45, 0x8b, 0x29, 0xc9, 0x48, 0x43, 0x9d, 0x4b, 0x9d, 0x61, 0xb4, 
+  0xe5, 0xc5, 0xac, 0xd0, 0x4b, 0xa7, 0xbb, 0xe5, 0xed, 0x1a, 0x69, 0xf8, 0xc7, 0x99, 0x10, 0xb7, 
+  0x90, 0x58, 0x38, 0x63, 0xc9, 0x9c, 0x4e, 0xe0, 0x77, 0x64, 0x46, 0x0a, 0xf6, 0xf1, 0x1f, 0x67, 
+  0x9b, 0xce, 0x27, 0xa2, 0xf7, 0xfc, 0xb1, 0xef, 0x3d, 0xad, 0x9d, 0x5d, 0xe4, 0x03, 0x9e, 0xb4, 
+  0x9f, 0x82, 0xde, 0x4b, 0xd1, 0xa2, 0xbc, 0xd4, 0xa1, 0x3e, 0x32, 0x63, 0xb6, 0x94, 0x4b, 0x49, 
+  0x45, 0xb8, 0xb9, 0x2c, 0xd7, 0xab, 0x26, 0x35, 0x53, 0xba, 0x66, 0x6b, 0x66, 0x76, 0xe5, 0x04, 
+  0x0e, 0x8c, 0x85, 0xb4, 0xbe, 0x8d, 0x4a, 0x58, 0x33, 0xb8, 0x90, 0x5f, 0xd1, 0xfa, 0x00, 0x83, 
+  0xd0, 0x38, 0xe0, 0x28, 0x86, 0x1e, 0xf0, 0x42, 0x07, 0x0f, 0xd0, 0xf0, 0xa3, 0x39, 0xbd, 0x9d, 
+  0x93, 0x84, 0xb1, 0x07, 0x4e, 0x97, 0x6c, 0x9a, 0x35, 0xd8, 0xe7, 0x30, 0xdc, 0x5b, 0x20, 0x1a, 
+  0x6c, 0xaf, 0xb4, 0xd0, 0xf7, 0x56, 0xc8, 0x3c, 0xea, 0x40, 0x31, 0x8a, 0xa0, 0x51, 0xb1, 0x01, 
+  0xa6, 0x7f, 0x61, 0x85, 0x31, 0x3f, 0xa7, 0xee, 0x68, 0x00, 0xb9, 0x57, 0xa2, 0x02, 0x01, 0x71, 
+  0x68, 0xcc, 0x4a, 0x96, 0x2c, 0xaa, 0x7e, 0x9e, 0x54, 0xd4, 0x2c, 0xda, 0x8c, 0xc4, 0xa3, 0x5a, 
+  0x82, 0xe4, 0x9a, 0x4e, 0x55, 0x4d, 0x13, 0xef, 0xee, 0x8a, 0x40, 0xdc, 0x36, 0x72, 0x2a, 0xd9, 
+  0x03, 0x00, 0xa2, 0xe2, 0xbe, 0xc8, 0x71, 0x0f, 0xbc, 0x07, 0x70, 0x8c, 0xe5, 0x30, 0x24, 0xaa, 
+  0x9f, 0x62, 0xa6, 0x4b, 0xa3, 0xa7, 0xa9, 0x08, 0x80, 0x9b, 0x76, 0x73, 0x05, 0xbd, 0x25, 0x6b, 
+  0x61, 0xab, 0xd8, 0x52, 0x3d, 0x80, 0x3e, 0xd8, 0xb1, 0x8a, 0xf4, 0xa9, 0xff, 0xc1, 0xdd, 0x3f, 
+  0x45, 0xcf, 0xf0, 0x31, 0x60, 0x06, 0xda, 0x38, 0x8d, 0xd9, 0x38, 0x09, 0xe8, 0xd6, 0xf6, 0x69, 
+  0xd6, 0xe8, 0x2c, 0x6e, 0x82, 0x5f, 0x26, 0xf8, 0x6e, 0xb1, 0x8b, 0x73, 0xbf, 0xb4, 0xb7, 0xd5, 
+  0x1c, 0x0c, 0x47, 0x2a, 0x20, 0xa2, 0x4c, 0x10, 0xaa, 0xbe, 0x66, 0x1a, 0x88, 0x42, 0x56, 0x0a, 
+  0xc7, 0x7e, 0x4e, 0x1f, 0x38, 0x8f, 0x5c, 0xd1, 0xf6, 0xee, 0xee, 0x4a, 0xec, 0xfc, 0xb4, 0x73, 
+  0x1d, 0xcd, 0x39, 0x2c, 0xbd, 0x44, 0x00, 0xbf, 0x1b, 0x1a, 0xe9, 0x17, 0x34, 0x14, 0x5c, 0x05, 
+  0x42, 0x83, 0x7b, 0x19, 0x78, 0x77, 0xf8, 0x73, 0x1b, 0x8f, 0x5e, 0x27, 0xb8, 0x92, 0x1d, 0xf0, 
+  0xfd, 0xd0, 0x35, 0x47, 0x2d, 0xc1, 0x93, 0xdd, 0x50, 0x5a, 0x04, 0xa0, 0xff, 0x21, 0x88, 0x1c, 
+  0xa8, 0x70, 0x1a, 0x88, 0x06, 0xee, 0x46, 0x05, 0x6b, 0x50, 0x32, 0xdd, 0xac, 0x02, 0x35, 0x50, 
+  0xd2, 0x84, 0xc1, 0x5a, 0x8e, 0x55, 0xea, 0x0a, 0x7a, 0x9d, 0x86, 0xfe, 0x70, 0xcf, 0x26, 0xd5, 
+  0x53, 0x85, 0x19, 0x66, 0x85, 0x03, 0xf7, 0xd7, 0xf3, 0xfe, 0x82, 0xf9, 0x69, 0x51, 0x56, 0xd9, 
+  0x11, 0x2d, 0x26, 0x59, 0x2d, 0xa5, 0x5d, 0xa6, 0xa8, 0x5e, 0xdd, 0x4e, 0xfa, 0x0a, 0x09, 0x30, 
+  0x2a, 0xff, 0x56, 0x67, 0x9a, 0xd1, 0x08, 0x9f, 0xb3, 0xf3, 0x22, 0xcc, 0xed, 0x10, 0x4f, 0x1d, 
+  0x84, 0xe3, 0x9c, 0x54, 0xe6, 0x96, 0x02, 0x2c, 0xf6, 0xd8, 0xcb, 0x8e, 0x61, 0x49, 0x6a, 0x86, 
+  0xc1, 0x49, 0x2b, 0xe6, 0x41, 0x31, 0x81, 0x90, 0xc8, 0x12, 0xf7, 0x12, 0x52, 0x72, 0x6e, 0x2c, 
+  0xd2, 0xea, 0x30, 0x54, 0xae, 0x68, 0x5f, 0x78, 0x39, 0xeb, 0xf8, 0xad, 0x86, 0xec, 0x91, 0xf4, 
+  0x5b, 0x18, 0x72, 0x6f, 0x5b, 0x6e, 0x44, 0x77, 0x08, 0xc9, 0xf7, 0xca, 0x8b, 0xb3, 0x8c, 0xc4, 
+  0xc9, 0xc1, 0x49, 0x55, 0x5e, 0x32, 0x11, 0xa0, 0xab, 0x41, 0x05, 0xe3, 0x2b, 0xd9, 0x4d, 0x9e, 
+  0xcd, 0xba, 0xf8, 0x70, 0x62, 0xc7, 0xf5, 0x7d, 0x35, 0x96, 0x83, 0xee, 0x18, 0x0d, 0x3a, 0x98, 
+  0x83, 0xef, 0xb2, 0x7a, 0x90, 0x76, 0x74, 0x16, 0x09, 0x74, 0x31, 0x84, 0x84, 0xee, 0x90, 0x15, 
+  0x74, 0xe2, 0x34, 0x49, 0xef, 0xee, 0x3a, 0x63, 0x25, 0x2c, 0xb5, 0x8e, 0xb5, 0x46, 0x3a, 0x88, 
+  0xe9, 0xd2, 0xa7, 0xdd, 0x94, 0x01, 0x40, 0x1f, 0xb7, 0x31, 0xf6, 0x2a, 0x83, 0xb1, 0xa7, 0xbe, 
+  0x5a, 0xf3, 0xcf, 0x36, 0x40, 0xae, 0x90, 0xb6, 0x4a, 0xf8, 0x90, 0x34, 0xd6, 0x19, 0x02, 0x9b, 
+  0x80, 0x5f, 0x9b, 0x86, 0xc2, 0xf0, 0x13, 0x3a, 0x43, 0x94, 0xb6, 0x51, 0x1a, 0x3a, 0xdc, 0xba, 
+  0x84, 0x71, 0x3f, 0xb7, 0x43, 0xca, 0x0d, 0x57, 0x2a, 0xd2, 0xe8, 0xe3, 0x8c, 0x16, 0x6b, 0x64, 
+  0x53, 0xae, 0x60, 0xee, 0x76, 0x2b, 0x9b, 0xac, 0xac, 0x85, 0x3f, 0x5e, 0x6d, 0x2c, 0x2c, 0x8e, 
+  0x96, 0xc8, 0x0c, 0x11, 0xf6, 0xd9, 0x4c, 0x7d, 0xab, 0xcc, 0x6d, 0x95, 0x02, 0x2e, 0xbb, 0xb2, 
+  0x51, 0xd4, 0x60, 0x5e, 0x6c, 0x05, 0xdc, 0x8a, 0x05, 0xfc, 0x16, 0xa8, 0xb7, 0x6b, 0x04, 0xb6, 
+  0x3a, 0x03, 0xdf, 0x39, 0xe4, 0x15, 0x17, 0xee, 0xab, 0x3e, 0x62, 0x0f, 0xd5, 0xc2, 0x75, 0x52, 
+  0xf6, 0x23, 0xa0, 0x55, 0x88, 0xcc, 0x6e, 0xa5, 0x88, 0x71, 0x8a, 0x32, 0x3c, 0xe9, 0x40, 0x11, 
+  0x43, 0x97, 0x75, 0xe7, 0x73, 0xc8, 0x9f, 0x01, 0x2d, 0x03, 0xbc, 0x20, 0xcf, 0x8e, 0xf5, 0xbd, 
+  0x03, 0x40, 0xfb, 0xf0, 0x01, 0x44, 0x37, 0x36, 0x01, 0x62, 0x59, 0x13, 0x72, 0x94, 0x25, 0x80, 
+  0x3b, 0x55, 0x16, 0xff, 0xc3, 0xb4, 0x5f, 0xb3, 0xaa, 0x3a, 0x11, 0xe3, 0x7f, 0x35, 0x62, 0xac, 
+  0x31, 0xc9, 0x3e, 0x9f, 0x19, 0x93, 0x6c, 0xc6, 0xd0, 0xbf, 0xe9, 0x71, 0xcb, 0x00, 0xab, 0xa8, 
+  0x56, 0x6d, 0xd1, 0xb4, 0x89, 0xbe, 0xee, 0x75, 0xf0, 0x74, 0x12, 0x30, 0xfa, 0x4c, 0x6e, 0xb4, 
+  0xbb, 0x14, 0x92, 0x20, 0xd9, 0xf0, 0x71, 0x30, 0x88, 0x2f, 0x0a, 0xcb, 0x1a, 0x2d, 0xd9, 0xfc, 
+  0xcc, 0x28, 0x20, 0xaa, 0x15, 0x03, 0xf7, 0x85, 0x02, 0x9b, 0xe8, 0xa6, 0x5d, 0x23, 0x2c, 0x41, 
+  0xdd, 0x35, 0x10, 0xcf, 0x8f, 0x15, 0x8a, 0x40, 0x2d, 0xcd, 0x0b, 0x20, 0x0b, 0x15, 0x3b, 0xa5, 
+  0x61, 0x0e, 0x96, 0x4d, 0x21, 0x7a, 0xa4, 0x4c, 0x1a, 0x45, 0x97, 0x75, 0x64, 0x2c, 0xef, 0x50, 
+  0x20, 0x8c, 0x2a, 0x74, 0xac, 0x71, 0xd2, 0x18, 0xd8, 0xf2, 0xfe, 0xe7, 0x31, 0x03, 0x7a, 0xf7, 
+  0x95, 0x5d, 0x17, 0xa8, 0x4e, 0xf0, 0x67, 0x28, 0xf2, 0x86, 0x0e, 0xd2, 0x85, 0x89, 0xfb, 0x28, 
+  0x81, 0x29, 0x4f, 0xea, 0x60, 0x4c, 0xb3, 0xb8, 0xe6, 0xfe, 0x0b, 0x11, 0xae, 0x9b, 0x73, 0x3e, 
+  0x82, 0x6f, 0x7a, 0x3d, 0xca, 0x4f, 0x02, 0x86, 0x2e, 0x54, 0x31, 0xbc, 0xe6, 0xfa, 0xb0, 0x29, 
+  0x40, 0xe7, 0xe1, 0x9a, 0x34, 0xfe, 0x31, 0x94, 0x99, 0xc0, 0x43, 0x7f, 0xb5, 0xf0, 0x4b, 0x1a, 
+  0x49, 0xb8, 0xbd, 0xd6, 0x11, 0xf2, 0xdc, 0xf3, 0xb2, 0xac, 0xc4, 0xc5, 0x84, 0xd6, 0x59, 0x86, 
+  0x0d, 0x93, 0x7b, 0x72, 0x0e, 0xfa, 0x95, 0xf4, 0x06, 0xe4, 0x36, 0x04, 0x71, 0x1e, 0xa2, 0x1e, 
+  0x9a, 0xf3, 0x5c, 0x4f, 0xce, 0xd9, 0x6c, 0x42, 0x04, 0xc2, 0x1f, 0x3a, 0x24, 0xa9, 0x2d, 0xf4, 
+  0xeb, 0xc4, 0x56, 0x4c, 0xd2, 0xa0, 0x3f, 0x32, 0xb0, 0x61, 0x5a, 0x77, 0x5c, 0xef, 0x29, 0x50, 
+  0x38, 0x73, 0xc9, 0x1b, 0xcf, 0x49, 0x49, 0x69, 0x82, 0xfc, 0xeb, 0xae, 0x9d, 0xcf, 0xc6, 0x09, 
+  0xf4, 0x2d, 0xfb, 0x5a, 0x60, 0x26, 0x1c, 0x64, 0x24, 0xcd, 0xe4, 0x05, 0xd9, 0xeb, 0x2c, 0x3a, 
+  0x61, 0x87, 0x0f, 0xa7, 0x21, 0x2a, 0x0a, 0x90, 0xbf, 0x68, 0xe3, 0x32, 0xb2, 0x7c, 0x63, 0xce, 
+  0x1a, 0x14, 0x34, 0xf5, 0x14, 0xfc, 0x6e, 0xc7, 0xd4, 0x65, 0x05, 0x8b, 0xa8, 0x86, 0xd3, 0x90, 
+  0xf1, 0x0d, 0xad, 0xa3, 0x49, 0x45, 0x6d, 0x0c, 0x89, 0x2f, 0x35, 0xfe, 0x43, 0x6b, 0x73, 0xe2, 
+  0xbd, 0x51, 0xba, 0xe9, 0xac, 0x0b, 0x72, 0x68, 0xa0, 0x08, 0x91, 0x4e, 0x34, 0xb6, 0xe4, 0x7b, 
+  0x74, 0xaf, 0x92, 0xf4, 0x85, 0xb6, 0x03, 0x44, 0x1d, 0xfe, 0x10, 0x49, 0x9a, 0x07, 0xcc, 0xf8, 
+  0x01, 0xe3, 0x62, 0x7e, 0x1c, 0x8c, 0x47, 0xa3, 0x5c, 0x40, 0xd4, 0x61, 0x85, 0x5c, 0x25, 0xf5, 
+  0xb4, 0x3c, 0xd6, 0xf4, 0x9a, 0xda, 0xd9, 0x92, 0x90, 0xa0, 0x2e, 0x86, 0xc3, 0xdb, 0x34, 0x42, 
+  0x58, 0xe8, 0x22, 0x59, 0x09, 0xc8, 0x43, 0xb8, 0x52, 0xc7, 0xa9, 0x3a, 0xae, 0x55, 0x12, 0x1f, 
+  0x6d, 0x58, 0xfb, 0xf0, 0xb7, 0xa0, 0x52, 0xe1, 0xdd, 0xac, 0x46, 0x49, 0xa9, 0x48, 0x2c, 0x96, 
+  0xb3, 0xe4, 0x1e, 0xed, 0xc7, 0x9a, 0x41, 0x92, 0x23, 0x05, 0xd8, 0xf2, 0x84, 0x43, 0xfb, 0x2e, 
+  0x69, 0xc6, 0x9f, 0xa8, 0x9f, 0xe9, 0x67, 0x0e, 0xf3, 0x0d, 0x17, 0x66, 0x85, 0x0d, 0xcf, 0x0c, 
+  0xbb, 0x4f, 0xf8, 0x29, 0x39, 0xdb, 0xa1, 0x85, 0x73, 0x3f, 0x3c, 0x4d, 0x16, 0xa3, 0xb3, 0xd1, 
+  0xfe, 0x58, 0xbf, 0x61, 0x79, 0x90, 0x2c, 0xd8, 0xc2, 0x8a, 0x13, 0xeb, 0x64, 0x15, 0xaa, 0xc0, 
+  0x5f, 0x60, 0x72, 0x21, 0x22, 0x79, 0xe9, 0x9f, 0x85, 0xe5, 0x88, 0x54, 0x3f, 0x52, 0x7c, 0xfd, 
+  0xbd, 0xb0, 0xdc, 0xd9, 0x0f, 0xc6, 0xe9, 0x41, 0x32, 0x1f, 0xa7, 0x74, 0xcf, 0x0a, 0x4c, 0x02, 
+  0xe9, 0x84, 0x74, 0x8b, 0x29, 0x5d, 0x38, 0x86, 0x4a, 0x3d, 0x4d, 0xe9, 0xc7, 0x64, 0xcd, 0x7f, 
+  0xe2, 0xa5, 0x4f, 0x3f, 0x48, 0x37, 0x39, 0x0d, 0x57, 0x7c, 0x82, 0x7e, 0x05, 0xa3, 0xfd, 0x38, 
+  0xa5, 0xff, 0x4a, 0xd5, 0x06, 0x06, 0xda, 0x3e, 0xc1, 0x3f, 0x9f, 0x84, 0x4d, 0x73, 0x41, 0x4f, 
+  0x3a, 0x1b, 0xd3, 0x94, 0x4a, 0xc7, 0xc1, 0x59, 0x72, 0x45, 0xdd, 0x4f, 0x55, 0x80, 0x02, 0xf2, 
+  0xe1, 0x43, 0x64, 0x7f, 0xcb, 0x09, 0x3c, 0xe3, 0x44, 0x1a, 0xba, 0x9c, 0x6a, 0xa0, 0xea, 0xe3, 
+  0xe4, 0x96, 0x84, 0x8d, 0x7a, 0xbd, 0x8a, 0x0b, 0xc5, 0x90, 0x59, 0x4f, 0x77, 0x76, 0x52, 0x78, 
+  0xc4, 0xe9, 0x53, 0xc4, 0x29, 0x72, 0xa7, 0x4d, 0x25, 0x54, 0x03, 0xd5, 0x3b, 0xf9, 0xb4, 0xbd, 
+  0x92, 0x4a, 0x55, 0x92, 0x51, 0x25, 0xa5, 0xae, 0xa4, 0x44, 0xde, 0x1f, 0x55, 0x1a, 0xd2, 0x39, 
+  0x12, 0x4d, 0x57, 0x1c, 0x8a, 0x74, 0x77, 0xa7, 0xe0, 0xbd, 0xf5, 0xad, 0x34, 0x66, 0xeb, 0x94, 
+  0xe9, 0x20, 0x4d, 0x43, 0xd2, 0xe3, 0x8d, 0x9b, 0x89, 0x7f, 0x36, 0xf7, 0x3f, 0x21, 0x2b, 0x36, 
+  0x27, 0xfd, 0xb9, 0xa8, 0x5f, 0xe7, 0x97, 0x79, 0x8d, 0xb4, 0x24, 0x10, 0x6a, 0xee, 0x3d, 0x5e, 
+  0x00, 0x7e, 0x1b, 0xb1, 0x5e, 0x15, 0x4c, 0x6b, 0x9b, 0x0e, 0xde, 0x55, 0x0b, 0xd1, 0xd3, 0xd0, 
+  0x67, 0x5b, 0x88, 0xa9, 0xb7, 0x6e, 0xb5, 0x71, 0xb1, 0x89, 0x59, 0xd7, 0x09, 0xd9, 0xf9, 0x43, 
+  0x5d, 0x2d, 0x28, 0x1f, 0xc0, 0x88, 0x55, 0x01, 0xac, 0x26, 0xaf, 0x4b, 0x06, 0x9e, 0x97, 0x2e, 
+  0x16, 0x78, 0x03, 0x4f, 0x20, 0xa5, 0x16, 0xc8, 0x5f, 0x89, 0x59, 0xf2, 0xb0, 0x4e, 0xe9, 0x42, 
+  0xd0, 0xd7, 0xf4, 0x74, 0x5e, 0xd7, 0xf9, 0x72, 0xc5, 0x69, 0xdf, 0x24, 0x39, 0x71, 0x6a, 0x2b, 
+  0x9b, 0x0f, 0x30, 0xce, 0xfb, 0xd5, 0xfc, 0x23, 0x8d, 0x6f, 0x17, 0x1a, 0x7c, 0x3f, 0x6a, 0x5f, 
+  0x96, 0xf4, 0x4a, 0x15, 0xd0, 0xee, 0x4b, 0xad, 0x28, 0xa6, 0x21, 0xa7, 0x72, 0x93, 0x7c, 0xb1, 
+  0x77, 0xd0, 0xf0, 0x11, 0xfa, 0x4a, 0x4f, 0x61, 0xe4, 0xde, 0xdc, 0xe8, 0x0c, 0x26, 0x66, 0x3f, 
+  0x0b, 0xc1, 0x8a, 0x6b, 0x30, 0x7d, 0x39, 0xb4, 0x82, 0x03, 0x10, 0x70, 0x43, 0x23, 0x17, 0xd4, 
+  0x61, 0xaf, 0xd8, 0xd8, 0xa0, 0x10, 0x6f, 0x4c, 0x9a, 0x45, 0x96, 0xc6, 0x69, 0xf8, 0x14, 0x4c, 
+  0x60, 0x58, 0xaa, 0x33, 0xd0, 0x50, 0xa3, 0xb5, 0x17, 0x56, 0xf4, 0xd7, 0x33, 0x47, 0xb8, 0x80, 
+  0x4c, 0x62, 0x0b, 0x83, 0x99, 0x88, 0x83, 0x2e, 0xc7, 0x1d, 0xc4, 0x8c, 0xcb, 0x64, 0x4e, 0xba, 
+  0x71, 0x78, 0xa6, 0x62, 0x5d, 0xae, 0x61, 0xd7, 0xbb, 0x0c, 0xc2, 0xcb, 0xa8, 0x9e, 0xf9, 0x67, 
+  0x34, 0x05, 0x75, 0x4f, 0x5c, 0x46, 0x59, 0x0a, 0xb5, 0x4c, 0x4d, 0x5f, 0x2a, 0x72, 0xaa, 0x7f, 
+  0x39, 0xe0, 0x69, 0x0a, 0xfa, 0xa0, 0x36, 0x84, 0x64, 0xa0, 0x01, 0x43, 0x08, 0x95, 0xa1, 0x01, 
+  0xcb, 0x84, 0x06, 0x6c, 0x5a, 0x1d, 0xeb, 0x80, 0x53, 0xfc, 0x46, 0xf5, 0x2e, 0x06, 0x09, 0x13, 
+  0x41, 0xe0, 0xca, 0x45, 0x0a, 0xf9, 0x56, 0x8d, 0x26, 0x5a, 0xe3, 0x2a, 0xa3, 0x68, 0xaf, 0x54, 
+  0x7e, 0x83, 0x8e, 0x45, 0xbb, 0x80, 0x95, 0xf8, 0x9c, 0x56, 0x15, 0xf7, 0x24, 0xdf, 0xb7, 0xd4, 
+  0x89, 0x09, 0xf3, 0xfe, 0xc4, 0x92, 0x0b, 0x9a, 0xbf, 0x2a, 0x97, 0x60, 0x39, 0x03, 0x28, 0x3e, 
+  0xc9, 0xb1, 0xee, 0x10, 0x0f, 0xf4, 0x02, 0xb8, 0x17, 0xe2, 0x9b, 0xf2, 0x7a, 0x72, 0x8a, 0x88, 
+  0xe2, 0x0c, 0xff, 0xe8, 0xf7, 0xbd, 0x0c, 0x6f, 0xc2, 0x59, 0x78, 0x8d, 0x8b, 0x9f, 0x13, 0x59, 
+  0x7e, 0xf6, 0x82, 0xf1, 0x4d, 0x72, 0x32, 0xfd, 0x7c, 0x3c, 0xfe, 0x8c, 0x45, 0x4d, 0x54, 0xe6, 
+  0x59, 0x72, 0x23, 0x6b, 0x79, 0x78, 0x13, 0xc9, 0xb4, 0x56, 0xea, 0xb3, 0x1e, 0xfb, 0xb1, 0x32, 
+  0xbb, 0xf9, 0x3e, 0xbe, 0xd1, 0x82, 0xe6, 0xd1, 0x53, 0x3a, 0xb8, 0x8c, 0x9e, 0xf2, 0x36, 0x4e, 
+  0x7f, 0x93, 0xf3, 0xf6, 0xd7, 0x69, 0x46, 0x68, 0xe5, 0xe4, 0x1a, 0x20, 0xfc, 0xbe, 0xfb, 0xdd, 
+  0xa8, 0x8e, 0x8b, 0x94, 0x9e, 0xf1, 0x6c, 0x72, 0x99, 0x08, 0x3d, 0x17, 0x35, 0x91, 0x3f, 0xfe, 
+  0xc3, 0x87, 0xb2, 0x6e, 0xa9, 0xac, 0xd4, 0x4f, 0x21, 0xea, 0x87, 0x98, 0xb3, 0x18, 0x8d, 0x5c, 
+  0xe5, 0x5d, 0x2d, 0x43, 0x71, 0xe9, 0x7f, 0xc6, 0xc5, 0xc0, 0xbe, 0x2a, 0x53, 0x37, 0x9e, 0x21, 
+  0xda, 0x6a, 0x82, 0x02, 0x33, 0x5a, 0xdb, 0x2e, 0x93, 0xdb, 0x8b, 0x34, 0xbe, 0x51, 0x61, 0x71, 
+  0xf5, 0x8c, 0xe4, 0x99, 0x37, 0x3c, 0xd0, 0x36, 0x7d, 0x43, 0x2b, 0x04, 0x7f, 0xee, 0x52, 0x9a, 
+  0x25, 0xdc, 0x21, 0x76, 0xa4, 0xe1, 0x05, 0x70, 0x46, 0x52, 0xf3, 0xae, 0x9c, 0x75, 0x79, 0xad, 
+  0xa3, 0x50, 0x3e, 0x85, 0x6e, 0x1f, 0x4c, 0x68, 0xed, 0x48, 0x63, 0x9b, 0xf3, 0x2e, 0xa0, 0x0f, 
+  0xb4, 0xc7, 0x23, 0xc8, 0x21, 0x29, 0x29, 0x82, 0xf1, 0x65, 0x72, 0xaa, 0xbf, 0x16, 0x6f, 0xd5, 
+  0x78, 0x7d, 0xc1, 0x4c, 0x52, 0x28, 0xd2, 0x97, 0xe1, 0x11, 0x6b, 0x58, 0xe8, 0x41, 0x5a, 0x56, 
+  0x30, 0x5b, 0xd0, 0x3b, 0xb4, 0xdf, 0x9d, 0x24, 0x28, 0x4c, 0x9f, 0x6b, 0xbc, 0x4e, 0x1c, 0x03, 
+  0x61, 0xb8, 0x4a, 0x4e, 0xb8, 0x8b, 0x4e, 0x84, 0x1e, 0x58, 0x78, 0xad, 0xe0, 0x72, 0x09, 0x57, 
+  0xc1, 0x78, 0x78, 0x19, 0xa5, 0x0b, 0x92, 0xc5, 0x60, 0x8c, 0xf3, 0xb9, 0x56, 0xfe, 0xa4, 0x5c, 
+  0x71, 0x88, 0x6b, 0x02, 0x79, 0x0a, 0xf7, 0x61, 0xeb, 0xdb, 0x86, 0xf2, 0x1e, 0xe3, 0xcf, 0x8d, 
+  0x43, 0x73, 0x34, 0xfa, 0x1c, 0xe0, 0x5b, 0x42, 0x05, 0xa2, 0x3f, 0xf8, 0xca, 0xcf, 0x68, 0x57, 
+  0xf5, 0x2b, 0x2b, 0x3b, 0xf5, 0x5a, 0x7a, 0xce, 0x64, 0xc4, 0x2e, 0x3b, 0x0b, 0x6c, 0x97, 0x35, 
+  0xeb, 0x65, 0x55, 0x5e, 0xf2, 0x7a, 0x7b, 0x48, 0xe3, 0x42, 0xf1, 0x70, 0x62, 0xa1, 0xc1, 0x6d, 
+  0xbf, 0x77, 0x58, 0xb4, 0xfa, 0x3d, 0xd1, 0x08, 0x26, 0x42, 0xf1, 0x8e, 0x25, 0xfb, 0xad, 0x7b, 
+  0xf6, 0x0b, 0xe1, 0x14, 0x2d, 0xcf, 0xbb, 0x12, 0x83, 0x9f, 0x1d, 0x7c, 0x47, 0xba, 0x9a, 0xb2, 
+  0xf3, 0x1b, 0xca, 0x39, 0x56, 0x33, 0x02, 0x09, 0xab, 0x61, 0xa4, 0xba, 0x65, 0x59, 0x08, 0xe9, 
+  0x21, 0xf5, 0xa9, 0x8d, 0x5b, 0x17, 0x33, 0x79, 0xb4, 0x38, 0xa9, 0x43, 0x0d, 0xb3, 0x19, 0xc2, 
+  0xb0, 0x1b, 0x4a, 0x6a, 0xae, 0x6a, 0xea, 0xef, 0x2c, 0x3e, 0xfa, 0x72, 0x4e, 0xf5, 0x59, 0x91, 
+  0x22, 0xc6, 0xb6, 0x2b, 0x66, 0xfe, 0xde, 0xf2, 0x42, 0x7d, 0x9e, 0xb5, 0xfd, 0x0f, 0x8a, 0xd1, 
+  0x29, 0x5b, 0xb4, 0x4c, 0xf6, 0xc3, 0x43, 0x7a, 0x97, 0xc3, 0xa8, 0xa6, 0x1a, 0xb5, 0x67, 0x64, 
+  0x8f, 0x83, 0xbb, 0x61, 0xce, 0x3f, 0x48, 0xe4, 0x0a, 0xa2, 0xcc, 0xe4, 0x47, 0x79, 0x95, 0x15, 
+  0x16, 0xaa, 0x47, 0x03, 0x0a, 0xf6, 0xe1, 0x83, 0x67, 0x60, 0xbd, 0xbe, 0x6a, 0x52, 0x61, 0xf5, 
+  0xa6, 0xbf, 0xbf, 0xf1, 0x95, 0xa3, 0xeb, 0x2f, 0xf6, 0x38, 0xac, 0xce, 0x58, 0x83, 0x3f, 0x86, 
+  0x45, 0x22, 0x3b, 0x7e, 0x79, 0xf0, 0x55, 0x87, 0xc9, 0xa6, 0x1a, 0xa8, 0x98, 0x67, 0x58, 0x0c, 
+  0x05, 0x4b, 0x9b, 0xdb, 0x09, 0x88, 0xca, 0xba, 0x2c, 0x07, 0xe5, 0x72, 0x11, 0x0d, 0xde, 0x92, 
+  0x50, 0x01, 0xfc, 0xd9, 0xab, 0xd3, 0x2a, 0x5d, 0x30, 0x5d, 0x83, 0x5d, 0x72, 0x3f, 0xda, 0x8b, 
+  0xf6, 0xae, 0xaa, 0x6c, 0x50, 0x56, 0x03, 0xb4, 0xa8, 0x8a, 0x54, 0x7e, 0x43, 0x9e, 0xe8, 0xb0, 
+  0x01, 0xba, 0x0a, 0x39, 0x20, 0x67, 0xd8, 0x01, 0x2d, 0xfd, 0x08, 0x08, 0xb0, 0xfe, 0x90, 0xc0, 
+  0x4c, 0x20, 0x55, 0xe9, 0xd0, 0x68, 0x06, 0xca, 0xfe, 0x70, 0x7b, 0x7b, 0x51, 0x7e, 0xe0, 0x30, 
+  0x93, 0x07, 0x39, 0x5d, 0x8a, 0x2e, 0x4a, 0xa5, 0x6d, 0x2a, 0x43, 0xc6, 0x66, 0xe3, 0x8d, 0xf2, 
+  0x11, 0x15, 0xdb, 0x55, 0xe5, 0x36, 0x1b, 0xaf, 0x89, 0x57, 0xb0, 0x1f, 0x8c, 0x50, 0x57, 0xda, 
+  0xe2, 0xa6, 0x0a, 0x2e, 0x1f, 0x11, 0x8b, 0x87, 0x7a, 0xa1, 0xb8, 0x6d, 0x57, 0x1b, 0xd7, 0x24, 
+  0x00, 0x98, 0xb6, 0xa8, 0x34, 0x87, 0x00, 0x7a, 0x9c, 0x7c, 0x50, 0x15, 0xce, 0x16, 0x28, 0xea, 
+  0xbe, 0xa3, 0xd2, 0xaf, 0xda, 0xd9, 0x4f, 0x8b, 0xfc, 0x13, 0x72, 0x85, 0x0e, 0xa3, 0x13, 0x05, 
+  0x3d, 0xb5, 0x82, 0x67, 0x93, 0xea, 0xb5, 0x40, 0xe9, 0xbf, 0x1c, 0x2a, 0x64, 0xf6, 0x3e, 0xe9, 
+  0x89, 0x39, 0xcd, 0x80, 0x81, 0x6f, 0x89, 0x43, 0x83, 0xdb, 0x81, 0xe1, 0x8d, 0x06, 0xb4, 0x28, 
+  0xdc, 0xfa, 0xc1, 0x80, 0x3a, 0x41, 0x3d, 0x87, 0x56, 0xf7, 0xde, 0x60, 0x90, 0xe0, 0xf6, 0x63, 
+  0xc4, 0x0e, 0x6d, 0xdf, 0x3b, 0x10, 0xb7, 0x29, 0x07, 0xd6, 0x24, 0x8f, 0xf0, 0xf6, 0xbb, 0xc8, 
+  0xbc, 0x7d, 0x34, 0xc8, 0x17, 0x89, 0x02, 0x3d, 0xfa, 0x9e, 0xf1, 0x53, 0x0f, 0xde, 0xef, 0x4a, 
+  0xd1, 0xef, 0x11, 0x78, 0xb2, 0x77, 0x00, 0xf3, 0xac, 0x35, 0xbe, 0x55, 0xf3, 0x92, 0x5b, 0x8c, 
+  0xf1, 0x98, 0x06, 0xb4, 0x6c, 0x0f, 0x0f, 0xf6, 0x07, 0x77, 0x77, 0x83, 0x47, 0x8f, 0x82, 0x31, 
+  0xb5, 0xc9, 0x2d, 0x8e, 0xef, 0xa5, 0x8b, 0x0b, 0xc7, 0xd9, 0x3e, 0xbd, 0x90, 0x17, 0x82, 0xdc, 
+  0x36, 0x8b, 0xbd, 0xcd, 0xc0, 0x13, 0x8b, 0xd9, 0xe7, 0xd9, 0xff, 0xe9, 0xed, 0xca, 0x9a, 0x9b, 
+  0x56, 0xb2, 0xf0, 0xfb, 0xfd, 0x15, 0xc1, 0x93, 0x72, 0x49, 0x93, 0x8e, 0x09, 0x77, 0xde, 0x24, 
+  0xba, 0x5c, 0x6c, 0x97, 0x84, 0x0b, 0x04, 0xc2, 0x36, 0x94, 0xc7, 0x45, 0x09, 0x5b, 0xc1, 0xc2, 
+  0x89, 0xe5, 0x58, 0x72, 0x20, 0xc4, 0xe2, 0xb7, 0xcf, 0xf9, 0x4e, 0x2f, 0x6a, 0x6d, 0x0e, 0xb9, 
+  0x73, 0x6b, 0x5e, 0x12, 0xb9, 0xf7, 0xe5, 0xf4, 0xe9, 0xd3, 0x67, 0x6d, 0xe2, 0x21, 0xa3, 0xf4, 
+  0xcd, 0xbf, 0xbe, 0x7f, 0x66, 0x0b, 0x58, 0x18, 0xfe, 0xf0, 0x99, 0x8f, 0x4d, 0xd8, 0xe1, 0x0b, 
+  0xc0, 0xe9, 0x5b, 0xea, 0xb2, 0x79, 0xe4, 0xbf, 0xb3, 0x2b, 0xe0, 0xa2, 0x2d, 0xd0, 0x80, 0x8a, 
+  0xe2, 0xde, 0xef, 0xab, 0xff, 0x83, 0xe8, 0x7c, 0x3a, 0x54, 0x9f, 0xde, 0xa8, 0xa7, 0xf8, 0x93, 
+  0xd0, 0xb5, 0xd5, 0x9e, 0x6b, 0x7b, 0x63, 0x44, 0xd8, 0x2b, 0x7d, 0x89, 0x48, 0xcf, 0x89, 0x03, 
+  0x5f, 0x32, 0x94, 0x55, 0xb5, 0xa1, 0x93, 0x17, 0x18, 0x0b, 0x58, 0x9d, 0xc7, 0x4c, 0x81, 0x1b, 
+  0x9a, 0x39, 0x4f, 0xa7, 0xeb, 0xb3, 0xb8, 0xb5, 0x15, 0x95, 0x05, 0x77, 0xed, 0xfa, 0x53, 0xc7, 
+  0xd9, 0xc8, 0x36, 0x1b, 0xd3, 0x41, 0x10, 0x7b, 0x9f, 0x10, 0xee, 0xe3, 0xba, 0xa8, 0xca, 0xda, 
+  0xe2, 0x2e, 0xff, 0x95, 0x7a, 0x8a, 0x37, 0x8f, 0xeb, 0xff, 0x37, 0x3d, 0x3f, 0xf6, 0xf4, 0xa8, 
+  0xbc, 0xde, 0x7c, 0x41, 0x67, 0x05, 0x36, 0xe7, 0x74, 0xb0, 0x75, 0x27, 0xdb, 0x1c, 0x6a, 0x36, 
+  0xb7, 0xd5, 0xb7, 0xdb, 0x6a, 0x9b, 0x12, 0x76, 0x87, 0xc7, 0xc2, 0x65, 0xd3, 0xb5, 0x8c, 0x76, 
+  0x9e, 0x6a, 0x7c, 0xca, 0x40, 0xa8, 0x70, 0xea, 0x9f, 0xba, 0x1d, 0x20, 0x50, 0x3d, 0xce, 0xa9, 
+  0xd8, 0x59, 0x2a, 0x0c, 0x1a, 0x2f, 0xb2, 0x35, 0x21, 0xca, 0x84, 0x73, 0xd9, 0x0d, 0xe5, 0xd4, 
+  0xf0, 0xe0, 0xf1, 0x4b, 0x39, 0x08, 0xa7, 0xac, 0x73, 0x75, 0x71, 0x53, 0xb5, 0xf5, 0x97, 0xfd, 
+  0x04, 0x66, 0x45, 0xb1, 0x37, 0x4f, 0xc5, 0x3c, 0x1d, 0xe8, 0x1c, 0xde, 0xc1, 0xa2, 0x44, 0x03, 
+  0x87, 0xe2, 0xc4, 0xbf, 0x3e, 0xb4, 0xb9, 0x27, 0x7c, 0x38, 0x8e, 0xc4, 0x2e, 0x91, 0x4d, 0x77, 
+  0x0e, 0xc4, 0x1f, 0xb2, 0xc7, 0x46, 0xff, 0x3a, 0x9b, 0x6e, 0x1a, 0xa2, 0xbd, 0x0f, 0x07, 0x26, 
+  0xfa, 0x53, 0x7e, 0x6c, 0x19, 0x85, 0xd0, 0xb9, 0x42, 0x9c, 0x14, 0xed, 0xd1, 0x93, 0x16, 0x43, 
+  0x71, 0xf3, 0xe8, 0x63, 0x1e, 0x5f, 0xe1, 0x9d, 0x07, 0xba, 0xe2, 0x11, 0xab, 0xb3, 0x4e, 0x69, 
+  0x81, 0x3e, 0x00, 0xa5, 0x31, 0x63, 0x94, 0x79, 0xb3, 0xc1, 0xa8, 0x67, 0x38, 0xaf, 0xd0, 0x40, 
+  0x67, 0xd6, 0x31, 0xec, 0x45, 0x27, 0xe9, 0xf2, 0x0a, 0xff, 0x15, 0x47, 0x12, 0x49, 0x05, 0xd1, 
+  0x59, 0x71, 0xe8, 0xc8, 0xe8, 0xca, 0x20, 0xda, 0xfa, 0x06, 0x2b, 0x05, 0xe1, 0xe0, 0xa0, 0x19, 
+  0x06, 0x86, 0x76, 0x09, 0x4c, 0x84, 0x7c, 0xb2, 0xbf, 0x1f, 0xf2, 0xeb, 0x25, 0x86, 0x27, 0xb5, 
+  0x15, 0x98, 0x36, 0x86, 0xb0, 0x8a, 0x91, 0x95, 0x8e, 0x72, 0x09, 0xf5, 0x87, 0x31, 0x5d, 0x33, 
+  0xf4, 0x3d, 0x96, 0xf7, 0x84, 0x0e, 0xf5, 0x92, 0x97, 0x2f, 0xf0, 0xa8, 0x26, 0x1f, 0x32, 0xfe, 
+  0x29, 0xec, 0xab, 0x68, 0x87, 0xbd, 0x56, 0xb0, 0x8b, 0xdc, 0x86, 0xfb, 0xff, 0x7e, 0x1f, 0xa1, 
+  0x90, 0x7d, 0xe6, 0xd9, 0x9e, 0xe0, 0x15, 0x03, 0x59, 0x1d, 0x91, 0x72, 0x94, 0x86, 0x68, 0x74, 
+  0x31, 0x3f, 0x9d, 0xd4, 0x8a, 0xc1, 0xde, 0x1f, 0x0c, 0x4a, 0xcd, 0xe9, 0x64, 0x2d, 0xe5, 0x53, 
+  0x2e, 0x2a, 0xb8, 0x8d, 0x32, 0xa4, 0x5b, 0x22, 0x75, 0x0d, 0x3a, 0x22, 0xb5, 0x46, 0x6d, 0x63, 
+  0x95, 0x2c, 0x5d, 0x1f, 0x61, 0x03, 0x92, 0xe1, 0x99, 0xd3, 0x66, 0x80, 0xbf, 0x8e, 0xf8, 0xf4, 
+  0xbd, 0xcb, 0xb0, 0x2e, 0x15, 0x07, 0x98, 0x9d, 0xef, 0x33, 0x57, 0x3f, 0xaf, 0x08, 0xcc, 0xbe, 
+  0xd4, 0x63, 0x9b, 0xbf, 0xf7, 0xb0, 0xd9, 0x60, 0x5f, 0x45, 0x56, 0xe2, 0x1c, 0xc2, 0x2a, 0x35, 
+  0x5c, 0xed, 0xef, 0x1b, 0xc1, 0x39, 0xc2, 0x35, 0x85, 0x88, 0x61, 0x0b, 0x0e, 0xec, 0xa8, 0xd7, 
+  0x1b, 0x3b, 0xa2, 0x1f, 0x15, 0xaa, 0x1e, 0xde, 0x29, 0x90, 0x01, 0x18, 0x16, 0xfc, 0x85, 0xf0, 
+  0x42, 0x1c, 0x0c, 0xd7, 0x7a, 0xad, 0x46, 0x08, 0xdc, 0xd2, 0xf5, 0x8c, 0xb7, 0x18, 0x28, 0x58, 
+  0x92, 0x4b, 0x30, 0x73, 0xf9, 0x53, 0x98, 0x34, 0xd8, 0x00, 0x6a, 0xf0, 0x53, 0xd9, 0xea, 0xbb, 
+  0x4c, 0xf5, 0x39, 0x2a, 0xc0, 0xf2, 0x8a, 0x73, 0xf1, 0xa1, 0x7f, 0x23, 0x5d, 0x03, 0x24, 0x67, 
+  0xe9, 0xef, 0x32, 0xd5, 0xf7, 0x85, 0xd3, 0xb1, 0xf9, 0x14, 0x59, 0x6b, 0xc7, 0xf6, 0x1b, 0xf9, 
+  0x8d, 0x8e, 0xd5, 0x87, 0xc8, 0x5a, 0x3a, 0xb6, 0xdf, 0x94, 0x6b, 0x3a, 0xa6, 0x02, 0x38, 0xab, 
+  0xf1, 0x54, 0x43, 0x5b, 0x12, 0xc3, 0x4a, 0xaa, 0x9e, 0xc4, 0x44, 0x1d, 0xb7, 0x9c, 0xd4, 0x4a, 
+  0xd6, 0x93, 0x54, 0xc9, 0xc2, 0x71, 0x36, 0xe9, 0x4a, 0x88, 0x4a, 0x99, 0xcc, 0x10, 0x4f, 0xe4, 
+  0xa0, 0x04, 0x59, 0x07, 0x00, 0xfd, 0x52, 0x50, 0x63, 0xcb, 0xe7, 0xc3, 0xbc, 0xab, 0x7c, 0xee, 
+  0x97, 0x66, 0x1d, 0x87, 0x03, 0xf5, 0x52, 0xe1, 0x62, 0x4f, 0xe9, 0xb9, 0x92, 0x64, 0xf4, 0xc4, 
+  0x98, 0x28, 0xbf, 0x23, 0x99, 0xf2, 0x75, 0x8f, 0x98, 0x0d, 0x95, 0x50, 0x98, 0xef, 0xe0, 0x3c, 
+  0xd1, 0x68, 0x7a, 0xb5, 0xe2, 0xaa, 0xb0, 0x35, 0xb5, 0xc1, 0x0a, 0x36, 0xd4, 0x6f, 0xf5, 0x12, 
+  0xb3, 0x77, 0x93, 0xcf, 0x92, 0x82, 0xd8, 0xd8, 0x98, 0x70, 0x1c, 0x83, 0x78, 0xa5, 0xa9, 0x31, 
+  0x6a, 0x46, 0xc0, 0xb9, 0xf2, 0x92, 0xb0, 0x36, 0x24, 0xdd, 0xf7, 0xc2, 0x46, 0xbe, 0xf1, 0x80, 
+  0x13, 0xc9, 0x89, 0xee, 0xd1, 0x3a, 0x61, 0xdd, 0x6c, 0x40, 0xe2, 0x3a, 0x9a, 0x42, 0xd6, 0x21, 
+  0xec, 0x6d, 0xe6, 0x33, 0xd1, 0xea, 0x52, 0x87, 0x83, 0x24, 0xfb, 0x00, 0x82, 0x0d, 0xa9, 0x65, 
+  0x3e, 0xf4, 0x5e, 0xda, 0x2b, 0xc6, 0x7a, 0x4a, 0x93, 0x4e, 0x3f, 0xb3, 0x29, 0x0d, 0xaf, 0xb2, 
+  0x39, 0xea, 0xa9, 0x7a, 0x44, 0x64, 0x2f, 0xad, 0x7e, 0xae, 0x84, 0xfb, 0x8e, 0x03, 0x56, 0xd7, 
+  0xfb, 0xaa, 0x76, 0x4c, 0xbb, 0xa8, 0xba, 0xa4, 0x35, 0x67, 0x56, 0x19, 0x29, 0x56, 0x57, 0x8a, 
+  0xc5, 0xb8, 0x66, 0x71, 0xd6, 0xcc, 0xfc, 0xf8, 0xf4, 0x6d, 0x05, 0x98, 0x5e, 0x49, 0xe3, 0xc1, 
+  0xe7, 0xf1, 0xb1, 0xcc, 0xc5, 0xaa, 0x60, 0xcb, 0x3e, 0x85, 0xac, 0x11, 0x5b, 0x28, 0x2a, 0x44, 
+  0xeb, 0x14, 0x07, 0xa7, 0x0b, 0x39, 0xa1, 0x3f, 0x94, 0x0b, 0x2a, 0x7f, 0x9d, 0xd3, 0xe3, 0xac, 
+  0x7d, 0x69, 0xb5, 0xae, 0x4d, 0xe9, 0x85, 0xb7, 0x7d, 0xc9, 0xf2, 0x1b, 0x5b, 0x72, 0x4f, 0xd1, 
+  0x33, 0x03, 0x62, 0x2e, 0x0f, 0x2d, 0xb1, 0x7c, 0xf7, 0x70, 0x75, 0x3f, 0x61, 0x1e, 0x1a, 0x1e, 
+  0x89, 0x30, 0xe6, 0x55, 0xbc, 0x34, 0xc6, 0xd4, 0xf0, 0xe1, 0x6c, 0xc0, 0x24, 0x74, 0x23, 0x0d, 
+  0xdb, 0xc6, 0xa7, 0xee, 0x75, 0xe4, 0xa2, 0x42, 0x99, 0x73, 0x20, 0xf7, 0x0a, 0x3d, 0xe2, 0x1c, 
+  0xbc, 0x85, 0x01, 0x68, 0x7b, 0xec, 0xd6, 0x0b, 0xac, 0xb2, 0x03, 0x31, 0x6e, 0xd8, 0xd6, 0x1f, 
+  0xed, 0x73, 0xf0, 0x00, 0xa3, 0x1d, 0xd5, 0x4b, 0x51, 0x92, 0x9d, 0xa1, 0x0d, 0xcf, 0xb2, 0x62, 
+  0x7d, 0xeb, 0xa9, 0x97, 0x52, 0x93, 0xee, 0x24, 0xd3, 0xa2, 0x41, 0x28, 0x7d, 0x98, 0xc5, 0x0b, 
+  0xab, 0x79, 0x40, 0x94, 0x8d, 0x22, 0x34, 0xfe, 0x29, 0x58, 0x6f, 0x9a, 0x88, 0x0d, 0x13, 0xb3, 
+  0x61, 0xe7, 0x5b, 0xa4, 0x64, 0x4e, 0xa7, 0x29, 0x4d, 0xf9, 0x4e, 0xcf, 0x19, 0xfc, 0xbf, 0x2b, 
+  0x68, 0xac, 0x02, 0xc9, 0x2f, 0xa2, 0xa5, 0xb7, 0x65, 0x06, 0x6d, 0xbc, 0xc5, 0x7c, 0xa8, 0xd6, 
+  0x1c, 0x9e, 0x94, 0xcb, 0x3e, 0x9e, 0x96, 0x86, 0x14, 0x6d, 0xf7, 0xb2, 0xef, 0x97, 0xf7, 0xe3, 
+  0x41, 0xb8, 0x28, 0x99, 0x3b, 0x0b, 0x5a, 0x96, 0xdc, 0x86, 0x9d, 0xaf, 0xd0, 0x13, 0xb1, 0x1f, 
+  0xb7, 0x12, 0x13, 0x70, 0x7a, 0x69, 0xfb, 0x7d, 0xad, 0x89, 0x72, 0x23, 0xdc, 0xf6, 0x8d, 0x05, 
+  0x81, 0xd6, 0xe5, 0x74, 0xc7, 0x60, 0xfc, 0xe7, 0x94, 0xe8, 0x0d, 0x2e, 0x08, 0xed, 0x70, 0xf3, 
+  0xb2, 0xd5, 0x8f, 0x4e, 0x80, 0x27, 0x78, 0x18, 0x2f, 0x75, 0x8a, 0xef, 0xfe, 0xbc, 0xfb, 0x45, 
+  0xf4, 0x7e, 0xfe, 0xec, 0x39, 0x49, 0xff, 0x19, 0x71, 0xda, 0xc8, 0x4d, 0x1b, 0x73, 0xd2, 0xb8, 
+  0x52, 0x6c, 0xc0, 0x69, 0x83, 0x5e, 0xcd, 0xba, 0x57, 0x81, 0x13, 0x91, 0x7d, 0x09, 0xe8, 0x35, 
+  0x7e, 0x8d, 0x66, 0xd1, 0x65, 0xdc, 0x6a, 0xba, 0x5c, 0xd9, 0xbc, 0x23, 0xcd, 0x13, 0x81, 0x8f, 
+  0x57, 0x10, 0x18, 0x8b, 0x61, 0x32, 0x5a, 0x8c, 0x65, 0x1e, 0x10, 0xca, 0x30, 0xc1, 0xfa, 0x12, 
+  0x4b, 0xcb, 0xe9, 0x87, 0x6e, 0x3d, 0xfe, 0xab, 0xb9, 0x39, 0xba, 0xda, 0x35, 0xbc, 0x9a, 0xfb, 
+  0x74, 0x8d, 0x25, 0x70, 0x2d, 0xa4, 0xae, 0xb5, 0xc2, 0x8d, 0xe3, 0x6c, 0xe6, 0x80, 0xdb, 0xb3, 
+  0xd9, 0xb8, 0x36, 0xe1, 0x8f, 0x9d, 0x00, 0x97, 0xb2, 0xb7, 0xbb, 0xbb, 0xdb, 0xd3, 0xf1, 0x45, 
+  0x56, 0x88, 0x56, 0xd4, 0xe5, 0x91, 0x1b, 0xfa, 0x10, 0x90, 0xf5, 0xd3, 0x81, 0x48, 0x04, 0x4a, 
+  0x4a, 0x08, 0xde, 0x8b, 0xce, 0x65, 0x42, 0xb7, 0x9c, 0xae, 0x75, 0xcb, 0x5b, 0xe7, 0x6c, 0x63, 
+  0x52, 0xc7, 0xbe, 0x92, 0x34, 0xd3, 0x23, 0xe1, 0x84, 0xee, 0x8d, 0x17, 0x4c, 0x39, 0x6c, 0x59, 
+  0x9e, 0x96, 0x23, 0xe2, 0x20, 0x9d, 0x7c, 0xf4, 0x07, 0x11, 0xec, 0x27, 0x03, 0x28, 0x2b, 0x3d, 
+  0x7b, 0x53, 0xd7, 0x82, 0x3a, 0x68, 0xd3, 0x11, 0xbe, 0xf1, 0xb8, 0xab, 0xb6, 0xe8, 0x65, 0x14, 
+  0x65, 0x19, 0x1f, 0x79, 0xed, 0x0d, 0xff, 0x2a, 0x5d, 0xd3, 0x89, 0x47, 0xc8, 0x06, 0x0e, 0x7b, 
+  0x7a, 0x49, 0x8b, 0x35, 0xd0, 0x41, 0x5b, 0xb5, 0xf7, 0x04, 0x08, 0x05, 0xbd, 0x23, 0xc0, 0xd5, 
+  0x2e, 0x2f, 0xdf, 0x39, 0xdd, 0x53, 0x7b, 0x7b, 0xe2, 0xf7, 0x96, 0x61, 0x40, 0x9e, 0xeb, 0xa8, 
+  0x1e, 0xd3, 0x34, 0x86, 0x0b, 0xe9, 0xa6, 0x04, 0x79, 0xe5, 0xa7, 0x2f, 0xfe, 0xd5, 0xde, 0x4a, 
+  0xb5, 0x98, 0x70, 0x1b, 0xf9, 0x7d, 0xcc, 0xba, 0x07, 0x54, 0xe4, 0x3d, 0xc4, 0x2a, 0xd4, 0x47, 
+  0xc3, 0x60, 0x75, 0x27, 0xf5, 0x94, 0xc4, 0x16, 0xae, 0x6e, 0x27, 0xc2, 0x1a, 0x60, 0xb5, 0x61, 
+  0x94, 0xce, 0x1d, 0x41, 0xbc, 0x8e, 0x89, 0x9c, 0x80, 0x4f, 0x06, 0x1c, 0x5b, 0x6e, 0xab, 0x35, 
+  0x78, 0x49, 0xba, 0xb7, 0x33, 0xf2, 0x69, 0x5c, 0xe1, 0x9a, 0x86, 0x98, 0x88, 0xb5, 0x52, 0xda, 
+  0x39, 0x93, 0xd7, 0x1c, 0xd4, 0x2d, 0x13, 0x4a, 0xb3, 0x29, 0x88, 0x37, 0x9b, 0xdc, 0x84, 0x3a, 
+  0x6d, 0xd2, 0x0a, 0x6b, 0xbe, 0xbc, 0xf0, 0x57, 0xb3, 0xae, 0x5c, 0x9d, 0x2e, 0x13, 0x6e, 0x5e, 
+  0x55, 0x5f, 0xb6, 0xc1, 0xe4, 0x3b, 0xef, 0xa8, 0xe9, 0x18, 0x74, 0xa7, 0x73, 0xc0, 0x79, 0xc3, 
+  0x2f, 0xee, 0xd0, 0xe9, 0xdb, 0x53, 0x43, 0x67, 0x89, 0x2b, 0x6b, 0x62, 0xe8, 0x29, 0x9c, 0x69, 
+  0x2d, 0x2d, 0x91, 0xcd, 0x93, 0x65, 0xf0, 0xa1, 0xf0, 0x83, 0x5b, 0x54, 0x62, 0xaf, 0x99, 0xda, 
+  0x0d, 0xd4, 0xd6, 0xf9, 0xab, 0x9b, 0xaa, 0x7b, 0xfe, 0xb3, 0x56, 0x0c, 0xa7, 0x7a, 0xcf, 0x3b, 
+  0x87, 0x9c, 0xb3, 0x8a, 0x55, 0xb0, 0xe5, 0x44, 0x16, 0x25, 0xf1, 0xd2, 0x4e, 0x0a, 0x2a, 0x62, 
+  0x76, 0x90, 0x3a, 0x34, 0xa0, 0x2f, 0x9c, 0x21, 0xe3, 0xe6, 0xe7, 0x11, 0x5e, 0xca, 0x5d, 0xe5, 
+  0x58, 0x9d, 0xd5, 0x95, 0x2e, 0xcd, 0x2d, 0x7d, 0x19, 0x32, 0xc7, 0x58, 0x01, 0x98, 0xd6, 0xa2, 
+  0x80, 0xe4, 0x4c, 0x9c, 0x43, 0x6f, 0xf4, 0xaa, 0x35, 0x6c, 0x76, 0x11, 0x3a, 0x2b, 0x43, 0xd7, 
+  0x36, 0x8d, 0xe0, 0x4a, 0x9a, 0x1f, 0xa8, 0x78, 0x00, 0x4a, 0x24, 0xc9, 0x2a, 0xc0, 0x48, 0x07, 
+  0x98, 0xe8, 0xe2, 0x43, 0x67, 0xa4, 0xbc, 0xc5, 0xde, 0x88, 0xce, 0x8e, 0x7e, 0xe6, 0xd4, 0xbd, 
+  0x6f, 0xd9, 0x75, 0x6c, 0x53, 0x9b, 0x19, 0xe6, 0x6d, 0x01, 0xc4, 0xa1, 0xa1, 0x01, 0x44, 0x6b, 
+  0xd7, 0x2d, 0x32, 0x8e, 0xf1, 0x5a, 0x71, 0xe6, 0x95, 0x72, 0x13, 0x54, 0x88, 0xa8, 0x32, 0x84, 
+  0x07, 0x74, 0xff, 0x36, 0x11, 0x27, 0x48, 0x8f, 0x2b, 0xff, 0x17, 0x1a, 0xe6, 0x08, 0xde, 0xad, 
+  0xb7, 0x50, 0x2e, 0x1a, 0x3d, 0x6a, 0xdd, 0xb6, 0xbf, 0x7b, 0xd6, 0x9a, 0x25, 0xf3, 0x8b, 0xd3, 
+  0xd6, 0x83, 0xf8, 0xb5, 0x79, 0x77, 0x37, 0x7d, 0xab, 0x89, 0xeb, 0xac, 0xd6, 0x0e, 0x23, 0xcf, 
+  0x17, 0x78, 0x33, 0xcb, 0x2b, 0xe7, 0x56, 0xea, 0x68, 0x78, 0xe1, 0xb4, 0xf9, 0xb4, 0x23, 0x20, 
+  0xbc, 0xe7, 0x8f, 0x6a, 0xdd, 0x52, 0xee, 0xb8, 0xac, 0xf7, 0x88, 0xb1, 0x45, 0xfd, 0x96, 0xe3, 
+  0xe9, 0x34, 0xeb, 0x35, 0x2f, 0xba, 0xb7, 0xb3, 0x78, 0x15, 0xdb, 0xf0, 0x5e, 0x88, 0xf4, 0xb5, 
+  0x30, 0x77, 0x1b, 0x8b, 0x31, 0x0c, 0x79, 0x9b, 0xcf, 0x22, 0x75, 0xdb, 0xd9, 0xe8, 0x07, 0x46, 
+  0x6e, 0x02, 0x4d, 0x57, 0x7f, 0xb8, 0x84, 0xff, 0xc3, 0x58, 0x91, 0xd3, 0xd6, 0x81, 0xc4, 0x8c, 
+  0x35, 0x3e, 0xc3, 0xee, 0xb7, 0xe0, 0x10, 0x34, 0x27, 0xdd, 0x6a, 0x8b, 0xc2, 0x6e, 0x91, 0xa6, 
+  0x93, 0x44, 0xae, 0x1d, 0x55, 0x7e, 0xa6, 0x35, 0xdd, 0x72, 0x51, 0xd0, 0x5a, 0x0f, 0xb2, 0x74, 
+  0x05, 0xd9, 0xda, 0x37, 0x2a, 0x99, 0x61, 0xbb, 0xcf, 0xfb, 0xfd, 0x6f, 0x3a, 0x91, 0x9b, 0xf8, 
+  0x2e, 0xde, 0x8a, 0xb9, 0x78, 0x64, 0xb7, 0xb7, 0xa2, 0xe4, 0xe1, 0x7d, 0x66, 0xe9, 0x2e, 0x88, 
+  0xa6, 0x37, 0x72, 0xcb, 0x75, 0x26, 0x5e, 0xa2, 0xc8, 0x63, 0x3c, 0xa0, 0x41, 0x1e, 0x43, 0xc8, 
+  0xfb, 0x56, 0xbe, 0x31, 0xf4, 0xf3, 0xf7, 0xfb, 0x6f, 0x95, 0x60, 0x17, 0x08, 0xca, 0x30, 0x1c, 
+  0xbc, 0x39, 0x01, 0xc1, 0x9b, 0x11, 0xfc, 0x0d, 0x6e, 0x36, 0xf3, 0x9d, 0x06, 0x6b, 0xc9, 0xbf, 
+  0x7e, 0x8c, 0x47, 0xba, 0xd2, 0xac, 0x7a, 0x39, 0x9a, 0x8f, 0x25, 0x0a, 0xf3, 0x75, 0xf7, 0x40, 
+  0x1c, 0x8b, 0xaf, 0xc0, 0x65, 0x9f, 0xa4, 0xdb, 0xdf, 0xa3, 0x46, 0x7f, 0x28, 0x7c, 0x11, 0xce, 
+  0xe5, 0x23, 0x88, 0x96, 0xf1, 0xe3, 0xb9, 0x9c, 0xec, 0xf5, 0x46, 0xbd, 0xbd, 0x8f, 0xde, 0x77, 
+  0x7f, 0xaf, 0x37, 0xee, 0x19, 0x65, 0xfa, 0x79, 0x55, 0x1f, 0x40, 0x8b, 0xd1, 0x1f, 0xc8, 0xc7, 
+  0x43, 0xea, 0x59, 0x09, 0xce, 0xc7, 0xc1, 0x8f, 0x6d, 0x17, 0xba, 0xd0, 0xc5, 0x00, 0xde, 0x17, 
+  0x32, 0xd5, 0xf3, 0x14, 0x0f, 0x98, 0x52, 0x88, 0xc4, 0x73, 0x3c, 0xc1, 0x4f, 0x21, 0x1a, 0xf3, 
+  0x2e, 0xba, 0x17, 0xf2, 0x82, 0x1e, 0x83, 0xc7, 0xf2, 0xd9, 0xd6, 0x7e, 0x1e, 0x88, 0x27, 0xe8, 
+  0x41, 0xca, 0x0f, 0xc3, 0x4f, 0x7b, 0x7b, 0xc1, 0xd7, 0xd1, 0xf1, 0xfe, 0xa7, 0xb1, 0xbc, 0x10, 
+  0x4f, 0x46, 0xc7, 0xe3, 0x86, 0xa2, 0xbf, 0xd1, 0x15, 0xf8, 0xeb, 0x33, 0xf9, 0x41, 0xe4, 0x8e, 
+  0x93, 0x90, 0x7a, 0x17, 0xd5, 0x39, 0xfd, 0xd2, 0x70, 0xbf, 0x62, 0x6c, 0xad, 0x43, 0xb4, 0x9a, 
+  0x17, 0xf5, 0x9e, 0x0a, 0xad, 0x90, 0x70, 0xcd, 0xce, 0x04, 0x02, 0xb3, 0x41, 0x02, 0x82, 0xc3, 
+  0xe0, 0x82, 0xf0, 0x4d, 0xe4, 0x7d, 0x55, 0x17, 0xa2, 0xbe, 0xaf, 0x5c, 0x6e, 0x76, 0xbf, 0x5f, 
+  0xc1, 0x29, 0x7f, 0xa4, 0xab, 0x27, 0x11, 0xed, 0xf2, 0x97, 0xca, 0x53, 0xb1, 0x51, 0xcb, 0x8b, 
+  0x95, 0xe7, 0x02, 0x11, 0x0f, 0xd0, 0x8b, 0x5f, 0x94, 0x56, 0xc3, 0xaf, 0x41, 0xb2, 0xa9, 0xf8, 
+  0x22, 0xd1, 0x36, 0xca, 0x4c, 0x15, 0x3a, 0x35, 0x87, 0xfc, 0x85, 0x74, 0x82, 0x05, 0x4d, 0x39, 
+  0x08, 0xc3, 0x0b, 0x3a, 0xf7, 0x2f, 0x20, 0x4a, 0x2c, 0x34, 0x36, 0xd0, 0xb9, 0x33, 0x2a, 0x18, 
+  0xd1, 0x21, 0xd2, 0xc9, 0xac, 0xbd, 0xa8, 0x38, 0x26, 0xbb, 0xea, 0xa9, 0x90, 0x09, 0x3a, 0xcf, 
+  0x4e, 0x85, 0x28, 0x7c, 0x5a, 0x0b, 0xa6, 0xa2, 0xf0, 0xcd, 0xc4, 0xa8, 0x7c, 0x11, 0xa4, 0x0f, 
+  0x00, 0xe9, 0x84, 0x7a, 0x3e, 0x6a, 0x3f, 0x00, 0xfb, 0xb0, 0x01, 0x6c, 0x45, 0xb7, 0x6b, 0xc3, 
+  0x11, 0xa5, 0x47, 0xd8, 0x0d, 0x05, 0x99, 0xfb, 0x99, 0xab, 0x99, 0x9a, 0x67, 0xea, 0x9d, 0x92, 
+  0x0b, 0x97, 0x81, 0xaf, 0xe8, 0xf2, 0xca, 0x4b, 0x7a, 0x58, 0x67, 0x1d, 0xdc, 0x5f, 0x1b, 0xee, 
+  0xa8, 0xa5, 0xca, 0xb7, 0x75, 0x68, 0x78, 0xaa, 0x65, 0xa8, 0xac, 0x08, 0x2a, 0x53, 0x68, 0x8d, 
+  0xf9, 0x97, 0x6a, 0x4c, 0x15, 0x26, 0x29, 0xde, 0x60, 0xf0, 0x12, 0xab, 0x30, 0xad, 0x26, 0x90, 
+  0x98, 0xe1, 0xb9, 0xa2, 0xb3, 0x89, 0xea, 0x82, 0xab, 0xaf, 0x45, 0xcc, 0x56, 0x07, 0x11, 0x54, 
+  0x7b, 0xa1, 0x38, 0xca, 0x16, 0x89, 0x7f, 0xcf, 0xf8, 0x3a, 0xc1, 0x24, 0xf1, 0x6f, 0x1a, 0x76, 
+  0xd7, 0x9d, 0x80, 0x76, 0x7d, 0x28, 0x31, 0x6f, 0x6b, 0x1b, 0x85, 0x3c, 0xd8, 0xcd, 0x25, 0xfd, 
+  0x3e, 0x7f, 0xc3, 0x2d, 0x14, 0xd5, 0xb1, 0x98, 0x17, 0x89, 0xc3, 0x24, 0xb8, 0xa9, 0x0d, 0x49, 
+  0xff, 0xd7, 0x0d, 0x46, 0xb5, 0x1a, 0xa2, 0x3a, 0x18, 0x76, 0x1b, 0xcc, 0x49, 0xd1, 0xd8, 0xd4, 
+  0xd9, 0x71, 0x13, 0x75, 0xd5, 0x92, 0x3c, 0x41, 0x24, 0x09, 0x88, 0x87, 0x5d, 0x33, 0xcc, 0x68, 
+  0x7a, 0x99, 0x37, 0x43, 0x45, 0x91, 0xf9, 0x01, 0x3e, 0x82, 0x2c, 0xac, 0x9a, 0x1d, 0x61, 0x53, 
+  0x5f, 0x61, 0xa3, 0x3a, 0x97, 0xc9, 0x6e, 0xc4, 0x2b, 0xee, 0x0c, 0xe7, 0x28, 0xd8, 0x86, 0xa4, 
+  0x22, 0xef, 0x95, 0x2f, 0x94, 0x14, 0xfa, 0xa1, 0x64, 0x2c, 0x3d, 0xf5, 0xb4, 0xc5, 0x8c, 0xba, 
+  0xbe, 0x51, 0xbd, 0x24, 0x70, 0xb7, 0x3e, 0xec, 0x04, 0x9f, 0xde, 0xc8, 0x53, 0x87, 0xf7, 0xa1, 
+  0x05, 0x09, 0x7b, 0x89, 0x17, 0x4a, 0x37, 0x50, 0x7e, 0x61, 0xe1, 0x15, 0xa8, 0x73, 0x36, 0x75, 
+  0x44, 0xa0, 0xf7, 0xfd, 0xfd, 0x94, 0x79, 0x50, 0xe1, 0x91, 0x75, 0x00, 0xad, 0x5f, 0x83, 0x47, 
+  0x83, 0x65, 0x0a, 0x5c, 0xa2, 0xb4, 0x95, 0xc0, 0x32, 0x01, 0x83, 0x75, 0x00, 0x8a, 0x25, 0xcf, 
+  0xcf, 0x62, 0x87, 0x87, 0x9d, 0xb4, 0x24, 0x5a, 0x01, 0xcc, 0x8a, 0x9e, 0x8e, 0xf4, 0x70, 0xc4, 
+  0x3f, 0xc1, 0x61, 0xc3, 0x4a, 0x76, 0x07, 0xd3, 0x3e, 0x10, 0x19, 0xc6, 0x45, 0xc9, 0x1f, 0x38, 
+  0x7e, 0xd9, 0x42, 0xc6, 0x31, 0x69, 0xe0, 0xa8, 0x0d, 0x71, 0xbc, 0x67, 0x6d, 0xe6, 0x68, 0xe5, 
+  0x7c, 0x07, 0x25, 0xd3, 0x61, 0x74, 0x50, 0x1e, 0x06, 0x56, 0xae, 0x7d, 0x96, 0x71, 0x73, 0xb6, 
+  0x17, 0x37, 0x28, 0x18, 0xf8, 0x21, 0x27, 0x83, 0x3c, 0xad, 0xf0, 0x26, 0x34, 0xd7, 0x2e, 0xdb, 
+  0x6c, 0x4e, 0x06, 0x08, 0x22, 0x6b, 0xbc, 0x25, 0x6a, 0x5d, 0x0e, 0x5a, 0x8f, 0xbf, 0xc6, 0xb8, 
+  0xd0, 0x42, 0x54, 0xee, 0xee, 0x97, 0xd9, 0x17, 0x25, 0xfb, 0xb0, 0x8a, 0xdc, 0x8c, 0x28, 0xa9, 
+  0xd9, 0xad, 0xd3, 0xd3, 0xb4, 0x36, 0x70, 0x5d, 0xc9, 0x8d, 0x3a, 0xaf, 0xcd, 0xfe, 0xb6, 0x77, 
+  0xa5, 0xa5, 0x52, 0xb7, 0xec, 0x4b, 0xd5, 0xba, 0x6d, 0x67, 0x2c, 0xe7, 0xba, 0x5d, 0x4f, 0xa8, 
+  0xd2, 0xd1, 0x8d, 0x81, 0x0a, 0xc9, 0x71, 0xfc, 0xc0, 0x62, 0xa1, 0xfd, 0x86, 0x93, 0xa3, 0x9c, 
+  0x83, 0x66, 0xb5, 0x5b, 0x0c, 0x6d, 0x7b, 0x49, 0x3b, 0x20, 0x53, 0x01, 0x57, 0xa3, 0x3c, 0xa5, 
+  0x0e, 0x90, 0x2a, 0xc0, 0xa0, 0x54, 0x7f, 0x77, 0x28, 0x41, 0x6e, 0x72, 0x7a, 0xc5, 0x70, 0x99, 
+  0x68, 0xaf, 0x30, 0x27, 0xb5, 0x59, 0xd5, 0x55, 0xc5, 0xe8, 0x9a, 0x68, 0x00, 0x9c, 0x39, 0xec, 
+  0x59, 0x98, 0x55, 0x2c, 0xfc, 0xd1, 0x5a, 0x0b, 0xdc, 0x56, 0x5d, 0x71, 0x59, 0xc1, 0x7b, 0x6c, 
+  0x36, 0xca, 0x46, 0x52, 0x37, 0xe2, 0xf7, 0x58, 0x83, 0x4b, 0x99, 0xc1, 0xd2, 0xf8, 0x98, 0xd7, 
+  0xbb, 0x4c, 0x34, 0xa2, 0xf9, 0xd8, 0x5e, 0x63, 0x26, 0x8b, 0x8f, 0xb6, 0xde, 0xd9, 0x86, 0x05, 
+  0x64, 0x87, 0x50, 0x4d, 0xdb, 0x54, 0xd3, 0x09, 0xa0, 0x85, 0x5a, 0x4f, 0xf2, 0x74, 0x45, 0xd9, 
+  0x8f, 0x11, 0x5d, 0x4d, 0xb3, 0xaa, 0x59, 0xa9, 0x20, 0x6c, 0x29, 0xa4, 0x22, 0xd8, 0xea, 0x52, 
+  0x0a, 0xb4, 0x0c, 0x22, 0x2a, 0x9b, 0x2f, 0x2a, 0xdb, 0xef, 0xee, 0xdf, 0xa9, 0x58, 0xaa, 0xdd, 
+  0x9b, 0x86, 0xde, 0x52, 0x2e, 0x95, 0x7d, 0x24, 0x17, 0x8d, 0xa7, 0xea, 0x8d, 0x90, 0xc9, 0x65, 
+  0x2d, 0x61, 0xb3, 0x61, 0x36, 0xa2, 0xe6, 0xdd, 0x6c, 0x63, 0x89, 0x62, 0x0f, 0x5f, 0x7b, 0xe5, 
+  0x9e, 0x41, 0x67, 0x60, 0x69, 0x2c, 0x03, 0x61, 0xde, 0x15, 0x2e, 0x09, 0x44, 0x97, 0x62, 0xc6, 
+  0x20, 0xda, 0xc8, 0x15, 0xd3, 0x56, 0x96, 0xdf, 0xcc, 0x1f, 0x8e, 0xc6, 0xc1, 0x35, 0x34, 0x6b, 
+  0xab, 0x03, 0x33, 0xfc, 0xde, 0xa9, 0xaf, 0xb9, 0x36, 0x6e, 0x6b, 0x06, 0x22, 0x9f, 0x7a, 0xb3, 
+  0x16, 0x8a, 0xce, 0x50, 0x6f, 0x77, 0x96, 0x7a, 0xfb, 0xe1, 0x86, 0xae, 0x8b, 0x1c, 0x59, 0x3a, 
+  0x84, 0xdc, 0x75, 0x25, 0xda, 0x9b, 0x9c, 0xc1, 0xfd, 0x04, 0xbb, 0xcc, 0x2f, 0x7b, 0x46, 0x24, 
+  0xbb, 0x19, 0x04, 0x5d, 0x22, 0x85, 0xea, 0xc5, 0xa5, 0xd2, 0xdd, 0x6b, 0x9b, 0xd9, 0xca, 0x1f, 
+  0xe2, 0xa2, 0x4a, 0xf7, 0xa4, 0x7a, 0x40, 0x25, 0xfc, 0x80, 0x82, 0x67, 0x6f, 0x9d, 0x4a, 0x87, 
+  0x5b, 0xd0, 0x7f, 0xe4, 0xf8, 0xb0, 0xa4, 0xde, 0x36, 0x46, 0x4d, 0x43, 0x6e, 0xa3, 0xab, 0x96, 
+  0x56, 0x08, 0x9f, 0x5b, 0x27, 0x40, 0xd8, 0x0b, 0x6d, 0x88, 0xcf, 0xb6, 0x8a, 0x32, 0x6b, 0xd0, 
+  0x27, 0xc8, 0x46, 0x2c, 0xad, 0x35, 0xc4, 0xd5, 0xd7, 0x2a, 0x02, 0x61, 0xd6, 0x20, 0xb4, 0x38, 
+  0xe8, 0x19, 0x95, 0x82, 0x22, 0x7e, 0x3b, 0xad, 0x6a, 0x01, 0xa3, 0x28, 0x8a, 0x06, 0x59, 0xb3, 
+  0xfd, 0x05, 0xc0, 0x04, 0x8f, 0x3e, 0x49, 0x81, 0x7a, 0x4f, 0x72, 0xfb, 0xea, 0xdb, 0x51, 0x87, 
+  0x52, 0xac, 0xdb, 0x06, 0xa4, 0x80, 0x58, 0x8d, 0xfc, 0x70, 0x0a, 0xea, 0xca, 0x29, 0x5e, 0x19, 
+  0xde, 0x99, 0x3f, 0x3c, 0x0b, 0x2a, 0x78, 0x33, 0xe2, 0xf3, 0x52, 0x23, 0x95, 0xb8, 0x0d, 0x22, 
+  0x63, 0xaa, 0xb0, 0x4b, 0x53, 0x22, 0xf8, 0xc5, 0x9f, 0x87, 0x34, 0x22, 0x1b, 0xaf, 0xd0, 0xb9, 
+  0xd2, 0x15, 0x8f, 0xb1, 0xe9, 0xb6, 0xa3, 0x89, 0xf3, 0xfa, 0x7d, 0x45, 0x57, 0xde, 0x91, 0x15, 
+  0x8c, 0x37, 0x74, 0x7f, 0x54, 0xbc, 0xdc, 0x09, 0xe5, 0x21, 0x37, 0xcc, 0x07, 0xa7, 0xb1, 0x8a, 
+  0x1d, 0x0b, 0x9d, 0x60, 0xa1, 0x68, 0xf4, 0x9c, 0x99, 0x6f, 0x79, 0xfc, 0x6e, 0x75, 0x56, 0xd3, 
+  0x69, 0x73, 0x6e, 0x1b, 0x45, 0x34, 0x68, 0xd9, 0x49, 0xef, 0x6b, 0x06, 0x5f, 0xcd, 0x83, 0xe8, 
+  0xec, 0x1b, 0xf8, 0x15, 0xae, 0x46, 0xb4, 0xd3, 0xc1, 0x3d, 0x78, 0x32, 0x65, 0x2e, 0x95, 0x0a, 
+  0x95, 0xde, 0x32, 0x67, 0xa9, 0x96, 0xdf, 0x30, 0x98, 0x3b, 0x56, 0xc6, 0xef, 0x6e, 0xa0, 0x82, 
+  0xfc, 0x6a, 0xa5, 0xc4, 0x1b, 0x7e, 0xbd, 0xfe, 0x0f, 0xdd, 0x76, 0x36, 0x50, 0xe9, 0xb6, 0x56, 
+  0x2a, 0xfc, 0xed, 0xee, 0xdd, 0x7f, 0xec, 0x64, 0xac, 0x56, 0xac, 0x15, 0xc8, 0xdf, 0x9d, 0x3c, 
+  0x97, 0x67, 0xc9, 0xe7, 0xc1, 0x57, 0x3e, 0x3a, 0xbf, 0xfd, 0x17, 0x62, 0x94, 0x4b, 0xd0, 0xa9, 
+  0x77, 0x02, 0x00, 0x00 };
@@ -1,4 +1,4 @@
-static const char CONTENT_OHM_JPG[] PROGMEM = {
+static const char CONTENT_OHM_JPG[] PROGMEM __attribute__((aligned(4))) = {
   0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x01, 0x00, 0x48, 
   0x00, 0x48, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x98, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00, 0x4d, 0x4d, 
   0x00, 0x2a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x05, 0x01, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 
@@ -178,3 +178,151 @@ static const char CONTENT_OHM_JPG[] PROGMEM = {
   0x8b, 0xd5, 0x85, 0xd4, 0x00, 0xb0, 0x18, 0xa7, 0x05, 0x5a, 0x5a, 0x21, 0xf2, 0x07, 0x35, 0x3c, 
   0x55, 0x8a, 0xfa, 0x0a, 0x2f, 0x31, 0x80, 0x10, 0x3a, 0x4d, 0x05, 0x94, 0x97, 0xaf, 0xff, 0xd9, 
   0x00 };
+static const char CONTENT_OHM_JPG_GZ[] PROGMEM __attribute__((aligned(4))) = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x95, 0x55, 0x7b, 0x20, 0xd3, 0x7b, 
+  0x1b, 0xff, 0xfe, 0x76, 0xb1, 0x61, 0xb4, 0xb9, 0x95, 0xa2, 0xcc, 0x6d, 0x14, 0x76, 0x11, 0x22, 
+  0x2c, 0xd1, 0x2a, 0xe2, 0xb4, 0xa4, 0xa2, 0x4e, 0x35, 0x33, 0x36, 0x31, 0x6c, 0x63, 0xe3, 0x55, 
+  0x59, 0x89, 0x42, 0x4a, 0x97, 0x53, 0xea, 0x2d, 0x19, 0x45, 0xd2, 0x71, 0x49, 0xe5, 0xe4, 0x9c, 
+  0x5c, 0xab, 0xc3, 0x49, 0xf1, 0xbe, 0xba, 0xe8, 0x72, 0x4a, 0xa2, 0x8e, 0x22, 0x3a, 0x8e, 0x9c, 
+  0xa8, 0xbd, 0xdf, 0x69, 0xed, 0xf4, 0xf6, 0x9e, 0x7f, 0xde, 0xef, 0x7e, 0xbf, 0xdf, 0x9e, 0xe7, 
+  0xfb, 0x5c, 0xf6, 0x79, 0x7e, 0xcf, 0xe7, 0xf9, 0x4e, 0x79, 0x5f, 0xf9, 0x14, 0x10, 0xfd, 0x59, 
+  0xcb, 0x59, 0x00, 0x41, 0x10, 0xb0, 0x0c, 0x7e, 0x80, 0xb2, 0x07, 0x1c, 0x5d, 0x22, 0x13, 0x44, 
+  0x02, 0x10, 0x18, 0x08, 0xe6, 0x02, 0x00, 0xf0, 0x00, 0x8b, 0xcc, 0x04, 0x58, 0x28, 0x21, 0xf0, 
+  0xf6, 0x47, 0x66, 0x69, 0xe4, 0x55, 0x88, 0x1d, 0x40, 0x4f, 0xc9, 0x28, 0xf8, 0xa0, 0xab, 0x9e, 
+  0x80, 0x00, 0xef, 0xb0, 0x4c, 0x01, 0xc0, 0xa8, 0x7d, 0x60, 0x9e, 0xa9, 0xb5, 0x4c, 0xad, 0x4f, 
+  0x7d, 0x2f, 0x5d, 0x1e, 0xb8, 0xd2, 0x82, 0xe1, 0xb4, 0xc0, 0x89, 0x3e, 0x1f, 0x00, 0xf4, 0x7e, 
+  0x00, 0x70, 0x70, 0x17, 0x43, 0x63, 0xd0, 0x69, 0xa7, 0x3e, 0xcb, 0x74, 0x1a, 0xed, 0x14, 0xf2, 
+  0x29, 0xbb, 0x52, 0xf9, 0x29, 0x85, 0xb2, 0x07, 0xa5, 0xe0, 0x4b, 0x24, 0xf1, 0x1e, 0x54, 0xaa, 
+  0x50, 0xec, 0xc4, 0x89, 0x88, 0x0b, 0xe7, 0x39, 0x71, 0xe3, 0x62, 0xa9, 0x32, 0x4e, 0x3c, 0x95, 
+  0xee, 0x44, 0xa3, 0x02, 0x4f, 0xa6, 0x2c, 0x9e, 0xc3, 0xdd, 0xc2, 0x93, 0x58, 0x84, 0xf3, 0xa2, 
+  0x04, 0x42, 0x2f, 0xca, 0x9b, 0xba, 0x7a, 0x8a, 0x85, 0x20, 0xc2, 0x8b, 0xb2, 0xd6, 0x25, 0x90, 
+  0x16, 0x18, 0xef, 0xcb, 0xe3, 0x0b, 0x96, 0xa5, 0x88, 0x78, 0xc1, 0x29, 0x41, 0xab, 0xb9, 0x29, 
+  0x5b, 0xb8, 0xee, 0x11, 0x14, 0xa6, 0xb7, 0x8e, 0xa7, 0xcc, 0x43, 0x16, 0x1b, 0x1f, 0xcb, 0x93, 
+  0x70, 0x2c, 0x64, 0xb1, 0x31, 0x42, 0xb1, 0x87, 0xcc, 0x8b, 0x32, 0x95, 0xdc, 0x03, 0xca, 0xaa, 
+  0x6d, 0x2a, 0x05, 0x3a, 0x89, 0x22, 0x22, 0x3d, 0x56, 0xf9, 0xb1, 0xd4, 0x2e, 0x50, 0xf3, 0xa2, 
+  0xa8, 0xb1, 0x48, 0xa5, 0x52, 0x27, 0xa9, 0xb3, 0x53, 0x9c, 0x28, 0x8a, 0x4a, 0x77, 0x77, 0x77, 
+  0xa7, 0xd2, 0x18, 0x54, 0x06, 0xc3, 0x11, 0x7a, 0x38, 0x8a, 0x93, 0x85, 0x12, 0x8e, 0xcc, 0x51, 
+  0x28, 0xb6, 0x82, 0x19, 0x74, 0x2c, 0xa6, 0x72, 0xf8, 0xf1, 0xc4, 0x5c, 0x91, 0x20, 0x5e, 0x22, 
+  0x88, 0x13, 0xaa, 0x73, 0xf1, 0xe0, 0xcb, 0xd6, 0x24, 0xfb, 0xaf, 0xc2, 0x54, 0x96, 0xa9, 0xca, 
+  0x60, 0xb8, 0x85, 0x85, 0xa7, 0x4a, 0xf5, 0x58, 0xb7, 0x8a, 0x27, 0x8e, 0x8b, 0x49, 0x54, 0xc5, 
+  0x7b, 0xbb, 0x31, 0x3c, 0xa9, 0xff, 0xb3, 0xa9, 0xf1, 0x0c, 0xfd, 0x3b, 0xcf, 0xd0, 0xbf, 0xf3, 
+  0xfc, 0x6b, 0x2f, 0x44, 0x28, 0x90, 0x78, 0x2f, 0x17, 0x72, 0xf9, 0x6a, 0xf7, 0xaf, 0x2c, 0x9a, 
+  0x88, 0xe0, 0xb8, 0x48, 0x89, 0x94, 0x23, 0xe2, 0x79, 0xfb, 0xa8, 0xc0, 0x5a, 0x2c, 0x8f, 0xe5, 
+  0x44, 0xf1, 0x56, 0xf1, 0x38, 0x11, 0xc9, 0xea, 0x38, 0x8d, 0x5d, 0x13, 0xa1, 0xa2, 0xd4, 0x1a, 
+  0x9e, 0x48, 0xac, 0xfa, 0x61, 0x95, 0x6c, 0xa1, 0x56, 0x20, 0x0d, 0xe8, 0xea, 0xa0, 0x2f, 0x5d, 
+  0x34, 0x71, 0xac, 0x18, 0x8e, 0x98, 0xbf, 0x52, 0x20, 0xfb, 0x6c, 0xf8, 0xac, 0x6b, 0xe2, 0xe1, 
+  0xfb, 0x51, 0xc7, 0x7f, 0xed, 0xaa, 0xc9, 0xe1, 0x1b, 0x17, 0x13, 0x27, 0x0a, 0x86, 0xd4, 0xe0, 
+  0x79, 0x87, 0x08, 0xb9, 0x9c, 0x18, 0x41, 0xb8, 0x88, 0x23, 0xe1, 0x45, 0xa8, 0xc3, 0xbe, 0xb0, 
+  0xc2, 0x1e, 0x51, 0xbf, 0x6a, 0x12, 0x6c, 0xdc, 0xa7, 0x3d, 0xd8, 0x7c, 0x48, 0x03, 0xaa, 0x86, 
+  0x2c, 0x50, 0xd1, 0xd0, 0x8d, 0x27, 0x84, 0x1c, 0x13, 0xa9, 0xc8, 0xa4, 0x7c, 0x08, 0x7c, 0x01, 
+  0x1a, 0x85, 0x52, 0x5d, 0x70, 0x61, 0xe0, 0x85, 0xc5, 0x63, 0xb1, 0x18, 0x0c, 0x56, 0x07, 0x87, 
+  0xd3, 0xc2, 0x13, 0x74, 0x08, 0x04, 0x5d, 0x1d, 0x5d, 0x5d, 0x3d, 0x7d, 0x03, 0xa2, 0x9e, 0x3e, 
+  0x49, 0x5f, 0x57, 0x97, 0x68, 0x42, 0x24, 0x19, 0x1a, 0x19, 0x1b, 0x1b, 0x13, 0xa6, 0x4d, 0x9f, 
+  0x61, 0x62, 0x34, 0xc3, 0xc0, 0xc8, 0xd8, 0x48, 0x95, 0x04, 0x41, 0xc3, 0x18, 0x0c, 0x56, 0x1b, 
+  0x8b, 0xd5, 0x36, 0xd2, 0xd3, 0xd5, 0x33, 0xfa, 0xbf, 0x97, 0xb2, 0x09, 0x90, 0xf0, 0x70, 0x80, 
+  0x1d, 0xd1, 0x08, 0x09, 0xa0, 0x48, 0x08, 0x9a, 0x84, 0x28, 0x5b, 0xc0, 0x4c, 0x00, 0x50, 0x68, 
+  0x04, 0x01, 0x7f, 0x2d, 0x2d, 0x1c, 0x0a, 0x83, 0x45, 0x4f, 0xd9, 0x90, 0xaf, 0x6d, 0x18, 0x2c, 
+  0x0a, 0xad, 0x85, 0x00, 0xe5, 0x03, 0x40, 0x40, 0x43, 0x23, 0x11, 0x4d, 0x84, 0xe3, 0x98, 0x32, 
+  0xa7, 0xe0, 0x1c, 0xfd, 0xe7, 0x16, 0xe1, 0xa5, 0xb8, 0x7d, 0x36, 0x7a, 0xad, 0x03, 0x8f, 0x19, 
+  0xed, 0x57, 0x17, 0xfd, 0xd3, 0xcd, 0xe7, 0xa6, 0xf3, 0xbd, 0x32, 0x2b, 0xd6, 0x41, 0x49, 0x19, 
+  0x8d, 0xdf, 0x52, 0xce, 0xf3, 0xb8, 0xd3, 0xbb, 0xa2, 0x78, 0x61, 0x73, 0xe2, 0x03, 0x5a, 0x7f, 
+  0x72, 0xd9, 0xe4, 0x41, 0xe3, 0xa0, 0xd2, 0x15, 0xcf, 0xcf, 0x80, 0x1f, 0x8d, 0x5c, 0xa8, 0xb2, 
+  0xdb, 0x41, 0x3b, 0xe5, 0xa6, 0xfd, 0x97, 0xb5, 0xb8, 0x41, 0x8d, 0xbd, 0x43, 0x34, 0x93, 0x68, 
+  0xca, 0x6f, 0xa2, 0xc3, 0xf3, 0xce, 0x74, 0xa3, 0x36, 0x3f, 0x24, 0xed, 0x98, 0xe8, 0x9e, 0x80, 
+  0x40, 0xc8, 0x44, 0x30, 0x85, 0x43, 0x0b, 0xfd, 0x19, 0xc8, 0x14, 0x44, 0xa0, 0xa5, 0x7a, 0x55, 
+  0x06, 0x74, 0x17, 0x88, 0x07, 0x0f, 0xed, 0x08, 0x16, 0x75, 0xb1, 0xce, 0x7f, 0x90, 0xfc, 0x61, 
+  0x2c, 0xa9, 0xe8, 0xc9, 0x72, 0xf1, 0x93, 0x40, 0x9d, 0x58, 0xc5, 0xcd, 0x1f, 0x3d, 0x79, 0xac, 
+  0x03, 0x55, 0xe3, 0xc7, 0x25, 0xeb, 0x27, 0xf6, 0x2e, 0xef, 0x0c, 0x69, 0x6b, 0xea, 0x1e, 0x4c, 
+  0x67, 0xd5, 0x95, 0xe5, 0x29, 0xc1, 0x19, 0x4e, 0x3b, 0xaa, 0x7c, 0x72, 0xa5, 0xa9, 0xd8, 0xe3, 
+  0x37, 0x6f, 0x4b, 0xe7, 0x67, 0x1f, 0x37, 0x0e, 0x6a, 0x07, 0x9e, 0xcd, 0x68, 0xb8, 0xce, 0x2a, 
+  0x0c, 0x51, 0x58, 0x35, 0xcc, 0xba, 0x35, 0x2c, 0x4a, 0xbf, 0x7c, 0xfd, 0x3c, 0x06, 0xfb, 0x3a, 
+  0x93, 0x55, 0x34, 0x30, 0x9b, 0xfb, 0xe2, 0xc2, 0xec, 0xcd, 0x5d, 0xe3, 0xe9, 0x7b, 0x67, 0x32, 
+  0xef, 0x15, 0xa6, 0x15, 0xd8, 0x3d, 0x37, 0x7d, 0x33, 0x8f, 0xf0, 0x91, 0xfa, 0x0d, 0x84, 0x47, 
+  0x21, 0x01, 0x04, 0x83, 0xc0, 0xee, 0x62, 0x35, 0xf0, 0x00, 0x6c, 0x17, 0x09, 0x6b, 0x40, 0x36, 
+  0xa4, 0xfb, 0x10, 0x8d, 0x18, 0x96, 0xce, 0xf3, 0xd9, 0x3d, 0x53, 0x20, 0x61, 0x19, 0x4c, 0xa4, 
+  0xcb, 0xba, 0x4a, 0x3b, 0x42, 0x97, 0x50, 0x33, 0x11, 0x1c, 0xe0, 0x8c, 0x30, 0x75, 0x06, 0x2b, 
+  0x62, 0xe7, 0x98, 0x77, 0x2e, 0x8b, 0x9c, 0x38, 0xf1, 0x76, 0xe0, 0x8c, 0x62, 0xf1, 0x07, 0xf7, 
+  0xbb, 0x21, 0x07, 0xe6, 0x25, 0x25, 0x31, 0x32, 0xb2, 0xd7, 0x1e, 0x29, 0xbb, 0xd6, 0x74, 0x99, 
+  0x59, 0x7b, 0xc4, 0xdb, 0x73, 0x2e, 0x65, 0xe3, 0xf4, 0x01, 0xff, 0xc9, 0xf3, 0x8b, 0x91, 0xef, 
+  0x5c, 0x4f, 0x32, 0xe7, 0x05, 0x16, 0x9c, 0xd5, 0xb7, 0xde, 0xf6, 0xcb, 0x37, 0x93, 0x97, 0xda, 
+  0xc8, 0x8f, 0x6e, 0xdd, 0xaa, 0x08, 0xc9, 0x2d, 0xbd, 0x74, 0xa3, 0x2f, 0xb8, 0xf8, 0x77, 0xef, 
+  0xde, 0xf1, 0x73, 0xa8, 0xf6, 0x0d, 0xc7, 0xaf, 0x1b, 0x33, 0x2f, 0x37, 0xe5, 0x9f, 0x3c, 0x7d, 
+  0xfe, 0x59, 0xd1, 0x7e, 0x9e, 0x79, 0x53, 0xd6, 0xf4, 0x3a, 0xce, 0xa3, 0xab, 0x84, 0x74, 0xbf, 
+  0xf5, 0xa8, 0x8b, 0x0b, 0x1d, 0xc8, 0x9d, 0xb3, 0x5f, 0x05, 0xca, 0x77, 0x38, 0x14, 0x1c, 0x8e, 
+  0xae, 0xbc, 0x4f, 0x60, 0x4a, 0x6c, 0xc2, 0xe5, 0xe2, 0x49, 0xdf, 0x73, 0xfa, 0xee, 0x3c, 0xa7, 
+  0xd2, 0xa8, 0xd1, 0x96, 0xb6, 0xf3, 0x86, 0xf9, 0xef, 0x6e, 0x77, 0x3b, 0x6f, 0xfb, 0xc9, 0xc6, 
+  0xc4, 0xb6, 0xf9, 0xdc, 0x62, 0x4b, 0x59, 0xe4, 0xea, 0x45, 0x49, 0x2f, 0x74, 0xdb, 0x12, 0x55, 
+  0xbd, 0x80, 0xe4, 0x51, 0x2d, 0xb4, 0x86, 0x17, 0x08, 0x1a, 0xb6, 0x83, 0x64, 0x40, 0x26, 0xd2, 
+  0x0d, 0x2d, 0xad, 0x18, 0x53, 0x65, 0xa2, 0x54, 0x65, 0xde, 0x28, 0x7b, 0xf3, 0xed, 0xba, 0xa5, 
+  0x9d, 0x89, 0x9b, 0xba, 0xa4, 0x06, 0xf5, 0x07, 0x3a, 0xd6, 0xec, 0xec, 0x12, 0x2e, 0xb0, 0x92, 
+  0x0c, 0x57, 0x5c, 0xdb, 0x70, 0xfa, 0xad, 0xae, 0x7d, 0x33, 0x7b, 0xfe, 0xf8, 0xab, 0xd9, 0xa6, 
+  0xdb, 0xce, 0x0e, 0x70, 0x2b, 0xef, 0x3e, 0x72, 0x64, 0xd8, 0xbf, 0xcb, 0x37, 0x9f, 0x2b, 0xb4, 
+  0xb9, 0xc7, 0xc9, 0x95, 0x22, 0x65, 0x13, 0x87, 0xba, 0x2b, 0x73, 0x7b, 0xaf, 0xf6, 0x31, 0x23, 
+  0x9a, 0xf0, 0x1e, 0x72, 0xf9, 0xdc, 0x8e, 0x31, 0x4e, 0xf7, 0x10, 0x97, 0x3a, 0x78, 0xf3, 0x66, 
+  0x86, 0xf0, 0x01, 0x29, 0x66, 0x1e, 0x6d, 0xd7, 0x73, 0x7c, 0x82, 0xf6, 0x28, 0x2f, 0x61, 0xd1, 
+  0xc7, 0x1c, 0xee, 0x2b, 0x9f, 0xeb, 0x07, 0xeb, 0x8d, 0x5f, 0x75, 0xb1, 0x3d, 0x72, 0x29, 0xdb, 
+  0xb6, 0x43, 0x88, 0x0e, 0x44, 0x80, 0x42, 0x50, 0x68, 0x2c, 0x4e, 0xd3, 0x0f, 0x04, 0x05, 0xd0, 
+  0x10, 0x21, 0x1d, 0x63, 0xe9, 0xc3, 0xe6, 0x10, 0x0d, 0x19, 0x8b, 0x57, 0x25, 0xc8, 0x8d, 0x9c, 
+  0xc3, 0x15, 0x8d, 0x6a, 0xe6, 0x68, 0x31, 0x51, 0x6b, 0xfc, 0x6b, 0x05, 0xae, 0x8b, 0xf4, 0xe3, 
+  0x6d, 0xfc, 0x77, 0x75, 0xed, 0xcc, 0x3b, 0xb2, 0xa9, 0xb6, 0xdb, 0xa1, 0xe5, 0x0f, 0xd3, 0xe3, 
+  0x27, 0x9e, 0x96, 0xd4, 0xb8, 0x5a, 0x3f, 0x7d, 0x91, 0x59, 0x1f, 0x89, 0xfd, 0x63, 0x73, 0xe8, 
+  0x13, 0x9d, 0xe3, 0x69, 0x7c, 0xae, 0xdb, 0xfe, 0x88, 0xca, 0x3b, 0xe5, 0x13, 0x1f, 0xd9, 0xb1, 
+  0x96, 0x83, 0x87, 0x24, 0x1e, 0x0f, 0x73, 0x1a, 0xc4, 0xd1, 0xc9, 0xa9, 0xf1, 0xd9, 0x5b, 0xa5, 
+  0x45, 0xe4, 0x8e, 0x36, 0x99, 0x69, 0xb6, 0x1b, 0xba, 0x8d, 0x9b, 0x5a, 0xba, 0xef, 0xc1, 0x1a, 
+  0x93, 0xea, 0x74, 0xd7, 0xc3, 0x95, 0x1f, 0x99, 0xf7, 0x37, 0xa4, 0x54, 0x55, 0xb0, 0x4d, 0x14, 
+  0xb3, 0xce, 0xe6, 0x0e, 0x26, 0x5c, 0xf8, 0xf7, 0xe3, 0x77, 0xf2, 0xd5, 0xeb, 0xb4, 0x47, 0x07, 
+  0xa4, 0xc7, 0xaf, 0x75, 0xf8, 0xae, 0xcc, 0x19, 0x98, 0x35, 0x19, 0x60, 0x7e, 0x6f, 0xb6, 0x49, 
+  0x9f, 0x63, 0x8c, 0xdb, 0xd3, 0x54, 0x47, 0xb7, 0xd2, 0xa8, 0x8e, 0x5f, 0x82, 0x7d, 0x02, 0xbe, 
+  0x3f, 0x23, 0xad, 0x5b, 0xd2, 0xb4, 0x25, 0xf2, 0x4e, 0x5d, 0x4c, 0x03, 0xed, 0x39, 0x47, 0x27, 
+  0xab, 0xe8, 0x94, 0x7c, 0xe2, 0xe2, 0x8d, 0x81, 0x4b, 0x5b, 0xeb, 0x61, 0x95, 0xb6, 0x44, 0x38, 
+  0x81, 0x08, 0x1a, 0xa5, 0xa5, 0xe9, 0x04, 0x02, 0x48, 0x64, 0x3a, 0x9b, 0xe3, 0x93, 0x40, 0x94, 
+  0x17, 0x56, 0x35, 0x0e, 0xe7, 0x75, 0xf6, 0x8c, 0x7c, 0x9e, 0x0c, 0x26, 0x59, 0x61, 0xd7, 0xd0, 
+  0x7d, 0x47, 0xd4, 0x4a, 0xd6, 0xae, 0xe9, 0xdc, 0x65, 0xb7, 0xb5, 0x3f, 0xce, 0x66, 0x4f, 0xf7, 
+  0x43, 0xc1, 0x66, 0xdc, 0xcc, 0x8a, 0xa3, 0xfd, 0xf8, 0xa3, 0xe1, 0x63, 0x95, 0xa7, 0x2b, 0xa3, 
+  0x27, 0xaa, 0x6f, 0xde, 0x4d, 0x7b, 0xb1, 0xa2, 0xdf, 0x9e, 0xea, 0xdb, 0xbb, 0xdd, 0x3d, 0xb4, 
+  0x28, 0x9b, 0x2a, 0x29, 0xcf, 0xc8, 0x7e, 0xa9, 0x9f, 0xf3, 0x83, 0xab, 0xcb, 0x87, 0x05, 0x6f, 
+  0x0f, 0x6f, 0xbf, 0x17, 0xfc, 0xe1, 0x58, 0xcc, 0xcb, 0xae, 0x9a, 0x6a, 0xd1, 0x35, 0x6e, 0xc8, 
+  0xc9, 0xf5, 0x66, 0xfe, 0x1b, 0x31, 0x7a, 0x84, 0x70, 0xf1, 0xfb, 0x1a, 0xa2, 0xa3, 0x79, 0xe3, 
+  0xd9, 0x21, 0xff, 0x75, 0xb3, 0x2c, 0x14, 0xa7, 0x53, 0xb8, 0xe7, 0x7d, 0x1b, 0xa2, 0xd1, 0x8b, 
+  0x23, 0x0f, 0x94, 0xbc, 0x7c, 0x65, 0xa2, 0x28, 0xfe, 0xe9, 0x4a, 0xea, 0x55, 0xb1, 0xb4, 0x7f, 
+  0xef, 0xa6, 0xd2, 0xc7, 0xec, 0x9f, 0x5f, 0x33, 0x43, 0x77, 0x87, 0xbb, 0x26, 0xe5, 0x7c, 0x3b, 
+  0x69, 0xa0, 0xf0, 0xba, 0x7c, 0xf6, 0xf5, 0xa2, 0x52, 0xac, 0xd6, 0xaf, 0x84, 0xb0, 0x44, 0x5d, 
+  0xd3, 0x0b, 0x78, 0x92, 0x16, 0xf2, 0xf4, 0x7d, 0xc9, 0xa6, 0x69, 0x9f, 0x4f, 0x97, 0xa9, 0x3f, 
+  0x7b, 0x62, 0x16, 0x53, 0x52, 0x6c, 0xb5, 0xb6, 0x76, 0x2b, 0x67, 0x97, 0x33, 0x17, 0xb7, 0x0f, 
+  0xd6, 0x6d, 0xa5, 0x9a, 0x36, 0x55, 0xcd, 0x38, 0xf0, 0x65, 0xdd, 0x3e, 0x9c, 0x04, 0x36, 0x51, 
+  0x9e, 0x57, 0xd5, 0xd8, 0x39, 0xac, 0x99, 0x34, 0x22, 0x3e, 0xa5, 0xd7, 0xbe, 0x2d, 0x42, 0xe7, 
+  0xc0, 0x25, 0x30, 0x59, 0xd2, 0xdb, 0xc9, 0xf7, 0x4b, 0xdf, 0xe9, 0xd7, 0xbb, 0x04, 0x6c, 0xbe, 
+  0x6e, 0x68, 0x1a, 0x4f, 0xe0, 0xcf, 0x5d, 0xa7, 0x33, 0x71, 0xca, 0x7c, 0xc4, 0x37, 0xa3, 0x97, 
+  0x6d, 0x1e, 0x42, 0x16, 0xa6, 0x54, 0xd3, 0xee, 0x8b, 0xb5, 0xbf, 0xbf, 0xbf, 0x43, 0x1e, 0x6a, 
+  0x77, 0x65, 0x2d, 0xd7, 0x3f, 0x31, 0xea, 0x57, 0x81, 0xee, 0xea, 0xb4, 0x20, 0xa7, 0x4b, 0xc1, 
+  0x66, 0x65, 0xcf, 0x90, 0xf9, 0xdb, 0xc3, 0xf4, 0x62, 0xa7, 0xed, 0x6b, 0x27, 0x97, 0xa6, 0x9d, 
+  0x3a, 0xd9, 0x52, 0xe1, 0xcb, 0x2f, 0xa1, 0xdf, 0x20, 0xb9, 0xcc, 0x75, 0xc7, 0x8d, 0xe6, 0xf7, 
+  0x98, 0x8e, 0xee, 0x4b, 0x7d, 0x50, 0x6c, 0x56, 0xbd, 0xbd, 0xa2, 0x15, 0x77, 0x2d, 0xc9, 0x35, 
+  0x68, 0xb4, 0x10, 0x05, 0x38, 0x18, 0x07, 0x22, 0xab, 0xcf, 0x28, 0x5d, 0x6b, 0x87, 0x35, 0x61, 
+  0xce, 0xdd, 0x71, 0xda, 0x26, 0x08, 0x7d, 0x0e, 0x49, 0x75, 0xa2, 0xc2, 0x73, 0x0a, 0x7c, 0x0d, 
+  0xbd, 0xb0, 0x6a, 0x78, 0x44, 0x33, 0x39, 0xc4, 0x76, 0x86, 0xd0, 0x9d, 0x9f, 0x43, 0xd1, 0x6b, 
+  0x4f, 0xd9, 0xdd, 0x9c, 0x69, 0xbb, 0x82, 0x66, 0x32, 0x6d, 0x5d, 0x2b, 0x2f, 0x7e, 0x38, 0x5f, 
+  0x8a, 0xab, 0x68, 0xdb, 0x60, 0xb6, 0xb5, 0x85, 0x74, 0xa5, 0xd6, 0x41, 0xbf, 0x52, 0xe1, 0x95, 
+  0x83, 0xf3, 0x73, 0x6a, 0xce, 0x3b, 0xfd, 0x50, 0x8e, 0x4b, 0x5e, 0x65, 0x3e, 0xb6, 0xf1, 0x78, 
+  0x7a, 0xf5, 0xd0, 0x88, 0x41, 0xf7, 0xcd, 0xc4, 0x2d, 0xde, 0xbc, 0xb5, 0xda, 0x5c, 0x17, 0x07, 
+  0xdf, 0x02, 0xd9, 0xe9, 0x66, 0x97, 0x44, 0x16, 0xf3, 0x50, 0x6b, 0x6d, 0x34, 0xc5, 0x86, 0x9d, 
+  0x5f, 0xdd, 0x51, 0x3b, 0x98, 0x51, 0x02, 0x91, 0x58, 0x43, 0xf2, 0xc0, 0x23, 0x0a, 0xad, 0x82, 
+  0xa3, 0x46, 0x42, 0x02, 0x10, 0x09, 0x3b, 0x41, 0xce, 0xc9, 0x2b, 0xac, 0xea, 0x6c, 0xfc, 0x82, 
+  0x3a, 0x44, 0x0e, 0xbb, 0x90, 0xe8, 0x80, 0x2f, 0x3f, 0x1a, 0x40, 0xc2, 0xd3, 0xed, 0x33, 0xb3, 
+  0x11, 0x6b, 0x4b, 0xec, 0x60, 0x58, 0x68, 0xdc, 0xfe, 0xc4, 0xa5, 0x3b, 0x53, 0x48, 0xa2, 0x0c, 
+  0x5b, 0x25, 0x50, 0xd8, 0xd7, 0xcf, 0x0f, 0x1f, 0xd3, 0xde, 0x3a, 0x9d, 0xd1, 0x6a, 0xe7, 0x83, 
+  0x0f, 0xb0, 0xe9, 0xff, 0x4e, 0x91, 0xd5, 0x6c, 0xc9, 0xb4, 0xcb, 0x6d, 0xbc, 0x68, 0x5b, 0xb9, 
+  0xf2, 0xf0, 0x8e, 0xf8, 0xbd, 0xdb, 0x04, 0x2b, 0x0a, 0xfe, 0xe5, 0xfe, 0xba, 0xbe, 0xcc, 0xa4, 
+  0xf5, 0x24, 0x52, 0xfe, 0xcc, 0xa6, 0xb1, 0xaa, 0xdd, 0x27, 0x9d, 0xb5, 0xe4, 0x98, 0x79, 0x1f, 
+  0x2e, 0x79, 0x24, 0x68, 0xaf, 0xf4, 0x5c, 0xd5, 0xe1, 0x3f, 0xcf, 0xf0, 0x8a, 0xf7, 0xbc, 0x48, 
+  0xe5, 0xa7, 0x96, 0xd7, 0x64, 0x18, 0x38, 0xfb, 0x61, 0x8c, 0x58, 0x48, 0x41, 0x52, 0x61, 0xb5, 
+  0x59, 0xe5, 0x91, 0xf7, 0x73, 0x56, 0x93, 0xcc, 0x8d, 0x7c, 0x37, 0x0f, 0xd9, 0xe7, 0x50, 0x3b, 
+  0xea, 0x8f, 0xf1, 0x23, 0xdb, 0x39, 0x8e, 0xb7, 0xc6, 0xc9, 0x77, 0xd3, 0xcd, 0x7a, 0x4a, 0x07, 
+  0x6c, 0xf7, 0x04, 0x87, 0x89, 0xb2, 0x64, 0x36, 0x8a, 0xbe, 0x91, 0x68, 0x13, 0x5b, 0x6f, 0x70, 
+  0xca, 0x97, 0x9f, 0x89, 0xb6, 0xf8, 0xd3, 0xa7, 0x63, 0x88, 0xed, 0x6d, 0x18, 0x82, 0xf9, 0xc7, 
+  0x6d, 0xa0, 0x18, 0x94, 0xb8, 0x2f, 0xd4, 0x2e, 0xab, 0x39, 0xd1, 0x8d, 0xf1, 0x0f, 0xfc, 0xe1, 
+  0xf7, 0xcb, 0x0b, 0x76, 0x47, 0xda, 0xd1, 0x89, 0xad, 0x8a, 0x31, 0xd2, 0xd8, 0x2e, 0xb7, 0x0f, 
+  0xfa, 0x60, 0xb4, 0x33, 0xe0, 0x5d, 0x7a, 0x7e, 0xdb, 0xc4, 0x41, 0x69, 0xf6, 0x9d, 0x5d, 0x5d, 
+  0xa0, 0x72, 0x46, 0x09, 0x36, 0x2c, 0x8c, 0xfc, 0x16, 0xe7, 0xe2, 0x19, 0x92, 0xf5, 0x5e, 0x87, 
+  0x4a, 0x4f, 0x23, 0x7a, 0x04, 0x62, 0x0f, 0x1d, 0xa9, 0x50, 0x76, 0xff, 0x07, 0xfc, 0xff, 0x00, 
+  0x31, 0x20, 0x0b, 0x00, 0x00, 0x00 };
@@ -1,2 +1,106 @@
-static const char CONTENT_STYLE_CSS[] PROGMEM = 
+static const char CONTENT_STYLE_CSS[] PROGMEM __attribute__((aligned(4))) = 
   "body{font-family:sans-serif;color:#333;font:14px Helvetica,sans-serif;box-sizing:border-box}#page,body{background-color:#fff}#page{margin:20px}iframe{max-width:100%}table{width:100%;border-collapse:collapse}th{background-color:#777;color:#fff;border:1px solid #f1f1f1}td,th{padding:8px}td{background-color:#fff;color:#777;border:1px solid #e1e1e1}tr:nth-child(2n+2){background-color:#f3f3f3}.header{padding:20px}.header h1{padding-bottom:.3em;color:teal;font-size:45px;font-weight:400;text-align:left;margin:0}.header h1,.header h1 span{font-family:Garmond,\"sans-serif\"}.header h1 span{font-weight:700;color:#000}h2{padding-bottom:.2em;border-bottom:1px solid #eee;margin-top:2px}.header h3{padding-top:-5px;padding-left:50px;font-weight:700;font-family:Arial,\"sans-serif\";font-size:17px;color:#b6b6b6;margin:-25px 0 -5px}.box{padding:20px;border:1px solid #ddd;border-radius:1em 1em 1em 1em;box-shadow:1px 7px 7px 1px rgba(0,0,0,.4);background:#fff;margin-bottom:20px}.box-full{margin:20px;width:840px}.box380,.box-half{margin:20px;width:380px}.box380{padding:20px;border:1px solid #ddd;border-radius:1em 1em 1em 1em;box-shadow:1px 7px 7px 1px rgba(0,0,0,.4);background:#fff}.left{float:left;clear:left}.right{float:right;clear:right}@media (max-width:494px){#page{width:inherit;margin:5px auto}#content{padding:1px}.box380,.box-full{margin:8px 8px 12px;padding:10px;width:inherit;float:none}}@media (min-width:494px) and (max-width:980px){#page{width:465px;margin:0 auto}.box-full{width:380px}}@media (min-width:980px){#page{width:930px;margin:0 auto}}button{background-color:teal;border-radius:5px;box-shadow:0 2px 2px 0 rgba(0,0,0,.4);border:none;color:#fff;padding:10px 28px;text-align:center;text-decoration:none;display:inline-block;font-size:1em;margin:4px 2px;cursor:pointer;outline:none}button:disabled{background-color:#eee;color:#ccc}button.on{background-color:#f1f1f1;color:#000}input[type=date],input[type=file],input[type=password],input[type=text],input[type=time],select{box-sizing:border-box;border:1px solid #ddd;border-radius:4px;margin-top:10px;width:280px;padding:5px}input:optional{border-color:#ddd}input:required{border-color:#19a6ff}input:required:valid{border-color:#249c4a}input:required:valid+.validMessage{display:none}input:required+.validMessage{display:block;margin:5px 0}.setup input[type=time],input[type=time]{width:110px}.setup input[type=date]{width:164px}@media screen and (max-width:420px){input[type=password],input[type=text],select{width:240px}input[type=time]{width:85px}input[type=date]{width:174px}}#update{background-color:red}.container{height:inherit;padding-bottom:20px}.tabs{padding-bottom:4px;overflow:hidden}.tabs:after{content:\" \";display:block;height:0;clear:both}.tabs input[type=radio]{display:none}.tabs label{background:teal;border-radius:5px;box-shadow:0 2px 2px 0 rgba(0,0,0,.4);color:#fff;cursor:pointer;display:block;float:left;font-size:1em;height:2.5em;line-height:2.5em;margin-right:.25em;padding:0 1.5em;text-align:center}.tabs input:hover+label{background:#e1e1e1;color:#000}.tabs input:checked+label{background:#f1f1f1;color:#000}#content{background:#e1e1e1;border-radius:.5em .5em .5em .5em;box-shadow:1px 7px 7px 1px rgba(0,0,0,.4);display:block}#content:after{content:\" \";display:block;height:0;clear:both}#footer{font-size:15px;text-align:center;margin-bottom:0}.small-text{font-size:10px;word-wrap:break-word}.saved{border-color:#3c763d!important;border-left-width:5px!important}.warning{border-left-color:#aa6708;border-left-width:5px}.warning h4{color:#aa6708;margin-top:0;margin-bottom:5px}.error{border-left-color:#a94442;border-left-width:5px}.error h4{margin-top:0;margin-bottom:5px}.error h4,.error td{color:#a94442}.error td:first-child{border-left-color:#a94442;border-left-width:5px}.switch{position:relative;display:inline-block;width:40px;height:24px;vertical-align:-40%}.switch input{display:none}.slider{cursor:pointer;top:0;left:0;right:0;bottom:0;background-color:#ccc}.slider,.slider:before{position:absolute;-webkit-transition:.4s;transition:.4s}.slider:before{content:\"\";height:16px;width:16px;left:4px;bottom:4px;background-color:#fff}input:checked+.slider{background-color:teal}input:focus+.slider{box-shadow:0 0 1px teal}input:checked+.slider:before{-webkit-transform:translateX(16px);-ms-transform:translateX(16px);transform:translateX(16px)}.slider.round{border-radius:12px}.slider.round:before{border-radius:50%}.info{background-color:teal;border-radius:100%;color:#fff;display:inline-block;font-family:serif;font-size:12px;font-style:italic;height:16px;margin-left:16px;text-align:center;width:16px;vertical-align:20%}.info:before{content:\"i\"}span.selected{color:teal}.ready{border-color:#01c40e;border-left-width:5px;box-shadow:1px 7px 7px 1px rgba(1,196,14,.3)}.connected{border-color:#d5ff70;border-left-width:5px;box-shadow:1px 7px 7px 1px rgba(213,255,112,.4)}.charging{border-color:#0092f7;border-left-width:5px;box-shadow:1px 7px 7px 1px rgba(0,146,247,.4)}.sleeping{border-color:#9200f7;border-left-width:5px;box-shadow:1px 7px 7px 1px rgba(146,0,247,.4)}hr{height:1px;color:#eee;background-color:#eee;border:none}.updateBad{color:red}.updateGood{color:#32c832}.updateSlow{color:#f0b414}.updateSlower{color:#ff7d14}\n";
+static const char CONTENT_STYLE_CSS_GZ[] PROGMEM __attribute__((aligned(4))) = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xc5, 0x58, 0xcd, 0x8f, 0xab, 0x36, 
+  0x10, 0xbf, 0xf7, 0xaf, 0xa0, 0xbb, 0xaa, 0xf4, 0x56, 0x2f, 0x20, 0x20, 0x24, 0xd9, 0x80, 0x2a, 
+  0xb5, 0xbd, 0xb4, 0x97, 0x9e, 0x7a, 0xa9, 0x54, 0xbd, 0x83, 0x01, 0x13, 0xac, 0x75, 0x30, 0x35, 
+  0xce, 0x66, 0xb7, 0x11, 0xff, 0x7b, 0xc7, 0x1f, 0x80, 0x0d, 0x6c, 0xbb, 0x6f, 0x7b, 0xa8, 0xa2, 
+  0xec, 0x12, 0x7b, 0x3c, 0xdf, 0xf3, 0x9b, 0x31, 0x39, 0x2b, 0x5f, 0x6f, 0x15, 0x6b, 0x84, 0x5f, 
+  0xa1, 0x33, 0xa1, 0xaf, 0x69, 0x87, 0x9a, 0xce, 0xef, 0x30, 0x27, 0x55, 0x56, 0x30, 0xca, 0x78, 
+  0x7a, 0xbf, 0xdd, 0x6e, 0x33, 0x49, 0x91, 0x46, 0x49, 0xfb, 0xe2, 0xfd, 0x82, 0xe9, 0x33, 0x16, 
+  0xa4, 0x40, 0x1b, 0x8b, 0x32, 0x67, 0x2f, 0x7e, 0x47, 0xfe, 0x22, 0xcd, 0x29, 0xcd, 0x19, 0x2f, 
+  0x31, 0xf7, 0x61, 0xa5, 0xbf, 0x6f, 0xd1, 0x09, 0x6f, 0x72, 0x29, 0x21, 0x47, 0xc5, 0xd3, 0x89, 
+  0xb3, 0x4b, 0x53, 0xfa, 0x86, 0x6b, 0x55, 0x55, 0x9a, 0xe0, 0x76, 0x46, 0xfc, 0x44, 0x9a, 0x34, 
+  0x0e, 0xdb, 0x97, 0x9e, 0x54, 0x1c, 0x9d, 0xe5, 0xd2, 0x8b, 0x7f, 0x25, 0xa5, 0xa8, 0xd3, 0x28, 
+  0x0c, 0xbf, 0xeb, 0x05, 0xca, 0x29, 0xbe, 0x4d, 0x0b, 0x99, 0x11, 0x02, 0xac, 0x28, 0x6a, 0x3b, 
+  0x9c, 0x0e, 0x0f, 0xbd, 0xa8, 0x57, 0x44, 0x1d, 0x0e, 0x87, 0x6c, 0x92, 0x6a, 0x0e, 0xa7, 0x11, 
+  0x18, 0xd3, 0x31, 0x4a, 0x4a, 0xef, 0xbe, 0x8a, 0xe4, 0xa7, 0x17, 0xe5, 0x06, 0xce, 0xb7, 0xa8, 
+  0x2c, 0xa5, 0x21, 0x8f, 0xa0, 0x8e, 0x28, 0xd7, 0x35, 0xcf, 0x2c, 0xce, 0x4b, 0x76, 0x38, 0x92, 
+  0x9f, 0x5e, 0xf0, 0xb4, 0x11, 0xb5, 0x5f, 0xd4, 0x84, 0x96, 0x9f, 0xe2, 0xe6, 0x73, 0xfc, 0xb0, 
+  0xc6, 0x6c, 0x2b, 0x3f, 0x7d, 0x50, 0x63, 0x04, 0x5c, 0x46, 0xe1, 0xca, 0x19, 0x66, 0xd1, 0xab, 
+  0xa3, 0x61, 0x1d, 0xdc, 0x2a, 0x04, 0x3b, 0xa7, 0xc1, 0x16, 0x9f, 0x8d, 0x0e, 0x02, 0x23, 0xaa, 
+  0xc2, 0x23, 0x03, 0x80, 0xd3, 0x64, 0xd7, 0xbe, 0xe8, 0x9f, 0x57, 0x4c, 0x4e, 0xb5, 0x48, 0x93, 
+  0x30, 0xcc, 0x04, 0x7e, 0x11, 0x3e, 0xa2, 0xe4, 0xd4, 0xa4, 0x14, 0x57, 0x22, 0x33, 0x1e, 0x0f, 
+  0x2d, 0x09, 0x9b, 0xe9, 0xd1, 0xeb, 0x5a, 0xd4, 0x38, 0x39, 0xf1, 0x33, 0xe2, 0x67, 0xd6, 0x94, 
+  0x9b, 0xbb, 0x29, 0xe4, 0x77, 0xfd, 0xea, 0x01, 0x23, 0xf4, 0x00, 0x42, 0x8d, 0x81, 0x61, 0x18, 
+  0xf6, 0x75, 0xbc, 0x30, 0x20, 0x06, 0x03, 0xc6, 0x54, 0x51, 0x4b, 0xb6, 0x03, 0x31, 0x36, 0x3a, 
+  0xfa, 0x82, 0xb5, 0x69, 0x6c, 0xfb, 0x62, 0x3b, 0xb2, 0x92, 0x5b, 0xbe, 0x34, 0x77, 0x58, 0x90, 
+  0xb6, 0xa5, 0xbb, 0x70, 0xe6, 0x00, 0xa9, 0x8b, 0x6d, 0xcc, 0x8f, 0x9c, 0x20, 0xea, 0x98, 0x62, 
+  0xb9, 0x2f, 0x3a, 0xc0, 0x69, 0xa3, 0x79, 0xbe, 0x97, 0x9f, 0xc1, 0x59, 0x7e, 0x0c, 0xa2, 0xbc, 
+  0xd0, 0x93, 0x12, 0xfb, 0x00, 0xd2, 0xdb, 0x89, 0xd5, 0x4a, 0x16, 0x94, 0x65, 0x39, 0x58, 0xc8, 
+  0x51, 0x49, 0x2e, 0x5d, 0x1a, 0xe1, 0xb3, 0x67, 0x7d, 0x75, 0xd5, 0xd4, 0xa8, 0x64, 0x57, 0x75, 
+  0xee, 0x60, 0xbe, 0xf2, 0x99, 0x9f, 0x72, 0xf4, 0x29, 0xdc, 0xc8, 0x4f, 0x90, 0x3c, 0x64, 0x53, 
+  0xde, 0xe8, 0xf4, 0x33, 0xce, 0x31, 0x9e, 0xd3, 0xc9, 0x22, 0xb9, 0x55, 0x17, 0x4a, 0xed, 0x7a, 
+  0xca, 0x74, 0xcd, 0x3c, 0x26, 0x03, 0xc5, 0xf6, 0x11, 0x18, 0x4a, 0xca, 0x1a, 0xd1, 0x6a, 0x85, 
+  0x12, 0xf6, 0x27, 0xca, 0xff, 0xd1, 0xc2, 0x3e, 0x90, 0xc1, 0xbc, 0x55, 0x94, 0x21, 0xa1, 0x73, 
+  0xb6, 0xa0, 0x18, 0x71, 0xf5, 0xd8, 0x07, 0x5c, 0x06, 0xd6, 0x6c, 0xaa, 0x67, 0xb3, 0xab, 0x9e, 
+  0xfb, 0x1f, 0xce, 0xb8, 0x24, 0xc8, 0xfb, 0x34, 0x81, 0x48, 0x72, 0x04, 0xe4, 0x7a, 0xb8, 0x69, 
+  0xb8, 0xd1, 0x4b, 0xa4, 0xa9, 0x21, 0xf6, 0x63, 0x29, 0xc8, 0xd8, 0xa2, 0x8b, 0x60, 0xfd, 0x7d, 
+  0x01, 0xb9, 0x80, 0x1b, 0x31, 0xda, 0x1e, 0xcd, 0x3d, 0x67, 0xfb, 0x18, 0x30, 0xc2, 0x93, 0xdf, 
+  0x28, 0x9e, 0xd2, 0x10, 0x10, 0x6a, 0x74, 0xe7, 0x20, 0x45, 0xab, 0xda, 0xb0, 0x06, 0xf7, 0x93, 
+  0x7a, 0x10, 0x40, 0x5b, 0x3d, 0x0f, 0x35, 0xa5, 0xad, 0xf4, 0x51, 0x86, 0xc2, 0x55, 0x3a, 0xd9, 
+  0xcb, 0x74, 0x1f, 0xaa, 0x57, 0x2b, 0x3c, 0xe9, 0x64, 0x47, 0x70, 0x45, 0xca, 0x0a, 0xbf, 0xe3, 
+  0x36, 0x5c, 0xf0, 0xeb, 0xf3, 0x0b, 0x24, 0x55, 0xb3, 0x84, 0x2a, 0x05, 0x34, 0x6e, 0xb8, 0x77, 
+  0x2a, 0x2d, 0xc6, 0x10, 0x87, 0x1e, 0xb8, 0x41, 0x7d, 0xc3, 0x45, 0x78, 0x75, 0xf2, 0x48, 0x0f, 
+  0xd8, 0x50, 0x6c, 0xbb, 0xcc, 0x8b, 0xc1, 0x93, 0x36, 0x54, 0x15, 0x10, 0x06, 0xcc, 0xf5, 0x4a, 
+  0x89, 0x0b, 0xc6, 0x91, 0x20, 0xac, 0xd1, 0x3c, 0x4a, 0xd2, 0xb5, 0x14, 0xbd, 0x82, 0x83, 0x29, 
+  0x69, 0xb0, 0x9f, 0x53, 0x56, 0x3c, 0xd9, 0x65, 0x0c, 0xb9, 0x67, 0xcc, 0x4a, 0xb4, 0x4a, 0x59, 
+  0x71, 0xe1, 0x1d, 0x88, 0x6d, 0x19, 0x51, 0x5c, 0xd9, 0x45, 0xc8, 0x93, 0x3a, 0x26, 0xda, 0xe4, 
+  0x14, 0x98, 0xca, 0x46, 0xb3, 0x86, 0xf9, 0x12, 0x91, 0xcc, 0x63, 0x51, 0x14, 0xe6, 0x40, 0xb0, 
+  0xe6, 0x26, 0xd3, 0x4c, 0x6c, 0xf8, 0x23, 0x4d, 0x7b, 0x11, 0x7f, 0x88, 0xd7, 0x16, 0x7f, 0x5f, 
+  0x22, 0x81, 0xbf, 0x6c, 0xac, 0x85, 0x8a, 0x50, 0x77, 0xa1, 0x45, 0x5d, 0x77, 0x05, 0x6f, 0x39, 
+  0x8b, 0xd2, 0x07, 0xee, 0x02, 0x39, 0xc3, 0xb1, 0x0e, 0x53, 0x5c, 0x88, 0xdb, 0x6a, 0xf7, 0x7d, 
+  0x57, 0xbd, 0x26, 0x63, 0xf8, 0x15, 0x9a, 0x5a, 0x99, 0x1b, 0xcb, 0x6c, 0x19, 0xe3, 0x23, 0x31, 
+  0x4f, 0x49, 0x4f, 0x59, 0x2b, 0x83, 0x80, 0xe8, 0x6d, 0x6a, 0xc1, 0xd2, 0x4c, 0x60, 0x6d, 0x08, 
+  0x38, 0xfe, 0xf3, 0x42, 0xb8, 0x74, 0xa2, 0x43, 0x10, 0x1d, 0xd1, 0x1e, 0xca, 0xda, 0xa5, 0x49, 
+  0x9f, 0x21, 0xd2, 0x73, 0xca, 0x38, 0x39, 0x16, 0x09, 0x5a, 0xa5, 0xfc, 0x1c, 0xa8, 0x7f, 0xbf, 
+  0xe2, 0xae, 0x93, 0x49, 0x3c, 0x24, 0x81, 0x8a, 0xa1, 0x4b, 0xff, 0x06, 0xa5, 0xce, 0x13, 0xab, 
+  0xe6, 0xa1, 0x05, 0x76, 0x58, 0x5c, 0x5a, 0x6f, 0xe1, 0xdb, 0xf9, 0xc2, 0x30, 0x7e, 0x44, 0x0a, 
+  0x20, 0x17, 0x87, 0x54, 0x60, 0x07, 0x9a, 0x3d, 0xf8, 0x75, 0xa8, 0xc0, 0xae, 0xe0, 0x18, 0x37, 
+  0xf3, 0xe2, 0x4e, 0x62, 0x55, 0x8c, 0xef, 0x8b, 0xbb, 0x09, 0xb3, 0x09, 0x8c, 0xc2, 0xf2, 0x37, 
+  0xb4, 0x7b, 0xdc, 0xb9, 0x7b, 0x8e, 0x56, 0x07, 0xa9, 0x55, 0x7f, 0x7f, 0x69, 0xe5, 0xea, 0x32, 
+  0x71, 0xc1, 0x6b, 0x7d, 0x20, 0xd1, 0x0f, 0x41, 0x5d, 0xf0, 0x5b, 0xad, 0xbb, 0xe7, 0x80, 0x60, 
+  0xb3, 0xfe, 0xad, 0x5b, 0x0e, 0xcc, 0x65, 0xdd, 0xbc, 0xb3, 0xcb, 0x94, 0x62, 0xcf, 0x98, 0x03, 
+  0xe4, 0x5d, 0xd3, 0x9a, 0x94, 0x25, 0x6e, 0x34, 0x61, 0x8a, 0x2a, 0x28, 0xbc, 0x9b, 0xc1, 0xd7, 
+  0xf4, 0xce, 0xbb, 0xcb, 0xdc, 0xb0, 0x18, 0x89, 0xa1, 0x01, 0x73, 0xe0, 0x57, 0xeb, 0x93, 0xb6, 
+  0x9f, 0x65, 0xe2, 0xb2, 0x2f, 0x6e, 0xe8, 0x35, 0x11, 0x45, 0x39, 0xa6, 0x96, 0x59, 0xff, 0x0d, 
+  0xb0, 0xec, 0x59, 0xcf, 0x45, 0x0e, 0x57, 0x69, 0xab, 0x43, 0xb9, 0xf0, 0x63, 0xac, 0x89, 0x83, 
+  0x1d, 0xfc, 0x50, 0x20, 0xe5, 0xac, 0x98, 0xaa, 0x53, 0x1d, 0x0b, 0xa6, 0x21, 0xb9, 0x34, 0x14, 
+  0x5b, 0xe8, 0x45, 0x8a, 0x64, 0x01, 0x85, 0xb6, 0x37, 0xd2, 0x5a, 0x3a, 0xf9, 0xf3, 0xc2, 0x68, 
+  0x33, 0x7c, 0xda, 0xf0, 0x63, 0x9f, 0x2a, 0x6a, 0x5c, 0x3c, 0x41, 0x79, 0x2c, 0xcf, 0x2d, 0x61, 
+  0x6b, 0x6c, 0x85, 0x2b, 0xec, 0x5d, 0xb7, 0x4a, 0x75, 0x3d, 0xf7, 0xcf, 0x57, 0xb4, 0x7e, 0xc7, 
+  0xa1, 0xa3, 0xd4, 0x0f, 0xa5, 0xcb, 0x7d, 0xc5, 0x98, 0x3c, 0x65, 0x85, 0x62, 0xb7, 0xda, 0x54, 
+  0xdc, 0x01, 0x4a, 0xa2, 0xc0, 0x19, 0x51, 0xea, 0x4b, 0x42, 0xfb, 0xb0, 0xc2, 0x43, 0x30, 0xd5, 
+  0xbf, 0x72, 0xd4, 0xa6, 0x39, 0xc7, 0xe8, 0xc9, 0x97, 0xbf, 0x81, 0x1e, 0x3d, 0x2f, 0x30, 0x6e, 
+  0x5b, 0x1c, 0xf6, 0xdb, 0xf2, 0x5b, 0x72, 0x6e, 0x19, 0x17, 0xa8, 0x11, 0x83, 0x97, 0x64, 0x76, 
+  0x98, 0xba, 0x07, 0x6d, 0xa6, 0xfd, 0x3e, 0xb8, 0x22, 0xde, 0x40, 0xc8, 0x6f, 0x36, 0xa1, 0x61, 
+  0x86, 0xd0, 0xfe, 0x10, 0x3e, 0xae, 0xb3, 0x18, 0x0f, 0x7a, 0x75, 0x72, 0x73, 0xe9, 0x2d, 0x34, 
+  0x0f, 0x67, 0x56, 0xaa, 0x83, 0x98, 0x73, 0xc6, 0x57, 0xe5, 0x1d, 0x93, 0x24, 0x89, 0xdf, 0x92, 
+  0xa7, 0x8e, 0x49, 0x69, 0xef, 0xe2, 0x0f, 0x84, 0x1b, 0xf3, 0x04, 0x37, 0x28, 0x47, 0x40, 0x3f, 
+  0xae, 0xa7, 0x15, 0xe1, 0x9d, 0xd0, 0xd7, 0xa3, 0xaf, 0x57, 0xa8, 0xbb, 0x12, 0x51, 0xc0, 0x65, 
+  0x8d, 0x75, 0x44, 0x4d, 0x05, 0x1c, 0x53, 0x18, 0x0f, 0x9e, 0xdf, 0x98, 0x0c, 0x0c, 0xe8, 0xca, 
+  0x70, 0x0e, 0x55, 0x28, 0x71, 0x0a, 0x2a, 0x48, 0xde, 0x64, 0xa9, 0xc9, 0x0d, 0x3f, 0x81, 0xbb, 
+  0xa6, 0xe1, 0xac, 0xeb, 0x65, 0x86, 0x33, 0x1d, 0xb4, 0x14, 0x99, 0x93, 0x2e, 0x20, 0x68, 0x5f, 
+  0xa8, 0xcb, 0x47, 0x98, 0x71, 0x93, 0x94, 0x43, 0x66, 0x65, 0xcb, 0x01, 0x41, 0x0e, 0x10, 0x86, 
+  0xd5, 0xc6, 0xfc, 0x4f, 0x73, 0x5c, 0x31, 0x8e, 0x27, 0x73, 0xa0, 0x62, 0x19, 0xbd, 0x08, 0x9c, 
+  0xc1, 0x2d, 0x26, 0x7f, 0x22, 0xc2, 0x17, 0x1c, 0xee, 0x2b, 0x7a, 0x2f, 0x48, 0xba, 0xcc, 0xfd, 
+  0xd9, 0xcf, 0xd8, 0x8c, 0x45, 0x73, 0x37, 0x98, 0x1b, 0xed, 0xc7, 0xce, 0xae, 0x1e, 0x95, 0xb6, 
+  0x89, 0x42, 0xc3, 0x11, 0xb5, 0xd7, 0xef, 0xe8, 0x2e, 0x6e, 0x0c, 0x2e, 0x58, 0x9d, 0x0e, 0x0d, 
+  0x6d, 0xc5, 0x8a, 0x4b, 0x37, 0x51, 0xda, 0x70, 0x1b, 0xaa, 0xfa, 0xb7, 0x68, 0x67, 0x7c, 0x07, 
+  0x03, 0x1c, 0xab, 0x61, 0xe5, 0x9c, 0xaa, 0x27, 0x08, 0x31, 0xfe, 0xfd, 0x93, 0x34, 0xe0, 0x21, 
+  0xf3, 0xcf, 0xdd, 0x3f, 0x6d, 0xbf, 0xbd, 0x35, 0x38, 0x2b, 0x50, 0xea, 0xdf, 0x66, 0x17, 0x18, 
+  0x75, 0xd7, 0xb4, 0x09, 0x06, 0x95, 0x66, 0x8d, 0x44, 0x66, 0x0a, 0x69, 0x2a, 0xf6, 0xae, 0x39, 
+  0x59, 0xbd, 0xb3, 0xb0, 0x3a, 0xca, 0xdb, 0xd3, 0xeb, 0xf0, 0x12, 0x46, 0xbd, 0x55, 0xb1, 0x80, 
+  0x28, 0x1e, 0x2e, 0xb5, 0x9d, 0x78, 0xa5, 0x38, 0x25, 0x02, 0x32, 0xb6, 0x70, 0x82, 0x6b, 0x6a, 
+  0x51, 0x05, 0x56, 0x2d, 0x2c, 0x41, 0xcf, 0x8a, 0xff, 0x2c, 0xf3, 0xe3, 0xc1, 0x9c, 0x45, 0x06, 
+  0x91, 0xbb, 0x5e, 0xde, 0xee, 0x03, 0x3d, 0x83, 0xe0, 0xa1, 0x9a, 0x55, 0x08, 0x03, 0xc0, 0x43, 
+  0xf9, 0x6e, 0xc7, 0x01, 0xc1, 0x30, 0x2a, 0x92, 0x10, 0xaf, 0x97, 0xed, 0xbf, 0x36, 0x85, 0x68, 
+  0x13, 0x1d, 0xf7, 0x9b, 0x08, 0xd0, 0x63, 0xfb, 0xa0, 0x86, 0x91, 0x46, 0x0b, 0x9d, 0x0d, 0x9b, 
+  0xbb, 0xaa, 0x3a, 0x84, 0x1f, 0x14, 0x11, 0x47, 0xdb, 0x4d, 0xbc, 0xdb, 0x6d, 0xa2, 0x28, 0x96, 
+  0xdd, 0x07, 0xa4, 0xd4, 0xca, 0x73, 0xa7, 0xb9, 0x1d, 0xe1, 0x31, 0xae, 0x0e, 0x1f, 0x14, 0x12, 
+  0x82, 0x0d, 0xfb, 0x4d, 0x9c, 0x1c, 0xb4, 0x88, 0x8e, 0x62, 0xdc, 0x2e, 0x45, 0x1c, 0xe3, 0x30, 
+  0xfc, 0xb0, 0x08, 0x29, 0x20, 0x1c, 0x45, 0xd4, 0xe3, 0xc0, 0x16, 0x4d, 0x2f, 0x30, 0xe4, 0xa5, 
+  0x65, 0xfd, 0x2a, 0x63, 0x5d, 0xc7, 0xfa, 0x40, 0x0f, 0x84, 0x3f, 0xa1, 0x21, 0xb6, 0x6a, 0x10, 
+  0xd4, 0x8b, 0x3f, 0x33, 0x36, 0xe2, 0xf7, 0x36, 0x2e, 0x1e, 0xb7, 0xf1, 0xb0, 0xf3, 0x1b, 0x8c, 
+  0x77, 0xc3, 0x4e, 0x15, 0xe6, 0x49, 0x94, 0xd8, 0x3b, 0xaa, 0x71, 0x9b, 0x74, 0x3f, 0x94, 0xb0, 
+  0xf7, 0xcd, 0xdf, 0xe8, 0x83, 0xa7, 0x9c, 0x68, 0x14, 0x00, 0x00, 0x00 };
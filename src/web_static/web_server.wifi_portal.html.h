@@ -1,2 +1,83 @@
-static const char CONTENT_WIFI_PORTAL_HTML[] PROGMEM = 
+static const char CONTENT_WIFI_PORTAL_HTML[] PROGMEM __attribute__((aligned(4))) = 
   "<!doctype html> <html lang=\"en\"> <head> <meta charset=\"utf-8\"> <title>OpenEVSE</title> <meta name=\"viewport\" content=\"width=device-width,initial-scale=1\"> <meta name=\"viewport\" content=\"width=device-width,user-scalable=no\"> <meta name=\"description\" content=\"OpenEVSE\"> <meta name=\"author\" content=\"OpenEVSE\"> <meta name=\"theme-color\" content=\"#000000\"> <link rel=\"stylesheet\" type=\"text/css\" href=\"style.css\"> <link rel=\"icon\" type=\"image/png\" href=\"favicon-32x32.png\" sizes=\"32x32\"> <link rel=\"icon\" type=\"image/png\" href=\"favicon-16x16.png\" sizes=\"16x16\"> </head> <body> <div id=\"page\"> <div class=\"header\"> <h1>Open<span>EVSE</span></h1> <h3>WiFi</h3> </div> <div class=\"container\"> <div class=\"box\" data-bind=\"visible: wifi.canConfigure() &amp;&amp; !wifi.wifiConnecting()\"> <h2>WiFi Setup</h2> <p><b>Mode:</b> <span id=\"mode\" data-bind=\"text: status.fullMode\"></span></p> <p>Connect to network:</p> <table> <thead> <tr> <th>Select</th> <th>Network</th> <th>RSSI dBm</th> </tr> </thead> <tbody id=\"networks\" data-bind=\"foreach: scan.results\"> <tr> <td><input class=\"networkcheckbox\" name=\"network\" data-bind=\"checkedValue: bssid(), checked: $root.wifi.bssid\" type=\"radio\"></td> <td data-bind=\"text: ssid\"></td> <td data-bind=\"text: rssi\"></td> </tr> </tbody> <tfoot data-bind=\"visible: 0 == scan.results().length\"> <tr> <td colspan=\"3\">Scanning...</td> </tr> </tfoot> </table> <p data-bind=\"text: config.ssid\"></p> <p> <b>Passkey:</b><br> <input type=\"text\" style=\"width:180px\" autocapitalize=\"none\" autocapitalize=\"none\" data-bind=\"textInput: config.pass\"> <button data-bind=\"click: wifi.saveNetwork, text: (wifi.saveNetworkFetching() ? 'Saving' : (wifi.saveNetworkSuccess() ? 'Saved' : 'Connect')), disable: wifi.saveNetworkFetching\">Connect</button> </p> <p>Connecting to a local WiFi network is not essential. OpenEVSE can be configured and controlled while in standalone WiFi AP (Access Point) mode:</p> <div> <button onclick=\"window.location.href='/home.html'\">WiFi Standalone Mode</button> </div> <p><i><span class=\"small-text\">Note: remote logging features e.g Emoncms will not work while in AP standalone mode</span></i></p> </div> <div class=\"box\" data-bind=\"visible: wifi.wifiConnecting() || !wifi.canConfigure()\"> <h2>Connecting to <span data-bind=\"text: config.ssid\"></span> ...</h2> <p>Please connect this device to <span data-bind=\"text: config.ssid\"></span> and navigate to the IP address displayed on your OpenEVSE display.</p> <p>Alternatively you can use <a href=\"http://openevse.local/\">http://openevse.local/</a> or <a href=\"http://openevse/\">http://openevse/</a></p> <div id=\"client-view\" data-bind=\"visible: status.isWifiClient\"> <button id=\"apoff\" data-bind=\"click: wifi.turnOffAccessPoint, disable: wifi.turnOffAccessPointFetching\">Continue</button> </div> </div> <div id=\"footer\"> <br><b> Powered by <a href=\"http://www.openevse.com\">OpenEVSE</a> and <a href=\"https://openenergymonitor.org\">OpenEnergyMonitor</a></b> <br> <b>Version: </b>V<span data-bind=\"text: config.version\"></span> </div> </div> </div> <script src=\"lib.js\"></script> <script src=\"wifi_portal.js\"></script> </body> </html> \n";
+static const char CONTENT_WIFI_PORTAL_HTML_GZ[] PROGMEM __attribute__((aligned(4))) = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x9d, 0x57, 0xdf, 0x6f, 0xdb, 0x36, 
+  0x10, 0x7e, 0xdf, 0x5f, 0xc1, 0x6a, 0xc3, 0x92, 0x00, 0xb5, 0xd4, 0x24, 0x40, 0x51, 0x78, 0xb6, 
+  0x86, 0x6e, 0x68, 0x81, 0x3c, 0xb4, 0x0d, 0x66, 0x20, 0x7d, 0x1c, 0x28, 0xf1, 0x24, 0x71, 0xa1, 
+  0x48, 0x81, 0xa4, 0xec, 0x78, 0xe8, 0x1f, 0xbf, 0xe3, 0x91, 0xfe, 0x21, 0xc7, 0x6d, 0xb1, 0xe6, 
+  0x21, 0x0a, 0x8f, 0xc7, 0xe3, 0xf1, 0xbb, 0xef, 0x3e, 0x32, 0x8b, 0x17, 0xc2, 0xd4, 0x7e, 0x3b, 
+  0x00, 0xeb, 0x7c, 0xaf, 0x4a, 0xb6, 0x08, 0x1f, 0xa6, 0xb8, 0x6e, 0x97, 0x19, 0xe8, 0x2c, 0x18, 
+  0x80, 0x0b, 0xfc, 0xf4, 0xe0, 0x39, 0xab, 0x3b, 0x6e, 0x1d, 0xf8, 0x65, 0x36, 0xfa, 0x66, 0xf6, 
+  0x26, 0xcc, 0x7a, 0xe9, 0x15, 0x94, 0x9f, 0x06, 0xd0, 0xef, 0x1e, 0x56, 0xef, 0x16, 0x45, 0x1c, 
+  0x27, 0x77, 0xcd, 0x7b, 0x58, 0x66, 0x6b, 0x09, 0x9b, 0xc1, 0x58, 0x9f, 0xb1, 0xda, 0x68, 0x0f, 
+  0x1a, 0x97, 0x6f, 0xa4, 0xf0, 0xdd, 0x52, 0xc0, 0x5a, 0xd6, 0x30, 0xa3, 0xc1, 0x4b, 0xa9, 0xa5, 
+  0x97, 0x5c, 0xcd, 0x5c, 0xcd, 0x15, 0x2c, 0xaf, 0xb3, 0x1f, 0x89, 0x31, 0x3a, 0xb0, 0x14, 0x80, 
+  0x57, 0x18, 0x43, 0x9b, 0x93, 0x20, 0x02, 0x5c, 0x6d, 0xe5, 0xe0, 0xa5, 0xd1, 0x47, 0x71, 0x76, 
+  0xb9, 0x9f, 0x38, 0xf3, 0xd1, 0x77, 0xc6, 0x7e, 0xdf, 0xcf, 0x77, 0xd0, 0xc3, 0xac, 0x36, 0x6a, 
+  0xe2, 0xfc, 0xf3, 0x2b, 0xfa, 0x09, 0xbe, 0x4a, 0xea, 0x47, 0x66, 0x41, 0x2d, 0x33, 0xe7, 0xb7, 
+  0x0a, 0x5c, 0x07, 0x80, 0xc7, 0x08, 0x90, 0xe3, 0x62, 0x78, 0xf2, 0x45, 0xed, 0x5c, 0xc6, 0x3a, 
+  0x0b, 0x4d, 0xf2, 0xc8, 0x83, 0x61, 0xb2, 0x50, 0xd6, 0x21, 0xe3, 0xb8, 0x44, 0xf6, 0xbc, 0x85, 
+  0x62, 0xd0, 0xed, 0x6e, 0x4d, 0xc3, 0xd7, 0x61, 0x7e, 0x76, 0x7b, 0xf3, 0x74, 0x7b, 0x93, 0xd3, 
+  0x84, 0x93, 0xff, 0x82, 0x5b, 0x66, 0x64, 0xf9, 0x81, 0x48, 0xd7, 0xaf, 0x9f, 0xae, 0x5f, 0x4f, 
+  0x22, 0x91, 0x25, 0x44, 0x2a, 0x12, 0x1b, 0x2a, 0x23, 0xb6, 0xf8, 0x11, 0x72, 0xcd, 0xa4, 0x58, 
+  0x66, 0x03, 0x46, 0xca, 0xd2, 0xb8, 0x56, 0xdc, 0xe1, 0x92, 0xe0, 0x08, 0x96, 0x08, 0x74, 0x4d, 
+  0xfc, 0x58, 0xb8, 0x81, 0xeb, 0x32, 0xb2, 0x84, 0xfe, 0xc4, 0x60, 0xd7, 0x61, 0xfa, 0xb6, 0xfc, 
+  0x2c, 0xdf, 0x4b, 0x1c, 0xdd, 0x86, 0x0d, 0x30, 0xc4, 0x34, 0x50, 0xc0, 0x94, 0x4b, 0x1d, 0x63, 
+  0x1d, 0xd9, 0x2b, 0xf3, 0x94, 0x31, 0xc1, 0x3d, 0x9f, 0x55, 0x52, 0x8b, 0x40, 0x11, 0x27, 0xb1, 
+  0xec, 0x73, 0xb6, 0x91, 0x8d, 0xcc, 0x6b, 0xae, 0xff, 0x34, 0xba, 0x91, 0xed, 0x68, 0xe1, 0xf2, 
+  0x8a, 0xfd, 0xca, 0xfb, 0xe1, 0x37, 0xfa, 0xc5, 0x5e, 0xd0, 0x7c, 0xf8, 0x85, 0x0e, 0x1a, 0x6a, 
+  0x2f, 0x75, 0x7b, 0x79, 0x45, 0x89, 0xde, 0x50, 0x26, 0x6c, 0x05, 0x7e, 0x1c, 0x30, 0x9f, 0x1b, 
+  0xb4, 0x0d, 0xe5, 0xa2, 0x2a, 0x3f, 0x18, 0x01, 0xf3, 0x45, 0x51, 0xe1, 0x38, 0x64, 0x4e, 0x47, 
+  0xee, 0xd1, 0x36, 0xd9, 0x3f, 0xd4, 0x72, 0xce, 0x9c, 0xe7, 0x7e, 0x74, 0x79, 0x33, 0x2a, 0x15, 
+  0x56, 0x65, 0xe5, 0xfe, 0xb0, 0x03, 0x45, 0x4b, 0x7b, 0x32, 0x6f, 0x98, 0x06, 0xbf, 0x31, 0xf6, 
+  0x71, 0x1e, 0xa7, 0x7c, 0xe0, 0x6c, 0xf8, 0x26, 0x84, 0xbd, 0xa5, 0x41, 0xb9, 0x02, 0x85, 0xfe, 
+  0xd8, 0x58, 0x5d, 0x1c, 0x7f, 0x8c, 0xab, 0x0e, 0x86, 0xbf, 0x56, 0xab, 0x3b, 0x26, 0xfe, 0xe8, 
+  0x93, 0xa5, 0xa0, 0x85, 0xc5, 0x3e, 0x4c, 0xa8, 0x14, 0x25, 0x9c, 0xb6, 0x73, 0x93, 0xa4, 0x1b, 
+  0x63, 0x81, 0xd7, 0x1d, 0xe6, 0x8d, 0x80, 0xe5, 0x16, 0xdc, 0xa8, 0x3c, 0x91, 0x2f, 0x6e, 0x2f, 
+  0xca, 0x85, 0xd4, 0xc3, 0xe8, 0x77, 0x98, 0xa7, 0x18, 0x75, 0x07, 0xf5, 0x23, 0xe1, 0x1f, 0x7b, 
+  0x20, 0x99, 0x27, 0x91, 0xc9, 0x07, 0xc4, 0x03, 0x57, 0x23, 0xd6, 0xa4, 0x72, 0x4e, 0x8a, 0xcb, 
+  0xab, 0x97, 0x2c, 0x99, 0xe7, 0xec, 0x17, 0x6b, 0x8c, 0xa7, 0x32, 0xe4, 0x34, 0xb9, 0x63, 0xa5, 
+  0xe5, 0x42, 0x9a, 0x00, 0x9b, 0xa7, 0xf4, 0xc5, 0x19, 0x88, 0x83, 0xf7, 0xb7, 0x1c, 0x2c, 0x7a, 
+  0xec, 0x1d, 0x76, 0x78, 0x24, 0xc6, 0xfa, 0x06, 0xb7, 0x3d, 0x4b, 0x9b, 0x57, 0x6c, 0xb9, 0x9c, 
+  0xc0, 0x70, 0x79, 0x95, 0x2b, 0xd0, 0xad, 0xef, 0x8e, 0xf0, 0xc0, 0x0e, 0x57, 0xa1, 0x9e, 0xd8, 
+  0x5c, 0x59, 0xb9, 0x42, 0x67, 0x8d, 0xec, 0xc9, 0xf3, 0xfc, 0x64, 0xb3, 0xb0, 0x09, 0xfd, 0x91, 
+  0x8a, 0x3a, 0x3c, 0x4f, 0xb2, 0x26, 0x76, 0xe6, 0xbb, 0xc3, 0x44, 0x76, 0x60, 0x63, 0x95, 0xf7, 
+  0x88, 0xf4, 0x23, 0x6c, 0x89, 0x6f, 0x8b, 0x2a, 0xc4, 0x8b, 0x25, 0x38, 0x28, 0x06, 0xb6, 0x65, 
+  0xd0, 0x89, 0x24, 0x81, 0xf3, 0xeb, 0x37, 0xaf, 0x06, 0x2c, 0x05, 0x0a, 0x96, 0xa9, 0xf9, 0x20, 
+  0x3d, 0x57, 0xd8, 0xb4, 0x58, 0x14, 0xa3, 0xe1, 0x6b, 0xd6, 0x93, 0x6c, 0xee, 0xc2, 0x06, 0xfb, 
+  0x94, 0x06, 0x1e, 0xf5, 0xa7, 0x1a, 0xbd, 0x37, 0x7a, 0x52, 0x53, 0x25, 0xeb, 0xc7, 0xd4, 0x60, 
+  0x8e, 0xaf, 0x21, 0x71, 0xf1, 0x25, 0x8b, 0x47, 0xba, 0x3c, 0x9d, 0x78, 0x0f, 0xbe, 0xee, 0xa8, 
+  0xbd, 0xd8, 0xef, 0xec, 0x62, 0x85, 0xf2, 0xa2, 0xdb, 0x0b, 0x76, 0xc6, 0x71, 0x35, 0xd6, 0x35, 
+  0x38, 0xb7, 0xf7, 0x03, 0x11, 0xdc, 0x2e, 0x52, 0xb3, 0x5c, 0x5c, 0x21, 0x71, 0x84, 0x74, 0xfc, 
+  0xd0, 0xde, 0x67, 0x36, 0xc9, 0x76, 0xbd, 0x85, 0xc0, 0x51, 0xe6, 0xa1, 0x00, 0x93, 0xa6, 0x43, 
+  0xa7, 0xd0, 0x77, 0x9c, 0x29, 0x84, 0x44, 0x31, 0xea, 0xf5, 0x44, 0x5d, 0x26, 0x1d, 0xd3, 0x48, 
+  0x0c, 0x4c, 0x02, 0xf5, 0x1b, 0xef, 0xa1, 0x9c, 0xed, 0xf4, 0x9e, 0x61, 0x95, 0x59, 0x05, 0x09, 
+  0x1d, 0x94, 0x13, 0xc1, 0xb8, 0x16, 0x24, 0xf5, 0xd6, 0x28, 0x85, 0xc3, 0x4d, 0x27, 0x15, 0x30, 
+  0xa9, 0x43, 0xf3, 0x6b, 0xc1, 0x15, 0x42, 0x1c, 0x83, 0xbf, 0xbd, 0x67, 0x97, 0x6f, 0xe9, 0x64, 
+  0xec, 0xde, 0x48, 0xed, 0xaf, 0x58, 0x1f, 0x95, 0x64, 0x88, 0x52, 0x76, 0x00, 0xd9, 0x68, 0xc2, 
+  0x36, 0x94, 0x54, 0x0b, 0xb3, 0xc9, 0x43, 0x86, 0xe1, 0x9e, 0xca, 0x49, 0x99, 0x2f, 0x8a, 0xce, 
+  0xf4, 0x90, 0x87, 0xab, 0xf9, 0x22, 0x4b, 0x1a, 0x75, 0xd8, 0x2a, 0xe8, 0xcc, 0xf1, 0x99, 0x63, 
+  0x60, 0x14, 0x2e, 0x59, 0x46, 0xb9, 0x4a, 0xcd, 0xeb, 0x7a, 0xae, 0xd4, 0x8c, 0x08, 0x54, 0x7e, 
+  0x34, 0x1e, 0xa1, 0xb4, 0xd0, 0xe3, 0x17, 0xe1, 0x68, 0xdb, 0x80, 0x4d, 0x03, 0xa8, 0x5d, 0x48, 
+  0x7e, 0x06, 0x79, 0xcb, 0xde, 0xf5, 0x98, 0x53, 0xef, 0x10, 0x6e, 0xa5, 0x08, 0x1a, 0x82, 0x69, 
+  0x7f, 0x54, 0x3c, 0xda, 0xd1, 0x69, 0x7b, 0x4a, 0x21, 0x09, 0x9d, 0x4c, 0x74, 0x7e, 0x2e, 0xe5, 
+  0xdf, 0x96, 0xec, 0x53, 0x49, 0x66, 0x5f, 0xbe, 0x24, 0xb1, 0x9e, 0x8a, 0x79, 0x92, 0xea, 0x69, 
+  0x51, 0xe3, 0x49, 0xbf, 0xd7, 0x65, 0x94, 0x21, 0xa3, 0x7e, 0x4d, 0xea, 0x7e, 0xaf, 0x80, 0x3b, 
+  0x2a, 0x6e, 0x94, 0xe5, 0x0e, 0x89, 0x10, 0xdf, 0x14, 0xff, 0x37, 0x6a, 0x20, 0x85, 0x46, 0x8a, 
+  0xb7, 0xdc, 0xd3, 0x5a, 0x54, 0x60, 0x76, 0x77, 0xcf, 0xb8, 0x10, 0x36, 0x10, 0x00, 0xf9, 0x3b, 
+  0x28, 0xbe, 0x45, 0xba, 0x60, 0xb9, 0xb7, 0x66, 0xb4, 0x07, 0x82, 0xa5, 0xa9, 0x7c, 0x47, 0xd7, 
+  0xb7, 0xca, 0x83, 0xd5, 0x58, 0xff, 0x35, 0xa8, 0x6d, 0xf0, 0x25, 0x0a, 0xe2, 0xe3, 0x86, 0x2d, 
+  0x78, 0xba, 0xaa, 0x3b, 0xef, 0x87, 0x79, 0x51, 0x18, 0x0c, 0x01, 0x6b, 0x07, 0xc4, 0x17, 0x55, 
+  0x64, 0xe5, 0x79, 0xfb, 0xa2, 0xe0, 0x25, 0x33, 0xf6, 0xab, 0xcb, 0x9f, 0x2f, 0xa4, 0x25, 0x7b, 
+  0x9e, 0xd2, 0xfd, 0x81, 0x04, 0xc5, 0xd6, 0x98, 0x85, 0x97, 0xd8, 0xf9, 0x22, 0xa6, 0xab, 0x4f, 
+  0xba, 0xcf, 0xa1, 0x90, 0xe4, 0x7d, 0x24, 0x23, 0x21, 0x04, 0x1f, 0x4c, 0xd3, 0x64, 0x5f, 0x53, 
+  0x14, 0xe4, 0x9e, 0xfe, 0xd4, 0x34, 0xb1, 0x61, 0xa8, 0x5f, 0x4e, 0xbb, 0xfe, 0xb9, 0xc7, 0xa4, 
+  0xf9, 0x91, 0x0b, 0xe3, 0x99, 0x4e, 0x38, 0xe2, 0xa1, 0xa4, 0x2b, 0x0f, 0x39, 0x4f, 0x8f, 0x09, 
+  0x14, 0x57, 0xd4, 0x5b, 0x6c, 0xcd, 0x0d, 0x84, 0xae, 0xae, 0xb6, 0xcf, 0x00, 0xda, 0x6c, 0x36, 
+  0xf9, 0x1e, 0xcb, 0xda, 0xf4, 0xd9, 0xd1, 0x4b, 0x97, 0xc7, 0x92, 0x4f, 0x96, 0xb8, 0x1d, 0x84, 
+  0xf8, 0x5c, 0x69, 0xb7, 0xd8, 0x41, 0xd2, 0x1b, 0x9b, 0x1b, 0xdb, 0xa6, 0x85, 0x64, 0xfe, 0x10, 
+  0xcd, 0x11, 0xe1, 0x2a, 0xe6, 0x11, 0x84, 0xff, 0x01, 0xac, 0xc3, 0x96, 0x9f, 0xb3, 0x60, 0x7d, 
+  0xf8, 0x36, 0xf5, 0xd6, 0xd1, 0xf7, 0xc0, 0xbe, 0x93, 0xc3, 0xa6, 0x4f, 0x7c, 0xef, 0x32, 0x67, 
+  0xeb, 0x65, 0xa6, 0x64, 0x95, 0xff, 0xe3, 0x68, 0x05, 0x59, 0x4f, 0xa6, 0x03, 0xc0, 0x7f, 0x87, 
+  0x27, 0x36, 0x6a, 0xdf, 0x89, 0x5b, 0x91, 0xee, 0xce, 0x22, 0xfe, 0x8b, 0xf0, 0xd3, 0x7f, 0x78, 
+  0xc0, 0x99, 0x42, 0x34, 0x0c, 0x00, 0x00, 0x00 };
@@ -1,3 +1,35 @@
-static const char CONTENT_WIFI_PORTAL_JS[] PROGMEM = 
+static const char CONTENT_WIFI_PORTAL_JS[] PROGMEM __attribute__((aligned(4))) = 
   "\"use strict\";function WiFiPortalViewModel(t,n){var e=this;e.baseHost=ko.observable(\"\"!==t?t:\"openevse.local\"),e.basePort=ko.observable(n),e.baseEndpoint=ko.pureComputed(function(){var t=\"//\"+e.baseHost();return 80!==e.basePort()&&(t+=\":\"+e.basePort()),t}),e.config=new ConfigViewModel(e.baseEndpoint),e.status=new StatusViewModel(e.baseEndpoint),e.scan=new WiFiScanViewModel(e.baseEndpoint),e.wifi=new WiFiConfigViewModel(e.baseEndpoint,e.config,e.status,e.scan),e.initialised=ko.observable(!1),e.updating=ko.observable(!1);var i=null;e.start=function(){e.updating(!0),e.config.update(function(){e.status.update(function(){e.initialised(!0),i=setTimeout(e.update,5e3),e.updating(!1)})})},e.update=function(){e.updating()||(e.updating(!0),null!==i&&(clearTimeout(i),i=null),e.status.update(function(){i=setTimeout(e.update,5e3),e.updating(!1)}))}}function scaleString(t,n,e){return(parseInt(t)/n).toFixed(e)}!function(){var n=window.location.hostname,e=window.location.port;$(function(){var t=new WiFiPortalViewModel(n,e);ko.applyBindings(t),t.start()})}();\n"
   "//# sourceMappingURL=wifi_portal.js.map\n";
+static const char CONTENT_WIFI_PORTAL_JS_GZ[] PROGMEM __attribute__((aligned(4))) = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x95, 0x93, 0x6f, 0x6b, 0xdb, 0x30, 
+  0x10, 0xc6, 0xdf, 0xf7, 0x53, 0x38, 0xde, 0x28, 0x12, 0x35, 0x76, 0xc7, 0x18, 0x8c, 0x1a, 0x31, 
+  0x58, 0x59, 0xd9, 0x60, 0x85, 0xb1, 0xec, 0xcf, 0xcb, 0xa1, 0xd8, 0x97, 0xf6, 0x36, 0x45, 0x12, 
+  0xd6, 0x29, 0xde, 0x68, 0xfd, 0xdd, 0x27, 0xd9, 0x75, 0x9c, 0x3a, 0x5d, 0x60, 0xf8, 0x8d, 0xac, 
+  0x7b, 0x74, 0xf7, 0xd3, 0xe9, 0xb9, 0xd4, 0x3b, 0x48, 0x1c, 0x35, 0x58, 0x51, 0x5a, 0xae, 0xbd, 
+  0xae, 0x08, 0x8d, 0x4e, 0xbe, 0xe3, 0x15, 0x7e, 0x32, 0x0d, 0x49, 0xf5, 0x0d, 0xa1, 0xbd, 0x36, 
+  0x35, 0x28, 0x46, 0x99, 0xe6, 0x77, 0x5b, 0xd9, 0x24, 0x20, 0xe8, 0x16, 0x5d, 0x09, 0xf9, 0x4a, 
+  0x3a, 0x78, 0x6f, 0x1c, 0x89, 0x5f, 0x26, 0x37, 0x2b, 0x07, 0xcd, 0x56, 0xae, 0x14, 0xb0, 0x34, 
+  0x5d, 0x08, 0x41, 0x6f, 0xe8, 0x22, 0x35, 0x16, 0x34, 0x6c, 0x1d, 0xe4, 0xca, 0x54, 0x52, 0xa5, 
+  0x3c, 0x1b, 0xce, 0xc4, 0xcc, 0xb3, 0x33, 0x7a, 0x8c, 0xbd, 0xd3, 0xb5, 0x35, 0xa8, 0xfb, 0xb8, 
+  0xf5, 0x0d, 0x5c, 0x9a, 0x8d, 0xf5, 0x04, 0x35, 0x1b, 0xd9, 0xd8, 0x00, 0x41, 0x22, 0x2d, 0x8a, 
+  0xf4, 0x6c, 0x82, 0x60, 0xbc, 0x6c, 0x80, 0x7c, 0xa3, 0x93, 0xd7, 0xe7, 0xa1, 0xfe, 0x54, 0x89, 
+  0xf1, 0xd3, 0x53, 0x46, 0x67, 0x22, 0xbd, 0x18, 0xe5, 0xc3, 0x2e, 0xcf, 0xa8, 0x8b, 0x55, 0x2b, 
+  0xa3, 0xd7, 0x78, 0x23, 0x34, 0xb4, 0xc9, 0x65, 0xbf, 0x9c, 0xae, 0xfc, 0x18, 0x29, 0x8a, 0x1d, 
+  0x49, 0xf2, 0xae, 0x17, 0x2f, 0xfb, 0xe5, 0x51, 0x71, 0x25, 0x75, 0x2f, 0x8d, 0xed, 0x5c, 0x86, 
+  0x9f, 0x63, 0xe2, 0x16, 0xd7, 0xb8, 0x13, 0x1f, 0x07, 0xd9, 0x41, 0xef, 0x80, 0x1e, 0x8a, 0xc5, 
+  0x3c, 0xa8, 0x91, 0x50, 0x2a, 0x74, 0x50, 0xcf, 0x7a, 0xbc, 0x78, 0x11, 0xe3, 0xde, 0xd6, 0x92, 
+  0x50, 0xdf, 0x1c, 0x06, 0xcb, 0xd8, 0xd7, 0xc0, 0xe0, 0x95, 0x2a, 0xfb, 0xc4, 0xe1, 0x95, 0xf6, 
+  0xba, 0x3e, 0x1d, 0x65, 0x8b, 0xf3, 0xa9, 0x71, 0xc3, 0x2e, 0xb0, 0x47, 0xca, 0x81, 0xea, 0xc9, 
+  0xd0, 0x1e, 0x5f, 0x9f, 0x07, 0x85, 0x03, 0xfa, 0x82, 0x1b, 0x30, 0x9e, 0xd8, 0x43, 0x0d, 0xc8, 
+  0x5e, 0xc1, 0xcb, 0x7d, 0xd8, 0x88, 0xd7, 0xc5, 0x6f, 0xdc, 0x83, 0x7f, 0x90, 0xf1, 0xfb, 0x7b, 
+  0x36, 0x03, 0x8d, 0xf7, 0x09, 0x86, 0xc0, 0xe0, 0x82, 0x4a, 0x81, 0x6c, 0xc6, 0x5a, 0x18, 0x6b, 
+  0xc7, 0xe0, 0xf4, 0xae, 0x4f, 0x00, 0xff, 0x07, 0x1e, 0xef, 0xba, 0xdd, 0x00, 0x85, 0xd7, 0x50, 
+  0xb0, 0x0c, 0x63, 0x15, 0x82, 0x61, 0x70, 0x32, 0xe0, 0x77, 0x83, 0x3b, 0x99, 0x95, 0x8d, 0x83, 
+  0x0f, 0x9a, 0x18, 0xf1, 0x42, 0xf3, 0x9c, 0xcc, 0x15, 0xfe, 0x0e, 0xad, 0x00, 0xde, 0x2d, 0x66, 
+  0x16, 0xd7, 0xa2, 0x45, 0x5d, 0x9b, 0xb6, 0x9f, 0x9e, 0xb8, 0x9f, 0xdf, 0x06, 0x9f, 0x6b, 0xb9, 
+  0x81, 0x0c, 0x0e, 0x42, 0x36, 0x78, 0xba, 0x7c, 0x7e, 0x38, 0x25, 0xa3, 0xa3, 0xe6, 0xd3, 0x1c, 
+  0x91, 0xca, 0x60, 0x01, 0x69, 0xad, 0xfa, 0xf3, 0x36, 0x24, 0x0b, 0xa4, 0x2e, 0x30, 0x65, 0x34, 
+  0xbc, 0x3c, 0x8b, 0xdd, 0x0e, 0x33, 0x75, 0x52, 0x14, 0xcf, 0x12, 0x67, 0x7c, 0x53, 0xc1, 0x75, 
+  0xd0, 0x06, 0xd5, 0xd7, 0xcf, 0x1f, 0x45, 0x34, 0xeb, 0x0f, 0xdb, 0xa7, 0xcc, 0x7f, 0xba, 0x7c, 
+  0x23, 0xed, 0xc9, 0x5f, 0x02, 0x30, 0xab, 0xcd, 0x49, 0x04, 0x00, 0x00, 0x00 };
@@ -9,16 +9,27 @@
 #include "web_server.style.css.h"
 #include "web_server.wifi_portal.html.h"
 #include "web_server.wifi_portal.js.h"
+static const char STATIC_FILE_NAME_ASSETS_JS[] PROGMEM = "/assets.js";
+static const char STATIC_FILE_NAME_EMONCMS_JPG[] PROGMEM = "/emoncms.jpg";
+static const char STATIC_FILE_NAME_FAVICON_16X16_PNG[] PROGMEM = "/favicon-16x16.png";
+static const char STATIC_FILE_NAME_FAVICON_32X32_PNG[] PROGMEM = "/favicon-32x32.png";
+static const char STATIC_FILE_NAME_HOME_HTML[] PROGMEM = "/home.html";
+static const char STATIC_FILE_NAME_HOME_JS[] PROGMEM = "/home.js";
+static const char STATIC_FILE_NAME_LIB_JS[] PROGMEM = "/lib.js";
+static const char STATIC_FILE_NAME_OHM_JPG[] PROGMEM = "/ohm.jpg";
+static const char STATIC_FILE_NAME_STYLE_CSS[] PROGMEM = "/style.css";
+static const char STATIC_FILE_NAME_WIFI_PORTAL_HTML[] PROGMEM = "/wifi_portal.html";
+static const char STATIC_FILE_NAME_WIFI_PORTAL_JS[] PROGMEM = "/wifi_portal.js";
 StaticFile staticFiles[] = {
-  { "/assets.js", CONTENT_ASSETS_JS, sizeof(CONTENT_ASSETS_JS) - 1, _CONTENT_TYPE_JS },
-  { "/emoncms.jpg", CONTENT_EMONCMS_JPG, sizeof(CONTENT_EMONCMS_JPG) - 1, _CONTENT_TYPE_JPEG },
-  { "/favicon-16x16.png", CONTENT_FAVICON_16X16_PNG, sizeof(CONTENT_FAVICON_16X16_PNG) - 1, _CONTENT_TYPE_PNG },
-  { "/favicon-32x32.png", CONTENT_FAVICON_32X32_PNG, sizeof(CONTENT_FAVICON_32X32_PNG) - 1, _CONTENT_TYPE_PNG },
-  { "/home.html", CONTENT_HOME_HTML, sizeof(CONTENT_HOME_HTML) - 1, _CONTENT_TYPE_HTML },
-  { "/home.js", CONTENT_HOME_JS, sizeof(CONTENT_HOME_JS) - 1, _CONTENT_TYPE_JS },
-  { "/lib.js", CONTENT_LIB_JS, sizeof(CONTENT_LIB_JS) - 1, _CONTENT_TYPE_JS },
-  { "/ohm.jpg", CONTENT_OHM_JPG, sizeof(CONTENT_OHM_JPG) - 1, _CONTENT_TYPE_JPEG },
-  { "/style.css", CONTENT_STYLE_CSS, sizeof(CONTENT_STYLE_CSS) - 1, _CONTENT_TYPE_CSS },
-  { "/wifi_portal.html", CONTENT_WIFI_PORTAL_HTML, sizeof(CONTENT_WIFI_PORTAL_HTML) - 1, _CONTENT_TYPE_HTML },
-  { "/wifi_portal.js", CONTENT_WIFI_PORTAL_JS, sizeof(CONTENT_WIFI_PORTAL_JS) - 1, _CONTENT_TYPE_JS },
+  { STATIC_FILE_NAME_ASSETS_JS, STATIC_FILE_IDENTITY(CONTENT_ASSETS_JS), STATIC_FILE_GZIP(CONTENT_ASSETS_JS_GZ), _CONTENT_TYPE_JS, 0xdc0a8f0a },
+  { STATIC_FILE_NAME_EMONCMS_JPG, STATIC_FILE_IDENTITY(CONTENT_EMONCMS_JPG), STATIC_FILE_GZIP(CONTENT_EMONCMS_JPG_GZ), _CONTENT_TYPE_JPEG, 0x6257bd7d },
+  { STATIC_FILE_NAME_FAVICON_16X16_PNG, CONTENT_FAVICON_16X16_PNG, sizeof(CONTENT_FAVICON_16X16_PNG) - 1, NULL, 0, _CONTENT_TYPE_PNG, 0xa21e1d83 },
+  { STATIC_FILE_NAME_FAVICON_32X32_PNG, CONTENT_FAVICON_32X32_PNG, sizeof(CONTENT_FAVICON_32X32_PNG) - 1, NULL, 0, _CONTENT_TYPE_PNG, 0x62a49ec1 },
+  { STATIC_FILE_NAME_HOME_HTML, STATIC_FILE_IDENTITY(CONTENT_HOME_HTML), STATIC_FILE_GZIP(CONTENT_HOME_HTML_GZ), _CONTENT_TYPE_HTML, 0xd2bc6dd7 },
+  { STATIC_FILE_NAME_HOME_JS, STATIC_FILE_IDENTITY(CONTENT_HOME_JS), STATIC_FILE_GZIP(CONTENT_HOME_JS_GZ), _CONTENT_TYPE_JS, 0xbaf81fa8 },
+  { STATIC_FILE_NAME_LIB_JS, STATIC_FILE_IDENTITY(CONTENT_LIB_JS), STATIC_FILE_GZIP(CONTENT_LIB_JS_GZ), _CONTENT_TYPE_JS, 0x7bf8f74e },
+  { STATIC_FILE_NAME_OHM_JPG, STATIC_FILE_IDENTITY(CONTENT_OHM_JPG), STATIC_FILE_GZIP(CONTENT_OHM_JPG_GZ), _CONTENT_TYPE_JPEG, 0x6d38d9ca },
+  { STATIC_FILE_NAME_STYLE_CSS, STATIC_FILE_IDENTITY(CONTENT_STYLE_CSS), STATIC_FILE_GZIP(CONTENT_STYLE_CSS_GZ), _CONTENT_TYPE_CSS, 0x05a55a17 },
+  { STATIC_FILE_NAME_WIFI_PORTAL_HTML, STATIC_FILE_IDENTITY(CONTENT_WIFI_PORTAL_HTML), STATIC_FILE_GZIP(CONTENT_WIFI_PORTAL_HTML_GZ), _CONTENT_TYPE_HTML, 0xb44d9a40 },
+  { STATIC_FILE_NAME_WIFI_PORTAL_JS, STATIC_FILE_IDENTITY(CONTENT_WIFI_PORTAL_JS), STATIC_FILE_GZIP(CONTENT_WIFI_PORTAL_JS_GZ), _CONTENT_TYPE_JS, 0x9f075bd8 },
 };